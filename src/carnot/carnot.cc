@@ -100,6 +100,10 @@ class CarnotImpl final : public Carnot {
 
   // The id of the agent that owns this Carnot instance.
   sole::uuid agent_id_;
+
+  // Time-slices the queries concurrently executing on this instance, so a heavy ad-hoc query
+  // can't monopolize the cores that latency-sensitive queries need.
+  exec::QueryScheduler query_scheduler_;
 };
 
 Status CarnotImpl::Init(const sole::uuid& agent_id, std::unique_ptr<udf::Registry> func_registry,
@@ -328,6 +332,9 @@ Status CarnotImpl::ExecutePlan(const planpb::Plan& logical_plan, const sole::uui
   // For each of the plan fragments in the plan, execute the query.
   std::vector<std::string> output_table_strs;
   auto exec_state = engine_state_->CreateExecState(query_id);
+  // A standing query key marks a plan that is re-executed periodically; memory sources park
+  // their cursors under it between executions so each run only scans newly added rows.
+  exec_state->set_standing_query_key(logical_plan.plan_options().standing_query_key());
   auto outgoing_conns = GetOutgoingConns(exec_state.get(), logical_plan);
   PX_RETURN_IF_ERROR(InitiateOutgoingConns(query_id, outgoing_conns,
                                            engine_state_->add_auth_to_grpc_context_func()));
@@ -352,12 +359,16 @@ Status CarnotImpl::ExecutePlan(const planpb::Plan& logical_plan, const sole::uui
   // share the schema between plan fragments.
   auto schema = std::make_unique<table_store::schema::Schema>();
   std::vector<statuspb::Status> incoming_errors;
+  // Wait for an execution slot before running the plan. The ticket's yield points then time-slice
+  // this query against the other queries executing on this instance, highest priority first.
+  auto query_ticket = query_scheduler_.Admit(logical_plan.plan_options().priority());
   auto s =
       plan::PlanWalker()
           .OnPlanFragment([&](auto* pf) {
             auto exec_graph = exec::ExecutionGraph();
             PX_RETURN_IF_ERROR(exec_graph.Init(schema.get(), plan_state.get(), exec_state.get(), pf,
                                                /* collect_exec_node_stats */ analyze));
+            exec_graph.set_query_ticket(query_ticket.get());
             PX_RETURN_IF_ERROR(exec_graph.Execute());
 
             // We must get this while exec_graph is alive. ExecutionGraph destructor calls
@@ -375,6 +386,12 @@ Status CarnotImpl::ExecutePlan(const planpb::Plan& logical_plan, const sole::uui
                     absl::Substitute("$0 (id=$1)", pf->nodes()[node_id]->DebugString(), node_id);
                 exec::ExecNodeStats* stats = exec_node->stats();
                 stats->AddExtraMetric("batches_output", stats->batches_output);
+                // Sampled cycle timings from the always-on hot-path instrumentation. Exporting
+                // them alongside the wall timers lets us validate the sampling against full
+                // measurements before trusting it on production queries.
+                stats->AddExtraMetric("sampled_batches", stats->sampled_batches);
+                stats->AddExtraMetric("sampled_cycles", stats->sampled_cycles);
+                stats->AddExtraMetric("sampled_self_cycles", stats->SampledSelfCycles());
                 int64_t total_time_ns = stats->TotalExecTime();
                 int64_t self_time_ns = stats->SelfExecTime();
                 LOG(INFO) << absl::Substitute(
@@ -26,6 +26,7 @@
 
 #include "src/carnot/exec/exec_metrics.h"
 #include "src/carnot/exec/exec_state.h"
+#include "src/carnot/exec/standing_query_registry.h"
 #include "src/carnot/funcs/funcs.h"
 #include "src/carnot/plan/plan_state.h"
 #include "src/carnot/planner/compiler_state/compiler_state.h"
@@ -59,7 +60,8 @@ class EngineState : public NotCopyable {
         add_auth_to_grpc_context_func_(add_auth_to_grpc_context_func),
         grpc_router_(grpc_router),
         model_pool_(std::move(model_pool)),
-        metrics_(std::make_unique<ExecMetrics>(&(GetMetricsRegistry()))) {}
+        metrics_(std::make_unique<ExecMetrics>(&(GetMetricsRegistry()))),
+        standing_query_registry_(std::make_unique<exec::StandingQueryRegistry>()) {}
 
   static StatusOr<std::unique_ptr<EngineState>> CreateDefault(
       std::unique_ptr<udf::Registry> func_registry,
@@ -87,7 +89,8 @@ class EngineState : public NotCopyable {
         [this](const std::string& remote_addr, bool insecure) {
           return TraceStubGenerator(remote_addr, insecure);
         },
-        query_id, model_pool_.get(), grpc_router_, add_auth_to_grpc_context_func_, metrics_.get());
+        query_id, model_pool_.get(), grpc_router_, add_auth_to_grpc_context_func_, metrics_.get(),
+        standing_query_registry_.get());
   }
   std::shared_ptr<grpc::Channel> CreateChannel(const std::string& remote_addr, bool insecure) {
     grpc::ChannelArguments args;
@@ -148,6 +151,8 @@ class EngineState : public NotCopyable {
   exec::GRPCRouter* grpc_router_ = nullptr;
   std::unique_ptr<udf::ModelPool> model_pool_;
   std::unique_ptr<ExecMetrics> metrics_;
+  // Parked standing query cursors, engine-lifetime so they survive across query executions.
+  std::unique_ptr<exec::StandingQueryRegistry> standing_query_registry_;
 };
 
 }  // namespace carnot
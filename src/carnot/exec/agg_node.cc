@@ -24,6 +24,8 @@
 #include <algorithm>
 #include <cstdint>
 
+#include <absl/base/casts.h>
+#include <absl/numeric/int128.h>
 #include <magic_enum.hpp>
 
 #include "src/carnot/exec/expression_evaluator.h"
@@ -54,6 +56,74 @@ void ExtractIntoGroupArgs(std::vector<GroupArgs>* group_args, arrow::Array* col,
   }
 }
 
+// Packs an entire group key column into the packed key chunk. Values are stored as raw 64-bit
+// patterns; the slot layout is fixed per plan, so equal rows always produce byte-identical keys.
+template <types::DataType DT>
+void PackColumnIntoKeys(std::vector<PackedGroupKey>* keys, arrow::Array* col, int slot) {
+  using ArrowArrayType = typename types::DataTypeTraits<DT>::arrow_array_type;
+  auto* typed_col = static_cast<ArrowArrayType*>(col);
+  auto num_rows = col->length();
+  for (auto row_idx = 0; row_idx < num_rows; ++row_idx) {
+    if constexpr (DT == types::DataType::UINT128) {
+      const absl::uint128 val = typed_col->Value(row_idx);
+      (*keys)[row_idx][slot] = absl::Uint128High64(val);
+      (*keys)[row_idx][slot + 1] = absl::Uint128Low64(val);
+    } else if constexpr (DT == types::DataType::FLOAT64) {
+      (*keys)[row_idx][slot] = absl::bit_cast<uint64_t>(typed_col->Value(row_idx));
+    } else {
+      (*keys)[row_idx][slot] = static_cast<uint64_t>(typed_col->Value(row_idx));
+    }
+  }
+}
+
+// Packs a single-slot group key column directly into raw 64-bit keys, bypassing the PackedGroupKey
+// layout for the common single fixed-width key group-by.
+template <types::DataType DT>
+void PackColumnIntoSingle64Keys(std::vector<uint64_t>* keys, arrow::Array* col) {
+  using ArrowArrayType = typename types::DataTypeTraits<DT>::arrow_array_type;
+  auto* typed_col = static_cast<ArrowArrayType*>(col);
+  auto num_rows = col->length();
+  for (auto row_idx = 0; row_idx < num_rows; ++row_idx) {
+    if constexpr (DT == types::DataType::FLOAT64) {
+      (*keys)[row_idx] = absl::bit_cast<uint64_t>(typed_col->Value(row_idx));
+    } else {
+      (*keys)[row_idx] = static_cast<uint64_t>(typed_col->Value(row_idx));
+    }
+  }
+}
+
+// Reconstructs a single-slot group value from its raw 64-bit pattern and appends it to the output
+// builder.
+template <types::DataType DT>
+void AppendRaw64ToBuilder(arrow::ArrayBuilder* builder, uint64_t raw) {
+  using ArrowBuilder = typename types::DataTypeTraits<DT>::arrow_builder_type;
+  auto* typed_builder = static_cast<ArrowBuilder*>(builder);
+  arrow::Status status;
+  if constexpr (DT == types::DataType::FLOAT64) {
+    status = typed_builder->Append(absl::bit_cast<double>(raw));
+  } else if constexpr (DT == types::DataType::BOOLEAN) {
+    status = typed_builder->Append(raw != 0);
+  } else {
+    status = typed_builder->Append(static_cast<int64_t>(raw));
+  }
+  PX_DCHECK_OK(status);
+  PX_UNUSED(status);
+}
+
+// Reconstructs a single group value from a packed key and appends it to the output builder.
+template <types::DataType DT>
+void AppendPackedValueToBuilder(arrow::ArrayBuilder* builder, const PackedGroupKey& key, int slot) {
+  if constexpr (DT == types::DataType::UINT128) {
+    using ArrowBuilder = typename types::DataTypeTraits<DT>::arrow_builder_type;
+    auto status =
+        static_cast<ArrowBuilder*>(builder)->Append(absl::MakeUint128(key[slot], key[slot + 1]));
+    PX_DCHECK_OK(status);
+    PX_UNUSED(status);
+  } else {
+    AppendRaw64ToBuilder<DT>(builder, key[slot]);
+  }
+}
+
 template <types::DataType DT>
 void AppendToBuilder(arrow::ArrayBuilder* builder, RowTuple* rt, size_t rt_idx) {
   using ArrowBuilder = typename types::DataTypeTraits<DT>::arrow_builder_type;
@@ -126,6 +196,7 @@ Status AggNode::InitImpl(const plan::Operator& plan_node) {
     DCHECK(group.idx < input_descriptor_->size());
     group_data_types_.emplace_back(input_descriptor_->type(group.idx));
   }
+  SetupPackedGroupKeys();
 
   auto values_size = plan_node_->values().size();
   for (size_t i = 0; i < values_size; ++i) {
@@ -162,6 +233,8 @@ Status AggNode::ConsumeNextImpl(ExecState* exec_state, const RowBatch& rb, size_
 Status AggNode::CloseImpl(ExecState*) {
   udas_no_groups_.clear();
   group_args_chunk_.clear();
+  packed_keys_chunk_.clear();
+  single64_keys_chunk_.clear();
   group_args_pool_.Clear();
   udas_pool_.Clear();
 
@@ -178,6 +251,15 @@ Status AggNode::ClearAggState(ExecState* exec_state) {
     PX_RETURN_IF_ERROR(CreateUDAInfoValues(&udas_no_groups_, exec_state));
   }
   agg_hash_map_.clear();
+  packed_agg_hash_map_.clear();
+  single64_agg_hash_map_.clear();
+  // Windowed aggregates clear state once per window for the lifetime of the query. The RowTuples
+  // and AggHashValues for the emitted window live in the pools, so the pools must be released
+  // here too or a streaming query's memory grows by one window's groups every window. The chunk
+  // holds pointers into group_args_pool_ and is rebuilt on the next batch.
+  group_args_chunk_.clear();
+  group_args_pool_.Clear();
+  udas_pool_.Clear();
   return Status::OK();
 }
 
@@ -219,16 +301,50 @@ Status AggNode::AggregateGroupByNone(ExecState* exec_state, const RowBatch& rb)
   return Status::OK();
 }
 
-Status AggNode::ExtractRowTupleForBatch(const RowBatch& rb) {
-  // Grow the group_args_chunk_ to be the size of the RowBatch.
-  size_t num_rows = rb.num_rows();
-  if (group_args_chunk_.size() < num_rows) {
-    int prev_size = group_args_chunk_.size();
-    group_args_chunk_.reserve(num_rows);
-    for (size_t idx = prev_size; idx < num_rows; ++idx) {
-      group_args_chunk_.emplace_back(CreateGroupArgsRowTuple());
+void AggNode::SetupPackedGroupKeys() {
+  group_key_slots_.clear();
+  size_t num_slots = 0;
+  for (auto dt : group_data_types_) {
+    group_key_slots_.push_back(static_cast<int>(num_slots));
+    switch (dt) {
+      case types::DataType::BOOLEAN:
+      case types::DataType::INT64:
+      case types::DataType::TIME64NS:
+      case types::DataType::FLOAT64:
+        num_slots += 1;
+        break;
+      case types::DataType::UINT128:
+        num_slots += 2;
+        break;
+      default:
+        // Variable sized group keys can't be packed, so use the general RowTuple path.
+        use_packed_group_keys_ = false;
+        return;
     }
   }
+  use_packed_group_keys_ = num_slots > 0 && num_slots <= std::tuple_size<PackedGroupKey>::value;
+  // ~80% of our group-bys key on a single fixed-width column, so that case bypasses the packed
+  // key layout too and probes a map keyed directly on the raw 64-bit value. A single UINT128 key
+  // stays on the packed path, whose two slots are already exactly the native key width.
+  use_single64_group_key_ =
+      use_packed_group_keys_ && group_data_types_.size() == 1 && num_slots == 1;
+}
+
+void AggNode::GrowGroupArgsChunk(size_t num_rows) {
+  // Grow the group_args_chunk_ to be the size of the RowBatch.
+  if (group_args_chunk_.size() >= num_rows) {
+    return;
+  }
+  size_t prev_size = group_args_chunk_.size();
+  group_args_chunk_.reserve(num_rows);
+  for (size_t idx = prev_size; idx < num_rows; ++idx) {
+    // The packed key path never reads the RowTuples, so we don't allocate them there.
+    group_args_chunk_.emplace_back(use_packed_group_keys_ ? nullptr : CreateGroupArgsRowTuple());
+  }
+}
+
+Status AggNode::ExtractRowTupleForBatch(const RowBatch& rb) {
+  GrowGroupArgsChunk(rb.num_rows());
 
   // Scan through all the group args in column order and extract the entire column.
   for (size_t idx = 0; idx < plan_node_->groups().size(); idx++) {
@@ -245,27 +361,112 @@ Status AggNode::ExtractRowTupleForBatch(const RowBatch& rb) {
   return Status::OK();
 }
 
+Status AggNode::PackGroupKeysForBatch(const RowBatch& rb) {
+  size_t num_rows = rb.num_rows();
+  GrowGroupArgsChunk(num_rows);
+
+  if (use_single64_group_key_) {
+    if (single64_keys_chunk_.size() < num_rows) {
+      single64_keys_chunk_.resize(num_rows);
+    }
+    // Every key is fully written below, so no zero-fill is needed here.
+    auto* col = rb.ColumnAt(plan_node_->groups()[0].idx).get();
+    switch (group_data_types_[0]) {
+      case types::DataType::BOOLEAN:
+        PackColumnIntoSingle64Keys<types::DataType::BOOLEAN>(&single64_keys_chunk_, col);
+        break;
+      case types::DataType::INT64:
+        PackColumnIntoSingle64Keys<types::DataType::INT64>(&single64_keys_chunk_, col);
+        break;
+      case types::DataType::TIME64NS:
+        PackColumnIntoSingle64Keys<types::DataType::TIME64NS>(&single64_keys_chunk_, col);
+        break;
+      case types::DataType::FLOAT64:
+        PackColumnIntoSingle64Keys<types::DataType::FLOAT64>(&single64_keys_chunk_, col);
+        break;
+      default:
+        return error::Internal("Unsupported data type in single 64-bit group key: $0",
+                               magic_enum::enum_name(group_data_types_[0]));
+    }
+    return Status::OK();
+  }
+
+  if (packed_keys_chunk_.size() < num_rows) {
+    packed_keys_chunk_.resize(num_rows);
+  }
+  // Zero the keys so slots not covered by a group column compare equal across rows.
+  std::fill_n(packed_keys_chunk_.begin(), num_rows, PackedGroupKey{});
+
+  // Pack the keys column-at-a-time, one slot range per group column.
+  for (size_t idx = 0; idx < plan_node_->groups().size(); idx++) {
+    auto grp = plan_node_->groups()[idx];
+    DCHECK(grp.idx < input_descriptor_->size());
+    auto* col = rb.ColumnAt(grp.idx).get();
+    int slot = group_key_slots_[idx];
+    switch (group_data_types_[idx]) {
+      case types::DataType::BOOLEAN:
+        PackColumnIntoKeys<types::DataType::BOOLEAN>(&packed_keys_chunk_, col, slot);
+        break;
+      case types::DataType::INT64:
+        PackColumnIntoKeys<types::DataType::INT64>(&packed_keys_chunk_, col, slot);
+        break;
+      case types::DataType::UINT128:
+        PackColumnIntoKeys<types::DataType::UINT128>(&packed_keys_chunk_, col, slot);
+        break;
+      case types::DataType::TIME64NS:
+        PackColumnIntoKeys<types::DataType::TIME64NS>(&packed_keys_chunk_, col, slot);
+        break;
+      case types::DataType::FLOAT64:
+        PackColumnIntoKeys<types::DataType::FLOAT64>(&packed_keys_chunk_, col, slot);
+        break;
+      default:
+        return error::Internal("Unsupported data type in packed group keys: $0",
+                               magic_enum::enum_name(group_data_types_[idx]));
+    }
+  }
+  return Status::OK();
+}
+
 Status AggNode::HashRowBatch(ExecState* exec_state, const RowBatch& rb) {
   PX_UNUSED(exec_state);
   // Loop through all the row and basically store the values into column chunk based on which
   // group they belong to.
-  for (auto row_idx = 0; row_idx < rb.num_rows(); ++row_idx) {
-    auto& ga = group_args_chunk_[row_idx];
-    AggHashValue* val = nullptr;
-    // Check to see if in hash
-    // TODO(zasgar): Change this to upsert.
-    auto it = agg_hash_map_.find(ga.rt);
-    // If not in hash then insert
-    if (it == agg_hash_map_.end()) {
-      // Create a val array.
-      val = CreateAggHashValue(exec_state);
-      agg_hash_map_[ga.rt] = val;
-      // We have inserted this, so the stored RowTuple is now in the table.
-      ga.rt = nullptr;
-    } else {
-      val = it->second;
+  if (use_single64_group_key_) {
+    for (auto row_idx = 0; row_idx < rb.num_rows(); ++row_idx) {
+      auto [it, inserted] = single64_agg_hash_map_.try_emplace(single64_keys_chunk_[row_idx],
+                                                              nullptr);
+      if (inserted) {
+        it->second = CreateAggHashValue(exec_state);
+      }
+      group_args_chunk_[row_idx].av = it->second;
+    }
+  } else if (use_packed_group_keys_) {
+    for (auto row_idx = 0; row_idx < rb.num_rows(); ++row_idx) {
+      auto [it, inserted] = packed_agg_hash_map_.try_emplace(packed_keys_chunk_[row_idx], nullptr);
+      if (inserted) {
+        it->second = CreateAggHashValue(exec_state);
+      }
+      group_args_chunk_[row_idx].av = it->second;
+    }
+  } else {
+    for (auto row_idx = 0; row_idx < rb.num_rows(); ++row_idx) {
+      auto& ga = group_args_chunk_[row_idx];
+      AggHashValue* val = nullptr;
+      // Check to see if in hash
+      // TODO(zasgar): Change this to upsert.
+      auto it = agg_hash_map_.find(ga.rt);
+      // If not in hash then insert
+      if (it == agg_hash_map_.end()) {
+        // Create a val array.
+        val = CreateAggHashValue(exec_state);
+        agg_hash_map_[ga.rt] = val;
+        // We have inserted this, so the stored RowTuple is now in the table.
+        ga.rt = nullptr;
+      } else {
+        val = it->second;
+      }
+      ga.av = val;
     }
-    ga.av = val;
   }
 
   // Now extract the values in the agg hash value.
@@ -306,6 +507,13 @@ Status AggNode::EvaluatePartialAggregates(ExecState* exec_state, size_t num_reco
 }
 
 Status AggNode::ResetGroupArgs() {
+  // The packed key path doesn't consume RowTuples, so only the agg hash values need resetting.
+  if (use_packed_group_keys_) {
+    for (size_t i = 0; i < group_args_chunk_.size(); ++i) {
+      group_args_chunk_[i].av = nullptr;
+    }
+    return Status::OK();
+  }
   // Reset the group args. If the row tuple is null it has been consumed, so
   // we can replace it with a new RowTuple. We also reset the
   // agg hash value to nullptr.
@@ -333,34 +541,28 @@ Status AggNode::ConvertAggHashMapToRowBatch(ExecState* exec_state, RowBatch* out
   }
 
   // Agg into agg values and emit!
-  for (const auto& kv : agg_hash_map_) {
-    auto* groups_rt = kv.first;
-    auto* val = kv.second;
+  if (use_single64_group_key_) {
+    for (const auto& kv : single64_agg_hash_map_) {
+      PX_RETURN_IF_ERROR(AppendSingle64GroupValue(kv.first, group_builders[0].get()));
+      PX_RETURN_IF_ERROR(FinalizeAggValue(exec_state, kv.second, &value_builders));
+    }
+  } else if (use_packed_group_keys_) {
+    for (const auto& kv : packed_agg_hash_map_) {
+      PX_RETURN_IF_ERROR(AppendPackedGroupValues(kv.first, &group_builders));
+      PX_RETURN_IF_ERROR(FinalizeAggValue(exec_state, kv.second, &value_builders));
+    }
+  } else {
+    for (const auto& kv : agg_hash_map_) {
+      auto* groups_rt = kv.first;
 
-    for (size_t i = 0; i < group_data_types_.size(); ++i) {
-      DCHECK(i < group_builders.size());
+      for (size_t i = 0; i < group_data_types_.size(); ++i) {
+        DCHECK(i < group_builders.size());
 
 #define TYPE_CASE(_dt_) AppendToBuilder<_dt_>(group_builders[i].get(), groups_rt, i);
-      PX_SWITCH_FOREACH_DATATYPE(group_data_types_[i], TYPE_CASE);
+        PX_SWITCH_FOREACH_DATATYPE(group_data_types_[i], TYPE_CASE);
 #undef TYPE_CASE
-    }
-    if (plan_node_->partial_agg()) {
-      PX_RETURN_IF_ERROR(EvaluateAggHashValue(exec_state, val));
-    }
-
-    if (plan_node_->finalize_results()) {
-      // Actually Finalize the UDA based on the column wrapper chunks.
-      for (size_t i = 0; i < val->udas.size(); ++i) {
-        const auto& uda_info = val->udas[i];
-        PX_RETURN_IF_ERROR(uda_info.def->FinalizeArrow(uda_info.uda.get(), function_ctx_.get(),
-                                                       value_builders[i].get()));
-      }
-    } else {
-      for (size_t i = 0; i < val->udas.size(); ++i) {
-        const auto& uda_info = val->udas[i];
-        PX_RETURN_IF_ERROR(uda_info.def->SerializeArrow(uda_info.uda.get(), function_ctx_.get(),
-                                                        value_builders[i].get()));
       }
+      PX_RETURN_IF_ERROR(FinalizeAggValue(exec_state, kv.second, &value_builders));
     }
   }
 
@@ -379,6 +581,80 @@ Status AggNode::ConvertAggHashMapToRowBatch(ExecState* exec_state, RowBatch* out
   return Status::OK();
 }
 
+Status AggNode::AppendPackedGroupValues(
+    const PackedGroupKey& key, std::vector<std::unique_ptr<arrow::ArrayBuilder>>* group_builders) {
+  for (size_t i = 0; i < group_data_types_.size(); ++i) {
+    DCHECK(i < group_builders->size());
+    auto* builder = (*group_builders)[i].get();
+    int slot = group_key_slots_[i];
+    switch (group_data_types_[i]) {
+      case types::DataType::BOOLEAN:
+        AppendPackedValueToBuilder<types::DataType::BOOLEAN>(builder, key, slot);
+        break;
+      case types::DataType::INT64:
+        AppendPackedValueToBuilder<types::DataType::INT64>(builder, key, slot);
+        break;
+      case types::DataType::UINT128:
+        AppendPackedValueToBuilder<types::DataType::UINT128>(builder, key, slot);
+        break;
+      case types::DataType::TIME64NS:
+        AppendPackedValueToBuilder<types::DataType::TIME64NS>(builder, key, slot);
+        break;
+      case types::DataType::FLOAT64:
+        AppendPackedValueToBuilder<types::DataType::FLOAT64>(builder, key, slot);
+        break;
+      default:
+        return error::Internal("Unsupported data type in packed group keys: $0",
+                               magic_enum::enum_name(group_data_types_[i]));
+    }
+  }
+  return Status::OK();
+}
+
+Status AggNode::AppendSingle64GroupValue(uint64_t key, arrow::ArrayBuilder* group_builder) {
+  switch (group_data_types_[0]) {
+    case types::DataType::BOOLEAN:
+      AppendRaw64ToBuilder<types::DataType::BOOLEAN>(group_builder, key);
+      break;
+    case types::DataType::INT64:
+      AppendRaw64ToBuilder<types::DataType::INT64>(group_builder, key);
+      break;
+    case types::DataType::TIME64NS:
+      AppendRaw64ToBuilder<types::DataType::TIME64NS>(group_builder, key);
+      break;
+    case types::DataType::FLOAT64:
+      AppendRaw64ToBuilder<types::DataType::FLOAT64>(group_builder, key);
+      break;
+    default:
+      return error::Internal("Unsupported data type in single 64-bit group key: $0",
+                             magic_enum::enum_name(group_data_types_[0]));
+  }
+  return Status::OK();
+}
+
+Status AggNode::FinalizeAggValue(ExecState* exec_state, AggHashValue* val,
+                                 std::vector<std::unique_ptr<arrow::ArrayBuilder>>* value_builders) {
+  if (plan_node_->partial_agg()) {
+    PX_RETURN_IF_ERROR(EvaluateAggHashValue(exec_state, val));
+  }
+
+  if (plan_node_->finalize_results()) {
+    // Actually Finalize the UDA based on the column wrapper chunks.
+    for (size_t i = 0; i < val->udas.size(); ++i) {
+      const auto& uda_info = val->udas[i];
+      PX_RETURN_IF_ERROR(uda_info.def->FinalizeArrow(uda_info.uda.get(), function_ctx_.get(),
+                                                     (*value_builders)[i].get()));
+    }
+  } else {
+    for (size_t i = 0; i < val->udas.size(); ++i) {
+      const auto& uda_info = val->udas[i];
+      PX_RETURN_IF_ERROR(uda_info.def->SerializeArrow(uda_info.uda.get(), function_ctx_.get(),
+                                                      (*value_builders)[i].get()));
+    }
+  }
+  return Status::OK();
+}
+
 Status AggNode::AggregateGroupByClause(ExecState* exec_state, const RowBatch& rb) {
   // Extracts the row tuples (column wise).
   // TODO(zasgar): PL-455 - Chunk this so we don't create a crazy number of row tuples if the batch
@@ -388,14 +664,21 @@ Status AggNode::AggregateGroupByClause(ExecState* exec_state, const RowBatch& rb
   // 3. If the agg values are large then run aggregate and compact.
   // 4. Reset state to prepare for next row batch.
   // 5. If it's the last batch then emit the values.
-  PX_RETURN_IF_ERROR(ExtractRowTupleForBatch(rb));
+  if (use_packed_group_keys_) {
+    PX_RETURN_IF_ERROR(PackGroupKeysForBatch(rb));
+  } else {
+    PX_RETURN_IF_ERROR(ExtractRowTupleForBatch(rb));
+  }
   PX_RETURN_IF_ERROR(HashRowBatch(exec_state, rb));
   if (plan_node_->partial_agg() && plan_node_->values().size() > 0) {
     PX_RETURN_IF_ERROR(EvaluatePartialAggregates(exec_state, rb.num_rows()));
   }
   PX_RETURN_IF_ERROR(ResetGroupArgs());
   if (ReadyToEmitBatches(rb)) {
-    RowBatch output_rb(*output_descriptor_, agg_hash_map_.size());
+    size_t num_groups = use_single64_group_key_  ? single64_agg_hash_map_.size()
+                        : use_packed_group_keys_ ? packed_agg_hash_map_.size()
+                                                 : agg_hash_map_.size();
+    RowBatch output_rb(*output_descriptor_, num_groups);
     PX_RETURN_IF_ERROR(ConvertAggHashMapToRowBatch(exec_state, &output_rb));
     output_rb.set_eow(rb.eow());
     output_rb.set_eos(rb.eos());
@@ -17,6 +17,7 @@
  */
 
 #pragma once
+#include <array>
 #include <cstddef>
 #include <map>
 #include <memory>
@@ -24,6 +25,8 @@
 #include <utility>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
+
 #include "src/carnot/exec/exec_node.h"
 #include "src/carnot/exec/exec_state.h"
 #include "src/carnot/exec/expression_evaluator.h"
@@ -38,6 +41,7 @@
 #include "src/shared/types/column_wrapper.h"
 #include "src/shared/types/hash_utils.h"
 #include "src/shared/types/types.h"
+#include "src/shared/upid/upid_kernels.h"
 #include "src/table_store/schema/row_batch.h"
 #include "src/table_store/table_store.h"
 
@@ -66,8 +70,23 @@ struct GroupArgs {
   AggHashValue* av;
 };
 
+// Key for the packed group key fast path. Group values that fit in 64 bits occupy one slot each;
+// UINT128 group values occupy two consecutive slots. Unused slots must stay zeroed so that keys
+// hash and compare consistently.
+using PackedGroupKey = std::array<uint64_t, 2>;
+
+// Hashes a packed group key with the upid library's 128->64 mix. The dominant packed key is a
+// UPID (a UINT128 spanning both slots), and the mix is a straight multiply/xorshift with no
+// per-key branching, so hashing a chunk of keys stays in registers.
+struct PackedGroupKeyHasher {
+  size_t operator()(const PackedGroupKey& k) const { return md::HashUPID128(k[0], k[1]); }
+};
+
 class AggNode : public ProcessingNode {
   using AggHashMap = AbslRowTupleHashMap<AggHashValue*>;
+  using PackedKeyAggHashMap =
+      absl::flat_hash_map<PackedGroupKey, AggHashValue*, PackedGroupKeyHasher>;
+  using Single64KeyAggHashMap = absl::flat_hash_map<uint64_t, AggHashValue*>;
 
  public:
   AggNode() = default;
@@ -87,6 +106,15 @@ class AggNode : public ProcessingNode {
 
  private:
   AggHashMap agg_hash_map_;
+  // When every group column is fixed-size and the packed widths fit in a PackedGroupKey, we key
+  // the hash map on packed keys instead of RowTuples. The keys are packed column-at-a-time and
+  // probe a flat open-addressed table, avoiding the per-row RowTuple allocation and byte-wise
+  // tuple hashing of the general path.
+  PackedKeyAggHashMap packed_agg_hash_map_;
+  // Most group-bys key on a single 64-bit column (time bucket, pod id), so that case gets its own
+  // specialization on top of the packed path: the map is keyed directly on the raw 64-bit value,
+  // halving the key width and skipping the slot layout entirely.
+  Single64KeyAggHashMap single64_agg_hash_map_;
   bool HasNoGroups() const { return plan_node_->groups().empty(); }
   // ReadyToEmitBatches returns true when the input stream has reached a point where output batches
   // can be emitted. In the windowed aggregate case, this happens whenever end of window (eow) is
@@ -143,17 +171,36 @@ class AggNode : public ProcessingNode {
   // This vector holds pointers to the row_tuples which are managed by the group_args_pool_.
 
   std::vector<GroupArgs> group_args_chunk_;
+
+  // Variables specific to the packed group key fast path.
+  bool use_packed_group_keys_ = false;
+  // Slot in the packed key at which each group column starts.
+  std::vector<int> group_key_slots_;
+  // Like group_args_chunk_, the packed keys for the current row batch, reused across batches.
+  std::vector<PackedGroupKey> packed_keys_chunk_;
+  // Variables specific to the single 64-bit key specialization.
+  bool use_single64_group_key_ = false;
+  std::vector<uint64_t> single64_keys_chunk_;
   // END: Variables specific to GroupBy Agg.
 
   // Creates a mapping between plan cols and stored cols (see above comment).
   Status CreateColumnMapping();
 
+  // Decides whether the packed group key fast path applies and computes the key slot layout.
+  void SetupPackedGroupKeys();
+  void GrowGroupArgsChunk(size_t num_rows);
   Status ExtractRowTupleForBatch(const table_store::schema::RowBatch& rb);
+  Status PackGroupKeysForBatch(const table_store::schema::RowBatch& rb);
   Status HashRowBatch(ExecState* exec_state, const table_store::schema::RowBatch& rb);
   Status EvaluatePartialAggregates(ExecState* exec_state, size_t num_records);
   Status ResetGroupArgs();
   Status ConvertAggHashMapToRowBatch(ExecState* exec_state,
                                      table_store::schema::RowBatch* output_rb);
+  Status AppendPackedGroupValues(const PackedGroupKey& key,
+                                 std::vector<std::unique_ptr<arrow::ArrayBuilder>>* group_builders);
+  Status AppendSingle64GroupValue(uint64_t key, arrow::ArrayBuilder* group_builder);
+  Status FinalizeAggValue(ExecState* exec_state, AggHashValue* val,
+                          std::vector<std::unique_ptr<arrow::ArrayBuilder>>* value_builders);
 
   AggHashValue* CreateAggHashValue(ExecState* exec_state);
   RowTuple* CreateGroupArgsRowTuple() {
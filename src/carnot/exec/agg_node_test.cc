@@ -171,6 +171,35 @@ agg_op {
   finalize_results: true
 })";
 
+constexpr char kBlockingUint128GroupAgg[] = R"(
+op_type: AGGREGATE_OPERATOR
+agg_op {
+  windowed: false
+  values {
+    name: "minsum"
+    args {
+      column {
+        node:0
+        index: 1
+      }
+    }
+    args {
+      column {
+        node:0
+        index: 2
+      }
+    }
+  }
+  groups {
+     node: 0
+     index: 0
+  }
+  group_names: "g1"
+  value_names: "value1"
+  partial_agg: true
+  finalize_results: true
+})";
+
 constexpr char kWindowedNoGroupAgg[] = R"(
 op_type: AGGREGATE_OPERATOR
 agg_op {
@@ -648,6 +677,77 @@ TEST_F(AggNodeTest, multiple_groups_with_string_blocking) {
       .Close();
 }
 
+// BOOLEAN and INT64 groups both fit in the packed group key fast path.
+TEST_F(AggNodeTest, multiple_groups_with_bool_blocking) {
+  auto plan_node = PlanNodeFromPbtxt(kBlockingMultipleGroupAgg);
+  RowDescriptor input_rd(
+      {types::DataType::BOOLEAN, types::DataType::INT64, types::DataType::INT64});
+
+  RowDescriptor output_rd(
+      {types::DataType::BOOLEAN, types::DataType::INT64, types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<AggNode, plan::AggregateOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd, 4, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<types::BoolValue>({true, false, true, false})
+                       .AddColumn<types::Int64Value>({1, 1, 2, 1})
+                       .AddColumn<types::Int64Value>({3, 5, 4, 2})
+                       .get(),
+                   0, 0)
+      .ConsumeNext(RowBatchBuilder(input_rd, 4, true, true)
+                       .AddColumn<types::BoolValue>({true, true, false, false})
+                       .AddColumn<types::Int64Value>({1, 2, 3, 3})
+                       .AddColumn<types::Int64Value>({0, 9, 7, 4})
+                       .get(),
+                   0)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 4, true, true)
+                          .AddColumn<types::BoolValue>({true, false, true, false})
+                          .AddColumn<types::Int64Value>({1, 1, 2, 3})
+                          .AddColumn<types::Int64Value>({1, 2, 4, 6})
+                          .get(),
+                      false)
+      .Close();
+}
+
+// A UINT128 group occupies both slots of the packed group key.
+TEST_F(AggNodeTest, uint128_group_blocking) {
+  auto plan_node = PlanNodeFromPbtxt(kBlockingUint128GroupAgg);
+  RowDescriptor input_rd(
+      {types::DataType::UINT128, types::DataType::INT64, types::DataType::INT64});
+
+  RowDescriptor output_rd({types::DataType::UINT128, types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<AggNode, plan::AggregateOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  types::UInt128Value upid_a(1, 2);
+  types::UInt128Value upid_b(1, 3);
+  types::UInt128Value upid_c(2, 2);
+  types::UInt128Value upid_d(0, 1);
+
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd, 4, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<types::UInt128Value>({upid_a, upid_b, upid_a, upid_c})
+                       .AddColumn<types::Int64Value>({1, 2, 3, 4})
+                       .AddColumn<types::Int64Value>({5, 1, 2, 8})
+                       .get(),
+                   0, 0)
+      .ConsumeNext(RowBatchBuilder(input_rd, 4, true, true)
+                       .AddColumn<types::UInt128Value>({upid_b, upid_c, upid_a, upid_d})
+                       .AddColumn<types::Int64Value>({2, 3, 1, 0})
+                       .AddColumn<types::Int64Value>({0, 3, 1, 9})
+                       .get(),
+                   0)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 4, true, true)
+                          .AddColumn<types::UInt128Value>({upid_a, upid_b, upid_c, upid_d})
+                          .AddColumn<types::Int64Value>({4, 1, 7, 0})
+                          .get(),
+                      false)
+      .Close();
+}
+
 TEST_F(AggNodeTest, no_groups_windowed) {
   auto plan_node = PlanNodeFromPbtxt(kWindowedNoGroupAgg);
   RowDescriptor input_rd({types::DataType::INT64, types::DataType::INT64});
@@ -19,6 +19,7 @@
 #include "src/carnot/exec/equijoin_node.h"
 
 #include <arrow/array.h>
+#include <arrow/array/builder_binary.h>
 #include <arrow/memory_pool.h>
 #include <arrow/status.h>
 #include <algorithm>
@@ -35,6 +36,11 @@
 #include "src/shared/types/arrow_adapter.h"
 #include "src/shared/types/type_utils.h"
 
+DEFINE_int64(carnot_equijoin_spill_threshold_bytes,
+             gflags::Int64FromEnv("PL_CARNOT_EQUIJOIN_SPILL_THRESHOLD_BYTES", 0),
+             "If non-zero, the approximate number of bytes the build side of a join may hold in "
+             "memory before the join falls back to disk-backed grace hash join processing.");
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -120,12 +126,22 @@ Status EquijoinNode::InitializeColumnBuilders() {
     column_builders_[i] =
         MakeArrowBuilder(output_descriptor_->type(i), arrow::default_memory_pool());
     PX_RETURN_IF_ERROR(column_builders_[i]->Reserve(output_rows_per_batch_));
+    if (output_descriptor_->type(i) == types::DataType::STRING) {
+      // Size the string data buffer from the rolling bytes-per-row of consumed input batches, so
+      // the common case appends single-copy instead of growing the buffer mid-batch.
+      auto hint = column_size_stats_.ReservationHintBytes(i, output_rows_per_batch_);
+      if (hint > 0) {
+        PX_RETURN_IF_ERROR(
+            static_cast<arrow::StringBuilder*>(column_builders_[i].get())->ReserveData(hint));
+      }
+    }
   }
   return Status::OK();
 }
 
 Status EquijoinNode::PrepareImpl(ExecState* /*exec_state*/) {
   column_builders_.resize(output_descriptor_->size());
+  column_size_stats_.Init(output_descriptor_->size());
   PX_RETURN_IF_ERROR(InitializeColumnBuilders());
 
   return Status::OK();
@@ -134,11 +150,25 @@ Status EquijoinNode::PrepareImpl(ExecState* /*exec_state*/) {
 Status EquijoinNode::OpenImpl(ExecState* /*exec_state*/) { return Status::OK(); }
 
 Status EquijoinNode::CloseImpl(ExecState* /*exec_state*/) {
+  ClearBuildState();
+  build_spill_.reset();
+  probe_spill_.reset();
+  return Status::OK();
+}
+
+void EquijoinNode::ClearBuildState() {
+  for (auto& partition : build_partitions_) {
+    partition.build_buffer.clear();
+    partition.build_buffer_rows.clear();
+    partition.probed_keys.clear();
+  }
+  // The pools own the key tuples and build values that the maps and scratch chunks point into, so
+  // the pointers have to go before the pools are released.
   join_keys_chunk_.clear();
-  build_buffer_.clear();
-  probed_keys_.clear();
+  build_wrappers_chunk_.clear();
+  probe_wrappers_chunk_.clear();
   key_values_pool_.Clear();
-  return Status::OK();
+  column_values_pool_.Clear();
 }
 
 template <types::DataType DT>
@@ -211,7 +241,12 @@ Status EquijoinNode::HashRowBatch(const table_store::schema::RowBatch& rb) {
   // Make sure the map has constructed the necessary column wrappers for all of the tuples.
   for (auto row_idx = 0; row_idx < rb.num_rows(); ++row_idx) {
     auto& rt = join_keys_chunk_[row_idx];
-    auto& current = build_buffer_[rt];
+    if (active_spill_partition_ >= 0 &&
+        static_cast<int64_t>(PartitionIndexForKey(rt)) != active_spill_partition_) {
+      continue;
+    }
+    auto* partition = PartitionForKey(rt);
+    auto& current = partition->build_buffer[rt];
     auto wrappers_ptr = current != nullptr ? current : build_wrappers_chunk_[row_idx];
 
     // Now extract the values into the corresponding column wrappers.
@@ -226,7 +261,7 @@ Status EquijoinNode::HashRowBatch(const table_store::schema::RowBatch& rb) {
 #undef TYPE_CASE
     }
     // Keep track of the number of rows that the build buffer matches for each key.
-    build_buffer_rows_[rt]++;
+    partition->build_buffer_rows[rt]++;
 
     if (current == nullptr) {
       std::swap(build_wrappers_chunk_[row_idx], current);
@@ -358,10 +393,17 @@ Status EquijoinNode::DoProbe(ExecState* exec_state, const table_store::schema::R
   }
 
   for (auto row_idx = 0; row_idx < rb.num_rows(); ++row_idx) {
-    auto it = build_buffer_.find(join_keys_chunk_[row_idx]);
-    if (it != build_buffer_.end()) {
+    if (active_spill_partition_ >= 0 &&
+        static_cast<int64_t>(PartitionIndexForKey(join_keys_chunk_[row_idx])) !=
+            active_spill_partition_) {
+      probe_wrappers_chunk_[row_idx] = nullptr;
+      continue;
+    }
+    auto* partition = PartitionForKey(join_keys_chunk_[row_idx]);
+    auto it = partition->build_buffer.find(join_keys_chunk_[row_idx]);
+    if (it != partition->build_buffer.end()) {
       probe_wrappers_chunk_[row_idx] = it->second;
-      probed_keys_.insert(it->first);
+      partition->probed_keys.insert(it->first);
     } else {
       probe_wrappers_chunk_[row_idx] = nullptr;
     }
@@ -370,6 +412,14 @@ Status EquijoinNode::DoProbe(ExecState* exec_state, const table_store::schema::R
   auto rb_ptr = std::make_shared<RowBatch>(rb);
 
   for (auto row_idx = 0; row_idx < rb.num_rows(); ++row_idx) {
+    // During spilled processing, each probe row is handled in the pass for its own partition, so
+    // rows outside the active partition must not count as unmatched here.
+    if (active_spill_partition_ >= 0 &&
+        static_cast<int64_t>(PartitionIndexForKey(join_keys_chunk_[row_idx])) !=
+            active_spill_partition_) {
+      continue;
+    }
+
     if (queued_rows_ >= output_rows_per_batch_ - column_builders_[0]->length()) {
       PX_RETURN_IF_ERROR(FlushChunkedRows(exec_state));
     }
@@ -383,12 +433,14 @@ Status EquijoinNode::DoProbe(ExecState* exec_state, const table_store::schema::R
       continue;
     }
 
-    PX_RETURN_IF_ERROR(MatchBuildValuesAndFlush(exec_state, probe_wrappers_chunk_[row_idx], rb_ptr,
-                                                row_idx,
-                                                build_buffer_rows_[join_keys_chunk_[row_idx]]));
+    PX_RETURN_IF_ERROR(MatchBuildValuesAndFlush(
+        exec_state, probe_wrappers_chunk_[row_idx], rb_ptr, row_idx,
+        PartitionForKey(join_keys_chunk_[row_idx])->build_buffer_rows[join_keys_chunk_[row_idx]]));
   }
 
-  if (probe_eos_ && queued_rows_ > 0) {
+  // During spilled processing, queued rows are flushed once at the end of the partition's pass
+  // rather than per replayed batch.
+  if (probe_eos_ && active_spill_partition_ < 0 && queued_rows_ > 0) {
     PX_RETURN_IF_ERROR(FlushChunkedRows(exec_state));
   }
 
@@ -396,12 +448,14 @@ Status EquijoinNode::DoProbe(ExecState* exec_state, const table_store::schema::R
 }
 
 Status EquijoinNode::EmitUnmatchedBuildRows(ExecState* exec_state) {
-  for (auto it = build_buffer_.begin(); it != build_buffer_.end(); ++it) {
-    if (probed_keys_.find(it->first) != probed_keys_.end()) {
-      continue;
+  for (auto& partition : build_partitions_) {
+    for (auto it = partition.build_buffer.begin(); it != partition.build_buffer.end(); ++it) {
+      if (partition.probed_keys.find(it->first) != partition.probed_keys.end()) {
+        continue;
+      }
+      PX_RETURN_IF_ERROR(MatchBuildValuesAndFlush(exec_state, it->second, nullptr, 0,
+                                                  partition.build_buffer_rows[it->first]));
     }
-    PX_RETURN_IF_ERROR(MatchBuildValuesAndFlush(exec_state, it->second, nullptr, 0,
-                                                build_buffer_rows_[it->first]));
   }
 
   if (queued_rows_ > 0) {
@@ -410,19 +464,96 @@ Status EquijoinNode::EmitUnmatchedBuildRows(ExecState* exec_state) {
   return Status::OK();
 }
 
+Status EquijoinNode::StartSpilling() {
+  spilling_ = true;
+  PX_ASSIGN_OR_RETURN(probe_spill_, RowBatchSpillFile::Create());
+  // The build spill file already covers every batch hashed so far, so the in-memory tables can go.
+  ClearBuildState();
+  // Probe batches buffered while waiting on the build side move to disk as well.
+  while (probe_batches_.size()) {
+    const auto& front = probe_batches_.front();
+    if (front.eos()) {
+      probe_eos_ = true;
+    }
+    PX_RETURN_IF_ERROR(probe_spill_->Append(front));
+    probe_batches_.pop();
+  }
+  return Status::OK();
+}
+
+// Joins the spilled inputs one radix partition at a time. Each pass replays the build file to
+// construct just that partition's hash table, streams the probe file through it, and then releases
+// the partition's state, so peak memory is bounded by the largest single partition rather than the
+// whole build side.
+Status EquijoinNode::ProcessSpilledPartitions(ExecState* exec_state) {
+  for (size_t partition = 0; partition < kNumJoinPartitions; ++partition) {
+    active_spill_partition_ = partition;
+
+    PX_RETURN_IF_ERROR(build_spill_->Rewind());
+    while (true) {
+      PX_ASSIGN_OR_RETURN(auto rb, build_spill_->ReadNext());
+      if (rb == nullptr) {
+        break;
+      }
+      PX_RETURN_IF_ERROR(ExtractJoinKeysForBatch(*rb, false));
+      PX_RETURN_IF_ERROR(HashRowBatch(*rb));
+    }
+
+    PX_RETURN_IF_ERROR(probe_spill_->Rewind());
+    while (true) {
+      PX_ASSIGN_OR_RETURN(auto rb, probe_spill_->ReadNext());
+      if (rb == nullptr) {
+        break;
+      }
+      PX_RETURN_IF_ERROR(DoProbe(exec_state, *rb));
+    }
+
+    if (build_spec_.emit_unmatched_rows) {
+      // Only the active partition's tables are populated, so this emits just its unmatched rows.
+      PX_RETURN_IF_ERROR(EmitUnmatchedBuildRows(exec_state));
+    } else if (queued_rows_ > 0) {
+      PX_RETURN_IF_ERROR(FlushChunkedRows(exec_state));
+    }
+    // The queued output chunks reference pool-owned build values, so flush before releasing them.
+    ClearBuildState();
+  }
+  active_spill_partition_ = -1;
+  build_spill_.reset();
+  probe_spill_.reset();
+  return Status::OK();
+}
+
 Status EquijoinNode::ConsumeBuildBatch(ExecState* exec_state,
                                        const table_store::schema::RowBatch& rb) {
   if (rb.eos()) {
     build_eos_ = true;
   }
 
-  PX_RETURN_IF_ERROR(ExtractJoinKeysForBatch(rb, false));
-  PX_RETURN_IF_ERROR(HashRowBatch(rb));
+  // Spilled processing replays the probe side once per partition, which reorders the output, so
+  // it is only eligible for joins that don't need to preserve the probe table's time order.
+  if (FLAGS_carnot_equijoin_spill_threshold_bytes > 0 && !plan_node_->order_by_time()) {
+    // Spool every build batch while spilling is enabled. If the threshold is never crossed the
+    // file is simply discarded, but once it is crossed it already holds the batches that went into
+    // the (now dropped) in-memory tables.
+    if (build_spill_ == nullptr) {
+      PX_ASSIGN_OR_RETURN(build_spill_, RowBatchSpillFile::Create());
+    }
+    PX_RETURN_IF_ERROR(build_spill_->Append(rb));
+    build_bytes_ += rb.NumBytes();
+    if (!spilling_ && build_bytes_ > FLAGS_carnot_equijoin_spill_threshold_bytes) {
+      PX_RETURN_IF_ERROR(StartSpilling());
+    }
+  }
+
+  if (!spilling_) {
+    PX_RETURN_IF_ERROR(ExtractJoinKeysForBatch(rb, false));
+    PX_RETURN_IF_ERROR(HashRowBatch(rb));
 
-  if (build_eos_) {
-    while (probe_batches_.size()) {
-      PX_RETURN_IF_ERROR(DoProbe(exec_state, probe_batches_.front()));
-      probe_batches_.pop();
+    if (build_eos_) {
+      while (probe_batches_.size()) {
+        PX_RETURN_IF_ERROR(DoProbe(exec_state, probe_batches_.front()));
+        probe_batches_.pop();
+      }
     }
   }
   return Status::OK();
@@ -430,6 +561,12 @@ Status EquijoinNode::ConsumeBuildBatch(ExecState* exec_state,
 
 Status EquijoinNode::ConsumeProbeBatch(ExecState* exec_state,
                                        const table_store::schema::RowBatch& rb) {
+  if (spilling_) {
+    if (rb.eos()) {
+      probe_eos_ = true;
+    }
+    return probe_spill_->Append(rb);
+  }
   if (!build_eos_) {
     probe_batches_.push(rb);
     return Status::OK();
@@ -439,6 +576,13 @@ Status EquijoinNode::ConsumeProbeBatch(ExecState* exec_state,
 
 Status EquijoinNode::ConsumeNextImpl(ExecState* exec_state, const table_store::schema::RowBatch& rb,
                                      size_t parent_index) {
+  const TableSpec& spec = IsProbeTable(parent_index) ? probe_spec_ : build_spec_;
+  for (size_t i = 0; i < spec.input_col_indices.size(); ++i) {
+    if (spec.input_col_types[i] == types::DataType::STRING) {
+      column_size_stats_.UpdateStringColumn(spec.output_col_indices[i],
+                                            *rb.ColumnAt(spec.input_col_indices[i]));
+    }
+  }
   if (IsProbeTable(parent_index)) {
     DCHECK(!probe_eos_);
     PX_RETURN_IF_ERROR(ConsumeProbeBatch(exec_state, rb));
@@ -448,7 +592,9 @@ Status EquijoinNode::ConsumeNextImpl(ExecState* exec_state, const table_store::s
   }
 
   if (build_eos_ && probe_eos_) {
-    if (build_spec_.emit_unmatched_rows) {
+    if (spilling_) {
+      PX_RETURN_IF_ERROR(ProcessSpilledPartitions(exec_state));
+    } else if (build_spec_.emit_unmatched_rows) {
       PX_RETURN_IF_ERROR(EmitUnmatchedBuildRows(exec_state));
     }
 
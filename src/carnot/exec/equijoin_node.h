@@ -19,6 +19,7 @@
 #pragma once
 
 #include <arrow/array/builder_base.h>
+#include <array>
 #include <cstddef>
 #include <memory>
 #include <queue>
@@ -30,6 +31,7 @@
 
 #include "src/carnot/exec/exec_node.h"
 #include "src/carnot/exec/exec_state.h"
+#include "src/carnot/exec/row_batch_spill.h"
 #include "src/carnot/exec/row_tuple.h"
 #include "src/carnot/plan/operators.h"
 #include "src/common/base/base.h"
@@ -37,14 +39,22 @@
 #include "src/common/memory/memory.h"
 #include "src/shared/types/column_wrapper.h"
 #include "src/shared/types/types.h"
+#include "src/table_store/schema/rolling_size_stats.h"
 #include "src/table_store/table_store.h"
 
+DECLARE_int64(carnot_equijoin_spill_threshold_bytes);
+
 namespace px {
 namespace carnot {
 namespace exec {
 
 constexpr size_t kDefaultJoinRowBatchSize = 1024;
 
+// Number of radix partitions for the build side of the join. Must be a power of two. Partitioning
+// the build buffer by key hash keeps the individual hash tables small enough to stay cache
+// resident for large build sides, and bounds the cost of any single table resize.
+constexpr size_t kNumJoinPartitions = 16;
+
 class EquijoinNode : public ProcessingNode {
   enum class JoinInputTable { kLeftTable, kRightTable };
 
@@ -89,6 +99,9 @@ class EquijoinNode : public ProcessingNode {
   Status NextOutputBatch(ExecState* exec_state);
   Status ConsumeBuildBatch(ExecState* exec_state, const table_store::schema::RowBatch& rb);
   Status ConsumeProbeBatch(ExecState* exec_state, const table_store::schema::RowBatch& rb);
+  Status StartSpilling();
+  Status ProcessSpilledPartitions(ExecState* exec_state);
+  void ClearBuildState();
 
   bool build_eos_ = false;
   bool probe_eos_ = false;
@@ -129,6 +142,9 @@ class EquijoinNode : public ProcessingNode {
   std::queue<table_store::schema::RowBatch> probe_batches_;
   // Column builders will flush a batch once they hit output_rows_per_batch_ rows.
   std::vector<std::unique_ptr<arrow::ArrayBuilder>> column_builders_;
+  // Rolling bytes-per-row of consumed string columns, used to preallocate the string data buffers
+  // of freshly initialized column builders.
+  table_store::schema::RollingColumnSizeStats column_size_stats_;
   // Manages the RowTuples containing the keys for the join.
   ObjectPool key_values_pool_{"equijoin_kv_pool"};
   ObjectPool column_values_pool_{"equijoin_col_vals_pool"};
@@ -139,17 +155,44 @@ class EquijoinNode : public ProcessingNode {
   std::vector<std::vector<types::SharedColumnWrapper>*> build_wrappers_chunk_;
 
   // Chunk of data to use when performing the probe stage of the join.
-  // This will store build table data from `build_buffer_`.
+  // This will store build table data from the build partitions.
   std::vector<std::vector<types::SharedColumnWrapper>*> probe_wrappers_chunk_;
-  AbslRowTupleHashMap<std::vector<types::SharedColumnWrapper>*> build_buffer_;
-  // Store the number of rows that match a given set of keys for the build buffer.
-  // This is necessary to store in addition to the values in `build_buffer_` in
-  // the event that no columns from the build side are emitted.
-  AbslRowTupleHashMap<int64_t> build_buffer_rows_;
-
-  // For joins where the build_buffer_ needs to emit any non-probed rows at the end of the join,
-  // keep track of which ones they were.
-  AbslRowTupleHashSet probed_keys_;
+
+  // One radix partition of the build side, selected by the key hash.
+  struct BuildPartition {
+    AbslRowTupleHashMap<std::vector<types::SharedColumnWrapper>*> build_buffer;
+    // Store the number of rows that match a given set of keys for the build buffer.
+    // This is necessary to store in addition to the values in `build_buffer` in
+    // the event that no columns from the build side are emitted.
+    AbslRowTupleHashMap<int64_t> build_buffer_rows;
+    // For joins where the build buffer needs to emit any non-probed rows at the end of the join,
+    // keep track of which ones they were.
+    AbslRowTupleHashSet probed_keys;
+  };
+  std::array<BuildPartition, kNumJoinPartitions> build_partitions_;
+
+  // Selects the build partition for a key from the high bits of its hash. The low bits feed the
+  // hash table bucket index within the partition, so using disjoint bits avoids clustering. The
+  // memoized RowTuple hash makes the extra Hash() call here cheap.
+  size_t PartitionIndexForKey(RowTuple* rt) {
+    return (rt->Hash() >> 56) & (kNumJoinPartitions - 1);
+  }
+  BuildPartition* PartitionForKey(RowTuple* rt) {
+    return &build_partitions_[PartitionIndexForKey(rt)];
+  }
+
+  // Grace hash join spill state. Once the build side crosses the spill threshold, the in-memory
+  // build tables are dropped and both inputs are spooled to scratch files instead; the radix
+  // partitions are then joined one at a time after both inputs reach eos, bounding peak memory by
+  // the largest single partition.
+  bool spilling_ = false;
+  // Approximate build-side footprint, accumulated from the consumed batch sizes.
+  int64_t build_bytes_ = 0;
+  // The partition currently being joined while processing spilled inputs, or -1 outside of that
+  // phase. Build and probe rows belonging to other partitions are skipped during a pass.
+  int64_t active_spill_partition_ = -1;
+  std::unique_ptr<RowBatchSpillFile> build_spill_;
+  std::unique_ptr<RowBatchSpillFile> probe_spill_;
 
   // Handle on the most recent RowBatch (in case it's the final one).
   std::unique_ptr<table_store::schema::RowBatch> pending_output_batch_;
@@ -589,6 +589,144 @@ TEST_F(JoinNodeTest, zero_row_row_batch_right) {
       .Close();
 }
 
+TEST_F(JoinNodeTest, unordered_many_keys) {
+  // Enough distinct keys that the build side spans all of the radix partitions.
+  // Left table input: [left_0:Int64, left_1:Int64]
+  // Right table input: [right_0:Int64, right_1:Int64]
+  // Inner join on left_0=right_0.
+  const char* proto = R"(
+  type: INNER
+  equality_conditions {
+    left_column_index: 0
+    right_column_index: 0
+  }
+  output_columns: {
+    parent_index: 0
+    column_index: 1
+  }
+  output_columns: {
+    parent_index: 1
+    column_index: 1
+  }
+  column_names: "left_1"
+  column_names: "right_1"
+  rows_per_batch: 64
+)";
+
+  // Left (build)
+  RowDescriptor input_rd_0({types::DataType::INT64, types::DataType::INT64});
+  // Right (probe)
+  RowDescriptor input_rd_1({types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64, types::DataType::INT64});
+
+  constexpr int64_t kNumKeys = 40;
+  std::vector<types::Int64Value> keys;
+  std::vector<types::Int64Value> build_vals;
+  std::vector<types::Int64Value> probe_vals;
+  for (int64_t i = 0; i < kNumKeys; ++i) {
+    keys.emplace_back(i);
+    build_vals.emplace_back(2 * i);
+    probe_vals.emplace_back(3 * i);
+  }
+
+  auto plan_node = PlanNodeFromPbtxt(proto);
+  auto tester = exec::ExecNodeTester<EquijoinNode, plan::JoinOperator>(
+      *plan_node, output_rd, {input_rd_0, input_rd_1}, exec_state_.get());
+
+  tester
+      // Build table
+      .ConsumeNext(RowBatchBuilder(input_rd_0, kNumKeys, /*eow*/ true, /*eos*/ true)
+                       .AddColumn<types::Int64Value>(keys)
+                       .AddColumn<types::Int64Value>(build_vals)
+                       .get(),
+                   0, 0)
+      // Probe table
+      .ConsumeNext(RowBatchBuilder(input_rd_1, kNumKeys, true, true)
+                       .AddColumn<types::Int64Value>(keys)
+                       .AddColumn<types::Int64Value>(probe_vals)
+                       .get(),
+                   1, 1)
+      // Output follows probe row order, so every key comes back in order despite partitioning.
+      .ExpectRowBatch(RowBatchBuilder(output_rd, kNumKeys, true, true)
+                          .AddColumn<types::Int64Value>(build_vals)
+                          .AddColumn<types::Int64Value>(probe_vals)
+                          .get(),
+                      true)
+      .Close();
+}
+
+TEST_F(JoinNodeTest, spilled_inner_join) {
+  // Force the grace hash join fallback by setting the spill threshold below the first build
+  // batch, so the whole join runs off the scratch files.
+  // Left table (build): [left_0:Int64, left_1:Int64]
+  // Right table (probe): [right_0:Int64, right_1:Int64]
+  // Inner join on left_0=right_0.
+  int64_t prev_threshold = FLAGS_carnot_equijoin_spill_threshold_bytes;
+  FLAGS_carnot_equijoin_spill_threshold_bytes = 1;
+
+  const char* proto = R"(
+  type: INNER
+  equality_conditions {
+    left_column_index: 0
+    right_column_index: 0
+  }
+  output_columns: {
+    parent_index: 0
+    column_index: 1
+  }
+  output_columns: {
+    parent_index: 1
+    column_index: 1
+  }
+  column_names: "left_1"
+  column_names: "right_1"
+  rows_per_batch: 64
+)";
+
+  // Left (build)
+  RowDescriptor input_rd_0({types::DataType::INT64, types::DataType::INT64});
+  // Right (probe)
+  RowDescriptor input_rd_1({types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64, types::DataType::INT64});
+
+  auto plan_node = PlanNodeFromPbtxt(proto);
+  auto tester = exec::ExecNodeTester<EquijoinNode, plan::JoinOperator>(
+      *plan_node, output_rd, {input_rd_0, input_rd_1}, exec_state_.get());
+
+  tester
+      // Build table: crosses the threshold, so all later batches are spooled to disk.
+      .ConsumeNext(RowBatchBuilder(input_rd_0, 2, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<types::Int64Value>({7, 7})
+                       .AddColumn<types::Int64Value>({1, 2})
+                       .get(),
+                   0, 0)
+      // Probe table
+      .ConsumeNext(RowBatchBuilder(input_rd_1, 2, false, false)
+                       .AddColumn<types::Int64Value>({7, 7})
+                       .AddColumn<types::Int64Value>({10, 20})
+                       .get(),
+                   1, 0)
+      .ConsumeNext(RowBatchBuilder(input_rd_1, 1, true, true)
+                       .AddColumn<types::Int64Value>({7})
+                       .AddColumn<types::Int64Value>({30})
+                       .get(),
+                   1, 0)
+      // Build table eos kicks off the partition-at-a-time join of the spilled inputs.
+      .ConsumeNext(RowBatchBuilder(input_rd_0, 1, /*eow*/ true, /*eos*/ true)
+                       .AddColumn<types::Int64Value>({7})
+                       .AddColumn<types::Int64Value>({3})
+                       .get(),
+                   0, 1)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 9, true, true)
+                          .AddColumn<types::Int64Value>({1, 2, 3, 1, 2, 3, 1, 2, 3})
+                          .AddColumn<types::Int64Value>({10, 10, 10, 20, 20, 20, 30, 30, 30})
+                          .get(),
+                      true)
+      .Close();
+
+  FLAGS_carnot_equijoin_spill_threshold_bytes = prev_threshold;
+}
+
 TEST_F(JoinNodeTest, unordered_many_matches) {
   // Left table input: [left_0:Time, left_1:Int64]
   // Right table input: [right_0:Int64, right_1:Time]
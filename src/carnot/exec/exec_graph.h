@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <sched.h>
 #include <stddef.h>
 #include <algorithm>
 #include <condition_variable>
@@ -32,6 +33,7 @@
 #include "src/carnot/exec/exec_node.h"
 #include "src/carnot/exec/exec_state.h"
 #include "src/carnot/exec/memory_source_node.h"
+#include "src/carnot/exec/query_scheduler.h"
 #include "src/carnot/plan/plan_fragment.h"
 #include "src/carnot/plan/plan_state.h"
 #include "src/common/base/base.h"
@@ -151,6 +153,14 @@ class ExecutionGraph {
    */
   void testing_set_exec_state(ExecState* exec_state) { exec_state_ = exec_state; }
 
+  /**
+   * Sets the query's scheduler ticket, making execution cooperative: the graph calls
+   * Ticket::Yield() between rounds of batch generation so other queries sharing the Carnot
+   * instance get their turn. The ticket must outlive Execute(). Without a ticket the graph runs
+   * uninterrupted, which unit tests and standalone uses rely on.
+   */
+  void set_query_ticket(QueryScheduler::Ticket* ticket) { query_ticket_ = ticket; }
+
   // Check the upstream connection health for a given GRPC source.
   // If it is not healthy, then we will just omit this particular source from the query,
   // since an input agent may have just been deleted or some other legitimate reason.
@@ -209,12 +219,19 @@ class ExecutionGraph {
 
   Status ExecuteSources();
 
+  // If --carnot_numa_aware_exec is set and the home NUMA nodes of this query's source tables have
+  // a clear majority, pins the calling execution thread to that node, saving the previous
+  // affinity in `prev_affinity`. Returns true iff the thread was pinned (and must be restored).
+  bool MaybePinToSourceNumaNode(cpu_set_t* prev_affinity);
+
   ExecState* exec_state_;
   ObjectPool pool_{"exec_graph_pool"};
   table_store::schema::Schema* schema_;
   plan::PlanState* plan_state_;
   plan::PlanFragment* pf_;
   std::vector<int64_t> sources_;
+  // Names of the tables backing this query's memory sources, used for NUMA placement.
+  std::vector<std::string> memory_source_table_names_;
   absl::flat_hash_set<int64_t> grpc_sources_;
   absl::flat_hash_set<int64_t> grpc_sinks_;
   std::unordered_map<int64_t, ExecNode*> nodes_;
@@ -234,6 +251,10 @@ class ExecutionGraph {
   // (Doesn't apply if there is only one active source.)
   int32_t consecutive_generate_calls_per_source_ = kDefaultConsecutiveGenerateCallsPerSource;
 
+  // Execution slot for this query in the instance-wide scheduler, or nullptr when execution is
+  // not scheduled cooperatively. Not owned.
+  QueryScheduler::Ticket* query_ticket_ = nullptr;
+
   // Whether or not the graph should continue executing or wait for more work to do.
   bool continue_ = false;
   std::mutex execution_mutex_;
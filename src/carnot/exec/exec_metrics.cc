@@ -32,4 +32,11 @@ ExecMetrics::ExecMetrics(prometheus::Registry* registry)
               .Name("otlp_timeouts")
               .Help("Total number of timeouts which occurred when exporting data to an OTLP client")
               .Register(*registry)
-              .Add({{"name", "spans"}})) {}
+              .Add({{"name", "spans"}})),
+      exec_mem_pool_recycled_bytes_counter(
+          prometheus::BuildCounter()
+              .Name("exec_mem_pool_recycled_bytes")
+              .Help("Total bytes served from per-query exec memory pool free lists instead of "
+                    "the backing allocator")
+              .Register(*registry)
+              .Add({})) {}
@@ -27,4 +27,5 @@ struct ExecMetrics {
 
   prometheus::Counter& otlp_metrics_timeout_counter;
   prometheus::Counter& otlp_spans_timeout_counter;
+  prometheus::Counter& exec_mem_pool_recycled_bytes_counter;
 };
@@ -83,6 +83,45 @@ struct ExecNodeStats {
     total_timer.Stop();
   }
 
+  // Sampled cycle timing runs on every query — not just under analyze — so production slowness
+  // can be diagnosed from query results without attaching perf. One in kTimingSampleInterval
+  // batches is timed with the CPU cycle counter, keeping the steady-state cost of an untimed
+  // batch to a single counter increment.
+  bool SampleTimingStart() {
+    if ((sample_seq_++ % kTimingSampleInterval) != 0) {
+      return false;
+    }
+    sampling_active_ = true;
+    sample_start_cycles_ = CycleCounter();
+    return true;
+  }
+
+  void SampleTimingStop() {
+    sampled_cycles += CycleCounter() - sample_start_cycles_;
+    ++sampled_batches;
+    sampling_active_ = false;
+  }
+
+  // Like the child timer, cycles spent in children during a sampled batch are tracked separately
+  // so self time can be attributed.
+  void ResumeSampledChildCycles() {
+    if (!sampling_active_) {
+      return;
+    }
+    sampled_child_start_cycles_ = CycleCounter();
+  }
+
+  void StopSampledChildCycles() {
+    if (!sampling_active_) {
+      return;
+    }
+    sampled_child_cycles += CycleCounter() - sampled_child_start_cycles_;
+  }
+
+  int64_t SampledSelfCycles() const {
+    return static_cast<int64_t>(sampled_cycles - sampled_child_cycles);
+  }
+
   void AddExtraMetric(std::string_view key, double value) {
     if (!collect_exec_stats) {
       return;
@@ -122,9 +161,22 @@ struct ExecNodeStats {
   // Flag to determine whether to collect stats or not.
   bool collect_exec_stats;
 
+  // Sampled cycle timing (always on). Every kTimingSampleInterval-th batch through the node is
+  // timed with the cycle counter; totals are in raw (machine-relative) cycles.
+  static constexpr uint64_t kTimingSampleInterval = 64;
+  int64_t sampled_batches = 0;
+  uint64_t sampled_cycles = 0;
+  uint64_t sampled_child_cycles = 0;
+
   // Extra metrics to store.
   absl::flat_hash_map<std::string, double> extra_metrics;
   absl::flat_hash_map<std::string, std::string> extra_info;
+
+ private:
+  uint64_t sample_seq_ = 0;
+  uint64_t sample_start_cycles_ = 0;
+  uint64_t sampled_child_start_cycles_ = 0;
+  bool sampling_active_ = false;
 };
 
 /**
@@ -195,7 +247,11 @@ class ExecNode {
     DCHECK(is_initialized_);
     DCHECK(type() == ExecNodeType::kSourceNode);
     stats_->ResumeTotalTimer();
+    bool sampled = stats_->SampleTimingStart();
     PX_RETURN_IF_ERROR(GenerateNextImpl(exec_state));
+    if (sampled) {
+      stats_->SampleTimingStop();
+    }
     stats_->StopTotalTimer();
     return Status::OK();
   }
@@ -220,7 +276,11 @@ class ExecNode {
     }
     stats_->AddInputStats(rb);
     stats_->ResumeTotalTimer();
+    bool sampled = stats_->SampleTimingStart();
     PX_RETURN_IF_ERROR(ConsumeNextImpl(exec_state, rb, parent_index));
+    if (sampled) {
+      stats_->SampleTimingStop();
+    }
     stats_->StopTotalTimer();
     return Status::OK();
   }
@@ -284,9 +344,11 @@ class ExecNode {
    */
   Status SendRowBatchToChildren(ExecState* exec_state, const table_store::schema::RowBatch& rb) {
     stats_->ResumeChildTimer();
+    stats_->ResumeSampledChildCycles();
     for (size_t i = 0; i < children_.size(); ++i) {
       PX_RETURN_IF_ERROR(children_[i]->ConsumeNext(exec_state, rb, parent_ids_for_children_[i]));
     }
+    stats_->StopSampledChildCycles();
     stats_->StopChildTimer();
     stats_->AddOutputStats(rb);
     if (rb.eos()) {
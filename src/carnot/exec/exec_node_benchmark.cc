@@ -0,0 +1,403 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Benchmarks for the exec nodes and full ExecutionGraph pipelines, measuring rows/sec
+ * (items_per_second) for the canonical query shapes: filter-heavy scans, high-cardinality
+ * group-bys, n-way unions, and equijoins. Inputs come from the src/datagen generators so the
+ * distributions stay consistent between runs and releases.
+ */
+
+#include <arrow/memory_pool.h>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/strings/str_cat.h>
+#include <absl/strings/substitute.h>
+#include <google/protobuf/text_format.h>
+#include <sole.hpp>
+
+#include "src/carnot/exec/agg_node.h"
+#include "src/carnot/exec/equijoin_node.h"
+#include "src/carnot/exec/exec_graph.h"
+#include "src/carnot/exec/exec_state.h"
+#include "src/carnot/exec/filter_node.h"
+#include "src/carnot/exec/test_utils.h"
+#include "src/carnot/exec/union_node.h"
+#include "src/carnot/plan/operators.h"
+#include "src/carnot/plan/plan_state.h"
+#include "src/carnot/planpb/plan.pb.h"
+#include "src/carnot/planpb/test_proto.h"
+#include "src/carnot/udf/base.h"
+#include "src/carnot/udf/registry.h"
+#include "src/carnot/udf/udf.h"
+#include "src/common/base/base.h"
+#include "src/datagen/datagen.h"
+#include "src/shared/types/arrow_adapter.h"
+#include "src/shared/types/types.h"
+#include "src/table_store/table_store.h"
+
+using px::carnot::exec::ExecState;
+using px::carnot::exec::MockMetricsStubGenerator;
+using px::carnot::exec::MockResultSinkStubGenerator;
+using px::carnot::exec::MockTraceStubGenerator;
+using px::carnot::exec::RowBatchBuilder;
+using px::carnot::udf::FunctionContext;
+using px::carnot::udf::Registry;
+using px::table_store::schema::RowBatch;
+using px::table_store::schema::RowDescriptor;
+using px::types::DataType;
+using px::types::Int64Value;
+
+constexpr int kBenchBatchRows = 1024;
+constexpr int kBenchNumBatches = 64;
+
+class EqUDF : public px::carnot::udf::ScalarUDF {
+ public:
+  px::types::BoolValue Exec(FunctionContext*, Int64Value v1, Int64Value v2) {
+    return v1.val == v2.val;
+  }
+};
+
+class SumUDA : public px::carnot::udf::UDA {
+ public:
+  void Update(FunctionContext*, Int64Value v) { sum_ = sum_.val + v.val; }
+  void Merge(FunctionContext*, const SumUDA& other) { sum_ = sum_.val + other.sum_.val; }
+  Int64Value Finalize(FunctionContext*) { return sum_; }
+
+ protected:
+  Int64Value sum_ = 0;
+};
+
+std::unique_ptr<ExecState> MakeBenchmarkExecState(Registry* registry) {
+  auto table_store = std::make_shared<px::table_store::TableStore>();
+  return std::make_unique<ExecState>(registry, table_store, MockResultSinkStubGenerator,
+                                     MockMetricsStubGenerator, MockTraceStubGenerator,
+                                     sole::uuid4(), nullptr);
+}
+
+px::carnot::planpb::Operator OperatorFromPbtxt(const std::string& pbtxt) {
+  px::carnot::planpb::Operator op_pb;
+  CHECK(google::protobuf::TextFormat::MergeFromString(pbtxt, &op_pb)) << "Failed to parse proto";
+  return op_pb;
+}
+
+// Builds batches of [key:INT64, value:INT64] rows with keys uniform in [0, cardinality).
+std::vector<RowBatch> MakeKeyValueBatches(const RowDescriptor& rd, int num_batches,
+                                          int64_t cardinality) {
+  std::vector<RowBatch> batches;
+  batches.reserve(num_batches);
+  for (int i = 0; i < num_batches; ++i) {
+    bool last = i == num_batches - 1;
+    batches.push_back(
+        RowBatchBuilder(rd, kBenchBatchRows, /*eow*/ last, /*eos*/ last)
+            .AddColumn<Int64Value>(
+                px::datagen::CreateLargeData<Int64Value>(kBenchBatchRows, 0, cardinality - 1))
+            .AddColumn<Int64Value>(px::datagen::CreateLargeData<Int64Value>(kBenchBatchRows))
+            .get());
+  }
+  return batches;
+}
+
+// Filter-heavy scan: eq(col0, 1) over [INT64, INT64, STRING] rows. The selectivity is set by the
+// range col0 is drawn from, so the match-rate sweep shows the cost of the selection copy.
+// NOLINTNEXTLINE : runtime/references.
+void BM_FilterNode(benchmark::State& state) {
+  int64_t match_one_in = state.range(0);
+
+  auto func_registry = std::make_unique<Registry>("bench_registry");
+  PX_CHECK_OK(func_registry->Register<EqUDF>("eq"));
+  auto exec_state = MakeBenchmarkExecState(func_registry.get());
+  PX_CHECK_OK(exec_state->AddScalarUDF(0, "eq", {DataType::INT64, DataType::INT64}));
+
+  auto op_proto = px::carnot::planpb::testutils::CreateTestFilterTwoCols();
+  auto plan_node = px::carnot::plan::FilterOperator::FromProto(op_proto, /*id*/ 1);
+
+  RowDescriptor rd({DataType::INT64, DataType::INT64, DataType::STRING});
+
+  px::datagen::UniformParams val_params(0, 63);
+  px::datagen::UniformParams len_params(8, 16);
+  std::vector<RowBatch> batches;
+  for (int i = 0; i < kBenchNumBatches; ++i) {
+    auto strings = px::datagen::CreateLargeStringData(kBenchBatchRows, &val_params, &len_params);
+    batches.push_back(
+        RowBatchBuilder(rd, kBenchBatchRows, /*eow*/ false, /*eos*/ false)
+            .AddColumn<Int64Value>(
+                px::datagen::CreateLargeData<Int64Value>(kBenchBatchRows, 0, match_one_in - 1))
+            .AddColumn<Int64Value>(px::datagen::CreateLargeData<Int64Value>(kBenchBatchRows))
+            .AddColumn<px::types::StringValue>(strings.ConsumeValueOrDie())
+            .get());
+  }
+
+  px::carnot::exec::FilterNode node;
+  PX_CHECK_OK(node.Init(*plan_node, rd, {rd}));
+  PX_CHECK_OK(node.Prepare(exec_state.get()));
+  PX_CHECK_OK(node.Open(exec_state.get()));
+
+  for (auto _ : state) {
+    for (const auto& rb : batches) {
+      PX_CHECK_OK(node.ConsumeNext(exec_state.get(), rb, 0));
+    }
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * kBenchNumBatches * kBenchBatchRows);
+}
+
+// ~1% and ~50% of rows pass the filter.
+BENCHMARK(BM_FilterNode)->Unit(benchmark::kMillisecond)->Arg(100)->Arg(2);
+
+constexpr char kBenchGroupAggPbtxt[] = R"(
+op_type: AGGREGATE_OPERATOR
+agg_op {
+  windowed: false
+  values {
+    name: "sum"
+    args {
+      column {
+        node: 0
+        index: 1
+      }
+    }
+  }
+  groups {
+    node: 0
+    index: 0
+  }
+  group_names: "g0"
+  value_names: "sum"
+  partial_agg: true
+  finalize_results: true
+})";
+
+// Group-by with a cardinality sweep: low cardinality stresses per-row hashing, high cardinality
+// stresses hash map growth and the output conversion at eos.
+// NOLINTNEXTLINE : runtime/references.
+void BM_AggNodeGroupBy(benchmark::State& state) {
+  int64_t cardinality = state.range(0);
+
+  auto func_registry = std::make_unique<Registry>("bench_registry");
+  PX_CHECK_OK(func_registry->Register<SumUDA>("sum"));
+  auto exec_state = MakeBenchmarkExecState(func_registry.get());
+  PX_CHECK_OK(exec_state->AddUDA(0, "sum", {DataType::INT64}));
+
+  auto op_proto = OperatorFromPbtxt(kBenchGroupAggPbtxt);
+  auto plan_node = px::carnot::plan::AggregateOperator::FromProto(op_proto, /*id*/ 1);
+
+  RowDescriptor input_rd({DataType::INT64, DataType::INT64});
+  RowDescriptor output_rd({DataType::INT64, DataType::INT64});
+  auto batches = MakeKeyValueBatches(input_rd, kBenchNumBatches, cardinality);
+
+  for (auto _ : state) {
+    // The agg is a blocking operator, so each iteration needs a fresh node to run to eos.
+    px::carnot::exec::AggNode node;
+    PX_CHECK_OK(node.Init(*plan_node, output_rd, {input_rd}));
+    PX_CHECK_OK(node.Prepare(exec_state.get()));
+    PX_CHECK_OK(node.Open(exec_state.get()));
+    for (const auto& rb : batches) {
+      PX_CHECK_OK(node.ConsumeNext(exec_state.get(), rb, 0));
+    }
+    PX_CHECK_OK(node.Close(exec_state.get()));
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * kBenchNumBatches * kBenchBatchRows);
+}
+
+BENCHMARK(BM_AggNodeGroupBy)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(16)
+    ->Range(16, 1 << 16);
+
+std::string UnionPbtxt(int num_parents) {
+  std::string mappings;
+  for (int i = 0; i < num_parents; ++i) {
+    absl::StrAppend(&mappings, "column_mappings { column_indexes: 0 column_indexes: 1 }\n");
+  }
+  return absl::Substitute(px::carnot::planpb::testutils::kOperatorProtoTmpl, "UNION_OPERATOR",
+                          "union_op",
+                          absl::StrCat("column_names: \"a\"\ncolumn_names: \"b\"\n", mappings));
+}
+
+// n-way unordered union, with the input batches spread round-robin across the parents.
+// NOLINTNEXTLINE : runtime/references.
+void BM_UnionNode(benchmark::State& state) {
+  int num_parents = state.range(0);
+
+  auto func_registry = std::make_unique<Registry>("bench_registry");
+  auto exec_state = MakeBenchmarkExecState(func_registry.get());
+
+  auto op_proto = OperatorFromPbtxt(UnionPbtxt(num_parents));
+  auto plan_node = px::carnot::plan::UnionOperator::FromProto(op_proto, /*id*/ 1);
+
+  RowDescriptor rd({DataType::INT64, DataType::INT64});
+  std::vector<RowDescriptor> input_rds(num_parents, rd);
+
+  int batches_per_parent = kBenchNumBatches / num_parents;
+  auto batches = MakeKeyValueBatches(rd, batches_per_parent, 100);
+
+  for (auto _ : state) {
+    px::carnot::exec::UnionNode node;
+    PX_CHECK_OK(node.Init(*plan_node, rd, input_rds));
+    PX_CHECK_OK(node.Prepare(exec_state.get()));
+    PX_CHECK_OK(node.Open(exec_state.get()));
+    node.disable_data_flush_timeout();
+    for (int i = 0; i < batches_per_parent; ++i) {
+      for (int parent = 0; parent < num_parents; ++parent) {
+        PX_CHECK_OK(node.ConsumeNext(exec_state.get(), batches[i], parent));
+      }
+    }
+    PX_CHECK_OK(node.Close(exec_state.get()));
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * batches_per_parent * num_parents *
+                          kBenchBatchRows);
+}
+
+BENCHMARK(BM_UnionNode)->Unit(benchmark::kMillisecond)->Arg(2)->Arg(4)->Arg(8);
+
+constexpr char kBenchJoinPbtxt[] = R"(
+type: INNER
+equality_conditions {
+  left_column_index: 0
+  right_column_index: 0
+}
+output_columns: {
+  parent_index: 0
+  column_index: 1
+}
+output_columns: {
+  parent_index: 1
+  column_index: 1
+}
+column_names: "left_1"
+column_names: "right_1"
+rows_per_batch: 1024
+)";
+
+// Inner equijoin on an INT64 key; the key cardinality sets the number of build-side matches per
+// probe row.
+// NOLINTNEXTLINE : runtime/references.
+void BM_EquijoinNode(benchmark::State& state) {
+  int64_t cardinality = state.range(0);
+
+  auto func_registry = std::make_unique<Registry>("bench_registry");
+  auto exec_state = MakeBenchmarkExecState(func_registry.get());
+
+  auto op_proto = OperatorFromPbtxt(absl::Substitute(
+      px::carnot::planpb::testutils::kOperatorProtoTmpl, "JOIN_OPERATOR", "join_op",
+      kBenchJoinPbtxt));
+  auto plan_node = px::carnot::plan::JoinOperator::FromProto(op_proto, /*id*/ 1);
+
+  RowDescriptor rd({DataType::INT64, DataType::INT64});
+  RowDescriptor output_rd({DataType::INT64, DataType::INT64});
+
+  int batches_per_side = kBenchNumBatches / 2;
+  auto build_batches = MakeKeyValueBatches(rd, batches_per_side, cardinality);
+  auto probe_batches = MakeKeyValueBatches(rd, batches_per_side, cardinality);
+
+  for (auto _ : state) {
+    px::carnot::exec::EquijoinNode node;
+    PX_CHECK_OK(node.Init(*plan_node, output_rd, {rd, rd}));
+    PX_CHECK_OK(node.Prepare(exec_state.get()));
+    PX_CHECK_OK(node.Open(exec_state.get()));
+    for (const auto& rb : build_batches) {
+      PX_CHECK_OK(node.ConsumeNext(exec_state.get(), rb, 0));
+    }
+    for (const auto& rb : probe_batches) {
+      PX_CHECK_OK(node.ConsumeNext(exec_state.get(), rb, 1));
+    }
+    PX_CHECK_OK(node.Close(exec_state.get()));
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * batches_per_side * 2 * kBenchBatchRows);
+}
+
+BENCHMARK(BM_EquijoinNode)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(64)
+    ->Range(1 << 10, 1 << 16);
+
+class AddUDF : public px::carnot::udf::ScalarUDF {
+ public:
+  px::types::Float64Value Exec(FunctionContext*, Int64Value v1, px::types::Float64Value v2) {
+    return v1.val + v2.val;
+  }
+};
+
+class MultiplyUDF : public px::carnot::udf::ScalarUDF {
+ public:
+  px::types::Float64Value Exec(FunctionContext*, px::types::Float64Value v1, Int64Value v2) {
+    return v1.val * v2.val;
+  }
+};
+
+// End-to-end pipeline: memory source -> map -> map -> memory sink, through ExecutionGraph, so the
+// per-batch overheads between nodes are included along with the operator work.
+// NOLINTNEXTLINE : runtime/references.
+void BM_ExecutionGraphLinear(benchmark::State& state) {
+  int num_batches = state.range(0);
+
+  auto func_registry = std::make_unique<Registry>("bench_registry");
+  func_registry->RegisterOrDie<AddUDF>("add");
+  func_registry->RegisterOrDie<MultiplyUDF>("multiply");
+
+  px::carnot::planpb::PlanFragment pf_pb;
+  CHECK(google::protobuf::TextFormat::MergeFromString(
+      px::carnot::planpb::testutils::kLinearPlanFragment, &pf_pb));
+  auto plan_fragment = std::make_shared<px::carnot::plan::PlanFragment>(1);
+  PX_CHECK_OK(plan_fragment->Init(pf_pb));
+
+  auto plan_state = std::make_unique<px::carnot::plan::PlanState>(func_registry.get());
+  auto schema = std::make_shared<px::table_store::schema::Schema>();
+  schema->AddRelation(
+      1, px::table_store::schema::Relation(
+             std::vector<DataType>({DataType::INT64, DataType::BOOLEAN, DataType::FLOAT64}),
+             std::vector<std::string>({"a", "b", "c"})));
+
+  px::table_store::schema::Relation rel({DataType::INT64, DataType::BOOLEAN, DataType::FLOAT64},
+                                        {"col1", "col2", "col3"});
+  auto table = px::table_store::Table::Create("test", rel);
+  for (int i = 0; i < num_batches; ++i) {
+    RowBatch rb(RowDescriptor(rel.col_types()), kBenchBatchRows);
+    auto ints = px::datagen::CreateLargeData<Int64Value>(kBenchBatchRows);
+    std::vector<px::types::BoolValue> bools(kBenchBatchRows, true);
+    std::vector<px::types::Float64Value> floats(kBenchBatchRows, 1.5);
+    PX_CHECK_OK(rb.AddColumn(px::types::ToArrow(ints, arrow::default_memory_pool())));
+    PX_CHECK_OK(rb.AddColumn(px::types::ToArrow(bools, arrow::default_memory_pool())));
+    PX_CHECK_OK(rb.AddColumn(px::types::ToArrow(floats, arrow::default_memory_pool())));
+    PX_CHECK_OK(table->WriteRowBatch(rb));
+  }
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto table_store = std::make_shared<px::table_store::TableStore>();
+    table_store->AddTable("numbers", table);
+    auto exec_state = std::make_unique<ExecState>(
+        func_registry.get(), table_store, MockResultSinkStubGenerator, MockMetricsStubGenerator,
+        MockTraceStubGenerator, sole::uuid4(), nullptr);
+    PX_CHECK_OK(exec_state->AddScalarUDF(0, "add", {DataType::INT64, DataType::FLOAT64}));
+    PX_CHECK_OK(exec_state->AddScalarUDF(1, "multiply", {DataType::FLOAT64, DataType::INT64}));
+    state.ResumeTiming();
+
+    px::carnot::exec::ExecutionGraph graph;
+    PX_CHECK_OK(graph.Init(schema.get(), plan_state.get(), exec_state.get(), plan_fragment.get(),
+                           /* collect_exec_node_stats */ false));
+    PX_CHECK_OK(graph.Execute());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * num_batches * kBenchBatchRows);
+}
+
+BENCHMARK(BM_ExecutionGraphLinear)->Unit(benchmark::kMillisecond)->Arg(16)->Arg(128);
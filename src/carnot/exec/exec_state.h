@@ -22,6 +22,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -31,6 +32,8 @@
 #include "src/carnot/carnotpb/carnot.pb.h"
 #include "src/carnot/exec/exec_metrics.h"
 #include "src/carnot/exec/grpc_router.h"
+#include "src/carnot/exec/recycling_memory_pool.h"
+#include "src/carnot/exec/standing_query_registry.h"
 #include "src/carnot/udf/model_pool.h"
 #include "src/carnot/udf/registry.h"
 #include "src/common/base/base.h"
@@ -72,7 +75,7 @@ class ExecState {
       const TraceStubGenerator& trace_stub_generator, const sole::uuid& query_id,
       udf::ModelPool* model_pool, GRPCRouter* grpc_router = nullptr,
       std::function<void(grpc::ClientContext*)> add_auth_func = [](grpc::ClientContext*) {},
-      ExecMetrics* exec_metrics = nullptr)
+      ExecMetrics* exec_metrics = nullptr, StandingQueryRegistry* standing_query_registry = nullptr)
       : func_registry_(func_registry),
         table_store_(std::move(table_store)),
         stub_generator_(stub_generator),
@@ -82,17 +85,19 @@ class ExecState {
         model_pool_(model_pool),
         grpc_router_(grpc_router),
         add_auth_to_grpc_client_context_func_(add_auth_func),
-        exec_metrics_(exec_metrics) {}
+        exec_metrics_(exec_metrics),
+        standing_query_registry_(standing_query_registry) {}
 
   ~ExecState() {
     if (grpc_router_ != nullptr) {
       grpc_router_->DeleteQuery(query_id_);
     }
+    if (exec_metrics_ != nullptr) {
+      exec_metrics_->exec_mem_pool_recycled_bytes_counter.Increment(
+          recycling_mem_pool()->ConsumeRecycledBytesDelta());
+    }
   }
-  arrow::MemoryPool* exec_mem_pool() {
-    // TOOD(zasgar): Make this the correct pool.
-    return arrow::default_memory_pool();
-  }
+  arrow::MemoryPool* exec_mem_pool() { return recycling_mem_pool(); }
 
   udf::Registry* func_registry() { return func_registry_; }
 
@@ -102,23 +107,34 @@ class ExecState {
 
   udf::ModelPool* model_pool() { return model_pool_; }
 
+  // The planner assigns funcs dense sequential ids within a plan, so definitions live in flat
+  // tables indexed by id and per-call dispatch is a vector index instead of a map lookup.
   Status AddScalarUDF(int64_t id, const std::string& name,
                       const std::vector<types::DataType> arg_types) {
     PX_ASSIGN_OR_RETURN(auto def, func_registry_->GetScalarUDFDefinition(name, arg_types));
+    if (static_cast<size_t>(id) >= id_to_scalar_udf_map_.size()) {
+      id_to_scalar_udf_map_.resize(id + 1, nullptr);
+    }
     id_to_scalar_udf_map_[id] = def;
     return Status::OK();
   }
 
   Status AddUDA(int64_t id, const std::string& name, const std::vector<types::DataType> arg_types) {
     PX_ASSIGN_OR_RETURN(auto def, func_registry_->GetUDADefinition(name, arg_types));
+    if (static_cast<size_t>(id) >= id_to_uda_map_.size()) {
+      id_to_uda_map_.resize(id + 1, nullptr);
+    }
     id_to_uda_map_[id] = def;
     return Status::OK();
   }
 
   // This function returns a stub to a service that is responsible for receiving results.
   // Currently, it will either be a Kelvin instance or a query broker.
+  // Locked because GRPC sink writer threads may reconnect concurrently with each other or with
+  // the execution thread.
   carnotpb::ResultSinkService::StubInterface* ResultSinkServiceStub(
       const std::string& remote_address, const std::string& ssl_targetname) {
+    std::lock_guard<std::mutex> lock(result_sink_stubs_mu_);
     if (result_sink_stub_map_.contains(remote_address)) {
       return result_sink_stub_map_[remote_address];
     }
@@ -158,13 +174,19 @@ class ExecState {
     return raw;
   }
 
-  udf::ScalarUDFDefinition* GetScalarUDFDefinition(int64_t id) { return id_to_scalar_udf_map_[id]; }
+  udf::ScalarUDFDefinition* GetScalarUDFDefinition(int64_t id) {
+    DCHECK_LT(static_cast<size_t>(id), id_to_scalar_udf_map_.size());
+    return id_to_scalar_udf_map_[id];
+  }
 
-  std::map<int64_t, udf::ScalarUDFDefinition*> id_to_scalar_udf_map() {
+  const std::vector<udf::ScalarUDFDefinition*>& id_to_scalar_udf_map() {
     return id_to_scalar_udf_map_;
   }
 
-  udf::UDADefinition* GetUDADefinition(int64_t id) { return id_to_uda_map_[id]; }
+  udf::UDADefinition* GetUDADefinition(int64_t id) {
+    DCHECK_LT(static_cast<size_t>(id), id_to_uda_map_.size());
+    return id_to_uda_map_[id];
+  }
 
   std::unique_ptr<udf::FunctionContext> CreateFunctionContext() {
     auto ctx = std::make_unique<udf::FunctionContext>(metadata_state_, model_pool_);
@@ -173,7 +195,21 @@ class ExecState {
 
   // A node (ie. Limit) can call this method to say no more records will be processed for this
   // source. That node is responsible for setting eos.
-  void StopSource(int64_t src_id) { source_id_to_keep_running_map_[src_id] = false; }
+  void StopSource(int64_t src_id) {
+    source_id_to_keep_running_map_[src_id] = false;
+    // If remote fragments feed this source, have the router hang up on their result streams so
+    // the upstream agents stop producing too.
+    if (grpc_router_ != nullptr) {
+      grpc_router_->StopSourceStreams(query_id_, src_id);
+    }
+  }
+
+  // Stops the source currently driving execution. Called by sink nodes when the receiver hangs
+  // up on their result stream (e.g. a limit in a downstream fragment was satisfied).
+  void StopCurrentSource() {
+    DCHECK(current_source_set_);
+    StopSource(current_source_);
+  }
 
   bool keep_running() {
     DCHECK(current_source_set_);
@@ -202,6 +238,17 @@ class ExecState {
 
   ExecMetrics* exec_metrics() { return exec_metrics_; }
 
+  // The engine-wide registry of parked standing query cursors; nullptr when the engine doesn't
+  // support standing queries (e.g. in tests).
+  StandingQueryRegistry* standing_query_registry() { return standing_query_registry_; }
+
+  // Non-empty when this query is a standing query, in which case memory source cursors are
+  // parked in the standing query registry between executions.
+  const std::string& standing_query_key() const { return standing_query_key_; }
+  void set_standing_query_key(const std::string& standing_query_key) {
+    standing_query_key_ = standing_query_key;
+  }
+
  private:
   udf::Registry* func_registry_;
   std::shared_ptr<table_store::TableStore> table_store_;
@@ -209,18 +256,29 @@ class ExecState {
   const ResultSinkStubGenerator stub_generator_;
   const MetricsStubGenerator metrics_stub_generator_;
   const TraceStubGenerator trace_stub_generator_;
-  std::map<int64_t, udf::ScalarUDFDefinition*> id_to_scalar_udf_map_;
-  std::map<int64_t, udf::UDADefinition*> id_to_uda_map_;
+  std::vector<udf::ScalarUDFDefinition*> id_to_scalar_udf_map_;
+  std::vector<udf::UDADefinition*> id_to_uda_map_;
   const sole::uuid query_id_;
   udf::ModelPool* model_pool_;
   GRPCRouter* grpc_router_ = nullptr;
   std::function<void(grpc::ClientContext*)> add_auth_to_grpc_client_context_func_;
   ExecMetrics* exec_metrics_;
+  StandingQueryRegistry* standing_query_registry_ = nullptr;
+  std::string standing_query_key_;
+
+  // Shared across queries rather than per-query: result arrays can outlive the query in the
+  // table store (e.g. memory sink output), so the pool backing them must outlive any ExecState.
+  static RecyclingMemoryPool* recycling_mem_pool() {
+    static RecyclingMemoryPool* pool = new RecyclingMemoryPool(arrow::default_memory_pool());
+    return pool;
+  }
 
   int64_t current_source_ = 0;
   bool current_source_set_ = false;
   std::map<int64_t, bool> source_id_to_keep_running_map_;
 
+  // Guards the result sink stub pool/map, which GRPC sink writer threads access on reconnect.
+  std::mutex result_sink_stubs_mu_;
   std::vector<std::unique_ptr<carnotpb::ResultSinkService::StubInterface>> result_sink_stubs_pool_;
   // Mapping of remote address to stub that serves that address.
   absl::flat_hash_map<std::string, carnotpb::ResultSinkService::StubInterface*>
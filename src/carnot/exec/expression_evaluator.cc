@@ -173,9 +173,12 @@ Status ScalarExpressionEvaluator::InitFuncsInExpression(
 }
 
 Status VectorNativeScalarExpressionEvaluator::Open(ExecState* exec_state) {
-  for (const auto& kv : exec_state->id_to_scalar_udf_map()) {
-    auto udf = kv.second->Make();
-    id_to_udf_map_[kv.first] = std::move(udf);
+  const auto& scalar_udf_defs = exec_state->id_to_scalar_udf_map();
+  id_to_udf_map_.resize(scalar_udf_defs.size());
+  for (size_t i = 0; i < scalar_udf_defs.size(); ++i) {
+    if (scalar_udf_defs[i] != nullptr) {
+      id_to_udf_map_[i] = scalar_udf_defs[i]->Make();
+    }
   }
   for (auto expr : expressions_) {
     PX_RETURN_IF_ERROR(InitFuncsInExpression(exec_state, expr));
@@ -184,13 +187,27 @@ Status VectorNativeScalarExpressionEvaluator::Open(ExecState* exec_state) {
 }
 
 Status VectorNativeScalarExpressionEvaluator::Close(ExecState*) {
-  // Nothing here yet.
+  column_wrapper_cache_.clear();
   return Status();
 }
 
+Status VectorNativeScalarExpressionEvaluator::Evaluate(ExecState* exec_state, const RowBatch& input,
+                                                       RowBatch* output) {
+  // Clearing once per batch (rather than per expression) lets columns referenced by several of
+  // the evaluator's expressions share one materialization.
+  column_wrapper_cache_.clear();
+  return ScalarExpressionEvaluator::Evaluate(exec_state, input, output);
+}
+
 StatusOr<types::SharedColumnWrapper>
 VectorNativeScalarExpressionEvaluator::EvaluateSingleExpression(
     ExecState* exec_state, const RowBatch& input, const plan::ScalarExpression& expr) {
+  column_wrapper_cache_.clear();
+  return EvaluateExpressionTree(exec_state, input, expr);
+}
+
+StatusOr<types::SharedColumnWrapper> VectorNativeScalarExpressionEvaluator::EvaluateExpressionTree(
+    ExecState* exec_state, const RowBatch& input, const plan::ScalarExpression& expr) {
   CHECK(exec_state != nullptr);
   CHECK_GT(input.num_columns(), 0);
 
@@ -211,7 +228,12 @@ VectorNativeScalarExpressionEvaluator::EvaluateSingleExpression(
       [&](const plan::Column& col,
           const std::vector<types::SharedColumnWrapper>& children) -> types::SharedColumnWrapper {
         DCHECK_EQ(children.size(), 0ULL);
-        return ColumnWrapper::FromArrow(input.ColumnAt(col.Index()));
+        auto arr = input.ColumnAt(col.Index());
+        auto& cached = column_wrapper_cache_[arr.get()];
+        if (cached == nullptr) {
+          cached = ColumnWrapper::FromArrow(arr);
+        }
+        return cached;
       });
 
   walker.OnScalarFunc(
@@ -268,16 +290,18 @@ Status VectorNativeScalarExpressionEvaluator::EvaluateSingleExpression(
     return Status::OK();
   }
 
-  PX_ASSIGN_OR_RETURN(auto result, VectorNativeScalarExpressionEvaluator::EvaluateSingleExpression(
-                                       exec_state, input, expr));
+  PX_ASSIGN_OR_RETURN(auto result, EvaluateExpressionTree(exec_state, input, expr));
   PX_RETURN_IF_ERROR(output->AddColumn(result->ConvertToArrow(exec_state->exec_mem_pool())));
   return Status::OK();
 }
 
 Status ArrowNativeScalarExpressionEvaluator::Open(ExecState* exec_state) {
-  for (const auto& kv : exec_state->id_to_scalar_udf_map()) {
-    auto udf = kv.second->Make();
-    id_to_udf_map_[kv.first] = std::move(udf);
+  const auto& scalar_udf_defs = exec_state->id_to_scalar_udf_map();
+  id_to_udf_map_.resize(scalar_udf_defs.size());
+  for (size_t i = 0; i < scalar_udf_defs.size(); ++i) {
+    if (scalar_udf_defs[i] != nullptr) {
+      id_to_udf_map_[i] = scalar_udf_defs[i]->Make();
+    }
   }
   for (const auto& expr : expressions_) {
     PX_RETURN_IF_ERROR(InitFuncsInExpression(exec_state, expr));
@@ -26,6 +26,8 @@
 #include <utility>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
+
 #include "src/carnot/exec/exec_state.h"
 #include "src/carnot/plan/scalar_expression.h"
 #include "src/carnot/udf/base.h"
@@ -125,7 +127,9 @@ class ScalarExpressionEvaluator : public ExpressionEvaluator {
                                std::shared_ptr<const plan::ScalarExpression> expr);
   plan::ConstScalarExpressionVector expressions_;
   udf::FunctionContext* function_ctx_ = nullptr;
-  std::map<int64_t, std::unique_ptr<udf::ScalarUDF>> id_to_udf_map_;
+  // UDF instances indexed by the dense func id from the plan, so per-call dispatch is a vector
+  // index rather than a map lookup.
+  std::vector<std::unique_ptr<udf::ScalarUDF>> id_to_udf_map_;
 };
 
 /**
@@ -141,6 +145,9 @@ class VectorNativeScalarExpressionEvaluator : public ScalarExpressionEvaluator {
   Status Open(ExecState* exec_state) override;
   Status Close(ExecState* exec_state) override;
 
+  Status Evaluate(ExecState* exec_state, const table_store::schema::RowBatch& input,
+                  table_store::schema::RowBatch* output) override;
+
   StatusOr<types::SharedColumnWrapper> EvaluateSingleExpression(
       ExecState* exec_state, const table_store::schema::RowBatch& input,
       const plan::ScalarExpression& expr);
@@ -149,6 +156,17 @@ class VectorNativeScalarExpressionEvaluator : public ScalarExpressionEvaluator {
   Status EvaluateSingleExpression(ExecState* exec_state, const table_store::schema::RowBatch& input,
                                   const plan::ScalarExpression& expr,
                                   table_store::schema::RowBatch* output) override;
+
+ private:
+  StatusOr<types::SharedColumnWrapper> EvaluateExpressionTree(
+      ExecState* exec_state, const table_store::schema::RowBatch& input,
+      const plan::ScalarExpression& expr);
+
+  // Per-batch cache of input columns converted to column wrappers, keyed by the underlying arrow
+  // array. A column referenced from several (sub)expressions would otherwise be re-materialized
+  // once per reference. Cleared at the start of each top-level evaluation, so entries never
+  // outlive the input batch they were built from.
+  absl::flat_hash_map<const arrow::Array*, types::SharedColumnWrapper> column_wrapper_cache_;
 };
 
 /**
@@ -76,19 +76,15 @@ Status FilterNode::CloseImpl(ExecState* exec_state) {
 }
 
 template <types::DataType T>
-Status PredicateCopyValues(const types::BoolValueColumnWrapper& pred, const arrow::Array* input_col,
-                           RowBatch* output_rb) {
-  DCHECK_EQ(pred.Size(), static_cast<size_t>(input_col->length()));
-  size_t num_output_records = output_rb->num_rows();
-  size_t num_input_records = input_col->length();
+Status CopySelectedValues(const std::vector<int64_t>& selected_rows, const arrow::Array* input_col,
+                          RowBatch* output_rb) {
+  DCHECK(selected_rows.empty() || selected_rows.back() < input_col->length());
   auto output_col_builder_generic = MakeArrowBuilder(T, arrow::default_memory_pool());
   auto* output_col_builder = static_cast<typename types::DataTypeTraits<T>::arrow_builder_type*>(
       output_col_builder_generic.get());
-  PX_RETURN_IF_ERROR(output_col_builder->Reserve(num_output_records));
-  for (size_t idx = 0; idx < num_input_records; ++idx) {
-    if (udf::UnWrap(pred[idx])) {
-      output_col_builder->UnsafeAppend(types::GetValueFromArrowArray<T>(input_col, idx));
-    }
+  PX_RETURN_IF_ERROR(output_col_builder->Reserve(selected_rows.size()));
+  for (int64_t idx : selected_rows) {
+    output_col_builder->UnsafeAppend(types::GetValueFromArrowArray<T>(input_col, idx));
   }
   std::shared_ptr<arrow::Array> output_array;
   PX_RETURN_IF_ERROR(output_col_builder->Finish(&output_array));
@@ -97,11 +93,9 @@ Status PredicateCopyValues(const types::BoolValueColumnWrapper& pred, const arro
 }
 
 template <>
-Status PredicateCopyValues<types::STRING>(const types::BoolValueColumnWrapper& pred,
-                                          const arrow::Array* input_col, RowBatch* output_rb) {
-  DCHECK_EQ(pred.Size(), static_cast<size_t>(input_col->length()));
-  size_t num_output_records = output_rb->num_rows();
-  size_t num_input_records = input_col->length();
+Status CopySelectedValues<types::STRING>(const std::vector<int64_t>& selected_rows,
+                                         const arrow::Array* input_col, RowBatch* output_rb) {
+  DCHECK(selected_rows.empty() || selected_rows.back() < input_col->length());
   size_t reserved =
       100;  // This can be an arbritrary number, since we do exponential doubling below.
   size_t total_size = 0;
@@ -110,18 +104,16 @@ Status PredicateCopyValues<types::STRING>(const types::BoolValueColumnWrapper& p
   auto* output_col_builder = static_cast<types::DataTypeTraits<types::STRING>::arrow_builder_type*>(
       output_col_builder_generic.get());
 
-  PX_RETURN_IF_ERROR(output_col_builder->Reserve(num_output_records));
+  PX_RETURN_IF_ERROR(output_col_builder->Reserve(selected_rows.size()));
   PX_RETURN_IF_ERROR(output_col_builder->ReserveData(reserved));
-  for (size_t idx = 0; idx < num_input_records; ++idx) {
-    if (udf::UnWrap(pred[idx])) {
-      auto res = types::GetValueFromArrowArray<types::STRING>(input_col, idx);
-      total_size += res.size();
-      while (total_size >= reserved) {
-        reserved *= 2;
-      }
-      PX_RETURN_IF_ERROR(output_col_builder->ReserveData(reserved));
-      output_col_builder->UnsafeAppend(std::move(res));
+  for (int64_t idx : selected_rows) {
+    auto res = types::GetValueFromArrowArray<types::STRING>(input_col, idx);
+    total_size += res.size();
+    while (total_size >= reserved) {
+      reserved *= 2;
     }
+    PX_RETURN_IF_ERROR(output_col_builder->ReserveData(reserved));
+    output_col_builder->UnsafeAppend(std::move(res));
   }
   std::shared_ptr<arrow::Array> output_array;
   PX_RETURN_IF_ERROR(output_col_builder->Finish(&output_array));
@@ -144,24 +136,33 @@ Status FilterNode::ConsumeNextImpl(ExecState* exec_state, const RowBatch& rb, si
 
   DCHECK_EQ(static_cast<size_t>(rb.num_rows()), num_pred);
 
-  // Find out how many of them returned true;
-  size_t num_output_records = 0;
+  // Build the selection vector once, so each column copy only visits the passing rows instead of
+  // re-scanning the whole predicate.
+  selected_rows_.clear();
   for (size_t i = 0; i < num_pred; ++i) {
     if (pred_col_wrapper[i].val) {
-      ++num_output_records;
+      selected_rows_.push_back(i);
     }
   }
+  size_t num_output_records = selected_rows_.size();
 
   RowBatch output_rb(*output_descriptor_, num_output_records);
   DCHECK_EQ(output_descriptor_->size(), plan_node_->selected_cols().size());
 
-  for (const auto& [output_col_idx, input_col_idx] : Enumerate(plan_node_->selected_cols())) {
-    auto input_col = rb.ColumnAt(input_col_idx);
-    auto col_type = output_descriptor_->type(output_col_idx);
+  if (num_output_records == num_pred) {
+    // Every row passed: forward the input columns without copying.
+    for (int64_t input_col_idx : plan_node_->selected_cols()) {
+      PX_RETURN_IF_ERROR(output_rb.AddColumn(rb.ColumnAt(input_col_idx)));
+    }
+  } else {
+    for (const auto& [output_col_idx, input_col_idx] : Enumerate(plan_node_->selected_cols())) {
+      auto input_col = rb.ColumnAt(input_col_idx);
+      auto col_type = output_descriptor_->type(output_col_idx);
 #define TYPE_CASE(_dt_) \
-  PX_RETURN_IF_ERROR(PredicateCopyValues<_dt_>(pred_col_wrapper, input_col.get(), &output_rb));
-    PX_SWITCH_FOREACH_DATATYPE(col_type, TYPE_CASE);
+  PX_RETURN_IF_ERROR(CopySelectedValues<_dt_>(selected_rows_, input_col.get(), &output_rb));
+      PX_SWITCH_FOREACH_DATATYPE(col_type, TYPE_CASE);
 #undef TYPE_CASE
+    }
   }
 
   output_rb.set_eow(rb.eow());
@@ -54,6 +54,11 @@ class FilterNode : public ProcessingNode {
   std::unique_ptr<VectorNativeScalarExpressionEvaluator> evaluator_;
   std::unique_ptr<plan::FilterOperator> plan_node_;
   std::unique_ptr<udf::FunctionContext> function_ctx_;
+
+  // Selection vector for the batch being consumed: indices of the rows that passed the predicate.
+  // Built once per batch and shared by all column copies; reused across batches to avoid
+  // reallocation.
+  std::vector<int64_t> selected_rows_;
 };
 
 }  // namespace exec
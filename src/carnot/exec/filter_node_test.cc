@@ -187,6 +187,44 @@ TEST_F(FilterNodeTest, zero_row_row_batch) {
       .Close();
 }
 
+// Exercises the fast path where every row passes (input columns are forwarded without copying)
+// and the case where no rows pass.
+TEST_F(FilterNodeTest, all_and_none_pass) {
+  auto op_proto = planpb::testutils::CreateTestFilterTwoCols();
+  plan_node_ = plan::FilterOperator::FromProto(op_proto, /*id*/ 1);
+
+  RowDescriptor input_rd({types::DataType::INT64, types::DataType::INT64, types::DataType::STRING});
+  RowDescriptor output_rd(
+      {types::DataType::INT64, types::DataType::INT64, types::DataType::STRING});
+
+  auto tester = exec::ExecNodeTester<FilterNode, plan::FilterOperator>(
+      *plan_node_, output_rd, {input_rd}, exec_state_.get());
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd, 3, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<types::Int64Value>({1, 2, 3})
+                       .AddColumn<types::Int64Value>({1, 2, 3})
+                       .AddColumn<types::StringValue>({"ABC", "DEF", "HELLO"})
+                       .get(),
+                   0)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 3, false, false)
+                          .AddColumn<types::Int64Value>({1, 2, 3})
+                          .AddColumn<types::Int64Value>({1, 2, 3})
+                          .AddColumn<types::StringValue>({"ABC", "DEF", "HELLO"})
+                          .get())
+      .ConsumeNext(RowBatchBuilder(input_rd, 3, true, true)
+                       .AddColumn<types::Int64Value>({1, 2, 3})
+                       .AddColumn<types::Int64Value>({4, 5, 6})
+                       .AddColumn<types::StringValue>({"Hello", "world", "now"})
+                       .get(),
+                   0)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 0, true, true)
+                          .AddColumn<types::Int64Value>({})
+                          .AddColumn<types::Int64Value>({})
+                          .AddColumn<types::StringValue>({})
+                          .get())
+      .Close();
+}
+
 TEST_F(FilterNodeTest, string_pred) {
   auto op_proto = planpb::testutils::CreateTestFilterTwoColsString();
   plan_node_ = plan::FilterOperator::FromProto(op_proto, /*id*/ 1);
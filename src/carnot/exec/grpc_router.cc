@@ -35,12 +35,39 @@ namespace px {
 namespace carnot {
 namespace exec {
 
+GRPCRouter::QueryShard* GRPCRouter::GetQueryShard(const sole::uuid& query_id) const {
+  return &query_shards_[absl::Hash<sole::uuid>{}(query_id) % kNumQueryShards];
+}
+
+std::shared_ptr<GRPCRouter::QueryTracker> GRPCRouter::GetQueryTracker(
+    const sole::uuid& query_id) const {
+  auto* shard = GetQueryShard(query_id);
+  absl::base_internal::SpinLockHolder lock(&shard->shard_lock);
+  auto it = shard->query_trackers.find(query_id);
+  if (it == shard->query_trackers.end()) {
+    return nullptr;
+  }
+  return it->second;
+}
+
 GRPCRouter::SourceNodeTracker* GRPCRouter::GetSourceNodeTracker(QueryTracker* query_tracker,
                                                                 int64_t source_id) {
   absl::base_internal::SpinLockHolder query_lock(&query_tracker->query_lock);
   return &query_tracker->source_node_trackers[source_id];
 }
 
+std::shared_ptr<BatchCredits> GRPCRouter::GetSourceNodeCredits(QueryTracker* query_tracker,
+                                                               int64_t source_id) {
+  auto snt = GetSourceNodeTracker(query_tracker, source_id);
+  absl::base_internal::SpinLockHolder snt_lock(&snt->node_lock);
+  if (snt->source_node == nullptr || snt->source_stopped) {
+    // Pre-registration batches go to the backlog and stopped sources reject batches outright;
+    // neither consumes queue capacity.
+    return nullptr;
+  }
+  return snt->source_node->batch_credits();
+}
+
 Status GRPCRouter::EnqueueRowBatch(QueryTracker* query_tracker,
                                    std::unique_ptr<carnotpb::TransferResultChunkRequest> req) {
   if (!req->has_query_result() || !req->query_result().has_row_batch() ||
@@ -54,6 +81,10 @@ Status GRPCRouter::EnqueueRowBatch(QueryTracker* query_tracker,
   auto snt = GetSourceNodeTracker(query_tracker, req->query_result().grpc_source_id());
   {
     absl::base_internal::SpinLockHolder snt_lock(&snt->node_lock);
+    if (snt->source_stopped) {
+      return error::Cancelled("Source $0 no longer needs results; rejecting result chunk.",
+                              req->query_result().grpc_source_id());
+    }
     // It's possible that we see row batches before we have gotten information about the query. To
     // solve this race, We store a backlog of all the pending batches.
     if (snt->source_node == nullptr) {
@@ -68,6 +99,49 @@ Status GRPCRouter::EnqueueRowBatch(QueryTracker* query_tracker,
   return Status::OK();
 }
 
+bool GRPCRouter::HasLocalSource(const sole::uuid& query_id, int64_t source_id) const {
+  auto query_tracker = GetQueryTracker(query_id);
+  if (query_tracker == nullptr) {
+    return false;
+  }
+  SourceNodeTracker* snt = nullptr;
+  {
+    // Deliberately not GetSourceNodeTracker: this is an existence check and must not create an
+    // entry. node_hash_map gives us a stable pointer to take out of the query lock.
+    absl::base_internal::SpinLockHolder query_lock(&query_tracker->query_lock);
+    auto it = query_tracker->source_node_trackers.find(source_id);
+    if (it == query_tracker->source_node_trackers.end()) {
+      return false;
+    }
+    snt = &it->second;
+  }
+  absl::base_internal::SpinLockHolder snt_lock(&snt->node_lock);
+  return snt->source_node != nullptr && !snt->source_stopped;
+}
+
+Status GRPCRouter::DeliverLocalResultChunk(
+    std::unique_ptr<carnotpb::TransferResultChunkRequest> req) {
+  PX_ASSIGN_OR_RETURN(auto query_id, ParseUUID(req->query_id()));
+  auto query_tracker = GetQueryTracker(query_id);
+  if (query_tracker == nullptr) {
+    return error::NotFound("Query $0 is no longer tracked; dropping locally-delivered chunk.",
+                           query_id.str());
+  }
+  if (!req->has_query_result() || !req->query_result().has_row_batch()) {
+    return error::InvalidArgument("Local result delivery only carries row batch chunks.");
+  }
+  return EnqueueRowBatch(query_tracker.get(), std::move(req));
+}
+
+void GRPCRouter::CloseLocalResultStream(const sole::uuid& query_id, int64_t source_id) {
+  auto query_tracker = GetQueryTracker(query_id);
+  if (query_tracker == nullptr) {
+    // The query already completed or was deleted; nothing to close.
+    return;
+  }
+  MarkResultStreamClosed(query_tracker.get(), source_id);
+}
+
 void GRPCRouter::MarkResultStreamClosed(QueryTracker* query_tracker, int64_t source_id) {
   auto snt = GetSourceNodeTracker(query_tracker, source_id);
   absl::base_internal::SpinLockHolder snt_lock(&snt->node_lock);
@@ -104,17 +178,22 @@ void GRPCRouter::MarkResultStreamContextAsComplete(QueryTracker* query_tracker,
     std::unique_ptr<carnotpb::TransferResultChunkRequest> req, ::grpc::ServerContext* context,
     TransferResultChunkState* state) {
   auto query_id = px::ParseUUID(req->query_id()).ConsumeValueOrDie();
-  {
-    absl::base_internal::SpinLockHolder lock(&id_to_query_tracker_map_lock_);
-    if (!id_to_query_tracker_map_.contains(query_id)) {
+  // A stream carries messages for a single query, so after the first message the cached tracker
+  // serves every subsequent one without touching the query map.
+  if (state->query_tracker == nullptr || state->query_id != query_id) {
+    auto* shard = GetQueryShard(query_id);
+    absl::base_internal::SpinLockHolder lock(&shard->shard_lock);
+    auto it = shard->query_trackers.find(query_id);
+    if (it == shard->query_trackers.end()) {
       if (!req->has_initiate_conn()) {
         return ::grpc::Status(
             grpc::StatusCode::INVALID_ARGUMENT,
             "Attempting to TransferResultChunk for uninitiated or completed query.");
       }
-      id_to_query_tracker_map_[query_id] = std::make_shared<QueryTracker>();
+      it = shard->query_trackers.emplace(query_id, std::make_shared<QueryTracker>()).first;
     }
-    state->query_tracker = id_to_query_tracker_map_[query_id];
+    state->query_id = query_id;
+    state->query_tracker = it->second;
   }
 
   if (!state->registered_server_context) {
@@ -141,8 +220,26 @@ void GRPCRouter::MarkResultStreamContextAsComplete(QueryTracker* query_tracker,
   if (req->has_query_result() && req->query_result().has_row_batch()) {
     state->stream_has_query_results = true;
     state->source_node_id = req->query_result().grpc_source_id();
+    // Credit gate: each slot in the destination source's queue is a credit. When the source's
+    // exec thread falls behind we stop reading this stream here rather than buffering, so gRPC's
+    // transport flow control pushes back on the sending sink and memory stays bounded on both
+    // ends.
+    auto credits = GetSourceNodeCredits(state->query_tracker.get(), state->source_node_id);
+    if (credits != nullptr) {
+      while (!credits->WaitForCredit(absl::Seconds(1))) {
+        if (context->IsCancelled()) {
+          return ::grpc::Status(grpc::StatusCode::CANCELLED,
+                                "stream cancelled while waiting for batch credits");
+        }
+      }
+    }
     auto s = EnqueueRowBatch(state->query_tracker.get(), std::move(req));
     if (!s.ok()) {
+      if (error::IsCancelled(s)) {
+        // The source was stopped by a downstream limit. Close the stream with CANCELLED so the
+        // sending fragment stops producing, rather than treating this as an internal error.
+        return ::grpc::Status(grpc::StatusCode::CANCELLED, std::string(s.msg()));
+      }
       return ::grpc::Status(grpc::StatusCode::INTERNAL, "failed to enqueue batch");
     }
     return ::grpc::Status::OK;
@@ -155,13 +252,9 @@ void GRPCRouter::MarkResultStreamContextAsComplete(QueryTracker* query_tracker,
   return ::grpc::Status(grpc::StatusCode::INTERNAL, "unexpected TransferResultChunkRequest type");
 }
 std::vector<statuspb::Status> GRPCRouter::GetIncomingWorkerErrors(const sole::uuid& query_id) {
-  std::shared_ptr<QueryTracker> query_tracker;
-  {
-    absl::base_internal::SpinLockHolder lock(&id_to_query_tracker_map_lock_);
-    if (!id_to_query_tracker_map_.contains(query_id)) {
-      return {};
-    }
-    query_tracker = id_to_query_tracker_map_[query_id];
+  auto query_tracker = GetQueryTracker(query_id);
+  if (query_tracker == nullptr) {
+    return {};
   }
   absl::base_internal::SpinLockHolder lock(&query_tracker->query_lock);
   return query_tracker->upstream_exec_errors;
@@ -209,11 +302,13 @@ Status GRPCRouter::AddGRPCSourceNode(sole::uuid query_id, int64_t source_id,
   // We need to check and see if there is backlog data, if so flush it from the vector.
   std::shared_ptr<QueryTracker> query_tracker;
   {
-    absl::base_internal::SpinLockHolder lock(&id_to_query_tracker_map_lock_);
-    if (!id_to_query_tracker_map_.contains(query_id)) {
-      id_to_query_tracker_map_[query_id] = std::make_shared<QueryTracker>();
+    auto* shard = GetQueryShard(query_id);
+    absl::base_internal::SpinLockHolder lock(&shard->shard_lock);
+    auto it = shard->query_trackers.find(query_id);
+    if (it == shard->query_trackers.end()) {
+      it = shard->query_trackers.emplace(query_id, std::make_shared<QueryTracker>()).first;
     }
-    query_tracker = id_to_query_tracker_map_[query_id];
+    query_tracker = it->second;
   }
 
   {
@@ -242,14 +337,9 @@ Status GRPCRouter::AddGRPCSourceNode(sole::uuid query_id, int64_t source_id,
 
 StatusOr<std::vector<queryresultspb::AgentExecutionStats>> GRPCRouter::GetIncomingWorkerExecStats(
     const sole::uuid& query_id) {
-  std::shared_ptr<QueryTracker> query_tracker;
-  {
-    absl::base_internal::SpinLockHolder lock(&id_to_query_tracker_map_lock_);
-    auto it = id_to_query_tracker_map_.find(query_id);
-    if (it == id_to_query_tracker_map_.end()) {
-      return error::Internal("No query ID $0 found in the GRPCRouter", query_id.str());
-    }
-    query_tracker = it->second;
+  auto query_tracker = GetQueryTracker(query_id);
+  if (query_tracker == nullptr) {
+    return error::Internal("No query ID $0 found in the GRPCRouter", query_id.str());
   }
 
   {
@@ -259,14 +349,10 @@ StatusOr<std::vector<queryresultspb::AgentExecutionStats>> GRPCRouter::GetIncomi
 }
 
 Status GRPCRouter::DeleteGRPCSourceNode(sole::uuid query_id, int64_t source_id) {
-  std::shared_ptr<QueryTracker> query_tracker;
-  {
-    absl::base_internal::SpinLockHolder lock(&id_to_query_tracker_map_lock_);
-    if (!id_to_query_tracker_map_.contains(query_id)) {
-      return error::Internal("Query map does not contain query ID $0 when deleting GRPC source $1",
-                             query_id.str(), source_id);
-    }
-    query_tracker = id_to_query_tracker_map_[query_id];
+  auto query_tracker = GetQueryTracker(query_id);
+  if (query_tracker == nullptr) {
+    return error::Internal("Query map does not contain query ID $0 when deleting GRPC source $1",
+                           query_id.str(), source_id);
   }
 
   absl::base_internal::SpinLockHolder lock(&query_tracker->query_lock);
@@ -279,19 +365,31 @@ Status GRPCRouter::DeleteGRPCSourceNode(sole::uuid query_id, int64_t source_id)
   return Status::OK();
 }
 
+void GRPCRouter::StopSourceStreams(const sole::uuid& query_id, int64_t source_id) {
+  auto query_tracker = GetQueryTracker(query_id);
+  if (query_tracker == nullptr) {
+    // The source isn't fed by remote fragments (e.g. a local memory source); nothing to stop.
+    return;
+  }
+  auto snt = GetSourceNodeTracker(query_tracker.get(), source_id);
+  absl::base_internal::SpinLockHolder snt_lock(&snt->node_lock);
+  snt->source_stopped = true;
+}
+
 void GRPCRouter::DeleteQuery(sole::uuid query_id) {
   VLOG(1) << "Deleting query ID from GRPC Router: " << query_id.str();
   std::shared_ptr<QueryTracker> query_tracker;
   {
-    absl::base_internal::SpinLockHolder lock(&id_to_query_tracker_map_lock_);
-    auto it = id_to_query_tracker_map_.find(query_id);
-    if (it == id_to_query_tracker_map_.end()) {
+    auto* shard = GetQueryShard(query_id);
+    absl::base_internal::SpinLockHolder lock(&shard->shard_lock);
+    auto it = shard->query_trackers.find(query_id);
+    if (it == shard->query_trackers.end()) {
       VLOG(1) << "No such query when deleting: " << query_id.str()
               << "(this is expected if no grpc sources are present)";
       return;
     }
     query_tracker = it->second;
-    id_to_query_tracker_map_.erase(it);
+    shard->query_trackers.erase(it);
   }
   absl::base_internal::SpinLockHolder lock(&query_tracker->query_lock);
   query_tracker->ResetRestartExecutionFunc();
@@ -302,8 +400,12 @@ void GRPCRouter::DeleteQuery(sole::uuid query_id) {
 }
 
 size_t GRPCRouter::NumQueriesTracking() const {
-  absl::base_internal::SpinLockHolder lock(&id_to_query_tracker_map_lock_);
-  return id_to_query_tracker_map_.size();
+  size_t num_queries = 0;
+  for (auto& shard : query_shards_) {
+    absl::base_internal::SpinLockHolder lock(&shard.shard_lock);
+    num_queries += shard.query_trackers.size();
+  }
+  return num_queries;
 }
 
 }  // namespace exec
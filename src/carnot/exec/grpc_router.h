@@ -19,6 +19,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <array>
 #include <chrono>
 #include <memory>
 #include <string>
@@ -43,8 +44,9 @@ namespace px {
 namespace carnot {
 namespace exec {
 
-// Forward declaration needed to break circular dependency.
+// Forward declarations needed to break circular dependency.
 class GRPCSourceNode;
+class BatchCredits;
 
 /**
  * GRPCRouter tracks incoming Kelvin connections and routes them to the appropriate Carnot source
@@ -80,6 +82,34 @@ class GRPCRouter final : public carnotpb::ResultSinkService::Service {
    */
   Status DeleteGRPCSourceNode(sole::uuid query_id, int64_t source_id);
 
+  /**
+   * Returns true if the given source node is registered with this router and still wants
+   * results. Used by sinks running in the same process to decide (once, at stream start)
+   * whether result chunks can be handed over directly instead of through a loopback gRPC stream.
+   */
+  bool HasLocalSource(const sole::uuid& query_id, int64_t source_id) const;
+
+  /**
+   * Delivers a result chunk to a source node in this process, bypassing the gRPC stream.
+   * The request must carry a row batch destined for a GRPC source ID. Returns NotFound if the
+   * query is no longer tracked and Cancelled if the source stopped wanting results; either way
+   * the caller should wind the stream down.
+   */
+  Status DeliverLocalResultChunk(std::unique_ptr<carnotpb::TransferResultChunkRequest> req);
+
+  /**
+   * Closes a locally-delivered result stream, the in-process equivalent of the sink finishing
+   * its TransferResultChunk call. Must be called exactly once per local stream.
+   */
+  void CloseLocalResultStream(const sole::uuid& query_id, int64_t source_id);
+
+  /**
+   * Marks a source as no longer needing results (e.g. a downstream limit was satisfied).
+   * Incoming result streams for the source are closed with a CANCELLED status so that the
+   * upstream fragments producing those results stop instead of draining their scans.
+   */
+  void StopSourceStreams(const sole::uuid& query_id, int64_t source_id);
+
   /**
    * @brief Get any errors that may have occured in the incoming worker nodes.
    *
@@ -116,6 +146,9 @@ class GRPCRouter final : public carnotpb::ResultSinkService::Service {
     // respectively.
     bool connection_initiated_by_sink GUARDED_BY(node_lock) = false;
     bool connection_closed_by_sink GUARDED_BY(node_lock) = false;
+    // Set when a downstream limit stopped this source; further result chunks for it are
+    // rejected so the upstream fragments producing them wind down.
+    bool source_stopped GUARDED_BY(node_lock) = false;
     std::vector<std::unique_ptr<::px::carnotpb::TransferResultChunkRequest>> response_backlog
         GUARDED_BY(node_lock);
     absl::base_internal::SpinLock node_lock;
@@ -165,6 +198,9 @@ class GRPCRouter final : public carnotpb::ResultSinkService::Service {
     // stream_has_query_results informs downstream source nodes about the health of the stream.
     // When true, the particular TransferResultChunk call has initiated the query stream.
     bool stream_has_query_results = false;
+    // The tracker is cached across a stream's messages (keyed by query_id) so that steady-state
+    // ingestion doesn't touch the query map or its locks at all.
+    sole::uuid query_id;
     std::shared_ptr<QueryTracker> query_tracker = nullptr;
   };
   ::grpc::Status HandleTransferResultChunkMessage(
@@ -176,10 +212,25 @@ class GRPCRouter final : public carnotpb::ResultSinkService::Service {
   void MarkResultStreamContextAsComplete(QueryTracker* query_tracker,
                                          ::grpc::ServerContext* context);
   SourceNodeTracker* GetSourceNodeTracker(QueryTracker* query_tracker, int64_t source_id);
+  // Returns the batch credit pool of the given source node, or nullptr if the node isn't
+  // registered yet (batches go to the backlog), was stopped, or has no queue bound.
+  std::shared_ptr<BatchCredits> GetSourceNodeCredits(QueryTracker* query_tracker,
+                                                     int64_t source_id);
+
+  // The query tracker map is sharded by query ID so that concurrent inbound streams for
+  // different queries don't contend on a single lock. Per-query and per-source state already
+  // have their own finer-grained locks.
+  static constexpr size_t kNumQueryShards = 16;
+  struct QueryShard {
+    absl::node_hash_map<sole::uuid, std::shared_ptr<QueryTracker>> query_trackers
+        GUARDED_BY(shard_lock);
+    mutable absl::base_internal::SpinLock shard_lock;
+  };
+  QueryShard* GetQueryShard(const sole::uuid& query_id) const;
+  // Returns the tracker for the query, or nullptr if it isn't tracked.
+  std::shared_ptr<QueryTracker> GetQueryTracker(const sole::uuid& query_id) const;
 
-  absl::node_hash_map<sole::uuid, std::shared_ptr<QueryTracker>> id_to_query_tracker_map_
-      GUARDED_BY(id_to_query_tracker_map_lock_);
-  mutable absl::base_internal::SpinLock id_to_query_tracker_map_lock_;
+  mutable std::array<QueryShard, kNumQueryShards> query_shards_;
 };
 
 }  // namespace exec
@@ -147,6 +147,47 @@ TEST_F(GRPCRouterTest, no_node_router_test) {
   EXPECT_TRUE(source_node.upstream_closed_connection());
 }
 
+TEST_F(GRPCRouterTest, stop_source_streams_test) {
+  int64_t grpc_source_node_id = 1;
+  auto query_id = sole::uuid4();
+  RowDescriptor input_rd({types::DataType::INT64});
+
+  auto op_proto = planpb::testutils::CreateTestGRPCSource1PB();
+  std::unique_ptr<px::carnot::plan::Operator> plan_node =
+      plan::GRPCSourceOperator::FromProto(op_proto, grpc_source_node_id);
+  auto source_node = FakeGRPCSourceNode();
+  ASSERT_OK(source_node.Init(*plan_node, input_rd, {}));
+  ASSERT_OK(service_->AddGRPCSourceNode(query_id, grpc_source_node_id, &source_node, [] {}));
+
+  // A downstream limit was satisfied: the source no longer needs results.
+  service_->StopSourceStreams(query_id, grpc_source_node_id);
+
+  carnotpb::TransferResultChunkRequest initiate_stream_req;
+  ToProto(query_id, initiate_stream_req.mutable_query_id());
+  *initiate_stream_req.mutable_initiate_conn() =
+      carnotpb::TransferResultChunkRequest::InitiateConnection();
+
+  auto rb1 = RowBatchBuilder(input_rd, 2, /*eow*/ false, /*eos*/ false)
+                 .AddColumn<types::Int64Value>({1, 2})
+                 .get();
+  carnotpb::TransferResultChunkRequest rb_req1;
+  EXPECT_OK(rb1.ToProto(rb_req1.mutable_query_result()->mutable_row_batch()));
+  rb_req1.mutable_query_result()->set_grpc_source_id(grpc_source_node_id);
+  ToProto(query_id, rb_req1.mutable_query_id());
+
+  // The stream should be closed with CANCELLED so the sending fragment winds down, and the
+  // batch should never reach the source node.
+  carnotpb::TransferResultChunkResponse response;
+  grpc::ClientContext context;
+  auto writer = stub_->TransferResultChunk(&context, &response);
+  writer->Write(initiate_stream_req);
+  writer->Write(rb_req1);
+  writer->WritesDone();
+  auto writer_s = writer->Finish();
+  EXPECT_EQ(grpc::StatusCode::CANCELLED, writer_s.error_code());
+  EXPECT_EQ(0, source_node.row_batches.size());
+}
+
 TEST_F(GRPCRouterTest, basic_router_test) {
   int64_t grpc_source_node_id = 1;
   uint64_t ab = 0xea8aa095697f49f1, cd = 0xb127d50e5b6e2645;
@@ -788,6 +829,67 @@ TEST_F(GRPCRouterTest, continue_func_segfault) {
   server_->Shutdown();
 }
 
+TEST_F(GRPCRouterTest, local_delivery_test) {
+  int64_t grpc_source_node_id = 1;
+  auto query_id = sole::uuid4();
+  RowDescriptor input_rd({types::DataType::INT64});
+
+  // No query registered yet: a co-located sink must fall back to gRPC.
+  EXPECT_FALSE(service_->HasLocalSource(query_id, grpc_source_node_id));
+
+  auto op_proto = planpb::testutils::CreateTestGRPCSource1PB();
+  std::unique_ptr<px::carnot::plan::Operator> plan_node =
+      plan::GRPCSourceOperator::FromProto(op_proto, grpc_source_node_id);
+  auto source_node = FakeGRPCSourceNode();
+  ASSERT_OK(source_node.Init(*plan_node, input_rd, {}));
+
+  auto num_continues = 0;
+  ASSERT_OK(service_->AddGRPCSourceNode(query_id, grpc_source_node_id, &source_node,
+                                        [&] { num_continues++; }));
+
+  EXPECT_TRUE(service_->HasLocalSource(query_id, grpc_source_node_id));
+  // Checking for a source that never registered must not create tracker state for it.
+  EXPECT_FALSE(service_->HasLocalSource(query_id, /* source_id */ 2));
+
+  // Deliver a row batch directly, without a gRPC stream.
+  auto rb1 = RowBatchBuilder(input_rd, 2, /*eow*/ false, /*eos*/ false)
+                 .AddColumn<types::Int64Value>({1, 2})
+                 .get();
+  auto rb_req = std::make_unique<carnotpb::TransferResultChunkRequest>();
+  EXPECT_OK(rb1.ToProto(rb_req->mutable_query_result()->mutable_row_batch()));
+  rb_req->mutable_query_result()->set_grpc_source_id(grpc_source_node_id);
+  ToProto(query_id, rb_req->mutable_query_id());
+  ASSERT_OK(service_->DeliverLocalResultChunk(std::move(rb_req)));
+
+  EXPECT_TRUE(source_node.upstream_initiated_connection());
+  EXPECT_EQ(1, source_node.row_batches.size());
+  EXPECT_EQ(1,
+            source_node.row_batches.at(0)->query_result().row_batch().cols(0).int64_data().data(0));
+  EXPECT_EQ(1, num_continues);
+
+  service_->CloseLocalResultStream(query_id, grpc_source_node_id);
+  EXPECT_TRUE(source_node.upstream_closed_connection());
+
+  // A stopped source rejects local chunks with CANCELLED, same as the gRPC path.
+  service_->StopSourceStreams(query_id, grpc_source_node_id);
+  EXPECT_FALSE(service_->HasLocalSource(query_id, grpc_source_node_id));
+  auto rb_req2 = std::make_unique<carnotpb::TransferResultChunkRequest>();
+  EXPECT_OK(rb1.ToProto(rb_req2->mutable_query_result()->mutable_row_batch()));
+  rb_req2->mutable_query_result()->set_grpc_source_id(grpc_source_node_id);
+  ToProto(query_id, rb_req2->mutable_query_id());
+  auto deliver_s = service_->DeliverLocalResultChunk(std::move(rb_req2));
+  EXPECT_TRUE(error::IsCancelled(deliver_s));
+  EXPECT_EQ(1, source_node.row_batches.size());
+
+  // Once the query is gone, delivery reports NotFound so the sink winds down.
+  service_->DeleteQuery(query_id);
+  auto rb_req3 = std::make_unique<carnotpb::TransferResultChunkRequest>();
+  EXPECT_OK(rb1.ToProto(rb_req3->mutable_query_result()->mutable_row_batch()));
+  rb_req3->mutable_query_result()->set_grpc_source_id(grpc_source_node_id);
+  ToProto(query_id, rb_req3->mutable_query_id());
+  EXPECT_TRUE(error::IsNotFound(service_->DeliverLocalResultChunk(std::move(rb_req3))));
+}
+
 TEST_F(GRPCRouterTest, receive_execution_error) {
   int64_t grpc_source_node_id = 1;
   uint64_t ab = 0xea8aa095697f49f1, cd = 0xb127d50e5b6e2645;
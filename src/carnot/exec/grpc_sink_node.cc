@@ -18,6 +18,9 @@
 
 #include "src/carnot/exec/grpc_sink_node.h"
 
+#include <arrow/array.h>
+#include <arrow/memory_pool.h>
+
 #include <chrono>
 #include <memory>
 #include <string>
@@ -26,11 +29,44 @@
 #include <absl/strings/substitute.h>
 
 #include "src/carnot/carnotpb/carnot.pb.h"
+#include "src/carnot/exec/row_tuple.h"
 #include "src/carnot/planpb/plan.pb.h"
 #include "src/common/base/macros.h"
 #include "src/common/uuid/uuid_utils.h"
+#include "src/shared/types/arrow_adapter.h"
+#include "src/shared/types/type_utils.h"
 #include "src/table_store/table_store.h"
 
+DEFINE_bool(carnot_grpc_sink_async_writes,
+            gflags::BoolFromEnv("PL_CARNOT_GRPC_SINK_ASYNC_WRITES", false),
+            "If true, GRPC sinks serialize result batches into a bounded queue drained by a "
+            "per-sink writer thread, overlapping query compute with network sends instead of "
+            "blocking the execution thread on each write.");
+
+DEFINE_bool(carnot_grpc_sink_compress_results,
+            gflags::BoolFromEnv("PL_CARNOT_GRPC_SINK_COMPRESS_RESULTS", false),
+            "If true, GRPC sinks compress the result stream with gzip. Trades CPU on both ends "
+            "of the transfer for lower network bandwidth between agents and Kelvins.");
+
+DEFINE_bool(carnot_grpc_sink_spool_results,
+            gflags::BoolFromEnv("PL_CARNOT_GRPC_SINK_SPOOL_RESULTS", false),
+            "If true (and async writes are enabled), GRPC sinks overflow result batches to a "
+            "compressed temporary file when a slow client lets the in-memory write queue fill "
+            "up, and stream them as the client drains. Bounds result-path memory regardless of "
+            "result size.");
+
+DEFINE_int64(carnot_grpc_sink_max_spool_bytes,
+             gflags::Int64FromEnv("PL_CARNOT_GRPC_SINK_MAX_SPOOL_BYTES", 2LL * 1024 * 1024 * 1024),
+             "Maximum on-disk bytes of not-yet-sent result data per GRPC sink. When the spool "
+             "reaches this size, the execution thread blocks on the write queue as it would "
+             "without spooling.");
+
+DEFINE_int64(carnot_grpc_sink_progressive_flush_batches,
+             gflags::Int64FromEnv("PL_CARNOT_GRPC_SINK_PROGRESSIVE_FLUSH_BATCHES", 0),
+             "If positive, result-table sinks stamp an end-of-window marker on every Nth outgoing "
+             "batch that doesn't already carry one, so consumers can render coherent partial "
+             "results while a long query is still running. 0 disables progressive flushing.");
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -45,47 +81,99 @@ std::string GRPCSinkNode::DebugStringImpl() {
   } else if (plan_node_->has_grpc_source_id()) {
     destination = absl::Substitute("source_id: $0", plan_node_->grpc_source_id());
   }
+  if (is_shuffle_) {
+    destination =
+        absl::Substitute("$0, shuffle_destinations: $1", destination, shuffle_sinks_.size());
+  }
   return absl::Substitute("Exec::GRPCSinkNode: {address: $0, $1, output: $2}",
                           plan_node_->address(), destination, input_descriptor_->DebugString());
 }
 
-StatusOr<carnotpb::TransferResultChunkRequest> RequestWithMetadata(
-    plan::GRPCSinkOperator* plan_node, ExecState* exec_state) {
-  carnotpb::TransferResultChunkRequest req;
+Status SetRequestMetadata(plan::GRPCSinkOperator* plan_node, ExecState* exec_state,
+                          carnotpb::TransferResultChunkRequest* req) {
   // Set the metadata for the RowBatch (where it should go).
-  req.set_address(plan_node->address());
+  req->set_address(plan_node->address());
 
   if (plan_node->has_grpc_source_id()) {
-    req.mutable_query_result()->set_grpc_source_id(plan_node->grpc_source_id());
+    req->mutable_query_result()->set_grpc_source_id(plan_node->grpc_source_id());
   } else if (plan_node->has_table_name()) {
-    req.mutable_query_result()->set_table_name(plan_node->table_name());
+    req->mutable_query_result()->set_table_name(plan_node->table_name());
   } else {
     return error::Internal("GRPCSink has neither source ID nor table name set.");
   }
 
-  ToProto(exec_state->query_id(), req.mutable_query_id());
+  ToProto(exec_state->query_id(), req->mutable_query_id());
+  return Status::OK();
+}
+
+StatusOr<carnotpb::TransferResultChunkRequest> RequestWithMetadata(
+    plan::GRPCSinkOperator* plan_node, ExecState* exec_state) {
+  carnotpb::TransferResultChunkRequest req;
+  PX_RETURN_IF_ERROR(SetRequestMetadata(plan_node, exec_state, &req));
   return req;
 }
 
+GRPCSinkNode::~GRPCSinkNode() { PX_UNUSED(StopWriterThread()); }
+
+carnotpb::TransferResultChunkRequest* GRPCSinkNode::AcquireRequest() {
+  if (reusable_request_ == nullptr || request_arena_.SpaceAllocated() > kMaxRequestArenaBytes) {
+    request_arena_.Reset();
+    reusable_request_ =
+        google::protobuf::Arena::CreateMessage<carnotpb::TransferResultChunkRequest>(
+            &request_arena_);
+  } else {
+    reusable_request_->Clear();
+  }
+  return reusable_request_;
+}
+
+void GRPCSinkNode::UpdateLastSendTime() {
+  std::lock_guard<std::mutex> lock(write_queue_mu_);
+  last_send_time_ = std::chrono::system_clock::now();
+}
+
 Status GRPCSinkNode::OptionallyCheckConnection(ExecState* exec_state) {
+  if (is_shuffle_) {
+    for (auto& sink : shuffle_sinks_) {
+      PX_RETURN_IF_ERROR(sink->OptionallyCheckConnection(exec_state));
+    }
+    return Status::OK();
+  }
+
   if (sent_eos_ || cancelled_) {
     return Status::OK();
   }
 
   auto time_now = std::chrono::system_clock::now();
   auto since_last_flush =
-      std::chrono::duration_cast<std::chrono::milliseconds>(time_now - last_send_time_);
+      std::chrono::duration_cast<std::chrono::milliseconds>(time_now - LastSendTime());
   bool recheck_connection = since_last_flush > connection_check_timeout_;
   if (!recheck_connection) {
     return Status::OK();
   }
 
-  PX_ASSIGN_OR_RETURN(auto req, RequestWithMetadata(plan_node_.get(), exec_state));
   PX_ASSIGN_OR_RETURN(auto rb,
                       RowBatch::WithZeroRows(*input_descriptor_, /* eow */ false, /* eos */ false));
-  PX_RETURN_IF_ERROR(rb->ToProto(req.mutable_query_result()->mutable_row_batch()));
 
-  PX_RETURN_IF_ERROR(TryWriteRequest(exec_state, req));
+  if (writer_thread_.joinable()) {
+    // Async mode: hand the heartbeat to the writer thread. Skip it if writes are already queued,
+    // since those will refresh the connection anyway; never block the execution thread here.
+    PX_ASSIGN_OR_RETURN(auto req, RequestWithMetadata(plan_node_.get(), exec_state));
+    PX_RETURN_IF_ERROR(rb->ToProto(req.mutable_query_result()->mutable_row_batch()));
+    std::unique_lock<std::mutex> lock(write_queue_mu_);
+    PX_RETURN_IF_ERROR(async_write_status_);
+    if (write_queue_.empty() && (spool_ == nullptr || spool_->Empty())) {
+      write_queue_.push_back(std::move(req));
+      lock.unlock();
+      write_queue_cv_.notify_all();
+    }
+    return Status::OK();
+  }
+
+  auto* req = AcquireRequest();
+  PX_RETURN_IF_ERROR(SetRequestMetadata(plan_node_.get(), exec_state, req));
+  PX_RETURN_IF_ERROR(rb->ToProto(req->mutable_query_result()->mutable_row_batch()));
+  PX_RETURN_IF_ERROR(TryWriteRequest(exec_state, *req));
   return Status::OK();
 }
 
@@ -99,10 +187,53 @@ Status GRPCSinkNode::InitImpl(const plan::Operator& plan_node) {
   input_descriptor_ = std::make_unique<RowDescriptor>(input_descriptors_[0]);
   const auto* sink_plan_node = static_cast<const plan::GRPCSinkOperator*>(&plan_node);
   plan_node_ = std::make_unique<plan::GRPCSinkOperator>(*sink_plan_node);
+  if (plan_node_->has_hash_shuffle()) {
+    return InitShuffle(*plan_node_);
+  }
   return Status::OK();
 }
 
-Status GRPCSinkNode::PrepareImpl(ExecState*) { return Status::OK(); }
+Status GRPCSinkNode::InitShuffle(const plan::GRPCSinkOperator& plan_node) {
+  const auto& spec = plan_node.hash_shuffle();
+  if (spec.key_column_idxs_size() == 0) {
+    return error::InvalidArgument("GRPCSink hash shuffle must specify at least one key column.");
+  }
+  for (const auto& key_idx : spec.key_column_idxs()) {
+    if (key_idx < 0 || static_cast<size_t>(key_idx) >= input_descriptor_->size()) {
+      return error::InvalidArgument("GRPCSink hash shuffle key column index $0 is out of range.",
+                                    key_idx);
+    }
+    shuffle_key_idxs_.push_back(key_idx);
+    shuffle_key_types_.push_back(input_descriptor_->type(key_idx));
+  }
+
+  // One plain single-destination sub-sink per destination. The sub plan nodes carry the
+  // destination's address/source id and no shuffle spec, so the sub-sinks take the normal
+  // send path.
+  for (const auto& dest : spec.destinations()) {
+    planpb::GRPCSinkOperator sub_pb;
+    sub_pb.set_address(dest.address());
+    sub_pb.set_grpc_source_id(dest.grpc_source_id());
+    if (!dest.ssl_targetname().empty()) {
+      sub_pb.mutable_connection_options()->set_ssl_targetname(dest.ssl_targetname());
+    }
+    plan::GRPCSinkOperator sub_op(plan_node.id());
+    PX_RETURN_IF_ERROR(sub_op.Init(sub_pb));
+
+    auto sub_sink = std::make_unique<GRPCSinkNode>(max_batch_size_, batch_size_factor_);
+    PX_RETURN_IF_ERROR(sub_sink->Init(sub_op, *output_descriptor_, {*input_descriptor_}));
+    shuffle_sinks_.push_back(std::move(sub_sink));
+  }
+  is_shuffle_ = true;
+  return Status::OK();
+}
+
+Status GRPCSinkNode::PrepareImpl(ExecState* exec_state) {
+  for (auto& sink : shuffle_sinks_) {
+    PX_RETURN_IF_ERROR(sink->Prepare(exec_state));
+  }
+  return Status::OK();
+}
 
 Status GRPCSinkNode::StartConnection(ExecState* exec_state) {
   return StartConnectionWithRetries(exec_state, kGRPCRetries);
@@ -120,6 +251,9 @@ Status GRPCSinkNode::StartConnectionWithRetries(ExecState* exec_state, size_t n_
   stub_ = exec_state->ResultSinkServiceStub(plan_node_->address(), plan_node_->ssl_targetname());
 
   context_ = std::make_unique<grpc::ClientContext>();
+  if (FLAGS_carnot_grpc_sink_compress_results) {
+    context_->set_compression_algorithm(GRPC_COMPRESS_GZIP);
+  }
   // When we are sending the results to an external service, such as the query broker,
   // add authentication to the client context.
   if (plan_node_->has_table_name()) {
@@ -141,7 +275,7 @@ Status GRPCSinkNode::StartConnectionWithRetries(ExecState* exec_state, size_t n_
     return StartConnectionWithRetries(exec_state, n_retries - 1);
   }
 
-  last_send_time_ = std::chrono::system_clock::now();
+  UpdateLastSendTime();
   return Status::OK();
 }
 
@@ -155,8 +289,26 @@ Status GRPCSinkNode::CancelledByServer(ExecState* exec_state) {
 
 Status GRPCSinkNode::TryWriteRequest(ExecState* exec_state,
                                      const carnotpb::TransferResultChunkRequest& req) {
+  if (local_delivery_) {
+    auto s = exec_state->grpc_router()->DeliverLocalResultChunk(
+        std::make_unique<carnotpb::TransferResultChunkRequest>(req));
+    if (s.ok()) {
+      UpdateLastSendTime();
+      return Status::OK();
+    }
+    if (error::IsCancelled(s)) {
+      // The source was stopped by a downstream limit; mirror the remote hang-up path so the
+      // consume path stops the source feeding this sink.
+      cancelled_ = true;
+      downstream_closed_ = true;
+      return Status::OK();
+    }
+    // The query or source is gone; treat it like a server-side close.
+    return CancelledByServer(exec_state);
+  }
+
   if (writer_->Write(req)) {
-    last_send_time_ = std::chrono::system_clock::now();
+    UpdateLastSendTime();
     return Status::OK();
   }
 
@@ -164,10 +316,16 @@ Status GRPCSinkNode::TryWriteRequest(ExecState* exec_state,
   // connection just died.
   writer_->WritesDone();
   auto s = writer_->Finish();
-  // If the Finish call was successful, then the server closed the connection and sent a response,
-  // in which case we shouldn't try to reconnect. If there's an error from the server side
-  // other than a RST_STREAM, we also shouldn't retry.
-  if (s.ok() || s.error_code() != grpc::StatusCode::INTERNAL ||
+  // A clean close or a CANCELLED status means the server hung up on the stream deliberately,
+  // typically because a limit downstream already has all the rows it needs. Wind down without
+  // erroring; the consume path stops the source feeding this sink.
+  if (s.ok() || s.error_code() == grpc::StatusCode::CANCELLED) {
+    cancelled_ = true;
+    downstream_closed_ = true;
+    return Status::OK();
+  }
+  // If there's an error from the server side other than a RST_STREAM, we shouldn't retry.
+  if (s.error_code() != grpc::StatusCode::INTERNAL ||
       !absl::StrContains(s.error_message(), "RST_STREAM")) {
     return CancelledByServer(exec_state);
   }
@@ -179,13 +337,160 @@ Status GRPCSinkNode::TryWriteRequest(ExecState* exec_state,
   if (!writer_->Write(req)) {
     return CancelledByServer(exec_state);
   }
-  last_send_time_ = std::chrono::system_clock::now();
+  UpdateLastSendTime();
   return Status::OK();
 }
 
-Status GRPCSinkNode::OpenImpl(ExecState* exec_state) { return StartConnection(exec_state); }
+Status GRPCSinkNode::OpenImpl(ExecState* exec_state) {
+  if (is_shuffle_) {
+    for (auto& sink : shuffle_sinks_) {
+      PX_RETURN_IF_ERROR(sink->Open(exec_state));
+    }
+    return Status::OK();
+  }
+
+  // If the destination GRPC source is registered with this process's router, hand result chunks
+  // to it directly and skip the loopback gRPC stream (and its serialize/parse round trip). The
+  // decision is made once here; a source that registers later still gets its data via gRPC.
+  local_delivery_ = plan_node_->has_grpc_source_id() && exec_state->grpc_router() != nullptr &&
+                    exec_state->grpc_router()->HasLocalSource(exec_state->query_id(),
+                                                              plan_node_->grpc_source_id());
+  if (local_delivery_) {
+    // There is no remote peer to populate response_, and local delivery failures surface as
+    // Statuses, so report success up front.
+    response_.Clear();
+    response_.set_success(true);
+    // Open the stream with the same zero-row batch the gRPC path sends.
+    auto* req = AcquireRequest();
+    PX_RETURN_IF_ERROR(SetRequestMetadata(plan_node_.get(), exec_state, req));
+    PX_ASSIGN_OR_RETURN(
+        auto rb, RowBatch::WithZeroRows(*input_descriptor_, /* eow */ false, /* eos */ false));
+    PX_RETURN_IF_ERROR(rb->ToProto(req->mutable_query_result()->mutable_row_batch()));
+    return TryWriteRequest(exec_state, *req);
+  }
+
+  PX_RETURN_IF_ERROR(StartConnection(exec_state));
+  if (FLAGS_carnot_grpc_sink_async_writes) {
+    if (FLAGS_carnot_grpc_sink_spool_results) {
+      // The spool is only useful with a writer thread to drain it; on the synchronous path the
+      // execution thread blocks inside Write and nothing would ever empty the spool.
+      PX_ASSIGN_OR_RETURN(spool_, ResultSpool::Create());
+    }
+    // After this point the writer thread owns writer_ until StopWriterThread joins it; the
+    // execution thread only serializes batches into the queue.
+    writer_thread_ = std::thread(&GRPCSinkNode::WriterThreadLoop, this, exec_state);
+  }
+  return Status::OK();
+}
+
+void GRPCSinkNode::WriterThreadLoop(ExecState* exec_state) {
+  while (true) {
+    carnotpb::TransferResultChunkRequest req;
+    {
+      std::unique_lock<std::mutex> lock(write_queue_mu_);
+      write_queue_cv_.wait(lock, [this] {
+        return writer_stopped_ || !write_queue_.empty() ||
+               (spool_ != nullptr && !spool_->Empty());
+      });
+      if (!write_queue_.empty()) {
+        // Queued requests are always older than spooled ones, so drain the queue first.
+        req = std::move(write_queue_.front());
+        write_queue_.pop_front();
+      } else if (spool_ != nullptr && !spool_->Empty()) {
+        auto req_or_s = spool_->PopNext();
+        if (!req_or_s.ok()) {
+          async_write_status_ = req_or_s.status();
+          spool_->Clear();
+          lock.unlock();
+          write_queue_cv_.notify_all();
+          return;
+        }
+        req = req_or_s.ConsumeValueOrDie();
+      } else {
+        // Stopped with nothing left to drain.
+        return;
+      }
+    }
+    write_queue_cv_.notify_all();
+    auto s = TryWriteRequest(exec_state, req);
+    if (downstream_closed_) {
+      // The receiver hung up deliberately; drop whatever is still queued and exit.
+      {
+        std::lock_guard<std::mutex> lock(write_queue_mu_);
+        write_queue_.clear();
+        if (spool_ != nullptr) {
+          spool_->Clear();
+        }
+      }
+      write_queue_cv_.notify_all();
+      return;
+    }
+    if (!s.ok()) {
+      {
+        std::lock_guard<std::mutex> lock(write_queue_mu_);
+        async_write_status_ = s;
+        write_queue_.clear();
+        if (spool_ != nullptr) {
+          spool_->Clear();
+        }
+      }
+      write_queue_cv_.notify_all();
+      return;
+    }
+  }
+}
+
+Status GRPCSinkNode::EnqueueWriteRequest(carnotpb::TransferResultChunkRequest* req) {
+  {
+    std::unique_lock<std::mutex> lock(write_queue_mu_);
+    while (true) {
+      if (downstream_closed_) {
+        // The receiver hung up deliberately; the caller stops the source and drops the batch.
+        return Status::OK();
+      }
+      PX_RETURN_IF_ERROR(async_write_status_);
+      // Overflow to the spool instead of blocking when the queue is full. Once anything is
+      // spooled, subsequent requests must also spool until the writer thread drains it, or
+      // batches would be reordered on the stream.
+      const bool must_spool = spool_ != nullptr && (!spool_->Empty() ||
+                                                    write_queue_.size() >= kMaxQueuedSinkRequests);
+      if (must_spool && spool_->SpooledBytes() < FLAGS_carnot_grpc_sink_max_spool_bytes) {
+        PX_RETURN_IF_ERROR(spool_->Append(*req));
+        break;
+      }
+      if (!must_spool && write_queue_.size() < kMaxQueuedSinkRequests) {
+        write_queue_.push_back(std::move(*req));
+        break;
+      }
+      // No spool, or the spool is at its disk bound: block until the writer makes progress.
+      write_queue_cv_.wait(lock);
+    }
+  }
+  write_queue_cv_.notify_all();
+  return Status::OK();
+}
+
+Status GRPCSinkNode::StopWriterThread() {
+  if (!writer_thread_.joinable()) {
+    return Status::OK();
+  }
+  {
+    std::lock_guard<std::mutex> lock(write_queue_mu_);
+    writer_stopped_ = true;
+  }
+  write_queue_cv_.notify_all();
+  writer_thread_.join();
+  std::lock_guard<std::mutex> lock(write_queue_mu_);
+  return async_write_status_;
+}
 
 Status GRPCSinkNode::CloseWriter(ExecState* exec_state) {
+  if (local_delivery_) {
+    // The in-process equivalent of finishing the TransferResultChunk stream.
+    exec_state->grpc_router()->CloseLocalResultStream(exec_state->query_id(),
+                                                      plan_node_->grpc_source_id());
+    return Status::OK();
+  }
   if (writer_ == nullptr) {
     return Status::OK();
   }
@@ -200,11 +505,23 @@ Status GRPCSinkNode::CloseWriter(ExecState* exec_state) {
 }
 
 Status GRPCSinkNode::CloseImpl(ExecState* exec_state) {
+  if (is_shuffle_) {
+    for (auto& sink : shuffle_sinks_) {
+      PX_RETURN_IF_ERROR(sink->Close(exec_state));
+    }
+    return Status::OK();
+  }
+
+  auto async_status = StopWriterThread();
+
   if (sent_eos_ || cancelled_) {
     return Status::OK();
   }
 
-  if (writer_ != nullptr) {
+  // Surface an async write failure that never made it back to the execution thread.
+  PX_RETURN_IF_ERROR(async_status);
+
+  if (writer_ != nullptr || local_delivery_) {
     LOG(INFO) << absl::Substitute("Closing GRPCSinkNode $0 in query $1 before receiving EOS",
                                   plan_node_->id(), exec_state->query_id().str());
     PX_RETURN_IF_ERROR(CloseWriter(exec_state));
@@ -303,19 +620,134 @@ Status GRPCSinkNode::SplitAndSendBatch(ExecState* exec_state, const RowBatch& rb
 }
 
 Status GRPCSinkNode::ConsumeNextImpl(ExecState* exec_state, const RowBatch& rb, size_t parent_idx) {
+  if (is_shuffle_) {
+    // Each sub-sink splits its own partition by size if needed.
+    return ConsumeNextShuffle(exec_state, rb, parent_idx);
+  }
   if (rb.NumBytes() > (max_batch_size_ * batch_size_factor_)) {
     return SplitAndSendBatch(exec_state, rb, parent_idx);
   }
   return ConsumeNextImplNoSplit(exec_state, rb, parent_idx);
 }
 
+Status GRPCSinkNode::ConsumeNextShuffle(ExecState* exec_state, const RowBatch& rb,
+                                        size_t parent_idx) {
+  const size_t num_dests = shuffle_sinks_.size();
+
+  if (rb.num_rows() == 0) {
+    // Zero-row batches (stream keep-alives, eow/eos markers) go to every destination, so each
+    // stream observes the same window and stream boundaries.
+    for (auto& sink : shuffle_sinks_) {
+      PX_RETURN_IF_ERROR(sink->ConsumeNext(exec_state, rb, parent_idx));
+    }
+    return Status::OK();
+  }
+
+  // The destination of each row comes from a deterministic hash (XXH3, via RowTuple) of its key
+  // columns, so every sending Carnot instance routes the same group key to the same destination.
+  std::vector<size_t> row_dest(rb.num_rows());
+  std::vector<int64_t> dest_counts(num_dests, 0);
+  RowTuple rt(&shuffle_key_types_);
+  for (int64_t row_idx = 0; row_idx < rb.num_rows(); ++row_idx) {
+    rt.Reset();
+    for (const auto& [rt_idx, col_idx] : Enumerate(shuffle_key_idxs_)) {
+      auto* col = rb.ColumnAt(col_idx).get();
+#define TYPE_CASE(_dt_) ExtractIntoRowTuple<_dt_>(&rt, col, rt_idx, row_idx);
+      PX_SWITCH_FOREACH_DATATYPE(shuffle_key_types_[rt_idx], TYPE_CASE);
+#undef TYPE_CASE
+    }
+    const size_t dest = rt.Hash() % num_dests;
+    row_dest[row_idx] = dest;
+    ++dest_counts[dest];
+  }
+
+  const bool carries_boundary = rb.eow() || rb.eos();
+  for (size_t dest = 0; dest < num_dests; ++dest) {
+    if (dest_counts[dest] == 0 && !carries_boundary) {
+      continue;
+    }
+    // Gather this destination's rows into a batch carrying the input batch's flags.
+    std::vector<std::unique_ptr<arrow::ArrayBuilder>> builders(rb.num_columns());
+    for (int64_t col_idx = 0; col_idx < rb.num_columns(); ++col_idx) {
+      builders[col_idx] =
+          types::MakeArrowBuilder(input_descriptor_->type(col_idx), arrow::default_memory_pool());
+      PX_RETURN_IF_ERROR(builders[col_idx]->Reserve(dest_counts[dest]));
+    }
+    for (int64_t row_idx = 0; row_idx < rb.num_rows(); ++row_idx) {
+      if (row_dest[row_idx] != dest) {
+        continue;
+      }
+      for (int64_t col_idx = 0; col_idx < rb.num_columns(); ++col_idx) {
+        auto* col = rb.ColumnAt(col_idx).get();
+#define TYPE_CASE(_dt_)                                      \
+  PX_RETURN_IF_ERROR(table_store::schema::CopyValue<_dt_>(   \
+      builders[col_idx].get(), types::GetValueFromArrowArray<_dt_>(col, row_idx)));
+        PX_SWITCH_FOREACH_DATATYPE(input_descriptor_->type(col_idx), TYPE_CASE);
+#undef TYPE_CASE
+      }
+    }
+    PX_ASSIGN_OR_RETURN(auto out_rb, RowBatch::FromColumnBuilders(*input_descriptor_, rb.eow(),
+                                                                  rb.eos(), &builders));
+    PX_RETURN_IF_ERROR(shuffle_sinks_[dest]->ConsumeNext(exec_state, *out_rb, parent_idx));
+  }
+  return Status::OK();
+}
+
+bool GRPCSinkNode::MarkProgressiveWindow(const RowBatch& rb) {
+  if (FLAGS_carnot_grpc_sink_progressive_flush_batches <= 0 || !plan_node_->has_table_name()) {
+    return false;
+  }
+  if (rb.eow() || rb.eos()) {
+    // The batch already closes a window; restart the count from this natural boundary.
+    batches_since_progressive_flush_ = 0;
+    return false;
+  }
+  if (++batches_since_progressive_flush_ >= FLAGS_carnot_grpc_sink_progressive_flush_batches) {
+    batches_since_progressive_flush_ = 0;
+    return true;
+  }
+  return false;
+}
+
 Status GRPCSinkNode::ConsumeNextImplNoSplit(ExecState* exec_state, const RowBatch& rb, size_t) {
-  PX_ASSIGN_OR_RETURN(auto req, RequestWithMetadata(plan_node_.get(), exec_state));
-  // Serialize the RowBatch.
-  PX_RETURN_IF_ERROR(rb.ToProto(req.mutable_query_result()->mutable_row_batch()));
+  if (downstream_closed_) {
+    // The receiver already has all the rows it needs. Stop the source driving this sink and
+    // drop the batch.
+    exec_state->StopCurrentSource();
+    return Status::OK();
+  }
 
-  PX_RETURN_IF_ERROR(TryWriteRequest(exec_state, req));
+  if (writer_thread_.joinable()) {
+    // The queue stores requests by value so they can outlive this call, which rules out the
+    // reusable arena-backed message here.
+    PX_ASSIGN_OR_RETURN(auto req, RequestWithMetadata(plan_node_.get(), exec_state));
+    PX_RETURN_IF_ERROR(rb.ToProto(req.mutable_query_result()->mutable_row_batch()));
+    if (MarkProgressiveWindow(rb)) {
+      // Only the wire copy is stamped; the in-memory batch keeps its original window flags.
+      req.mutable_query_result()->mutable_row_batch()->set_eow(true);
+    }
+    PX_RETURN_IF_ERROR(EnqueueWriteRequest(&req));
+    if (rb.eos() && !downstream_closed_) {
+      // Flush the stream synchronously on eos so the final write status is reported in-line,
+      // matching the synchronous path.
+      PX_RETURN_IF_ERROR(StopWriterThread());
+    }
+  } else {
+    // Synchronous path: Write() serializes before returning, so the per-batch request is reused
+    // across batches instead of being rebuilt on the heap each time.
+    auto* req = AcquireRequest();
+    PX_RETURN_IF_ERROR(SetRequestMetadata(plan_node_.get(), exec_state, req));
+    PX_RETURN_IF_ERROR(rb.ToProto(req->mutable_query_result()->mutable_row_batch()));
+    if (MarkProgressiveWindow(rb)) {
+      req->mutable_query_result()->mutable_row_batch()->set_eow(true);
+    }
+    PX_RETURN_IF_ERROR(TryWriteRequest(exec_state, *req));
+  }
 
+  if (downstream_closed_) {
+    exec_state->StopCurrentSource();
+    return Status::OK();
+  }
   if (!rb.eos()) {
     return Status::OK();
   }
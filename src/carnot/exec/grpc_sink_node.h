@@ -19,22 +19,35 @@
 #pragma once
 
 #include <stddef.h>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/grpcpp.h>
 
 #include "src/carnot/carnotpb/carnot.pb.h"
 #include "src/carnot/exec/exec_node.h"
 #include "src/carnot/exec/exec_state.h"
+#include "src/carnot/exec/result_spool.h"
 #include "src/carnot/plan/operators.h"
 #include "src/common/base/base.h"
 #include "src/table_store/table_store.h"
 
 #include "src/carnot/carnotpb/carnot.grpc.pb.h"
 
+DECLARE_bool(carnot_grpc_sink_async_writes);
+DECLARE_bool(carnot_grpc_sink_compress_results);
+DECLARE_int64(carnot_grpc_sink_progressive_flush_batches);
+DECLARE_bool(carnot_grpc_sink_spool_results);
+DECLARE_int64(carnot_grpc_sink_max_spool_bytes);
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -51,12 +64,17 @@ constexpr float kBatchSizeFactor = 0.9f;
 // Number of times to retry connecting to grpc before giving up.
 constexpr size_t kGRPCRetries = 3;
 
+// Bound on the number of serialized requests queued for the async writer thread. Keeps
+// backpressure on the execution thread when the network can't keep up, while still letting
+// compute overlap with sends.
+constexpr size_t kMaxQueuedSinkRequests = 8;
+
 class GRPCSinkNode : public SinkNode {
  public:
   GRPCSinkNode(size_t max_batch_size, float batch_size_factor)
       : max_batch_size_(max_batch_size), batch_size_factor_(batch_size_factor) {}
   GRPCSinkNode() : GRPCSinkNode(kMaxBatchSize, kBatchSizeFactor) {}
-  virtual ~GRPCSinkNode() = default;
+  virtual ~GRPCSinkNode();
 
   // Used to check the downstream connection after connection_check_timeout_ has elapsed.
   Status OptionallyCheckConnection(ExecState* exec_state);
@@ -64,8 +82,8 @@ class GRPCSinkNode : public SinkNode {
   void testing_set_connection_check_timeout(const std::chrono::milliseconds& timeout) {
     connection_check_timeout_ = timeout;
   }
-  const std::chrono::time_point<std::chrono::system_clock>& testing_last_send_time() const {
-    return last_send_time_;
+  std::chrono::time_point<std::chrono::system_clock> testing_last_send_time() const {
+    return LastSendTime();
   }
 
  protected:
@@ -78,6 +96,13 @@ class GRPCSinkNode : public SinkNode {
                          size_t parent_index) override;
   Status ConsumeNextImplNoSplit(ExecState* exec_state, const table_store::schema::RowBatch& rb,
                                 size_t parent_index);
+  // Shuffle mode (hash_shuffle set in the plan node): rows are hash-partitioned by the key
+  // columns and forwarded to one sub-sink per destination. Each sub-sink is a plain
+  // single-destination GRPCSinkNode, so every destination stream keeps the existing
+  // retry / async-write / local-delivery behavior.
+  Status InitShuffle(const plan::GRPCSinkOperator& plan_node);
+  Status ConsumeNextShuffle(ExecState* exec_state, const table_store::schema::RowBatch& rb,
+                            size_t parent_index);
   Status SplitAndSendBatch(ExecState* exec_state, const table_store::schema::RowBatch& rb,
                            size_t parent_index);
   std::vector<int64_t> SplitBatchSizes(bool has_string_col,
@@ -85,13 +110,65 @@ class GRPCSinkNode : public SinkNode {
                                        int64_t other_col_row_size) const;
 
  private:
+  // Progressive mode (--carnot_grpc_sink_progressive_flush_batches): returns true when the
+  // outgoing copy of this result-table batch should be stamped with an end-of-window marker,
+  // giving consumers a coherent boundary to render partial results at before eos arrives.
+  bool MarkProgressiveWindow(const table_store::schema::RowBatch& rb);
+
   Status CloseWriter(ExecState* exec_state);
   Status StartConnection(ExecState* exec_state);
   Status StartConnectionWithRetries(ExecState* exec_state, size_t n_retries);
   Status CancelledByServer(ExecState* exec_state);
   Status TryWriteRequest(ExecState* exec_state, const carnotpb::TransferResultChunkRequest& req);
+  // last_send_time_ is written by the writer thread in async mode, so access goes through these
+  // locked helpers.
+  void UpdateLastSendTime();
+  std::chrono::time_point<std::chrono::system_clock> LastSendTime() const {
+    std::lock_guard<std::mutex> lock(write_queue_mu_);
+    return last_send_time_;
+  }
 
-  bool cancelled_ = false;
+  // Async write path (enabled by --carnot_grpc_sink_async_writes): the execution thread
+  // serializes requests into a bounded queue and a writer thread drains them, so compute overlaps
+  // with network sends. Write failures are recorded and surfaced on the next consume (or close),
+  // and the eos request is flushed synchronously so the final status is still reported in-line.
+  void WriterThreadLoop(ExecState* exec_state);
+  Status EnqueueWriteRequest(carnotpb::TransferResultChunkRequest* req);
+  // Signals the writer thread to exit after draining the queue, joins it, and returns the status
+  // of any failed async write. Idempotent.
+  Status StopWriterThread();
+
+  // Returns the arena-backed reusable request, cleared and ready to fill. Clearing retains the
+  // arena blocks and the message's repeated/string capacity, so the per-batch request on the
+  // synchronous write path stops allocating once the stream reaches a steady state. Only valid
+  // for requests written before the next Acquire; the reconnection path inside TryWriteRequest
+  // deliberately builds its own request so a retry can't clobber the one being written.
+  carnotpb::TransferResultChunkRequest* AcquireRequest();
+
+  std::thread writer_thread_;
+  mutable std::mutex write_queue_mu_;
+  std::condition_variable write_queue_cv_;
+  std::deque<carnotpb::TransferResultChunkRequest> write_queue_;
+  bool writer_stopped_ = false;
+  Status async_write_status_;
+  // Disk overflow for the async write path (--carnot_grpc_sink_spool_results): when the bounded
+  // queue is full, sealed result batches spill to a compressed temp file instead of stalling the
+  // execution thread, and the writer thread streams them as the client drains. Once entries are
+  // spooled, new batches keep going to the spool until it is drained, so batch order on the
+  // stream is preserved. Guarded by write_queue_mu_; the compression cost is only ever paid when
+  // the client is the bottleneck. When the spool reaches the configured size bound, enqueueing
+  // falls back to blocking, so both memory and disk stay bounded.
+  std::unique_ptr<ResultSpool> spool_;
+
+  std::atomic<bool> cancelled_ = false;
+  // Set at Open when the destination GRPC source runs in this same process: result chunks are
+  // handed to the GRPCRouter directly instead of going through a loopback gRPC stream. Fixed for
+  // the life of the stream so batches can't be reordered across transports.
+  bool local_delivery_ = false;
+  // Set when the server closed the result stream deliberately (clean close or CANCELLED),
+  // e.g. because a limit in a downstream fragment was satisfied. The sink then stops the
+  // source driving it and drops further batches instead of failing the query.
+  std::atomic<bool> downstream_closed_ = false;
 
   std::unique_ptr<grpc::ClientContext> context_;
   carnotpb::TransferResultChunkResponse response_;
@@ -102,9 +179,24 @@ class GRPCSinkNode : public SinkNode {
   std::unique_ptr<plan::GRPCSinkOperator> plan_node_;
   std::unique_ptr<table_store::schema::RowDescriptor> input_descriptor_;
 
+  // Shuffle state; empty unless the plan node carries a hash_shuffle spec.
+  bool is_shuffle_ = false;
+  std::vector<int64_t> shuffle_key_idxs_;
+  std::vector<types::DataType> shuffle_key_types_;
+  std::vector<std::unique_ptr<GRPCSinkNode>> shuffle_sinks_;
+
   std::chrono::milliseconds connection_check_timeout_ = kDefaultConnectionCheckTimeoutMS;
   std::chrono::time_point<std::chrono::system_clock> last_send_time_;
 
+  // Arena backing reusable_request_. Reset (with the message re-created) when it grows past
+  // kMaxRequestArenaBytes, so one oversized batch doesn't pin memory for the life of the stream.
+  static constexpr size_t kMaxRequestArenaBytes = 8 * 1024 * 1024;
+  google::protobuf::Arena request_arena_;
+  carnotpb::TransferResultChunkRequest* reusable_request_ = nullptr;
+
+  // Outgoing batches since the last window boundary, for progressive flushing.
+  int64_t batches_since_progressive_flush_ = 0;
+
   size_t max_batch_size_;
   float batch_size_factor_;
 };
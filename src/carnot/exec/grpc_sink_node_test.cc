@@ -217,6 +217,65 @@ TEST_F(GRPCSinkNodeTest, internal_result) {
   EXPECT_FALSE(add_metadata_called_);
 }
 
+// Same flow as internal_result, but with the async writer thread enabled. The eos batch flushes
+// the queue synchronously, so the saved protos can be checked as soon as ConsumeNext returns.
+TEST_F(GRPCSinkNodeTest, internal_result_async_writes) {
+  FLAGS_carnot_grpc_sink_async_writes = true;
+
+  auto op_proto = planpb::testutils::CreateTestGRPCSink1PB();
+  auto plan_node = std::make_unique<plan::GRPCSinkOperator>(1);
+  auto s = plan_node->Init(op_proto.grpc_sink_op());
+  RowDescriptor input_rd({types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64});
+
+  TransferResultChunkResponse resp;
+  resp.set_success(true);
+
+  std::vector<TransferResultChunkRequest> actual_protos(4);
+  std::vector<std::string> expected_protos = {
+      absl::Substitute(kExpected0RowResult, exec_state_->query_id().ab, exec_state_->query_id().cd),
+      absl::Substitute(kExpectedInteralResult0, exec_state_->query_id().ab,
+                       exec_state_->query_id().cd),
+      absl::Substitute(kExpectedInteralResult1, exec_state_->query_id().ab,
+                       exec_state_->query_id().cd),
+      absl::Substitute(kExpectedInteralResult2, exec_state_->query_id().ab,
+                       exec_state_->query_id().cd),
+  };
+
+  auto writer = new grpc::testing::MockClientWriter<TransferResultChunkRequest>();
+
+  EXPECT_CALL(*writer, Write(_, _))
+      .Times(4)
+      .WillOnce(DoAll(SaveArg<0>(&actual_protos[0]), Return(true)))
+      .WillOnce(DoAll(SaveArg<0>(&actual_protos[1]), Return(true)))
+      .WillOnce(DoAll(SaveArg<0>(&actual_protos[2]), Return(true)))
+      .WillOnce(DoAll(SaveArg<0>(&actual_protos[3]), Return(true)));
+
+  EXPECT_CALL(*writer, WritesDone());
+  EXPECT_CALL(*writer, Finish()).WillOnce(Return(grpc::Status::OK));
+  EXPECT_CALL(*mock_, TransferResultChunkRaw(_, _))
+      .WillOnce(DoAll(SetArgPointee<1>(resp), Return(writer)));
+
+  auto tester = exec::ExecNodeTester<GRPCSinkNode, plan::GRPCSinkOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  for (auto i = 0; i < 3; ++i) {
+    std::vector<types::Int64Value> data(i, i);
+    auto rb = RowBatchBuilder(output_rd, i, /*eow*/ i == 2, /*eos*/ i == 2)
+                  .AddColumn<types::Int64Value>(data)
+                  .get();
+    tester.ConsumeNext(rb, 5, 0);
+  }
+
+  tester.Close();
+
+  for (auto i = 0; i < 4; ++i) {
+    EXPECT_THAT(actual_protos[i], EqualsProto(expected_protos[i]));
+  }
+
+  FLAGS_carnot_grpc_sink_async_writes = false;
+}
+
 constexpr char kExpectedExternal0RowResult[] = R"proto(
 address: "localhost:1234"
 query_id {
@@ -350,6 +409,57 @@ TEST_F(GRPCSinkNodeTest, external_result) {
   EXPECT_TRUE(add_metadata_called_);
 }
 
+TEST_F(GRPCSinkNodeTest, progressive_flush_marks_windows) {
+  int64_t prev_flush_batches = FLAGS_carnot_grpc_sink_progressive_flush_batches;
+  FLAGS_carnot_grpc_sink_progressive_flush_batches = 2;
+
+  auto op_proto = planpb::testutils::CreateTestGRPCSink2PB();
+  auto plan_node = std::make_unique<plan::GRPCSinkOperator>(1);
+  auto s = plan_node->Init(op_proto.grpc_sink_op());
+  RowDescriptor input_rd({types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64});
+
+  TransferResultChunkResponse resp;
+  resp.set_success(true);
+
+  // 1 init request + 5 data batches + eos batch.
+  std::vector<TransferResultChunkRequest> actual_protos(7);
+  auto writer = new grpc::testing::MockClientWriter<TransferResultChunkRequest>();
+  {
+    ::testing::InSequence seq;
+    for (auto i = 0; i < 7; ++i) {
+      EXPECT_CALL(*writer, Write(_, _)).WillOnce(DoAll(SaveArg<0>(&actual_protos[i]), Return(true)));
+    }
+  }
+  EXPECT_CALL(*writer, WritesDone());
+  EXPECT_CALL(*writer, Finish()).WillOnce(Return(grpc::Status::OK));
+  EXPECT_CALL(*mock_, TransferResultChunkRaw(_, _))
+      .WillOnce(DoAll(SetArgPointee<1>(resp), Return(writer)));
+
+  auto tester = exec::ExecNodeTester<GRPCSinkNode, plan::GRPCSinkOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  for (auto i = 0; i < 6; ++i) {
+    std::vector<types::Int64Value> data(1, i);
+    auto rb = RowBatchBuilder(output_rd, 1, /*eow*/ i == 5, /*eos*/ i == 5)
+                  .AddColumn<types::Int64Value>(data)
+                  .get();
+    tester.ConsumeNext(rb, 5, 0);
+  }
+
+  tester.Close();
+
+  // Every 2nd plain batch is stamped with eow; the eos batch keeps its own flags.
+  std::vector<bool> expected_eow = {false, true, false, true, false, true};
+  for (auto i = 0; i < 6; ++i) {
+    const auto& rb_pb = actual_protos[i + 1].query_result().row_batch();
+    EXPECT_EQ(expected_eow[i], rb_pb.eow()) << "batch " << i;
+    EXPECT_EQ(i == 5, rb_pb.eos()) << "batch " << i;
+  }
+
+  FLAGS_carnot_grpc_sink_progressive_flush_batches = prev_flush_batches;
+}
+
 TEST_F(GRPCSinkNodeTest, check_connection) {
   auto op_proto = planpb::testutils::CreateTestGRPCSink2PB();
   auto plan_node = std::make_unique<plan::GRPCSinkOperator>(1);
@@ -722,6 +832,49 @@ TEST_F(GRPCSinkNodeTest, retry_failed_writes) {
   EXPECT_FALSE(add_metadata_called_);
 }
 
+// The server hanging up cleanly on the stream (e.g. a limit in a downstream fragment was
+// satisfied) should stop the source feeding the sink and drop further batches rather than
+// fail the query.
+TEST_F(GRPCSinkNodeTest, downstream_hangup_stops_source) {
+  auto op_proto = planpb::testutils::CreateTestGRPCSink1PB();
+  auto plan_node = std::make_unique<plan::GRPCSinkOperator>(1);
+  auto s = plan_node->Init(op_proto.grpc_sink_op());
+  RowDescriptor input_rd({types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64});
+
+  TransferResultChunkResponse resp;
+  resp.set_success(true);
+
+  auto writer = new grpc::testing::MockClientWriter<TransferResultChunkRequest>();
+  EXPECT_CALL(*writer, Write(_, _))
+      .Times(2)
+      .WillOnce(Return(true))    // Initiate result sink.
+      .WillOnce(Return(false));  // Server hung up before the first batch.
+  EXPECT_CALL(*writer, WritesDone()).WillOnce(Return(true));
+  EXPECT_CALL(*writer, Finish()).WillOnce(Return(grpc::Status::OK));
+  EXPECT_CALL(*mock_, TransferResultChunkRaw(_, _))
+      .WillOnce(DoAll(SetArgPointee<1>(resp), Return(writer)));
+
+  auto tester = exec::ExecNodeTester<GRPCSinkNode, plan::GRPCSinkOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  exec_state_->SetCurrentSource(7);
+  EXPECT_TRUE(exec_state_->keep_running());
+
+  std::vector<types::Int64Value> data(2, 1);
+  auto rb = RowBatchBuilder(output_rd, 2, /*eow*/ false, /*eos*/ false)
+                .AddColumn<types::Int64Value>(data)
+                .get();
+  tester.ConsumeNext(rb, 5, 0);
+
+  // The source driving this sink should now be stopped, and subsequent batches dropped without
+  // touching the dead stream.
+  EXPECT_FALSE(exec_state_->keep_running());
+  tester.ConsumeNext(rb, 5, 0);
+
+  tester.Close();
+}
+
 TEST_F(GRPCSinkNodeTest, check_connection_after_eos) {
   auto op_proto = planpb::testutils::CreateTestGRPCSink2PB();
   auto plan_node = std::make_unique<plan::GRPCSinkOperator>(1);
@@ -763,6 +916,82 @@ TEST_F(GRPCSinkNodeTest, check_connection_after_eos) {
   tester.Close();
 }
 
+TEST_F(GRPCSinkNodeTest, hash_shuffle_partitions_rows) {
+  auto op_proto = planpb::testutils::CreateTestGRPCSink1PB();
+  auto* shuffle = op_proto.mutable_grpc_sink_op()->mutable_hash_shuffle();
+  shuffle->add_key_column_idxs(0);
+  for (uint64_t i = 0; i < 2; ++i) {
+    auto* dest = shuffle->add_destinations();
+    dest->set_address("localhost:1234");
+    dest->set_grpc_source_id(i);
+  }
+  auto plan_node = std::make_unique<plan::GRPCSinkOperator>(1);
+  ASSERT_OK(plan_node->Init(op_proto.grpc_sink_op()));
+  RowDescriptor input_rd({types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64});
+
+  // Each destination sub-sink opens its own stream; capture the requests per destination.
+  TransferResultChunkResponse resp;
+  resp.set_success(true);
+  std::vector<std::vector<TransferResultChunkRequest>> actual_protos(2);
+  size_t stub_idx = 0;
+  auto exec_state = std::make_unique<ExecState>(
+      func_registry_.get(), std::make_shared<table_store::TableStore>(),
+      [&](const std::string&,
+          const std::string&) -> std::unique_ptr<ResultSinkService::StubInterface> {
+        CHECK_LT(stub_idx, actual_protos.size());
+        auto* requests = &actual_protos[stub_idx++];
+        auto mock = std::make_unique<MockResultSinkServiceStub>();
+        auto writer = new grpc::testing::MockClientWriter<TransferResultChunkRequest>();
+        EXPECT_CALL(*writer, Write(_, _))
+            .WillRepeatedly(
+                Invoke([requests](const TransferResultChunkRequest& req, grpc::WriteOptions) {
+                  requests->push_back(req);
+                  return true;
+                }));
+        EXPECT_CALL(*writer, WritesDone()).WillRepeatedly(Return(true));
+        EXPECT_CALL(*writer, Finish()).WillRepeatedly(Return(grpc::Status::OK));
+        EXPECT_CALL(*mock, TransferResultChunkRaw(_, _))
+            .WillOnce(DoAll(SetArgPointee<1>(resp), Return(writer)));
+        return mock;
+      },
+      MockMetricsStubGenerator, MockTraceStubGenerator, sole::uuid4(), nullptr, nullptr,
+      [](grpc::ClientContext*) {});
+
+  auto tester = exec::ExecNodeTester<GRPCSinkNode, plan::GRPCSinkOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state.get());
+
+  std::vector<types::Int64Value> data = {1, 2, 1, 2, 3, 3, 4, 4};
+  auto rb = RowBatchBuilder(output_rd, data.size(), /*eow*/ true, /*eos*/ true)
+                .AddColumn<types::Int64Value>(data)
+                .get();
+  tester.ConsumeNext(rb, 5, 0);
+  tester.Close();
+
+  // Every row lands on exactly one destination, the eos boundary reaches every destination, and
+  // rows with the same key always go to the same destination.
+  absl::flat_hash_map<int64_t, size_t> value_to_dest;
+  size_t total_rows = 0;
+  for (size_t dest = 0; dest < actual_protos.size(); ++dest) {
+    ASSERT_FALSE(actual_protos[dest].empty());
+    bool got_eos = false;
+    for (const auto& req : actual_protos[dest]) {
+      ASSERT_TRUE(req.has_query_result());
+      EXPECT_EQ(req.query_result().grpc_source_id(), dest);
+      got_eos = got_eos || req.query_result().row_batch().eos();
+      for (int64_t value : req.query_result().row_batch().cols(0).int64_data().data()) {
+        ++total_rows;
+        auto inserted = value_to_dest.try_emplace(value, dest);
+        EXPECT_EQ(inserted.first->second, dest)
+            << "key " << value << " was split across destinations";
+      }
+    }
+    EXPECT_TRUE(got_eos);
+  }
+  EXPECT_EQ(total_rows, data.size());
+  EXPECT_EQ(value_to_dest.size(), 4);
+}
+
 }  // namespace exec
 }  // namespace carnot
 }  // namespace px
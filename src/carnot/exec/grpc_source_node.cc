@@ -26,6 +26,12 @@
 
 #include "src/carnot/planpb/plan.pb.h"
 
+DEFINE_int64(carnot_grpc_source_node_queue_capacity,
+             gflags::Int64FromEnv("PL_CARNOT_GRPC_SOURCE_NODE_QUEUE_CAPACITY", 128),
+             "Maximum row batches a GRPC source node buffers before its inbound result streams "
+             "stop reading, letting gRPC flow control pace the sending sinks. 0 disables the "
+             "bound.");
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -41,6 +47,9 @@ Status GRPCSourceNode::InitImpl(const plan::Operator& plan_node) {
   CHECK(plan_node.op_type() == planpb::OperatorType::GRPC_SOURCE_OPERATOR);
   const auto* source_plan_node = static_cast<const plan::GRPCSourceOperator*>(&plan_node);
   plan_node_ = std::make_unique<plan::GRPCSourceOperator>(*source_plan_node);
+  if (FLAGS_carnot_grpc_source_node_queue_capacity > 0) {
+    batch_credits_ = std::make_shared<BatchCredits>(FLAGS_carnot_grpc_source_node_queue_capacity);
+  }
   return Status::OK();
 }
 Status GRPCSourceNode::PrepareImpl(ExecState*) { return Status::OK(); }
@@ -60,6 +69,9 @@ Status GRPCSourceNode::EnqueueRowBatch(
   if (!row_batch_queue_.enqueue(std::move(row_batch))) {
     return error::Internal("Failed to enqueue RowBatch");
   }
+  if (batch_credits_ != nullptr) {
+    batch_credits_->Consume();
+  }
   return Status::OK();
 }
 
@@ -72,6 +84,9 @@ Status GRPCSourceNode::PopRowBatch() {
         "Called GRPCSourceNode::OptionallyPopRowBatch but there was no available row batch in the "
         "queue.");
   }
+  if (batch_credits_ != nullptr) {
+    batch_credits_->Return();
+  }
   if (!rb_request->has_query_result() || !rb_request->query_result().has_row_batch()) {
     return error::Internal(
         "GRPCSourceNode::PopRowBatch expected TransferResultChunkRequest to have RowBatch "
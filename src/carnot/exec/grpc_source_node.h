@@ -23,6 +23,10 @@
 #include <string>
 #include <vector>
 
+#include <absl/base/thread_annotations.h>
+#include <absl/synchronization/mutex.h>
+#include <absl/time/time.h>
+
 #include "src/carnot/carnotpb/carnot.pb.h"
 #include "src/carnot/exec/exec_node.h"
 #include "src/carnot/exec/exec_state.h"
@@ -32,14 +36,73 @@
 
 #include "blockingconcurrentqueue.h"
 
+DECLARE_int64(carnot_grpc_source_node_queue_capacity);
+
 namespace px {
 namespace carnot {
 namespace exec {
 
+/**
+ * Batch credits shared between a GRPCSourceNode and the GRPCRouter's result stream readers.
+ *
+ * The TransferResultChunk protocol has no credit messages, so credits are granted implicitly:
+ * the node starts with one credit per queue slot, a reader consumes a credit per enqueued batch
+ * and stops reading its stream when none remain (letting gRPC's transport-level flow control
+ * pace the sending sink), and the node's exec thread returns a credit each time it drains a
+ * batch. Shared ownership lets a reader wait safely while the node is torn down; Close() wakes
+ * any waiters when that happens.
+ */
+class BatchCredits {
+ public:
+  explicit BatchCredits(int64_t initial_credits) : credits_(initial_credits) {}
+
+  void Consume() {
+    absl::MutexLock lock(&mu_);
+    --credits_;
+  }
+
+  void Return() {
+    absl::MutexLock lock(&mu_);
+    ++credits_;
+  }
+
+  // Wakes all waiters and makes further waits return immediately. Called when the owning source
+  // node goes away; enqueueing to a closed source fails on its own.
+  void Close() {
+    absl::MutexLock lock(&mu_);
+    closed_ = true;
+  }
+
+  int64_t credits() const {
+    absl::MutexLock lock(&mu_);
+    return credits_;
+  }
+
+  // Blocks until a credit is available or the credits are closed, returning false if the timeout
+  // expired first. Callers should check for stream cancellation between waits.
+  bool WaitForCredit(absl::Duration timeout) {
+    absl::MutexLock lock(&mu_);
+    return mu_.AwaitWithTimeout(absl::Condition(this, &BatchCredits::CreditAvailable), timeout);
+  }
+
+ private:
+  bool CreditAvailable() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return closed_ || credits_ > 0;
+  }
+
+  mutable absl::Mutex mu_;
+  int64_t credits_ ABSL_GUARDED_BY(mu_);
+  bool closed_ ABSL_GUARDED_BY(mu_) = false;
+};
+
 class GRPCSourceNode : public SourceNode {
  public:
   GRPCSourceNode() = default;
-  virtual ~GRPCSourceNode() = default;
+  virtual ~GRPCSourceNode() {
+    if (batch_credits_ != nullptr) {
+      batch_credits_->Close();
+    }
+  }
 
   bool NextBatchReady() override;
   virtual Status EnqueueRowBatch(std::unique_ptr<carnotpb::TransferResultChunkRequest> row_batch);
@@ -56,6 +119,10 @@ class GRPCSourceNode : public SourceNode {
   void set_upstream_closed_connection() { upstream_closed_connection_ = true; }
   bool upstream_closed_connection() const { return upstream_closed_connection_; }
 
+  // The credit pool bounding this node's row batch queue, or nullptr when the bound is disabled
+  // (--carnot_grpc_source_node_queue_capacity=0).
+  const std::shared_ptr<BatchCredits>& batch_credits() const { return batch_credits_; }
+
  protected:
   std::string DebugStringImpl() override;
   Status InitImpl(const plan::Operator& plan_node) override;
@@ -72,6 +139,7 @@ class GRPCSourceNode : public SourceNode {
       row_batch_queue_;
 
   std::unique_ptr<plan::GRPCSourceOperator> plan_node_;
+  std::shared_ptr<BatchCredits> batch_credits_;
   bool upstream_initiated_connection_ = false;
   bool upstream_closed_connection_ = false;
 };
@@ -87,6 +87,52 @@ TEST_F(GRPCSourceNodeTest, basic) {
   EXPECT_FALSE(tester.node()->HasBatchesRemaining());
 }
 
+TEST_F(GRPCSourceNodeTest, batch_credits) {
+  int64_t prev_capacity = FLAGS_carnot_grpc_source_node_queue_capacity;
+  FLAGS_carnot_grpc_source_node_queue_capacity = 2;
+
+  auto op_proto = planpb::testutils::CreateTestGRPCSource1PB();
+  std::unique_ptr<plan::Operator> plan_node = plan::GRPCSourceOperator::FromProto(op_proto, 1);
+  RowDescriptor output_rd({types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<GRPCSourceNode, plan::GRPCSourceOperator>(
+      *plan_node, output_rd, std::vector<RowDescriptor>({}), exec_state_.get());
+
+  auto credits = tester.node()->batch_credits();
+  ASSERT_NE(nullptr, credits);
+  EXPECT_EQ(2, credits->credits());
+
+  std::vector<RowBatch> rbs;
+  for (auto i = 0; i < 2; ++i) {
+    std::vector<types::Int64Value> data(3, i);
+    rbs.push_back(RowBatchBuilder(output_rd, 3, /*eow*/ i == 1, /*eos*/ i == 1)
+                      .AddColumn<types::Int64Value>(data)
+                      .get());
+    auto rb_wrapper = std::make_unique<carnotpb::TransferResultChunkRequest>();
+    EXPECT_OK(rbs[i].ToProto(rb_wrapper->mutable_query_result()->mutable_row_batch()));
+    EXPECT_OK(tester.node()->EnqueueRowBatch(std::move(rb_wrapper)));
+  }
+
+  // The queue is full, so a stream reader should stall until the exec thread drains a batch.
+  EXPECT_EQ(0, credits->credits());
+  EXPECT_FALSE(credits->WaitForCredit(absl::Milliseconds(1)));
+
+  tester.GenerateNextResult().ExpectRowBatch(rbs[0]);
+  EXPECT_EQ(1, credits->credits());
+  EXPECT_TRUE(credits->WaitForCredit(absl::Milliseconds(1)));
+
+  tester.GenerateNextResult().ExpectRowBatch(rbs[1]);
+  EXPECT_EQ(2, credits->credits());
+
+  // Closing the credits (as the node's destructor does) wakes waiters even with no credits left.
+  credits->Consume();
+  credits->Consume();
+  credits->Close();
+  EXPECT_TRUE(credits->WaitForCredit(absl::Milliseconds(1)));
+
+  FLAGS_carnot_grpc_source_node_queue_capacity = prev_capacity;
+}
+
 }  // namespace exec
 }  // namespace carnot
 }  // namespace px
@@ -75,6 +75,9 @@ Status MemorySinkNode::CloseImpl(ExecState*) { return Status::OK(); }
 Status MemorySinkNode::ConsumeNextImpl(ExecState*, const RowBatch& rb, size_t) {
   DCHECK_EQ(0U, children().size());
   if (rb.num_rows() > 0 || (rb.eow() || rb.eos())) {
+    // Each batch is visible to table store readers as soon as it's written, so memory sink
+    // results are inherently progressive; streaming consumers get window markers from the GRPC
+    // sink's progressive flush mode instead.
     PX_RETURN_IF_ERROR(table_->WriteRowBatch(rb));
   }
   return Status::OK();
@@ -19,8 +19,10 @@
 #include "src/carnot/exec/memory_source_node.h"
 #include "src/table_store/table/table.h"
 
+#include <algorithm>
 #include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <absl/strings/substitute.h>
@@ -28,6 +30,12 @@
 #include "src/carnot/planpb/plan.pb.h"
 #include "src/common/base/base.h"
 
+DEFINE_int32(carnot_memory_source_prefetch_batches,
+             gflags::Int32FromEnv("PL_CARNOT_MEMORY_SOURCE_PREFETCH_BATCHES", 2),
+             "Number of row batches a memory source reads ahead of the execution thread. Larger "
+             "values hide more table-store latency at the cost of memory pinned by in-flight "
+             "batches.");
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -35,6 +43,8 @@ namespace exec {
 using StartSpec = Table::Cursor::StartSpec;
 using StopSpec = Table::Cursor::StopSpec;
 
+MemorySourceNode::~MemorySourceNode() { StopPrefetch(); }
+
 std::string MemorySourceNode::DebugStringImpl() {
   return absl::Substitute("Exec::MemorySourceNode: <name: $0, output: $1>", plan_node_->TableName(),
                           output_descriptor_->DebugString());
@@ -56,19 +66,12 @@ Status MemorySourceNode::OpenImpl(ExecState* exec_state) {
   DCHECK(table_ != nullptr);
 
   streaming_ = plan_node_->streaming();
+  sample_every_n_ = plan_node_->sample_every_n();
 
   if (table_ == nullptr) {
     return error::NotFound("Table '$0' not found", plan_node_->TableName());
   }
 
-  StartSpec start_spec;
-  if (plan_node_->HasStartTime()) {
-    start_spec.type = StartSpec::StartType::StartAtTime;
-    start_spec.start_time = plan_node_->start_time();
-  } else {
-    start_spec.type = StartSpec::StartType::CurrentStartOfTable;
-  }
-
   StopSpec stop_spec;
   if (streaming_) {
     if (plan_node_->HasStopTime()) {
@@ -85,13 +88,65 @@ Status MemorySourceNode::OpenImpl(ExecState* exec_state) {
       stop_spec.type = StopSpec::StopType::CurrentEndOfTable;
     }
   }
+  // Standing queries resume from the cursor parked by the previous execution, so only rows
+  // added since then are scanned. The stop condition is still recomputed from the plan, since
+  // e.g. CurrentEndOfTable must reflect the table as of this execution.
+  standing_query_key_ = exec_state->standing_query_key();
+  if (!standing_query_key_.empty() && exec_state->standing_query_registry() != nullptr) {
+    cursor_ = exec_state->standing_query_registry()->TakeCursor(standing_query_key_,
+                                                                plan_node_->id(), table_);
+    if (cursor_ != nullptr) {
+      cursor_->UpdateStopSpec(stop_spec);
+      return Status::OK();
+    }
+  }
+
+  StartSpec start_spec;
+  if (plan_node_->HasStartTime()) {
+    start_spec.type = StartSpec::StartType::StartAtTime;
+    start_spec.start_time = plan_node_->start_time();
+  } else {
+    start_spec.type = StartSpec::StartType::CurrentStartOfTable;
+  }
   cursor_ = std::make_unique<Table::Cursor>(table_, start_spec, stop_spec);
 
+  // Warm the cold partition for the plan's time window while the rest of the execution graph
+  // finishes opening, so the scan's first reads hit already-decompressed batches. Streaming
+  // sources start at the live edge of the table, where there is no cold data to warm. (The
+  // standing-query path above resumes near the live edge too, so it skips warming.)
+  if (!streaming_) {
+    const int64_t start_time = plan_node_->HasStartTime() ? plan_node_->start_time()
+                                                          : std::numeric_limits<int64_t>::min();
+    const int64_t stop_time = plan_node_->HasStopTime() ? plan_node_->stop_time()
+                                                        : std::numeric_limits<int64_t>::max();
+    warmup_thread_ = std::thread([this, start_time, stop_time] {
+      cold_batches_prefetched_ = table_->PrefetchTimeRange(start_time, stop_time);
+    });
+  }
+
   return Status::OK();
 }
 
-Status MemorySourceNode::CloseImpl(ExecState*) {
+Status MemorySourceNode::CloseImpl(ExecState* exec_state) {
+  StopPrefetch();
+  if (!standing_query_key_.empty() && cursor_ != nullptr &&
+      exec_state->standing_query_registry() != nullptr) {
+    // The parked position includes any batches the prefetch thread read ahead; that is the
+    // consumed position in the normal case where the source is drained to its stop condition.
+    exec_state->standing_query_registry()->ParkCursor(standing_query_key_, plan_node_->id(),
+                                                      table_, std::move(cursor_));
+  }
   stats()->AddExtraInfo("streaming", streaming_ ? "true" : "false");
+  if (cold_batches_prefetched_ > 0) {
+    stats()->AddExtraInfo("cold_batches_prefetched",
+                          absl::Substitute("$0", cold_batches_prefetched_));
+  }
+  if (sample_every_n_ > 1) {
+    // Annotate sampled scans with the configured rate and what actually got skipped, so result
+    // consumers can tell an approximate preview from a full scan.
+    stats()->AddExtraInfo("sample_every_n", absl::Substitute("$0", sample_every_n_));
+    stats()->AddExtraInfo("batches_sampled_out", absl::Substitute("$0", batches_sampled_out_));
+  }
   return Status::OK();
 }
 
@@ -113,6 +168,16 @@ StatusOr<std::unique_ptr<RowBatch>> MemorySourceNode::GetNextRowBatch(ExecState*
   rows_processed_ += row_batch->num_rows();
   bytes_processed_ += row_batch->NumBytes();
 
+  if (sample_every_n_ > 1) {
+    // Sampling mode: after each batch read, the next N-1 batches are skipped using batch
+    // metadata only. For streaming sources the skip stops at the live edge of the table, so the
+    // effective rate near the edge is approximate, which is fine for a sampled preview.
+    for (int64_t i = 0; i < sample_every_n_ - 1 && cursor_->NextBatchReady(); ++i) {
+      PX_RETURN_IF_ERROR(cursor_->SkipNextRowBatch());
+      ++batches_sampled_out_;
+    }
+  }
+
   // If infinite stream is set, we don't send Eow or Eos. Infinite streams therefore never cause
   // HasBatchesRemaining to be false. Instead the outer loop that calls GenerateNext() is
   // responsible for managing whether we continue the stream or end it.
@@ -123,8 +188,71 @@ StatusOr<std::unique_ptr<RowBatch>> MemorySourceNode::GetNextRowBatch(ExecState*
   return row_batch;
 }
 
+void MemorySourceNode::PrefetchLoop() {
+  // Read the flag once: changing the depth mid-query would only confuse the backpressure wait.
+  const size_t max_prefetched_batches =
+      std::max<int32_t>(1, FLAGS_carnot_memory_source_prefetch_batches);
+  while (true) {
+    auto batch_or = GetNextRowBatch(/* exec_state */ nullptr);
+    // An error or the final (eos) batch ends the loop; the execution thread surfaces the error
+    // or sends the eos downstream.
+    bool terminal = !batch_or.ok() || batch_or.ValueOrDie()->eos();
+    {
+      std::unique_lock<std::mutex> lock(prefetch_mu_);
+      prefetch_cv_.wait(lock, [this, max_prefetched_batches] {
+        return prefetch_stopped_ || prefetched_batches_.size() < max_prefetched_batches;
+      });
+      if (prefetch_stopped_) {
+        return;
+      }
+      prefetched_batches_.push_back(std::move(batch_or));
+    }
+    prefetch_cv_.notify_all();
+    if (terminal) {
+      return;
+    }
+  }
+}
+
+StatusOr<std::unique_ptr<RowBatch>> MemorySourceNode::NextPrefetchedBatch() {
+  std::unique_lock<std::mutex> lock(prefetch_mu_);
+  prefetch_cv_.wait(lock, [this] { return !prefetched_batches_.empty(); });
+  auto batch_or = std::move(prefetched_batches_.front());
+  prefetched_batches_.pop_front();
+  lock.unlock();
+  prefetch_cv_.notify_all();
+  return batch_or;
+}
+
+void MemorySourceNode::StopPrefetch() {
+  {
+    std::lock_guard<std::mutex> lock(prefetch_mu_);
+    prefetch_stopped_ = true;
+  }
+  prefetch_cv_.notify_all();
+  if (prefetch_thread_.joinable()) {
+    prefetch_thread_.join();
+  }
+  if (warmup_thread_.joinable()) {
+    warmup_thread_.join();
+  }
+}
+
 Status MemorySourceNode::GenerateNextImpl(ExecState* exec_state) {
-  PX_ASSIGN_OR_RETURN(auto row_batch, GetNextRowBatch(exec_state));
+  // Streaming sources are polled via NextBatchReady on the execution thread, so they keep the
+  // synchronous read path. Finite sources hand the cursor to a prefetch thread, which overlaps
+  // table reads (and cold batch decompression) with downstream operator execution. The thread is
+  // started on the first generate call rather than in OpenImpl, so batch boundaries still reflect
+  // the table's layout (e.g. compactions) at execution time rather than at open time.
+  if (streaming_) {
+    PX_ASSIGN_OR_RETURN(auto row_batch, GetNextRowBatch(exec_state));
+    PX_RETURN_IF_ERROR(SendRowBatchToChildren(exec_state, *row_batch));
+    return Status::OK();
+  }
+  if (!prefetch_thread_.joinable()) {
+    prefetch_thread_ = std::thread(&MemorySourceNode::PrefetchLoop, this);
+  }
+  PX_ASSIGN_OR_RETURN(auto row_batch, NextPrefetchedBatch());
   PX_RETURN_IF_ERROR(SendRowBatchToChildren(exec_state, *row_batch));
   return Status::OK();
 }
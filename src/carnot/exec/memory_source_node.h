@@ -19,8 +19,12 @@
 #pragma once
 
 #include <stdint.h>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "src/carnot/exec/exec_node.h"
@@ -32,6 +36,8 @@
 #include "src/table_store/table/table.h"
 #include "src/table_store/table_store.h"
 
+DECLARE_int32(carnot_memory_source_prefetch_batches);
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -42,7 +48,7 @@ using table_store::schema::RowBatch;
 class MemorySourceNode : public SourceNode {
  public:
   MemorySourceNode() = default;
-  virtual ~MemorySourceNode() = default;
+  virtual ~MemorySourceNode();
 
   bool NextBatchReady() override;
 
@@ -57,11 +63,46 @@ class MemorySourceNode : public SourceNode {
  private:
   StatusOr<std::unique_ptr<RowBatch>> GetNextRowBatch(ExecState* exec_state);
   bool InfiniteStreamNextBatchReady();
+  // Body of the prefetch thread. Reads batches from the cursor into prefetched_batches_ until the
+  // cursor is exhausted, an error occurs, or the node is closed.
+  void PrefetchLoop();
+  // Blocks until the prefetch thread has produced a batch, then pops it.
+  StatusOr<std::unique_ptr<RowBatch>> NextPrefetchedBatch();
+  // Signals the prefetch thread to exit and joins it. Idempotent.
+  void StopPrefetch();
+
   // Whether this memory source will stream future results.
   bool streaming_ = false;
 
+  // When > 1, only every Nth row batch is read; the skipped batches are advanced past using
+  // batch metadata, so their data is never loaded or decompressed. Set from the plan node for
+  // approximate preview queries.
+  int64_t sample_every_n_ = 0;
+  int64_t batches_sampled_out_ = 0;
+
+  // Non-empty when this source belongs to a standing query; the cursor is then taken from and
+  // parked back into the standing query registry instead of being created and destroyed per
+  // execution.
+  std::string standing_query_key_;
+
+  // For non-streaming sources the cursor is read exclusively by the prefetch thread once the
+  // first generate call starts it. Streaming sources read it synchronously on the execution
+  // thread, since the execution graph polls NextBatchReady to decide when to yield.
   std::unique_ptr<Table::Cursor> cursor_;
 
+  // Warms the table's cold partition for the plan's time window, started in OpenImpl so the
+  // work overlaps with the rest of the execution graph opening. Joined by StopPrefetch.
+  std::thread warmup_thread_;
+  int64_t cold_batches_prefetched_ = 0;
+
+  std::thread prefetch_thread_;
+  std::mutex prefetch_mu_;
+  std::condition_variable prefetch_cv_;
+  // Bounded (by --carnot_memory_source_prefetch_batches) queue of batches read ahead by the
+  // prefetch thread.
+  std::deque<StatusOr<std::unique_ptr<RowBatch>>> prefetched_batches_;
+  bool prefetch_stopped_ = false;
+
   std::unique_ptr<plan::MemorySourceOperator> plan_node_;
   table_store::Table* table_ = nullptr;
 };
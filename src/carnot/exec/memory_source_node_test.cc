@@ -51,9 +51,10 @@ class MemorySourceNodeTest : public ::testing::Test {
   void SetUp() override {
     func_registry_ = std::make_unique<udf::Registry>("test_registry");
     auto table_store = std::make_shared<table_store::TableStore>();
-    exec_state_ = std::make_unique<ExecState>(func_registry_.get(), table_store,
-                                              MockResultSinkStubGenerator, MockMetricsStubGenerator,
-                                              MockTraceStubGenerator, sole::uuid4(), nullptr);
+    exec_state_ = std::make_unique<ExecState>(
+        func_registry_.get(), table_store, MockResultSinkStubGenerator, MockMetricsStubGenerator,
+        MockTraceStubGenerator, sole::uuid4(), nullptr, nullptr, [](grpc::ClientContext*) {},
+        nullptr, &standing_query_registry_);
 
     table_store::schema::Relation rel({types::DataType::BOOLEAN, types::DataType::TIME64NS},
                                       {"col1", "time_"});
@@ -80,6 +81,7 @@ class MemorySourceNodeTest : public ::testing::Test {
   }
 
   std::shared_ptr<Table> cpu_table_;
+  StandingQueryRegistry standing_query_registry_;
   std::unique_ptr<ExecState> exec_state_;
   std::unique_ptr<udf::Registry> func_registry_;
 };
@@ -107,6 +109,27 @@ TEST_F(MemorySourceNodeTest, basic) {
   EXPECT_EQ(sizeof(int64_t) * 5, tester.node()->BytesProcessed());
 }
 
+TEST_F(MemorySourceNodeTest, sampled) {
+  auto op_proto = planpb::testutils::CreateTestSampledSource1PB();
+  std::unique_ptr<plan::Operator> plan_node = plan::MemorySourceOperator::FromProto(op_proto, 1);
+  RowDescriptor output_rd({types::DataType::TIME64NS});
+
+  auto tester = exec::ExecNodeTester<MemorySourceNode, plan::MemorySourceOperator>(
+      *plan_node, output_rd, std::vector<RowDescriptor>({}), exec_state_.get());
+  EXPECT_TRUE(tester.node()->HasBatchesRemaining());
+  // With sample_every_n: 2, the first batch is read and the second is skipped, which exhausts
+  // the cursor, so the read batch carries eow/eos.
+  tester.GenerateNextResult().ExpectRowBatch(
+      RowBatchBuilder(output_rd, 3, /*eow*/ true, /*eos*/ true)
+          .AddColumn<types::Time64NSValue>({1, 2, 3})
+          .get());
+  EXPECT_FALSE(tester.node()->HasBatchesRemaining());
+  tester.Close();
+  // Only the read batch counts toward processed rows and bytes.
+  EXPECT_EQ(3, tester.node()->RowsProcessed());
+  EXPECT_EQ(sizeof(int64_t) * 3, tester.node()->BytesProcessed());
+}
+
 TEST_F(MemorySourceNodeTest, empty_table) {
   auto op_proto = planpb::testutils::CreateTestSource1PB("empty");
   std::unique_ptr<plan::Operator> plan_node = plan::MemorySourceOperator::FromProto(op_proto, 1);
@@ -225,6 +248,52 @@ TEST_F(MemorySourceNodeTest, all_range) {
   tester.Close();
 }
 
+TEST_F(MemorySourceNodeTest, standing_query_resumes_cursor) {
+  exec_state_->set_standing_query_key("live_view");
+
+  auto op_proto = planpb::testutils::CreateTestSource1PB();
+  RowDescriptor output_rd({types::DataType::TIME64NS});
+
+  {
+    std::unique_ptr<plan::Operator> plan_node = plan::MemorySourceOperator::FromProto(op_proto, 1);
+    auto tester = exec::ExecNodeTester<MemorySourceNode, plan::MemorySourceOperator>(
+        *plan_node, output_rd, std::vector<RowDescriptor>({}), exec_state_.get());
+    tester.GenerateNextResult().ExpectRowBatch(
+        RowBatchBuilder(output_rd, 3, /*eow*/ false, /*eos*/ false)
+            .AddColumn<types::Time64NSValue>({1, 2, 3})
+            .get());
+    tester.GenerateNextResult().ExpectRowBatch(
+        RowBatchBuilder(output_rd, 2, /*eow*/ true, /*eos*/ true)
+            .AddColumn<types::Time64NSValue>({5, 6})
+            .get());
+    tester.Close();
+  }
+  EXPECT_EQ(1U, standing_query_registry_.NumStandingQueries());
+
+  // Rows written between the two executions of the standing query.
+  auto rb3 = RowBatch(RowDescriptor(cpu_table_->GetRelation().col_types()), 2);
+  std::vector<types::BoolValue> col1_in3 = {true, false};
+  std::vector<types::Time64NSValue> col2_in3 = {8, 9};
+  EXPECT_OK(rb3.AddColumn(types::ToArrow(col1_in3, arrow::default_memory_pool())));
+  EXPECT_OK(rb3.AddColumn(types::ToArrow(col2_in3, arrow::default_memory_pool())));
+  EXPECT_OK(cpu_table_->WriteRowBatch(rb3));
+
+  {
+    // Same plan node id as the previous execution, so the parked cursor is resumed and only
+    // the newly written rows are read.
+    std::unique_ptr<plan::Operator> plan_node = plan::MemorySourceOperator::FromProto(op_proto, 1);
+    auto tester = exec::ExecNodeTester<MemorySourceNode, plan::MemorySourceOperator>(
+        *plan_node, output_rd, std::vector<RowDescriptor>({}), exec_state_.get());
+    tester.GenerateNextResult().ExpectRowBatch(
+        RowBatchBuilder(output_rd, 2, /*eow*/ true, /*eos*/ true)
+            .AddColumn<types::Time64NSValue>({8, 9})
+            .get());
+    EXPECT_FALSE(tester.node()->HasBatchesRemaining());
+    tester.Close();
+  }
+  EXPECT_EQ(1U, standing_query_registry_.NumStandingQueries());
+}
+
 class MemorySourceNodeTabletTest : public ::testing::Test {
  protected:
   void SetUp() override {
@@ -582,6 +651,42 @@ INSTANTIATE_TEST_SUITE_P(
             5,
             false,
         },
+        {
+            // More batches than the default readahead depth, so the prefetch thread fills the queue and
+            // blocks until the consumer drains it.
+            "full_table_many_batches",
+            {
+                {1, 2},
+                {3, 4},
+                {5, 6},
+                {7, 8},
+            },
+            std::nullopt,
+            std::nullopt,
+            false,
+            {
+                {
+                    ActionType::ExpectBatch,
+                    {1, 2},
+                },
+                {
+                    ActionType::ExpectBatch,
+                    {3, 4},
+                },
+                {
+                    ActionType::ExpectBatch,
+                    {5, 6},
+                },
+                {
+                    ActionType::ExpectBatch,
+                    {7, 8},
+                    true,
+                    true,
+                },
+            },
+            8,
+            false,
+        },
         {
             "start_time_basic",
             {
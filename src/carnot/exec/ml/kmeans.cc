@@ -17,6 +17,7 @@
  */
 
 #include "src/carnot/exec/ml/kmeans.h"
+#include <algorithm>
 #include <random>
 
 #include "src/carnot/exec/ml/sampling.h"
@@ -48,16 +49,94 @@ void KMeans::Fit(std::shared_ptr<WeightedPointSet> set) {
   }
 }
 
+void KMeans::MiniBatchFit(std::shared_ptr<WeightedPointSet> set, int batch_size) {
+  if (set->size() < 2) {
+    LOG(ERROR) << "Fitting KMeans on less than 2 points is currently unsupported.";
+    return;
+  }
+  auto points = set->points();
+  auto weights = set->weights();
+  batch_size = std::min<int>(batch_size, points.rows());
+
+  centroids_.resize(k_, points.cols());
+  switch (init_type_) {
+    case KMeans::kKMeansPlusPlus:
+      KMeansPlusPlusInit(points, weights);
+  }
+
+  std::uniform_int_distribution<int> point_dist(0, points.rows() - 1);
+  Eigen::MatrixXf batch(batch_size, points.cols());
+  Eigen::VectorXf batch_weights(batch_size);
+  Eigen::ArrayXf per_centroid_weight = Eigen::ArrayXf::Zero(k_);
+  for (int iter = 0; iter < max_iters_; iter++) {
+    for (int b = 0; b < batch_size; b++) {
+      auto ind = point_dist(random_gen_);
+      batch.row(b) = points.row(ind);
+      batch_weights(b) = weights(ind);
+    }
+    AssignClosestCentroids(batch, &assignments_);
+    for (int b = 0; b < batch_size; b++) {
+      auto closest_centroid = assignments_(b);
+      per_centroid_weight(closest_centroid) += batch_weights(b);
+      // Decaying per-centroid learning rate: each centroid converges to the weighted mean of the
+      // points assigned to it across batches.
+      float eta = batch_weights(b) / per_centroid_weight(closest_centroid);
+      centroids_.row(closest_centroid) =
+          (1.0f - eta) * centroids_.row(closest_centroid) + eta * batch.row(b);
+    }
+  }
+}
+
+void KMeans::AssignClosestCentroids(const Eigen::MatrixXf& points, Eigen::VectorXi* assignments) {
+  centroid_sq_norms_ = centroids_.rowwise().squaredNorm();
+  if (dist_block_.rows() < kDistanceBlockRows || dist_block_.cols() < centroids_.rows()) {
+    dist_block_.resize(kDistanceBlockRows, centroids_.rows());
+  }
+  assignments->resize(points.rows());
+  for (int start = 0; start < points.rows(); start += kDistanceBlockRows) {
+    int rows = std::min<int>(kDistanceBlockRows, points.rows() - start);
+    auto block = points.middleRows(start, rows);
+    auto dists = dist_block_.topLeftCorner(rows, centroids_.rows());
+    // ||p||^2 is constant per row, so the argmin only needs -2*p.c + ||c||^2.
+    dists.noalias() = -2.0f * (block * centroids_.transpose());
+    dists.rowwise() += centroid_sq_norms_.transpose();
+    for (int r = 0; r < rows; r++) {
+      Eigen::VectorXf::Index closest_centroid;
+      dists.row(r).minCoeff(&closest_centroid);
+      (*assignments)(start + r) = closest_centroid;
+    }
+  }
+}
+
+void KMeans::MinSquaredDistances(const Eigen::MatrixXf& points, int num_centroids,
+                                 Eigen::VectorXf* out) {
+  auto active = centroids_.topRows(num_centroids);
+  centroid_sq_norms_ = active.rowwise().squaredNorm();
+  if (dist_block_.rows() < kDistanceBlockRows || dist_block_.cols() < num_centroids) {
+    dist_block_.resize(kDistanceBlockRows, std::max<int>(num_centroids, k_));
+  }
+  out->resize(points.rows());
+  for (int start = 0; start < points.rows(); start += kDistanceBlockRows) {
+    int rows = std::min<int>(kDistanceBlockRows, points.rows() - start);
+    auto block = points.middleRows(start, rows);
+    auto dists = dist_block_.topLeftCorner(rows, num_centroids);
+    dists.noalias() = -2.0f * (block * active.transpose());
+    dists.rowwise() += centroid_sq_norms_.transpose();
+    for (int r = 0; r < rows; r++) {
+      // The norm expansion can dip slightly negative from cancellation; clamp since the results
+      // are used as sampling weights.
+      (*out)(start + r) = std::max(0.0f, dists.row(r).minCoeff() + block.row(r).squaredNorm());
+    }
+  }
+}
+
 bool KMeans::LloydsIteration(const Eigen::MatrixXf& points, const Eigen::VectorXf& weights) {
   Eigen::MatrixXf new_centroids = Eigen::MatrixXf::Zero(centroids_.rows(), centroids_.cols());
   Eigen::ArrayXf centroid_weights = Eigen::ArrayXf::Zero(centroids_.rows());
 
+  AssignClosestCentroids(points, &assignments_);
   for (int i = 0; i < points.rows(); i++) {
-    Eigen::VectorXf::Index closest_centroid;
-    (centroids_.rowwise() - points(i, Eigen::indexing::all))
-        .rowwise()
-        .squaredNorm()
-        .minCoeff(&closest_centroid);
+    auto closest_centroid = assignments_(i);
     new_centroids(closest_centroid, Eigen::indexing::all) +=
         weights(i) * points(i, Eigen::indexing::all);
     centroid_weights(closest_centroid) += weights(i);
@@ -85,15 +164,8 @@ void KMeans::KMeansPlusPlusInit(const Eigen::MatrixXf& points, const Eigen::Vect
 
   Eigen::VectorXf probDist(points.rows());
   for (auto i = 1; i < k_; i++) {
-    for (auto j = 0; j < probDist.rows(); j++) {
-      auto point = points(j, Eigen::indexing::all);
-      Eigen::VectorXf::Index closestCentroid;
-      auto dist = (centroids_(Eigen::seq(0, i - 1), Eigen::indexing::all).rowwise() - point)
-                      .rowwise()
-                      .squaredNorm()
-                      .minCoeff(&closestCentroid);
-      probDist(j) = weights(j) * dist;
-    }
+    MinSquaredDistances(points, i, &probDist);
+    probDist.array() *= weights.array();
     std::discrete_distribution<> pointDist(probDist.begin(), probDist.end());
     auto ind = pointDist(random_gen_);
     centroids_(i, Eigen::indexing::all) = points(ind, Eigen::indexing::all);
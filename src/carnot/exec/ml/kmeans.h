@@ -46,6 +46,14 @@ class KMeans {
    **/
   void Fit(std::shared_ptr<WeightedPointSet> set);
 
+  /**
+   * Mini-batch variant of Fit (Sculley, WWW 2010): each of max_iters iterations samples
+   * batch_size points and moves the assigned centroids toward them with a per-centroid decaying
+   * learning rate. Each iteration touches batch_size points instead of the whole set, so large
+   * windows cost a fraction of a full Lloyd's pass per iteration at a small accuracy cost.
+   **/
+  void MiniBatchFit(std::shared_ptr<WeightedPointSet> set, int batch_size);
+
   /**
    * Transform returns the index of the centroid closest to point.
    **/
@@ -57,14 +65,32 @@ class KMeans {
   void FromJSON(std::string data);
 
  private:
+  // Number of point rows per block in the batched distance kernels. Keeps the distance workspace
+  // (block x k) and the point block within cache while being large enough for Eigen to use
+  // vectorized GEMM paths.
+  static constexpr int kDistanceBlockRows = 256;
+
   bool LloydsIteration(const Eigen::MatrixXf& points, const Eigen::VectorXf& weights);
   void KMeansPlusPlusInit(const Eigen::MatrixXf& points, const Eigen::VectorXf& weights);
 
+  // Batched point-to-centroid distance kernels. Both expand ||p - c||^2 as
+  // ||p||^2 - 2*p.c + ||c||^2 so a block of points resolves against all centroids with one
+  // matrix product instead of a per-row broadcast, reusing the preallocated dist_block_
+  // workspace across blocks and iterations.
+  void AssignClosestCentroids(const Eigen::MatrixXf& points, Eigen::VectorXi* assignments);
+  void MinSquaredDistances(const Eigen::MatrixXf& points, int num_centroids, Eigen::VectorXf* out);
+
   int k_;
   int max_iters_;
   KMeansInitType init_type_;
   Eigen::MatrixXf centroids_;
   std::mt19937 random_gen_;
+
+  // Workspaces for the batched distance kernels, allocated once and reused across blocks and
+  // iterations.
+  Eigen::MatrixXf dist_block_;
+  Eigen::VectorXf centroid_sq_norms_;
+  Eigen::VectorXi assignments_;
 };
 
 }  // namespace ml
@@ -97,6 +97,34 @@ TEST(KMeans, trimodal_normal_dist) {
   }
 }
 
+TEST(KMeans, mini_batch_trimodal_normal_dist) {
+  int k = 3;
+
+  Eigen::MatrixXf points = kmeans_test_data();
+  Eigen::VectorXf weights = Eigen::VectorXf::Ones(60);
+
+  auto set = std::make_shared<WeightedPointSet>(points, weights);
+
+  KMeans kmeans(k, /* max_iters */ 50);
+  kmeans.MiniBatchFit(set, /* batch_size */ 32);
+
+  // Mini-batch is stochastic, so allow a looser tolerance than the full Lloyd's test.
+  ASSERT_THAT(kmeans.centroids(), UnorderedRowsAre(kmeans_expected_centroids(), 0.2));
+
+  // Each cluster's points should map to one distinct centroid.
+  std::set<size_t> taken_inds;
+  for (int i = 0; i < 3; i++) {
+    std::vector<size_t> cluster_inds;
+    for (int j = 0; j < 20; j++) {
+      cluster_inds.push_back(
+          kmeans.Transform(points(20 * i + j, Eigen::indexing::all).transpose()));
+    }
+    EXPECT_EQ(taken_inds.find(cluster_inds[0]), taken_inds.end());
+    EXPECT_THAT(cluster_inds, ::testing::Each(cluster_inds[0]));
+    taken_inds.insert(cluster_inds[0]);
+  }
+}
+
 }  // namespace ml
 }  // namespace exec
 }  // namespace carnot
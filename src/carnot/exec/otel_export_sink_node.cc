@@ -28,6 +28,7 @@
 #include <utility>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/strings/substitute.h>
 
 #include "glog/logging.h"
@@ -38,6 +39,18 @@
 #include "src/shared/types/typespb/types.pb.h"
 #include "src/table_store/table_store.h"
 
+DEFINE_bool(carnot_otel_export_async,
+            gflags::BoolFromEnv("PL_CARNOT_OTEL_EXPORT_ASYNC", false),
+            "If true, OTel export sinks convert batches on the execution thread but issue the "
+            "Export RPCs from a per-sink export thread, so collector latency no longer "
+            "backpressures query execution.");
+
+DEFINE_int32(carnot_otel_export_coalesce_bytes,
+             gflags::Int32FromEnv("PL_CARNOT_OTEL_EXPORT_COALESCE_BYTES", 1024 * 1024),
+             "Upper bound on the serialized size of a coalesced OTel export request. The export "
+             "thread merges queued requests of the same kind up to this size before each "
+             "Export RPC.");
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -50,6 +63,38 @@ const int64_t kOTelTraceIDLength = 16;
 
 const int64_t kB3ShortTraceIDLength = 8;
 
+OTelExportSinkNode::~OTelExportSinkNode() { PX_UNUSED(StopExportThread()); }
+
+opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest*
+OTelExportSinkNode::AcquireMetricsRequest() {
+  if (reusable_metrics_request_ == nullptr ||
+      request_arena_.SpaceAllocated() > kMaxRequestArenaBytes) {
+    request_arena_.Reset();
+    // The reset frees both reusable messages; they are re-created on their next acquire.
+    reusable_trace_request_ = nullptr;
+    reusable_metrics_request_ = google::protobuf::Arena::CreateMessage<
+        opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest>(
+        &request_arena_);
+  } else {
+    reusable_metrics_request_->Clear();
+  }
+  return reusable_metrics_request_;
+}
+
+opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest*
+OTelExportSinkNode::AcquireTraceRequest() {
+  if (reusable_trace_request_ == nullptr ||
+      request_arena_.SpaceAllocated() > kMaxRequestArenaBytes) {
+    request_arena_.Reset();
+    reusable_metrics_request_ = nullptr;
+    reusable_trace_request_ = google::protobuf::Arena::CreateMessage<
+        opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest>(&request_arena_);
+  } else {
+    reusable_trace_request_->Clear();
+  }
+  return reusable_trace_request_;
+}
+
 std::string OTelExportSinkNode::DebugStringImpl() {
   return absl::Substitute("Exec::OTelExportSinkNode: $0", plan_node_->DebugString());
 }
@@ -77,14 +122,96 @@ Status OTelExportSinkNode::OpenImpl(ExecState* exec_state) {
   if (plan_node_->spans().size()) {
     trace_service_stub_ = exec_state->TraceServiceStub(plan_node_->url(), plan_node_->insecure());
   }
+  if (FLAGS_carnot_otel_export_async) {
+    export_thread_ = std::thread(&OTelExportSinkNode::ExportThreadLoop, this, exec_state);
+  }
+  return Status::OK();
+}
+
+void OTelExportSinkNode::ExportThreadLoop(ExecState* exec_state) {
+  while (true) {
+    PendingExport pending;
+    {
+      std::unique_lock<std::mutex> lock(export_queue_mu_);
+      export_queue_cv_.wait(lock, [this] { return exporter_stopped_ || !export_queue_.empty(); });
+      if (export_queue_.empty()) {
+        // Stopped with nothing left to drain.
+        return;
+      }
+      pending = std::move(export_queue_.front());
+      export_queue_.pop_front();
+      // Coalesce queued requests of the same kind into one RPC, up to the configured size. This
+      // amortizes the collector round trip when the queue builds up faster than it drains.
+      auto coalesce_bytes = static_cast<size_t>(FLAGS_carnot_otel_export_coalesce_bytes);
+      while (!export_queue_.empty()) {
+        auto& next = export_queue_.front();
+        if (pending.metrics != nullptr && next.metrics != nullptr &&
+            pending.metrics->ByteSizeLong() + next.metrics->ByteSizeLong() <= coalesce_bytes) {
+          pending.metrics->mutable_resource_metrics()->MergeFrom(next.metrics->resource_metrics());
+          export_queue_.pop_front();
+          continue;
+        }
+        if (pending.spans != nullptr && next.spans != nullptr &&
+            pending.spans->ByteSizeLong() + next.spans->ByteSizeLong() <= coalesce_bytes) {
+          pending.spans->mutable_resource_spans()->MergeFrom(next.spans->resource_spans());
+          export_queue_.pop_front();
+          continue;
+        }
+        break;
+      }
+    }
+    export_queue_cv_.notify_all();
+    auto s = pending.metrics != nullptr ? ExportMetricsRequest(exec_state, *pending.metrics)
+                                        : ExportSpansRequest(exec_state, *pending.spans);
+    if (!s.ok()) {
+      {
+        std::lock_guard<std::mutex> lock(export_queue_mu_);
+        async_export_status_ = s;
+        export_queue_.clear();
+      }
+      export_queue_cv_.notify_all();
+      return;
+    }
+  }
+}
+
+Status OTelExportSinkNode::EnqueueExport(PendingExport pending) {
+  {
+    std::unique_lock<std::mutex> lock(export_queue_mu_);
+    export_queue_cv_.wait(lock, [this] {
+      return !async_export_status_.ok() || export_queue_.size() < kMaxQueuedOTelExports;
+    });
+    PX_RETURN_IF_ERROR(async_export_status_);
+    export_queue_.push_back(std::move(pending));
+  }
+  export_queue_cv_.notify_all();
   return Status::OK();
 }
 
+Status OTelExportSinkNode::StopExportThread() {
+  if (!export_thread_.joinable()) {
+    return Status::OK();
+  }
+  {
+    std::lock_guard<std::mutex> lock(export_queue_mu_);
+    exporter_stopped_ = true;
+  }
+  export_queue_cv_.notify_all();
+  export_thread_.join();
+  std::lock_guard<std::mutex> lock(export_queue_mu_);
+  return async_export_status_;
+}
+
 Status OTelExportSinkNode::CloseImpl(ExecState* exec_state) {
+  auto async_status = StopExportThread();
+
   if (sent_eos_) {
     return Status::OK();
   }
 
+  // Surface an async export failure that never made it back to the execution thread.
+  PX_RETURN_IF_ERROR(async_status);
+
   LOG(INFO) << absl::Substitute("Closing OTelExportSinkNode $0 in query $1 before receiving EOS",
                                 plan_node_->id(), exec_state->query_id().str());
 
@@ -216,24 +343,50 @@ Status FormatOTelStatus(int64_t id, const grpc::Status& status) {
 
 using ::opentelemetry::proto::metrics::v1::ResourceMetrics;
 Status OTelExportSinkNode::ConsumeMetrics(ExecState* exec_state, const RowBatch& rb) {
-  grpc::ClientContext context;
-  for (const auto& header : plan_node_->endpoint_headers()) {
-    context.AddMetadata(header.first, header.second);
+  // The async path hands the request to the export queue, so it must own its message; the
+  // synchronous path reuses the arena-backed request across batches to avoid rebuilding the
+  // protobuf tree per batch.
+  std::unique_ptr<opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest>
+      owned_request;
+  opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest* request;
+  if (export_thread_.joinable()) {
+    owned_request = std::make_unique<
+        opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest>();
+    request = owned_request.get();
+  } else {
+    request = AcquireMetricsRequest();
   }
-  context.set_compression_algorithm(GRPC_COMPRESS_GZIP);
 
-  metrics_response_.Clear();
-  opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest request;
+  // Rows that render identical resource attribute values share one ResourceMetrics entry, keyed
+  // by the serialized resource. JSON-encoded resource attributes fork the resource per row
+  // inside ReplicateData, so grouping only applies when none are configured.
+  const bool group_by_resource = plan_node_->resource_attributes_optional_json_encoded().empty();
+  absl::flat_hash_map<std::string,
+                      ::opentelemetry::proto::metrics::v1::InstrumentationLibraryMetrics*>
+      library_by_resource;
+  ::opentelemetry::proto::resource::v1::Resource resource_scratch;
 
   for (int64_t row_idx = 0; row_idx < rb.ColumnAt(0)->length(); ++row_idx) {
     ::opentelemetry::proto::metrics::v1::ResourceMetrics resource_metrics;
-    auto resource = resource_metrics.mutable_resource();
-    AddAttributes(resource->mutable_attributes(), plan_node_->resource_attributes_normal_encoding(),
-                  rb, row_idx);
-    // TODO(philkuz) optimize by pooling metrics by resource within a batch.
+    ::opentelemetry::proto::metrics::v1::InstrumentationLibraryMetrics* library_metrics;
+    if (group_by_resource) {
+      resource_scratch.Clear();
+      AddAttributes(resource_scratch.mutable_attributes(),
+                    plan_node_->resource_attributes_normal_encoding(), rb, row_idx);
+      auto [it, inserted] =
+          library_by_resource.try_emplace(resource_scratch.SerializeAsString(), nullptr);
+      if (inserted) {
+        auto grouped_metrics = request->add_resource_metrics();
+        *grouped_metrics->mutable_resource() = resource_scratch;
+        it->second = grouped_metrics->add_instrumentation_library_metrics();
+      }
+      library_metrics = it->second;
+    } else {
+      AddAttributes(resource_metrics.mutable_resource()->mutable_attributes(),
+                    plan_node_->resource_attributes_normal_encoding(), rb, row_idx);
+      library_metrics = resource_metrics.add_instrumentation_library_metrics();
+    }
     // TODO(philkuz) optimize by pooling data per metric per resource.
-
-    auto library_metrics = resource_metrics.add_instrumentation_library_metrics();
     for (const auto& metric_pb : plan_node_->metrics()) {
       auto metric = library_metrics->add_metrics();
       metric->set_name(metric_pb.name());
@@ -282,13 +435,32 @@ Status OTelExportSinkNode::ConsumeMetrics(ExecState* exec_state, const RowBatch&
         }
       }
     }
-    ReplicateData<ResourceMetrics>(
-        plan_node_->resource_attributes_optional_json_encoded(),
-        [&request](ResourceMetrics metrics) {
-          *request.add_resource_metrics() = std::move(metrics);
-        },
-        std::move(resource_metrics), rb, row_idx);
+    if (!group_by_resource) {
+      ReplicateData<ResourceMetrics>(
+          plan_node_->resource_attributes_optional_json_encoded(),
+          [request](ResourceMetrics metrics) {
+            *request->add_resource_metrics() = std::move(metrics);
+          },
+          std::move(resource_metrics), rb, row_idx);
+    }
+  }
+
+  if (owned_request != nullptr) {
+    PendingExport pending;
+    pending.metrics = std::move(owned_request);
+    return EnqueueExport(std::move(pending));
   }
+  return ExportMetricsRequest(exec_state, *request);
+}
+
+Status OTelExportSinkNode::ExportMetricsRequest(
+    ExecState* exec_state,
+    const opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest& request) {
+  grpc::ClientContext context;
+  for (const auto& header : plan_node_->endpoint_headers()) {
+    context.AddMetadata(header.first, header.second);
+  }
+  context.set_compression_algorithm(GRPC_COMPRESS_GZIP);
 
   // Set timeout, to avoid blocking on query.
   if (plan_node_->timeout() > 0) {
@@ -297,6 +469,7 @@ Status OTelExportSinkNode::ConsumeMetrics(ExecState* exec_state, const RowBatch&
     context.set_deadline(deadline);
   }
 
+  metrics_response_.Clear();
   grpc::Status status = metrics_service_stub_->Export(&context, request, &metrics_response_);
   if (!status.ok()) {
     if (status.error_code() == grpc::StatusCode::DEADLINE_EXCEEDED) {
@@ -334,22 +507,43 @@ std::string GenerateID(uint64_t num_bytes) {
 
 using ::opentelemetry::proto::trace::v1::ResourceSpans;
 Status OTelExportSinkNode::ConsumeSpans(ExecState* exec_state, const RowBatch& rb) {
-  grpc::ClientContext context;
-  for (const auto& header : plan_node_->endpoint_headers()) {
-    context.AddMetadata(header.first, header.second);
+  // See ConsumeMetrics for the request ownership and resource grouping rationale.
+  std::unique_ptr<opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest>
+      owned_request;
+  opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest* request;
+  if (export_thread_.joinable()) {
+    owned_request =
+        std::make_unique<opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest>();
+    request = owned_request.get();
+  } else {
+    request = AcquireTraceRequest();
   }
-  context.set_compression_algorithm(GRPC_COMPRESS_GZIP);
 
-  metrics_response_.Clear();
-  opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest request;
+  const bool group_by_resource = plan_node_->resource_attributes_optional_json_encoded().empty();
+  absl::flat_hash_map<std::string, ::opentelemetry::proto::trace::v1::InstrumentationLibrarySpans*>
+      library_by_resource;
+  ::opentelemetry::proto::resource::v1::Resource resource_scratch;
 
   for (int64_t row_idx = 0; row_idx < rb.ColumnAt(0)->length(); ++row_idx) {
-    // TODO(philkuz) aggregate spans by resource.
     ::opentelemetry::proto::trace::v1::ResourceSpans resource_spans;
-    auto resource = resource_spans.mutable_resource();
-    AddAttributes(resource->mutable_attributes(), plan_node_->resource_attributes_normal_encoding(),
-                  rb, row_idx);
-    auto library_spans = resource_spans.add_instrumentation_library_spans();
+    ::opentelemetry::proto::trace::v1::InstrumentationLibrarySpans* library_spans;
+    if (group_by_resource) {
+      resource_scratch.Clear();
+      AddAttributes(resource_scratch.mutable_attributes(),
+                    plan_node_->resource_attributes_normal_encoding(), rb, row_idx);
+      auto [it, inserted] =
+          library_by_resource.try_emplace(resource_scratch.SerializeAsString(), nullptr);
+      if (inserted) {
+        auto grouped_spans = request->add_resource_spans();
+        *grouped_spans->mutable_resource() = resource_scratch;
+        it->second = grouped_spans->add_instrumentation_library_spans();
+      }
+      library_spans = it->second;
+    } else {
+      AddAttributes(resource_spans.mutable_resource()->mutable_attributes(),
+                    plan_node_->resource_attributes_normal_encoding(), rb, row_idx);
+      library_spans = resource_spans.add_instrumentation_library_spans();
+    }
     for (const auto& span_pb : plan_node_->spans()) {
       auto span = library_spans->add_spans();
       if (span_pb.has_name_string()) {
@@ -415,11 +609,31 @@ Status OTelExportSinkNode::ConsumeSpans(ExecState* exec_state, const RowBatch& r
       }
     }
 
-    ReplicateData<ResourceSpans>(
-        plan_node_->resource_attributes_optional_json_encoded(),
-        [&request](ResourceSpans span) { *request.add_resource_spans() = std::move(span); },
-        std::move(resource_spans), rb, row_idx);
+    if (!group_by_resource) {
+      ReplicateData<ResourceSpans>(
+          plan_node_->resource_attributes_optional_json_encoded(),
+          [request](ResourceSpans span) { *request->add_resource_spans() = std::move(span); },
+          std::move(resource_spans), rb, row_idx);
+    }
+  }
+
+  if (owned_request != nullptr) {
+    PendingExport pending;
+    pending.spans = std::move(owned_request);
+    return EnqueueExport(std::move(pending));
   }
+  return ExportSpansRequest(exec_state, *request);
+}
+
+Status OTelExportSinkNode::ExportSpansRequest(
+    ExecState* exec_state,
+    const opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest& request) {
+  grpc::ClientContext context;
+  for (const auto& header : plan_node_->endpoint_headers()) {
+    context.AddMetadata(header.first, header.second);
+  }
+  context.set_compression_algorithm(GRPC_COMPRESS_GZIP);
+
   // Set timeout, to avoid blocking on query.
   if (plan_node_->timeout() > 0) {
     std::chrono::system_clock::time_point deadline =
@@ -427,6 +641,7 @@ Status OTelExportSinkNode::ConsumeSpans(ExecState* exec_state, const RowBatch& r
     context.set_deadline(deadline);
   }
 
+  trace_response_.Clear();
   grpc::Status status = trace_service_stub_->Export(&context, request, &trace_response_);
   if (!status.ok()) {
     if (status.error_code() == grpc::StatusCode::DEADLINE_EXCEEDED) {
@@ -446,6 +661,9 @@ Status OTelExportSinkNode::ConsumeNextImpl(ExecState* exec_state, const RowBatch
     PX_RETURN_IF_ERROR(ConsumeSpans(exec_state, rb));
   }
   if (rb.eos()) {
+    // Drain any pending async exports before acknowledging eos, so a failed export still fails
+    // the query in-line.
+    PX_RETURN_IF_ERROR(StopExportThread());
     sent_eos_ = true;
   }
   return Status::OK();
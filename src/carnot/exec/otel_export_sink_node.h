@@ -17,9 +17,14 @@
  */
 #pragma once
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/grpcpp.h>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "opentelemetry/proto/collector/metrics/v1/metrics_service.grpc.pb.h"
 #include "opentelemetry/proto/collector/metrics/v1/metrics_service.pb.h"
@@ -29,6 +34,9 @@
 #include "src/common/base/base.h"
 #include "src/shared/types/types.h"
 
+DECLARE_bool(carnot_otel_export_async);
+DECLARE_int32(carnot_otel_export_coalesce_bytes);
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -37,9 +45,14 @@ struct SpanConfig {
   std::string name;
 };
 
+// Bound on the number of converted export requests queued for the export thread. Keeps
+// backpressure on the execution thread when the collector can't keep up, while still letting
+// compute overlap with exports.
+constexpr size_t kMaxQueuedOTelExports = 8;
+
 class OTelExportSinkNode : public SinkNode {
  public:
-  virtual ~OTelExportSinkNode() = default;
+  virtual ~OTelExportSinkNode();
 
  protected:
   std::string DebugStringImpl() override;
@@ -53,6 +66,47 @@ class OTelExportSinkNode : public SinkNode {
  private:
   Status ConsumeMetrics(ExecState* exec_state, const table_store::schema::RowBatch& rb);
   Status ConsumeSpans(ExecState* exec_state, const table_store::schema::RowBatch& rb);
+  Status ExportMetricsRequest(
+      ExecState* exec_state,
+      const opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest& request);
+  Status ExportSpansRequest(
+      ExecState* exec_state,
+      const opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest& request);
+
+  // A converted export waiting for the export thread. Exactly one of metrics/spans is set.
+  struct PendingExport {
+    std::unique_ptr<opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest>
+        metrics;
+    std::unique_ptr<opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest> spans;
+  };
+
+  // Async export path (enabled by --carnot_otel_export_async): the execution thread converts row
+  // batches into export requests and hands them to a bounded queue; the export thread coalesces
+  // adjacent requests of the same kind up to --carnot_otel_export_coalesce_bytes and issues one
+  // Export RPC per coalesced request, so collector latency no longer stalls execution. Export
+  // failures are recorded and surfaced on the next consume, and the queue is drained synchronously
+  // at eos so the final status is still reported in-line.
+  void ExportThreadLoop(ExecState* exec_state);
+  Status EnqueueExport(PendingExport pending);
+  // Signals the export thread to exit after draining the queue, joins it, and returns the status
+  // of any failed async export. Idempotent.
+  Status StopExportThread();
+
+  // Return the arena-backed reusable request, cleared and ready to fill. Clearing retains the
+  // arena blocks and the message tree's capacity, so the per-batch conversion on the synchronous
+  // export path stops allocating once the sink reaches a steady state. Not used on the async
+  // path: queued requests must outlive the consume call, so they are heap-allocated and owned by
+  // the queue.
+  opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest*
+  AcquireMetricsRequest();
+  opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest* AcquireTraceRequest();
+
+  std::thread export_thread_;
+  mutable std::mutex export_queue_mu_;
+  std::condition_variable export_queue_cv_;
+  std::deque<PendingExport> export_queue_;
+  bool exporter_stopped_ = false;
+  Status async_export_status_;
 
   std::unique_ptr<table_store::schema::RowDescriptor> input_descriptor_;
   opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceResponse metrics_response_;
@@ -62,6 +116,16 @@ class OTelExportSinkNode : public SinkNode {
   opentelemetry::proto::collector::trace::v1::TraceService::StubInterface* trace_service_stub_;
   std::unique_ptr<plan::OTelExportSinkOperator> plan_node_;
 
+  // Arena backing the reusable export requests. Reset (with the messages re-created) when it
+  // grows past kMaxRequestArenaBytes, so one oversized batch doesn't pin memory for the life of
+  // the sink.
+  static constexpr size_t kMaxRequestArenaBytes = 8 * 1024 * 1024;
+  google::protobuf::Arena request_arena_;
+  opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest*
+      reusable_metrics_request_ = nullptr;
+  opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest* reusable_trace_request_ =
+      nullptr;
+
   std::unique_ptr<SpanConfig> span_config_;
 };
 
@@ -18,6 +18,7 @@
 
 #include "src/carnot/exec/otel_export_sink_node.h"
 
+#include <atomic>
 #include <utility>
 #include <vector>
 
@@ -209,6 +210,56 @@ metrics {
                                  .bytes_value());
 }
 
+TEST_F(OTelExportSinkNodeTest, async_export) {
+  bool prev_flag_value = FLAGS_carnot_otel_export_async;
+  FLAGS_carnot_otel_export_async = true;
+
+  std::string operator_pb_txt = R"(
+endpoint_config {
+  url: "otlp.px.dev"
+}
+metrics {
+  name: "http.resp.latency"
+  time_column_index: 0
+  gauge { int_column_index: 1 }
+})";
+  planpb::OTelExportSinkOperator otel_sink_op;
+
+  EXPECT_TRUE(google::protobuf::TextFormat::ParseFromString(operator_pb_txt, &otel_sink_op));
+  auto plan_node = std::make_unique<plan::OTelExportSinkOperator>(1);
+  auto s = plan_node->Init(otel_sink_op);
+  RowDescriptor input_rd({types::TIME64NS, types::FLOAT64});
+  RowDescriptor output_rd({});
+
+  // The export thread may coalesce the two batches into a single Export call, so we count rows
+  // across calls rather than calls.
+  std::atomic<int64_t> exported_resource_metrics = 0;
+  EXPECT_CALL(*metrics_mock_, Export(_, _, _))
+      .WillRepeatedly(
+          Invoke([&exported_resource_metrics](const auto&, const auto& proto, const auto&) {
+            exported_resource_metrics += proto.resource_metrics_size();
+            return grpc::Status::OK;
+          }));
+
+  auto tester = exec::ExecNodeTester<OTelExportSinkNode, plan::OTelExportSinkOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+  auto rb1 = RowBatchBuilder(input_rd, 1, /*eow*/ false, /*eos*/ false)
+                 .AddColumn<types::Time64NSValue>({10})
+                 .AddColumn<types::Float64Value>({1.0})
+                 .get();
+  tester.ConsumeNext(rb1, 1, 0);
+  auto rb2 = RowBatchBuilder(input_rd, 1, /*eow*/ true, /*eos*/ true)
+                 .AddColumn<types::Time64NSValue>({20})
+                 .AddColumn<types::Float64Value>({2.0})
+                 .get();
+  // The eos batch drains the export queue synchronously.
+  tester.ConsumeNext(rb2, 1, 0);
+  EXPECT_EQ(2, exported_resource_metrics);
+  tester.Close();
+
+  FLAGS_carnot_otel_export_async = prev_flag_value;
+}
+
 struct TestCase {
   std::string name;
   std::string operator_proto;
@@ -325,11 +376,6 @@ resource_metrics {
         }
       }
     }
-  }
-}
-resource_metrics {
-  resource {}
-  instrumentation_library_metrics {
     metrics {
       name: "http.resp.latency"
       summary {
@@ -470,11 +516,6 @@ resource_metrics {
         }
       }
     }
-  }
-}
-resource_metrics {
-  resource {}
-  instrumentation_library_metrics {
     metrics {
       name: "http.resp.latency"
       gauge {
@@ -513,11 +554,6 @@ resource_metrics {
         }
       }
     }
-  }
-}
-resource_metrics {
-  resource {}
-  instrumentation_library_metrics {
     metrics {
       name: "http.resp.latency"
       gauge {
@@ -916,6 +952,83 @@ resource_metrics {
       }
     }
   }
+})pb"}},
+                             {"grouped_by_resource",
+                              R"pb(
+resource {
+  attributes {
+    name: "service.name"
+    column {
+      column_type: STRING
+      column_index: 1
+    }
+  }
+}
+metrics {
+  name: "http.resp.latency"
+  time_column_index: 0
+  gauge { int_column_index: 2 }
+})pb",
+                              {R"pb(
+cols { time64ns_data { data: 10 data: 11 data: 12 } }
+cols {
+  string_data { data: "pl/querybroker" data: "pl/metadata" data: "pl/querybroker" }
+}
+cols { int64_data { data: 15 data: 150 data: 1500 } }
+num_rows: 3
+eow: true
+eos: true)pb"},
+                              {R"pb(
+resource_metrics {
+  resource {
+    attributes {
+      key: "service.name"
+      value {
+        string_value: "pl/querybroker"
+      }
+    }
+  }
+  instrumentation_library_metrics {
+    metrics {
+      name: "http.resp.latency"
+      gauge {
+        data_points {
+          time_unix_nano: 10
+          as_int: 15
+        }
+      }
+    }
+    metrics {
+      name: "http.resp.latency"
+      gauge {
+        data_points {
+          time_unix_nano: 12
+          as_int: 1500
+        }
+      }
+    }
+  }
+}
+resource_metrics {
+  resource {
+    attributes {
+      key: "service.name"
+      value {
+        string_value: "pl/metadata"
+      }
+    }
+  }
+  instrumentation_library_metrics {
+    metrics {
+      name: "http.resp.latency"
+      gauge {
+        data_points {
+          time_unix_nano: 11
+          as_int: 150
+        }
+      }
+    }
+  }
 })pb"}},
                              {"string_value_attribute",
                               R"pb(
@@ -966,18 +1079,6 @@ resource_metrics {
         }
       }
     }
-  }
-}
-resource_metrics {
-  resource {
-    attributes {
-      key: "pixie_cloud_addr"
-      value {
-        string_value: "dev.withpixie.dev"
-      }
-    }
-  }
-  instrumentation_library_metrics {
     metrics {
       name: "http.resp.latency"
       gauge {
@@ -1184,11 +1285,6 @@ resource_spans {
       kind: SPAN_KIND_SERVER
       status {}
     }
-  }
-}
-resource_spans {
-  resource {}
-  instrumentation_library_spans {
     spans {
       name: "span2"
       start_time_unix_nano: 20
@@ -1529,8 +1625,11 @@ TEST_P(SpanIDTests, generate_ids) {
   auto rb = RowBatch::FromProto(row_batch_proto).ConsumeValueOrDie();
   tester.ConsumeNext(*rb.get(), 1, 0);
 
-  for (const auto& [s_idx, span] : Enumerate(actual_proto.resource_spans())) {
-    for (const auto& ilm : span.instrumentation_library_spans()) {
+  // Rows sharing a resource are grouped into one ResourceSpans, so index expectations by span
+  // ordinal rather than by resource.
+  size_t s_idx = 0;
+  for (const auto& resource_span : actual_proto.resource_spans()) {
+    for (const auto& ilm : resource_span.instrumentation_library_spans()) {
       for (const auto& span : ilm.spans()) {
         SCOPED_TRACE(absl::Substitute("span $0", s_idx));
         {
@@ -1545,6 +1644,7 @@ TEST_P(SpanIDTests, generate_ids) {
           SCOPED_TRACE("parent_span_id");
           tc.expected_parent_span_ids[s_idx].Compare(span.parent_span_id());
         }
+        ++s_idx;
       }
     }
   }
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/query_scheduler.h"
+
+#include <memory>
+
+DEFINE_int32(carnot_max_concurrent_queries,
+             gflags::Int32FromEnv("PL_CARNOT_MAX_CONCURRENT_QUERIES", 4),
+             "Max number of queries that may execute concurrently on this Carnot instance. "
+             "Additional queries queue for an execution slot, highest priority first.");
+
+DEFINE_int32(carnot_query_slice_millis, gflags::Int32FromEnv("PL_CARNOT_QUERY_SLICE_MILLIS", 100),
+             "Execution slice of an admitted query, in milliseconds. Once a query's slice expires "
+             "and other queries are waiting, it yields its slot and re-queues at its priority.");
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+QueryScheduler::QueryScheduler()
+    : QueryScheduler(FLAGS_carnot_max_concurrent_queries,
+                     std::chrono::milliseconds{FLAGS_carnot_query_slice_millis}) {}
+
+std::unique_ptr<QueryScheduler::Ticket> QueryScheduler::Admit(int64_t priority) {
+  std::unique_lock<std::mutex> lock(mu_);
+  WaitForSlot(&lock, {-priority, next_seq_++});
+  return std::unique_ptr<Ticket>(new Ticket(this, priority));
+}
+
+void QueryScheduler::WaitForSlot(std::unique_lock<std::mutex>* lock, const WaitKey& key) {
+  waiting_.insert(key);
+  cv_.wait(*lock, [&] { return running_ < max_running_queries_ && *waiting_.begin() == key; });
+  waiting_.erase(key);
+  ++running_;
+  // The head of the wait queue changed, so the next waiter (if a slot remains) can re-check.
+  cv_.notify_all();
+}
+
+void QueryScheduler::ReleaseSlot() {
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    --running_;
+  }
+  cv_.notify_all();
+}
+
+void QueryScheduler::Rotate(int64_t priority) {
+  std::unique_lock<std::mutex> lock(mu_);
+  if (waiting_.empty()) {
+    return;
+  }
+  --running_;
+  cv_.notify_all();
+  WaitForSlot(&lock, {-priority, next_seq_++});
+}
+
+int32_t QueryScheduler::num_running() const {
+  std::lock_guard<std::mutex> lock(mu_);
+  return running_;
+}
+
+size_t QueryScheduler::num_waiting() const {
+  std::lock_guard<std::mutex> lock(mu_);
+  return waiting_.size();
+}
+
+QueryScheduler::Ticket::~Ticket() { scheduler_->ReleaseSlot(); }
+
+void QueryScheduler::Ticket::Yield() {
+  auto now = std::chrono::steady_clock::now();
+  if (now - slice_start_ < scheduler_->slice_duration_) {
+    return;
+  }
+  scheduler_->Rotate(priority_);
+  slice_start_ = std::chrono::steady_clock::now();
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <utility>
+
+#include "src/common/base/base.h"
+
+DECLARE_int32(carnot_max_concurrent_queries);
+DECLARE_int32(carnot_query_slice_millis);
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+/**
+ * QueryScheduler cooperatively time-slices the queries running on a Carnot instance. Each query
+ * executes on its own thread, but without coordination a heavy ad-hoc scan competes with every
+ * latency-sensitive dashboard query for the same cores for its entire runtime.
+ *
+ * A query must Admit() itself before executing and holds one of a bounded number of execution
+ * slots while it runs. ExecutionGraph calls Ticket::Yield() between rounds of batch generation;
+ * once a query has used up its slice and other queries are waiting, it gives up its slot and
+ * re-queues behind them. Waiters are admitted highest priority first (FIFO within a priority), so
+ * a long low-priority scan degrades into running one slice per turn while short high-priority
+ * queries overtake it at every yield point.
+ *
+ * Low-priority waiters can be starved indefinitely by a sustained stream of higher-priority
+ * queries; that is the intended trade for keeping dashboard latency predictable.
+ */
+class QueryScheduler {
+ public:
+  /**
+   * A Ticket represents an admitted query's execution slot, held for the lifetime of the ticket.
+   * Tickets are handed to ExecutionGraph as the cooperative yield point and must not outlive the
+   * scheduler that issued them.
+   */
+  class Ticket : public NotCopyable {
+   public:
+    ~Ticket();
+
+    /**
+     * The cooperative yield point, called between rounds of batch generation. Cheap when the
+     * query's slice hasn't expired or no other query is waiting; otherwise releases the slot,
+     * re-queues this query at its priority, and blocks until it is re-admitted.
+     */
+    void Yield();
+
+   private:
+    friend class QueryScheduler;
+    Ticket(QueryScheduler* scheduler, int64_t priority)
+        : scheduler_(scheduler),
+          priority_(priority),
+          slice_start_(std::chrono::steady_clock::now()) {}
+
+    QueryScheduler* const scheduler_;
+    const int64_t priority_;
+    std::chrono::steady_clock::time_point slice_start_;
+  };
+
+  QueryScheduler(int32_t max_running_queries, std::chrono::milliseconds slice_duration)
+      : max_running_queries_(max_running_queries), slice_duration_(slice_duration) {}
+
+  /**
+   * Creates a scheduler configured from the --carnot_max_concurrent_queries and
+   * --carnot_query_slice_millis flags.
+   */
+  QueryScheduler();
+
+  /**
+   * Blocks until an execution slot is available and this query is the highest-priority waiter,
+   * then returns the ticket holding the slot. Higher priority values are admitted first; equal
+   * priorities are admitted in arrival order.
+   */
+  std::unique_ptr<Ticket> Admit(int64_t priority);
+
+  int32_t num_running() const;
+  size_t num_waiting() const;
+
+ private:
+  // Waiters are ordered (-priority, arrival seq), so *begin() is always the next query to admit.
+  using WaitKey = std::pair<int64_t, uint64_t>;
+
+  // Blocks until `key` is at the head of the wait queue and a slot is free, then takes the slot.
+  void WaitForSlot(std::unique_lock<std::mutex>* lock, const WaitKey& key);
+  void ReleaseSlot();
+  // Gives up the caller's slot and re-acquires it behind the current waiters. No-op when nothing
+  // is waiting.
+  void Rotate(int64_t priority);
+
+  const int32_t max_running_queries_;
+  const std::chrono::milliseconds slice_duration_;
+
+  mutable std::mutex mu_;
+  std::condition_variable cv_;
+  int32_t running_ = 0;
+  uint64_t next_seq_ = 0;
+  std::set<WaitKey> waiting_;
+};
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
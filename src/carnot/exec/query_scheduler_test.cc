@@ -0,0 +1,111 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/query_scheduler.h"
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+using std::chrono::milliseconds;
+
+namespace {
+// Spin until the scheduler has the expected number of waiters, so tests can establish a known
+// queue state before releasing slots.
+void WaitForWaiters(const QueryScheduler& scheduler, size_t expected) {
+  while (scheduler.num_waiting() < expected) {
+    std::this_thread::sleep_for(milliseconds{1});
+  }
+}
+}  // namespace
+
+TEST(QuerySchedulerTest, AdmitsUpToCapacity) {
+  QueryScheduler scheduler(2, milliseconds{100});
+  auto t1 = scheduler.Admit(/*priority*/ 0);
+  auto t2 = scheduler.Admit(/*priority*/ 0);
+  EXPECT_EQ(2, scheduler.num_running());
+  EXPECT_EQ(0, scheduler.num_waiting());
+
+  t1.reset();
+  EXPECT_EQ(1, scheduler.num_running());
+}
+
+TEST(QuerySchedulerTest, BlocksWhenFullUntilSlotReleased) {
+  QueryScheduler scheduler(1, milliseconds{100});
+  auto t1 = scheduler.Admit(/*priority*/ 0);
+
+  std::unique_ptr<QueryScheduler::Ticket> t2;
+  std::thread waiter([&] { t2 = scheduler.Admit(/*priority*/ 0); });
+  WaitForWaiters(scheduler, 1);
+  EXPECT_EQ(1, scheduler.num_running());
+  EXPECT_EQ(nullptr, t2);
+
+  t1.reset();
+  waiter.join();
+  EXPECT_NE(nullptr, t2);
+  EXPECT_EQ(1, scheduler.num_running());
+}
+
+TEST(QuerySchedulerTest, YieldKeepsSlotWhenNothingIsWaiting) {
+  // Zero slice duration: every Yield() is past its slice, but with no waiters it must not block.
+  QueryScheduler scheduler(1, milliseconds{0});
+  auto t1 = scheduler.Admit(/*priority*/ 0);
+  t1->Yield();
+  EXPECT_EQ(1, scheduler.num_running());
+}
+
+TEST(QuerySchedulerTest, YieldAdmitsWaitersByPriority) {
+  QueryScheduler scheduler(1, milliseconds{0});
+  auto t0 = scheduler.Admit(/*priority*/ 0);
+
+  std::mutex mu;
+  std::vector<int64_t> admission_order;
+  auto run_query = [&](int64_t priority) {
+    auto ticket = scheduler.Admit(priority);
+    std::lock_guard<std::mutex> lock(mu);
+    admission_order.push_back(priority);
+  };
+
+  // Queue the low-priority query first, then the high-priority one.
+  std::thread low([&] { run_query(1); });
+  WaitForWaiters(scheduler, 1);
+  std::thread high([&] { run_query(10); });
+  WaitForWaiters(scheduler, 2);
+
+  // The running query's slice is expired and queries are waiting, so Yield() re-queues it at
+  // priority 0: both waiters overtake it, highest priority first.
+  t0->Yield();
+  low.join();
+  high.join();
+
+  ASSERT_EQ(2, admission_order.size());
+  EXPECT_EQ(10, admission_order[0]);
+  EXPECT_EQ(1, admission_order[1]);
+  EXPECT_EQ(1, scheduler.num_running());
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
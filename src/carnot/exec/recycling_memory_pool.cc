@@ -0,0 +1,170 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/recycling_memory_pool.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "src/common/base/base.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+RecyclingMemoryPool::~RecyclingMemoryPool() {
+  for (size_t bucket = 0; bucket < kNumBuckets; ++bucket) {
+    for (uint8_t* buffer : free_lists_[bucket]) {
+      backing_->Free(buffer, BucketSize(bucket));
+    }
+  }
+}
+
+size_t RecyclingMemoryPool::BucketIndex(int64_t size) {
+  DCHECK_GT(size, 0);
+  DCHECK_LE(size, kMaxRecycledAllocation);
+  size_t bucket = 0;
+  int64_t bucket_size = kMinRecycledAllocation;
+  while (bucket_size < size) {
+    bucket_size <<= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+int64_t RecyclingMemoryPool::BucketSize(size_t bucket) {
+  DCHECK_LT(bucket, kNumBuckets);
+  return kMinRecycledAllocation << bucket;
+}
+
+arrow::Status RecyclingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  if (size <= 0 || size > kMaxRecycledAllocation) {
+    auto s = backing_->Allocate(size, out);
+    if (s.ok()) {
+      std::lock_guard<std::mutex> lock(mu_);
+      outstanding_bytes_ += size;
+      max_outstanding_bytes_ = std::max(max_outstanding_bytes_, outstanding_bytes_);
+    }
+    return s;
+  }
+
+  auto bucket = BucketIndex(size);
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto& free_list = free_lists_[bucket];
+    if (!free_list.empty()) {
+      *out = free_list.back();
+      free_list.pop_back();
+      cached_bytes_ -= BucketSize(bucket);
+      recycled_bytes_ += size;
+      outstanding_bytes_ += size;
+      max_outstanding_bytes_ = std::max(max_outstanding_bytes_, outstanding_bytes_);
+      return arrow::Status::OK();
+    }
+  }
+  // Allocate the full size class so the buffer can serve any request in this bucket later.
+  auto s = backing_->Allocate(BucketSize(bucket), out);
+  if (s.ok()) {
+    std::lock_guard<std::mutex> lock(mu_);
+    outstanding_bytes_ += size;
+    max_outstanding_bytes_ = std::max(max_outstanding_bytes_, outstanding_bytes_);
+  }
+  return s;
+}
+
+arrow::Status RecyclingMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  bool old_recycled = old_size > 0 && old_size <= kMaxRecycledAllocation;
+  bool new_recycled = new_size > 0 && new_size <= kMaxRecycledAllocation;
+
+  if (old_recycled && new_recycled && BucketIndex(old_size) == BucketIndex(new_size)) {
+    // The buffer's size class already has room for the new size.
+    std::lock_guard<std::mutex> lock(mu_);
+    outstanding_bytes_ += new_size - old_size;
+    max_outstanding_bytes_ = std::max(max_outstanding_bytes_, outstanding_bytes_);
+    return arrow::Status::OK();
+  }
+
+  if (!old_recycled && !new_recycled) {
+    auto s = backing_->Reallocate(old_size, new_size, ptr);
+    if (s.ok()) {
+      std::lock_guard<std::mutex> lock(mu_);
+      outstanding_bytes_ += new_size - old_size;
+      max_outstanding_bytes_ = std::max(max_outstanding_bytes_, outstanding_bytes_);
+    }
+    return s;
+  }
+
+  // Crossing a size-class boundary: allocate fresh, copy, and free through our own paths so
+  // buffers always carry their size class's capacity.
+  uint8_t* new_buffer;
+  auto s = Allocate(new_size, &new_buffer);
+  if (!s.ok()) {
+    return s;
+  }
+  std::memcpy(new_buffer, *ptr, std::min(old_size, new_size));
+  Free(*ptr, old_size);
+  *ptr = new_buffer;
+  return arrow::Status::OK();
+}
+
+void RecyclingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  if (size <= 0 || size > kMaxRecycledAllocation) {
+    backing_->Free(buffer, size);
+    std::lock_guard<std::mutex> lock(mu_);
+    outstanding_bytes_ -= size;
+    return;
+  }
+
+  auto bucket = BucketIndex(size);
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    outstanding_bytes_ -= size;
+    if (cached_bytes_ + BucketSize(bucket) <= kMaxRecycledCacheBytes) {
+      free_lists_[bucket].push_back(buffer);
+      cached_bytes_ += BucketSize(bucket);
+      return;
+    }
+  }
+  backing_->Free(buffer, BucketSize(bucket));
+}
+
+int64_t RecyclingMemoryPool::bytes_allocated() const {
+  std::lock_guard<std::mutex> lock(mu_);
+  return outstanding_bytes_;
+}
+
+int64_t RecyclingMemoryPool::max_memory() const {
+  std::lock_guard<std::mutex> lock(mu_);
+  return max_outstanding_bytes_;
+}
+
+int64_t RecyclingMemoryPool::recycled_bytes() const {
+  std::lock_guard<std::mutex> lock(mu_);
+  return recycled_bytes_;
+}
+
+int64_t RecyclingMemoryPool::ConsumeRecycledBytesDelta() {
+  std::lock_guard<std::mutex> lock(mu_);
+  auto delta = recycled_bytes_ - reported_recycled_bytes_;
+  reported_recycled_bytes_ = recycled_bytes_;
+  return delta;
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <arrow/memory_pool.h>
+#include <arrow/status.h>
+#include <stdint.h>
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+// Allocations within [1, kMaxRecycledAllocation] are rounded up to a power-of-two size class
+// (no smaller than kMinRecycledAllocation) and recycled through per-class free lists. Larger
+// allocations pass straight through to the backing pool.
+constexpr int64_t kMinRecycledAllocation = 1024;
+constexpr int64_t kMaxRecycledAllocation = 1 << 20;
+// Cap on the bytes held in the free lists, so an idle pool doesn't pin much memory.
+constexpr int64_t kMaxRecycledCacheBytes = 16 << 20;
+
+/**
+ * RecyclingMemoryPool is an arrow::MemoryPool that recycles freed buffers across the thousands
+ * of similarly-sized batch allocations a query makes, instead of returning each one to malloc.
+ * One instance lives per query (owned by ExecState); it is thread-safe since sink writer and
+ * source prefetch threads can allocate concurrently with the execution thread.
+ */
+class RecyclingMemoryPool : public arrow::MemoryPool {
+ public:
+  explicit RecyclingMemoryPool(arrow::MemoryPool* backing) : backing_(backing) {}
+  ~RecyclingMemoryPool() override;
+
+  arrow::Status Allocate(int64_t size, uint8_t** out) override;
+  arrow::Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+  int64_t max_memory() const override;
+  std::string backend_name() const override { return "recycling"; }
+
+  // Total bytes served from the free lists rather than the backing pool.
+  int64_t recycled_bytes() const;
+  // Returns the bytes recycled since the last call. Per-query stats export uses this so
+  // concurrent queries sharing the pool sum to the true total.
+  int64_t ConsumeRecycledBytesDelta();
+
+ private:
+  static size_t BucketIndex(int64_t size);
+  static int64_t BucketSize(size_t bucket);
+  static constexpr size_t kNumBuckets = 11;
+  static_assert(kMinRecycledAllocation << (kNumBuckets - 1) == kMaxRecycledAllocation,
+                "size classes must span [kMinRecycledAllocation, kMaxRecycledAllocation]");
+
+  arrow::MemoryPool* backing_;
+
+  mutable std::mutex mu_;
+  std::array<std::vector<uint8_t*>, kNumBuckets> free_lists_;
+  // Bytes currently sitting in the free lists.
+  int64_t cached_bytes_ = 0;
+  // Bytes handed out to callers and not yet freed.
+  int64_t outstanding_bytes_ = 0;
+  int64_t max_outstanding_bytes_ = 0;
+  int64_t recycled_bytes_ = 0;
+  int64_t reported_recycled_bytes_ = 0;
+};
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
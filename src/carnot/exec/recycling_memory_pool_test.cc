@@ -0,0 +1,100 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/recycling_memory_pool.h"
+
+#include <arrow/memory_pool.h>
+#include <cstring>
+
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+TEST(RecyclingMemoryPoolTest, recycles_freed_buffers) {
+  RecyclingMemoryPool pool(arrow::default_memory_pool());
+
+  uint8_t* buffer;
+  ASSERT_TRUE(pool.Allocate(4000, &buffer).ok());
+  EXPECT_EQ(4000, pool.bytes_allocated());
+  EXPECT_EQ(0, pool.recycled_bytes());
+  pool.Free(buffer, 4000);
+  EXPECT_EQ(0, pool.bytes_allocated());
+
+  // A same-size-class allocation should be served from the free list.
+  uint8_t* recycled;
+  ASSERT_TRUE(pool.Allocate(3000, &recycled).ok());
+  EXPECT_EQ(buffer, recycled);
+  EXPECT_EQ(3000, pool.recycled_bytes());
+  pool.Free(recycled, 3000);
+}
+
+TEST(RecyclingMemoryPoolTest, oversized_allocations_pass_through) {
+  RecyclingMemoryPool pool(arrow::default_memory_pool());
+
+  uint8_t* buffer;
+  ASSERT_TRUE(pool.Allocate(2 * kMaxRecycledAllocation, &buffer).ok());
+  EXPECT_EQ(2 * kMaxRecycledAllocation, pool.bytes_allocated());
+  pool.Free(buffer, 2 * kMaxRecycledAllocation);
+
+  uint8_t* next;
+  ASSERT_TRUE(pool.Allocate(2 * kMaxRecycledAllocation, &next).ok());
+  EXPECT_EQ(0, pool.recycled_bytes());
+  pool.Free(next, 2 * kMaxRecycledAllocation);
+  EXPECT_EQ(0, pool.bytes_allocated());
+}
+
+TEST(RecyclingMemoryPoolTest, reallocate_within_and_across_size_classes) {
+  RecyclingMemoryPool pool(arrow::default_memory_pool());
+
+  uint8_t* buffer;
+  ASSERT_TRUE(pool.Allocate(1000, &buffer).ok());
+  std::memset(buffer, 0xab, 1000);
+
+  // Within the same size class the pointer is unchanged.
+  uint8_t* same_class = buffer;
+  ASSERT_TRUE(pool.Reallocate(1000, 1024, &same_class).ok());
+  EXPECT_EQ(buffer, same_class);
+
+  // Growing across size classes preserves the data.
+  ASSERT_TRUE(pool.Reallocate(1024, 8192, &same_class).ok());
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(0xab, same_class[i]);
+  }
+  EXPECT_EQ(8192, pool.bytes_allocated());
+  pool.Free(same_class, 8192);
+}
+
+TEST(RecyclingMemoryPoolTest, consume_recycled_bytes_delta) {
+  RecyclingMemoryPool pool(arrow::default_memory_pool());
+
+  uint8_t* buffer;
+  ASSERT_TRUE(pool.Allocate(2048, &buffer).ok());
+  pool.Free(buffer, 2048);
+  ASSERT_TRUE(pool.Allocate(2048, &buffer).ok());
+
+  EXPECT_EQ(2048, pool.ConsumeRecycledBytesDelta());
+  EXPECT_EQ(0, pool.ConsumeRecycledBytesDelta());
+  EXPECT_EQ(2048, pool.recycled_bytes());
+  pool.Free(buffer, 2048);
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/result_spool.h"
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include "src/common/zlib/zlib_wrapper.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+// Each entry is stored as a u64 compressed length followed by the gzip bytes.
+
+StatusOr<std::unique_ptr<ResultSpool>> ResultSpool::Create() {
+  std::FILE* file = std::tmpfile();
+  if (file == nullptr) {
+    return error::Internal("Failed to create result spool file: $0", std::strerror(errno));
+  }
+  return std::unique_ptr<ResultSpool>(new ResultSpool(file));
+}
+
+ResultSpool::~ResultSpool() {
+  if (file_ != nullptr) {
+    std::fclose(file_);
+  }
+}
+
+Status ResultSpool::Append(const carnotpb::TransferResultChunkRequest& req) {
+  PX_ASSIGN_OR_RETURN(auto compressed, zlib::Deflate(req.SerializeAsString()));
+
+  if (std::fseek(file_, write_offset_, SEEK_SET) != 0) {
+    return error::Internal("Failed to seek result spool file: $0", std::strerror(errno));
+  }
+  uint64_t length = compressed.size();
+  if (std::fwrite(&length, sizeof(length), 1, file_) != 1 ||
+      std::fwrite(compressed.data(), 1, compressed.size(), file_) != compressed.size()) {
+    return error::Internal("Failed to write to result spool file: $0", std::strerror(errno));
+  }
+  if (std::fflush(file_) != 0) {
+    return error::Internal("Failed to flush result spool file: $0", std::strerror(errno));
+  }
+
+  write_offset_ += sizeof(length) + compressed.size();
+  ++num_pending_;
+  return Status::OK();
+}
+
+StatusOr<carnotpb::TransferResultChunkRequest> ResultSpool::PopNext() {
+  DCHECK_GT(num_pending_, 0U) << "PopNext called on an empty ResultSpool";
+
+  if (std::fseek(file_, read_offset_, SEEK_SET) != 0) {
+    return error::Internal("Failed to seek result spool file: $0", std::strerror(errno));
+  }
+  uint64_t length = 0;
+  if (std::fread(&length, sizeof(length), 1, file_) != 1) {
+    return error::Internal("Failed to read result spool entry header: $0", std::strerror(errno));
+  }
+  std::string compressed(length, '\0');
+  if (std::fread(compressed.data(), 1, length, file_) != length) {
+    return error::Internal("Failed to read result spool entry: $0", std::strerror(errno));
+  }
+
+  PX_ASSIGN_OR_RETURN(auto serialized, zlib::Inflate(compressed));
+  carnotpb::TransferResultChunkRequest req;
+  if (!req.ParseFromString(serialized)) {
+    return error::Internal("Failed to parse spooled TransferResultChunkRequest");
+  }
+
+  read_offset_ += sizeof(length) + length;
+  --num_pending_;
+  return req;
+}
+
+void ResultSpool::Clear() {
+  read_offset_ = write_offset_;
+  num_pending_ = 0;
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
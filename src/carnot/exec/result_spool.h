@@ -0,0 +1,87 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+#include "src/carnot/carnotpb/carnot.pb.h"
+#include "src/common/base/base.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+/**
+ * ResultSpool is a FIFO of TransferResultChunkRequests backed by an anonymous temporary file,
+ * used by GRPCSinkNode to overflow sealed result batches to disk when a slow client lets the
+ * in-memory write queue fill up. Entries are serialized and gzip-compressed on append, and
+ * decompressed and parsed back on pop, so a large result set costs bounded memory and a fraction
+ * of its wire size on disk while it waits for the client to drain. Like RowBatchSpillFile, the
+ * backing file is anonymous, so its space is reclaimed by the OS even if the process dies
+ * mid-query.
+ *
+ * Appends go to the tail of the file and pops read sequentially from the head. Space from popped
+ * entries is not reclaimed until the spool is destroyed, so SpooledBytes() (the not-yet-drained
+ * bytes) is what callers should bound, not the file size.
+ *
+ * This class is not thread safe; GRPCSinkNode guards it with its write-queue mutex.
+ */
+class ResultSpool : public NotCopyable {
+ public:
+  static StatusOr<std::unique_ptr<ResultSpool>> Create();
+  ~ResultSpool();
+
+  /**
+   * Append compresses and writes the serialized request to the tail of the spool.
+   */
+  Status Append(const carnotpb::TransferResultChunkRequest& req);
+
+  /**
+   * PopNext reads, decompresses and parses the oldest request in the spool. Must not be called
+   * when the spool is Empty().
+   */
+  StatusOr<carnotpb::TransferResultChunkRequest> PopNext();
+
+  /**
+   * Clear drops all pending entries without reading them, e.g. when the receiver hung up.
+   */
+  void Clear();
+
+  bool Empty() const { return num_pending_ == 0; }
+  size_t NumPending() const { return num_pending_; }
+
+  /**
+   * SpooledBytes returns the on-disk bytes of entries that have been appended but not yet popped.
+   */
+  int64_t SpooledBytes() const { return write_offset_ - read_offset_; }
+
+ private:
+  explicit ResultSpool(std::FILE* file) : file_(file) {}
+
+  std::FILE* file_;
+  size_t num_pending_ = 0;
+  int64_t read_offset_ = 0;
+  int64_t write_offset_ = 0;
+};
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/result_spool.h"
+
+#include <gtest/gtest.h>
+
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+namespace {
+
+carnotpb::TransferResultChunkRequest MakeRequest(int64_t source_id) {
+  carnotpb::TransferResultChunkRequest req;
+  req.set_address("localhost:1234");
+  req.mutable_query_result()->set_grpc_source_id(source_id);
+  req.mutable_query_result()->mutable_row_batch()->set_num_rows(source_id);
+  return req;
+}
+
+}  // namespace
+
+TEST(ResultSpoolTest, fifo_round_trip) {
+  ASSERT_OK_AND_ASSIGN(auto spool, ResultSpool::Create());
+  EXPECT_TRUE(spool->Empty());
+  EXPECT_EQ(0, spool->SpooledBytes());
+
+  for (int64_t i = 0; i < 3; ++i) {
+    EXPECT_OK(spool->Append(MakeRequest(i)));
+  }
+  EXPECT_FALSE(spool->Empty());
+  EXPECT_EQ(3, spool->NumPending());
+  EXPECT_GT(spool->SpooledBytes(), 0);
+
+  for (int64_t i = 0; i < 3; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto req, spool->PopNext());
+    EXPECT_EQ(i, req.query_result().grpc_source_id());
+    EXPECT_EQ(i, req.query_result().row_batch().num_rows());
+    EXPECT_EQ("localhost:1234", req.address());
+  }
+  EXPECT_TRUE(spool->Empty());
+  EXPECT_EQ(0, spool->SpooledBytes());
+}
+
+TEST(ResultSpoolTest, interleaved_append_and_pop) {
+  ASSERT_OK_AND_ASSIGN(auto spool, ResultSpool::Create());
+
+  EXPECT_OK(spool->Append(MakeRequest(1)));
+  EXPECT_OK(spool->Append(MakeRequest(2)));
+  ASSERT_OK_AND_ASSIGN(auto req, spool->PopNext());
+  EXPECT_EQ(1, req.query_result().grpc_source_id());
+
+  EXPECT_OK(spool->Append(MakeRequest(3)));
+  ASSERT_OK_AND_ASSIGN(req, spool->PopNext());
+  EXPECT_EQ(2, req.query_result().grpc_source_id());
+  ASSERT_OK_AND_ASSIGN(req, spool->PopNext());
+  EXPECT_EQ(3, req.query_result().grpc_source_id());
+  EXPECT_TRUE(spool->Empty());
+}
+
+TEST(ResultSpoolTest, clear) {
+  ASSERT_OK_AND_ASSIGN(auto spool, ResultSpool::Create());
+
+  EXPECT_OK(spool->Append(MakeRequest(1)));
+  EXPECT_OK(spool->Append(MakeRequest(2)));
+  spool->Clear();
+  EXPECT_TRUE(spool->Empty());
+  EXPECT_EQ(0, spool->SpooledBytes());
+
+  // The spool stays usable after a Clear.
+  EXPECT_OK(spool->Append(MakeRequest(3)));
+  ASSERT_OK_AND_ASSIGN(auto req, spool->PopNext());
+  EXPECT_EQ(3, req.query_result().grpc_source_id());
+  EXPECT_TRUE(spool->Empty());
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
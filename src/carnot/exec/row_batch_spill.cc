@@ -0,0 +1,96 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/row_batch_spill.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+using table_store::schema::RowBatch;
+
+StatusOr<std::unique_ptr<RowBatchSpillFile>> RowBatchSpillFile::Create() {
+  std::FILE* file = std::tmpfile();
+  if (file == nullptr) {
+    return error::Internal("Failed to create spill file: $0", std::strerror(errno));
+  }
+  return std::unique_ptr<RowBatchSpillFile>(new RowBatchSpillFile(file));
+}
+
+RowBatchSpillFile::~RowBatchSpillFile() {
+  if (file_ != nullptr) {
+    std::fclose(file_);
+  }
+}
+
+Status RowBatchSpillFile::Append(const RowBatch& rb) {
+  table_store::schemapb::RowBatchData data;
+  PX_RETURN_IF_ERROR(rb.ToProto(&data));
+  std::string serialized;
+  if (!data.SerializeToString(&serialized)) {
+    return error::Internal("Failed to serialize row batch for spilling");
+  }
+
+  uint64_t size = serialized.size();
+  if (std::fwrite(&size, sizeof(size), 1, file_) != 1 ||
+      std::fwrite(serialized.data(), 1, serialized.size(), file_) != serialized.size()) {
+    return error::Internal("Failed to write to spill file: $0", std::strerror(errno));
+  }
+  ++num_batches_;
+  bytes_written_ += sizeof(size) + serialized.size();
+  return Status::OK();
+}
+
+Status RowBatchSpillFile::Rewind() {
+  if (std::fseek(file_, 0, SEEK_SET) != 0) {
+    return error::Internal("Failed to rewind spill file: $0", std::strerror(errno));
+  }
+  batches_read_ = 0;
+  return Status::OK();
+}
+
+StatusOr<std::unique_ptr<RowBatch>> RowBatchSpillFile::ReadNext() {
+  if (batches_read_ == num_batches_) {
+    return std::unique_ptr<RowBatch>(nullptr);
+  }
+
+  uint64_t size = 0;
+  if (std::fread(&size, sizeof(size), 1, file_) != 1) {
+    return error::Internal("Failed to read spill file record header: $0", std::strerror(errno));
+  }
+  std::string serialized(size, '\0');
+  if (std::fread(serialized.data(), 1, size, file_) != size) {
+    return error::Internal("Failed to read spill file record: $0", std::strerror(errno));
+  }
+
+  table_store::schemapb::RowBatchData data;
+  if (!data.ParseFromString(serialized)) {
+    return error::Internal("Failed to parse spilled row batch");
+  }
+  ++batches_read_;
+  return RowBatch::FromProto(data);
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+#include "src/common/base/base.h"
+#include "src/table_store/table_store.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+/**
+ * RowBatchSpillFile is an append-only scratch file of serialized row batches, used by operators
+ * that fall back to disk when their working set would otherwise exceed a memory budget.
+ *
+ * Batches are stored as length-prefixed RowBatchData protos in an anonymous temporary file, so the
+ * space is reclaimed by the OS even if the process dies mid-query. All appends must happen before
+ * the first Rewind(); after that the file may be rewound and replayed any number of times.
+ */
+class RowBatchSpillFile : public NotCopyable {
+ public:
+  static StatusOr<std::unique_ptr<RowBatchSpillFile>> Create();
+  ~RowBatchSpillFile();
+
+  /**
+   * Appends a row batch to the end of the file.
+   */
+  Status Append(const table_store::schema::RowBatch& rb);
+
+  /**
+   * Resets the read cursor to the first batch.
+   */
+  Status Rewind();
+
+  /**
+   * Reads the next batch, or returns nullptr once every batch has been read.
+   */
+  StatusOr<std::unique_ptr<table_store::schema::RowBatch>> ReadNext();
+
+  int64_t num_batches() const { return num_batches_; }
+  int64_t bytes_written() const { return bytes_written_; }
+
+ private:
+  explicit RowBatchSpillFile(std::FILE* file) : file_(file) {}
+
+  std::FILE* file_;
+  int64_t num_batches_ = 0;
+  int64_t batches_read_ = 0;
+  int64_t bytes_written_ = 0;
+};
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
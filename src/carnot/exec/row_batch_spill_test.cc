@@ -0,0 +1,79 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/row_batch_spill.h"
+
+#include <gtest/gtest.h>
+
+#include "src/carnot/exec/test_utils.h"
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+using table_store::schema::RowDescriptor;
+
+TEST(RowBatchSpillFileTest, append_and_replay) {
+  RowDescriptor rd({types::DataType::INT64, types::DataType::STRING});
+
+  auto rb1 = RowBatchBuilder(rd, 3, /*eow*/ false, /*eos*/ false)
+                 .AddColumn<types::Int64Value>({1, 2, 3})
+                 .AddColumn<types::StringValue>({"a", "b", "c"})
+                 .get();
+  auto rb2 = RowBatchBuilder(rd, 2, /*eow*/ true, /*eos*/ true)
+                 .AddColumn<types::Int64Value>({4, 5})
+                 .AddColumn<types::StringValue>({"d", "e"})
+                 .get();
+
+  ASSERT_OK_AND_ASSIGN(auto spill, RowBatchSpillFile::Create());
+  ASSERT_OK(spill->Append(rb1));
+  ASSERT_OK(spill->Append(rb2));
+  EXPECT_EQ(2, spill->num_batches());
+  EXPECT_GT(spill->bytes_written(), 0);
+
+  // The file can be rewound and replayed multiple times.
+  for (int pass = 0; pass < 2; ++pass) {
+    ASSERT_OK(spill->Rewind());
+
+    ASSERT_OK_AND_ASSIGN(auto out1, spill->ReadNext());
+    ASSERT_NE(out1, nullptr);
+    EXPECT_EQ(out1->num_rows(), rb1.num_rows());
+    for (int64_t i = 0; i < rb1.num_columns(); ++i) {
+      EXPECT_TRUE(rb1.ColumnAt(i)->Equals(out1->ColumnAt(i)));
+    }
+    EXPECT_FALSE(out1->eow());
+    EXPECT_FALSE(out1->eos());
+
+    ASSERT_OK_AND_ASSIGN(auto out2, spill->ReadNext());
+    ASSERT_NE(out2, nullptr);
+    EXPECT_EQ(out2->num_rows(), rb2.num_rows());
+    for (int64_t i = 0; i < rb2.num_columns(); ++i) {
+      EXPECT_TRUE(rb2.ColumnAt(i)->Equals(out2->ColumnAt(i)));
+    }
+    EXPECT_TRUE(out2->eow());
+    EXPECT_TRUE(out2->eos());
+
+    ASSERT_OK_AND_ASSIGN(auto out3, spill->ReadNext());
+    EXPECT_EQ(out3, nullptr);
+  }
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
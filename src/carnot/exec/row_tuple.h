@@ -19,9 +19,9 @@
 #pragma once
 
 #include <arrow/array.h>
-#include <farmhash.h>
 #include <stdint.h>
 #include <string.h>
+#include <xxhash.h>
 
 #include <algorithm>
 #include <iostream>
@@ -81,6 +81,8 @@ struct RowTuple : public NotCopyable {
   void Reset() {
     fixed_values.resize(types->size());
     variable_values.clear();
+    hash_valid_ = false;
+    packed_valid_ = false;
   }
 
   /**
@@ -94,6 +96,15 @@ struct RowTuple : public NotCopyable {
     internal::SetValueHelper<T>(this, idx, val);
   }
 
+  /**
+   * Move overload for string values: the string's buffer is stolen rather than copied.
+   */
+  void SetValue(size_t idx, types::StringValue&& val) {
+    DCHECK_LT(idx, fixed_values.size());
+    SetValue(idx, types::Int64Value(variable_values.size()));
+    variable_values.emplace_back(std::move(val));
+  }
+
   /**
    * Gets the value at the given index with type specified.
    * Will die in debug mode if wrong type is specified.
@@ -117,39 +128,72 @@ struct RowTuple : public NotCopyable {
     DCHECK(CheckSequentialWriteOrder()) << "Variable sized write ordering mismatch";
     DCHECK(other.CheckSequentialWriteOrder()) << "Variable sized write ordering mismatch";
 
-    if (memcmp(fixed_values.data(), other.fixed_values.data(),
-               sizeof(types::FixedSizeValueUnion) * fixed_values.size()) != 0) {
-      // Early exit for failed comparisons.
-      return false;
+    if (variable_values.empty()) {
+      return memcmp(fixed_values.data(), other.fixed_values.data(),
+                    sizeof(types::FixedSizeValueUnion) * fixed_values.size()) == 0;
     }
-    // Do  deep compare of the variable sized values;
-    for (size_t idx = 0; idx < variable_values.size(); ++idx) {
-      // This will invoke the correct operator on the variant.
-      if (variable_values[idx] != other.variable_values[idx]) {
-        return false;
-      }
+    // With variable sized values, equal tuples produce byte-identical packed keys, so a single
+    // memcmp replaces the per-column variant compares.
+    const auto& k1 = PackedKey();
+    const auto& k2 = other.PackedKey();
+    return k1.size() == k2.size() && memcmp(k1.data(), k2.data(), k1.size()) == 0;
+  }
+
+  /**
+   * The tuple serialized into one contiguous buffer: the fixed-width slots inline (string slots
+   * hold their sequence id) followed by each string value length-prefixed. Equal tuples always
+   * produce byte-identical buffers, so the packed key hashes in a single pass and compares with
+   * memcmp. Memoized like the hash; writing a value or calling Reset() invalidates it.
+   */
+  const std::string& PackedKey() const {
+    if (packed_valid_) {
+      return packed_key_;
     }
-    return true;
+    DCHECK(CheckSequentialWriteOrder()) << "Variable sized write ordering mismatch";
+    size_t fixed_bytes = sizeof(types::FixedSizeValueUnion) * fixed_values.size();
+    size_t total_bytes = fixed_bytes;
+    for (const auto& val : variable_values) {
+      // This should be edited when we add support for new variable sized types.
+      DCHECK(std::holds_alternative<types::StringValue>(val));
+      total_bytes += sizeof(uint64_t) + std::get<types::StringValue>(val).size();
+    }
+    packed_key_.clear();
+    packed_key_.reserve(total_bytes);
+    packed_key_.append(reinterpret_cast<const char*>(fixed_values.data()), fixed_bytes);
+    for (const auto& val : variable_values) {
+      const auto& str = std::get<types::StringValue>(val);
+      uint64_t len = str.size();
+      packed_key_.append(reinterpret_cast<const char*>(&len), sizeof(len));
+      packed_key_.append(str.data(), str.size());
+    }
+    packed_valid_ = true;
+    return packed_key_;
   }
 
   /**
-   * Compute the hash of this RowTuple.
+   * Compute the hash of this RowTuple with a single xxhash pass over the packed key.
+   *
+   * The hash is memoized, so repeated calls on an unmodified tuple (e.g. hash map probes after
+   * partition selection) don't recompute it. Writing a value or calling Reset() invalidates the
+   * cached hash.
    *
    * @return the hash results.
    */
   size_t Hash() const {
+    if (hash_valid_) {
+      return hash_;
+    }
     DCHECK(CheckSequentialWriteOrder()) << "Variable sized write ordering mismatch";
-    // For fixed sized data we just hash the stored array.
-    size_t hash = ::util::Hash64(reinterpret_cast<const char*>(fixed_values.data()),
-                                 sizeof(types::FixedSizeValueUnion) * fixed_values.size());
-    // For variable sized data we run the appropriate hash function.
-    for (const auto& val : variable_values) {
-      // This should be edited when we add support for new variable sized types.
-      DCHECK(std::holds_alternative<types::StringValue>(val));
-      hash = ::px::HashCombine(
-          hash, types::utils::hash<types::StringValue>()(std::get<types::StringValue>(val)));
+    if (variable_values.empty()) {
+      // All-fixed-width tuples are already contiguous; hash them in place.
+      hash_ = XXH3_64bits(fixed_values.data(),
+                          sizeof(types::FixedSizeValueUnion) * fixed_values.size());
+    } else {
+      const auto& key = PackedKey();
+      hash_ = XXH3_64bits(key.data(), key.size());
     }
-    return hash;
+    hash_valid_ = true;
+    return hash_;
   }
 
   /**
@@ -185,6 +229,13 @@ struct RowTuple : public NotCopyable {
   // This index is stored as a Int64Value.
   std::vector<types::FixedSizeValueUnion> fixed_values;
   std::vector<VariableSizeValueTypeVariant> variable_values;
+
+  // Memoized result of Hash(). Mutable so the lazily computed hash can be cached on const tuples.
+  mutable size_t hash_ = 0;
+  mutable bool hash_valid_ = false;
+  // Memoized result of PackedKey(); only built for tuples with variable sized values.
+  mutable std::string packed_key_;
+  mutable bool packed_valid_ = false;
 };
 
 namespace internal {
@@ -192,6 +243,8 @@ template <typename T>
 inline void SetValueHelper(RowTuple* rt, size_t idx, const T& val) {
   static_assert(types::ValueTypeTraits<T>::is_fixed_size, "Only fixed size values allowed");
   types::SetValue<T>(&rt->fixed_values[idx], val);
+  rt->hash_valid_ = false;
+  rt->packed_valid_ = false;
 }
 
 template <>
@@ -247,8 +300,14 @@ template <types::DataType DT>
 void ExtractIntoRowTuple(RowTuple* rt, arrow::Array* col, int rt_col_idx, int rt_row_idx) {
   using UDFValueType = typename types::DataTypeTraits<DT>::value_type;
   using ArrowArrayType = typename types::DataTypeTraits<DT>::arrow_array_type;
-  rt->SetValue<UDFValueType>(rt_col_idx,
-                             types::GetValue(static_cast<ArrowArrayType*>(col), rt_row_idx));
+  if constexpr (DT == types::DataType::STRING) {
+    // Move the extracted string into the tuple instead of copying it.
+    auto str = types::GetValue(static_cast<ArrowArrayType*>(col), rt_row_idx);
+    rt->SetValue(rt_col_idx, types::StringValue(std::move(str)));
+  } else {
+    rt->SetValue<UDFValueType>(rt_col_idx,
+                               types::GetValue(static_cast<ArrowArrayType*>(col), rt_row_idx));
+  }
 }
 
 }  // namespace exec
@@ -97,6 +97,21 @@ TEST_F(RowTupleTest, check_equality_func_with_same_types_different_after_reset)
   EXPECT_NE(rt1_.Hash(), rt2_.Hash());
 }
 
+TEST_F(RowTupleTest, hash_invalidated_on_write) {
+  rt0_.SetValue(0, types::Int64Value(1));
+  auto hash1 = rt0_.Hash();
+  // Repeated calls on an unmodified tuple return the memoized hash.
+  EXPECT_EQ(hash1, rt0_.Hash());
+
+  rt0_.SetValue(0, types::Int64Value(2));
+  auto hash2 = rt0_.Hash();
+  EXPECT_NE(hash1, hash2);
+
+  rt0_.Reset();
+  rt0_.SetValue(0, types::Int64Value(1));
+  EXPECT_EQ(hash1, rt0_.Hash());
+}
+
 using RowTupleDeathTest = RowTupleTest;
 
 TEST_F(RowTupleDeathTest, read_wrong_type) {
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/standing_query_registry.h"
+
+#include <chrono>
+#include <utility>
+
+DEFINE_int32(carnot_standing_query_limit,
+             gflags::Int32FromEnv("PL_CARNOT_STANDING_QUERY_LIMIT", 64),
+             "Maximum number of standing queries whose cursors are kept alive between "
+             "executions. The least recently used standing query is evicted beyond this.");
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+namespace {
+int64_t MonotonicNowNS() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+}  // namespace
+
+std::unique_ptr<table_store::Table::Cursor> StandingQueryRegistry::TakeCursor(
+    const std::string& standing_query_key, int64_t node_id, const table_store::Table* table) {
+  std::lock_guard<std::mutex> lock(mu_);
+  auto query = queries_.find(standing_query_key);
+  if (query == queries_.end()) {
+    return nullptr;
+  }
+  query->second.last_used_ns = MonotonicNowNS();
+  auto parked = query->second.cursors_by_node.find(node_id);
+  if (parked == query->second.cursors_by_node.end()) {
+    return nullptr;
+  }
+  auto cursor = std::move(parked->second.cursor);
+  const table_store::Table* parked_table = parked->second.table;
+  query->second.cursors_by_node.erase(parked);
+  if (parked_table != table) {
+    // The table was replaced since the previous execution; the parked position is meaningless.
+    return nullptr;
+  }
+  return cursor;
+}
+
+void StandingQueryRegistry::ParkCursor(const std::string& standing_query_key, int64_t node_id,
+                                       const table_store::Table* table,
+                                       std::unique_ptr<table_store::Table::Cursor> cursor) {
+  std::lock_guard<std::mutex> lock(mu_);
+  auto& query = queries_[standing_query_key];
+  query.last_used_ns = MonotonicNowNS();
+  query.cursors_by_node[node_id] = ParkedCursor{table, std::move(cursor)};
+  EvictLRUBeyondLimit();
+}
+
+size_t StandingQueryRegistry::NumStandingQueries() const {
+  std::lock_guard<std::mutex> lock(mu_);
+  return queries_.size();
+}
+
+void StandingQueryRegistry::EvictLRUBeyondLimit() {
+  while (queries_.size() > static_cast<size_t>(FLAGS_carnot_standing_query_limit)) {
+    auto lru = queries_.begin();
+    for (auto it = queries_.begin(); it != queries_.end(); ++it) {
+      if (it->second.last_used_ns < lru->second.last_used_ns) {
+        lru = it;
+      }
+    }
+    queries_.erase(lru);
+  }
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
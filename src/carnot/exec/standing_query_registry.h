@@ -0,0 +1,91 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <absl/container/flat_hash_map.h>
+
+#include "src/common/base/base.h"
+#include "src/table_store/table/table.h"
+
+DECLARE_int32(carnot_standing_query_limit);
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+/**
+ * StandingQueryRegistry keeps the table cursors of standing queries alive between executions.
+ *
+ * Live views re-submit the same script every few seconds, and each submission otherwise
+ * re-scans its sources from the start time. When a plan carries a standing query key, every
+ * MemorySourceNode parks its cursor here on Close and resumes from the parked position on the
+ * next execution, so only rows added since the previous run are read.
+ *
+ * Parked cursors are keyed by the standing query key and the memory source's plan node id.
+ * Identical scripts compile to identical plans, so node ids are stable across submissions. The
+ * registry holds at most --carnot_standing_query_limit standing queries, evicting the least
+ * recently used beyond that.
+ */
+class StandingQueryRegistry {
+ public:
+  /**
+   * Removes and returns the parked cursor for the given standing query and plan node.
+   * Returns nullptr if no cursor is parked, or if the parked cursor was created against a
+   * different table than the one passed in (e.g. the table was replaced in the table store
+   * since the previous execution), in which case the parked cursor is discarded.
+   */
+  std::unique_ptr<table_store::Table::Cursor> TakeCursor(const std::string& standing_query_key,
+                                                         int64_t node_id,
+                                                         const table_store::Table* table);
+
+  /**
+   * Parks a cursor for the next execution of the standing query.
+   */
+  void ParkCursor(const std::string& standing_query_key, int64_t node_id,
+                  const table_store::Table* table,
+                  std::unique_ptr<table_store::Table::Cursor> cursor);
+
+  size_t NumStandingQueries() const;
+
+ private:
+  struct ParkedCursor {
+    // The table the cursor iterates, recorded so a parked cursor is never resumed against a
+    // different table.
+    const table_store::Table* table;
+    std::unique_ptr<table_store::Table::Cursor> cursor;
+  };
+  struct QueryEntry {
+    absl::flat_hash_map<int64_t, ParkedCursor> cursors_by_node;
+    int64_t last_used_ns = 0;
+  };
+
+  // Must be called with mu_ held.
+  void EvictLRUBeyondLimit();
+
+  mutable std::mutex mu_;
+  absl::flat_hash_map<std::string, QueryEntry> queries_;
+};
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
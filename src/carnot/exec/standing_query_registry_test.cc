@@ -0,0 +1,95 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/standing_query_registry.h"
+
+#include <memory>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "src/common/testing/testing.h"
+#include "src/table_store/table/table.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+using table_store::Table;
+
+class StandingQueryRegistryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    table_store::schema::Relation rel({types::DataType::TIME64NS}, {"time_"});
+    table_ = Table::Create("cpu", rel);
+    other_table_ = Table::Create("http", rel);
+  }
+
+  std::unique_ptr<Table::Cursor> MakeCursor(const Table* table) {
+    return std::make_unique<Table::Cursor>(table);
+  }
+
+  std::shared_ptr<Table> table_;
+  std::shared_ptr<Table> other_table_;
+  StandingQueryRegistry registry_;
+};
+
+TEST_F(StandingQueryRegistryTest, park_and_take_roundtrip) {
+  auto cursor = MakeCursor(table_.get());
+  auto* cursor_ptr = cursor.get();
+  registry_.ParkCursor("live_view", /*node_id*/ 1, table_.get(), std::move(cursor));
+  EXPECT_EQ(1U, registry_.NumStandingQueries());
+
+  auto taken = registry_.TakeCursor("live_view", /*node_id*/ 1, table_.get());
+  EXPECT_EQ(cursor_ptr, taken.get());
+  // A cursor is removed once taken.
+  EXPECT_EQ(nullptr, registry_.TakeCursor("live_view", /*node_id*/ 1, table_.get()));
+}
+
+TEST_F(StandingQueryRegistryTest, take_missing_returns_nullptr) {
+  EXPECT_EQ(nullptr, registry_.TakeCursor("unknown", /*node_id*/ 1, table_.get()));
+  registry_.ParkCursor("live_view", /*node_id*/ 1, table_.get(), MakeCursor(table_.get()));
+  EXPECT_EQ(nullptr, registry_.TakeCursor("live_view", /*node_id*/ 2, table_.get()));
+}
+
+TEST_F(StandingQueryRegistryTest, discards_cursor_for_replaced_table) {
+  registry_.ParkCursor("live_view", /*node_id*/ 1, table_.get(), MakeCursor(table_.get()));
+  // The table was replaced in the table store between executions.
+  EXPECT_EQ(nullptr, registry_.TakeCursor("live_view", /*node_id*/ 1, other_table_.get()));
+  // The stale cursor was discarded, not kept for a later match.
+  EXPECT_EQ(nullptr, registry_.TakeCursor("live_view", /*node_id*/ 1, table_.get()));
+}
+
+TEST_F(StandingQueryRegistryTest, evicts_least_recently_used_beyond_limit) {
+  PX_SET_FOR_SCOPE(FLAGS_carnot_standing_query_limit, 2);
+  registry_.ParkCursor("view_a", /*node_id*/ 1, table_.get(), MakeCursor(table_.get()));
+  registry_.ParkCursor("view_b", /*node_id*/ 1, table_.get(), MakeCursor(table_.get()));
+  // Touch view_a so view_b becomes the least recently used.
+  EXPECT_NE(nullptr, registry_.TakeCursor("view_a", /*node_id*/ 1, table_.get()));
+  registry_.ParkCursor("view_a", /*node_id*/ 1, table_.get(), MakeCursor(table_.get()));
+
+  registry_.ParkCursor("view_c", /*node_id*/ 1, table_.get(), MakeCursor(table_.get()));
+  EXPECT_EQ(2U, registry_.NumStandingQueries());
+  EXPECT_EQ(nullptr, registry_.TakeCursor("view_b", /*node_id*/ 1, table_.get()));
+  EXPECT_NE(nullptr, registry_.TakeCursor("view_a", /*node_id*/ 1, table_.get()));
+  EXPECT_NE(nullptr, registry_.TakeCursor("view_c", /*node_id*/ 1, table_.get()));
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
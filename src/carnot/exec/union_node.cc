@@ -18,6 +18,7 @@
 
 #include "src/carnot/exec/union_node.h"
 
+#include <arrow/array/builder_binary.h>
 #include <arrow/memory_pool.h>
 #include <arrow/status.h>
 #include <algorithm>
@@ -61,6 +62,15 @@ Status UnionNode::InitializeColumnBuilders() {
     column_builders_[i] =
         MakeArrowBuilder(output_descriptor_->type(i), arrow::default_memory_pool());
     PX_RETURN_IF_ERROR(column_builders_[i]->Reserve(output_rows_per_batch_));
+    if (output_descriptor_->type(i) == types::DataType::STRING) {
+      // Size the string data buffer from the rolling bytes-per-row of consumed input batches, so
+      // the common case appends single-copy instead of growing the buffer mid-batch.
+      auto hint = column_size_stats_.ReservationHintBytes(i, output_rows_per_batch_);
+      if (hint > 0) {
+        PX_RETURN_IF_ERROR(
+            static_cast<arrow::StringBuilder*>(column_builders_[i].get())->ReserveData(hint));
+      }
+    }
   }
   return Status::OK();
 }
@@ -78,6 +88,7 @@ Status UnionNode::PrepareImpl(ExecState*) {
     data_columns_.resize(num_parents_, std::vector<arrow::Array*>(num_output_cols));
 
     column_builders_.resize(num_output_cols);
+    column_size_stats_.Init(num_output_cols);
     PX_RETURN_IF_ERROR(InitializeColumnBuilders());
   }
 
@@ -111,19 +122,40 @@ types::Time64NSValue UnionNode::GetTimeAtParentCursor(size_t parent_index) const
                                                         row_cursors_[parent_index]);
 }
 
-Status UnionNode::AppendRow(size_t parent) {
-  auto row = row_cursors_[parent];
+Status UnionNode::AppendRows(size_t parent, size_t num_rows) {
+  size_t start = row_cursors_[parent];
   for (size_t i = 0; i < output_descriptor_->size(); ++i) {
     auto input_col = data_columns_[parent][i];
-#define TYPE_CASE(_dt_)                                    \
-  PX_RETURN_IF_ERROR(table_store::schema::CopyValue<_dt_>( \
-      column_builders_[i].get(), types::GetValueFromArrowArray<_dt_>(input_col, row)));
+    // Dispatch the column type once per run instead of once per row.
+#define TYPE_CASE(_dt_)                                        \
+  for (size_t row = start; row < start + num_rows; ++row) {    \
+    PX_RETURN_IF_ERROR(table_store::schema::CopyValue<_dt_>(   \
+        column_builders_[i].get(),                             \
+        types::GetValueFromArrowArray<_dt_>(input_col, row))); \
+  }
     PX_SWITCH_FOREACH_DATATYPE(output_descriptor_->type(i), TYPE_CASE);
 #undef TYPE_CASE
   }
   return Status::OK();
 }
 
+StatusOr<std::unique_ptr<RowBatch>> UnionNode::SliceRun(size_t parent, size_t offset,
+                                                        size_t num_rows) {
+  const RowBatch& input_rb = parent_row_batches_[parent][0];
+  auto output_rb = std::make_unique<RowBatch>(*output_descriptor_, num_rows);
+  for (size_t i = 0; i < output_descriptor_->size(); ++i) {
+    auto col = GetInputColumn(input_rb, parent, i);
+    // Share the refcounted array directly when the run spans the whole input batch; otherwise
+    // take an arrow slice, which is a view over the same buffers rather than a copy.
+    if (offset == 0 && static_cast<int64_t>(num_rows) == col->length()) {
+      PX_RETURN_IF_ERROR(output_rb->AddColumn(col));
+    } else {
+      PX_RETURN_IF_ERROR(output_rb->AddColumn(col->Slice(offset, num_rows)));
+    }
+  }
+  return output_rb;
+}
+
 // Flush the row batch if we have waited too long between row batches.
 Status UnionNode::OptionallyFlushRowBatchIfTimeout(ExecState* exec_state) {
   if (!enable_data_flush_timeout_) {
@@ -171,66 +203,108 @@ Status UnionNode::FlushBatch(ExecState* exec_state) {
 
 Status UnionNode::MergeData(ExecState* exec_state) {
   while (!sent_eos_) {
-    // Get the smallest time out of all of the current streams.
-    std::vector<size_t> parent_streams;
-    parent_streams.reserve(row_cursors_.size());
-
+    // Find the two streams with the smallest current times. Only the winner and the runner-up
+    // matter for a merge run, so a single O(num_parents) scan replaces sorting all streams.
+    // Iterating in increasing parent order with strict comparisons keeps ties stable with
+    // respect to input parent index.
+    int64_t winner = -1;
+    int64_t runner_up = -1;
+    bool all_flushed = true;
     for (size_t parent = 0; parent < row_cursors_.size(); ++parent) {
       if (flushed_parent_eoses_[parent]) {
         continue;
       }
+      all_flushed = false;
       // If we lack necessary data, we can't merge anymore.
       if (!parent_row_batches_[parent].size()) {
         return Status::OK();
       }
-      parent_streams.push_back(parent);
+      if (winner == -1) {
+        winner = parent;
+        continue;
+      }
+      auto time = GetTimeAtParentCursor(parent);
+      if (time < GetTimeAtParentCursor(winner)) {
+        runner_up = winner;
+        winner = parent;
+      } else if (runner_up == -1 || time < GetTimeAtParentCursor(runner_up)) {
+        runner_up = parent;
+      }
     }
 
     // If we have reached end of stream for all of our inputs, flush the queue.
-    if (!parent_streams.size()) {
+    if (all_flushed) {
       return OptionallyFlushRowBatchIfMaxRowsOrEOS(exec_state);
     }
 
-    std::sort(parent_streams.begin(), parent_streams.end(),
-              [this](size_t parent_a, size_t parent_b) {
-                auto time_a = GetTimeAtParentCursor(parent_a);
-                auto time_b = GetTimeAtParentCursor(parent_b);
-                return time_a < time_b || (time_a == time_b && parent_a < parent_b);
-              });
-
-    bool has_limit = parent_streams.size() > 1;
-    size_t parent = parent_streams[0];
-
+    size_t parent = winner;
     while (parent_row_batches_[parent].size()) {
-      if (has_limit) {
-        size_t next_parent = parent_streams[1];
+      size_t batch_rows = parent_row_batches_[parent][0].num_rows();
+      // End of the mergeable run within the current batch, exclusive.
+      size_t run_end = batch_rows;
+      if (runner_up != -1) {
+        auto cursor_time = GetTimeAtParentCursor(parent);
+        auto runner_up_time = GetTimeAtParentCursor(runner_up);
         // If this time is greater than another parent stream's earliest time,
-        // or if they are the same but the first parent is at a smaller index, stop merging.
+        // or if they are the same but the other parent is at a smaller index, stop merging.
         // This way rows are always stable with respect to input parent index.
-        if (GetTimeAtParentCursor(parent) > GetTimeAtParentCursor(next_parent) ||
-            (GetTimeAtParentCursor(parent) == GetTimeAtParentCursor(next_parent) &&
-             parent > next_parent)) {
+        if (cursor_time > runner_up_time ||
+            (cursor_time == runner_up_time && parent > static_cast<size_t>(runner_up))) {
           break;
         }
+        // The batch's times are sorted, so binary search for how far the run extends instead of
+        // re-checking the runner-up after every row. When the whole batch precedes the runner-up
+        // this copies it wholesale.
+        if (parent < static_cast<size_t>(runner_up)) {
+          run_end = types::SearchArrowArrayLessThanOrEqual<types::TIME64NS>(
+                        time_columns_[parent], runner_up_time.val) +
+                    1;
+        } else {
+          auto geq_idx = types::SearchArrowArrayGreaterThanOrEqual<types::TIME64NS>(
+              time_columns_[parent], runner_up_time.val);
+          run_end = geq_idx == -1 ? batch_rows : static_cast<size_t>(geq_idx);
+        }
       }
 
-      PX_RETURN_IF_ERROR(AppendRow(parent));
+      // Append the run, capped at the output batch boundary so flush cadence is unchanged.
+      size_t capacity = output_rows_per_batch_ - column_builders_[0]->length();
+      size_t num_rows = std::min(run_end - row_cursors_[parent], capacity);
+      // When the run lines up with an entire empty output batch, forward it as a zero-copy slice
+      // of the input batch instead of copying every row through the column builders. The emitted
+      // batch has exactly the rows and boundaries the builder path would have produced. The slice
+      // must be taken before the input batch is potentially popped below.
+      const bool emit_run_zero_copy =
+          column_builders_[0]->length() == 0 && num_rows == output_rows_per_batch_;
+      std::unique_ptr<RowBatch> run_rb;
+      if (emit_run_zero_copy) {
+        PX_ASSIGN_OR_RETURN(run_rb, SliceRun(parent, row_cursors_[parent], num_rows));
+      } else {
+        PX_RETURN_IF_ERROR(AppendRows(parent, num_rows));
+      }
+      row_cursors_[parent] += num_rows;
 
       // Mark whether or not we hit the eos for this stream, and whether the row batch needs to be
       // popped.
-      const auto& rb = parent_row_batches_[parent][0];
-      bool pop_row_batch = ++row_cursors_[parent] == static_cast<size_t>(rb.num_rows());
-      if (pop_row_batch && rb.eos()) {
-        flushed_parent_eoses_[parent] = true;
-      }
-
+      bool pop_row_batch = row_cursors_[parent] == batch_rows;
       if (pop_row_batch) {
+        if (parent_row_batches_[parent][0].eos()) {
+          flushed_parent_eoses_[parent] = true;
+        }
         // Delete the top row batch from our buffer and update the cursor.
         parent_row_batches_[parent].erase(parent_row_batches_[parent].begin());
         row_cursors_[parent] = 0;
         CacheNextRowBatch(parent);
       }
 
+      if (emit_run_zero_copy) {
+        const bool eos = InputsComplete();
+        run_rb->set_eow(eos);
+        run_rb->set_eos(eos);
+        last_data_flush_time_ = std::chrono::system_clock::now();
+        PX_RETURN_IF_ERROR(SendRowBatchToChildren(exec_state, *run_rb));
+        continue;
+      }
+
       // Flush the current RowBatch if necessary.
       PX_RETURN_IF_ERROR(OptionallyFlushRowBatchIfMaxRowsOrEOS(exec_state));
     }
@@ -259,6 +333,11 @@ void UnionNode::CacheNextRowBatch(size_t parent) {
 
 Status UnionNode::ConsumeNextOrdered(ExecState* exec_state, const RowBatch& rb,
                                      size_t parent_index) {
+  for (size_t i = 0; i < output_descriptor_->size(); ++i) {
+    if (output_descriptor_->type(i) == types::DataType::STRING) {
+      column_size_stats_.UpdateStringColumn(i, *GetInputColumn(rb, parent_index, i));
+    }
+  }
   parent_row_batches_[parent_index].push_back(rb);
   CacheNextRowBatch(parent_index);
   PX_RETURN_IF_ERROR(MergeData(exec_state));
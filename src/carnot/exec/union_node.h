@@ -32,6 +32,7 @@
 #include "src/common/base/base.h"
 #include "src/common/base/status.h"
 #include "src/shared/types/types.h"
+#include "src/table_store/schema/rolling_size_stats.h"
 #include "src/table_store/table_store.h"
 
 namespace px {
@@ -91,7 +92,9 @@ class UnionNode : public ProcessingNode {
   void CacheNextRowBatch(size_t parent);
   Status InitializeColumnBuilders();
   types::Time64NSValue GetTimeAtParentCursor(size_t parent_index) const;
-  Status AppendRow(size_t parent);
+  Status AppendRows(size_t parent, size_t num_rows);
+  StatusOr<std::unique_ptr<table_store::schema::RowBatch>> SliceRun(size_t parent, size_t offset,
+                                                                    size_t num_rows);
   Status OptionallyFlushRowBatchIfMaxRowsOrEOS(ExecState* exec_state);
   Status OptionallyFlushRowBatchIfTimeout(ExecState* exec_state);
   Status FlushBatch(ExecState* exec_state);
@@ -103,6 +106,9 @@ class UnionNode : public ProcessingNode {
 
   // Column builders will flush a batch once they hit output_rows_per_batch_ rows.
   std::vector<std::unique_ptr<arrow::ArrayBuilder>> column_builders_;
+  // Rolling bytes-per-row of consumed string columns, used to preallocate the string data buffers
+  // of freshly initialized column builders.
+  table_store::schema::RollingColumnSizeStats column_size_stats_;
 
   // Hold onto the input row batches for every parent until we copy all of their data.
   std::vector<std::vector<table_store::schema::RowBatch>> parent_row_batches_;
@@ -508,6 +508,53 @@ TEST_F(UnionNodeTest, end_on_empty_rb) {
       .Close();
 }
 
+// Once one parent hits eos, a run from the remaining parent that lines up exactly with an empty
+// output batch is forwarded as a zero-copy slice of the input batch. The output must be
+// indistinguishable from the row-copying builder path, including batch boundaries and eos.
+TEST_F(UnionNodeTest, ordered_full_batch_run) {
+  auto op_proto = planpb::testutils::CreateTestUnionOrderedPB();
+  plan_node_ = plan::UnionOperator::FromProto(op_proto, /*id*/ 1);
+  RowDescriptor input_rd_0({types::DataType::STRING, types::DataType::TIME64NS});
+  RowDescriptor input_rd_1({types::DataType::TIME64NS, types::DataType::STRING});
+  RowDescriptor output_rd({types::DataType::STRING, types::DataType::TIME64NS});
+
+  auto tester = exec::ExecNodeTester<UnionNode, plan::UnionOperator>(
+      *plan_node_, output_rd, {input_rd_0, input_rd_1}, exec_state_.get());
+  tester.node()->disable_data_flush_timeout();
+
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd_1, 0, /*eow*/ true, /*eos*/ true)
+                       .AddColumn<types::Time64NSValue>({})
+                       .AddColumn<types::StringValue>({})
+                       .get(),
+                   1, 0)
+      // Exactly rows_per_batch (5) rows: the whole batch is forwarded without copying.
+      .ConsumeNext(RowBatchBuilder(input_rd_0, 5, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<types::StringValue>({"A", "B", "C", "D", "E"})
+                       .AddColumn<types::Time64NSValue>({1, 2, 3, 4, 5})
+                       .get(),
+                   0, 1)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 5, false, false)
+                          .AddColumn<types::StringValue>({"A", "B", "C", "D", "E"})
+                          .AddColumn<types::Time64NSValue>({1, 2, 3, 4, 5})
+                          .get())
+      // 7 rows: the first 5 go out as a zero-copy slice, the remaining 2 through the builders.
+      .ConsumeNext(RowBatchBuilder(input_rd_0, 7, /*eow*/ true, /*eos*/ true)
+                       .AddColumn<types::StringValue>({"F", "G", "H", "I", "J", "K", "L"})
+                       .AddColumn<types::Time64NSValue>({6, 7, 8, 9, 10, 11, 12})
+                       .get(),
+                   0, 2)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 5, false, false)
+                          .AddColumn<types::StringValue>({"F", "G", "H", "I", "J"})
+                          .AddColumn<types::Time64NSValue>({6, 7, 8, 9, 10})
+                          .get())
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 2, true, true)
+                          .AddColumn<types::StringValue>({"K", "L"})
+                          .AddColumn<types::Time64NSValue>({11, 12})
+                          .get())
+      .Close();
+}
+
 TEST_F(UnionNodeTest, ordered_timeout_not_hit) {
   auto op_proto = planpb::testutils::CreateTestUnionOrderedPB();
   plan_node_ = plan::UnionOperator::FromProto(op_proto, /*id*/ 1);
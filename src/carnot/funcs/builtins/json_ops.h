@@ -18,10 +18,14 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#define TBB_PREVIEW_CONCURRENT_LRU_CACHE 1
+#include "tbb/concurrent_lru_cache.h"
+
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
@@ -33,24 +37,64 @@ namespace px {
 namespace carnot {
 namespace builtins {
 
+namespace internal {
+
+// Sized to comfortably cover a row batch, so that a map plucking several fields from the same
+// JSON column parses each document once for the first pluck expression and the remaining
+// expressions hit the cache on their pass over the batch.
+constexpr size_t kParsedJSONLRUCacheSize = 4096;
+
+inline std::shared_ptr<const rapidjson::Document> ParseJSONDoc(const std::string& in) {
+  auto d = std::make_shared<rapidjson::Document>();
+  d->Parse(in.c_str());
+  return d;
+}
+
+/**
+ * Process-wide LRU cache of parsed JSON documents keyed by the document string.
+ * The pluck UDFs each used to parse the full document per row, so extracting N fields parsed
+ * the same document N times. Documents that fail to parse are cached too (with their parse
+ * error set), since scripts repeatedly plucking from a malformed column pay the parse attempt
+ * each time otherwise. The bound is an entry count rather than bytes, which mirrors the other
+ * builtin caches; parsed documents live only as long as their LRU slot or an in-flight use.
+ */
+class ParsedJSONCache {
+ public:
+  static ParsedJSONCache& GetInstance() {
+    static ParsedJSONCache cache;
+    return cache;
+  }
+
+  std::shared_ptr<const rapidjson::Document> Lookup(const std::string& in) {
+    return cache_[in].value();
+  }
+
+ private:
+  ParsedJSONCache()
+      : cache_([](std::string in) { return ParseJSONDoc(in); }, kParsedJSONLRUCacheSize) {}
+
+  tbb::concurrent_lru_cache<std::string, std::shared_ptr<const rapidjson::Document>> cache_;
+};
+
+}  // namespace internal
+
 // TODO(zasgar): PL-419 To have proper support for JSON we need structs and nullable types.
 // Revisit when we have them.
 class PluckUDF : public udf::ScalarUDF {
  public:
   StringValue Exec(FunctionContext*, StringValue in, StringValue key) {
-    rapidjson::Document d;
-    rapidjson::ParseResult ok = d.Parse(in.data());
+    auto d = internal::ParsedJSONCache::GetInstance().Lookup(in);
     // TODO(zasgar/michellenguyen, PP-419): Replace with null when available.
-    if (ok == nullptr) {
+    if (d->HasParseError()) {
       return "";
     }
-    if (!d.IsObject()) {
+    if (!d->IsObject()) {
       return "";
     }
-    if (!d.HasMember(key.data())) {
+    if (!d->HasMember(key.data())) {
       return "";
     }
-    const auto& plucked_value = d[key.data()];
+    const auto& plucked_value = (*d)[key.data()];
     if (plucked_value.IsNull()) {
       return "";
     }
@@ -87,19 +131,18 @@ class PluckUDF : public udf::ScalarUDF {
 class PluckAsInt64UDF : public udf::ScalarUDF {
  public:
   Int64Value Exec(FunctionContext*, StringValue in, StringValue key) {
-    rapidjson::Document d;
-    rapidjson::ParseResult ok = d.Parse(in.data());
+    auto d = internal::ParsedJSONCache::GetInstance().Lookup(in);
     // TODO(zasgar/michellenguyen, PP-419): Replace with null when available.
-    if (ok == nullptr) {
+    if (d->HasParseError()) {
       return 0;
     }
-    if (!d.IsObject()) {
+    if (!d->IsObject()) {
       return 0;
     }
-    if (!d.HasMember(key.data())) {
+    if (!d->HasMember(key.data())) {
       return 0;
     }
-    const auto& plucked_value = d[key.data()];
+    const auto& plucked_value = (*d)[key.data()];
     if (plucked_value.IsNull()) {
       return 0;
     }
@@ -131,19 +174,18 @@ class PluckAsInt64UDF : public udf::ScalarUDF {
 class PluckAsFloat64UDF : public udf::ScalarUDF {
  public:
   Float64Value Exec(FunctionContext*, StringValue in, StringValue key) {
-    rapidjson::Document d;
-    rapidjson::ParseResult ok = d.Parse(in.data());
+    auto d = internal::ParsedJSONCache::GetInstance().Lookup(in);
     // TODO(zasgar/michellenguyen, PP-419): Replace with null when available.
-    if (ok == nullptr) {
+    if (d->HasParseError()) {
       return 0.0;
     }
-    if (!d.IsObject()) {
+    if (!d->IsObject()) {
       return 0.0;
     }
-    if (!d.HasMember(key.data())) {
+    if (!d->HasMember(key.data())) {
       return 0.0;
     }
-    const auto& plucked_value = d[key.data()];
+    const auto& plucked_value = (*d)[key.data()];
     if (plucked_value.IsNull()) {
       return 0.0;
     }
@@ -178,16 +220,15 @@ class PluckAsFloat64UDF : public udf::ScalarUDF {
 class PluckArrayUDF : public udf::ScalarUDF {
  public:
   StringValue Exec(FunctionContext*, StringValue in, Int64Value index) {
-    rapidjson::Document d;
-    rapidjson::ParseResult ok = d.Parse(in.data());
+    auto d = internal::ParsedJSONCache::GetInstance().Lookup(in);
     // TODO(zasgar/michellenguyen, PP-419): Replace with null when available.
-    if (ok == nullptr) {
+    if (d->HasParseError()) {
       return "";
     }
-    if (!d.IsArray()) {
+    if (!d->IsArray()) {
       return "";
     }
-    const auto& plucked_array = d.GetArray();
+    const auto& plucked_array = d->GetArray();
     if (index < 0 || index >= plucked_array.Size()) {
       return "";
     }
@@ -60,6 +60,19 @@ TEST(JSONOps, PluckUDF_non_object_input_return_empty) {
   udf_tester.ForInput("[\"asdad\"]", "str_key").Expect("");
 }
 
+TEST(JSONOps, ParsedJSONCache_shares_documents_across_lookups) {
+  auto& cache = internal::ParsedJSONCache::GetInstance();
+  // Plucking several keys from the same document string reuses one parsed document.
+  auto first = cache.Lookup(kTestJSONStr);
+  auto second = cache.Lookup(kTestJSONStr);
+  EXPECT_EQ(first.get(), second.get());
+  EXPECT_FALSE(first->HasParseError());
+
+  // Malformed documents are cached with their parse error intact.
+  auto invalid = cache.Lookup("{not json");
+  EXPECT_TRUE(invalid->HasParseError());
+}
+
 TEST(JSONOps, PluckAsInt64UDF) {
   auto udf_tester = udf::UDFTester<PluckAsInt64UDF>();
   udf_tester.ForInput(kTestJSONStr, "str_key").Expect(0);
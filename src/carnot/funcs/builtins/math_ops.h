@@ -35,6 +35,13 @@ template <typename TReturn, typename TArg1 = TReturn, typename TArg2 = TReturn>
 class AddUDF : public udf::ScalarUDF {
  public:
   TReturn Exec(FunctionContext*, TArg1 b1, TArg2 b2) { return b1.val + b2.val; }
+  Status ExecBatch(FunctionContext*, size_t count, TReturn* out, const TArg1* b1,
+                   const TArg2* b2) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = b1[i].val + b2[i].val;
+    }
+    return Status::OK();
+  }
   static udf::InfRuleVec SemanticInferenceRules() {
     return {
         udf::InheritTypeFromArgs<AddUDF>::Create({types::ST_BYTES, types::ST_THROUGHPUT_PER_NS,
@@ -60,6 +67,13 @@ template <typename TReturn, typename TArg1 = TReturn, typename TArg2 = TReturn>
 class SubtractUDF : public udf::ScalarUDF {
  public:
   TReturn Exec(FunctionContext*, TArg1 b1, TArg2 b2) { return b1.val - b2.val; }
+  Status ExecBatch(FunctionContext*, size_t count, TReturn* out, const TArg1* b1,
+                   const TArg2* b2) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = b1[i].val - b2[i].val;
+    }
+    return Status::OK();
+  }
   static udf::InfRuleVec SemanticInferenceRules() {
     return {
         udf::InheritTypeFromArgs<SubtractUDF>::Create({types::ST_BYTES, types::ST_THROUGHPUT_PER_NS,
@@ -88,6 +102,13 @@ class DivideUDF : public udf::ScalarUDF {
   types::Float64Value Exec(FunctionContext*, TArg1 b1, TArg2 b2) {
     return static_cast<double>(b1.val) / static_cast<double>(b2.val);
   }
+  Status ExecBatch(FunctionContext*, size_t count, types::Float64Value* out, const TArg1* b1,
+                   const TArg2* b2) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = static_cast<double>(b1[i].val) / static_cast<double>(b2[i].val);
+    }
+    return Status::OK();
+  }
 
   static udf::InfRuleVec SemanticInferenceRules() {
     return {udf::ExplicitRule::Create<DivideUDF>(types::ST_THROUGHPUT_PER_NS,
@@ -113,6 +134,13 @@ template <typename TReturn, typename TArg1 = TReturn, typename TArg2 = TReturn>
 class MultiplyUDF : public udf::ScalarUDF {
  public:
   TReturn Exec(FunctionContext*, TArg1 b1, TArg2 b2) { return b1.val * b2.val; }
+  Status ExecBatch(FunctionContext*, size_t count, TReturn* out, const TArg1* b1,
+                   const TArg2* b2) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = b1[i].val * b2[i].val;
+    }
+    return Status::OK();
+  }
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Multiplies the arguments.")
         .Details("Multiplies the two values together. Accessible using the `*` operator syntax.")
@@ -266,6 +294,13 @@ template <typename TArg1, typename TArg2 = TArg1>
 class LogicalOrUDF : public udf::ScalarUDF {
  public:
   BoolValue Exec(FunctionContext*, TArg1 b1, TArg2 b2) { return b1.val || b2.val; }
+  Status ExecBatch(FunctionContext*, size_t count, BoolValue* out, const TArg1* b1,
+                   const TArg2* b2) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = b1[i].val || b2[i].val;
+    }
+    return Status::OK();
+  }
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Boolean ORs the passed in values.")
         .Example(R"doc(# Implicit call.
@@ -285,6 +320,13 @@ template <typename TArg1, typename TArg2 = TArg1>
 class LogicalAndUDF : public udf::ScalarUDF {
  public:
   BoolValue Exec(FunctionContext*, TArg1 b1, TArg2 b2) { return b1.val && b2.val; }
+  Status ExecBatch(FunctionContext*, size_t count, BoolValue* out, const TArg1* b1,
+                   const TArg2* b2) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = b1[i].val && b2[i].val;
+    }
+    return Status::OK();
+  }
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Boolean ANDs the passed in values.")
         .Example(R"doc(# Implicit call.
@@ -302,6 +344,12 @@ template <typename TArg1>
 class LogicalNotUDF : public udf::ScalarUDF {
  public:
   BoolValue Exec(FunctionContext*, TArg1 b1) { return !b1.val; }
+  Status ExecBatch(FunctionContext*, size_t count, BoolValue* out, const TArg1* b1) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = !b1[i].val;
+    }
+    return Status::OK();
+  }
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Boolean NOTs the passed in value.")
         .Example(R"doc(# Implicit call.
@@ -318,6 +366,12 @@ template <typename TArg1>
 class NegateUDF : public udf::ScalarUDF {
  public:
   TArg1 Exec(FunctionContext*, TArg1 b1) { return -b1.val; }
+  Status ExecBatch(FunctionContext*, size_t count, TArg1* out, const TArg1* b1) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = -b1[i].val;
+    }
+    return Status::OK();
+  }
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Negates the passed in value.")
         .Example(R"doc(# Implicit call.
@@ -374,6 +428,13 @@ template <typename TArg1, typename TArg2 = TArg1>
 class EqualUDF : public udf::ScalarUDF {
  public:
   BoolValue Exec(FunctionContext*, TArg1 b1, TArg2 b2) { return b1 == b2; }
+  Status ExecBatch(FunctionContext*, size_t count, BoolValue* out, const TArg1* b1,
+                   const TArg2* b2) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = b1[i] == b2[i];
+    }
+    return Status::OK();
+  }
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Returns whether the values are equal.")
         .Details(
@@ -394,6 +455,13 @@ template <typename TArg1, typename TArg2 = TArg1>
 class NotEqualUDF : public udf::ScalarUDF {
  public:
   BoolValue Exec(FunctionContext*, TArg1 b1, TArg2 b2) { return b1 != b2; }
+  Status ExecBatch(FunctionContext*, size_t count, BoolValue* out, const TArg1* b1,
+                   const TArg2* b2) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = b1[i] != b2[i];
+    }
+    return Status::OK();
+  }
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Returns whether the values are not equal.")
         .Details(
@@ -439,6 +507,13 @@ template <typename TArg1, typename TArg2 = TArg1>
 class GreaterThanUDF : public udf::ScalarUDF {
  public:
   BoolValue Exec(FunctionContext*, TArg1 b1, TArg2 b2) { return b1 > b2; }
+  Status ExecBatch(FunctionContext*, size_t count, BoolValue* out, const TArg1* b1,
+                   const TArg2* b2) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = b1[i] > b2[i];
+    }
+    return Status::OK();
+  }
 
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder(
@@ -458,6 +533,13 @@ template <typename TArg1, typename TArg2 = TArg1>
 class GreaterThanEqualUDF : public udf::ScalarUDF {
  public:
   BoolValue Exec(FunctionContext*, TArg1 b1, TArg2 b2) { return b1 >= b2; }
+  Status ExecBatch(FunctionContext*, size_t count, BoolValue* out, const TArg1* b1,
+                   const TArg2* b2) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = b1[i] >= b2[i];
+    }
+    return Status::OK();
+  }
 
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder(
@@ -478,6 +560,13 @@ template <typename TArg1, typename TArg2 = TArg1>
 class LessThanUDF : public udf::ScalarUDF {
  public:
   BoolValue Exec(FunctionContext*, TArg1 b1, TArg2 b2) { return b1 < b2; }
+  Status ExecBatch(FunctionContext*, size_t count, BoolValue* out, const TArg1* b1,
+                   const TArg2* b2) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = b1[i] < b2[i];
+    }
+    return Status::OK();
+  }
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Returns which value is less than the other.")
         .Example(R"doc(# Implict call.
@@ -494,6 +583,13 @@ template <typename TArg1, typename TArg2 = TArg1>
 class LessThanEqualUDF : public udf::ScalarUDF {
  public:
   BoolValue Exec(FunctionContext*, TArg1 b1, TArg2 b2) { return b1 <= b2; }
+  Status ExecBatch(FunctionContext*, size_t count, BoolValue* out, const TArg1* b1,
+                   const TArg2* b2) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = b1[i] <= b2[i];
+    }
+    return Status::OK();
+  }
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Returns which value is less than or equal to the the other.")
         .Example(R"doc(
@@ -514,6 +610,16 @@ template <typename TReturn, typename TArg1 = TReturn, typename TArg2 = TReturn>
 class BinUDF : public udf::ScalarUDF {
  public:
   TReturn Exec(FunctionContext*, TArg1 b1, TArg2 b2) { return b1.val - (b1.val % b2.val); }
+  // Time-bucketing maps run this over every row of every dashboard query, so process whole
+  // columns per call. The simple integer loop auto-vectorizes when the compiler can prove the
+  // bin width constant.
+  Status ExecBatch(FunctionContext*, size_t count, TReturn* out, const TArg1* b1,
+                   const TArg2* b2) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = b1[i].val - (b1[i].val % b2[i].val);
+    }
+    return Status::OK();
+  }
   static udf::ScalarUDFDocBuilder Doc() { return BinDoc(); }
 };
 
@@ -524,6 +630,13 @@ class BinUDF<TReturn, types::Float64Value, TArg2> : public udf::ScalarUDF {
   TReturn Exec(FunctionContext*, Float64Value b1, Int64Value b2) {
     return static_cast<int64_t>(b1.val) - (static_cast<int64_t>(b1.val) % b2.val);
   }
+  Status ExecBatch(FunctionContext*, size_t count, TReturn* out, const Float64Value* b1,
+                   const Int64Value* b2) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = static_cast<int64_t>(b1[i].val) - (static_cast<int64_t>(b1[i].val) % b2[i].val);
+    }
+    return Status::OK();
+  }
   static udf::ScalarUDFDocBuilder Doc() { return BinDoc(); }
 };
 
@@ -552,6 +665,12 @@ class RoundUDF : public udf::ScalarUDF {
 class TimeToInt64UDF : public udf::ScalarUDF {
  public:
   Int64Value Exec(FunctionContext*, Time64NSValue value) { return value.val; }
+  Status ExecBatch(FunctionContext*, size_t count, Int64Value* out, const Time64NSValue* value) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = value[i].val;
+    }
+    return Status::OK();
+  }
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Converts a time value to an int64 value")
         .Details(
@@ -568,6 +687,12 @@ class TimeToInt64UDF : public udf::ScalarUDF {
 class Int64ToTimeUDF : public udf::ScalarUDF {
  public:
   Time64NSValue Exec(FunctionContext*, Int64Value value) { return value.val; }
+  Status ExecBatch(FunctionContext*, size_t count, Time64NSValue* out, const Int64Value* value) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = value[i].val;
+    }
+    return Status::OK();
+  }
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Converts a int64 value to a time")
         .Details(
@@ -23,6 +23,8 @@
 
 #include "src/carnot/funcs/builtins/math_ops.h"
 #include "src/carnot/udf/test_utils.h"
+#include "src/carnot/udf/udf_wrapper.h"
+#include "src/shared/types/column_wrapper.h"
 #include "src/common/base/base.h"
 #include "src/common/testing/testing.h"
 
@@ -635,6 +637,80 @@ TEST(MathOps, partial_count_test) {
   auto uda_tester = udf::UDATester<CountUDA<types::Int64Value>>();
   uda_tester.ForInput(3).ForInput(6).ForInput(10).ForInput(5).ForInput(2).Expect(5);
 }
+
+TEST(MathOps, vectorized_add_batch_matches_exec) {
+  using TUDF = AddUDF<types::Int64Value>;
+  static_assert(udf::ScalarUDFTraits<TUDF>::HasExecBatch());
+
+  auto ctx = udf::FunctionContext(nullptr, nullptr);
+  TUDF udf;
+  types::Int64ValueColumnWrapper v1({1, 2, 3});
+  types::Int64ValueColumnWrapper v2({3, 4, 5});
+  types::Int64ValueColumnWrapper out(v1.Size());
+  EXPECT_OK(udf::ScalarUDFWrapper<TUDF>::ExecBatch(&udf, &ctx, {&v1, &v2}, &out, v1.Size()));
+  for (size_t i = 0; i < v1.Size(); ++i) {
+    EXPECT_EQ(udf.Exec(&ctx, v1[i], v2[i]).val, out[i].val);
+  }
+}
+
+TEST(MathOps, vectorized_bin_batch_matches_exec) {
+  using TUDF = BinUDF<types::Time64NSValue, types::Time64NSValue, types::Int64Value>;
+  static_assert(udf::ScalarUDFTraits<TUDF>::HasExecBatch());
+
+  auto ctx = udf::FunctionContext(nullptr, nullptr);
+  TUDF udf;
+  types::Time64NSValueColumnWrapper v1({11, 29, 30});
+  types::Int64ValueColumnWrapper v2({10, 10, 10});
+  types::Time64NSValueColumnWrapper out(v1.Size());
+  EXPECT_OK(udf::ScalarUDFWrapper<TUDF>::ExecBatch(&udf, &ctx, {&v1, &v2}, &out, v1.Size()));
+  for (size_t i = 0; i < v1.Size(); ++i) {
+    EXPECT_EQ(udf.Exec(&ctx, v1[i], v2[i]).val, out[i].val);
+  }
+}
+
+TEST(MathOps, vectorized_float_bin_batch_matches_exec) {
+  using TUDF = BinUDF<types::Int64Value, types::Float64Value, types::Int64Value>;
+  static_assert(udf::ScalarUDFTraits<TUDF>::HasExecBatch());
+
+  auto ctx = udf::FunctionContext(nullptr, nullptr);
+  TUDF udf;
+  types::Float64ValueColumnWrapper v1({11.5, 29.2, 30.0});
+  types::Int64ValueColumnWrapper v2({10, 10, 10});
+  types::Int64ValueColumnWrapper out(v1.Size());
+  EXPECT_OK(udf::ScalarUDFWrapper<TUDF>::ExecBatch(&udf, &ctx, {&v1, &v2}, &out, v1.Size()));
+  for (size_t i = 0; i < v1.Size(); ++i) {
+    EXPECT_EQ(udf.Exec(&ctx, v1[i], v2[i]).val, out[i].val);
+  }
+}
+
+TEST(MathOps, vectorized_time_conversion_batch_matches_exec) {
+  static_assert(udf::ScalarUDFTraits<TimeToInt64UDF>::HasExecBatch());
+  static_assert(udf::ScalarUDFTraits<Int64ToTimeUDF>::HasExecBatch());
+
+  auto ctx = udf::FunctionContext(nullptr, nullptr);
+  TimeToInt64UDF udf;
+  types::Time64NSValueColumnWrapper v1({0, 1, 123456789});
+  types::Int64ValueColumnWrapper out(v1.Size());
+  EXPECT_OK(udf::ScalarUDFWrapper<TimeToInt64UDF>::ExecBatch(&udf, &ctx, {&v1}, &out, v1.Size()));
+  for (size_t i = 0; i < v1.Size(); ++i) {
+    EXPECT_EQ(udf.Exec(&ctx, v1[i]).val, out[i].val);
+  }
+}
+
+TEST(MathOps, vectorized_less_than_batch_matches_exec) {
+  using TUDF = LessThanUDF<types::Float64Value>;
+  static_assert(udf::ScalarUDFTraits<TUDF>::HasExecBatch());
+
+  auto ctx = udf::FunctionContext(nullptr, nullptr);
+  TUDF udf;
+  types::Float64ValueColumnWrapper v1({1.5, 4.0, 3.2});
+  types::Float64ValueColumnWrapper v2({2.5, 4.0, 1.2});
+  types::BoolValueColumnWrapper out(v1.Size());
+  EXPECT_OK(udf::ScalarUDFWrapper<TUDF>::ExecBatch(&udf, &ctx, {&v1, &v2}, &out, v1.Size()));
+  for (size_t i = 0; i < v1.Size(); ++i) {
+    EXPECT_EQ(udf.Exec(&ctx, v1[i], v2[i]).val, out[i].val);
+  }
+}
 }  // namespace builtins
 }  // namespace carnot
 }  // namespace px
@@ -16,6 +16,12 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "src/carnot/funcs/builtins/math_sketches.h"
@@ -27,6 +33,7 @@ namespace builtins {
 void RegisterMathSketchesOrDie(udf::Registry* registry) {
   registry->RegisterOrDie<QuantilesUDA<types::Int64Value>>("quantiles");
   registry->RegisterOrDie<QuantilesUDA<types::Float64Value>>("quantiles");
+  registry->RegisterOrDie<HeavyHittersUDA>("topk");
 }
 
 void WriteCentroidArray(rapidjson::Writer<rapidjson::StringBuffer>* writer,
@@ -52,6 +59,273 @@ std::vector<tdigest::Centroid> CentroidArrayFromJSON(const rapidjson::Value& val
   return centroids;
 }
 
+namespace {
+
+template <typename T>
+void AppendRaw(std::string* out, T val) {
+  out->append(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+
+template <typename T>
+bool ReadRaw(std::string_view* data, T* out) {
+  if (data->size() < sizeof(T)) {
+    return false;
+  }
+  std::memcpy(out, data->data(), sizeof(T));
+  data->remove_prefix(sizeof(T));
+  return true;
+}
+
+void AppendCentroids(std::string* out, const std::vector<tdigest::Centroid>& centroids) {
+  AppendRaw<uint64_t>(out, centroids.size());
+  for (const auto& c : centroids) {
+    AppendRaw<double>(out, c.mean());
+    AppendRaw<double>(out, c.weight());
+  }
+}
+
+bool ReadCentroids(std::string_view* data, std::vector<tdigest::Centroid>* centroids) {
+  uint64_t count;
+  if (!ReadRaw(data, &count)) {
+    return false;
+  }
+  // Reject truncated or corrupt payloads before reserving based on the claimed count.
+  if (count > data->size() / (2 * sizeof(double))) {
+    return false;
+  }
+  centroids->reserve(count);
+  for (uint64_t i = 0; i < count; ++i) {
+    double mean;
+    double weight;
+    if (!ReadRaw(data, &mean) || !ReadRaw(data, &weight)) {
+      return false;
+    }
+    centroids->emplace_back(mean, weight);
+  }
+  return true;
+}
+
+StatusOr<tdigest::TDigest> TDigestFromBinary(const types::StringValue& data) {
+  std::string_view remaining(data);
+  remaining.remove_prefix(1);
+
+  double compression;
+  uint64_t max_unprocessed;
+  uint64_t max_processed;
+  std::vector<tdigest::Centroid> processed;
+  std::vector<tdigest::Centroid> unprocessed;
+  if (!ReadRaw(&remaining, &compression) || !ReadRaw(&remaining, &max_unprocessed) ||
+      !ReadRaw(&remaining, &max_processed) || !ReadCentroids(&remaining, &processed) ||
+      !ReadCentroids(&remaining, &unprocessed)) {
+    return error::InvalidArgument("invalid serialized tdigest");
+  }
+  return tdigest::TDigest(std::move(processed), std::move(unprocessed), compression,
+                          max_unprocessed, max_processed);
+}
+
+StatusOr<tdigest::TDigest> TDigestFromLegacyJSON(const types::StringValue& json) {
+  rapidjson::Document d;
+  rapidjson::ParseResult ok = d.Parse(json.data());
+  if (ok == nullptr) {
+    return error::InvalidArgument("invalid serialized tdigest");
+  }
+  auto processed = CentroidArrayFromJSON(d[kTDigestProcessedKey]);
+  auto unprocessed = CentroidArrayFromJSON(d[kTDigestUnprocessedKey]);
+  return tdigest::TDigest(std::move(processed), std::move(unprocessed),
+                          d[kTDigestCompressionKey].GetDouble(),
+                          d[kTDigestMaxUnprocessedKey].GetUint64(),
+                          d[kTDigestMaxProcessedKey].GetUint64());
+}
+
+}  // namespace
+
+types::StringValue SerializeTDigestBinary(const tdigest::TDigest& digest) {
+  const auto& processed = digest.processed();
+  const auto& unprocessed = digest.unprocessed();
+  std::string out;
+  out.reserve(1 + sizeof(double) + 4 * sizeof(uint64_t) +
+              2 * sizeof(double) * (processed.size() + unprocessed.size()));
+  out.push_back(kTDigestBinaryFormatVersion);
+  AppendRaw<double>(&out, digest.compression());
+  AppendRaw<uint64_t>(&out, digest.maxUnprocessed());
+  AppendRaw<uint64_t>(&out, digest.maxProcessed());
+  AppendCentroids(&out, processed);
+  AppendCentroids(&out, unprocessed);
+  return out;
+}
+
+void HeavyHittersUDA::AddCount(std::string val, uint64_t count, uint64_t error) {
+  auto it = counters_.find(val);
+  if (it != counters_.end()) {
+    it->second.count += count;
+    it->second.error += error;
+    return;
+  }
+  if (counters_.size() < kNumCounters) {
+    counters_.emplace(std::move(val), Counter{count, error});
+    return;
+  }
+  // Space-saving eviction: replace the minimum counter. The newcomer inherits its count, which
+  // becomes part of the newcomer's error bound, since it could have occurred that often before
+  // being tracked.
+  auto min_it = counters_.begin();
+  for (auto i = counters_.begin(); i != counters_.end(); ++i) {
+    if (i->second.count < min_it->second.count) {
+      min_it = i;
+    }
+  }
+  uint64_t min_count = min_it->second.count;
+  counters_.erase(min_it);
+  counters_.emplace(std::move(val), Counter{min_count + count, min_count + error});
+}
+
+uint64_t HeavyHittersUDA::MinCount() const {
+  if (counters_.size() < kNumCounters) {
+    return 0;
+  }
+  uint64_t min_count = std::numeric_limits<uint64_t>::max();
+  for (const auto& [val, entry] : counters_) {
+    min_count = std::min(min_count, entry.count);
+  }
+  return min_count;
+}
+
+std::vector<std::pair<std::string, HeavyHittersUDA::Counter>> HeavyHittersUDA::SortedCounters()
+    const {
+  std::vector<std::pair<std::string, Counter>> sorted(counters_.begin(), counters_.end());
+  std::sort(sorted.begin(), sorted.end(),
+            [](const auto& a, const auto& b) { return a.second.count > b.second.count; });
+  return sorted;
+}
+
+void HeavyHittersUDA::Merge(FunctionContext*, const HeavyHittersUDA& other) {
+  uint64_t this_min = MinCount();
+  uint64_t other_min = other.MinCount();
+
+  // A value absent from one summary could have occurred up to that summary's minimum count
+  // times without being tracked, so absent values inherit that minimum as both count and error.
+  // This keeps every merged count an overestimate with a valid error bound.
+  absl::flat_hash_map<std::string, Counter> merged;
+  merged.reserve(counters_.size() + other.counters_.size());
+  for (const auto& [val, entry] : counters_) {
+    auto other_it = other.counters_.find(val);
+    if (other_it != other.counters_.end()) {
+      merged.emplace(val, Counter{entry.count + other_it->second.count,
+                                  entry.error + other_it->second.error});
+    } else {
+      merged.emplace(val, Counter{entry.count + other_min, entry.error + other_min});
+    }
+  }
+  for (const auto& [val, entry] : other.counters_) {
+    if (counters_.contains(val)) {
+      continue;
+    }
+    merged.emplace(val, Counter{entry.count + this_min, entry.error + this_min});
+  }
+
+  counters_ = std::move(merged);
+  if (counters_.size() <= kNumCounters) {
+    return;
+  }
+  // Keep the heaviest kNumCounters values.
+  auto sorted = SortedCounters();
+  counters_.clear();
+  for (size_t i = 0; i < kNumCounters; ++i) {
+    counters_.emplace(std::move(sorted[i].first), sorted[i].second);
+  }
+}
+
+types::StringValue HeavyHittersUDA::Finalize(FunctionContext*) {
+  auto sorted = SortedCounters();
+  if (sorted.size() > kTopK) {
+    sorted.resize(kTopK);
+  }
+  rapidjson::StringBuffer sb;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+  writer.StartArray();
+  for (const auto& [val, entry] : sorted) {
+    writer.StartObject();
+    writer.Key("value");
+    writer.String(val.data(), val.size());
+    writer.Key("count");
+    writer.Uint64(entry.count);
+    writer.Key("error");
+    writer.Uint64(entry.error);
+    writer.EndObject();
+  }
+  writer.EndArray();
+  return sb.GetString();
+}
+
+types::StringValue HeavyHittersUDA::Serialize(FunctionContext*) {
+  // Binary wire format, like the t-digest partials: arbitrary byte strings don't survive a JSON
+  // round trip. A version byte, the counter count, then (length, bytes, count, error) per value.
+  std::string out;
+  size_t total_bytes = 1 + sizeof(uint64_t);
+  for (const auto& [val, entry] : counters_) {
+    total_bytes += sizeof(uint64_t) * 3 + val.size();
+  }
+  out.reserve(total_bytes);
+  out.push_back(kHeavyHittersBinaryFormatVersion);
+  AppendRaw<uint64_t>(&out, counters_.size());
+  for (const auto& [val, entry] : counters_) {
+    AppendRaw<uint64_t>(&out, val.size());
+    out.append(val);
+    AppendRaw<uint64_t>(&out, entry.count);
+    AppendRaw<uint64_t>(&out, entry.error);
+  }
+  return out;
+}
+
+Status HeavyHittersUDA::Deserialize(FunctionContext*, const StringValue& data) {
+  if (data.empty() || data[0] != kHeavyHittersBinaryFormatVersion) {
+    return error::InvalidArgument("invalid serialized heavy hitters summary");
+  }
+  std::string_view remaining(data);
+  remaining.remove_prefix(1);
+
+  uint64_t num_counters;
+  if (!ReadRaw(&remaining, &num_counters)) {
+    return error::InvalidArgument("invalid serialized heavy hitters summary");
+  }
+  // Reject corrupt payloads before reserving based on the claimed count.
+  if (num_counters > kNumCounters || num_counters * 3 * sizeof(uint64_t) > remaining.size()) {
+    return error::InvalidArgument("invalid serialized heavy hitters summary");
+  }
+
+  absl::flat_hash_map<std::string, Counter> counters;
+  counters.reserve(num_counters);
+  for (uint64_t i = 0; i < num_counters; ++i) {
+    uint64_t len;
+    if (!ReadRaw(&remaining, &len) || len > remaining.size()) {
+      return error::InvalidArgument("invalid serialized heavy hitters summary");
+    }
+    std::string val(remaining.substr(0, len));
+    remaining.remove_prefix(len);
+    Counter entry;
+    if (!ReadRaw(&remaining, &entry.count) || !ReadRaw(&remaining, &entry.error)) {
+      return error::InvalidArgument("invalid serialized heavy hitters summary");
+    }
+    counters.emplace(std::move(val), entry);
+  }
+  counters_ = std::move(counters);
+  return Status::OK();
+}
+
+StatusOr<tdigest::TDigest> TDigestFromSerialized(const types::StringValue& data) {
+  if (data.empty()) {
+    return error::InvalidArgument("invalid serialized tdigest");
+  }
+  if (data[0] == '{') {
+    return TDigestFromLegacyJSON(data);
+  }
+  if (data[0] != kTDigestBinaryFormatVersion) {
+    return error::InvalidArgument("unknown serialized tdigest format version: $0",
+                                  static_cast<int>(data[0]));
+  }
+  return TDigestFromBinary(data);
+}
+
 }  // namespace builtins
 }  // namespace carnot
 }  // namespace px
@@ -20,10 +20,14 @@
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
+
 #include "src/carnot/udf/registry.h"
+#include "src/common/base/base.h"
 #include "src/common/base/error.h"
 #include "src/shared/types/types.h"
 #include "tdigest/tdigest.h"
@@ -37,15 +41,47 @@ void WriteCentroidArray(rapidjson::Writer<rapidjson::StringBuffer>* writer,
 
 std::vector<tdigest::Centroid> CentroidArrayFromJSON(const rapidjson::Value& val);
 
+// Version tag of the binary t-digest wire format. It doubles as the format discriminator in
+// TDigestFromSerialized: legacy JSON payloads always start with '{'.
+constexpr char kTDigestBinaryFormatVersion = 1;
+
+// Keys of the legacy JSON wire format, retained so partial aggregates produced by older agents
+// still deserialize during a rolling upgrade.
+constexpr char kTDigestProcessedKey[] = "0";
+constexpr char kTDigestUnprocessedKey[] = "1";
+constexpr char kTDigestCompressionKey[] = "2";
+constexpr char kTDigestMaxUnprocessedKey[] = "3";
+constexpr char kTDigestMaxProcessedKey[] = "4";
+
+// Serializes a t-digest into the compact binary wire format: a version byte, the digest
+// parameters, and the raw centroid (mean, weight) doubles. This is ~5x smaller than the legacy
+// JSON encoding and avoids the number formatting/parsing cost on both ends of the
+// partial-aggregate transfer.
+types::StringValue SerializeTDigestBinary(const tdigest::TDigest& digest);
+
+// Reconstructs a t-digest from a serialized partial aggregate, accepting both the binary format
+// and the legacy JSON format.
+StatusOr<tdigest::TDigest> TDigestFromSerialized(const types::StringValue& data);
+
 // TODO(zasgar): PL-419 Replace this when we add support for structs.
 template <typename TArg>
 class QuantilesUDA : public udf::UDA {
  public:
   QuantilesUDA() : digest_(1000) {}
   void Update(FunctionContext*, TArg val) { digest_.add(val.val); }
-  void Merge(FunctionContext*, const QuantilesUDA& other) { digest_.merge(&other.digest_); }
+
+  // Merging a partial aggregate only copies its centroids into a preallocated buffer; the digest
+  // folds the buffer in with a single merge once it fills up (or at finalize/serialize time).
+  // Kelvin merges thousands of PEM partials per window, so batching amortizes the sort/compress
+  // pass inside tdigest across many partials instead of paying it per Merge call.
+  void Merge(FunctionContext*, const QuantilesUDA& other) {
+    BufferCentroids(other.digest_.processed());
+    BufferCentroids(other.digest_.unprocessed());
+    BufferCentroids(other.merge_buffer_);
+  }
 
   StringValue Finalize(FunctionContext*) {
+    FlushMergeBuffer();
     rapidjson::Document d;
     d.SetObject();
     d.AddMember("p01", digest_.quantile(0.01), d.GetAllocator());
@@ -61,43 +97,14 @@ class QuantilesUDA : public udf::UDA {
     return sb.GetString();
   }
 
-  static constexpr char kProcessedKey[] = "0";
-  static constexpr char kUnprocessedKey[] = "1";
-  static constexpr char kCompressionKey[] = "2";
-  static constexpr char kMaxUnprocessedKey[] = "3";
-  static constexpr char kMaxProcessedKey[] = "4";
-
   StringValue Serialize(FunctionContext*) {
-    rapidjson::StringBuffer sb;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
-    writer.StartObject();
-    writer.Key(kProcessedKey);
-    WriteCentroidArray(&writer, digest_.processed());
-    writer.Key(kUnprocessedKey);
-    WriteCentroidArray(&writer, digest_.unprocessed());
-    writer.Key(kCompressionKey);
-    writer.Double(digest_.compression());
-    writer.Key(kMaxUnprocessedKey);
-    writer.Uint64(digest_.maxUnprocessed());
-    writer.Key(kMaxProcessedKey);
-    writer.Uint64(digest_.maxProcessed());
-    writer.EndObject();
-    return sb.GetString();
+    FlushMergeBuffer();
+    return SerializeTDigestBinary(digest_);
   }
 
-  Status Deserialize(FunctionContext*, const StringValue& json) {
-    rapidjson::Document d;
-    rapidjson::ParseResult ok = d.Parse(json.data());
-    if (ok == nullptr) {
-      return error::InvalidArgument("invalid serialized tdigest");
-    }
-    auto processed = CentroidArrayFromJSON(d[kProcessedKey]);
-    auto unprocessed = CentroidArrayFromJSON(d[kUnprocessedKey]);
-    auto compression = d[kCompressionKey].GetDouble();
-    auto maxUnprocessed = d[kMaxUnprocessedKey].GetUint64();
-    auto maxProcessed = d[kMaxProcessedKey].GetUint64();
-    digest_ = tdigest::TDigest(std::move(processed), std::move(unprocessed), compression,
-                               maxUnprocessed, maxProcessed);
+  Status Deserialize(FunctionContext*, const StringValue& data) {
+    PX_ASSIGN_OR_RETURN(digest_, TDigestFromSerialized(data));
+    merge_buffer_.clear();
     return Status::OK();
   }
 
@@ -127,6 +134,103 @@ class QuantilesUDA : public udf::UDA {
 
  protected:
   tdigest::TDigest digest_;
+
+ private:
+  // Flush threshold for the merge buffer. Sized so that a flush covers a few hundred partial
+  // aggregates' worth of centroids while keeping the buffer footprint small (~32KiB).
+  static constexpr size_t kMergeBufferCentroids = 2048;
+
+  void BufferCentroids(const std::vector<tdigest::Centroid>& centroids) {
+    if (centroids.empty()) {
+      return;
+    }
+    if (merge_buffer_.capacity() == 0) {
+      merge_buffer_.reserve(kMergeBufferCentroids);
+    }
+    merge_buffer_.insert(merge_buffer_.end(), centroids.begin(), centroids.end());
+    if (merge_buffer_.size() >= kMergeBufferCentroids) {
+      FlushMergeBuffer();
+    }
+  }
+
+  void FlushMergeBuffer() {
+    if (merge_buffer_.empty()) {
+      return;
+    }
+    // Hand the buffered centroids to a scratch digest as its unprocessed set (with headroom so
+    // the constructor doesn't compress them) and fold the whole batch in with one merge.
+    auto batch_size = merge_buffer_.size();
+    tdigest::TDigest batch(std::vector<tdigest::Centroid>(), std::move(merge_buffer_),
+                           digest_.compression(), batch_size + 1, digest_.maxProcessed());
+    digest_.merge(&batch);
+    merge_buffer_.clear();
+    merge_buffer_.reserve(kMergeBufferCentroids);
+  }
+
+  std::vector<tdigest::Centroid> merge_buffer_;
+};
+
+// Version tag of the binary heavy-hitters wire format.
+constexpr char kHeavyHittersBinaryFormatVersion = 1;
+
+/**
+ * Approximate heavy hitters (top values by count) via the space-saving algorithm.
+ *
+ * Tracks at most kNumCounters values regardless of input cardinality, so each partial aggregate
+ * uses O(k) memory instead of memory proportional to the number of distinct values. Every
+ * reported count is an overestimate of the true count by at most the reported error, and any
+ * value whose true count exceeds N / kNumCounters is guaranteed to be tracked. Partial
+ * aggregates merge by inflating values absent from one side by that side's minimum count (the
+ * standard mergeable-summaries construction), which preserves both bounds.
+ */
+class HeavyHittersUDA : public udf::UDA {
+ public:
+  void Update(FunctionContext*, StringValue val) { AddCount(std::move(val), 1, 0); }
+
+  void Merge(FunctionContext*, const HeavyHittersUDA& other);
+
+  // Returns the top values as a JSON array of {value, count, error} objects, sorted by
+  // descending count and capped at kTopK entries.
+  StringValue Finalize(FunctionContext*);
+
+  StringValue Serialize(FunctionContext*);
+
+  Status Deserialize(FunctionContext*, const StringValue& data);
+
+  static udf::UDADocBuilder Doc() {
+    return udf::UDADocBuilder("Approximates the most frequent values of the aggregated data.")
+        .Details(
+            "Tracks the heaviest values of a high-cardinality column in constant memory using "
+            "the space-saving algorithm. Returns a serialized JSON array of objects, sorted by "
+            "descending count, where each object has the keys `value`, `count` and `error`. "
+            "The true count of each value lies between `count - error` and `count`.")
+        .Example(R"doc(
+        | # Approximate the most requested endpoints.
+        | df = df.agg(top_endpoints=('req_path', px.topk))
+        )doc")
+        .Arg("val", "The data to find the most frequent values of.")
+        .Returns("The top values with approximate counts, serialized as a JSON array.");
+  }
+
+ private:
+  struct Counter {
+    uint64_t count = 0;
+    uint64_t error = 0;
+  };
+
+  // Number of tracked values; bounds the count error at N / kNumCounters.
+  static constexpr size_t kNumCounters = 256;
+  // Number of entries reported by Finalize.
+  static constexpr size_t kTopK = 25;
+
+  void AddCount(std::string val, uint64_t count, uint64_t error);
+  // The summary's minimum tracked count, or 0 while it still has free slots. Untracked values
+  // can have occurred at most this many times.
+  uint64_t MinCount() const;
+  // Tracked values sorted by descending count.
+  std::vector<std::pair<std::string, Counter>> SortedCounters() const;
+
+  absl::flat_hash_map<std::string, Counter> counters_;
 };
 
 void RegisterMathSketchesOrDie(udf::Registry* registry);
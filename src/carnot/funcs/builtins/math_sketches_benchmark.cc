@@ -0,0 +1,142 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "src/carnot/funcs/builtins/math_sketches.h"
+
+namespace px {
+namespace carnot {
+namespace builtins {
+
+namespace {
+
+tdigest::TDigest MakeDigest(size_t num_samples) {
+  std::mt19937 gen(42);
+  // Latency-shaped input: mostly small values with a long tail.
+  std::exponential_distribution<double> dist(1.0 / 100.0);
+  tdigest::TDigest digest(1000);
+  for (size_t i = 0; i < num_samples; ++i) {
+    digest.add(dist(gen));
+  }
+  return digest;
+}
+
+// The JSON wire format that predates SerializeTDigestBinary, kept here as the baseline.
+std::string SerializeTDigestLegacyJSON(const tdigest::TDigest& digest) {
+  rapidjson::StringBuffer sb;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+  writer.StartObject();
+  writer.Key(kTDigestProcessedKey);
+  WriteCentroidArray(&writer, digest.processed());
+  writer.Key(kTDigestUnprocessedKey);
+  WriteCentroidArray(&writer, digest.unprocessed());
+  writer.Key(kTDigestCompressionKey);
+  writer.Double(digest.compression());
+  writer.Key(kTDigestMaxUnprocessedKey);
+  writer.Uint64(digest.maxUnprocessed());
+  writer.Key(kTDigestMaxProcessedKey);
+  writer.Uint64(digest.maxProcessed());
+  writer.EndObject();
+  return sb.GetString();
+}
+
+}  // namespace
+
+// NOLINTNEXTLINE : runtime/references.
+static void BM_TDigestSerializeLegacyJSON(benchmark::State& state) {
+  auto digest = MakeDigest(state.range(0));
+  size_t serialized_size = SerializeTDigestLegacyJSON(digest).size();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SerializeTDigestLegacyJSON(digest));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(serialized_size) *
+                          static_cast<int64_t>(state.iterations()));
+}
+
+// NOLINTNEXTLINE : runtime/references.
+static void BM_TDigestSerializeBinary(benchmark::State& state) {
+  auto digest = MakeDigest(state.range(0));
+  size_t serialized_size = SerializeTDigestBinary(digest).size();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SerializeTDigestBinary(digest));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(serialized_size) *
+                          static_cast<int64_t>(state.iterations()));
+}
+
+// NOLINTNEXTLINE : runtime/references.
+static void BM_TDigestDeserializeLegacyJSON(benchmark::State& state) {
+  types::StringValue serialized = SerializeTDigestLegacyJSON(MakeDigest(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(TDigestFromSerialized(serialized));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(serialized.size()) *
+                          static_cast<int64_t>(state.iterations()));
+}
+
+// NOLINTNEXTLINE : runtime/references.
+static void BM_TDigestDeserializeBinary(benchmark::State& state) {
+  types::StringValue serialized = SerializeTDigestBinary(MakeDigest(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(TDigestFromSerialized(serialized));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(serialized.size()) *
+                          static_cast<int64_t>(state.iterations()));
+}
+
+// Models the Kelvin side of a window: deserialize each PEM partial aggregate and merge it into
+// the accumulator, then finalize.
+// NOLINTNEXTLINE : runtime/references.
+static void BM_QuantilesMergePartials(benchmark::State& state) {
+  constexpr size_t kSamplesPerPartial = 256;
+  std::vector<types::StringValue> partials;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    QuantilesUDA<types::Float64Value> partial;
+    std::mt19937 gen(i);
+    std::exponential_distribution<double> dist(1.0 / 100.0);
+    for (size_t j = 0; j < kSamplesPerPartial; ++j) {
+      partial.Update(nullptr, dist(gen));
+    }
+    partials.push_back(partial.Serialize(nullptr));
+  }
+  for (auto _ : state) {
+    QuantilesUDA<types::Float64Value> merged;
+    for (const auto& serialized : partials) {
+      QuantilesUDA<types::Float64Value> partial;
+      PX_CHECK_OK(partial.Deserialize(nullptr, serialized));
+      merged.Merge(nullptr, partial);
+    }
+    benchmark::DoNotOptimize(merged.Finalize(nullptr));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.range(0)) *
+                          static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_TDigestSerializeLegacyJSON)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_TDigestSerializeBinary)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_TDigestDeserializeLegacyJSON)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_TDigestDeserializeBinary)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_QuantilesMergePartials)->RangeMultiplier(4)->Range(64, 4096);
+
+}  // namespace builtins
+}  // namespace carnot
+}  // namespace px
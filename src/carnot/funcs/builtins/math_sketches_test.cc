@@ -76,19 +76,49 @@ TEST(MathSketches, quantiles_int64) {
 TEST(MathSketches, quantiles_serialize) {
   auto uda_tester = udf::UDATester<QuantilesUDA<types::Float64Value>>();
   auto serialized = uda_tester.ForInput(1).Serialize();
+  EXPECT_EQ(kTDigestBinaryFormatVersion, serialized[0]);
+  // A single input sits in the unprocessed set as one centroid: a version byte, the compression
+  // double, the two digest size parameters, the two centroid counts, and one (mean, weight) pair.
+  EXPECT_EQ(1 + sizeof(double) + 4 * sizeof(uint64_t) + 2 * sizeof(double), serialized.size());
+  // The other bytes are opaque internals to tdigest; roundtrip behavior is covered by
+  // quantiles_serde.
+}
+
+TEST(MathSketches, quantiles_deserialize_legacy_json) {
+  // Partial aggregates from agents predating the binary format arrive as JSON; they must still
+  // deserialize during a rolling upgrade.
+  constexpr char kLegacySerialized[] =
+      R"({"0":[],"1":[[2.0,1.0],[4.0,1.0]],"2":1000.0,"3":8000,"4":2000})";
+  auto uda_tester = udf::UDATester<QuantilesUDA<types::Float64Value>>();
+  EXPECT_OK(uda_tester.Deserialize(kLegacySerialized));
+  auto res = uda_tester.Result();
   rapidjson::Document d;
-  d.Parse(serialized.data());
-  const auto& processed = d[QuantilesUDA<types::Float64Value>::kProcessedKey];
-  EXPECT_TRUE(processed.IsArray());
-  EXPECT_EQ(0, processed.GetArray().Size());
-  const auto& unprocessed = d[QuantilesUDA<types::Float64Value>::kUnprocessedKey];
-  EXPECT_EQ(1, unprocessed.GetArray().Size());
-  const auto& first_centroid = unprocessed.GetArray()[0].GetArray();
-  EXPECT_EQ(2, first_centroid.Size());
-  EXPECT_EQ(1.0, first_centroid[0].GetDouble());
-  EXPECT_EQ(1.0, first_centroid[1].GetDouble());
-  // The other members of the serialized json are opaque internals to tdigest, so we don't test
-  // those here.
+  d.Parse(res.data());
+  EXPECT_DOUBLE_EQ(d["p01"].GetDouble(), 2.0);
+  EXPECT_DOUBLE_EQ(d["p99"].GetDouble(), 4.0);
+}
+
+TEST(MathSketches, quantiles_deserialize_rejects_corrupt_input) {
+  auto uda_tester = udf::UDATester<QuantilesUDA<types::Float64Value>>();
+  EXPECT_NOT_OK(uda_tester.Deserialize(""));
+  EXPECT_NOT_OK(uda_tester.Deserialize("\x07garbage"));
+  // A binary payload truncated mid-header must not deserialize.
+  auto serialized = udf::UDATester<QuantilesUDA<types::Float64Value>>().ForInput(1).Serialize();
+  EXPECT_NOT_OK(uda_tester.Deserialize(serialized.substr(0, serialized.size() / 2)));
+}
+
+TEST(MathSketches, quantiles_merge_many_partials) {
+  // Merge enough partials to force the centroid merge buffer to flush mid-stream.
+  auto merged = udf::UDATester<QuantilesUDA<types::Float64Value>>();
+  for (int i = 1; i <= 4096; ++i) {
+    auto partial = udf::UDATester<QuantilesUDA<types::Float64Value>>();
+    partial.ForInput(static_cast<double>(i));
+    merged.Merge(&partial);
+  }
+  rapidjson::Document d;
+  d.Parse(merged.Result().data());
+  EXPECT_NEAR(d["p50"].GetDouble(), 2048, 10);
+  EXPECT_NEAR(d["p99"].GetDouble(), 4055, 10);
 }
 
 TEST(MathSketches, quantiles_serde) {
@@ -108,6 +138,87 @@ TEST(MathSketches, quantiles_serde) {
   EXPECT_EQ(res_before_serde, res_after_serde);
 }
 
+TEST(MathSketches, topk_exact_for_small_cardinality) {
+  auto uda_tester = udf::UDATester<HeavyHittersUDA>();
+  for (int i = 0; i < 5; ++i) {
+    uda_tester.ForInput("/api/users");
+  }
+  for (int i = 0; i < 3; ++i) {
+    uda_tester.ForInput("/api/orders");
+  }
+  uda_tester.ForInput("/healthz");
+
+  rapidjson::Document d;
+  d.Parse(uda_tester.Result().data());
+  ASSERT_TRUE(d.IsArray());
+  ASSERT_EQ(3u, d.Size());
+  // Small cardinality fits in the counter budget, so counts are exact with zero error.
+  EXPECT_STREQ("/api/users", d[0]["value"].GetString());
+  EXPECT_EQ(5, d[0]["count"].GetUint64());
+  EXPECT_EQ(0, d[0]["error"].GetUint64());
+  EXPECT_STREQ("/api/orders", d[1]["value"].GetString());
+  EXPECT_EQ(3, d[1]["count"].GetUint64());
+  EXPECT_STREQ("/healthz", d[2]["value"].GetString());
+  EXPECT_EQ(1, d[2]["count"].GetUint64());
+}
+
+TEST(MathSketches, topk_tracks_heavy_hitters_past_capacity) {
+  auto uda_tester = udf::UDATester<HeavyHittersUDA>();
+  // A heavy value mixed into a stream of 10000 distinct light values, far past the counter
+  // budget. The heavy hitter must survive with its count bounded by the reported error.
+  for (int i = 0; i < 10000; ++i) {
+    uda_tester.ForInput(absl::Substitute("/unique/$0", i));
+    if (i % 10 == 0) {
+      uda_tester.ForInput("/api/hot");
+    }
+  }
+
+  rapidjson::Document d;
+  d.Parse(uda_tester.Result().data());
+  ASSERT_TRUE(d.IsArray());
+  ASSERT_GT(d.Size(), 0u);
+  EXPECT_STREQ("/api/hot", d[0]["value"].GetString());
+  uint64_t count = d[0]["count"].GetUint64();
+  uint64_t error = d[0]["error"].GetUint64();
+  EXPECT_GE(count, 1000);          // Counts never underestimate by more than the error...
+  EXPECT_LE(count - error, 1000);  // ...and overestimate by at most the error.
+}
+
+TEST(MathSketches, topk_merge_partials) {
+  auto merged = udf::UDATester<HeavyHittersUDA>();
+  for (int p = 0; p < 4; ++p) {
+    auto partial = udf::UDATester<HeavyHittersUDA>();
+    for (int i = 0; i < 7; ++i) {
+      partial.ForInput("/api/hot");
+    }
+    partial.ForInput(absl::Substitute("/partial/$0", p));
+    merged.Merge(&partial);
+  }
+
+  rapidjson::Document d;
+  d.Parse(merged.Result().data());
+  ASSERT_TRUE(d.IsArray());
+  EXPECT_STREQ("/api/hot", d[0]["value"].GetString());
+  EXPECT_EQ(28, d[0]["count"].GetUint64());
+  EXPECT_EQ(0, d[0]["error"].GetUint64());
+}
+
+TEST(MathSketches, topk_serde) {
+  auto uda_tester = udf::UDATester<HeavyHittersUDA>();
+  auto res_before_serde = uda_tester.ForInput("/api/users")
+                              .ForInput("/api/users")
+                              .ForInput("/api/orders")
+                              .Result();
+  auto serialized = uda_tester.Serialize();
+  EXPECT_EQ(kHeavyHittersBinaryFormatVersion, serialized[0]);
+
+  auto new_uda_tester = udf::UDATester<HeavyHittersUDA>();
+  EXPECT_OK(new_uda_tester.Deserialize(serialized));
+  EXPECT_EQ(res_before_serde, new_uda_tester.Result());
+
+  EXPECT_NOT_OK(udf::UDATester<HeavyHittersUDA>().Deserialize("garbage"));
+}
+
 }  // namespace builtins
 }  // namespace carnot
 }  // namespace px
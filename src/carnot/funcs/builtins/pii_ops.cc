@@ -321,19 +321,56 @@ static std::map<Tag::Type, std::string_view> type_to_sub_str_ = {
     SUB_STR(Tag::Type::IMEISV),   SUB_STR(Tag::Type::IBAN),      SUB_STR(Tag::Type::SSN),
 };
 
-Status RedactPIIUDF::Init(FunctionContext*) {
+template <Tag::Type TTag>
+void PIIScanner::AddTagger() {
+  std::string err;
+  auto pattern = TagTypeTraits<TTag>::BuildRegexPattern();
+  int idx = set_->Add(re2::StringPiece(pattern.data(), pattern.size()), &err);
+  // Since the regex patterns are defined at compile time, using a DCHECK is ok here.
+  DCHECK_EQ(idx, static_cast<int>(taggers_.size())) << err;
+  taggers_.push_back(std::make_unique<RegexTagger<TTag>>());
+}
+
+PIIScanner::PIIScanner() {
+  re2::RE2::Options opts;
+  opts.set_log_errors(false);
+  set_ = std::make_unique<RE2::Set>(opts, RE2::UNANCHORED);
   // Order is important here. For example, IPv6 has to go before IPv4 to support IPv6 addresses with
   // the lowest 32 bits written like IPv4. Also Email has to go before IP since IP addresses can be
   // part of valid emails.
-  taggers_.push_back(std::make_unique<RegexTagger<Tag::Type::IBAN>>());
-  taggers_.push_back(std::make_unique<RegexTagger<Tag::Type::EMAIL_ADDR>>());
-  taggers_.push_back(std::make_unique<RegexTagger<Tag::Type::IPv6>>());
-  taggers_.push_back(std::make_unique<RegexTagger<Tag::Type::IPv4>>());
-  taggers_.push_back(std::make_unique<RegexTagger<Tag::Type::MAC_ADDR>>());
-  taggers_.push_back(std::make_unique<RegexTagger<Tag::Type::IMEI>>());
-  taggers_.push_back(std::make_unique<RegexTagger<Tag::Type::IMEISV>>());
-  taggers_.push_back(std::make_unique<RegexTagger<Tag::Type::CC_NUMBER>>());
-  taggers_.push_back(std::make_unique<RegexTagger<Tag::Type::SSN>>());
+  AddTagger<Tag::Type::IBAN>();
+  AddTagger<Tag::Type::EMAIL_ADDR>();
+  AddTagger<Tag::Type::IPv6>();
+  AddTagger<Tag::Type::IPv4>();
+  AddTagger<Tag::Type::MAC_ADDR>();
+  AddTagger<Tag::Type::IMEI>();
+  AddTagger<Tag::Type::IMEISV>();
+  AddTagger<Tag::Type::CC_NUMBER>();
+  AddTagger<Tag::Type::SSN>();
+  CHECK(set_->Compile()) << "Failed to compile the combined PII pattern set.";
+}
+
+PIIScanner& PIIScanner::GetInstance() {
+  static PIIScanner scanner;
+  return scanner;
+}
+
+Status PIIScanner::AddTags(std::string* input, std::vector<Tag>* tags) {
+  std::vector<int> matched_patterns;
+  if (!set_->Match(*input, &matched_patterns)) {
+    return Status::OK();
+  }
+  // Match doesn't guarantee an ordering, and the taggers have to run in the order they were
+  // registered.
+  std::sort(matched_patterns.begin(), matched_patterns.end());
+  for (int idx : matched_patterns) {
+    PX_RETURN_IF_ERROR(taggers_[idx]->AddTags(input, tags));
+  }
+  return Status::OK();
+}
+
+Status RedactPIIUDF::Init(FunctionContext*) {
+  scanner_ = &PIIScanner::GetInstance();
   return Status::OK();
 }
 
@@ -394,11 +431,12 @@ static inline std::string ReplaceTagsWithSubs(std::string input, std::vector<Tag
 
 StringValue RedactPIIUDF::Exec(FunctionContext*, StringValue input) {
   std::vector<Tag> tags;
-  for (const auto& tagger : taggers_) {
-    auto s = tagger->AddTags(&input, &tags);
-    if (!s.ok()) {
-      return "Invalid regex: " + s.msg();
-    }
+  auto s = scanner_->AddTags(&input, &tags);
+  if (!s.ok()) {
+    return "Invalid regex: " + s.msg();
+  }
+  if (tags.empty()) {
+    return input;
   }
   return ReplaceTagsWithSubs(input, &tags);
 }
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "re2/re2.h"
+#include "re2/set.h"
 #include "src/carnot/udf/registry.h"
 #include "src/common/base/utils.h"
 #include "src/shared/types/types.h"
@@ -72,6 +73,30 @@ class Tagger {
   virtual Status AddTags(std::string* input, std::vector<Tag>* tags) = 0;
 };
 
+/**
+ * Process-wide scanner that tags every PII class in an input.
+ * All patterns are additionally compiled into a single RE2::Set, which is matched once per input
+ * as a prefilter: only the taggers whose patterns occur somewhere in the input run their own
+ * pass, so a body with no PII costs one combined scan instead of one pass per PII class.
+ * The patterns are fixed at compile time, so the compiled set and taggers are built once and
+ * shared by all RedactPIIUDF instances; matching is thread-safe.
+ */
+class PIIScanner {
+ public:
+  static PIIScanner& GetInstance();
+
+  Status AddTags(std::string* input, std::vector<Tag>* tags);
+
+ private:
+  PIIScanner();
+
+  template <Tag::Type TTag>
+  void AddTagger();
+
+  std::vector<std::unique_ptr<Tagger>> taggers_;
+  std::unique_ptr<RE2::Set> set_;
+};
+
 class RedactPIIUDF : public udf::ScalarUDF {
  public:
   Status Init(FunctionContext*);
@@ -93,7 +118,7 @@ class RedactPIIUDF : public udf::ScalarUDF {
   }
 
  private:
-  std::vector<std::unique_ptr<Tagger>> taggers_;
+  PIIScanner* scanner_ = nullptr;
 };
 
 void RegisterPIIOpsOrDie(udf::Registry* registry);
@@ -267,6 +267,18 @@ INSTANTIATE_TEST_SUITE_P(TemplatedRedactionTest, RedactionTest,
                                                           EmailGen(), CCGen(), IMEIGen(), SSNGen(),
                                                           NegativeExampleGen()})));
 
+TEST(RedactionTest, no_pii_passes_through_unchanged) {
+  // Exercises the combined-set prefilter path: no pattern occurs, so no tagger runs.
+  std::string input = "GET /api/v1/healthz HTTP/1.1 host: svc.cluster.local status: ok";
+  udf::UDFTester<RedactPIIUDF>().Init().ForInput(input).Expect(input);
+}
+
+TEST(RedactionTest, multiple_pii_classes_in_one_body) {
+  udf::UDFTester<RedactPIIUDF>().Init()
+      .ForInput("user bob@example.com logged in from 192.168.0.1")
+      .Expect("user <REDACTED_EMAIL> logged in from <REDACTED_IPV4>");
+}
+
 }  // namespace builtins
 }  // namespace carnot
 }  // namespace px
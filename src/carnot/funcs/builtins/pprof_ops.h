@@ -20,10 +20,12 @@
 
 #include <absl/container/flat_hash_map.h>
 
+#include <optional>
 #include <string>
 
 #include "src/carnot/udf/registry.h"
 #include "src/carnot/udf/udf.h"
+#include "src/shared/pprof/folded_stack_delta.h"
 #include "src/shared/pprof/pprof.h"
 
 namespace px {
@@ -52,7 +54,7 @@ class CreatePProfRowAggregate : public udf::UDA {
         | # Thus, group by sampling period (normally this results in just one group).
         | df = df.groupby(['profiler_sampling_period_ms']).agg(pprof=('stack_trace', 'count', 'profiler_sampling_period_ms', px.pprof))
         )doc")
-        .Arg("stack_trace", "Stack trace string.")
+        .Arg("stack_trace", "Stack trace string, either plain or profiler delta-encoded.")
         .Arg("count", "Count of the stack trace string.")
         .Arg("profiler_period_ms", "Profiler stack trace sampling period in ms.")
         .Returns("A single row that aggregates all the stack traces and counts into pprof format.");
@@ -62,7 +64,10 @@ class CreatePProfRowAggregate : public udf::UDA {
               const Int64Value profiler_period_ms) {
     UpdateOrCheckSamplingPeriod(profiler_period_ms.val);
 
-    histo_[stack_trace] += count.val;
+    // The profiler delta-encodes folded stack strings against the previous row to shrink its
+    // table-store footprint; reconstruct the full string here. Plain strings pass through
+    // (and restart the decode chain).
+    histo_[delta_decoder_.Decode(stack_trace)] += count.val;
   }
 
   void Merge(FunctionContext*, const CreatePProfRowAggregate& other) {
@@ -78,7 +83,13 @@ class CreatePProfRowAggregate : public udf::UDA {
       return "Protobuf `SerializeToString` failed, multiple profiling periods found.";
     }
 
-    const auto pprof = px::shared::CreatePProfProfile(profiler_period_ms_, histo_);
+    // The builder is kept for the lifetime of this UDA: when serialization happens more than
+    // once (e.g. partial aggregates in a standing query), recurring stack traces reuse their
+    // interned string & location table entries instead of being rebuilt from scratch.
+    if (!builder_.has_value()) {
+      builder_.emplace(profiler_period_ms_);
+    }
+    const auto pprof = builder_->BuildProfile(histo_);
     std::string output;
     const bool ok = pprof.SerializeToString(&output);
     if (!ok) {
@@ -122,6 +133,8 @@ class CreatePProfRowAggregate : public udf::UDA {
   }
 
   absl::flat_hash_map<std::string, uint64_t> histo_;
+  ::px::shared::FoldedStackDeltaDecoder delta_decoder_;
+  std::optional<px::shared::PProfBuilder> builder_;
   int32_t profiler_period_ms_ = -1;
   bool multiple_profiler_periods_found_ = false;
 };
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "src/carnot/udf/test_utils.h"
+#include "src/shared/pprof/folded_stack_delta.h"
 #include "src/shared/pprof/pprof.h"
 
 namespace px {
@@ -137,6 +138,36 @@ TEST(PProf, pprof_merge_test) {
   EXPECT_EQ(actual, expected);
 }
 
+TEST(PProf, delta_encoded_rows_to_pprof_test) {
+  // The profiler delta-encodes rows sorted by stack trace; encode a chain here the same way.
+  const std::vector<std::pair<std::string, uint64_t>> input = {
+      {"foo;bar", 1},
+      {"foo;bar;baz", 2},
+      {"foo;bar;qux", 3},
+      {"main;compute;map;reduce", 4},
+  };
+
+  px::shared::FoldedStackDeltaEncoder encoder;
+  auto pprof_uda_tester = udf::UDATester<CreatePProfRowAggregate>();
+  for (const auto& [stack_trace, count] : input) {
+    pprof_uda_tester.ForInput(encoder.Encode(stack_trace), count, profiler_period_ms);
+  }
+
+  const std::string result = pprof_uda_tester.Result();
+
+  PProfProfile pprof;
+  EXPECT_TRUE(pprof.ParseFromString(result));
+
+  // Expect the full (decoded) stack trace strings in the output.
+  const absl::flat_hash_map<std::string, uint64_t> expected = {
+      {"foo;bar", 1},
+      {"foo;bar;baz", 2},
+      {"foo;bar;qux", 3},
+      {"main;compute;map;reduce", 4},
+  };
+  EXPECT_EQ(DeserializePProfProfile(pprof), expected);
+}
+
 TEST(PProf, uda_fails_with_multiple_sample_periods) {
   // Create our UDA tester.
   auto pprof_uda_tester = udf::UDATester<CreatePProfRowAggregate>();
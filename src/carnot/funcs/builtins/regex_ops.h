@@ -28,6 +28,10 @@
 #include <string>
 #include <utility>
 #include <vector>
+
+#define TBB_PREVIEW_CONCURRENT_LRU_CACHE 1
+#include "tbb/concurrent_lru_cache.h"
+
 #include "re2/re2.h"
 #include "src/carnot/udf/registry.h"
 #include "src/common/base/utils.h"
@@ -37,13 +41,52 @@ namespace px {
 namespace carnot {
 namespace builtins {
 
+namespace internal {
+
+constexpr size_t kRegexLRUCacheSize = 256;
+
+inline std::shared_ptr<const re2::RE2> CompileRegex(const std::string& pattern, bool dot_nl) {
+  re2::RE2::Options opts;
+  opts.set_dot_nl(dot_nl);
+  opts.set_log_errors(false);
+  return std::make_shared<const re2::RE2>(pattern, opts);
+}
+
+/**
+ * Process-wide LRU cache of compiled RE2 patterns, shared across query executions.
+ * Scripts tend to reuse the same handful of constant patterns, so repeated queries (and the
+ * many UDF instances within one query) skip RE2 compilation entirely. Compiled patterns are
+ * handed out as shared_ptrs, so an eviction never invalidates a pattern still in use.
+ */
+class RegexCache {
+ public:
+  static RegexCache& GetInstance() {
+    static RegexCache cache;
+    return cache;
+  }
+
+  std::shared_ptr<const re2::RE2> Lookup(const std::string& pattern, bool dot_nl) {
+    return dot_nl ? dot_nl_cache_[pattern].value() : cache_[pattern].value();
+  }
+
+ private:
+  // RE2 options are part of the compiled state, so each option set gets its own cache.
+  RegexCache()
+      : cache_([](std::string p) { return CompileRegex(p, /*dot_nl*/ false); },
+               kRegexLRUCacheSize),
+        dot_nl_cache_([](std::string p) { return CompileRegex(p, /*dot_nl*/ true); },
+                      kRegexLRUCacheSize) {}
+
+  tbb::concurrent_lru_cache<std::string, std::shared_ptr<const re2::RE2>> cache_;
+  tbb::concurrent_lru_cache<std::string, std::shared_ptr<const re2::RE2>> dot_nl_cache_;
+};
+
+}  // namespace internal
+
 class RegexMatchUDF : public udf::ScalarUDF {
  public:
   Status Init(FunctionContext*, StringValue regex) {
-    re2::RE2::Options opts;
-    opts.set_dot_nl(true);
-    opts.set_log_errors(false);
-    regex_ = std::make_unique<re2::RE2>(regex, opts);
+    regex_ = internal::RegexCache::GetInstance().Lookup(regex, /*dot_nl*/ true);
     return Status::OK();
   }
   BoolValue Exec(FunctionContext*, StringValue input) {
@@ -69,15 +112,13 @@ class RegexMatchUDF : public udf::ScalarUDF {
   }
 
  private:
-  std::unique_ptr<re2::RE2> regex_;
+  std::shared_ptr<const re2::RE2> regex_;
 };
 
 class RegexReplaceUDF : public udf::ScalarUDF {
  public:
   Status Init(FunctionContext*, StringValue regex_pattern) {
-    re2::RE2::Options opts;
-    opts.set_log_errors(false);
-    regex_ = std::make_unique<re2::RE2>(regex_pattern, opts);
+    regex_ = internal::RegexCache::GetInstance().Lookup(regex_pattern, /*dot_nl*/ false);
     return Status::OK();
   }
   StringValue Exec(FunctionContext*, StringValue input, StringValue sub) {
@@ -114,7 +155,7 @@ class RegexReplaceUDF : public udf::ScalarUDF {
   }
 
  private:
-  std::unique_ptr<re2::RE2> regex_;
+  std::shared_ptr<const re2::RE2> regex_;
 };
 
 class MatchRegexRule : public udf::ScalarUDF {
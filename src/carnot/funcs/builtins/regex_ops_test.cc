@@ -96,6 +96,22 @@ TEST(RegexOps, regex_match_rules) {
   EXPECT_NOT_OK(MatchRegexRule().Init(nullptr, "(?i).*onpointerenter.*"));
 }
 
+TEST(RegexOps, compiled_pattern_cache) {
+  auto& cache = internal::RegexCache::GetInstance();
+  // Repeated lookups of the same pattern share one compiled RE2.
+  auto first = cache.Lookup(".*abc.*", /*dot_nl*/ true);
+  auto second = cache.Lookup(".*abc.*", /*dot_nl*/ true);
+  EXPECT_EQ(first.get(), second.get());
+  // The same pattern compiled with different options is a different entry.
+  auto without_dot_nl = cache.Lookup(".*abc.*", /*dot_nl*/ false);
+  EXPECT_NE(first.get(), without_dot_nl.get());
+  EXPECT_TRUE(first->ok());
+
+  // Invalid patterns are still handed out so the UDFs can report the error per row.
+  auto invalid = cache.Lookup(R"regex(\K)regex", /*dot_nl*/ false);
+  EXPECT_FALSE(invalid->ok());
+}
+
 }  // namespace builtins
 }  // namespace carnot
 }  // namespace px
@@ -39,29 +39,48 @@ void RegisterRequestPathOpsOrDie(udf::Registry* registry) {
   registry->RegisterOrDie<RequestPathClusteringFitUDA>("_build_request_path_clusters");
 }
 
-RequestPath::RequestPath(std::string request_path) {
+RequestPath::RequestPath(std::string request_path) : path_(std::move(request_path)) {
   // Chop off request params for now. In the future, we want to keep these around and include
   // them in the clustering.
-  std::string request_path_no_params;
-  auto param_index = request_path.find('?');
-  if (param_index == std::string::npos) {
-    request_path_no_params = request_path;
-  } else {
-    request_path_no_params = request_path.substr(0, param_index);
+  auto param_index = path_.find('?');
+  if (param_index != std::string::npos) {
+    path_.resize(param_index);
+  }
+  // Tokenize in place: components are offset/length spans over the backing string, so the only
+  // allocations are the moved-in string itself and the span vector.
+  std::string_view remaining = path_;
+  if (!remaining.empty() && remaining[0] == '/') {
+    remaining.remove_prefix(1);
   }
-  if (request_path_no_params[0] == '/') {
-    request_path_no_params = request_path_no_params.substr(1, request_path_no_params.size() - 1);
+  auto offset = static_cast<uint32_t>(path_.size() - remaining.size());
+  while (true) {
+    auto slash = remaining.find('/');
+    auto len = static_cast<uint32_t>(slash == std::string_view::npos ? remaining.size() : slash);
+    components_.push_back(ComponentSpan{offset, len});
+    if (slash == std::string_view::npos) {
+      break;
+    }
+    remaining.remove_prefix(slash + 1);
+    offset += len + 1;
   }
-  path_components_ = absl::StrSplit(request_path_no_params, '/');
+}
+
+void RequestPath::AppendComponent(std::string_view component) {
+  if (!components_.empty()) {
+    path_.push_back('/');
+  }
+  auto offset = static_cast<uint32_t>(path_.size());
+  path_.append(component);
+  components_.push_back(ComponentSpan{offset, static_cast<uint32_t>(component.size())});
 }
 
 double RequestPath::Similarity(const RequestPath& other) const {
   DCHECK_EQ(depth(), other.depth());
   auto num_agree = 0.0;
-  for (const auto& [i, path_component] : Enumerate(path_components_)) {
-    auto other_path_component = other.path_components_[i];
-    if (path_component == kAnyToken || other_path_component == kAnyToken ||
-        path_component != other_path_component) {
+  for (int64_t i = 0; i < depth(); ++i) {
+    auto component = path_component(i);
+    auto other_component = other.path_component(i);
+    if (component == kAnyToken || other_component == kAnyToken || component != other_component) {
       continue;
     }
     num_agree += 1;
@@ -91,7 +110,7 @@ StatusOr<RequestPath> RequestPath::FromJSON(const rapidjson::Document::ValueType
           "RequestPath::FromJSON: expected array of path components, received non string path "
           "component");
     }
-    request_path.path_components_.emplace_back(val.GetString(), val.GetStringLength());
+    request_path.AppendComponent(std::string_view(val.GetString(), val.GetStringLength()));
   }
   return request_path;
 }
@@ -105,20 +124,29 @@ std::string RequestPath::ToJSON() const {
 
 void RequestPath::ToJSON(rapidjson::Writer<rapidjson::StringBuffer>* writer) const {
   writer->StartArray();
-  for (auto path : path_components_) {
-    writer->String(path.data(), path.size());
+  for (int64_t i = 0; i < depth(); ++i) {
+    auto component = path_component(i);
+    writer->String(component.data(), component.size());
   }
   writer->EndArray();
 }
 
-std::string RequestPath::ToString() const { return "/" + absl::StrJoin(path_components_, "/"); }
+std::string RequestPath::ToString() const {
+  std::string out;
+  out.reserve(path_.size() + depth() + 1);
+  for (int64_t i = 0; i < depth(); ++i) {
+    out.push_back('/');
+    out.append(path_component(i));
+  }
+  return out;
+}
 
 bool operator==(const RequestPath& a, const RequestPath& b) {
   if (a.depth() != b.depth()) {
     return false;
   }
-  for (const auto& [i, path] : Enumerate(a.path_components())) {
-    if (path != b.path_components()[i]) {
+  for (int64_t i = 0; i < a.depth(); ++i) {
+    if (a.path_component(i) != b.path_component(i)) {
       return false;
     }
   }
@@ -129,11 +157,11 @@ bool RequestPath::Matches(const RequestPath& templ) const {
   if (depth() != templ.depth()) {
     return false;
   }
-  for (const auto& [i, path_component] : Enumerate(path_components_)) {
-    if (templ.path_components()[i] == kAnyToken) {
+  for (int64_t i = 0; i < depth(); ++i) {
+    if (templ.path_component(i) == kAnyToken) {
       continue;
     }
-    if (path_component != templ.path_components()[i]) {
+    if (path_component(i) != templ.path_component(i)) {
       return false;
     }
   }
@@ -145,19 +173,18 @@ void RequestPathCluster::Merge(const RequestPathCluster& other_cluster) {
   MergeMembers(other_cluster.members_);
 }
 void RequestPathCluster::MergeCentroids(const RequestPath& other_centroid) {
-  auto path_components = centroid_.path_components();
-  auto other_path_components = other_centroid.path_components();
-  for (const auto& [i, path] : Enumerate(other_path_components)) {
-    if (path == path_components[i]) {
+  DCHECK_EQ(centroid_.depth(), other_centroid.depth());
+  for (int64_t i = 0; i < other_centroid.depth(); ++i) {
+    if (other_centroid.path_component(i) == centroid_.path_component(i)) {
       continue;
     }
-    centroid_.UpdatePathComponent(i, RequestPath::kAnyToken);
+    centroid_.SetPathComponentToAnyToken(i);
   }
 }
 
 void RequestPathCluster::MergeMembers(const absl::flat_hash_set<RequestPath>& other_members) {
   if (members_.size() > 0 && other_members.size() > 0) {
-    for (auto path : other_members) {
+    for (const auto& path : other_members) {
       members_.insert(path);
     }
     if (members_.size() > min_cardinality_) {
@@ -264,7 +291,7 @@ std::string RequestPathClustering::ToJSON() const {
   rapidjson::StringBuffer sb;
   rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
   writer.StartArray();
-  for (auto cluster : clusters_) {
+  for (const auto& cluster : clusters_) {
     cluster.ToJSON(&writer);
   }
   writer.EndArray();
@@ -299,7 +326,7 @@ void RequestPathClustering::Merge(const RequestPathClustering& other_clustering)
     if (cluster.members().size() == 0) {
       new_clusters.push_back(cluster);
     } else {
-      for (auto request_path : cluster.members()) {
+      for (const auto& request_path : cluster.members()) {
         singleton_clusters.push_back(RequestPathCluster(request_path));
       }
     }
@@ -320,7 +347,7 @@ void RequestPathClustering::Merge(const RequestPathClustering& other_clustering)
     if (cluster.members().size() == 0) {
       Update(cluster);
     } else {
-      for (auto request_path : cluster.members()) {
+      for (const auto& request_path : cluster.members()) {
         singleton_clusters.push_back(RequestPathCluster(request_path));
       }
     }
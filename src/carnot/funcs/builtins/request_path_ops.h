@@ -20,6 +20,8 @@
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -42,6 +44,9 @@ class RequestPath {
   /**
    * This class assumes that the request paths "/a/b" and "a/b" are equivalent. And as a result,
    * RequestPath("a/b").ToString() == "/a/b".
+   *
+   * The path is stored as a single backing string plus per-component offset/length spans, so
+   * tokenization, comparison and hashing don't allocate a string per path component.
    */
  public:
   explicit RequestPath(std::string request_path);
@@ -57,13 +62,13 @@ class RequestPath {
   double Similarity(const RequestPath& other) const;
 
   /**
-   * Updates i-th path component with new value.
-   * @param i the index of the path component to update.
-   * @param new_val The new value of the path componet.
+   * Replaces the i-th path component with kAnyToken. Centroid merging only ever generalizes
+   * components, so this is the sole mutation the component spans need to support.
+   * @param i the index of the path component to replace.
    */
-  void UpdatePathComponent(size_t i, const std::string& new_val) {
-    DCHECK_LT(i, path_components_.size());
-    path_components_[i] = new_val;
+  void SetPathComponentToAnyToken(size_t i) {
+    DCHECK_LT(i, components_.size());
+    components_[i] = ComponentSpan{kAnyTokenOffset, 0};
   }
 
   /**
@@ -85,7 +90,10 @@ class RequestPath {
 
   template <typename H>
   friend H AbslHashValue(H h, const RequestPath& request_path) {
-    return H::combine(std::move(h), request_path.ToString());
+    for (int64_t i = 0; i < request_path.depth(); ++i) {
+      h = H::combine(std::move(h), request_path.path_component(i));
+    }
+    return H::combine(std::move(h), request_path.depth());
   }
 
   // Serialization/Deserialization
@@ -94,12 +102,33 @@ class RequestPath {
   static StatusOr<RequestPath> FromJSON(std::string serialized_request_path);
   static StatusOr<RequestPath> FromJSON(const rapidjson::Document::ValueType& doc);
 
-  int64_t depth() const { return path_components_.size(); }
-  const std::vector<std::string>& path_components() const { return path_components_; }
+  int64_t depth() const { return components_.size(); }
+  /**
+   * Returns a view of the i-th path component, backed by this RequestPath.
+   */
+  std::string_view path_component(size_t i) const {
+    DCHECK_LT(i, components_.size());
+    const auto& span = components_[i];
+    if (span.offset == kAnyTokenOffset) {
+      return kAnyToken;
+    }
+    return std::string_view(path_).substr(span.offset, span.len);
+  }
   inline static constexpr char kAnyToken[] = "*";
 
  private:
-  std::vector<std::string> path_components_;
+  // Offset/length into path_. Components replaced by kAnyToken carry kAnyTokenOffset instead of
+  // pointing into the backing string, which keeps copies and moves of RequestPath trivial.
+  struct ComponentSpan {
+    uint32_t offset;
+    uint32_t len;
+  };
+  inline static constexpr uint32_t kAnyTokenOffset = std::numeric_limits<uint32_t>::max();
+
+  void AppendComponent(std::string_view component);
+
+  std::string path_;
+  std::vector<ComponentSpan> components_;
 };
 
 bool operator==(const RequestPath& a, const RequestPath& b);
@@ -230,23 +259,57 @@ class RequestPathClusteringPredictUDF : public udf::ScalarUDF {
 class RequestPathClusteringFitUDA : public udf::UDA {
  public:
   void Update(FunctionContext*, StringValue request_path_str) {
-    auto request_path = RequestPath(request_path_str);
-    clustering_.Update(RequestPathCluster(request_path));
+    // Gateway traffic repeats the same handful of paths many times per window, and clustering is
+    // over unique paths (cluster members are a set), so a path that's already been clustered is a
+    // no-op and can be skipped without tokenizing or scanning clusters again.
+    if (seen_paths_.contains(request_path_str)) {
+      return;
+    }
+    if (seen_paths_.size() < kMaxSeenPaths) {
+      seen_paths_.insert(request_path_str);
+    }
+    serialized_cache_valid_ = false;
+    clustering_.Update(RequestPathCluster(RequestPath(std::move(request_path_str))));
   }
   void Merge(FunctionContext*, const RequestPathClusteringFitUDA& other) {
     clustering_.Merge(other.clustering_);
+    serialized_cache_valid_ = false;
+    for (const auto& path : other.seen_paths_) {
+      if (seen_paths_.size() >= kMaxSeenPaths) {
+        break;
+      }
+      seen_paths_.insert(path);
+    }
   }
-  StringValue Finalize(FunctionContext*) { return clustering_.ToJSON(); }
+  StringValue Finalize(FunctionContext*) { return SerializedClustering(); }
 
-  StringValue Serialize(FunctionContext*) { return clustering_.ToJSON(); }
+  StringValue Serialize(FunctionContext*) { return SerializedClustering(); }
 
   Status Deserialize(FunctionContext*, const StringValue& data) {
     PX_ASSIGN_OR_RETURN(clustering_, RequestPathClustering::FromJSON(data));
+    serialized_cache_ = data;
+    serialized_cache_valid_ = true;
     return Status::OK();
   }
 
  private:
+  const std::string& SerializedClustering() {
+    if (!serialized_cache_valid_) {
+      serialized_cache_ = clustering_.ToJSON();
+      serialized_cache_valid_ = true;
+    }
+    return serialized_cache_;
+  }
+
+  // Bounds the dedup set so adversarially high-cardinality paths degrade to re-clustering
+  // instead of unbounded memory growth.
+  inline static constexpr size_t kMaxSeenPaths = 8192;
+
   RequestPathClustering clustering_;
+  absl::flat_hash_set<std::string> seen_paths_;
+  // Serialization of the clustering, reused as long as no update has changed the clustering.
+  std::string serialized_cache_;
+  bool serialized_cache_valid_ = false;
 };
 
 class RequestPathEndpointMatcherUDF : public udf::ScalarUDF {
@@ -39,6 +39,38 @@ INSTANTIATE_TEST_SUITE_P(RequestPathVariants, RequestPathTest,
                          ::testing::Values("/abc/b/cedfeg12345", "/a/b?k=v?k2=v2",
                                            "/a/%2F/c/?k=v%2F1"));
 
+TEST(RequestPath, tokenizes_into_component_views) {
+  RequestPath path("/a/b/cdef?k=v");
+  ASSERT_EQ(3, path.depth());
+  EXPECT_EQ("a", path.path_component(0));
+  EXPECT_EQ("b", path.path_component(1));
+  EXPECT_EQ("cdef", path.path_component(2));
+  EXPECT_EQ("/a/b/cdef", path.ToString());
+
+  path.SetPathComponentToAnyToken(1);
+  EXPECT_EQ(RequestPath::kAnyToken, path.path_component(1));
+  EXPECT_EQ("/a/*/cdef", path.ToString());
+}
+
+TEST(RequestPathClusteringFit, duplicate_paths_are_deduped) {
+  // Repeats of paths already clustered should produce the same clustering as feeding each unique
+  // path once.
+  auto uda_tester = udf::UDATester<RequestPathClusteringFitUDA>();
+  for (int i = 0; i < 3; i++) {
+    uda_tester.ForInput("/a/b/c")
+        .ForInput("/a/b/d")
+        .ForInput("/a/b/a")
+        .ForInput("/a/b/b")
+        .ForInput("/a/b/e")
+        .ForInput("/a/b/f");
+  }
+  auto clustering_or_s = RequestPathClustering::FromJSON(uda_tester.Result());
+  ASSERT_OK(clustering_or_s);
+  auto clustering = clustering_or_s.ConsumeValueOrDie();
+  ASSERT_EQ(1, clustering.clusters().size());
+  EXPECT_EQ("/a/b/*", clustering.clusters()[0].centroid().ToString());
+}
+
 TEST(RequestPathClusteringFit, basic) {
   auto uda_tester = udf::UDATester<RequestPathClusteringFitUDA>();
 
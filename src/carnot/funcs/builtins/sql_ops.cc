@@ -15,6 +15,10 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "src/carnot/funcs/builtins/sql_ops.h"
@@ -54,19 +58,25 @@ void RegisterSQLOpsOrDie(udf::Registry* registry) {
    *****************************************/
 }
 
-types::StringValue NormalizePostgresSQLUDF::Exec(FunctionContext*, StringValue sql_str,
-                                                 StringValue cmd_code) {
+namespace internal {
+namespace {
+
+// Separates the command code from the statement in cache keys. The ASCII unit separator cannot
+// appear in a Postgres command tag or a formatted MySQL command code, so keys are unambiguous.
+constexpr std::string_view kCacheKeySeparator = "\x1f";
+
+std::string NormalizePgSQLToJSON(std::string_view cmd_code, std::string_view sql_str) {
   std::string query;
   std::vector<std::string> param_values;
 
-  if (cmd_code.compare(kPgExecCmdCode) == 0) {
-    auto status = ParseExecuteCommand(sql_str, &query, &param_values);
+  if (cmd_code == kPgExecCmdCode) {
+    auto status = ParseExecuteCommand(std::string(sql_str), &query, &param_values);
     if (!status.ok()) {
       sql_parsing::NormalizeResult result;
       result.error = status.msg();
       return result.ToJSON();
     }
-  } else if (cmd_code.compare(kPgQueryCmdCode) == 0) {
+  } else if (cmd_code == kPgQueryCmdCode) {
     query = sql_str;
   } else {
     sql_parsing::NormalizeResult result;
@@ -84,13 +94,12 @@ types::StringValue NormalizePostgresSQLUDF::Exec(FunctionContext*, StringValue s
   return result_or_s.ConsumeValueOrDie().ToJSON();
 }
 
-types::StringValue NormalizeMySQLUDF::Exec(FunctionContext*, StringValue sql_str,
-                                           Int64Value cmd_code) {
+std::string NormalizeMySQLToJSON(int64_t cmd_code, std::string_view sql_str) {
   std::string query;
   std::vector<std::string> param_values;
 
   if (cmd_code == kMySQLExecuteCmdCode) {
-    auto status = ParseExecuteCommand(sql_str, &query, &param_values);
+    auto status = ParseExecuteCommand(std::string(sql_str), &query, &param_values);
     if (!status.ok()) {
       sql_parsing::NormalizeResult result;
       result.error = status.msg();
@@ -114,6 +123,61 @@ types::StringValue NormalizeMySQLUDF::Exec(FunctionContext*, StringValue sql_str
   return result_or_s.ConsumeValueOrDie().ToJSON();
 }
 
+}  // namespace
+
+SQLNormalizationCache& SQLNormalizationCache::GetInstance() {
+  static SQLNormalizationCache cache;
+  return cache;
+}
+
+SQLNormalizationCache::SQLNormalizationCache()
+    : pgsql_cache_(&SQLNormalizationCache::ComputePgSQL, kSQLNormalizationLRUCacheSize),
+      mysql_cache_(&SQLNormalizationCache::ComputeMySQL, kSQLNormalizationLRUCacheSize) {}
+
+std::shared_ptr<const std::string> SQLNormalizationCache::LookupPgSQL(const std::string& cmd_code,
+                                                                      const std::string& sql_str) {
+  lookups_.fetch_add(1, std::memory_order_relaxed);
+  return pgsql_cache_[absl::StrCat(cmd_code, kCacheKeySeparator, sql_str)].value();
+}
+
+std::shared_ptr<const std::string> SQLNormalizationCache::LookupMySQL(int64_t cmd_code,
+                                                                      const std::string& sql_str) {
+  lookups_.fetch_add(1, std::memory_order_relaxed);
+  return mysql_cache_[absl::StrCat(cmd_code, kCacheKeySeparator, sql_str)].value();
+}
+
+std::shared_ptr<const std::string> SQLNormalizationCache::ComputePgSQL(std::string key) {
+  GetInstance().misses_.fetch_add(1, std::memory_order_relaxed);
+  std::string_view key_view(key);
+  auto sep = key_view.find(kCacheKeySeparator);
+  DCHECK_NE(sep, std::string_view::npos);
+  return std::make_shared<const std::string>(
+      NormalizePgSQLToJSON(key_view.substr(0, sep), key_view.substr(sep + 1)));
+}
+
+std::shared_ptr<const std::string> SQLNormalizationCache::ComputeMySQL(std::string key) {
+  GetInstance().misses_.fetch_add(1, std::memory_order_relaxed);
+  std::string_view key_view(key);
+  auto sep = key_view.find(kCacheKeySeparator);
+  DCHECK_NE(sep, std::string_view::npos);
+  int64_t cmd_code = 0;
+  CHECK(absl::SimpleAtoi(key_view.substr(0, sep), &cmd_code));
+  return std::make_shared<const std::string>(
+      NormalizeMySQLToJSON(cmd_code, key_view.substr(sep + 1)));
+}
+
+}  // namespace internal
+
+types::StringValue NormalizePostgresSQLUDF::Exec(FunctionContext*, StringValue sql_str,
+                                                 StringValue cmd_code) {
+  return *internal::SQLNormalizationCache::GetInstance().LookupPgSQL(cmd_code, sql_str);
+}
+
+types::StringValue NormalizeMySQLUDF::Exec(FunctionContext*, StringValue sql_str,
+                                           Int64Value cmd_code) {
+  return *internal::SQLNormalizationCache::GetInstance().LookupMySQL(cmd_code.val, sql_str);
+}
+
 }  // namespace builtins
 }  // namespace carnot
 }  // namespace px
@@ -19,8 +19,15 @@
 #pragma once
 
 #include <absl/strings/strip.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <regex>
 #include <string>
+
+#define TBB_PREVIEW_CONCURRENT_LRU_CACHE 1
+#include "tbb/concurrent_lru_cache.h"
+
 #include "src/carnot/funcs/builtins/sql_parsing/normalization.h"
 #include "src/carnot/udf/registry.h"
 #include "src/common/base/status.h"
@@ -36,6 +43,47 @@ static constexpr char kPgQueryCmdCode[] = "Query";
 static constexpr int64_t kMySQLQueryCmdCode = 0x03;
 static constexpr int64_t kMySQLExecuteCmdCode = 0x17;
 
+namespace internal {
+
+// Production workloads repeat a few hundred distinct statements millions of times, so this
+// comfortably covers the working set while bounding memory for adversarial inputs.
+constexpr size_t kSQLNormalizationLRUCacheSize = 1024;
+
+/**
+ * Process-wide LRU cache of normalized SQL statements, shared across query executions.
+ * The key combines the command code and the raw statement; the value is the normalized-result
+ * JSON, handed out as a shared_ptr so an eviction never invalidates a result still in use.
+ * Repeated statements cost a hash lookup instead of a parser invocation. Hit/miss counters make
+ * the cache effectiveness observable in tests and ad-hoc debugging.
+ */
+class SQLNormalizationCache {
+ public:
+  static SQLNormalizationCache& GetInstance();
+
+  std::shared_ptr<const std::string> LookupPgSQL(const std::string& cmd_code,
+                                                 const std::string& sql_str);
+  std::shared_ptr<const std::string> LookupMySQL(int64_t cmd_code, const std::string& sql_str);
+
+  uint64_t hits() const {
+    return lookups_.load(std::memory_order_relaxed) - misses_.load(std::memory_order_relaxed);
+  }
+  uint64_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+ private:
+  SQLNormalizationCache();
+
+  // Cache-miss factories: these run the parser and are charged to the miss counter.
+  static std::shared_ptr<const std::string> ComputePgSQL(std::string key);
+  static std::shared_ptr<const std::string> ComputeMySQL(std::string key);
+
+  tbb::concurrent_lru_cache<std::string, std::shared_ptr<const std::string>> pgsql_cache_;
+  tbb::concurrent_lru_cache<std::string, std::shared_ptr<const std::string>> mysql_cache_;
+  std::atomic<uint64_t> lookups_{0};
+  std::atomic<uint64_t> misses_{0};
+};
+
+}  // namespace internal
+
 class NormalizePostgresSQLUDF : public udf::ScalarUDF {
  public:
   StringValue Exec(FunctionContext*, StringValue sql_str, StringValue cmd_code);
@@ -185,6 +185,25 @@ TEST(NormPGSQL, invalid_utf8) {
   udf_tester.ForInput(invalid, kPgQueryCmdCode).Expect(expected_result.ToJSON());
 }
 
+TEST(SQLNormalizationCache, repeated_statements_hit_cache) {
+  auto& cache = internal::SQLNormalizationCache::GetInstance();
+  // The cache is process-wide, so measure counter deltas with a statement unique to this test.
+  auto misses_before = cache.misses();
+  auto hits_before = cache.hits();
+  auto first = cache.LookupPgSQL(kPgQueryCmdCode, "SELECT a FROM cache_test WHERE b='repeat'");
+  auto second = cache.LookupPgSQL(kPgQueryCmdCode, "SELECT a FROM cache_test WHERE b='repeat'");
+  EXPECT_EQ(first.get(), second.get());
+  EXPECT_EQ(misses_before + 1, cache.misses());
+  EXPECT_EQ(hits_before + 1, cache.hits());
+}
+
+TEST(SQLNormalizationCache, command_code_is_part_of_the_key) {
+  auto& cache = internal::SQLNormalizationCache::GetInstance();
+  auto query = cache.LookupMySQL(kMySQLQueryCmdCode, "SELECT a FROM cache_test WHERE b='key'");
+  auto execute = cache.LookupMySQL(kMySQLExecuteCmdCode, "SELECT a FROM cache_test WHERE b='key'");
+  EXPECT_NE(*query, *execute);
+}
+
 TEST(NormMySQL, invalid_utf8) {
   std::string invalid(
       "\xbf\xef\xef\xbd\xbd\xbf\xbf\xef\xef\xbd\xbd\xbf\xbf\xef\xef\xbd\xbd\xbf\xbf\xef");
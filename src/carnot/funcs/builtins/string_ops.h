@@ -178,13 +178,20 @@ class StripPrefixUDF : public udf::ScalarUDF {
 
 class HexToASCII : public udf::ScalarUDF {
  public:
-  StringValue Exec(FunctionContext*, StringValue h) {
-    std::string result;
-    auto s_or_res = AsciiHexToBytes<std::string>(h);
-    if (s_or_res.ok()) {
-      return s_or_res.ConsumeValueOrDie();
+  StringValue Exec(FunctionContext* ctx, StringValue h) {
+    auto compute = [&]() -> StringValue {
+      auto s_or_res = AsciiHexToBytes<std::string>(h);
+      if (s_or_res.ok()) {
+        return StringValue(s_or_res.ConsumeValueOrDie());
+      }
+      return "";
+    };
+    if (ctx == nullptr) {
+      return compute();
     }
-    return "";
+    // Hex columns are typically low-cardinality (status bytes, fixed frames), so repeated
+    // inputs resolve through the context's intern pool instead of re-converting per row.
+    return ctx->string_pool()->InternOrCompute("hex_to_ascii", h, compute);
   }
 
   static udf::ScalarUDFDocBuilder Doc() {
@@ -201,7 +208,13 @@ class HexToASCII : public udf::ScalarUDF {
 
 class BytesToHex : public udf::ScalarUDF {
  public:
-  StringValue Exec(FunctionContext*, StringValue h) { return BytesToString<bytes_format::Hex>(h); }
+  StringValue Exec(FunctionContext* ctx, StringValue h) {
+    auto compute = [&]() -> StringValue { return BytesToString<bytes_format::Hex>(h); };
+    if (ctx == nullptr) {
+      return compute();
+    }
+    return ctx->string_pool()->InternOrCompute("bytes_to_hex", h, compute);
+  }
 
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Convert an input bytes in hex string.")
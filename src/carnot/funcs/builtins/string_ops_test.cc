@@ -17,8 +17,10 @@
  */
 
 #include <gtest/gtest.h>
+#include <memory>
 #include <numeric>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "src/carnot/funcs/builtins/string_ops.h"
@@ -103,6 +105,17 @@ TEST(StringOps, BytesToHex) {
   udf_tester.ForInput("abc").Expect(R"(\x61\x62\x63)");
 }
 
+TEST(StringOps, BytesToHex_repeated_inputs_use_intern_pool) {
+  auto ctx = std::make_unique<udf::FunctionContext>(nullptr, nullptr);
+  auto* pool = ctx->string_pool();
+  auto udf_tester = udf::UDFTester<BytesToHex>(std::move(ctx));
+  udf_tester.ForInput("abc").Expect(R"(\x61\x62\x63)");
+  udf_tester.ForInput("abc").Expect(R"(\x61\x62\x63)");
+  udf_tester.ForInput("abd").Expect(R"(\x61\x62\x64)");
+  // Two distinct inputs, so two pooled entries despite three calls.
+  EXPECT_EQ(2, pool->size());
+}
+
 TEST(StringOps, StringToInt) {
   auto udf_tester = udf::UDFTester<StringToIntUDF>();
   udf_tester.ForInput("1234", -1).Expect(1234);
@@ -20,6 +20,7 @@
 
 #include <sys/sysinfo.h>
 
+#include <absl/container/flat_hash_map.h>
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
@@ -55,6 +56,48 @@ inline StatusOr<K8sNameIdentView> K8sName(std::string_view name) {
   return std::make_pair(name_parts[0], name_parts[1]);
 }
 
+/**
+ * @brief Memoizes metadata lookups, keyed on the identity of the metadata snapshot.
+ *
+ * A UDF instance lives for the duration of a query, and the rows it processes repeat the same
+ * pod/service keys over and over while the underlying metadata rarely changes. Caching the
+ * resolved value turns the per-row map walks (and JSON stringification for the service set
+ * lookups) into a single hash probe. The cache is dropped whenever the backing snapshot changes
+ * (a different state object, or a new epoch on the same object), so cached results are always
+ * consistent with the snapshot the query is reading. The entry count is bounded so a
+ * high-cardinality key column cannot grow the cache without limit.
+ */
+template <typename TKey>
+class MetadataResolutionCache {
+ public:
+  template <typename TResolver>
+  types::StringValue Resolve(const px::md::AgentMetadataState* md, const TKey& key,
+                             TResolver&& resolver) {
+    if (md != md_ || md->epoch_id() != epoch_id_) {
+      cache_.clear();
+      md_ = md;
+      epoch_id_ = md->epoch_id();
+    }
+    auto it = cache_.find(key);
+    if (it != cache_.end()) {
+      return it->second;
+    }
+    if (cache_.size() >= kMaxEntries) {
+      cache_.clear();
+    }
+    types::StringValue val = resolver();
+    cache_.emplace(key, val);
+    return val;
+  }
+
+ private:
+  static constexpr size_t kMaxEntries = 8192;
+
+  const px::md::AgentMetadataState* md_ = nullptr;
+  uint64_t epoch_id_ = 0;
+  absl::flat_hash_map<TKey, types::StringValue> cache_;
+};
+
 }  // namespace internal
 
 inline const px::md::AgentMetadataState* GetMetadataState(px::carnot::udf::FunctionContext* ctx) {
@@ -103,13 +146,14 @@ class PodIDToPodNameUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, StringValue pod_id) {
     auto md = GetMetadataState(ctx);
+    return cache_.Resolve(md, pod_id, [&]() -> StringValue {
+      const auto* pod_info = md->k8s_metadata_state().PodInfoByID(pod_id);
+      if (pod_info != nullptr) {
+        return absl::Substitute("$0/$1", pod_info->ns(), pod_info->name());
+      }
 
-    const auto* pod_info = md->k8s_metadata_state().PodInfoByID(pod_id);
-    if (pod_info != nullptr) {
-      return absl::Substitute("$0/$1", pod_info->ns(), pod_info->name());
-    }
-
-    return "";
+      return "";
+    });
   }
   static udf::InfRuleVec SemanticInferenceRules() {
     return {udf::ExplicitRule::Create<PodIDToPodNameUDF>(types::ST_POD_NAME, {types::ST_NONE})};
@@ -121,6 +165,9 @@ class PodIDToPodNameUDF : public ScalarUDF {
         .Arg("pod_id", "The pod ID of the pod to get the name for.")
         .Returns("The k8s pod name for the pod ID passed in.");
   }
+
+ private:
+  internal::MetadataResolutionCache<std::string> cache_;
 };
 
 class PodIDToPodLabelsUDF : public ScalarUDF {
@@ -148,7 +195,7 @@ class PodNameToPodIDUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, StringValue pod_name) {
     auto md = GetMetadataState(ctx);
-    return GetPodID(md, pod_name);
+    return cache_.Resolve(md, pod_name, [&] { return GetPodID(md, pod_name); });
   }
 
   static StringValue GetPodID(const px::md::AgentMetadataState* md, StringValue pod_name) {
@@ -165,6 +212,9 @@ class PodNameToPodIDUDF : public ScalarUDF {
         .Arg("pod_name", "The name of the pod to get the ID for.")
         .Returns("The k8s pod ID for the pod name passed in.");
   }
+
+ private:
+  internal::MetadataResolutionCache<std::string> cache_;
 };
 
 class PodNameToPodIPUDF : public ScalarUDF {
@@ -411,13 +461,14 @@ class ServiceIDToServiceNameUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, StringValue service_id) {
     auto md = GetMetadataState(ctx);
+    return cache_.Resolve(md, service_id, [&]() -> StringValue {
+      const auto* service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
+      if (service_info != nullptr) {
+        return absl::Substitute("$0/$1", service_info->ns(), service_info->name());
+      }
 
-    const auto* service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
-    if (service_info != nullptr) {
-      return absl::Substitute("$0/$1", service_info->ns(), service_info->name());
-    }
-
-    return "";
+      return "";
+    });
   }
   static udf::InfRuleVec SemanticInferenceRules() {
     return {udf::ExplicitRule::Create<ServiceIDToServiceNameUDF>(types::ST_SERVICE_NAME,
@@ -433,6 +484,9 @@ class ServiceIDToServiceNameUDF : public ScalarUDF {
         .Arg("service_id", "The service ID to get the service name for.")
         .Returns("The service name or an empty string if service_id not found.");
   }
+
+ private:
+  internal::MetadataResolutionCache<std::string> cache_;
 };
 
 class ServiceIDToClusterIPUDF : public ScalarUDF {
@@ -539,22 +593,25 @@ class UPIDToServiceIDUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, UInt128Value upid_value) {
     auto md = GetMetadataState(ctx);
-    auto pod_info = UPIDtoPod(md, upid_value);
-    if (pod_info == nullptr || pod_info->services().size() == 0) {
-      return "";
-    }
-    std::vector<std::string> running_service_ids;
-    for (const auto& service_id : pod_info->services()) {
-      auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
-      if (service_info == nullptr) {
-        continue;
+    auto upid = absl::MakeUint128(upid_value.High64(), upid_value.Low64());
+    return cache_.Resolve(md, upid, [&]() -> StringValue {
+      auto pod_info = UPIDtoPod(md, upid_value);
+      if (pod_info == nullptr || pod_info->services().size() == 0) {
+        return "";
       }
-      if (service_info->stop_time_ns() == 0) {
-        running_service_ids.push_back(service_id);
+      std::vector<std::string> running_service_ids;
+      for (const auto& service_id : pod_info->services()) {
+        auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
+        if (service_info == nullptr) {
+          continue;
+        }
+        if (service_info->stop_time_ns() == 0) {
+          running_service_ids.push_back(service_id);
+        }
       }
-    }
 
-    return StringifyVector(running_service_ids);
+      return StringifyVector(running_service_ids);
+    });
   }
 
   static udf::ScalarUDFDocBuilder Doc() {
@@ -572,6 +629,9 @@ class UPIDToServiceIDUDF : public ScalarUDF {
 
   // This UDF can currently only run on PEMs, because only PEMs have the UPID information.
   static udfspb::UDFSourceExecutor Executor() { return udfspb::UDFSourceExecutor::UDF_PEM; }
+
+ private:
+  internal::MetadataResolutionCache<absl::uint128> cache_;
 };
 
 /**
@@ -581,22 +641,25 @@ class UPIDToServiceNameUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, UInt128Value upid_value) {
     auto md = GetMetadataState(ctx);
-    auto pod_info = UPIDtoPod(md, upid_value);
-    if (pod_info == nullptr || pod_info->services().size() == 0) {
-      return "";
-    }
-    std::vector<std::string> running_service_names;
-    for (const auto& service_id : pod_info->services()) {
-      auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
-      if (service_info == nullptr) {
-        continue;
+    auto upid = absl::MakeUint128(upid_value.High64(), upid_value.Low64());
+    return cache_.Resolve(md, upid, [&]() -> StringValue {
+      auto pod_info = UPIDtoPod(md, upid_value);
+      if (pod_info == nullptr || pod_info->services().size() == 0) {
+        return "";
       }
-      if (service_info->stop_time_ns() == 0) {
-        running_service_names.push_back(
-            absl::Substitute("$0/$1", service_info->ns(), service_info->name()));
+      std::vector<std::string> running_service_names;
+      for (const auto& service_id : pod_info->services()) {
+        auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
+        if (service_info == nullptr) {
+          continue;
+        }
+        if (service_info->stop_time_ns() == 0) {
+          running_service_names.push_back(
+              absl::Substitute("$0/$1", service_info->ns(), service_info->name()));
+        }
       }
-    }
-    return StringifyVector(running_service_names);
+      return StringifyVector(running_service_names);
+    });
   }
   static udf::InfRuleVec SemanticInferenceRules() {
     return {
@@ -618,6 +681,9 @@ class UPIDToServiceNameUDF : public ScalarUDF {
 
   // This UDF can currently only run on PEMs, because only PEMs have the UPID information.
   static udfspb::UDFSourceExecutor Executor() { return udfspb::UDFSourceExecutor::UDF_PEM; }
+
+ private:
+  internal::MetadataResolutionCache<absl::uint128> cache_;
 };
 
 /**
@@ -1784,24 +1850,25 @@ class PodIDToServiceNameUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, StringValue pod_id) {
     auto md = GetMetadataState(ctx);
-
-    const auto* pod_info = md->k8s_metadata_state().PodInfoByID(pod_id);
-    if (pod_info == nullptr) {
-      return "";
-    }
-
-    std::vector<std::string> running_service_names;
-    for (const auto& service_id : pod_info->services()) {
-      auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
-      if (service_info == nullptr) {
-        continue;
+    return cache_.Resolve(md, pod_id, [&]() -> StringValue {
+      const auto* pod_info = md->k8s_metadata_state().PodInfoByID(pod_id);
+      if (pod_info == nullptr) {
+        return "";
       }
-      if (service_info->stop_time_ns() == 0) {
-        running_service_names.push_back(
-            absl::Substitute("$0/$1", service_info->ns(), service_info->name()));
+
+      std::vector<std::string> running_service_names;
+      for (const auto& service_id : pod_info->services()) {
+        auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
+        if (service_info == nullptr) {
+          continue;
+        }
+        if (service_info->stop_time_ns() == 0) {
+          running_service_names.push_back(
+              absl::Substitute("$0/$1", service_info->ns(), service_info->name()));
+        }
       }
-    }
-    return StringifyVector(running_service_names);
+      return StringifyVector(running_service_names);
+    });
   }
   static udf::InfRuleVec SemanticInferenceRules() {
     return {
@@ -1817,6 +1884,9 @@ class PodIDToServiceNameUDF : public ScalarUDF {
         .Arg("pod_id", "The Pod ID of the Pod to get service name for.")
         .Returns("The k8s service name for the Pod ID passed in.");
   }
+
+ private:
+  internal::MetadataResolutionCache<std::string> cache_;
 };
 
 /**
@@ -1826,23 +1896,24 @@ class PodIDToServiceIDUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, StringValue pod_id) {
     auto md = GetMetadataState(ctx);
-
-    const auto* pod_info = md->k8s_metadata_state().PodInfoByID(pod_id);
-    if (pod_info == nullptr) {
-      return "";
-    }
-
-    std::vector<std::string> running_service_ids;
-    for (const auto& service_id : pod_info->services()) {
-      auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
-      if (service_info == nullptr) {
-        continue;
+    return cache_.Resolve(md, pod_id, [&]() -> StringValue {
+      const auto* pod_info = md->k8s_metadata_state().PodInfoByID(pod_id);
+      if (pod_info == nullptr) {
+        return "";
       }
-      if (service_info->stop_time_ns() == 0) {
-        running_service_ids.push_back(service_id);
+
+      std::vector<std::string> running_service_ids;
+      for (const auto& service_id : pod_info->services()) {
+        auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
+        if (service_info == nullptr) {
+          continue;
+        }
+        if (service_info->stop_time_ns() == 0) {
+          running_service_ids.push_back(service_id);
+        }
       }
-    }
-    return StringifyVector(running_service_ids);
+      return StringifyVector(running_service_ids);
+    });
   }
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Get the service ID for a given pod ID.")
@@ -1853,6 +1924,9 @@ class PodIDToServiceIDUDF : public ScalarUDF {
         .Arg("pod_id", "The Pod ID of the Pod to get service ID for.")
         .Returns("The k8s service ID for the Pod ID passed in.");
   }
+
+ private:
+  internal::MetadataResolutionCache<std::string> cache_;
 };
 
 /**
@@ -2256,28 +2330,29 @@ class PodNameToServiceNameUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, StringValue pod_name) {
     auto md = GetMetadataState(ctx);
+    return cache_.Resolve(md, pod_name, [&]() -> StringValue {
+      // This UDF expects the pod name to be in the format of "<ns>/<pod-name>".
+      PX_ASSIGN_OR(auto pod_name_view, internal::K8sName(pod_name), return "");
+      auto pod_id = md->k8s_metadata_state().PodIDByName(pod_name_view);
 
-    // This UDF expects the pod name to be in the format of "<ns>/<pod-name>".
-    PX_ASSIGN_OR(auto pod_name_view, internal::K8sName(pod_name), return "");
-    auto pod_id = md->k8s_metadata_state().PodIDByName(pod_name_view);
-
-    const auto* pod_info = md->k8s_metadata_state().PodInfoByID(pod_id);
-    if (pod_info == nullptr) {
-      return "";
-    }
-
-    std::vector<std::string> running_service_names;
-    for (const auto& service_id : pod_info->services()) {
-      auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
-      if (service_info == nullptr) {
-        continue;
+      const auto* pod_info = md->k8s_metadata_state().PodInfoByID(pod_id);
+      if (pod_info == nullptr) {
+        return "";
       }
-      if (service_info->stop_time_ns() == 0) {
-        running_service_names.push_back(
-            absl::Substitute("$0/$1", service_info->ns(), service_info->name()));
+
+      std::vector<std::string> running_service_names;
+      for (const auto& service_id : pod_info->services()) {
+        auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
+        if (service_info == nullptr) {
+          continue;
+        }
+        if (service_info->stop_time_ns() == 0) {
+          running_service_names.push_back(
+              absl::Substitute("$0/$1", service_info->ns(), service_info->name()));
+        }
       }
-    }
-    return StringifyVector(running_service_names);
+      return StringifyVector(running_service_names);
+    });
   }
   static udf::InfRuleVec SemanticInferenceRules() {
     return {udf::ExplicitRule::Create<PodNameToServiceNameUDF>(types::ST_SERVICE_NAME,
@@ -2293,6 +2368,9 @@ class PodNameToServiceNameUDF : public ScalarUDF {
         .Arg("pod_name", "The name of the Pod to get service name for.")
         .Returns("The k8s service name for the Pod name passed in.");
   }
+
+ private:
+  internal::MetadataResolutionCache<std::string> cache_;
 };
 
 /**
@@ -2302,27 +2380,28 @@ class PodNameToServiceIDUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, StringValue pod_name) {
     auto md = GetMetadataState(ctx);
+    return cache_.Resolve(md, pod_name, [&]() -> StringValue {
+      // This UDF expects the pod name to be in the format of "<ns>/<pod-name>".
+      PX_ASSIGN_OR(auto pod_name_view, internal::K8sName(pod_name), return "");
+      auto pod_id = md->k8s_metadata_state().PodIDByName(pod_name_view);
 
-    // This UDF expects the pod name to be in the format of "<ns>/<pod-name>".
-    PX_ASSIGN_OR(auto pod_name_view, internal::K8sName(pod_name), return "");
-    auto pod_id = md->k8s_metadata_state().PodIDByName(pod_name_view);
-
-    const auto* pod_info = md->k8s_metadata_state().PodInfoByID(pod_id);
-    if (pod_info == nullptr) {
-      return "";
-    }
-
-    std::vector<std::string> running_service_ids;
-    for (const auto& service_id : pod_info->services()) {
-      auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
-      if (service_info == nullptr) {
-        continue;
+      const auto* pod_info = md->k8s_metadata_state().PodInfoByID(pod_id);
+      if (pod_info == nullptr) {
+        return "";
       }
-      if (service_info->stop_time_ns() == 0) {
-        running_service_ids.push_back(service_id);
+
+      std::vector<std::string> running_service_ids;
+      for (const auto& service_id : pod_info->services()) {
+        auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
+        if (service_info == nullptr) {
+          continue;
+        }
+        if (service_info->stop_time_ns() == 0) {
+          running_service_ids.push_back(service_id);
+        }
       }
-    }
-    return StringifyVector(running_service_ids);
+      return StringifyVector(running_service_ids);
+    });
   }
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Get the service ID for a given pod name.")
@@ -2333,6 +2412,9 @@ class PodNameToServiceIDUDF : public ScalarUDF {
         .Arg("pod_id", "The name of the Pod to get service ID for.")
         .Returns("The k8s service ID for the Pod name passed in.");
   }
+
+ private:
+  internal::MetadataResolutionCache<std::string> cache_;
 };
 
 class UPIDToStringUDF : public ScalarUDF {
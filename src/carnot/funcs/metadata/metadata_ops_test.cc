@@ -198,6 +198,9 @@ TEST_F(MetadataOpsTest, upid_to_service_id_test) {
   // Terminate a service, and make sure that the upid no longer associates with that service.
   updates_->enqueue(px::metadatapb::testutils::CreateTerminatedServiceUpdatePB());
   EXPECT_OK(px::md::ApplyK8sUpdates(11, metadata_state_.get(), &md_filter_, updates_.get()));
+  // The state manager bumps the epoch whenever it publishes an updated state; mirror that here
+  // so the UDF's resolution cache sees the update.
+  metadata_state_->set_epoch_id(metadata_state_->epoch_id() + 1);
   // upid2 previously was connected to 4_uid.
   udf_tester.ForInput(upid2).Expect("");
 }
@@ -214,10 +217,32 @@ TEST_F(MetadataOpsTest, upid_to_service_name_test) {
 
   updates_->enqueue(px::metadatapb::testutils::CreateTerminatedServiceUpdatePB());
   EXPECT_OK(px::md::ApplyK8sUpdates(11, metadata_state_.get(), &md_filter_, updates_.get()));
+  // The state manager bumps the epoch whenever it publishes an updated state; mirror that here
+  // so the UDF's resolution cache sees the update.
+  metadata_state_->set_epoch_id(metadata_state_->epoch_id() + 1);
   // upid2 previously was connected to pl/terminating_service.
   udf_tester.ForInput(upid2).Expect("");
 }
 
+TEST_F(MetadataOpsTest, metadata_resolution_cache_test) {
+  internal::MetadataResolutionCache<std::string> cache;
+  int num_resolves = 0;
+  auto resolver = [&]() -> types::StringValue {
+    ++num_resolves;
+    return "val";
+  };
+
+  EXPECT_EQ("val", cache.Resolve(metadata_state_.get(), "key", resolver));
+  EXPECT_EQ("val", cache.Resolve(metadata_state_.get(), "key", resolver));
+  // The second call should be served from the cache.
+  EXPECT_EQ(1, num_resolves);
+
+  // A new epoch on the same state object invalidates the cache.
+  metadata_state_->set_epoch_id(metadata_state_->epoch_id() + 1);
+  EXPECT_EQ("val", cache.Resolve(metadata_state_.get(), "key", resolver));
+  EXPECT_EQ(2, num_resolves);
+}
+
 TEST_F(MetadataOpsTest, upid_to_replicaset_name_test) {
   auto function_ctx = std::make_unique<FunctionContext>(metadata_state_, nullptr);
   auto udf_tester = px::carnot::udf::UDFTester<UPIDToReplicaSetNameUDF>(std::move(function_ctx));
@@ -0,0 +1,123 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/funcs/net/dns.h"
+
+#include <utility>
+
+DEFINE_int64(carnot_dns_cache_ttl_seconds,
+             gflags::Int64FromEnv("PL_CARNOT_DNS_CACHE_TTL_SECONDS", 300),
+             "How long a reverse-DNS result is served before the background resolver refreshes "
+             "it. The previous name continues to be served while the refresh is in flight.");
+
+namespace px {
+namespace carnot {
+namespace funcs {
+namespace net {
+namespace internal {
+
+AsyncDNSCache& AsyncDNSCache::GetInstance() {
+  static AsyncDNSCache cache;
+  return cache;
+}
+
+AsyncDNSCache::AsyncDNSCache(std::function<std::string(const std::string&)> resolve_fn)
+    : resolve_fn_(std::move(resolve_fn)), resolver_thread_([this] { ResolverLoop(); }) {}
+
+AsyncDNSCache::~AsyncDNSCache() {
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  resolver_thread_.join();
+}
+
+std::string AsyncDNSCache::Lookup(const std::string& addr) {
+  const auto now = std::chrono::steady_clock::now();
+
+  std::lock_guard<std::mutex> lock(mu_);
+
+  auto iter = entries_.find(addr);
+  if (iter != entries_.end()) {
+    Entry& entry = iter->second;
+    if (now >= entry.expiry && !entry.resolving) {
+      entry.resolving = true;
+      pending_.push_back(addr);
+      cv_.notify_one();
+    }
+    // Expired entries keep serving the previous name while the refresh is in flight.
+    return entry.name;
+  }
+
+  if (entries_.size() >= kMaxEntries && !EvictOneExpired(now)) {
+    return addr;
+  }
+
+  Entry& entry = entries_[addr];
+  entry.name = addr;
+  entry.expiry = now;
+  entry.resolving = true;
+  pending_.push_back(addr);
+  cv_.notify_one();
+  return addr;
+}
+
+bool AsyncDNSCache::EvictOneExpired(std::chrono::steady_clock::time_point now) {
+  size_t probes = 0;
+  for (auto iter = entries_.begin(); iter != entries_.end() && probes < kEvictionProbes;
+       ++iter, ++probes) {
+    if (now >= iter->second.expiry && !iter->second.resolving) {
+      entries_.erase(iter);
+      return true;
+    }
+  }
+  return false;
+}
+
+void AsyncDNSCache::ResolverLoop() {
+  std::unique_lock<std::mutex> lock(mu_);
+  while (true) {
+    cv_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+    if (stop_) {
+      return;
+    }
+
+    std::string addr = std::move(pending_.front());
+    pending_.pop_front();
+
+    // Resolve outside the lock, so lookups keep hitting the cache while getnameinfo blocks.
+    lock.unlock();
+    std::string name = resolve_fn_(addr);
+    lock.lock();
+
+    auto iter = entries_.find(addr);
+    if (iter != entries_.end()) {
+      iter->second.name = std::move(name);
+      iter->second.expiry = std::chrono::steady_clock::now() +
+                            std::chrono::seconds(FLAGS_carnot_dns_cache_ttl_seconds);
+      iter->second.resolving = false;
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace net
+}  // namespace funcs
+}  // namespace carnot
+}  // namespace px
@@ -18,10 +18,22 @@
 
 #pragma once
 
+#include <arpa/inet.h>
+#include <netdb.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <string>
+#include <thread>
 
-#define TBB_PREVIEW_CONCURRENT_LRU_CACHE 1
-#include "tbb/concurrent_lru_cache.h"
+#include <absl/container/flat_hash_map.h>
+
+#include "src/common/base/base.h"
+
+DECLARE_int64(carnot_dns_cache_ttl_seconds);
 
 namespace px {
 namespace carnot {
@@ -30,7 +42,6 @@ namespace net {
 namespace internal {
 
 constexpr size_t kMaxHostnameSize = 512;
-constexpr size_t kLRUCacheSize = 1024;
 
 inline std::string DNSLookup(const std::string& addr) {
   struct sockaddr_in sa;
@@ -51,20 +62,55 @@ inline std::string DNSLookup(const std::string& addr) {
   return node;
 }
 
-class DNSCache {
+/**
+ * AsyncDNSCache performs reverse DNS resolution off the query path.
+ *
+ * Lookup() never blocks: it returns the cached name when one is known, or the IP itself while a
+ * background thread resolves it, so per-row calls in a UDF cost a map lookup rather than a
+ * network round-trip. Entries are refreshed once they are older than
+ * --carnot_dns_cache_ttl_seconds; the previous name continues to be served while the refresh is
+ * in flight.
+ */
+class AsyncDNSCache {
  public:
-  static DNSCache& GetInstance() {
-    static DNSCache cache;
-    return cache;
-  }
+  static AsyncDNSCache& GetInstance();
 
-  std::string Lookup(std::string addr) { return cache_[addr].value(); }
+  // Public so tests can inject a resolver; production code uses GetInstance().
+  explicit AsyncDNSCache(std::function<std::string(const std::string&)> resolve_fn = DNSLookup);
+  ~AsyncDNSCache();
 
- private:
-  DNSCache()
-      : cache_([](std::string addr) -> std::string { return DNSLookup(addr); }, kLRUCacheSize) {}
+  /**
+   * Returns the name for the address if the cache holds one, or the address itself otherwise.
+   * Unknown and expired addresses are queued for the background resolver; never blocks.
+   */
+  std::string Lookup(const std::string& addr);
 
-  tbb::concurrent_lru_cache<std::string, std::string> cache_;
+ private:
+  struct Entry {
+    // The resolved name. Until the first resolution completes, the IP is its own name.
+    std::string name;
+    std::chrono::steady_clock::time_point expiry;
+    // Whether a resolution for this address is currently queued or in flight.
+    bool resolving = false;
+  };
+
+  // Bound on cached addresses. At the cap, a miss evicts an expired idle entry if one is found
+  // within a bounded probe, and is otherwise served unresolved without being cached.
+  static constexpr size_t kMaxEntries = 8192;
+  static constexpr size_t kEvictionProbes = 16;
+
+  void ResolverLoop();
+  bool EvictOneExpired(std::chrono::steady_clock::time_point now);
+
+  const std::function<std::string(const std::string&)> resolve_fn_;
+
+  std::mutex mu_;
+  std::condition_variable cv_;
+  absl::flat_hash_map<std::string, Entry> entries_;
+  std::deque<std::string> pending_;
+  bool stop_ = false;
+
+  std::thread resolver_thread_;
 };
 
 }  // namespace internal
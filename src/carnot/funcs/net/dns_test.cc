@@ -0,0 +1,94 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "src/carnot/funcs/net/dns.h"
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace carnot {
+namespace funcs {
+namespace net {
+namespace internal {
+
+namespace {
+
+// Spins until the cache serves a name other than the address, i.e. until the background
+// resolver has filled the entry. Returns the final answer.
+std::string WaitForResolution(AsyncDNSCache* cache, const std::string& addr) {
+  constexpr auto kTimeout = std::chrono::seconds(5);
+  const auto deadline = std::chrono::steady_clock::now() + kTimeout;
+  while (std::chrono::steady_clock::now() < deadline) {
+    std::string result = cache->Lookup(addr);
+    if (result != addr) {
+      return result;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return addr;
+}
+
+}  // namespace
+
+TEST(AsyncDNSCacheTest, ServesAddressUntilResolved) {
+  AsyncDNSCache cache([](const std::string& addr) { return "host-" + addr; });
+
+  // The first lookup cannot know the name yet; it must return the address without blocking.
+  EXPECT_EQ(cache.Lookup("10.0.0.1"), "10.0.0.1");
+
+  EXPECT_EQ(WaitForResolution(&cache, "10.0.0.1"), "host-10.0.0.1");
+  EXPECT_EQ(cache.Lookup("10.0.0.1"), "host-10.0.0.1");
+}
+
+TEST(AsyncDNSCacheTest, ExpiredEntryServesStaleNameWhileRefreshing) {
+  const int64_t old_ttl = FLAGS_carnot_dns_cache_ttl_seconds;
+  // A zero TTL makes every resolved entry immediately due for a refresh.
+  FLAGS_carnot_dns_cache_ttl_seconds = 0;
+
+  std::atomic<int> resolutions{0};
+  AsyncDNSCache cache([&resolutions](const std::string& addr) {
+    ++resolutions;
+    return "host-" + addr;
+  });
+
+  cache.Lookup("10.0.0.1");
+  ASSERT_EQ(WaitForResolution(&cache, "10.0.0.1"), "host-10.0.0.1");
+  const int after_first = resolutions;
+
+  // The expired entry keeps serving the previous name, and triggers a re-resolution.
+  EXPECT_EQ(cache.Lookup("10.0.0.1"), "host-10.0.0.1");
+  constexpr auto kTimeout = std::chrono::seconds(5);
+  const auto deadline = std::chrono::steady_clock::now() + kTimeout;
+  while (resolutions <= after_first && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_GT(resolutions, after_first);
+  EXPECT_EQ(cache.Lookup("10.0.0.1"), "host-10.0.0.1");
+
+  FLAGS_carnot_dns_cache_ttl_seconds = old_ttl;
+}
+
+}  // namespace internal
+}  // namespace net
+}  // namespace funcs
+}  // namespace carnot
+}  // namespace px
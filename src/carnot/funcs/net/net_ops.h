@@ -47,14 +47,17 @@ class NSLookupUDF : public ScalarUDF {
 
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Perform a DNS lookup for the value (experimental).")
-        .Details("Experimental UDF to perform a DNS lookup for a given value.")
+        .Details(
+            "Experimental UDF to perform a DNS lookup for a given value. Resolution happens "
+            "asynchronously: addresses not yet resolved are returned as-is, and gain their "
+            "hostname in later queries once the background resolver has cached them.")
         .Arg("addr", "An IP address")
         .Example("df.hostname = px.nslookup(df.ip_addr)")
-        .Returns("The hostname.");
+        .Returns("The hostname, or the IP address itself if it has not been resolved yet.");
   }
 
  private:
-  internal::DNSCache& cache_ = internal::DNSCache::GetInstance();
+  internal::AsyncDNSCache& cache_ = internal::AsyncDNSCache::GetInstance();
 };
 
 class CIDRsContainIPUDF : public ScalarUDF {
@@ -73,15 +76,15 @@ class CIDRsContainIPUDF : public ScalarUDF {
       if (!doc.IsArray()) {
         return false;
       }
-      cidrs_.clear();
+      cidr_trie_.clear();
       for (rapidjson::Value::ConstValueIterator itr = doc.Begin(); itr != doc.End(); ++itr) {
         if (!itr->IsString()) {
           return false;
         }
-        cidrs_.emplace_back();
-        auto s = px::ParseCIDRBlock(itr->GetString(), &cidrs_.back());
-        if (!s.ok()) {
-          cidrs_.pop_back();
+        px::CIDRBlock cidr;
+        auto s = px::ParseCIDRBlock(itr->GetString(), &cidr);
+        if (s.ok()) {
+          cidr_trie_.Insert(cidr);
         }
       }
     }
@@ -91,12 +94,7 @@ class CIDRsContainIPUDF : public ScalarUDF {
     if (!s.ok()) {
       return false;
     }
-    for (const auto& cidr : cidrs_) {
-      if (px::CIDRContainsIPAddr(cidr, addr)) {
-        return true;
-      }
-    }
-    return false;
+    return cidr_trie_.ContainsIPAddr(addr);
   }
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Determine whether an IP is contained in a set of CIDR ranges.")
@@ -116,7 +114,8 @@ class CIDRsContainIPUDF : public ScalarUDF {
 
  private:
   std::string parsed_cidr_str_ = "";
-  std::vector<px::CIDRBlock> cidrs_;
+  // Longest-prefix-match index over the parsed CIDRs; lookup cost is independent of CIDR count.
+  px::CIDRTrieSet cidr_trie_;
 };
 
 void RegisterNetOpsOrDie(px::carnot::udf::Registry* registry);
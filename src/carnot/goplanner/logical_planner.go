@@ -28,6 +28,8 @@ import "C"
 import (
 	"errors"
 	"fmt"
+	"hash/fnv"
+	"sync"
 	"unsafe"
 
 	"github.com/gogo/protobuf/proto"
@@ -43,9 +45,29 @@ import (
 	"px.dev/pixie/src/common/base/statuspb"
 )
 
+// sentStateFingerprints tracks which distributed state fingerprints the C++ planner has been
+// sent, so repeat Plan calls can omit the multi-megabyte distributed state from the cgo payload.
+type sentStateFingerprints struct {
+	mu   sync.Mutex
+	sent map[uint64]bool
+}
+
+func (f *sentStateFingerprints) has(fp uint64) bool {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	return f.sent[fp]
+}
+
+func (f *sentStateFingerprints) add(fp uint64) {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	f.sent[fp] = true
+}
+
 // GoPlanner wraps the C Planner.
 type GoPlanner struct {
-	planner C.PlannerPtr
+	planner           C.PlannerPtr
+	stateFingerprints *sentStateFingerprints
 }
 
 // New creates a new GoPlanner object.
@@ -59,12 +81,60 @@ func New(udfInfo *udfspb.UDFInfo) (GoPlanner, error) {
 	defer C.free(udfInfoData)
 
 	ret.planner = C.PlannerNew((*C.char)(udfInfoData), C.int(len(udfInfoBytes)))
+	ret.stateFingerprints = &sentStateFingerprints{sent: make(map[uint64]bool)}
 
 	return ret, nil
 }
 
 // Plan the query with the passed in state, then return the result as a planner result protobuf.
+//
+// The distributed state dominates the request size but changes rarely, so it is fingerprinted
+// and, once the planner has seen a fingerprint, later requests carry only the fingerprint. The
+// planner answers a fingerprint it has since evicted with NOT_FOUND, in which case the request
+// is retried with the full state.
 func (cm GoPlanner) Plan(queryRequest *plannerpb.QueryRequest) (*distributedpb.LogicalPlannerResult, error) {
+	ls := queryRequest.LogicalPlannerState
+	if ls == nil || ls.DistributedState == nil || cm.stateFingerprints == nil {
+		return cm.planRequest(queryRequest)
+	}
+
+	stateBytes, err := proto.Marshal(ls.DistributedState)
+	if err != nil {
+		return nil, err
+	}
+	h := fnv.New64a()
+	h.Write(stateBytes)
+	fp := h.Sum64()
+	if fp == 0 {
+		// 0 means fingerprinting is not in use, so this state cannot be cached by reference.
+		return cm.planRequest(queryRequest)
+	}
+
+	if cm.stateFingerprints.has(fp) {
+		strippedState := *ls
+		strippedState.DistributedState = nil
+		strippedState.DistributedStateFingerprint = fp
+		strippedRequest := *queryRequest
+		strippedRequest.LogicalPlannerState = &strippedState
+		result, err := cm.planRequest(&strippedRequest)
+		if err != nil || result.Status.GetErrCode() != statuspb.NOT_FOUND {
+			return result, err
+		}
+		// The planner evicted this fingerprint; fall through and resend the full state.
+	}
+
+	fullState := *ls
+	fullState.DistributedStateFingerprint = fp
+	fullRequest := *queryRequest
+	fullRequest.LogicalPlannerState = &fullState
+	result, err := cm.planRequest(&fullRequest)
+	if err == nil {
+		cm.stateFingerprints.add(fp)
+	}
+	return result, err
+}
+
+func (cm GoPlanner) planRequest(queryRequest *plannerpb.QueryRequest) (*distributedpb.LogicalPlannerResult, error) {
 	var resultLen C.int
 	queryRequestBytes, err := proto.Marshal(queryRequest)
 	if err != nil {
@@ -325,6 +325,10 @@ std::string GRPCSinkOperator::DebugString() const {
   } else if (has_grpc_source_id()) {
     destination = absl::Substitute("source_id=$0", grpc_source_id());
   }
+  if (has_hash_shuffle()) {
+    destination = absl::Substitute("$0, shuffle_destinations=$1", destination,
+                                   hash_shuffle().destinations_size());
+  }
   return absl::Substitute("Op:GRPCSink($0, $1)", address(), destination);
 }
 
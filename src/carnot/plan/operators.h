@@ -97,6 +97,7 @@ class MemorySourceOperator : public Operator {
   std::vector<int64_t> Columns() const { return column_idxs_; }
   const types::TabletID& Tablet() const { return pb_.tablet(); }
   bool streaming() const { return pb_.streaming(); }
+  int64_t sample_every_n() const { return pb_.sample_every_n(); }
 
  private:
   planpb::MemorySourceOperator pb_;
@@ -217,6 +218,15 @@ class GRPCSinkOperator : public Operator {
   }
   std::string table_name() const { return pb_.output_table().table_name(); }
 
+  // When true, the sink hash-partitions rows by the shuffle key columns across the
+  // destinations in hash_shuffle(), instead of using the single address/source id above.
+  bool has_hash_shuffle() const {
+    return pb_.has_hash_shuffle() && pb_.hash_shuffle().destinations_size() > 0;
+  }
+  const planpb::GRPCSinkOperator::HashShuffleSpec& hash_shuffle() const {
+    return pb_.hash_shuffle();
+  }
+
  private:
   planpb::GRPCSinkOperator pb_;
 };
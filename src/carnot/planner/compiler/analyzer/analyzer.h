@@ -25,13 +25,16 @@
 
 #include "src/carnot/planner/compiler/analyzer/add_limit_to_batch_result_sink_rule.h"
 #include "src/carnot/planner/compiler/analyzer/combine_consecutive_maps_rule.h"
+#include "src/carnot/planner/compiler/analyzer/common_subexpression_elimination_rule.h"
 #include "src/carnot/planner/compiler/analyzer/convert_metadata_rule.h"
+#include "src/carnot/planner/compiler/analyzer/fold_constant_expressions_rule.h"
 #include "src/carnot/planner/compiler/analyzer/drop_to_map_rule.h"
 #include "src/carnot/planner/compiler/analyzer/merge_group_by_into_group_acceptor_rule.h"
 #include "src/carnot/planner/compiler/analyzer/nested_blocking_agg_fn_check_rule.h"
 #include "src/carnot/planner/compiler/analyzer/propagate_expression_annotations_rule.h"
 #include "src/carnot/planner/compiler/analyzer/remove_group_by_rule.h"
 #include "src/carnot/planner/compiler/analyzer/resolve_metadata_property_rule.h"
+#include "src/carnot/planner/compiler/analyzer/resolve_sample_rule.h"
 #include "src/carnot/planner/compiler/analyzer/resolve_stream_rule.h"
 #include "src/carnot/planner/compiler/analyzer/resolve_types_rule.h"
 #include "src/carnot/planner/compiler/analyzer/restrict_columns_rule.h"
@@ -72,6 +75,7 @@ class Analyzer : public RuleExecutor<IR> {
         IRNodeType::kRolling);
     source_and_metadata_resolution_batch->AddRule<NestedBlockingAggFnCheckRule>();
     source_and_metadata_resolution_batch->AddRule<ResolveStreamRule>();
+    source_and_metadata_resolution_batch->AddRule<ResolveSampleRule>();
   }
 
   void CreateUniqueSinkNamesBatch() {
@@ -90,6 +94,15 @@ class Analyzer : public RuleExecutor<IR> {
     consecutive_maps->AddRule<CombineConsecutiveMapsRule>();
   }
 
+  void CreateExpressionSimplificationBatch() {
+    // Constant folding executes leaves-first so one pass fully folds nested constants; the
+    // second pass picks up expressions that only become redundant after the first.
+    RuleBatch* expression_simplification =
+        CreateRuleBatch<TryUntilMax>("ExpressionSimplification", 2);
+    expression_simplification->AddRule<FoldConstantExpressionsRule>();
+    expression_simplification->AddRule<CommonSubexpressionEliminationRule>();
+  }
+
   void CreateDataTypeResolutionBatch() {
     RuleBatch* intermediate_resolution_batch =
         CreateRuleBatch<FailOnMax>("DataTypeResolution", 100);
@@ -124,6 +137,7 @@ class Analyzer : public RuleExecutor<IR> {
     CreateUniqueSinkNamesBatch();
     CreateAddLimitToBatchResultSinkBatch();
     CreateCombineConsecutiveMapsRule();
+    CreateExpressionSimplificationBatch();
     CreateDataTypeResolutionBatch();
     CreateManageColumnAccessBatch();
     CreateMetadataConversionBatch();
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string>
+#include <vector>
+
+#include "src/carnot/planner/compiler/analyzer/common_subexpression_elimination_rule.h"
+#include "src/carnot/planner/ir/column_ir.h"
+#include "src/carnot/planner/ir/func_ir.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace compiler {
+
+namespace {
+
+// Collects the func subexpressions of expr in pre-order, so enclosing expressions precede
+// their arguments.
+void CollectFuncs(ExpressionIR* expr, std::vector<FuncIR*>* funcs) {
+  if (!Match(expr, Func())) {
+    return;
+  }
+  auto func = static_cast<FuncIR*>(expr);
+  funcs->push_back(func);
+  for (ExpressionIR* arg : func->all_args()) {
+    CollectFuncs(arg, funcs);
+  }
+}
+
+void MarkSubtreeCovered(ExpressionIR* expr, absl::flat_hash_set<int64_t>* covered) {
+  covered->insert(expr->id());
+  if (!Match(expr, Func())) {
+    return;
+  }
+  for (ExpressionIR* arg : static_cast<FuncIR*>(expr)->all_args()) {
+    MarkSubtreeCovered(arg, covered);
+  }
+}
+
+// Replaces old_expr with new_expr in the node holding it. The update deletes old_expr's
+// subtree once it is orphaned.
+Status ReplaceExpression(IRNode* container, ExpressionIR* old_expr, ExpressionIR* new_expr) {
+  if (Match(container, Func())) {
+    return static_cast<FuncIR*>(container)->UpdateArg(old_expr, new_expr);
+  }
+  if (Match(container, Map())) {
+    return static_cast<MapIR*>(container)->UpdateColExpr(old_expr, new_expr);
+  }
+  return error::Internal("Unsupported container for subexpression elimination: $0",
+                         container->DebugString());
+}
+
+std::string HelperColumnName(FuncIR* func) { return absl::StrCat("_cse_", func->id()); }
+
+}  // namespace
+
+StatusOr<bool> CommonSubexpressionEliminationRule::Apply(IRNode* ir_node) {
+  if (!Match(ir_node, Map())) {
+    return false;
+  }
+  return EliminateCommonSubexpressions(static_cast<MapIR*>(ir_node));
+}
+
+StatusOr<bool> CommonSubexpressionEliminationRule::EliminateCommonSubexpressions(MapIR* map) {
+  // A map that keeps its input columns would surface the helper columns of the inserted map in
+  // its own output relation, so only project-style maps are rewritten.
+  if (map->keep_input_columns()) {
+    return false;
+  }
+  DCHECK_EQ(1UL, map->parents().size());
+
+  std::vector<FuncIR*> funcs;
+  for (const auto& col_expr : map->col_exprs()) {
+    CollectFuncs(col_expr.node, &funcs);
+  }
+
+  // Group structurally-equal funcs, preserving pre-order so that larger subtrees come first.
+  std::vector<std::vector<FuncIR*>> groups;
+  for (FuncIR* func : funcs) {
+    bool found = false;
+    for (auto& group : groups) {
+      if (group[0]->Equals(func)) {
+        group.push_back(func);
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      groups.push_back({func});
+    }
+  }
+
+  // Select maximal repeated subtrees: groups nested inside an already-selected subtree are
+  // skipped, since their occurrences are computed once within the hoisted expression.
+  absl::flat_hash_set<int64_t> covered;
+  std::vector<std::vector<FuncIR*>> hoisted;
+  for (auto& group : groups) {
+    if (group.size() < 2) {
+      continue;
+    }
+    bool any_covered = false;
+    for (FuncIR* func : group) {
+      if (covered.contains(func->id())) {
+        any_covered = true;
+        break;
+      }
+    }
+    if (any_covered) {
+      continue;
+    }
+    hoisted.push_back(group);
+    for (FuncIR* func : group) {
+      MarkSubtreeCovered(func, &covered);
+    }
+  }
+  if (hoisted.empty()) {
+    return false;
+  }
+
+  auto graph = map->graph();
+  OperatorIR* old_parent = map->parents()[0];
+
+  // The inserted map computes each repeated expression once, alongside the input columns the
+  // original map still references.
+  ColExpressionVector helper_exprs;
+  for (const auto& group : hoisted) {
+    helper_exprs.emplace_back(HelperColumnName(group[0]), group[0]);
+  }
+  PX_ASSIGN_OR_RETURN(MapIR * helper_map,
+                      graph->CreateNode<MapIR>(map->ast(), old_parent, helper_exprs,
+                                               /*keep_input_columns*/ true));
+
+  for (const auto& group : hoisted) {
+    std::string col_name = HelperColumnName(group[0]);
+    for (FuncIR* occurrence : group) {
+      for (int64_t container_id : graph->dag().ParentsOf(occurrence->id())) {
+        IRNode* container = graph->Get(container_id);
+        if (container == helper_map) {
+          continue;
+        }
+        PX_ASSIGN_OR_RETURN(ColumnIR * col,
+                            graph->CreateNode<ColumnIR>(occurrence->ast(), col_name,
+                                                        /*parent_op_idx*/ 0));
+        PX_RETURN_IF_ERROR(ReplaceExpression(container, occurrence, col));
+      }
+    }
+  }
+
+  PX_RETURN_IF_ERROR(map->ReplaceParent(old_parent, helper_map));
+  return true;
+}
+
+}  // namespace compiler
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
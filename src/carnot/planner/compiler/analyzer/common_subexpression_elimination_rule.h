@@ -0,0 +1,59 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "src/carnot/planner/ir/map_ir.h"
+#include "src/carnot/planner/rules/rules.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace compiler {
+
+/**
+ * @brief This rule computes duplicated subexpressions within a map once instead of once per
+ * occurrence. Generated queries frequently reuse an expensive expression (e.g.
+ * `px.upid_to_service_name(df.upid)`) across several columns, and each occurrence otherwise
+ * becomes a separate per-row evaluation in the exec engine.
+ *
+ * Each repeated func subtree is hoisted into a new map inserted above the original, computed
+ * once into a helper column, and every occurrence in the original map is rewritten to
+ * reference that column. Scalar funcs are assumed to be pure, which holds for the builtin
+ * registry.
+ *
+ * Only maps that do not keep their input columns are rewritten: for those, the map's output
+ * is exactly its own column expressions, so the helper columns produced by the inserted map
+ * never leak into the output relation.
+ */
+class CommonSubexpressionEliminationRule : public Rule {
+ public:
+  CommonSubexpressionEliminationRule()
+      : Rule(nullptr, /*use_topo*/ true, /*reverse_topological_execution*/ false) {}
+
+ protected:
+  StatusOr<bool> Apply(IRNode* ir_node) override;
+
+ private:
+  StatusOr<bool> EliminateCommonSubexpressions(MapIR* map);
+};
+
+}  // namespace compiler
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
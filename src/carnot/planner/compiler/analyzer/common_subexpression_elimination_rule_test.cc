@@ -0,0 +1,126 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "src/carnot/planner/compiler/analyzer/common_subexpression_elimination_rule.h"
+#include "src/carnot/planner/compiler/test_utils.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace compiler {
+
+using CommonSubexpressionEliminationRuleTest = RulesTest;
+TEST_F(CommonSubexpressionEliminationRuleTest, hoists_duplicate_func) {
+  MemorySourceIR* mem_src = MakeMemSource();
+  FuncIR* service1 = MakeFunc("upid_to_service_name", {MakeColumn("upid", 0)});
+  FuncIR* service2 = MakeFunc("upid_to_service_name", {MakeColumn("upid", 0)});
+  auto map = MakeMap(
+      mem_src, {{"s1", service1}, {"s2", service2}, {"count", MakeColumn("count", 0)}}, false);
+  MakeMemSink(map, "out");
+
+  CommonSubexpressionEliminationRule rule;
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  ASSERT_TRUE(result.ConsumeValueOrDie());
+
+  // The duplicated func moves into a new map between the source and the original map, where it
+  // is computed once.
+  ASSERT_EQ(1U, map->parents().size());
+  ASSERT_MATCH(map->parents()[0], Map());
+  auto helper_map = static_cast<MapIR*>(map->parents()[0]);
+  EXPECT_THAT(helper_map->parents(), ::testing::ElementsAre(mem_src));
+  EXPECT_TRUE(helper_map->keep_input_columns());
+  ASSERT_EQ(1U, helper_map->col_exprs().size());
+  EXPECT_EQ(service1, helper_map->col_exprs()[0].node);
+
+  // Both original occurrences now reference the helper column.
+  std::string helper_col = helper_map->col_exprs()[0].name;
+  ASSERT_EQ(3U, map->col_exprs().size());
+  EXPECT_MATCH(map->col_exprs()[0].node, ColumnNode(helper_col));
+  EXPECT_MATCH(map->col_exprs()[1].node, ColumnNode(helper_col));
+  EXPECT_MATCH(map->col_exprs()[2].node, ColumnNode("count"));
+}
+
+TEST_F(CommonSubexpressionEliminationRuleTest, hoists_maximal_repeated_subtree) {
+  MemorySourceIR* mem_src = MakeMemSource();
+  FuncIR* shifted1 = MakeAddFunc(MakeColumn("count", 0), MakeInt(1));
+  FuncIR* shifted2 = MakeAddFunc(MakeColumn("count", 0), MakeInt(1));
+  auto map = MakeMap(mem_src,
+                     {{"a", MakeMultFunc(shifted1, MakeInt(2))},
+                      {"b", MakeMultFunc(shifted2, MakeInt(3))}},
+                     false);
+  MakeMemSink(map, "out");
+
+  CommonSubexpressionEliminationRule rule;
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  ASSERT_TRUE(result.ConsumeValueOrDie());
+
+  ASSERT_MATCH(map->parents()[0], Map());
+  auto helper_map = static_cast<MapIR*>(map->parents()[0]);
+  ASSERT_EQ(1U, helper_map->col_exprs().size());
+  EXPECT_EQ(shifted1, helper_map->col_exprs()[0].node);
+
+  // The enclosing multiplies stay in the original map, with the repeated subtree replaced by a
+  // reference to the helper column.
+  std::string helper_col = helper_map->col_exprs()[0].name;
+  for (const auto& col_expr : map->col_exprs()) {
+    ASSERT_MATCH(col_expr.node, Func());
+    auto func = static_cast<FuncIR*>(col_expr.node);
+    EXPECT_EQ(FuncIR::Opcode::mult, func->opcode());
+    EXPECT_MATCH(func->all_args()[0], ColumnNode(helper_col));
+  }
+}
+
+TEST_F(CommonSubexpressionEliminationRuleTest, no_change_without_duplicates) {
+  MemorySourceIR* mem_src = MakeMemSource();
+  auto map = MakeMap(mem_src,
+                     {{"a", MakeAddFunc(MakeColumn("count", 0), MakeInt(1))},
+                      {"b", MakeAddFunc(MakeColumn("count", 0), MakeInt(2))}},
+                     false);
+  MakeMemSink(map, "out");
+
+  CommonSubexpressionEliminationRule rule;
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_FALSE(result.ConsumeValueOrDie());
+  EXPECT_THAT(map->parents(), ::testing::ElementsAre(mem_src));
+}
+
+TEST_F(CommonSubexpressionEliminationRuleTest, skips_map_keeping_input_columns) {
+  MemorySourceIR* mem_src = MakeMemSource();
+  // The helper columns would leak into this map's output relation, so it is left untouched.
+  auto map = MakeMap(mem_src,
+                     {{"s1", MakeFunc("upid_to_service_name", {MakeColumn("upid", 0)})},
+                      {"s2", MakeFunc("upid_to_service_name", {MakeColumn("upid", 0)})}},
+                     true);
+  MakeMemSink(map, "out");
+
+  CommonSubexpressionEliminationRule rule;
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_FALSE(result.ConsumeValueOrDie());
+  EXPECT_THAT(map->parents(), ::testing::ElementsAre(mem_src));
+}
+
+}  // namespace compiler
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,178 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <vector>
+
+#include "src/carnot/planner/compiler/analyzer/fold_constant_expressions_rule.h"
+#include "src/carnot/planner/ir/bool_ir.h"
+#include "src/carnot/planner/ir/filter_ir.h"
+#include "src/carnot/planner/ir/float_ir.h"
+#include "src/carnot/planner/ir/int_ir.h"
+#include "src/carnot/planner/ir/map_ir.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace compiler {
+
+namespace {
+
+// Replaces old_expr with new_expr in the node holding it. The update deletes old_expr's
+// subtree once it is orphaned.
+Status ReplaceExpression(IRNode* container, ExpressionIR* old_expr, ExpressionIR* new_expr) {
+  if (Match(container, Func())) {
+    return static_cast<FuncIR*>(container)->UpdateArg(old_expr, new_expr);
+  }
+  if (Match(container, Map())) {
+    return static_cast<MapIR*>(container)->UpdateColExpr(old_expr, new_expr);
+  }
+  if (Match(container, Filter())) {
+    return static_cast<FilterIR*>(container)->SetFilterExpr(new_expr);
+  }
+  return error::Internal("Unsupported container for constant folding: $0",
+                         container->DebugString());
+}
+
+}  // namespace
+
+StatusOr<bool> FoldConstantExpressionsRule::Apply(IRNode* ir_node) {
+  if (!Match(ir_node, Func())) {
+    return false;
+  }
+  auto func = static_cast<FuncIR*>(ir_node);
+  auto graph = func->graph();
+
+  std::vector<int64_t> container_ids = graph->dag().ParentsOf(func->id());
+  if (container_ids.empty()) {
+    return false;
+  }
+  // Only fold expressions held by containers we know how to update.
+  for (int64_t container_id : container_ids) {
+    IRNode* container = graph->Get(container_id);
+    if (!Match(container, Func()) && !Match(container, Map()) && !Match(container, Filter())) {
+      return false;
+    }
+  }
+
+  PX_ASSIGN_OR_RETURN(DataIR * folded, FoldFunc(func));
+  if (folded == nullptr) {
+    return false;
+  }
+
+  for (int64_t container_id : container_ids) {
+    PX_RETURN_IF_ERROR(ReplaceExpression(graph->Get(container_id), func, folded));
+  }
+  // The last container update deletes the orphaned func subtree; guard in case edges remain.
+  if (graph->HasNode(func->id())) {
+    PX_RETURN_IF_ERROR(graph->DeleteOrphansInSubtree(func->id()));
+  }
+  return true;
+}
+
+StatusOr<DataIR*> FoldConstantExpressionsRule::FoldFunc(FuncIR* func) const {
+  if (func->all_args().size() != 2) {
+    return static_cast<DataIR*>(nullptr);
+  }
+  ExpressionIR* left = func->all_args()[0];
+  ExpressionIR* right = func->all_args()[1];
+  auto graph = func->graph();
+  auto ast = func->ast();
+
+  if (Match(left, Int()) && Match(right, Int())) {
+    int64_t a = static_cast<IntIR*>(left)->val();
+    int64_t b = static_cast<IntIR*>(right)->val();
+    switch (func->opcode()) {
+      case FuncIR::Opcode::add:
+        return graph->CreateNode<IntIR>(ast, a + b);
+      case FuncIR::Opcode::sub:
+        return graph->CreateNode<IntIR>(ast, a - b);
+      case FuncIR::Opcode::mult:
+        return graph->CreateNode<IntIR>(ast, a * b);
+      case FuncIR::Opcode::mod:
+        if (b == 0) {
+          return static_cast<DataIR*>(nullptr);
+        }
+        return graph->CreateNode<IntIR>(ast, a % b);
+      case FuncIR::Opcode::eq:
+        return graph->CreateNode<BoolIR>(ast, a == b);
+      case FuncIR::Opcode::neq:
+        return graph->CreateNode<BoolIR>(ast, a != b);
+      case FuncIR::Opcode::lt:
+        return graph->CreateNode<BoolIR>(ast, a < b);
+      case FuncIR::Opcode::gt:
+        return graph->CreateNode<BoolIR>(ast, a > b);
+      case FuncIR::Opcode::lteq:
+        return graph->CreateNode<BoolIR>(ast, a <= b);
+      case FuncIR::Opcode::gteq:
+        return graph->CreateNode<BoolIR>(ast, a >= b);
+      default:
+        return static_cast<DataIR*>(nullptr);
+    }
+  }
+
+  if (Match(left, Float()) && Match(right, Float())) {
+    double a = static_cast<FloatIR*>(left)->val();
+    double b = static_cast<FloatIR*>(right)->val();
+    switch (func->opcode()) {
+      case FuncIR::Opcode::add:
+        return graph->CreateNode<FloatIR>(ast, a + b);
+      case FuncIR::Opcode::sub:
+        return graph->CreateNode<FloatIR>(ast, a - b);
+      case FuncIR::Opcode::mult:
+        return graph->CreateNode<FloatIR>(ast, a * b);
+      case FuncIR::Opcode::eq:
+        return graph->CreateNode<BoolIR>(ast, a == b);
+      case FuncIR::Opcode::neq:
+        return graph->CreateNode<BoolIR>(ast, a != b);
+      case FuncIR::Opcode::lt:
+        return graph->CreateNode<BoolIR>(ast, a < b);
+      case FuncIR::Opcode::gt:
+        return graph->CreateNode<BoolIR>(ast, a > b);
+      case FuncIR::Opcode::lteq:
+        return graph->CreateNode<BoolIR>(ast, a <= b);
+      case FuncIR::Opcode::gteq:
+        return graph->CreateNode<BoolIR>(ast, a >= b);
+      default:
+        return static_cast<DataIR*>(nullptr);
+    }
+  }
+
+  if (Match(left, Bool()) && Match(right, Bool())) {
+    bool a = static_cast<BoolIR*>(left)->val();
+    bool b = static_cast<BoolIR*>(right)->val();
+    switch (func->opcode()) {
+      case FuncIR::Opcode::logand:
+        return graph->CreateNode<BoolIR>(ast, a && b);
+      case FuncIR::Opcode::logor:
+        return graph->CreateNode<BoolIR>(ast, a || b);
+      case FuncIR::Opcode::eq:
+        return graph->CreateNode<BoolIR>(ast, a == b);
+      case FuncIR::Opcode::neq:
+        return graph->CreateNode<BoolIR>(ast, a != b);
+      default:
+        return static_cast<DataIR*>(nullptr);
+    }
+  }
+
+  return static_cast<DataIR*>(nullptr);
+}
+
+}  // namespace compiler
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "src/carnot/planner/ir/data_ir.h"
+#include "src/carnot/planner/ir/func_ir.h"
+#include "src/carnot/planner/rules/rules.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace compiler {
+
+/**
+ * @brief This rule evaluates operator expressions whose arguments are all compile-time
+ * constants, so that e.g. `1 + 60 * 60` becomes `3601` instead of being recomputed for every
+ * row at execution time.
+ *
+ * Only operators with fixed engine semantics are folded: arithmetic and comparisons on pairs
+ * of int or float literals, and and/or on bool literals. Division is deliberately excluded
+ * because the engine's divide always produces a float, even for int inputs.
+ *
+ * The rule executes in reverse topological order so that argument expressions fold before the
+ * expressions containing them, fully folding nested constants in a single pass.
+ */
+class FoldConstantExpressionsRule : public Rule {
+ public:
+  FoldConstantExpressionsRule()
+      : Rule(nullptr, /*use_topo*/ true, /*reverse_topological_execution*/ true) {}
+
+ protected:
+  StatusOr<bool> Apply(IRNode* ir_node) override;
+
+ private:
+  // Returns the folded constant, or nullptr if func is not foldable.
+  StatusOr<DataIR*> FoldFunc(FuncIR* func) const;
+};
+
+}  // namespace compiler
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "src/carnot/planner/compiler/analyzer/fold_constant_expressions_rule.h"
+#include "src/carnot/planner/compiler/test_utils.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace compiler {
+
+using FoldConstantExpressionsRuleTest = RulesTest;
+TEST_F(FoldConstantExpressionsRuleTest, folds_nested_int_arithmetic) {
+  MemorySourceIR* mem_src = MakeMemSource();
+  auto map = MakeMap(mem_src, {{"window", MakeAddFunc(MakeInt(1), MakeMultFunc(MakeInt(60), MakeInt(60)))}},
+                     false);
+  MakeMemSink(map, "out");
+
+  FoldConstantExpressionsRule rule;
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  ASSERT_TRUE(result.ConsumeValueOrDie());
+
+  // Both the inner multiply and the outer add fold in a single pass.
+  ASSERT_EQ(1U, map->col_exprs().size());
+  EXPECT_MATCH(map->col_exprs()[0].node, Int(3601));
+}
+
+TEST_F(FoldConstantExpressionsRuleTest, folds_filter_comparison) {
+  MemorySourceIR* mem_src = MakeMemSource();
+  auto filter = MakeFilter(mem_src, MakeEqualsFunc(MakeInt(2), MakeInt(2)));
+  MakeMemSink(filter, "out");
+
+  FoldConstantExpressionsRule rule;
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  ASSERT_TRUE(result.ConsumeValueOrDie());
+
+  EXPECT_MATCH(filter->filter_expr(), Bool(true));
+}
+
+TEST_F(FoldConstantExpressionsRuleTest, folds_constant_arg_of_non_constant_func) {
+  MemorySourceIR* mem_src = MakeMemSource();
+  FuncIR* outer = MakeAddFunc(MakeColumn("count", 0), MakeAddFunc(MakeInt(1), MakeInt(2)));
+  auto map = MakeMap(mem_src, {{"count_shifted", outer}}, false);
+  MakeMemSink(map, "out");
+
+  FoldConstantExpressionsRule rule;
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  ASSERT_TRUE(result.ConsumeValueOrDie());
+
+  // The outer func still depends on a column, but its constant arg folds.
+  ASSERT_EQ(map->col_exprs()[0].node, outer);
+  ASSERT_EQ(2U, outer->all_args().size());
+  EXPECT_MATCH(outer->all_args()[0], ColumnNode("count"));
+  EXPECT_MATCH(outer->all_args()[1], Int(3));
+}
+
+TEST_F(FoldConstantExpressionsRuleTest, does_not_fold_division) {
+  MemorySourceIR* mem_src = MakeMemSource();
+  // The engine's divide always produces a float, so int division must not fold.
+  FuncIR* div = graph
+                    ->CreateNode<FuncIR>(ast, FuncIR::op_map.find("/")->second,
+                                         std::vector<ExpressionIR*>{MakeInt(4), MakeInt(2)})
+                    .ConsumeValueOrDie();
+  auto map = MakeMap(mem_src, {{"ratio", div}}, false);
+  MakeMemSink(map, "out");
+
+  FoldConstantExpressionsRule rule;
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_FALSE(result.ConsumeValueOrDie());
+  EXPECT_EQ(map->col_exprs()[0].node, div);
+}
+
+}  // namespace compiler
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <queue>
+
+#include "src/carnot/planner/compiler/analyzer/resolve_sample_rule.h"
+#include "src/carnot/planner/ir/sample_ir.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace compiler {
+
+StatusOr<bool> ResolveSampleRule::Apply(IRNode* ir_node) {
+  if (!Match(ir_node, Sample())) {
+    return false;
+  }
+
+  auto sample_node = static_cast<SampleIR*>(ir_node);
+
+  // Push the sampling rate down into every ancestor MemorySource. The result is approximate by
+  // definition, so unlike streaming there is no restriction on the operators in between.
+  DCHECK_EQ(sample_node->parents().size(), 1UL);
+  OperatorIR* parent = sample_node->parents()[0];
+  std::queue<OperatorIR*> nodes;
+  nodes.push(parent);
+
+  while (nodes.size()) {
+    auto node = nodes.front();
+    nodes.pop();
+
+    if (Match(node, MemorySource())) {
+      static_cast<MemorySourceIR*>(node)->set_sample_every_n(sample_node->sample_every_n());
+    }
+    auto node_parents = node->parents();
+    for (OperatorIR* node_parent : node_parents) {
+      nodes.push(node_parent);
+    }
+  }
+
+  // Reattach the children to the parent and remove the sample node from the graph.
+  auto children = sample_node->Children();
+  for (OperatorIR* child : children) {
+    PX_RETURN_IF_ERROR(child->ReplaceParent(sample_node, parent));
+  }
+
+  PX_RETURN_IF_ERROR(sample_node->RemoveParent(parent));
+  PX_RETURN_IF_ERROR(parent->graph()->DeleteNode(sample_node->id()));
+  return true;
+}
+
+}  // namespace compiler
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "src/carnot/planner/compiler/analyzer/resolve_sample_rule.h"
+#include "src/carnot/planner/compiler/test_utils.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace compiler {
+
+using ::testing::ElementsAre;
+
+TEST_F(RulesTest, resolve_sample) {
+  MemorySourceIR* src = MakeMemSource();
+  FilterIR* filter = MakeFilter(src);
+  SampleIR* sample = graph->CreateNode<SampleIR>(ast, filter, /*sample_every_n*/ 100).ValueOrDie();
+  MemorySinkIR* sink = MakeMemSink(sample, "");
+  auto sample_id = sample->id();
+
+  EXPECT_TRUE(graph->dag().HasNode(sample_id));
+  EXPECT_EQ(0, src->sample_every_n());
+
+  ResolveSampleRule rule;
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_TRUE(result.ValueOrDie());
+  EXPECT_FALSE(graph->dag().HasNode(sample_id));
+  EXPECT_EQ(100, src->sample_every_n());
+  EXPECT_THAT(sink->parents(), ElementsAre(filter));
+}
+
+TEST_F(RulesTest, resolve_sample_no_sample) {
+  MemorySourceIR* mem_source = MakeMemSource();
+  FilterIR* filter = MakeFilter(mem_source);
+  MakeMemSink(filter, "");
+
+  ResolveSampleRule rule;
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_FALSE(result.ValueOrDie());
+  EXPECT_EQ(0, mem_source->sample_every_n());
+}
+
+// Unlike streaming, sampling past a blocking operator is allowed: the result is approximate by
+// definition.
+TEST_F(RulesTest, resolve_sample_blocking_ancestor) {
+  MemorySourceIR* mem_source = MakeMemSource();
+  GroupByIR* group_by = MakeGroupBy(mem_source, {MakeColumn("col1", 0), MakeColumn("col2", 0)});
+  BlockingAggIR* agg =
+      MakeBlockingAgg(group_by, {}, {{"outcount", MakeMeanFunc(MakeColumn("count", 0))}});
+  SampleIR* sample = graph->CreateNode<SampleIR>(ast, agg, /*sample_every_n*/ 10).ValueOrDie();
+  MemorySinkIR* sink = MakeMemSink(sample, "");
+
+  ResolveSampleRule rule;
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_TRUE(result.ValueOrDie());
+  EXPECT_EQ(10, mem_source->sample_every_n());
+  EXPECT_THAT(sink->parents(), ElementsAre(agg));
+}
+
+}  // namespace compiler
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -16,34 +16,94 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <regex>
 #include <sole.hpp>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include <absl/container/flat_hash_set.h>
 #include <pypa/ast/tree_walker.hh>
 #include <pypa/parser/parser.hh>
 
 #include "src/carnot/planner/compiler/analyzer/analyzer.h"
+#include "src/carnot/planner/compiler/analyzer/unique_sink_names_rule.h"
 #include "src/carnot/planner/compiler/compiler.h"
 #include "src/carnot/planner/compiler/optimizer/optimizer.h"
 #include "src/carnot/planner/ir/ir.h"
 #include "src/carnot/planner/objects/pixie_module.h"
 #include "src/carnot/planner/parser/parser.h"
 #include "src/carnot/planpb/plan.pb.h"
+#include "src/common/base/base.h"
 #include "src/shared/scriptspb/scripts.pb.h"
 
 constexpr char kPxlViews[] = (
 #include "src/carnot/planner/pxl_lib/pxviews.pxl"
 );
+
+DEFINE_int32(carnot_compiler_parallel_flows,
+             gflags::Int32FromEnv("PL_CARNOT_COMPILER_PARALLEL_FLOWS", 8),
+             "Maximum number of worker threads used to analyze independent query flows in "
+             "parallel. Values below 2 disable parallel compilation.");
+
 namespace px {
 namespace carnot {
 namespace planner {
 namespace compiler {
 
+namespace {
+
+// Groups the graph's operators into connected components, treating every edge (operator-operator
+// and operator-expression alike) as undirected. Operators in different components never interact
+// during analysis or optimization, so the components can be processed independently.
+std::vector<absl::flat_hash_set<OperatorIR*>> IndependentOperatorSubgraphs(const IR* ir) {
+  absl::flat_hash_set<int64_t> visited;
+  std::vector<absl::flat_hash_set<OperatorIR*>> components;
+  std::vector<int64_t> node_ids(ir->dag().nodes().begin(), ir->dag().nodes().end());
+  std::sort(node_ids.begin(), node_ids.end());
+  for (int64_t start : node_ids) {
+    if (visited.contains(start)) {
+      continue;
+    }
+    absl::flat_hash_set<OperatorIR*> ops;
+    std::vector<int64_t> stack{start};
+    visited.insert(start);
+    while (!stack.empty()) {
+      int64_t id = stack.back();
+      stack.pop_back();
+      IRNode* node = ir->Get(id);
+      if (node != nullptr && node->IsOperator()) {
+        ops.insert(static_cast<OperatorIR*>(node));
+      }
+      for (int64_t neighbor : ir->dag().DependenciesOf(id)) {
+        if (visited.insert(neighbor).second) {
+          stack.push_back(neighbor);
+        }
+      }
+      for (int64_t neighbor : ir->dag().ParentsOf(id)) {
+        if (visited.insert(neighbor).second) {
+          stack.push_back(neighbor);
+        }
+      }
+    }
+    if (!ops.empty()) {
+      components.push_back(std::move(ops));
+    }
+  }
+  return components;
+}
+
+// Node ids each independent flow may allocate during analysis before colliding with the next
+// flow's range. Analysis creates at most a handful of nodes per operator, so 2^20 ids per flow
+// is far beyond any realistic plan.
+constexpr int64_t kFlowNodeIdStride = int64_t{1} << 20;
+
+}  // namespace
+
 StatusOr<planpb::Plan> Compiler::Compile(const std::string& query, CompilerState* compiler_state) {
   return Compile(query, compiler_state, /* exec_funcs */ {});
 }
@@ -63,8 +123,7 @@ StatusOr<std::shared_ptr<IR>> Compiler::CompileToIR(const std::string& query,
                                                     CompilerState* compiler_state,
                                                     const ExecFuncs& exec_funcs) {
   PX_ASSIGN_OR_RETURN(std::shared_ptr<IR> ir, QueryToIR(query, compiler_state, exec_funcs));
-  PX_RETURN_IF_ERROR(Analyze(ir.get(), compiler_state));
-  PX_RETURN_IF_ERROR(Optimize(ir.get(), compiler_state));
+  PX_ASSIGN_OR_RETURN(ir, AnalyzeAndOptimize(std::move(ir), compiler_state));
 
   PX_RETURN_IF_ERROR(VerifyGraphHasResultSink(ir.get()));
   return ir;
@@ -80,6 +139,72 @@ Status Compiler::Optimize(IR* ir, CompilerState* compiler_state) {
   return optimizer->Execute(ir);
 }
 
+StatusOr<std::shared_ptr<IR>> Compiler::AnalyzeAndOptimize(std::shared_ptr<IR> ir,
+                                                           CompilerState* compiler_state) {
+  auto components = IndependentOperatorSubgraphs(ir.get());
+  if (FLAGS_carnot_compiler_parallel_flows < 2 || components.size() < 2) {
+    PX_RETURN_IF_ERROR(Analyze(ir.get(), compiler_state));
+    PX_RETURN_IF_ERROR(Optimize(ir.get(), compiler_state));
+    return ir;
+  }
+
+  // Sink name de-duplication is inherently cross-flow, so it runs on the full graph before the
+  // flows are analyzed independently; the per-flow pass then sees unique names and is a no-op.
+  UniqueSinkNameRule unique_sink_names;
+  PX_RETURN_IF_ERROR(unique_sink_names.Execute(ir.get()).status());
+
+  int64_t max_node_id = 0;
+  for (int64_t node_id : ir->dag().nodes()) {
+    max_node_id = std::max(max_node_id, node_id);
+  }
+
+  // Each flow is copied into its own graph with its original node ids and allocates new ids from
+  // a disjoint range, so the analyzed flows can be merged back without collisions.
+  std::vector<std::unique_ptr<IR>> flows(components.size());
+  for (size_t i = 0; i < components.size(); ++i) {
+    flows[i] = std::make_unique<IR>();
+    PX_RETURN_IF_ERROR(flows[i]->CopyOperatorSubgraph(ir.get(), components[i]));
+    flows[i]->ReserveNodeIdsFrom(max_node_id + 1 + static_cast<int64_t>(i) * kFlowNodeIdStride);
+  }
+
+  std::vector<Status> results(flows.size());
+  const size_t num_workers =
+      std::min<size_t>(flows.size(), FLAGS_carnot_compiler_parallel_flows);
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers);
+  for (size_t w = 0; w < num_workers; ++w) {
+    workers.emplace_back([this, w, num_workers, compiler_state, &flows, &results] {
+      for (size_t i = w; i < flows.size(); i += num_workers) {
+        auto status = Analyze(flows[i].get(), compiler_state);
+        if (status.ok()) {
+          status = Optimize(flows[i].get(), compiler_state);
+        }
+        results[i] = status;
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  // Surface the error from the earliest flow so error reporting stays deterministic.
+  for (const auto& status : results) {
+    PX_RETURN_IF_ERROR(status);
+  }
+
+  auto merged = std::make_shared<IR>();
+  for (const auto& flow : flows) {
+    absl::flat_hash_set<OperatorIR*> flow_ops;
+    for (int64_t node_id : flow->dag().nodes()) {
+      IRNode* node = flow->Get(node_id);
+      if (node != nullptr && node->IsOperator()) {
+        flow_ops.insert(static_cast<OperatorIR*>(node));
+      }
+    }
+    PX_RETURN_IF_ERROR(merged->CopyOperatorSubgraph(flow.get(), flow_ops));
+  }
+  return merged;
+}
+
 StatusOr<std::shared_ptr<IR>> Compiler::QueryToIR(const std::string& query,
                                                   CompilerState* compiler_state,
                                                   const ExecFuncs& exec_funcs) {
@@ -28,6 +28,8 @@
 #include "src/carnot/planner/ir/ir.h"
 #include "src/carnot/planpb/plan.pb.h"
 
+DECLARE_int32(carnot_compiler_parallel_flows);
+
 namespace px {
 namespace carnot {
 namespace planner {
@@ -71,6 +73,17 @@ class Compiler {
 
   Status Analyze(IR* ir, CompilerState* compiler_state);
   Status Optimize(IR* ir, CompilerState* compiler_state);
+
+  /**
+   * @brief Runs the analyzer and optimizer over the parsed graph. When the graph contains
+   * several independent query flows (e.g. dashboards issuing many display calls), each flow is
+   * copied into its own graph, analyzed on a worker thread, and merged back into a single graph.
+   * Sink name de-duplication is inherently cross-flow and runs on the full graph beforehand;
+   * the MergeNodes optimization then only applies within a flow.
+   */
+  StatusOr<std::shared_ptr<IR>> AnalyzeAndOptimize(std::shared_ptr<IR> ir,
+                                                   CompilerState* compiler_state);
+
   Status VerifyGraphHasResultSink(IR* ir);
 };
 
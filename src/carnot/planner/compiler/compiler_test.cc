@@ -3256,6 +3256,43 @@ TEST_F(CompilerTest, pxviews) {
       compiler_state_.get()));
 }
 
+constexpr char kIndependentFlowsQuery[] = R"pxl(
+import px
+df1 = px.DataFrame(table='cpu', select=['count', 'cpu0'])
+df1.cpu_sum = df1.cpu0 + df1.cpu0
+px.display(df1, 'out')
+df2 = px.DataFrame(table='http_table', select=['time_', 'resp_status'])
+df2 = df2[df2.resp_status == 200]
+px.display(df2, 'out')
+)pxl";
+
+TEST_F(CompilerTest, independent_flows_analyzed_in_parallel) {
+  ASSERT_OK_AND_ASSIGN(auto ir,
+                       compiler_.CompileToIR(kIndependentFlowsQuery, compiler_state_.get()));
+  // Sink names are de-duplicated across flows even though the flows are analyzed independently.
+  absl::flat_hash_set<std::string> sink_names;
+  for (auto* node : ir->FindNodesOfType(IRNodeType::kGRPCSink)) {
+    sink_names.insert(static_cast<GRPCSinkIR*>(node)->name());
+  }
+  EXPECT_THAT(sink_names, ::testing::UnorderedElementsAre("out", "out_1"));
+  // The merged graph keeps the analysis results of every flow and still serializes.
+  for (auto* node : ir->FindNodesThatMatch(Operator())) {
+    EXPECT_TRUE(static_cast<OperatorIR*>(node)->is_type_resolved()) << node->DebugString();
+  }
+  EXPECT_OK(ir->ToProto());
+}
+
+TEST_F(CompilerTest, independent_flows_serial_fallback) {
+  PX_SET_FOR_SCOPE(FLAGS_carnot_compiler_parallel_flows, 1);
+  ASSERT_OK_AND_ASSIGN(auto ir,
+                       compiler_.CompileToIR(kIndependentFlowsQuery, compiler_state_.get()));
+  absl::flat_hash_set<std::string> sink_names;
+  for (auto* node : ir->FindNodesOfType(IRNodeType::kGRPCSink)) {
+    sink_names.insert(static_cast<GRPCSinkIR*>(node)->name());
+  }
+  EXPECT_THAT(sink_names, ::testing::UnorderedElementsAre("out", "out_1"));
+}
+
 }  // namespace compiler
 }  // namespace planner
 }  // namespace carnot
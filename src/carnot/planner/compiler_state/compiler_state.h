@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -105,8 +106,16 @@ struct DebugInfo {
   std::vector<OTelDebugAttribute> otel_debug_attrs;
 };
 
+// Aggregate size statistics for one table's stored data, as reported by the agents holding it.
+// Zero values mean the sizes are unknown.
+struct TableSizeStats {
+  uint64_t bytes = 0;
+  uint64_t num_rows = 0;
+};
+
 using RelationMap = std::unordered_map<std::string, table_store::schema::Relation>;
 using SensitiveColumnMap = absl::flat_hash_map<std::string, absl::flat_hash_set<std::string>>;
+using TableStatsMap = absl::flat_hash_map<std::string, TableSizeStats>;
 class CompilerState : public NotCopyable {
  public:
   /**
@@ -139,7 +148,13 @@ class CompilerState : public NotCopyable {
     return &table_names_to_sensitive_columns_;
   }
   RegistryInfo* registry_info() const { return registry_info_; }
-  types::Time64NSValue time_now() const { return time_now_; }
+  types::Time64NSValue time_now() const {
+    time_now_accessed_ = true;
+    return time_now_;
+  }
+  // Whether the compilation read the current time. Such plans embed absolute timestamps resolved
+  // from compile time (px.now(), relative start_times) and must not be reused across executions.
+  bool time_now_accessed() const { return time_now_accessed_; }
   const std::string& result_address() const { return result_address_; }
   const std::string& result_ssl_targetname() const { return result_ssl_targetname_; }
 
@@ -172,6 +187,13 @@ class CompilerState : public NotCopyable {
   const RedactionOptions& redaction_options() { return redaction_options_; }
   void set_redaction_options(const RedactionOptions& options) { redaction_options_ = options; }
 
+  // Table size statistics used by cost-based planner rules. May be empty when the agents did not
+  // report stats, in which case those rules leave the plan untouched.
+  const TableStatsMap& table_stats_map() const { return table_stats_map_; }
+  void set_table_stats_map(TableStatsMap table_stats_map) {
+    table_stats_map_ = std::move(table_stats_map);
+  }
+
   planpb::OTelEndpointConfig* endpoint_config() { return endpoint_config_.get(); }
   PluginConfig* plugin_config() { return plugin_config_.get(); }
   const DebugInfo& debug_info() { return debug_info_; }
@@ -181,6 +203,9 @@ class CompilerState : public NotCopyable {
   SensitiveColumnMap table_names_to_sensitive_columns_;
   RegistryInfo* registry_info_;
   types::Time64NSValue time_now_;
+  // Atomic because independent query flows may be analyzed on concurrent worker threads that
+  // share this compiler state.
+  mutable std::atomic<bool> time_now_accessed_ = false;
   std::map<IDRegistryKey, int64_t> udf_to_id_map_;
   std::map<IDRegistryKey, int64_t> uda_to_id_map_;
 
@@ -188,6 +213,7 @@ class CompilerState : public NotCopyable {
   const std::string result_address_;
   const std::string result_ssl_targetname_;
   RedactionOptions redaction_options_;
+  TableStatsMap table_stats_map_;
   std::unique_ptr<planpb::OTelEndpointConfig> endpoint_config_ = nullptr;
   std::unique_ptr<PluginConfig> plugin_config_ = nullptr;
   DebugInfo debug_info_;
@@ -28,12 +28,18 @@
 #include "src/carnot/planner/distributed/coordinator/plan_clusters.h"
 #include "src/carnot/planner/distributed/coordinator/prune_unavailable_sources_rule.h"
 #include "src/carnot/planner/distributed/coordinator/removable_ops_rule.h"
+#include "src/carnot/planner/distributed/coordinator/shuffle_across_kelvins.h"
 #include "src/carnot/planner/distributed/splitter/splitter.h"
 #include "src/carnot/planner/rules/rules.h"
 #include "src/carnot/udfspb/udfs.pb.h"
 #include "src/common/uuid/uuid.h"
 #include "src/shared/upid/upid.h"
 
+DEFINE_bool(carnot_multi_kelvin_shuffle,
+            gflags::BoolFromEnv("PL_CARNOT_MULTI_KELVIN_SHUFFLE", true),
+            "Whether to hash-partition partial aggregate results across all available Kelvin "
+            "instances instead of funneling them into a single Kelvin.");
+
 namespace px {
 namespace carnot {
 namespace planner {
@@ -201,6 +207,23 @@ StatusOr<std::unique_ptr<DistributedPlan>> CoordinatorImpl::CoordinateImpl(const
     source_node_ids.push_back(source_node_id);
   }
 
+  // Spread finalize aggregates across any additional Kelvin instances. This must run before
+  // GetUniquePEMPlans so the shuffle marking on the PEM sinks survives the per-agent cloning.
+  if (FLAGS_carnot_multi_kelvin_shuffle && remote_processor_nodes_.size() > 1) {
+    std::vector<CarnotInfo> extra_kelvins(remote_processor_nodes_.begin() + 1,
+                                          remote_processor_nodes_.end());
+    PX_ASSIGN_OR_RETURN(std::vector<int64_t> shuffle_kelvin_ids,
+                        ShuffleAggregatesAcrossKelvins(distributed_plan.get(), remote_carnot,
+                                                       split_plan->before_blocking.get(),
+                                                       extra_kelvins));
+    for (int64_t shuffle_kelvin_id : shuffle_kelvin_ids) {
+      for (int64_t source_node_id : source_node_ids) {
+        distributed_plan->AddEdge(source_node_id, shuffle_kelvin_id);
+      }
+      distributed_plan->AddEdge(shuffle_kelvin_id, remote_node_id);
+    }
+  }
+
   PX_ASSIGN_OR_RETURN(auto agent_schema_map,
                       LoadSchemaMap(*distributed_state_, distributed_plan->uuid_to_id_map()));
 
@@ -169,6 +169,65 @@ TEST_F(CoordinatorTest, one_pem_three_kelvin) {
   }
 }
 
+TEST_F(CoordinatorTest, one_pem_three_kelvins_shuffles_agg) {
+  auto ps = LoadDistributedStatePb(kOnePEMThreeKelvinsDistributedState);
+  auto coordinator = Coordinator::Create(compiler_state_.get(), ps).ConsumeValueOrDie();
+
+  auto mem_src = MakeMemSource(MakeRelation());
+  compiler_state_->relation_map()->emplace("table", MakeRelation());
+  auto mean_func = MakeMeanFuncWithFloatType(MakeColumn("cpu0", 0, types::DataType::FLOAT64));
+  auto agg = MakeBlockingAgg(mem_src, {MakeColumn("count", 0, types::DataType::INT64)},
+                             {{"mean", mean_func}});
+  MakeMemSink(agg, "out");
+  ResolveTypesRule rule(compiler_state_.get());
+  ASSERT_OK(rule.Execute(graph.get()));
+
+  auto physical_plan = coordinator->Coordinate(graph.get()).ConsumeValueOrDie();
+  // The PEM, the primary Kelvin, and one instance per extra Kelvin that finalizes a hash
+  // partition of the aggregate.
+  ASSERT_EQ(physical_plan->dag().nodes().size(), 4UL);
+
+  // The PEM's partial agg sink should be marked as shuffled by the group column.
+  auto pem_instance = physical_plan->Get(1);
+  EXPECT_THAT(pem_instance->carnot_info().query_broker_address(), ContainsRegex("pem"));
+  auto pem_sinks = pem_instance->plan()->FindNodesThatMatch(InternalGRPCSink());
+  ASSERT_EQ(pem_sinks.size(), 1);
+  auto pem_sink = static_cast<GRPCSinkIR*>(pem_sinks[0]);
+  EXPECT_TRUE(pem_sink->is_shuffle());
+  EXPECT_THAT(pem_sink->shuffle_key_columns(), ElementsAre("count"));
+
+  // The primary Kelvin unions its own finalize agg with the results of the extra Kelvins.
+  auto kelvin_instance = physical_plan->Get(0);
+  EXPECT_THAT(kelvin_instance->carnot_info().query_broker_address(), ContainsRegex("kelvin"));
+  auto union_nodes = kelvin_instance->plan()->FindNodesOfType(IRNodeType::kUnion);
+  ASSERT_EQ(union_nodes.size(), 1);
+  auto union_op = static_cast<UnionIR*>(union_nodes[0]);
+  ASSERT_EQ(union_op->parents().size(), 3);
+  EXPECT_MATCH(union_op->parents()[0], FinalizeAgg());
+  EXPECT_MATCH(union_op->parents()[1], GRPCSourceGroup());
+  EXPECT_MATCH(union_op->parents()[2], GRPCSourceGroup());
+
+  // Each extra Kelvin finalizes its partition and sends the result back to the primary.
+  for (int64_t extra_kelvin_id : {2, 3}) {
+    SCOPED_TRACE(absl::Substitute("extra kelvin $0", extra_kelvin_id));
+    auto extra_instance = physical_plan->Get(extra_kelvin_id);
+    EXPECT_THAT(extra_instance->carnot_info().query_broker_address(), ContainsRegex("kelvin"));
+    IR* extra_plan = extra_instance->plan();
+    auto source_groups = extra_plan->FindNodesThatMatch(GRPCSourceGroup());
+    ASSERT_EQ(source_groups.size(), 1);
+    auto source_group = static_cast<GRPCSourceGroupIR*>(source_groups[0]);
+    EXPECT_EQ(source_group->source_id(), pem_sink->destination_id());
+    ASSERT_EQ(source_group->Children().size(), 1);
+    ASSERT_MATCH(source_group->Children()[0], FinalizeAgg());
+    auto extra_agg = static_cast<BlockingAggIR*>(source_group->Children()[0]);
+    ASSERT_EQ(extra_agg->Children().size(), 1);
+    ASSERT_MATCH(extra_agg->Children()[0], InternalGRPCSink());
+    // The result bridge back to the primary must not collide with the PEM bridge.
+    auto result_sink = static_cast<GRPCSinkIR*>(extra_agg->Children()[0]);
+    EXPECT_NE(result_sink->destination_id(), pem_sink->destination_id());
+  }
+}
+
 constexpr char kBadAgentSpecificationState[] = R"proto(
 carnot_info {
   query_broker_address: "pem"
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/carnot/planner/distributed/coordinator/shuffle_across_kelvins.h"
+#include "src/carnot/planner/ir/blocking_agg_ir.h"
+#include "src/carnot/planner/ir/grpc_sink_ir.h"
+#include "src/carnot/planner/ir/grpc_source_group_ir.h"
+#include "src/carnot/planner/ir/pattern_match.h"
+#include "src/carnot/planner/ir/union_ir.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace distributed {
+
+namespace {
+
+// A GRPCSourceGroup -> finalize agg pair in the primary Kelvin plan that can be spread across
+// Kelvins, along with the PEM sink that feeds the bridge.
+struct ShuffleCandidate {
+  GRPCSourceGroupIR* source_group;
+  BlockingAggIR* agg;
+  GRPCSinkIR* pem_sink;
+};
+
+StatusOr<std::vector<ShuffleCandidate>> FindShuffleCandidates(IR* primary_plan, IR* pem_plan) {
+  std::vector<ShuffleCandidate> candidates;
+  for (IRNode* node : primary_plan->FindNodesThatMatch(GRPCSourceGroup())) {
+    auto source_group = static_cast<GRPCSourceGroupIR*>(node);
+    if (source_group->Children().size() != 1) {
+      continue;
+    }
+    OperatorIR* child = source_group->Children()[0];
+    // Only finalize-only aggs benefit: each Kelvin can merge the partial aggregates of its hash
+    // partition independently. Group-by-all aggs have a single output group and can't be split.
+    if (!Match(child, FinalizeAgg())) {
+      continue;
+    }
+    auto agg = static_cast<BlockingAggIR*>(child);
+    if (agg->group_by_all()) {
+      continue;
+    }
+    // Find the PEM-side sink that feeds this bridge.
+    GRPCSinkIR* pem_sink = nullptr;
+    for (IRNode* sink_node : pem_plan->FindNodesThatMatch(InternalGRPCSink())) {
+      auto sink = static_cast<GRPCSinkIR*>(sink_node);
+      if (sink->destination_id() == source_group->source_id()) {
+        pem_sink = sink;
+        break;
+      }
+    }
+    if (pem_sink == nullptr) {
+      continue;
+    }
+    candidates.push_back(ShuffleCandidate{source_group, agg, pem_sink});
+  }
+  return candidates;
+}
+
+// Returns a bridge id that doesn't collide with the ids the Splitter assigned.
+int64_t NextAvailableBridgeID(IR* primary_plan) {
+  int64_t max_id = 0;
+  for (IRNode* node : primary_plan->FindNodesThatMatch(GRPCSourceGroup())) {
+    max_id = std::max(max_id, static_cast<GRPCSourceGroupIR*>(node)->source_id());
+  }
+  for (IRNode* node : primary_plan->FindNodesThatMatch(InternalGRPCSink())) {
+    max_id = std::max(max_id, static_cast<GRPCSinkIR*>(node)->destination_id());
+  }
+  return max_id + 1;
+}
+
+}  // namespace
+
+StatusOr<std::vector<int64_t>> ShuffleAggregatesAcrossKelvins(
+    DistributedPlan* distributed_plan, CarnotInstance* primary_kelvin, IR* pem_plan,
+    const std::vector<distributedpb::CarnotInfo>& extra_kelvins) {
+  IR* primary_plan = primary_kelvin->plan();
+  PX_ASSIGN_OR_RETURN(std::vector<ShuffleCandidate> candidates,
+                      FindShuffleCandidates(primary_plan, pem_plan));
+  if (candidates.empty() || extra_kelvins.empty()) {
+    return std::vector<int64_t>{};
+  }
+
+  // Mark the PEM sinks as shuffled by the group columns. This must happen before the PEM plans
+  // are cloned per agent so every clone carries the marking.
+  for (const auto& candidate : candidates) {
+    std::vector<std::string> key_columns;
+    for (ColumnIR* group : candidate.agg->groups()) {
+      key_columns.push_back(group->col_name());
+    }
+    candidate.pem_sink->SetShuffleKeyColumns(std::move(key_columns));
+  }
+
+  absl::flat_hash_set<OperatorIR*> ops_to_copy;
+  for (const auto& candidate : candidates) {
+    ops_to_copy.insert(candidate.source_group);
+    ops_to_copy.insert(candidate.agg);
+  }
+
+  int64_t bridge_id_counter = NextAvailableBridgeID(primary_plan);
+  std::vector<int64_t> kelvin_ids;
+  // Per candidate, the source groups in the primary plan that receive the extra Kelvins' results.
+  std::vector<std::vector<GRPCSourceGroupIR*>> result_source_groups(candidates.size());
+  for (const auto& kelvin_info : extra_kelvins) {
+    PX_ASSIGN_OR_RETURN(int64_t kelvin_id, distributed_plan->AddCarnot(kelvin_info));
+    kelvin_ids.push_back(kelvin_id);
+
+    auto subplan_uptr = std::make_unique<IR>();
+    IR* subplan = subplan_uptr.get();
+    PX_RETURN_IF_ERROR(subplan->CopyOperatorSubgraph(primary_plan, ops_to_copy));
+    for (const auto& [i, candidate] : Enumerate(candidates)) {
+      // CopyOperatorSubgraph preserves node ids, so the copies can be looked up directly.
+      auto agg_copy = static_cast<OperatorIR*>(subplan->Get(candidate.agg->id()));
+      int64_t bridge_id = bridge_id_counter++;
+      PX_ASSIGN_OR_RETURN(GRPCSinkIR * result_sink,
+                          subplan->CreateNode<GRPCSinkIR>(agg_copy->ast(), agg_copy, bridge_id));
+      PX_RETURN_IF_ERROR(result_sink->SetResolvedType(agg_copy->resolved_type()));
+
+      PX_ASSIGN_OR_RETURN(GRPCSourceGroupIR * result_source_group,
+                          primary_plan->CreateNode<GRPCSourceGroupIR>(
+                              candidate.agg->ast(), bridge_id, candidate.agg->resolved_type()));
+      result_source_groups[i].push_back(result_source_group);
+    }
+    distributed_plan->Get(kelvin_id)->AddPlan(subplan);
+    distributed_plan->AddPlan(std::move(subplan_uptr));
+  }
+
+  // Union each primary finalize agg with the results of the extra Kelvins.
+  for (const auto& [i, candidate] : Enumerate(candidates)) {
+    std::vector<OperatorIR*> union_parents{candidate.agg};
+    union_parents.insert(union_parents.end(), result_source_groups[i].begin(),
+                         result_source_groups[i].end());
+    auto agg_children = candidate.agg->Children();
+    PX_ASSIGN_OR_RETURN(UnionIR * union_op, primary_plan->CreateNode<UnionIR>(
+                                                candidate.agg->ast(), union_parents));
+    PX_RETURN_IF_ERROR(union_op->SetResolvedType(candidate.agg->resolved_type()));
+    PX_RETURN_IF_ERROR(union_op->SetDefaultColumnMapping());
+    for (OperatorIR* child : agg_children) {
+      PX_RETURN_IF_ERROR(child->ReplaceParent(candidate.agg, union_op));
+    }
+  }
+  return kelvin_ids;
+}
+
+}  // namespace distributed
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
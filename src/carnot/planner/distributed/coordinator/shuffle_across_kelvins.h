@@ -0,0 +1,58 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+#include <vector>
+
+#include "src/carnot/planner/distributed/distributed_plan/distributed_plan.h"
+#include "src/carnot/planner/ir/ir.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace distributed {
+
+/**
+ * @brief Spreads finalize aggregates in the primary Kelvin plan across extra Kelvin instances
+ * by hash-partitioning the partial aggregate output of the PEMs on the group-by columns.
+ *
+ * For every GRPCSourceGroup in the primary Kelvin plan whose only child is a finalize-only
+ * BlockingAgg with a non-empty group-by, the corresponding PEM GRPCSink is marked as shuffled by
+ * the group columns. Each extra Kelvin gets a copy of the (source group, finalize agg) pair
+ * followed by a new GRPCSink back to the primary, and the primary unions its own finalize agg
+ * output with the results of the extra Kelvins. The fan-out of the PEM sinks themselves happens
+ * during plan stitching, once the GRPCSourceGroups of every Kelvin are expanded.
+ *
+ * Must run before the PEM plans are cloned per-agent so the shuffle marking propagates to every
+ * PEM plan, and before StitchPlan so the new bridges get connected.
+ *
+ * @param distributed_plan: the distributed plan to add the extra Kelvin instances to.
+ * @param primary_kelvin: the Kelvin instance that produces the final query result.
+ * @param pem_plan: the shared before-blocking plan that runs on the PEMs.
+ * @param extra_kelvins: Kelvin-capable Carnot instances beyond the primary.
+ * @return the distributed plan ids of the Kelvin instances that were added, empty if the plan has
+ * no aggregate that can be shuffled.
+ */
+StatusOr<std::vector<int64_t>> ShuffleAggregatesAcrossKelvins(
+    DistributedPlan* distributed_plan, CarnotInstance* primary_kelvin, IR* pem_plan,
+    const std::vector<distributedpb::CarnotInfo>& extra_kelvins);
+
+}  // namespace distributed
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
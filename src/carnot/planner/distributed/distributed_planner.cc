@@ -16,6 +16,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -49,23 +50,59 @@ Status StitchPlan(DistributedPlan* distributed_plan) {
   IR* remote_plan = remote_carnot->plan();
   DCHECK(remote_plan);
 
+  // All Kelvin instances, primary first. Extra Kelvins added by the shuffle transform are the
+  // dag nodes whose plan is not one of the PEM plans. The id-sorted order matters: the shuffle
+  // destination lists of the PEM sinks are appended to in Kelvin conversion order, so every PEM
+  // must see the Kelvins in the same order for the hash partitioning to line up.
+  std::vector<CarnotInstance*> kelvins{remote_carnot};
+  const auto& dag_nodes = distributed_plan->dag().nodes();
+  std::vector<int64_t> sorted_nodes(dag_nodes.begin(), dag_nodes.end());
+  std::sort(sorted_nodes.begin(), sorted_nodes.end());
+  for (int64_t node_id : sorted_nodes) {
+    CarnotInstance* instance = distributed_plan->Get(node_id);
+    if (instance == remote_carnot ||
+        distributed_plan->plan_to_agent_map().contains(instance->plan())) {
+      continue;
+    }
+    kelvins.push_back(instance);
+  }
+
   DistributedSetSourceGroupGRPCAddressRule set_grpc_address_rule;
-  PX_RETURN_IF_ERROR(set_grpc_address_rule.Apply(remote_carnot));
+  for (CarnotInstance* kelvin : kelvins) {
+    PX_RETURN_IF_ERROR(set_grpc_address_rule.Apply(kelvin));
+  }
 
-  // Connect the plans.
+  // Connect the PEM plans to every Kelvin. Only the primary Kelvin is guaranteed to receive
+  // data from every PEM plan.
   for (const auto& [plan, agents] : distributed_plan->plan_to_agent_map()) {
-    PX_ASSIGN_OR_RETURN(auto did_connect_plan, AssociateDistributedPlanEdgesRule::ConnectGraphs(
-                                                   plan, agents, remote_plan));
-    DCHECK(did_connect_plan);
+    for (CarnotInstance* kelvin : kelvins) {
+      PX_ASSIGN_OR_RETURN(auto did_connect_plan, AssociateDistributedPlanEdgesRule::ConnectGraphs(
+                                                     plan, agents, kelvin->plan()));
+      DCHECK(did_connect_plan || kelvin != remote_carnot);
+    }
+  }
+
+  // The extra Kelvins send their results to the primary.
+  for (CarnotInstance* kelvin : kelvins) {
+    if (kelvin == remote_carnot) {
+      continue;
+    }
+    PX_RETURN_IF_ERROR(AssociateDistributedPlanEdgesRule::ConnectGraphs(kelvin->plan(),
+                                                                        {kelvin->id()},
+                                                                        remote_plan));
   }
 
   // TODO(philkuz) make this connect to self without a grpc bridge.
   PX_RETURN_IF_ERROR(
       AssociateDistributedPlanEdgesRule::ConnectGraphs(remote_plan, {remote_node_id}, remote_plan));
 
-  // Expand GRPCSourceGroups in the remote_plan.
+  // Expand the GRPCSourceGroups of every Kelvin plan, primary first so the primary is the first
+  // entry in the shuffle destination lists. Only the primary connects to itself, so only its
+  // plan can contain same-node bridges to merge.
   GRPCSourceGroupConversionRule conversion_rule;
-  PX_RETURN_IF_ERROR(conversion_rule.Execute(remote_plan));
+  for (CarnotInstance* kelvin : kelvins) {
+    PX_RETURN_IF_ERROR(conversion_rule.Execute(kelvin->plan()));
+  }
   return MergeSameNodeGRPCBridgeRule(remote_node_id).Execute(remote_plan).status();
 }
 
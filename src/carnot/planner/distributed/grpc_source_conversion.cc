@@ -63,8 +63,16 @@ StatusOr<GRPCSourceIR*> GRPCSourceGroupConversionRule::CreateGRPCSource(
 
 // Have to get rid of this function. Instead, need to associate (agent_id, sink_id) ->
 // source_id/destination_id.
-Status UpdateSink(GRPCSourceIR* source, GRPCSinkIR* sink, int64_t agent_id) {
+Status UpdateSink(GRPCSourceGroupIR* group_ir, GRPCSourceIR* source, GRPCSinkIR* sink,
+                  int64_t agent_id) {
   sink->AddDestinationIDMap(source->id(), agent_id);
+  if (sink->is_shuffle()) {
+    // Shuffled sinks fan out across instances: record the full destination (this group's
+    // instance address plus the new source's id), so the sink's HashShuffleSpec can be emitted
+    // once every instance's source group has been converted.
+    sink->AddAgentShuffleDestination(agent_id, group_ir->grpc_address(),
+                                     group_ir->ssl_targetname(), source->id());
+  }
   return Status::OK();
 }
 
@@ -83,7 +91,8 @@ StatusOr<OperatorIR*> GRPCSourceGroupConversionRule::ConvertGRPCSourceGroup(
   // Don't add an unnecessary union node if there is only one sink.
   if (sinks.size() == 1 && sinks[0].second.size() == 1) {
     PX_ASSIGN_OR_RETURN(auto new_grpc_source, CreateGRPCSource(group_ir));
-    PX_RETURN_IF_ERROR(UpdateSink(new_grpc_source, sinks[0].first, *(sinks[0].second.begin())));
+    PX_RETURN_IF_ERROR(
+        UpdateSink(group_ir, new_grpc_source, sinks[0].first, *(sinks[0].second.begin())));
     return new_grpc_source;
   }
 
@@ -92,7 +101,7 @@ StatusOr<OperatorIR*> GRPCSourceGroupConversionRule::ConvertGRPCSourceGroup(
     DCHECK_GE(sinks[0].second.size(), 1U);
     for (int64_t agent_id : sink.second) {
       PX_ASSIGN_OR_RETURN(GRPCSourceIR * new_grpc_source, CreateGRPCSource(group_ir));
-      PX_RETURN_IF_ERROR(UpdateSink(new_grpc_source, sink.first, agent_id));
+      PX_RETURN_IF_ERROR(UpdateSink(group_ir, new_grpc_source, sink.first, agent_id));
       grpc_sources.push_back(new_grpc_source);
     }
   }
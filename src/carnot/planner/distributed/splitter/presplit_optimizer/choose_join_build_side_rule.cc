@@ -0,0 +1,89 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <queue>
+
+#include "src/carnot/planner/distributed/splitter/presplit_optimizer/choose_join_build_side_rule.h"
+#include "src/carnot/planner/ir/memory_source_ir.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace distributed {
+
+StatusOr<bool> ChooseJoinBuildSideRule::Apply(IRNode* ir_node) {
+  if (!Match(ir_node, Join())) {
+    return false;
+  }
+  JoinIR* join = static_cast<JoinIR*>(ir_node);
+  // Only inner joins can have their parents reordered without changing semantics.
+  if (join->join_type() != JoinIR::JoinType::kInner) {
+    return false;
+  }
+  // A time_ output column pins the probe side to the time_ parent to preserve output ordering,
+  // so reordering the parents would not move the build side.
+  if (std::find(join->column_names().begin(), join->column_names().end(), "time_") !=
+      join->column_names().end()) {
+    return false;
+  }
+  DCHECK_EQ(2UL, join->parents().size());
+  auto left_bytes = EstimateInputBytes(join->parents()[0]);
+  auto right_bytes = EstimateInputBytes(join->parents()[1]);
+  if (!left_bytes.has_value() || !right_bytes.has_value()) {
+    return false;
+  }
+  // The left input is the build side; put the smaller input there.
+  if (*right_bytes >= *left_bytes) {
+    return false;
+  }
+  PX_RETURN_IF_ERROR(join->FlipParentOrder());
+  return true;
+}
+
+std::optional<uint64_t> ChooseJoinBuildSideRule::EstimateInputBytes(OperatorIR* op) {
+  const auto& table_stats = compiler_state_->table_stats_map();
+  uint64_t total_bytes = 0;
+  std::queue<OperatorIR*> ops;
+  ops.push(op);
+  while (!ops.empty()) {
+    OperatorIR* current = ops.front();
+    ops.pop();
+    if (Match(current, MemorySource())) {
+      auto stats = table_stats.find(static_cast<MemorySourceIR*>(current)->table_name());
+      if (stats == table_stats.end() || stats->second.bytes == 0) {
+        return std::nullopt;
+      }
+      total_bytes += stats->second.bytes;
+      continue;
+    }
+    // Non-memory sources (UDTFs, empty sources) have no stats to estimate from.
+    if (current->parents().empty()) {
+      return std::nullopt;
+    }
+    for (OperatorIR* parent : current->parents()) {
+      ops.push(parent);
+    }
+  }
+  return total_bytes;
+}
+
+}  // namespace distributed
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <optional>
+
+#include "src/carnot/planner/ir/join_ir.h"
+#include "src/carnot/planner/rules/rules.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace distributed {
+
+/**
+ * @brief This rule orders the inputs of inner joins so that the smaller input becomes the
+ * build side of the execution engine's hash join. The engine builds its hash table from the
+ * left input (unless the output has a time_ column, which pins the build side regardless of
+ * parent order), so building from the larger input holds the larger table in memory.
+ *
+ * Input sizes are estimated from the table size statistics the agents report in their
+ * distributed state, by summing the stored bytes of the source tables feeding each side. This
+ * ignores the selectivity of filters and aggregates in between, but choosing the build side
+ * only needs the relative order of the two sides, which table sizes predict well. When stats
+ * are missing for any source, the join is left untouched.
+ *
+ * NOTE: nothing populates SchemaInfo.stats yet (the metadata service builds SchemaInfo from the
+ * computed schema, which has no size information), so today the missing-stats guard always fires
+ * and this rule is a no-op. It activates once agents report table sizes into the distributed
+ * state.
+ */
+class ChooseJoinBuildSideRule : public Rule {
+ public:
+  explicit ChooseJoinBuildSideRule(CompilerState* compiler_state)
+      : Rule(compiler_state, /*use_topo*/ true, /*reverse_topological_execution*/ false) {}
+
+ protected:
+  StatusOr<bool> Apply(IRNode*) override;
+
+ private:
+  // Returns the estimated stored bytes feeding op, or nullopt if any source lacks stats.
+  std::optional<uint64_t> EstimateInputBytes(OperatorIR* op);
+};
+
+}  // namespace distributed
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,170 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "src/carnot/planner/compiler/analyzer/resolve_types_rule.h"
+#include "src/carnot/planner/distributed/splitter/presplit_optimizer/choose_join_build_side_rule.h"
+#include "src/carnot/planner/test_utils.h"
+#include "src/carnot/udf_exporter/udf_exporter.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace distributed {
+
+using compiler::ResolveTypesRule;
+using ::testing::ElementsAre;
+
+using ChooseJoinBuildSideTest = testutils::DistributedRulesTest;
+TEST_F(ChooseJoinBuildSideTest, swaps_larger_build_side) {
+  Relation left_relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "xyz"});
+  Relation right_relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "jkl"});
+  MemorySourceIR* left_src = MakeMemSource("big_table", left_relation);
+  compiler_state_->relation_map()->emplace("big_table", left_relation);
+  MemorySourceIR* right_src = MakeMemSource("small_table", right_relation);
+  compiler_state_->relation_map()->emplace("small_table", right_relation);
+  compiler_state_->set_table_stats_map(
+      {{"big_table", TableSizeStats{10 * 1024 * 1024, 100000}},
+       {"small_table", TableSizeStats{64 * 1024, 1000}}});
+
+  JoinIR* join = MakeJoin({left_src, right_src}, "inner", left_relation, right_relation, {"abc"},
+                          {"abc"}, {"_x", "_y"});
+  MakeMemSink(join, "foo", {});
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  ChooseJoinBuildSideRule rule(compiler_state_.get());
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_TRUE(result.ValueOrDie());
+
+  // The smaller table moves to the left (build) side, with the on-columns following it.
+  EXPECT_THAT(join->parents(), ElementsAre(right_src, left_src));
+  ASSERT_EQ(1U, join->left_on_columns().size());
+  EXPECT_EQ("abc", join->left_on_columns()[0]->col_name());
+  EXPECT_EQ(0, join->left_on_columns()[0]->container_op_parent_idx());
+  EXPECT_EQ(1, join->right_on_columns()[0]->container_op_parent_idx());
+  // The output relation is unchanged.
+  EXPECT_THAT(join->column_names(), ElementsAre("abc_x", "xyz", "abc_y", "jkl"));
+}
+
+TEST_F(ChooseJoinBuildSideTest, no_swap_when_build_side_already_smaller) {
+  Relation left_relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "xyz"});
+  Relation right_relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "jkl"});
+  MemorySourceIR* left_src = MakeMemSource("small_table", left_relation);
+  compiler_state_->relation_map()->emplace("small_table", left_relation);
+  MemorySourceIR* right_src = MakeMemSource("big_table", right_relation);
+  compiler_state_->relation_map()->emplace("big_table", right_relation);
+  compiler_state_->set_table_stats_map({{"big_table", TableSizeStats{10 * 1024 * 1024, 100000}},
+                                        {"small_table", TableSizeStats{64 * 1024, 1000}}});
+
+  JoinIR* join = MakeJoin({left_src, right_src}, "inner", left_relation, right_relation, {"abc"},
+                          {"abc"}, {"_x", "_y"});
+  MakeMemSink(join, "foo", {});
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  ChooseJoinBuildSideRule rule(compiler_state_.get());
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_FALSE(result.ValueOrDie());
+  EXPECT_THAT(join->parents(), ElementsAre(left_src, right_src));
+}
+
+TEST_F(ChooseJoinBuildSideTest, no_swap_without_stats) {
+  Relation left_relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "xyz"});
+  Relation right_relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "jkl"});
+  MemorySourceIR* left_src = MakeMemSource("big_table", left_relation);
+  compiler_state_->relation_map()->emplace("big_table", left_relation);
+  MemorySourceIR* right_src = MakeMemSource("small_table", right_relation);
+  compiler_state_->relation_map()->emplace("small_table", right_relation);
+  // Only one side has stats, so no cost estimate is possible.
+  compiler_state_->set_table_stats_map({{"big_table", TableSizeStats{10 * 1024 * 1024, 100000}}});
+
+  JoinIR* join = MakeJoin({left_src, right_src}, "inner", left_relation, right_relation, {"abc"},
+                          {"abc"}, {"_x", "_y"});
+  MakeMemSink(join, "foo", {});
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  ChooseJoinBuildSideRule rule(compiler_state_.get());
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_FALSE(result.ValueOrDie());
+  EXPECT_THAT(join->parents(), ElementsAre(left_src, right_src));
+}
+
+TEST_F(ChooseJoinBuildSideTest, no_swap_for_left_join) {
+  Relation left_relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "xyz"});
+  Relation right_relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "jkl"});
+  MemorySourceIR* left_src = MakeMemSource("big_table", left_relation);
+  compiler_state_->relation_map()->emplace("big_table", left_relation);
+  MemorySourceIR* right_src = MakeMemSource("small_table", right_relation);
+  compiler_state_->relation_map()->emplace("small_table", right_relation);
+  compiler_state_->set_table_stats_map({{"big_table", TableSizeStats{10 * 1024 * 1024, 100000}},
+                                        {"small_table", TableSizeStats{64 * 1024, 1000}}});
+
+  JoinIR* join = MakeJoin({left_src, right_src}, "left", left_relation, right_relation, {"abc"},
+                          {"abc"}, {"_x", "_y"});
+  MakeMemSink(join, "foo", {});
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  ChooseJoinBuildSideRule rule(compiler_state_.get());
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_FALSE(result.ValueOrDie());
+  EXPECT_THAT(join->parents(), ElementsAre(left_src, right_src));
+}
+
+TEST_F(ChooseJoinBuildSideTest, no_swap_with_time_ordered_output) {
+  Relation left_relation({types::DataType::TIME64NS, types::DataType::INT64}, {"time_", "abc"});
+  Relation right_relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "jkl"});
+  MemorySourceIR* left_src = MakeMemSource("big_table", left_relation);
+  compiler_state_->relation_map()->emplace("big_table", left_relation);
+  MemorySourceIR* right_src = MakeMemSource("small_table", right_relation);
+  compiler_state_->relation_map()->emplace("small_table", right_relation);
+  compiler_state_->set_table_stats_map({{"big_table", TableSizeStats{10 * 1024 * 1024, 100000}},
+                                        {"small_table", TableSizeStats{64 * 1024, 1000}}});
+
+  JoinIR* join = MakeJoin({left_src, right_src}, "inner", left_relation, right_relation, {"abc"},
+                          {"abc"}, {"_x", "_y"});
+  MakeMemSink(join, "foo", {});
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  ChooseJoinBuildSideRule rule(compiler_state_.get());
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  // The time_ output column pins the build side, so reordering parents would not help.
+  EXPECT_FALSE(result.ValueOrDie());
+  EXPECT_THAT(join->parents(), ElementsAre(left_src, right_src));
+}
+
+}  // namespace distributed
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
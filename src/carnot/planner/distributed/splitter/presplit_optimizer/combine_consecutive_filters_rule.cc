@@ -0,0 +1,73 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <vector>
+
+#include "src/carnot/planner/distributed/splitter/presplit_optimizer/combine_consecutive_filters_rule.h"
+#include "src/carnot/planner/ir/func_ir.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace distributed {
+
+StatusOr<bool> CombineConsecutiveFiltersRule::Apply(IRNode* ir_node) {
+  if (!Match(ir_node, Filter())) {
+    return false;
+  }
+  auto child = static_cast<FilterIR*>(ir_node);
+  DCHECK_EQ(1UL, child->parents().size());
+  auto parent_op = child->parents()[0];
+  if (!Match(parent_op, Filter())) {
+    return false;
+  }
+  auto parent = static_cast<FilterIR*>(parent_op);
+  // Fusing would change what the parent's other children see, so only fuse exclusive chains.
+  if (parent->Children().size() > 1) {
+    return false;
+  }
+  PX_RETURN_IF_ERROR(CombineFilters(parent, child));
+  return true;
+}
+
+Status CombineConsecutiveFiltersRule::CombineFilters(FilterIR* parent, FilterIR* child) {
+  IR* graph = parent->graph();
+  ExpressionIR* child_expr = child->filter_expr();
+  PX_ASSIGN_OR_RETURN(
+      FuncIR * and_func,
+      graph->CreateNode<FuncIR>(child->ast(), FuncIR::op_map.find("and")->second,
+                                std::vector<ExpressionIR*>{parent->filter_expr(), child_expr}));
+  // This rule runs after type resolution, so the fused predicate has to be resolved here. The
+  // arguments keep their existing types and only the conjunction itself is looked up.
+  PX_RETURN_IF_ERROR(and_func->ResolveType(compiler_state_, /*parent_types*/ {}));
+  // SetFilterExpr drops the edge to the old predicate, which survives as an argument of the
+  // conjunction.
+  PX_RETURN_IF_ERROR(parent->SetFilterExpr(and_func));
+
+  PX_RETURN_IF_ERROR(graph->DeleteEdge(child, child_expr));
+  PX_RETURN_IF_ERROR(child->RemoveParent(parent));
+  for (OperatorIR* grandchild : child->Children()) {
+    PX_RETURN_IF_ERROR(grandchild->ReplaceParent(child, parent));
+  }
+  return graph->DeleteNode(child->id());
+}
+
+}  // namespace distributed
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "src/carnot/planner/ir/filter_ir.h"
+#include "src/carnot/planner/rules/rules.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace distributed {
+
+/**
+ * @brief This rule fuses a filter whose sole parent is another filter with no other children
+ * into a single filter with the conjunction of both predicates, which the expression evaluator
+ * then evaluates in one pass over each row batch.
+ *
+ * It is the inverse of SplitFilterConjunctionsRule and runs after filter pushdown: conjuncts
+ * that could be pushed toward different sources have moved by then, and whatever ended up
+ * adjacent again would otherwise each materialize an intermediate row batch at execution time.
+ */
+class CombineConsecutiveFiltersRule : public Rule {
+ public:
+  explicit CombineConsecutiveFiltersRule(CompilerState* compiler_state)
+      : Rule(compiler_state, /*use_topo*/ true, /*reverse_topological_execution*/ false) {}
+
+ protected:
+  StatusOr<bool> Apply(IRNode*) override;
+
+ private:
+  Status CombineFilters(FilterIR* parent, FilterIR* child);
+};
+
+}  // namespace distributed
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
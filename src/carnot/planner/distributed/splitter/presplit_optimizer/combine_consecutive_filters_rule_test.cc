@@ -0,0 +1,106 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "src/carnot/planner/compiler/analyzer/resolve_types_rule.h"
+#include "src/carnot/planner/distributed/splitter/presplit_optimizer/combine_consecutive_filters_rule.h"
+#include "src/carnot/planner/test_utils.h"
+#include "src/carnot/udf_exporter/udf_exporter.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace distributed {
+
+using compiler::ResolveTypesRule;
+using ::testing::ElementsAre;
+
+using CombineConsecutiveFiltersTest = testutils::DistributedRulesTest;
+TEST_F(CombineConsecutiveFiltersTest, fuses_filter_chain_into_conjunction) {
+  Relation relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "xyz"});
+  MemorySourceIR* src = MakeMemSource("source", relation);
+  compiler_state_->relation_map()->emplace("source", relation);
+
+  FilterIR* bottom = MakeFilter(src, MakeEqualsFunc(MakeColumn("abc", 0), MakeInt(1)));
+  FilterIR* middle = MakeFilter(bottom, MakeEqualsFunc(MakeColumn("xyz", 0), MakeInt(2)));
+  FilterIR* top = MakeFilter(middle, MakeEqualsFunc(MakeColumn("abc", 0), MakeInt(3)));
+  MemorySinkIR* sink = MakeMemSink(top, "foo", {});
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  CombineConsecutiveFiltersRule rule(compiler_state_.get());
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_TRUE(result.ValueOrDie());
+
+  // The whole chain collapses into the bottom filter in a single pass.
+  EXPECT_THAT(sink->parents(), ElementsAre(bottom));
+  EXPECT_THAT(bottom->parents(), ElementsAre(src));
+  EXPECT_FALSE(graph->HasNode(middle->id()));
+  EXPECT_FALSE(graph->HasNode(top->id()));
+  EXPECT_MATCH(bottom->filter_expr(), LogicalAnd());
+  EXPECT_TRUE(bottom->filter_expr()->is_type_resolved());
+}
+
+TEST_F(CombineConsecutiveFiltersTest, single_filter_no_op) {
+  Relation relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "xyz"});
+  MemorySourceIR* src = MakeMemSource("source", relation);
+  compiler_state_->relation_map()->emplace("source", relation);
+
+  FilterIR* filter = MakeFilter(src, MakeEqualsFunc(MakeColumn("abc", 0), MakeInt(1)));
+  MemorySinkIR* sink = MakeMemSink(filter, "foo", {});
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  CombineConsecutiveFiltersRule rule(compiler_state_.get());
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_FALSE(result.ValueOrDie());
+  EXPECT_THAT(sink->parents(), ElementsAre(filter));
+  EXPECT_MATCH(filter->filter_expr(), Equals(ColumnNode("abc"), Int(1)));
+}
+
+TEST_F(CombineConsecutiveFiltersTest, does_not_fuse_filter_with_other_children) {
+  Relation relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "xyz"});
+  MemorySourceIR* src = MakeMemSource("source", relation);
+  compiler_state_->relation_map()->emplace("source", relation);
+
+  FilterIR* parent = MakeFilter(src, MakeEqualsFunc(MakeColumn("abc", 0), MakeInt(1)));
+  FilterIR* child = MakeFilter(parent, MakeEqualsFunc(MakeColumn("xyz", 0), MakeInt(2)));
+  MakeMemSink(child, "foo", {});
+  // The parent's rows also feed a second sink, so fusing would change that sink's output.
+  MakeMemSink(parent, "bar", {});
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  CombineConsecutiveFiltersRule rule(compiler_state_.get());
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_FALSE(result.ValueOrDie());
+  EXPECT_THAT(child->parents(), ElementsAre(parent));
+  EXPECT_MATCH(parent->filter_expr(), Equals(ColumnNode("abc"), Int(1)));
+}
+
+}  // namespace distributed
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -18,6 +18,9 @@
 
 #include <algorithm>
 #include <queue>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "src/carnot/planner/distributed/splitter/executor_utils.h"
 #include "src/carnot/planner/distributed/splitter/presplit_optimizer/filter_push_down_rule.h"
@@ -165,28 +168,216 @@ StatusOr<bool> FilterPushdownRule::Apply(IRNode* ir_node) {
     }
     current_node = next_parent;
   }
-  // If the current_node is filter, that means we could not find a better filter location and will
-  // not change.
-  if (current_node == filter) {
-    return false;
+  bool changed = false;
+  if (current_node != filter) {
+    PX_RETURN_IF_ERROR(UpdateFilter(filter, column_name_mapping));
+
+    // Make the filter's parent its children's new parent.
+    DCHECK_EQ(1U, filter->parents().size());
+    OperatorIR* filter_parent = filter->parents()[0];
+
+    for (OperatorIR* child : filter->Children()) {
+      PX_RETURN_IF_ERROR(child->ReplaceParent(filter, filter_parent));
+    }
+    PX_RETURN_IF_ERROR(filter->RemoveParent(filter_parent));
+
+    DCHECK_EQ(1U, current_node->parents().size());
+    auto new_filter_parent = current_node->parents()[0];
+    PX_RETURN_IF_ERROR(filter->AddParent(new_filter_parent));
+    PX_RETURN_IF_ERROR(current_node->ReplaceParent(new_filter_parent, filter));
+    PX_RETURN_IF_ERROR(filter->SetResolvedType(new_filter_parent->resolved_type()));
+    changed = true;
   }
 
-  PX_RETURN_IF_ERROR(UpdateFilter(filter, column_name_mapping));
+  // The single-chain walk above stops at multi-parent operators and sources. If the filter now
+  // sits directly below one, try to push it through or absorb it into the source's scan range.
+  if (filter->parents().size() == 1) {
+    OperatorIR* barrier = filter->parents()[0];
+    // Pushing below the barrier changes its input, so the filter must be its only consumer.
+    if (barrier->Children().size() == 1) {
+      if (Match(barrier, Union())) {
+        PX_ASSIGN_OR_RETURN(bool pushed,
+                            PushFilterBelowUnion(filter, static_cast<UnionIR*>(barrier)));
+        changed = changed || pushed;
+      } else if (Match(barrier, Join())) {
+        PX_ASSIGN_OR_RETURN(bool pushed, PushFilterBelowJoin(filter, static_cast<JoinIR*>(barrier)));
+        changed = changed || pushed;
+      } else if (Match(barrier, MemorySource())) {
+        PX_ASSIGN_OR_RETURN(
+            bool absorbed,
+            AbsorbFilterIntoMemorySourceTimeRange(filter, static_cast<MemorySourceIR*>(barrier)));
+        changed = changed || absorbed;
+      }
+    }
+  }
+  return changed;
+}
 
-  // Make the filter's parent its children's new parent.
+Status FilterPushdownRule::RemoveFilterFromPlan(FilterIR* filter) {
   DCHECK_EQ(1U, filter->parents().size());
-  OperatorIR* filter_parent = filter->parents()[0];
-
+  OperatorIR* parent = filter->parents()[0];
   for (OperatorIR* child : filter->Children()) {
-    PX_RETURN_IF_ERROR(child->ReplaceParent(filter, filter_parent));
+    PX_RETURN_IF_ERROR(child->ReplaceParent(filter, parent));
+  }
+  PX_RETURN_IF_ERROR(filter->RemoveParent(parent));
+
+  IR* graph = filter->graph();
+  int64_t expr_id = filter->filter_expr()->id();
+  PX_RETURN_IF_ERROR(graph->DeleteEdge(filter->id(), expr_id));
+  PX_RETURN_IF_ERROR(graph->DeleteNode(filter->id()));
+  return graph->DeleteOrphansInSubtree(expr_id);
+}
+
+StatusOr<bool> FilterPushdownRule::PushFilterBelowUnion(FilterIR* filter, UnionIR* union_op) {
+  // Unions match parent columns by name, so the predicate can be evaluated directly on every
+  // input. Replicate the filter onto each parent and remove the original.
+  IR* graph = filter->graph();
+  // Snapshot the parents, since the loop below replaces the union's parent edges.
+  std::vector<OperatorIR*> parents = union_op->parents();
+  for (OperatorIR* parent : parents) {
+    PX_ASSIGN_OR_RETURN(ExpressionIR * expr_copy, graph->CopyNode(filter->filter_expr()));
+    PX_ASSIGN_OR_RETURN(FilterIR * new_filter,
+                        graph->CreateNode<FilterIR>(filter->ast(), parent, expr_copy));
+    PX_RETURN_IF_ERROR(new_filter->SetResolvedType(parent->resolved_type()));
+    PX_RETURN_IF_ERROR(union_op->ReplaceParent(parent, new_filter));
+  }
+  PX_RETURN_IF_ERROR(RemoveFilterFromPlan(filter));
+  return true;
+}
+
+StatusOr<bool> FilterPushdownRule::PushFilterBelowJoin(FilterIR* filter, JoinIR* join) {
+  // Determine which parent's rows may be filtered before the join. Inner joins allow either
+  // side; left joins only the preserved left side, since the other side's columns get
+  // null-extended above the join where a pre-join filter can't see them. Right joins are
+  // normalized to left joins by SetupJoinTypeRule, but handle them for completeness.
+  int64_t allowed_idx;
+  switch (join->join_type()) {
+    case JoinIR::JoinType::kInner:
+      allowed_idx = -1;  // Either side.
+      break;
+    case JoinIR::JoinType::kLeft:
+      allowed_idx = 0;
+      break;
+    case JoinIR::JoinType::kRight:
+      allowed_idx = 1;
+      break;
+    case JoinIR::JoinType::kOuter:
+      return false;
+  }
+
+  // Map each output column of the join back to its parent index and parent-side name, undoing
+  // any suffixes the join added.
+  const auto& output_names = join->column_names();
+  const auto& output_cols = join->output_columns();
+  if (output_names.size() != output_cols.size()) {
+    return false;
+  }
+  absl::flat_hash_map<std::string, std::pair<int64_t, std::string>> output_to_parent_col;
+  for (size_t i = 0; i < output_names.size(); ++i) {
+    output_to_parent_col[output_names[i]] = {output_cols[i]->container_op_parent_idx(),
+                                             output_cols[i]->col_name()};
+  }
+
+  PX_ASSIGN_OR_RETURN(auto involved_cols, filter->filter_expr()->InputColumnNames());
+  if (involved_cols.empty()) {
+    return false;
+  }
+  int64_t side = -1;
+  for (const std::string& name : involved_cols) {
+    auto it = output_to_parent_col.find(name);
+    if (it == output_to_parent_col.end()) {
+      return false;
+    }
+    if (side == -1) {
+      side = it->second.first;
+    } else if (side != it->second.first) {
+      // The predicate spans both sides of the join.
+      return false;
+    }
+  }
+  if (allowed_idx != -1 && side != allowed_idx) {
+    return false;
+  }
+
+  IR* graph = filter->graph();
+  OperatorIR* parent = join->parents()[side];
+  PX_ASSIGN_OR_RETURN(ExpressionIR * expr_copy, graph->CopyNode(filter->filter_expr()));
+  PX_ASSIGN_OR_RETURN(auto copy_cols, expr_copy->InputColumns());
+  for (ColumnIR* col : copy_cols) {
+    col->UpdateColumnName(output_to_parent_col.at(col->col_name()).second);
+  }
+  PX_ASSIGN_OR_RETURN(FilterIR * new_filter,
+                      graph->CreateNode<FilterIR>(filter->ast(), parent, expr_copy));
+  PX_RETURN_IF_ERROR(new_filter->SetResolvedType(parent->resolved_type()));
+  PX_RETURN_IF_ERROR(join->ReplaceParent(parent, new_filter));
+  PX_RETURN_IF_ERROR(RemoveFilterFromPlan(filter));
+  return true;
+}
+
+StatusOr<bool> FilterPushdownRule::AbsorbFilterIntoMemorySourceTimeRange(FilterIR* filter,
+                                                                         MemorySourceIR* src) {
+  if (!Match(filter->filter_expr(), Func())) {
+    return false;
+  }
+  FuncIR* func = static_cast<FuncIR*>(filter->filter_expr());
+  FuncIR::Opcode opcode = func->opcode();
+  if (opcode != FuncIR::Opcode::gt && opcode != FuncIR::Opcode::gteq &&
+      opcode != FuncIR::Opcode::lt && opcode != FuncIR::Opcode::lteq) {
+    return false;
+  }
+  if (func->all_args().size() != 2) {
+    return false;
+  }
+
+  // Normalize to <time column> <op> <constant>, mirroring the comparison if the constant is on
+  // the left.
+  ExpressionIR* column_side = func->all_args()[0];
+  ExpressionIR* value_side = func->all_args()[1];
+  if (!Match(column_side, ColumnNode())) {
+    std::swap(column_side, value_side);
+    switch (opcode) {
+      case FuncIR::Opcode::gt:
+        opcode = FuncIR::Opcode::lt;
+        break;
+      case FuncIR::Opcode::gteq:
+        opcode = FuncIR::Opcode::lteq;
+        break;
+      case FuncIR::Opcode::lt:
+        opcode = FuncIR::Opcode::gt;
+        break;
+      default:
+        opcode = FuncIR::Opcode::gteq;
+        break;
+    }
+  }
+  if (!Match(column_side, ColumnNode()) || !(Match(value_side, Int()) || Match(value_side, Time()))) {
+    return false;
+  }
+  // Only predicates on the table's time column map onto the source's scan range.
+  if (static_cast<ColumnIR*>(column_side)->col_name() != "time_") {
+    return false;
   }
-  PX_RETURN_IF_ERROR(filter->RemoveParent(filter_parent));
 
-  DCHECK_EQ(1U, current_node->parents().size());
-  auto new_filter_parent = current_node->parents()[0];
-  PX_RETURN_IF_ERROR(filter->AddParent(new_filter_parent));
-  PX_RETURN_IF_ERROR(current_node->ReplaceParent(new_filter_parent, filter));
-  PX_RETURN_IF_ERROR(filter->SetResolvedType(new_filter_parent->resolved_type()));
+  int64_t value = Match(value_side, Int()) ? static_cast<IntIR*>(value_side)->val()
+                                           : static_cast<TimeIR*>(value_side)->val();
+  // The table cursor treats both the start and the stop time as inclusive.
+  switch (opcode) {
+    case FuncIR::Opcode::gteq:
+      src->SetTimeStartNS(src->IsTimeStartSet() ? std::max(src->time_start_ns(), value) : value);
+      break;
+    case FuncIR::Opcode::gt:
+      src->SetTimeStartNS(src->IsTimeStartSet() ? std::max(src->time_start_ns(), value + 1)
+                                                : value + 1);
+      break;
+    case FuncIR::Opcode::lteq:
+      src->SetTimeStopNS(src->IsTimeStopSet() ? std::min(src->time_stop_ns(), value) : value);
+      break;
+    default:
+      src->SetTimeStopNS(src->IsTimeStopSet() ? std::min(src->time_stop_ns(), value - 1)
+                                              : value - 1);
+      break;
+  }
+  PX_RETURN_IF_ERROR(RemoveFilterFromPlan(filter));
   return true;
 }
 
@@ -19,7 +19,10 @@
 #pragma once
 
 #include "src/carnot/planner/ir/blocking_agg_ir.h"
+#include "src/carnot/planner/ir/join_ir.h"
 #include "src/carnot/planner/ir/map_ir.h"
+#include "src/carnot/planner/ir/memory_source_ir.h"
+#include "src/carnot/planner/ir/union_ir.h"
 #include "src/carnot/planner/rules/rules.h"
 
 namespace px {
@@ -32,6 +35,10 @@ namespace distributed {
  * It must run after OperatorRelationRule so that it has full context on all of the column
  * names that exist in the IR.
  *
+ * Filters that reach a union are replicated below it onto every parent, and filters whose
+ * predicate only touches one side of a join are pushed below the join onto that parent. Simple
+ * comparisons against the time column that reach a memory source are absorbed into the source's
+ * start/stop scan bounds instead of being evaluated row by row.
  */
 class FilterPushdownRule : public Rule {
  public:
@@ -48,6 +55,10 @@ class FilterPushdownRule : public Rule {
   StatusOr<OperatorIR*> NextFilterLocation(OperatorIR* current_node, bool kelvin_only_filter,
                                            ColumnNameMapping* column_name_mapping);
   Status UpdateFilter(FilterIR* expr, const ColumnNameMapping& column_name_mapping);
+  StatusOr<bool> PushFilterBelowUnion(FilterIR* filter, UnionIR* union_op);
+  StatusOr<bool> PushFilterBelowJoin(FilterIR* filter, JoinIR* join);
+  StatusOr<bool> AbsorbFilterIntoMemorySourceTimeRange(FilterIR* filter, MemorySourceIR* src);
+  Status RemoveFilterFromPlan(FilterIR* filter);
 };
 
 }  // namespace distributed
@@ -479,6 +479,194 @@ TEST_F(FilterPushDownTest, dont_update_col_names_if_not_pushing_down_map) {
                                                  Equals(ColumnNode("renamed"), Int(1))));
 }
 
+TEST_F(FilterPushDownTest, push_below_union) {
+  Relation relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "xyz"});
+  MemorySourceIR* src1 = MakeMemSource("source1", relation);
+  compiler_state_->relation_map()->emplace("source1", relation);
+  MemorySourceIR* src2 = MakeMemSource("source2", relation);
+  compiler_state_->relation_map()->emplace("source2", relation);
+  UnionIR* union_op = MakeUnion({src1, src2});
+
+  auto eq_func = MakeEqualsFunc(MakeColumn("abc", 0), MakeInt(2));
+  FilterIR* filter = MakeFilter(union_op, eq_func);
+  MemorySinkIR* sink = MakeMemSink(filter, "foo", {});
+  int64_t filter_id = filter->id();
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  FilterPushdownRule rule(compiler_state_.get());
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_TRUE(result.ValueOrDie());
+
+  // The filter should be replicated onto every union input and removed from above the union.
+  EXPECT_THAT(sink->parents(), ElementsAre(union_op));
+  EXPECT_FALSE(graph->HasNode(filter_id));
+  std::vector<MemorySourceIR*> srcs{src1, src2};
+  ASSERT_EQ(srcs.size(), union_op->parents().size());
+  for (size_t i = 0; i < srcs.size(); ++i) {
+    ASSERT_MATCH(union_op->parents()[i], Filter());
+    FilterIR* new_filter = static_cast<FilterIR*>(union_op->parents()[i]);
+    EXPECT_THAT(new_filter->parents(), ElementsAre(srcs[i]));
+    EXPECT_MATCH(new_filter->filter_expr(), Equals(ColumnNode("abc"), Int(2)));
+  }
+}
+
+TEST_F(FilterPushDownTest, push_below_inner_join_with_suffix_rename) {
+  Relation left_relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "xyz"});
+  Relation right_relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "jkl"});
+  MemorySourceIR* left_src = MakeMemSource("left", left_relation);
+  compiler_state_->relation_map()->emplace("left", left_relation);
+  MemorySourceIR* right_src = MakeMemSource("right", right_relation);
+  compiler_state_->relation_map()->emplace("right", right_relation);
+  JoinIR* join = MakeJoin({left_src, right_src}, "inner", left_relation, right_relation, {"abc"},
+                          {"abc"}, {"_x", "_y"});
+
+  // abc_y is the right parent's abc column after suffixing.
+  auto eq_func = MakeEqualsFunc(MakeColumn("abc_y", 0), MakeInt(2));
+  FilterIR* filter = MakeFilter(join, eq_func);
+  MemorySinkIR* sink = MakeMemSink(filter, "foo", {});
+  int64_t filter_id = filter->id();
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  FilterPushdownRule rule(compiler_state_.get());
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_TRUE(result.ValueOrDie());
+
+  EXPECT_THAT(sink->parents(), ElementsAre(join));
+  EXPECT_FALSE(graph->HasNode(filter_id));
+  ASSERT_EQ(2U, join->parents().size());
+  EXPECT_EQ(left_src, join->parents()[0]);
+  ASSERT_MATCH(join->parents()[1], Filter());
+  FilterIR* new_filter = static_cast<FilterIR*>(join->parents()[1]);
+  EXPECT_THAT(new_filter->parents(), ElementsAre(right_src));
+  // The pushed filter uses the parent-side column name, not the suffixed output name.
+  EXPECT_MATCH(new_filter->filter_expr(), Equals(ColumnNode("abc"), Int(2)));
+}
+
+TEST_F(FilterPushDownTest, push_below_left_join_preserved_side_only) {
+  Relation left_relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "xyz"});
+  Relation right_relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "jkl"});
+  MemorySourceIR* left_src = MakeMemSource("left", left_relation);
+  compiler_state_->relation_map()->emplace("left", left_relation);
+  MemorySourceIR* right_src = MakeMemSource("right", right_relation);
+  compiler_state_->relation_map()->emplace("right", right_relation);
+  JoinIR* join = MakeJoin({left_src, right_src}, "left", left_relation, right_relation, {"abc"},
+                          {"abc"}, {"_x", "_y"});
+
+  auto eq_func = MakeEqualsFunc(MakeColumn("xyz", 0), MakeInt(2));
+  FilterIR* filter = MakeFilter(join, eq_func);
+  MemorySinkIR* sink = MakeMemSink(filter, "foo", {});
+  int64_t filter_id = filter->id();
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  FilterPushdownRule rule(compiler_state_.get());
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_TRUE(result.ValueOrDie());
+
+  // A filter on a left-side column may be pushed below a left join.
+  EXPECT_THAT(sink->parents(), ElementsAre(join));
+  EXPECT_FALSE(graph->HasNode(filter_id));
+  ASSERT_MATCH(join->parents()[0], Filter());
+  FilterIR* new_filter = static_cast<FilterIR*>(join->parents()[0]);
+  EXPECT_THAT(new_filter->parents(), ElementsAre(left_src));
+  EXPECT_MATCH(new_filter->filter_expr(), Equals(ColumnNode("xyz"), Int(2)));
+  EXPECT_EQ(right_src, join->parents()[1]);
+}
+
+TEST_F(FilterPushDownTest, left_join_null_extended_side_no_push) {
+  Relation left_relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "xyz"});
+  Relation right_relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "jkl"});
+  MemorySourceIR* left_src = MakeMemSource("left", left_relation);
+  compiler_state_->relation_map()->emplace("left", left_relation);
+  MemorySourceIR* right_src = MakeMemSource("right", right_relation);
+  compiler_state_->relation_map()->emplace("right", right_relation);
+  JoinIR* join = MakeJoin({left_src, right_src}, "left", left_relation, right_relation, {"abc"},
+                          {"abc"}, {"_x", "_y"});
+
+  // jkl comes from the right side, which gets null-extended by the left join, so the filter must
+  // stay above it.
+  auto eq_func = MakeEqualsFunc(MakeColumn("jkl", 0), MakeInt(2));
+  FilterIR* filter = MakeFilter(join, eq_func);
+  MakeMemSink(filter, "foo", {});
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  FilterPushdownRule rule(compiler_state_.get());
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_FALSE(result.ValueOrDie());
+  EXPECT_THAT(filter->parents(), ElementsAre(join));
+  EXPECT_THAT(join->parents(), ElementsAre(left_src, right_src));
+}
+
+TEST_F(FilterPushDownTest, absorb_time_filter_into_memory_source) {
+  MemorySourceIR* src = MakeMemSource("source", MakeTimeRelation());
+  compiler_state_->relation_map()->emplace("source", MakeTimeRelation());
+
+  auto ge_func = graph
+                     ->CreateNode<FuncIR>(ast, FuncIR::op_map.find(">=")->second,
+                                          std::vector<ExpressionIR*>{MakeColumn("time_", 0),
+                                                                     MakeTime(1234)})
+                     .ConsumeValueOrDie();
+  FilterIR* filter = MakeFilter(src, ge_func);
+  MemorySinkIR* sink = MakeMemSink(filter, "foo", {});
+  int64_t filter_id = filter->id();
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  FilterPushdownRule rule(compiler_state_.get());
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_TRUE(result.ValueOrDie());
+
+  // The filter becomes the source's start bound instead of a row-by-row predicate.
+  EXPECT_FALSE(graph->HasNode(filter_id));
+  EXPECT_THAT(sink->parents(), ElementsAre(src));
+  EXPECT_TRUE(src->IsTimeStartSet());
+  EXPECT_EQ(1234, src->time_start_ns());
+  EXPECT_FALSE(src->IsTimeStopSet());
+}
+
+TEST_F(FilterPushDownTest, absorb_time_filter_exclusive_stop_merges_with_existing) {
+  MemorySourceIR* src = MakeMemSource("source", MakeTimeRelation());
+  compiler_state_->relation_map()->emplace("source", MakeTimeRelation());
+  src->SetTimeStopNS(1000);
+
+  // Constant on the left: 2000 > time_ is time_ < 2000, an exclusive stop bound of 1999 that
+  // loses to the existing tighter bound.
+  auto gt_func =
+      graph
+          ->CreateNode<FuncIR>(
+              ast, FuncIR::op_map.find(">")->second,
+              std::vector<ExpressionIR*>{MakeTime(2000), MakeColumn("time_", 0)})
+          .ConsumeValueOrDie();
+  FilterIR* filter = MakeFilter(src, gt_func);
+  MemorySinkIR* sink = MakeMemSink(filter, "foo", {});
+  int64_t filter_id = filter->id();
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  FilterPushdownRule rule(compiler_state_.get());
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_TRUE(result.ValueOrDie());
+
+  EXPECT_FALSE(graph->HasNode(filter_id));
+  EXPECT_THAT(sink->parents(), ElementsAre(src));
+  EXPECT_EQ(1000, src->time_stop_ns());
+}
+
 }  // namespace distributed
 }  // namespace planner
 }  // namespace carnot
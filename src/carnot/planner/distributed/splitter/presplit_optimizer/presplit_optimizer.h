@@ -20,8 +20,11 @@
 #include <memory>
 
 #include "src/carnot/planner/compiler_state/compiler_state.h"
+#include "src/carnot/planner/distributed/splitter/presplit_optimizer/choose_join_build_side_rule.h"
+#include "src/carnot/planner/distributed/splitter/presplit_optimizer/combine_consecutive_filters_rule.h"
 #include "src/carnot/planner/distributed/splitter/presplit_optimizer/filter_push_down_rule.h"
 #include "src/carnot/planner/distributed/splitter/presplit_optimizer/limit_push_down_rule.h"
+#include "src/carnot/planner/distributed/splitter/presplit_optimizer/split_filter_conjunctions_rule.h"
 #include "src/carnot/planner/rules/rule_executor.h"
 
 namespace px {
@@ -54,15 +57,43 @@ class PreSplitOptimizer : public RuleExecutor<IR> {
     limit_pushdown->AddRule<LimitPushdownRule>(compiler_state_);
   }
 
+  void CreateSplitFilterConjunctionsBatch() {
+    // Splitting all conjunctions takes a single pass, since SplitFilter fully decomposes nested
+    // ANDs.
+    RuleBatch* split_conjunctions = CreateRuleBatch<TryUntilMax>("SplitFilterConjunctions", 1);
+    split_conjunctions->AddRule<SplitFilterConjunctionsRule>();
+  }
+
   void CreateFilterPushdownBatch() {
-    // Use TryUntilMax here to avoid swapping the positions of "equal" filters endlessly.
-    RuleBatch* filter_pushdown = CreateRuleBatch<TryUntilMax>("FilterPushdown", 1);
+    // Use TryUntilMax here to avoid swapping the positions of "equal" filters endlessly. Two
+    // iterations so that filters replicated below a union or join in the first pass can continue
+    // toward the memory sources in the second.
+    RuleBatch* filter_pushdown = CreateRuleBatch<TryUntilMax>("FilterPushdown", 2);
     filter_pushdown->AddRule<FilterPushdownRule>(compiler_state_);
   }
 
+  void CreateCombineConsecutiveFiltersBatch() {
+    // The inverse of the conjunction split, run once pushdown has settled: filters that ended up
+    // adjacent again fuse into one conjunction, so each fused stage saves a full row-batch
+    // materialization at execution time. A single topological pass collapses whole chains,
+    // since each filter merges into its surviving parent.
+    RuleBatch* combine_filters = CreateRuleBatch<TryUntilMax>("CombineConsecutiveFilters", 1);
+    combine_filters->AddRule<CombineConsecutiveFiltersRule>(compiler_state_);
+  }
+
+  void CreateChooseJoinBuildSideBatch() {
+    // Runs after filter pushdown so the plan shape is final, and once, since a single pass visits
+    // every join and re-running would never find a further improvement.
+    RuleBatch* join_build_side = CreateRuleBatch<TryUntilMax>("ChooseJoinBuildSide", 1);
+    join_build_side->AddRule<ChooseJoinBuildSideRule>(compiler_state_);
+  }
+
   Status Init() {
     CreateLimitPushdownBatch();
+    CreateSplitFilterConjunctionsBatch();
     CreateFilterPushdownBatch();
+    CreateCombineConsecutiveFiltersBatch();
+    CreateChooseJoinBuildSideBatch();
     return Status::OK();
   }
 
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <queue>
+#include <vector>
+
+#include "src/carnot/planner/distributed/splitter/presplit_optimizer/split_filter_conjunctions_rule.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace distributed {
+
+StatusOr<bool> SplitFilterConjunctionsRule::Apply(IRNode* ir_node) {
+  if (!Match(ir_node, Filter())) {
+    return false;
+  }
+  FilterIR* filter = static_cast<FilterIR*>(ir_node);
+  if (!Match(filter->filter_expr(), LogicalAnd())) {
+    return false;
+  }
+  return SplitFilter(filter);
+}
+
+StatusOr<bool> SplitFilterConjunctionsRule::SplitFilter(FilterIR* filter) {
+  // Collect the conjuncts, peeling nested ANDs so `a and b and c` yields three filters.
+  std::vector<ExpressionIR*> conjuncts;
+  std::queue<ExpressionIR*> exprs;
+  exprs.push(filter->filter_expr());
+  while (!exprs.empty()) {
+    ExpressionIR* expr = exprs.front();
+    exprs.pop();
+    if (Match(expr, LogicalAnd())) {
+      for (ExpressionIR* arg : static_cast<FuncIR*>(expr)->all_args()) {
+        exprs.push(arg);
+      }
+    } else {
+      conjuncts.push_back(expr);
+    }
+  }
+  DCHECK_GE(conjuncts.size(), 2UL);
+
+  DCHECK_EQ(1UL, filter->parents().size());
+  IR* graph = filter->graph();
+  OperatorIR* old_parent = filter->parents()[0];
+
+  // Build a chain of new filters for all but the first conjunct between the old parent and the
+  // original filter, which keeps the first conjunct. The conjunct expressions get cloned by
+  // SetFilterExpr/Init since they still hang off the conjunction function.
+  OperatorIR* bottom = old_parent;
+  for (size_t i = 1; i < conjuncts.size(); ++i) {
+    PX_ASSIGN_OR_RETURN(FilterIR * new_filter,
+                        graph->CreateNode<FilterIR>(filter->ast(), bottom, conjuncts[i]));
+    PX_RETURN_IF_ERROR(new_filter->SetResolvedType(old_parent->resolved_type()));
+    bottom = new_filter;
+  }
+  // SetFilterExpr clones the conjunct and then deletes the now-orphaned conjunction function.
+  PX_RETURN_IF_ERROR(filter->SetFilterExpr(conjuncts[0]));
+  PX_RETURN_IF_ERROR(filter->ReplaceParent(old_parent, bottom));
+  return true;
+}
+
+}  // namespace distributed
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "src/carnot/planner/compiler/analyzer/resolve_types_rule.h"
+#include "src/carnot/planner/distributed/splitter/presplit_optimizer/split_filter_conjunctions_rule.h"
+#include "src/carnot/planner/test_utils.h"
+#include "src/carnot/udf_exporter/udf_exporter.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace distributed {
+
+using compiler::ResolveTypesRule;
+using ::testing::ElementsAre;
+
+using SplitFilterConjunctionsTest = testutils::DistributedRulesTest;
+TEST_F(SplitFilterConjunctionsTest, no_conjunction_no_op) {
+  Relation relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "xyz"});
+  MemorySourceIR* src = MakeMemSource("source", relation);
+  compiler_state_->relation_map()->emplace("source", relation);
+
+  auto eq_func = MakeEqualsFunc(MakeColumn("abc", 0), MakeInt(2));
+  FilterIR* filter = MakeFilter(src, eq_func);
+  MakeMemSink(filter, "foo", {});
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  SplitFilterConjunctionsRule rule;
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_FALSE(result.ValueOrDie());
+  EXPECT_THAT(filter->parents(), ElementsAre(src));
+  EXPECT_MATCH(filter->filter_expr(), Equals(ColumnNode("abc"), Int(2)));
+}
+
+TEST_F(SplitFilterConjunctionsTest, splits_conjunction_into_filter_chain) {
+  Relation relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "xyz"});
+  MemorySourceIR* src = MakeMemSource("source", relation);
+  compiler_state_->relation_map()->emplace("source", relation);
+
+  auto eq_func1 = MakeEqualsFunc(MakeColumn("abc", 0), MakeInt(2));
+  auto eq_func2 = MakeEqualsFunc(MakeColumn("xyz", 0), MakeInt(3));
+  FilterIR* filter = MakeFilter(src, MakeAndFunc(eq_func1, eq_func2));
+  MemorySinkIR* sink = MakeMemSink(filter, "foo", {});
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  SplitFilterConjunctionsRule rule;
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_TRUE(result.ValueOrDie());
+
+  // The original filter keeps one conjunct and a new filter below it gets the other.
+  EXPECT_THAT(sink->parents(), ElementsAre(filter));
+  EXPECT_MATCH(filter->filter_expr(), Equals(ColumnNode("abc"), Int(2)));
+  ASSERT_EQ(1U, filter->parents().size());
+  ASSERT_MATCH(filter->parents()[0], Filter());
+  FilterIR* new_filter = static_cast<FilterIR*>(filter->parents()[0]);
+  EXPECT_MATCH(new_filter->filter_expr(), Equals(ColumnNode("xyz"), Int(3)));
+  EXPECT_THAT(new_filter->parents(), ElementsAre(src));
+}
+
+TEST_F(SplitFilterConjunctionsTest, splits_nested_conjunctions) {
+  Relation relation({types::DataType::INT64, types::DataType::INT64}, {"abc", "xyz"});
+  MemorySourceIR* src = MakeMemSource("source", relation);
+  compiler_state_->relation_map()->emplace("source", relation);
+
+  auto eq_func1 = MakeEqualsFunc(MakeColumn("abc", 0), MakeInt(1));
+  auto eq_func2 = MakeEqualsFunc(MakeColumn("xyz", 0), MakeInt(2));
+  auto eq_func3 = MakeEqualsFunc(MakeColumn("abc", 0), MakeInt(3));
+  FilterIR* filter = MakeFilter(src, MakeAndFunc(MakeAndFunc(eq_func1, eq_func2), eq_func3));
+  MemorySinkIR* sink = MakeMemSink(filter, "foo", {});
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  SplitFilterConjunctionsRule rule;
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  EXPECT_TRUE(result.ValueOrDie());
+
+  // `(a and b) and c` yields three single-conjunct filters with no AND left anywhere.
+  EXPECT_THAT(sink->parents(), ElementsAre(filter));
+  OperatorIR* current = filter;
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_MATCH(current, Filter());
+    EXPECT_MATCH(static_cast<FilterIR*>(current)->filter_expr(),
+                 Equals(ColumnNode(), Int()));
+    ASSERT_EQ(1U, current->parents().size());
+    current = current->parents()[0];
+  }
+  EXPECT_EQ(src, current);
+}
+
+}  // namespace distributed
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -294,16 +294,68 @@ func (m *TableInfo) GetTablets() []string {
 	return nil
 }
 
+type TableStats struct {
+	Bytes   uint64 `protobuf:"varint,1,opt,name=bytes,proto3" json:"bytes,omitempty"`
+	NumRows uint64 `protobuf:"varint,2,opt,name=num_rows,json=numRows,proto3" json:"num_rows,omitempty"`
+}
+
+func (m *TableStats) Reset()      { *m = TableStats{} }
+func (*TableStats) ProtoMessage() {}
+func (*TableStats) Descriptor() ([]byte, []int) {
+	return fileDescriptor_30dce4250507a2af, []int{3}
+}
+func (m *TableStats) XXX_Unmarshal(b []byte) error {
+	return m.Unmarshal(b)
+}
+func (m *TableStats) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	if deterministic {
+		return xxx_messageInfo_TableStats.Marshal(b, m, deterministic)
+	} else {
+		b = b[:cap(b)]
+		n, err := m.MarshalToSizedBuffer(b)
+		if err != nil {
+			return nil, err
+		}
+		return b[:n], nil
+	}
+}
+func (m *TableStats) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_TableStats.Merge(m, src)
+}
+func (m *TableStats) XXX_Size() int {
+	return m.Size()
+}
+func (m *TableStats) XXX_DiscardUnknown() {
+	xxx_messageInfo_TableStats.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_TableStats proto.InternalMessageInfo
+
+func (m *TableStats) GetBytes() uint64 {
+	if m != nil {
+		return m.Bytes
+	}
+	return 0
+}
+
+func (m *TableStats) GetNumRows() uint64 {
+	if m != nil {
+		return m.NumRows
+	}
+	return 0
+}
+
 type SchemaInfo struct {
 	Name      string             `protobuf:"bytes,1,opt,name=name,proto3" json:"name,omitempty"`
 	Relation  *schemapb.Relation `protobuf:"bytes,2,opt,name=relation,proto3" json:"relation,omitempty"`
 	AgentList []*uuidpb.UUID     `protobuf:"bytes,3,rep,name=agent_list,json=agentList,proto3" json:"agent_list,omitempty"`
+	Stats     *TableStats        `protobuf:"bytes,4,opt,name=stats,proto3" json:"stats,omitempty"`
 }
 
 func (m *SchemaInfo) Reset()      { *m = SchemaInfo{} }
 func (*SchemaInfo) ProtoMessage() {}
 func (*SchemaInfo) Descriptor() ([]byte, []int) {
-	return fileDescriptor_30dce4250507a2af, []int{3}
+	return fileDescriptor_30dce4250507a2af, []int{4}
 }
 func (m *SchemaInfo) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -353,6 +405,13 @@ func (m *SchemaInfo) GetAgentList() []*uuidpb.UUID {
 	return nil
 }
 
+func (m *SchemaInfo) GetStats() *TableStats {
+	if m != nil {
+		return m.Stats
+	}
+	return nil
+}
+
 type DistributedState struct {
 	CarnotInfo []*CarnotInfo `protobuf:"bytes,1,rep,name=carnot_info,json=carnotInfo,proto3" json:"carnot_info,omitempty"`
 	SchemaInfo []*SchemaInfo `protobuf:"bytes,2,rep,name=schema_info,json=schemaInfo,proto3" json:"schema_info,omitempty"`
@@ -361,7 +420,7 @@ type DistributedState struct {
 func (m *DistributedState) Reset()      { *m = DistributedState{} }
 func (*DistributedState) ProtoMessage() {}
 func (*DistributedState) Descriptor() ([]byte, []int) {
-	return fileDescriptor_30dce4250507a2af, []int{4}
+	return fileDescriptor_30dce4250507a2af, []int{5}
 }
 func (m *DistributedState) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -413,7 +472,7 @@ type DistributedPlan struct {
 func (m *DistributedPlan) Reset()      { *m = DistributedPlan{} }
 func (*DistributedPlan) ProtoMessage() {}
 func (*DistributedPlan) Descriptor() ([]byte, []int) {
-	return fileDescriptor_30dce4250507a2af, []int{5}
+	return fileDescriptor_30dce4250507a2af, []int{6}
 }
 func (m *DistributedPlan) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -471,7 +530,7 @@ type RedactionOptions struct {
 func (m *RedactionOptions) Reset()      { *m = RedactionOptions{} }
 func (*RedactionOptions) ProtoMessage() {}
 func (*RedactionOptions) Descriptor() ([]byte, []int) {
-	return fileDescriptor_30dce4250507a2af, []int{6}
+	return fileDescriptor_30dce4250507a2af, []int{7}
 }
 func (m *RedactionOptions) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -524,7 +583,7 @@ type OTelEndpointConfig struct {
 func (m *OTelEndpointConfig) Reset()      { *m = OTelEndpointConfig{} }
 func (*OTelEndpointConfig) ProtoMessage() {}
 func (*OTelEndpointConfig) Descriptor() ([]byte, []int) {
-	return fileDescriptor_30dce4250507a2af, []int{7}
+	return fileDescriptor_30dce4250507a2af, []int{8}
 }
 func (m *OTelEndpointConfig) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -589,7 +648,7 @@ type PluginConfig struct {
 func (m *PluginConfig) Reset()      { *m = PluginConfig{} }
 func (*PluginConfig) ProtoMessage() {}
 func (*PluginConfig) Descriptor() ([]byte, []int) {
-	return fileDescriptor_30dce4250507a2af, []int{8}
+	return fileDescriptor_30dce4250507a2af, []int{9}
 }
 func (m *PluginConfig) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -639,7 +698,7 @@ type DebugInfo struct {
 func (m *DebugInfo) Reset()      { *m = DebugInfo{} }
 func (*DebugInfo) ProtoMessage() {}
 func (*DebugInfo) Descriptor() ([]byte, []int) {
-	return fileDescriptor_30dce4250507a2af, []int{9}
+	return fileDescriptor_30dce4250507a2af, []int{10}
 }
 func (m *DebugInfo) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -683,7 +742,7 @@ type DebugInfo_OTelDebugAttribute struct {
 func (m *DebugInfo_OTelDebugAttribute) Reset()      { *m = DebugInfo_OTelDebugAttribute{} }
 func (*DebugInfo_OTelDebugAttribute) ProtoMessage() {}
 func (*DebugInfo_OTelDebugAttribute) Descriptor() ([]byte, []int) {
-	return fileDescriptor_30dce4250507a2af, []int{9, 0}
+	return fileDescriptor_30dce4250507a2af, []int{10, 0}
 }
 func (m *DebugInfo_OTelDebugAttribute) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -727,20 +786,21 @@ func (m *DebugInfo_OTelDebugAttribute) GetValue() string {
 }
 
 type LogicalPlannerState struct {
-	DistributedState    *DistributedState   `protobuf:"bytes,2,opt,name=distributed_state,json=distributedState,proto3" json:"distributed_state,omitempty"`
-	PlanOptions         *planpb.PlanOptions `protobuf:"bytes,3,opt,name=plan_options,json=planOptions,proto3" json:"plan_options,omitempty"`
-	ResultAddress       string              `protobuf:"bytes,4,opt,name=result_address,json=resultAddress,proto3" json:"result_address,omitempty"`
-	ResultSSLTargetName string              `protobuf:"bytes,5,opt,name=result_ssl_targetname,json=resultSslTargetname,proto3" json:"result_ssl_targetname,omitempty"`
-	RedactionOptions    *RedactionOptions   `protobuf:"bytes,7,opt,name=redaction_options,json=redactionOptions,proto3" json:"redaction_options,omitempty"`
-	OTelEndpointConfig  *OTelEndpointConfig `protobuf:"bytes,8,opt,name=otel_endpoint_config,json=otelEndpointConfig,proto3" json:"otel_endpoint_config,omitempty"`
-	PluginConfig        *PluginConfig       `protobuf:"bytes,9,opt,name=plugin_config,json=pluginConfig,proto3" json:"plugin_config,omitempty"`
-	DebugInfo           *DebugInfo          `protobuf:"bytes,10,opt,name=debug_info,json=debugInfo,proto3" json:"debug_info,omitempty"`
+	DistributedState            *DistributedState   `protobuf:"bytes,2,opt,name=distributed_state,json=distributedState,proto3" json:"distributed_state,omitempty"`
+	PlanOptions                 *planpb.PlanOptions `protobuf:"bytes,3,opt,name=plan_options,json=planOptions,proto3" json:"plan_options,omitempty"`
+	ResultAddress               string              `protobuf:"bytes,4,opt,name=result_address,json=resultAddress,proto3" json:"result_address,omitempty"`
+	ResultSSLTargetName         string              `protobuf:"bytes,5,opt,name=result_ssl_targetname,json=resultSslTargetname,proto3" json:"result_ssl_targetname,omitempty"`
+	RedactionOptions            *RedactionOptions   `protobuf:"bytes,7,opt,name=redaction_options,json=redactionOptions,proto3" json:"redaction_options,omitempty"`
+	OTelEndpointConfig          *OTelEndpointConfig `protobuf:"bytes,8,opt,name=otel_endpoint_config,json=otelEndpointConfig,proto3" json:"otel_endpoint_config,omitempty"`
+	PluginConfig                *PluginConfig       `protobuf:"bytes,9,opt,name=plugin_config,json=pluginConfig,proto3" json:"plugin_config,omitempty"`
+	DebugInfo                   *DebugInfo          `protobuf:"bytes,10,opt,name=debug_info,json=debugInfo,proto3" json:"debug_info,omitempty"`
+	DistributedStateFingerprint uint64              `protobuf:"varint,11,opt,name=distributed_state_fingerprint,json=distributedStateFingerprint,proto3" json:"distributed_state_fingerprint,omitempty"`
 }
 
 func (m *LogicalPlannerState) Reset()      { *m = LogicalPlannerState{} }
 func (*LogicalPlannerState) ProtoMessage() {}
 func (*LogicalPlannerState) Descriptor() ([]byte, []int) {
-	return fileDescriptor_30dce4250507a2af, []int{10}
+	return fileDescriptor_30dce4250507a2af, []int{11}
 }
 func (m *LogicalPlannerState) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -825,6 +885,13 @@ func (m *LogicalPlannerState) GetDebugInfo() *DebugInfo {
 	return nil
 }
 
+func (m *LogicalPlannerState) GetDistributedStateFingerprint() uint64 {
+	if m != nil {
+		return m.DistributedStateFingerprint
+	}
+	return 0
+}
+
 type LogicalPlannerResult struct {
 	Status *statuspb.Status `protobuf:"bytes,1,opt,name=status,proto3" json:"status,omitempty"`
 	Plan   *DistributedPlan `protobuf:"bytes,2,opt,name=plan,proto3" json:"plan,omitempty"`
@@ -833,7 +900,7 @@ type LogicalPlannerResult struct {
 func (m *LogicalPlannerResult) Reset()      { *m = LogicalPlannerResult{} }
 func (*LogicalPlannerResult) ProtoMessage() {}
 func (*LogicalPlannerResult) Descriptor() ([]byte, []int) {
-	return fileDescriptor_30dce4250507a2af, []int{11}
+	return fileDescriptor_30dce4250507a2af, []int{12}
 }
 func (m *LogicalPlannerResult) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -880,6 +947,7 @@ func init() {
 	proto.RegisterType((*MetadataInfo)(nil), "px.carnot.planner.distributedpb.MetadataInfo")
 	proto.RegisterType((*CarnotInfo)(nil), "px.carnot.planner.distributedpb.CarnotInfo")
 	proto.RegisterType((*TableInfo)(nil), "px.carnot.planner.distributedpb.TableInfo")
+	proto.RegisterType((*TableStats)(nil), "px.carnot.planner.distributedpb.TableStats")
 	proto.RegisterType((*SchemaInfo)(nil), "px.carnot.planner.distributedpb.SchemaInfo")
 	proto.RegisterType((*DistributedState)(nil), "px.carnot.planner.distributedpb.DistributedState")
 	proto.RegisterType((*DistributedPlan)(nil), "px.carnot.planner.distributedpb.DistributedPlan")
@@ -900,105 +968,105 @@ func init() {
 }
 
 var fileDescriptor_30dce4250507a2af = []byte{
-	// 1564 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xa4, 0x57, 0x4f, 0x6f, 0x1b, 0xc7,
-	0x15, 0xd7, 0x8a, 0x94, 0x48, 0x3e, 0x92, 0x12, 0x3d, 0xa2, 0x5c, 0x96, 0x48, 0x48, 0x97, 0x48,
-	0x50, 0xc1, 0x76, 0x96, 0xa9, 0x12, 0x34, 0x69, 0x80, 0xb4, 0x11, 0x45, 0xff, 0x61, 0xac, 0x26,
-	0xea, 0x50, 0x06, 0x02, 0x1f, 0xba, 0x98, 0xe5, 0x0e, 0xc9, 0x45, 0x96, 0xbb, 0xab, 0x9d, 0x59,
-	0x43, 0x6a, 0x51, 0xa0, 0x3d, 0xf6, 0xd4, 0x7e, 0x8c, 0x9e, 0x7a, 0xeb, 0xb5, 0xd7, 0xf6, 0xe8,
-	0x63, 0x4e, 0x42, 0x4c, 0x5f, 0x7a, 0xcc, 0x17, 0x28, 0x50, 0xcc, 0x9b, 0x5d, 0x6a, 0x49, 0x13,
-	0x90, 0xd3, 0x5c, 0xc8, 0x99, 0xf7, 0x7e, 0xef, 0xcf, 0xcc, 0x7b, 0xbf, 0x99, 0x59, 0xf8, 0x48,
-	0x44, 0xa3, 0xee, 0x88, 0x45, 0x7e, 0x20, 0xbb, 0xa1, 0xc7, 0x7c, 0x9f, 0x47, 0x5d, 0xc7, 0x15,
-	0x32, 0x72, 0xed, 0x58, 0x72, 0x27, 0xb4, 0xb3, 0x33, 0x4b, 0x21, 0xcc, 0x30, 0x0a, 0x64, 0x40,
-	0xda, 0xe1, 0x85, 0xa9, 0xed, 0xcc, 0xc4, 0xce, 0x5c, 0xb2, 0x6b, 0xbe, 0x37, 0x71, 0xe5, 0x34,
-	0xb6, 0xcd, 0x51, 0x30, 0xeb, 0x4e, 0x82, 0x49, 0xd0, 0x45, 0x3b, 0x3b, 0x1e, 0xe3, 0x0c, 0x27,
-	0x38, 0xd2, 0xfe, 0x9a, 0x6d, 0x95, 0x08, 0x0b, 0x5d, 0x0d, 0xeb, 0xc6, 0xb1, 0xab, 0x82, 0xab,
-	0xbf, 0x04, 0xf0, 0xd6, 0x4a, 0xa6, 0xa1, 0xdd, 0xbd, 0x4e, 0xa7, 0xf9, 0x2e, 0x6a, 0x83, 0xd9,
-	0x2c, 0xf0, 0xbb, 0x36, 0x13, 0xbc, 0x2b, 0x24, 0x93, 0xb1, 0x08, 0xed, 0x64, 0x90, 0xc0, 0xee,
-	0x2a, 0x98, 0x98, 0xb2, 0x88, 0x3b, 0x5d, 0xdb, 0x0b, 0x82, 0xd9, 0xd8, 0xf5, 0x24, 0x8f, 0x42,
-	0x3b, 0x3b, 0x4b, 0xb0, 0xef, 0x64, 0xb0, 0x33, 0x2e, 0x99, 0xc3, 0x24, 0x0b, 0xed, 0xc5, 0x30,
-	0x1b, 0x58, 0x32, 0xdb, 0xe3, 0x96, 0x90, 0x41, 0xc4, 0xbb, 0x62, 0x34, 0xe5, 0x33, 0x05, 0xd4,
-	0x03, 0x0d, 0xeb, 0xcc, 0x0d, 0xa8, 0xfc, 0x3a, 0xb1, 0x1c, 0xf8, 0xe3, 0x80, 0x3c, 0x81, 0xdd,
-	0xd4, 0x93, 0x35, 0x76, 0xb9, 0xe7, 0x88, 0x86, 0x71, 0x27, 0x77, 0xb0, 0x73, 0xd8, 0x31, 0xc3,
-	0x0b, 0x53, 0x87, 0x35, 0xaf, 0xc3, 0x9a, 0xa9, 0xf1, 0xd9, 0x65, 0xc8, 0xe9, 0x4e, 0xaa, 0x78,
-	0x88, 0x96, 0xe4, 0xf7, 0xb0, 0x7f, 0x71, 0x31, 0x65, 0x62, 0xfa, 0xf3, 0x0f, 0x2d, 0x5c, 0x88,
-	0xa5, 0x57, 0xd2, 0xd8, 0xbc, 0x63, 0x1c, 0x94, 0x0f, 0xef, 0x67, 0x5c, 0x2e, 0xad, 0xda, 0xfc,
-	0xea, 0xab, 0xc7, 0x68, 0xd5, 0x53, 0xd2, 0x87, 0x28, 0xed, 0xfd, 0x68, 0x7e, 0xd5, 0xde, 0x5b,
-	0xa3, 0x78, 0xbc, 0x41, 0xf7, 0xd2, 0x28, 0x59, 0x7c, 0x11, 0xb6, 0xb5, 0xbf, 0xce, 0xb7, 0x79,
-	0x80, 0x63, 0xac, 0x10, 0x2e, 0xf1, 0x7d, 0xa8, 0x9f, 0xc7, 0x3c, 0xba, 0xb4, 0xec, 0x28, 0xf8,
-	0x9a, 0x47, 0x16, 0x73, 0x9c, 0x88, 0x0b, 0xb5, 0x4e, 0xe3, 0xa0, 0x44, 0x09, 0xea, 0x7a, 0xa8,
-	0x3a, 0xd2, 0x1a, 0xf2, 0x11, 0x14, 0xd9, 0x84, 0xfb, 0xd2, 0x72, 0x9d, 0x06, 0x60, 0xea, 0xbb,
-	0x2a, 0x75, 0xdd, 0x0c, 0xe6, 0xd3, 0xa7, 0x83, 0x7e, 0xaf, 0x3c, 0xbf, 0x6a, 0x17, 0x8e, 0x14,
-	0x68, 0xd0, 0xa7, 0x05, 0x44, 0x0f, 0x1c, 0xf2, 0x0b, 0xd8, 0x9d, 0x32, 0x61, 0x4d, 0xa2, 0x70,
-	0x64, 0x09, 0x1e, 0x3d, 0x4f, 0x96, 0x5e, 0xec, 0xdd, 0x9a, 0x5f, 0xb5, 0xab, 0x8f, 0x99, 0x78,
-	0x44, 0x4f, 0x8f, 0x87, 0xa8, 0xa0, 0xd5, 0x29, 0x13, 0x8f, 0xa2, 0x70, 0xa4, 0xa7, 0xe4, 0x10,
-	0x2a, 0x68, 0x96, 0x66, 0x97, 0x53, 0xd9, 0xf5, 0x76, 0xe7, 0x57, 0xed, 0xb2, 0x32, 0x4a, 0x52,
-	0xa3, 0x65, 0x05, 0x4a, 0xf3, 0x7c, 0x07, 0x76, 0x54, 0x38, 0x2c, 0x1e, 0x56, 0xbd, 0x91, 0x57,
-	0xd1, 0x68, 0x65, 0xca, 0x44, 0x9f, 0x49, 0x36, 0x54, 0x32, 0xf2, 0x2e, 0xec, 0x84, 0x51, 0x30,
-	0xe2, 0x42, 0x70, 0x8d, 0x6d, 0x6c, 0x21, 0xaa, 0xba, 0x90, 0x2a, 0x2c, 0xf9, 0x10, 0x6e, 0xb3,
-	0xd1, 0x88, 0x87, 0x52, 0x58, 0x11, 0x9f, 0x05, 0x92, 0x5b, 0x22, 0x88, 0xa3, 0x11, 0x17, 0x8d,
-	0x6d, 0x84, 0xd7, 0x13, 0x2d, 0x45, 0xe5, 0x50, 0xeb, 0xc8, 0x00, 0x40, 0x77, 0x9d, 0xeb, 0x8f,
-	0x83, 0x46, 0xe1, 0x4e, 0xee, 0xa0, 0x7c, 0x78, 0xd7, 0xbc, 0x81, 0x94, 0xe6, 0x99, 0x32, 0x51,
-	0xc5, 0xa1, 0x25, 0x99, 0x0e, 0xc9, 0x5b, 0x90, 0x67, 0xc2, 0x75, 0x1a, 0xc5, 0x3b, 0xc6, 0x41,
-	0xb5, 0x57, 0x9c, 0x5f, 0xb5, 0xf3, 0x47, 0xc3, 0x41, 0x9f, 0xa2, 0x94, 0x50, 0xa8, 0x2e, 0x1a,
-	0x15, 0x63, 0x95, 0xb0, 0x30, 0xef, 0xdd, 0x18, 0x2b, 0xdb, 0xee, 0xb4, 0x32, 0xcb, 0x36, 0xff,
-	0xc7, 0xb0, 0x23, 0x84, 0x67, 0x49, 0x16, 0x4d, 0xb8, 0xf4, 0xd9, 0x8c, 0x37, 0xca, 0xb8, 0xeb,
-	0x58, 0xad, 0xe1, 0xf0, 0xe4, 0x0c, 0x15, 0x5f, 0xb0, 0x19, 0xa7, 0x55, 0x21, 0xbc, 0xb3, 0x05,
-	0xae, 0x33, 0x85, 0xd2, 0x62, 0x0d, 0xa4, 0x0e, 0x5b, 0xb8, 0x8a, 0xa4, 0xa3, 0xf4, 0x84, 0xdc,
-	0x83, 0x5b, 0x38, 0x90, 0xee, 0xef, 0x98, 0x74, 0x03, 0xdf, 0xfa, 0x9a, 0x5f, 0x62, 0x37, 0x94,
-	0x68, 0x6d, 0x49, 0xf1, 0x84, 0x5f, 0x92, 0x06, 0x14, 0xb4, 0x4c, 0x15, 0x3e, 0x77, 0x50, 0xa2,
-	0xe9, 0xb4, 0xf3, 0x17, 0x03, 0x60, 0x88, 0x14, 0xc6, 0x58, 0x04, 0xf2, 0x98, 0xa8, 0x0e, 0x85,
-	0x63, 0xf2, 0x29, 0x14, 0x23, 0xee, 0xa1, 0xaf, 0x84, 0x69, 0x3f, 0x51, 0xbb, 0x92, 0x39, 0x0d,
-	0xcc, 0xf4, 0x34, 0x30, 0x69, 0x02, 0xa4, 0x0b, 0x13, 0x62, 0x02, 0xe8, 0x6e, 0xf7, 0x5c, 0x21,
-	0x31, 0xfc, 0xeb, 0xfd, 0x4e, 0x4b, 0x08, 0x39, 0x71, 0x85, 0xec, 0xfc, 0xdd, 0x80, 0x5a, 0xff,
-	0x7a, 0x8b, 0x87, 0x92, 0x49, 0x4e, 0x4e, 0xa0, 0xac, 0xab, 0xa0, 0x8b, 0x63, 0xa0, 0x97, 0x7b,
-	0x37, 0x16, 0xe7, 0x9a, 0xa6, 0x14, 0x46, 0xd7, 0x94, 0x3d, 0x81, 0xb2, 0xce, 0x58, 0x7b, 0xdb,
-	0x7c, 0x43, 0x6f, 0xd7, 0xfb, 0x44, 0x41, 0x2c, 0xc6, 0x9d, 0x7f, 0xe5, 0x60, 0x37, 0x93, 0xf0,
-	0xa9, 0xc7, 0x7c, 0x12, 0x01, 0x39, 0xb7, 0x53, 0xb2, 0x59, 0x32, 0xc0, 0x3b, 0x25, 0x49, 0xfb,
-	0xc1, 0x8d, 0x81, 0x56, 0xbc, 0x99, 0xbf, 0xb1, 0x13, 0x4a, 0x9e, 0x05, 0x6a, 0xfe, 0xc0, 0x97,
-	0xd1, 0x25, 0xdd, 0x3d, 0x5f, 0x96, 0x92, 0xe7, 0x50, 0x5f, 0x8e, 0xe9, 0xb0, 0x89, 0x3a, 0x62,
-	0xf4, 0xf2, 0x1e, 0xfe, 0x90, 0xa8, 0x7d, 0x36, 0x19, 0x38, 0x3a, 0x6c, 0xed, 0x7c, 0x45, 0x4c,
-	0x7e, 0x0a, 0x39, 0x87, 0x4d, 0xf0, 0x44, 0x29, 0x1f, 0xee, 0xaf, 0x84, 0x51, 0x7e, 0x8f, 0x1e,
-	0x51, 0x85, 0x68, 0x3e, 0x83, 0xfa, 0xba, 0x95, 0x90, 0x1a, 0xe4, 0x54, 0xf3, 0xea, 0x9e, 0x53,
-	0x43, 0x72, 0x1f, 0xb6, 0x9e, 0x33, 0x2f, 0xe6, 0x49, 0xbf, 0xdd, 0x7e, 0xdd, 0xa9, 0xb2, 0xa6,
-	0x1a, 0xf4, 0xc9, 0xe6, 0xc7, 0x46, 0xf3, 0x18, 0xf6, 0xd7, 0xe6, 0xbb, 0xc6, 0x79, 0x3d, 0xeb,
-	0x3c, 0x9f, 0x71, 0xd2, 0xf9, 0x93, 0x01, 0x35, 0xca, 0x1d, 0x36, 0x52, 0x8d, 0xfb, 0x65, 0xa8,
-	0x7e, 0x05, 0xb9, 0x0f, 0x24, 0x16, 0xdc, 0x1a, 0xc7, 0x9e, 0x67, 0x45, 0xa9, 0x12, 0xfd, 0x15,
-	0x69, 0x2d, 0x16, 0xfc, 0x61, 0xec, 0x79, 0x0b, 0x23, 0xf2, 0x2b, 0x78, 0x5b, 0xa1, 0xc3, 0x8b,
-	0x04, 0x6b, 0x85, 0xae, 0x6b, 0xd9, 0x5c, 0x48, 0x8b, 0x8f, 0xc7, 0x41, 0x24, 0xf5, 0x81, 0x4d,
-	0x1b, 0xb1, 0xe0, 0xa7, 0x17, 0xda, 0xec, 0xd4, 0x75, 0x7b, 0x5c, 0xc8, 0x07, 0xa8, 0xef, 0xfc,
-	0xd7, 0x00, 0xf2, 0xe5, 0x19, 0xf7, 0x1e, 0xf8, 0x4e, 0x18, 0xb8, 0xbe, 0x3c, 0x0e, 0xfc, 0xb1,
-	0x3b, 0x21, 0x3f, 0x86, 0x5c, 0x1c, 0x79, 0x7a, 0x19, 0xbd, 0xc2, 0xfc, 0xaa, 0x9d, 0x7b, 0x4a,
-	0x4f, 0xa8, 0x92, 0x91, 0x67, 0x50, 0x98, 0x72, 0xe6, 0xf0, 0x48, 0x24, 0xa5, 0xfe, 0xec, 0xc6,
-	0x52, 0xbf, 0x1e, 0xc0, 0x7c, 0xac, 0x5d, 0xe8, 0x22, 0xa7, 0x0e, 0x49, 0x13, 0x8a, 0xae, 0x2f,
-	0xf8, 0x28, 0x8e, 0x38, 0x16, 0xb8, 0x48, 0x17, 0x73, 0x3c, 0x54, 0xdc, 0x19, 0x0f, 0x62, 0x89,
-	0xf7, 0x42, 0x8e, 0xa6, 0xd3, 0xe6, 0x27, 0x50, 0xc9, 0xba, 0xbb, 0xa9, 0x06, 0xa5, 0x6c, 0x0d,
-	0x28, 0x54, 0x4e, 0xbd, 0x78, 0xe2, 0xfa, 0xc9, 0xc2, 0x3b, 0x50, 0x15, 0x92, 0x45, 0xd2, 0x52,
-	0xce, 0x2d, 0x5f, 0xdf, 0xab, 0x39, 0x5a, 0x46, 0xe1, 0x99, 0x3b, 0xe3, 0x5f, 0x08, 0xd2, 0x82,
-	0x32, 0xf7, 0x9d, 0x05, 0x62, 0x13, 0x11, 0x25, 0xee, 0x3b, 0x5a, 0xdf, 0xf9, 0xa7, 0x01, 0xa5,
-	0x3e, 0xb7, 0xe3, 0x09, 0xb2, 0xff, 0x1c, 0xf6, 0x03, 0xc9, 0x3d, 0xcb, 0x51, 0x12, 0x8b, 0xc9,
-	0x64, 0x5f, 0x44, 0x42, 0xcf, 0x4f, 0x6f, 0x26, 0x4a, 0xea, 0x0a, 0xf7, 0x11, 0x67, 0x47, 0xa9,
-	0x17, 0xba, 0xa7, 0x7c, 0x2f, 0xcb, 0x44, 0xf3, 0x97, 0xba, 0xa6, 0xcb, 0xe2, 0xb5, 0x87, 0xed,
-	0xda, 0x8d, 0xe9, 0xfc, 0x63, 0x0b, 0xf6, 0x4e, 0x82, 0x89, 0x3b, 0x62, 0xde, 0xa9, 0x4e, 0x49,
-	0x1f, 0x8b, 0xbf, 0x85, 0x5b, 0xd9, 0x87, 0xab, 0x7a, 0x04, 0xa6, 0x9c, 0xf9, 0xd9, 0xf7, 0xe1,
-	0x3b, 0x7a, 0xa3, 0x35, 0x67, 0xf5, 0xd8, 0xfd, 0x0c, 0x2a, 0xca, 0xd6, 0x0a, 0x34, 0x17, 0x12,
-	0x8e, 0xbf, 0xbd, 0x9e, 0x8e, 0x09, 0x61, 0x68, 0x39, 0xbc, 0x9e, 0xa8, 0xd7, 0x41, 0xc4, 0x45,
-	0xec, 0xc9, 0xc5, 0xcb, 0x23, 0x8f, 0x0b, 0xab, 0x6a, 0x69, 0xfa, 0xd4, 0x78, 0x02, 0xfb, 0x09,
-	0x6c, 0xe5, 0xc6, 0xdc, 0xc2, 0x86, 0xc7, 0xc7, 0x1a, 0x45, 0xc0, 0xf2, 0xbd, 0xb9, 0xa7, 0xad,
-	0x86, 0xd9, 0xdb, 0x53, 0xed, 0xca, 0x82, 0xa8, 0x8b, 0xd4, 0x0b, 0x6f, 0xb8, 0x2b, 0xab, 0xfc,
-	0xa7, 0xb5, 0x68, 0xf5, 0x44, 0xf8, 0x03, 0xd4, 0xb1, 0x81, 0x78, 0xc2, 0x20, 0x6b, 0x84, 0xad,
-	0x8a, 0x2f, 0x8b, 0xf2, 0xe1, 0x07, 0xff, 0x07, 0xfb, 0x7a, 0xb7, 0xe7, 0x57, 0xed, 0x35, 0xb4,
-	0xa7, 0x44, 0x05, 0x5a, 0x39, 0x0a, 0x28, 0x54, 0x43, 0x64, 0x48, 0x1a, 0xf7, 0x4d, 0x9f, 0x2a,
-	0x59, 0x5e, 0xd1, 0x4a, 0x98, 0x65, 0xd9, 0x00, 0x40, 0xd3, 0x01, 0x2f, 0x44, 0xfd, 0x28, 0xbd,
-	0xfb, 0xe6, 0x44, 0xa0, 0x25, 0x27, 0x1d, 0x7e, 0x9e, 0x2f, 0x1a, 0xb5, 0xcd, 0xcf, 0xf3, 0xc5,
-	0xed, 0x5a, 0xa1, 0xf3, 0x67, 0x03, 0xea, 0xcb, 0x7d, 0xab, 0x8b, 0x48, 0xee, 0xc1, 0xb6, 0xfe,
-	0x62, 0xc1, 0xe6, 0x2f, 0x1f, 0xee, 0xe1, 0xdb, 0x3d, 0xf9, 0x98, 0x31, 0x87, 0x38, 0xa0, 0x09,
-	0x84, 0xf4, 0x21, 0x8f, 0xd7, 0xa7, 0x6e, 0xec, 0xf7, 0xbf, 0xef, 0x45, 0x46, 0xd1, 0xba, 0x77,
-	0xfc, 0xe2, 0x65, 0x6b, 0xe3, 0x9b, 0x97, 0xad, 0x8d, 0xef, 0x5e, 0xb6, 0x8c, 0x3f, 0xce, 0x5b,
-	0xc6, 0xdf, 0xe6, 0x2d, 0xe3, 0xdf, 0xf3, 0x96, 0xf1, 0x62, 0xde, 0x32, 0xbe, 0x9d, 0xb7, 0x8c,
-	0xff, 0xcc, 0x5b, 0x1b, 0xdf, 0xcd, 0x5b, 0xc6, 0x5f, 0x5f, 0xb5, 0x36, 0x5e, 0xbc, 0x6a, 0x6d,
-	0x7c, 0xf3, 0xaa, 0xb5, 0xf1, 0xac, 0xba, 0xe4, 0xda, 0xde, 0xc6, 0xef, 0x9c, 0x0f, 0xfe, 0x17,
-	0x00, 0x00, 0xff, 0xff, 0xb9, 0x38, 0x96, 0xde, 0x51, 0x0e, 0x00, 0x00,
+	// 1553 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xa5, 0x57, 0x5f, 0x6f, 0x1b, 0x45,
+	0x10, 0xc7, 0xb1, 0x13, 0xdb, 0x63, 0x3b, 0x71, 0x37, 0x49, 0x31, 0xa6, 0xa5, 0xc5, 0x6a, 0x45,
+	0xd5, 0x3f, 0xe7, 0xe2, 0x56, 0xb4, 0x54, 0x2a, 0x34, 0x6e, 0x92, 0x36, 0x34, 0xb4, 0x61, 0x9d,
+	0x4a, 0x55, 0x1f, 0x38, 0x9d, 0x7d, 0x6b, 0xe7, 0xd4, 0xf3, 0x9d, 0x73, 0xb7, 0x57, 0x12, 0x10,
+	0x0f, 0x3c, 0xf2, 0x65, 0xf8, 0x08, 0xbc, 0xf2, 0xce, 0x07, 0x40, 0x88, 0x6f, 0xc1, 0x03, 0x12,
+	0xb3, 0xb3, 0x77, 0xf6, 0xd9, 0xb1, 0x94, 0x14, 0x5e, 0xec, 0x9d, 0x99, 0xdf, 0xfc, 0xdb, 0x9d,
+	0x99, 0xdd, 0x83, 0x7b, 0x61, 0xd0, 0x6b, 0xf6, 0xac, 0xc0, 0xf3, 0x65, 0x73, 0xe4, 0x5a, 0x9e,
+	0x27, 0x82, 0xa6, 0xed, 0x84, 0x32, 0x70, 0xba, 0x91, 0x14, 0xf6, 0xa8, 0x9b, 0xa6, 0x4c, 0x85,
+	0x30, 0x46, 0x81, 0x2f, 0x7d, 0x76, 0x69, 0x74, 0x64, 0x68, 0x3d, 0x23, 0xd6, 0x33, 0xa6, 0xf4,
+	0xea, 0xb7, 0x06, 0x8e, 0x3c, 0x88, 0xba, 0x46, 0xcf, 0x1f, 0x36, 0x07, 0xfe, 0xc0, 0x6f, 0x92,
+	0x5e, 0x37, 0xea, 0x13, 0x45, 0x04, 0xad, 0xb4, 0xbd, 0xfa, 0x25, 0x15, 0x88, 0x35, 0x72, 0x34,
+	0xac, 0x19, 0x45, 0x8e, 0x72, 0xae, 0xfe, 0x62, 0xc0, 0x85, 0x99, 0x48, 0x51, 0x3a, 0x09, 0xa7,
+	0x7e, 0x95, 0xa4, 0xfe, 0x70, 0xe8, 0x7b, 0xcd, 0xae, 0x15, 0x8a, 0x66, 0x28, 0x2d, 0x19, 0x85,
+	0x08, 0xd2, 0x8b, 0x18, 0x76, 0x5d, 0xc1, 0xc2, 0x03, 0x2b, 0x10, 0x76, 0xb3, 0xeb, 0xfa, 0xfe,
+	0xb0, 0xef, 0xb8, 0x52, 0x04, 0x08, 0x4b, 0x51, 0x31, 0xf6, 0x4a, 0x0a, 0x3b, 0x14, 0xd2, 0xb2,
+	0x2d, 0x69, 0x21, 0x30, 0x59, 0xa6, 0x1d, 0x4b, 0xab, 0xeb, 0x0a, 0x33, 0x94, 0x7e, 0x80, 0x8e,
+	0x7b, 0x07, 0x62, 0xa8, 0x80, 0x7a, 0xa1, 0x61, 0x8d, 0xbf, 0x32, 0x50, 0xfe, 0x3a, 0xd6, 0xdc,
+	0xf1, 0xfa, 0x3e, 0x7b, 0x06, 0x2b, 0x89, 0x25, 0xb3, 0xef, 0x08, 0xd7, 0x0e, 0x6b, 0x99, 0xcb,
+	0xd9, 0x6b, 0xcb, 0xad, 0x86, 0x81, 0x3b, 0xab, 0xdd, 0x1a, 0x13, 0xb7, 0x46, 0xa2, 0xbc, 0x7f,
+	0x3c, 0x12, 0x7c, 0x39, 0x11, 0x6c, 0x93, 0x26, 0xfb, 0x01, 0xd6, 0x8f, 0x8e, 0x0e, 0xac, 0xf0,
+	0xe0, 0xb3, 0xbb, 0x26, 0x25, 0x62, 0xea, 0x4c, 0x6a, 0x0b, 0x97, 0x33, 0xd7, 0x4a, 0xad, 0x9b,
+	0x29, 0x93, 0x53, 0x59, 0x1b, 0xaf, 0x5e, 0x3d, 0x25, 0xad, 0xb6, 0xe2, 0x6e, 0x13, 0xb7, 0xfd,
+	0xfe, 0x5f, 0x7f, 0x5c, 0x5a, 0x9d, 0x23, 0x78, 0xfa, 0x1e, 0x5f, 0x4d, 0xbc, 0xa4, 0xf1, 0x05,
+	0x58, 0xd2, 0xf6, 0x1a, 0x7f, 0xe6, 0x00, 0x1e, 0xd3, 0x09, 0x51, 0x8a, 0xb7, 0x61, 0xed, 0x30,
+	0x12, 0xc1, 0xb1, 0xd9, 0x0d, 0xfc, 0x37, 0x22, 0x30, 0x2d, 0xdb, 0x0e, 0x44, 0xa8, 0xf2, 0xcc,
+	0x5c, 0x2b, 0x72, 0x46, 0xb2, 0x36, 0x89, 0x36, 0xb4, 0x84, 0xdd, 0x83, 0x82, 0x35, 0x10, 0x9e,
+	0x34, 0x1d, 0xbb, 0x06, 0x14, 0xfa, 0x8a, 0x0a, 0x5d, 0x17, 0x83, 0xf1, 0xf2, 0xe5, 0xce, 0x66,
+	0xbb, 0x84, 0xd1, 0xe5, 0x37, 0x14, 0x68, 0x67, 0x93, 0xe7, 0x09, 0xbd, 0x63, 0xb3, 0xcf, 0x61,
+	0x05, 0x03, 0x33, 0x07, 0xc1, 0xa8, 0x67, 0x86, 0x22, 0x78, 0x1b, 0xa7, 0x5e, 0x68, 0x9f, 0x43,
+	0x78, 0x05, 0x53, 0x79, 0xc2, 0xf7, 0x1e, 0x77, 0x48, 0xc0, 0x2b, 0x88, 0x7c, 0x82, 0x40, 0x4d,
+	0xb2, 0x16, 0x94, 0x49, 0x2d, 0x89, 0x2e, 0xab, 0xa2, 0x6b, 0xaf, 0xa0, 0x5e, 0x49, 0x29, 0xc5,
+	0xa1, 0xf1, 0x92, 0x02, 0x25, 0x71, 0x5e, 0x81, 0x65, 0xe5, 0x8e, 0x0e, 0x8f, 0x4e, 0xbd, 0x96,
+	0x53, 0xde, 0x78, 0x19, 0xb9, 0x9b, 0xc8, 0xec, 0x28, 0x1e, 0xbb, 0x0a, 0xcb, 0x78, 0xf8, 0x3d,
+	0x54, 0x10, 0x1a, 0x5b, 0x5b, 0x24, 0x54, 0x65, 0xcc, 0x55, 0x58, 0x76, 0x17, 0xce, 0x5b, 0xbd,
+	0x9e, 0x18, 0xc9, 0xd0, 0x0c, 0xc4, 0xd0, 0x97, 0x58, 0x48, 0x7e, 0x14, 0x20, 0xa0, 0xb6, 0x44,
+	0xf0, 0xb5, 0x58, 0xca, 0x49, 0xd8, 0xd1, 0x32, 0xb6, 0x03, 0xa0, 0xab, 0xce, 0xc1, 0xad, 0xae,
+	0xe5, 0xb1, 0x74, 0x4a, 0xad, 0xeb, 0xc6, 0x29, 0x4d, 0x69, 0xec, 0x2b, 0x15, 0x75, 0x38, 0xbc,
+	0x28, 0x93, 0x25, 0xbb, 0x00, 0x39, 0x2b, 0xc4, 0x1d, 0x2f, 0xa0, 0xbb, 0x4a, 0xbb, 0x80, 0x99,
+	0xe7, 0x36, 0x3a, 0xb8, 0xbb, 0xc4, 0x65, 0x1c, 0x2a, 0xe3, 0x42, 0x25, 0x5f, 0x45, 0x3a, 0x98,
+	0x5b, 0xa7, 0xfa, 0x4a, 0x97, 0x3b, 0x2f, 0x0f, 0xd3, 0xc5, 0x7f, 0x1f, 0x96, 0xc3, 0xd0, 0x35,
+	0xa5, 0x15, 0x0c, 0x84, 0xf4, 0xac, 0xa1, 0xa8, 0x95, 0x68, 0xd7, 0xe9, 0xb4, 0x3a, 0x9d, 0xdd,
+	0x7d, 0x12, 0x3c, 0x47, 0x01, 0xaf, 0x20, 0x70, 0x7f, 0x8c, 0x6b, 0x1c, 0x40, 0x71, 0x9c, 0x03,
+	0x5b, 0x83, 0x45, 0xca, 0x22, 0xae, 0x28, 0x4d, 0xb0, 0x1b, 0x70, 0x8e, 0x16, 0xd2, 0xf9, 0xde,
+	0x92, 0x8e, 0xef, 0x99, 0x6f, 0xc4, 0x31, 0x55, 0x43, 0x91, 0x57, 0xa7, 0x04, 0xcf, 0xc4, 0x31,
+	0xab, 0x41, 0x5e, 0xf3, 0xd4, 0xc1, 0x67, 0x11, 0x92, 0x90, 0x8d, 0x87, 0x00, 0xe4, 0xa9, 0x83,
+	0xf3, 0x23, 0x54, 0xae, 0xba, 0xc7, 0x52, 0xe8, 0xe2, 0xcd, 0x71, 0x4d, 0xb0, 0x0f, 0xa0, 0xe0,
+	0x45, 0x43, 0x33, 0xf0, 0xbf, 0x0b, 0xc9, 0x43, 0x8e, 0xe7, 0x91, 0xe6, 0x48, 0x36, 0x7e, 0xcf,
+	0x00, 0x74, 0x68, 0x02, 0x50, 0xa8, 0x0c, 0x72, 0x94, 0xa7, 0x8e, 0x94, 0xd6, 0xec, 0x21, 0x14,
+	0x02, 0xe1, 0x52, 0x28, 0x71, 0xa3, 0x7e, 0xac, 0x36, 0x35, 0x35, 0x4c, 0x8c, 0x64, 0x98, 0x18,
+	0x3c, 0x06, 0xf2, 0xb1, 0x0a, 0x33, 0x00, 0x74, 0xb3, 0xb8, 0xb8, 0xed, 0x14, 0xfd, 0xc9, 0x76,
+	0xe1, 0x45, 0x82, 0xec, 0x22, 0x82, 0x6d, 0xc0, 0xa2, 0x9a, 0x85, 0x21, 0xd5, 0x6a, 0xa9, 0x75,
+	0xe3, 0x6c, 0xc5, 0x42, 0xe9, 0x73, 0xad, 0xd9, 0xf8, 0x25, 0x03, 0xd5, 0xcd, 0x09, 0x46, 0xc9,
+	0x04, 0xdb, 0x85, 0x92, 0x36, 0xa3, 0xcb, 0x23, 0x43, 0x81, 0x9c, 0x6e, 0x7d, 0x32, 0x28, 0x38,
+	0xf4, 0x26, 0x43, 0x03, 0xad, 0xe9, 0xa4, 0xb5, 0xb5, 0x85, 0x33, 0x5a, 0x9b, 0x6c, 0x35, 0x87,
+	0x70, 0xbc, 0x6e, 0xfc, 0x96, 0x85, 0x95, 0x54, 0xc0, 0x7b, 0xa8, 0xcb, 0x02, 0x60, 0x87, 0xdd,
+	0xa4, 0xdd, 0x4d, 0xe9, 0xd3, 0xad, 0x16, 0x87, 0xbd, 0x75, 0xaa, 0xa3, 0x19, 0x6b, 0xc6, 0x37,
+	0xdd, 0x78, 0x28, 0xec, 0xfb, 0x8a, 0xde, 0xf2, 0x64, 0x70, 0xcc, 0x57, 0x0e, 0xa7, 0xb9, 0xec,
+	0x2d, 0x8e, 0xc2, 0x29, 0x9f, 0xb6, 0x35, 0x50, 0x43, 0x4e, 0xa7, 0xb7, 0xfd, 0x7f, 0xbc, 0x6e,
+	0x5a, 0x83, 0x1d, 0x5b, 0xbb, 0xad, 0x1e, 0xce, 0xb0, 0xd9, 0x27, 0x90, 0x45, 0x4f, 0x34, 0xd3,
+	0x4a, 0xad, 0xf5, 0x19, 0x37, 0xca, 0xee, 0xc6, 0x13, 0xae, 0x10, 0xf5, 0xd7, 0xb0, 0x36, 0x2f,
+	0x13, 0x56, 0x85, 0xac, 0x6a, 0x1f, 0x5d, 0xb6, 0x6a, 0xc9, 0x6e, 0xc2, 0xe2, 0x5b, 0xcb, 0x8d,
+	0x44, 0x5c, 0xb2, 0xe7, 0x4f, 0x1a, 0x55, 0xda, 0x5c, 0x83, 0x1e, 0x2c, 0xdc, 0xcf, 0xd4, 0x1f,
+	0xc3, 0xfa, 0xdc, 0x78, 0xe7, 0x18, 0x5f, 0x4b, 0x1b, 0xcf, 0xa5, 0x8c, 0x34, 0x7e, 0xc2, 0xd2,
+	0xe3, 0xc2, 0xb6, 0x7a, 0xaa, 0xf6, 0x5f, 0x8c, 0xd4, 0x6f, 0x88, 0xb1, 0xb0, 0x28, 0x14, 0x66,
+	0x3f, 0x72, 0x5d, 0x9c, 0x9d, 0xb1, 0x90, 0xec, 0x15, 0x78, 0x15, 0x25, 0xdb, 0x28, 0x18, 0x2b,
+	0xb1, 0x2f, 0xe1, 0xa2, 0x42, 0x8f, 0x8e, 0x62, 0xac, 0x39, 0x72, 0x1c, 0xb3, 0x2b, 0x42, 0x69,
+	0x8a, 0x7e, 0xdf, 0x0f, 0xa4, 0xbe, 0x32, 0x78, 0x0d, 0x41, 0x7b, 0x47, 0x5a, 0x6d, 0xcf, 0x71,
+	0xda, 0x08, 0xd8, 0x22, 0x79, 0xe3, 0x9f, 0x0c, 0xb0, 0x17, 0xfb, 0xc2, 0xdd, 0xf2, 0xec, 0x91,
+	0xef, 0x78, 0xf2, 0xb1, 0xef, 0xf5, 0x9d, 0x01, 0x4e, 0x81, 0x6c, 0x14, 0xb8, 0x3a, 0x8d, 0x76,
+	0x1e, 0x47, 0x58, 0xf6, 0x25, 0xdf, 0xe5, 0x8a, 0xc7, 0x5e, 0x43, 0xfe, 0x40, 0x58, 0xb6, 0x08,
+	0xc2, 0xf8, 0xa8, 0x1f, 0x9d, 0x7a, 0xd4, 0x27, 0x1d, 0x18, 0x4f, 0xb5, 0x09, 0x7d, 0xc8, 0x89,
+	0x41, 0x56, 0x87, 0x82, 0xe3, 0x85, 0xa2, 0x17, 0xe1, 0xf5, 0x93, 0xa5, 0xc8, 0xc7, 0x34, 0x8d,
+	0x35, 0x67, 0x28, 0xfc, 0x48, 0x52, 0xb7, 0x67, 0x79, 0x42, 0xd6, 0x1f, 0x40, 0x39, 0x6d, 0xee,
+	0xb4, 0x33, 0x28, 0xa6, 0xcf, 0x80, 0x43, 0x79, 0xcf, 0x8d, 0x06, 0x8e, 0x17, 0x27, 0xde, 0x80,
+	0x0a, 0xce, 0x85, 0x40, 0x9a, 0xca, 0xb8, 0xe9, 0xe9, 0xe1, 0x98, 0xe5, 0x25, 0x62, 0xee, 0x23,
+	0xef, 0x79, 0xc8, 0x3e, 0x82, 0x92, 0xf0, 0xec, 0x31, 0x62, 0x81, 0x10, 0x45, 0x64, 0x69, 0x79,
+	0xe3, 0xd7, 0x0c, 0x14, 0x37, 0x45, 0x37, 0x1a, 0x50, 0xf7, 0x1f, 0xc2, 0x3a, 0xde, 0x71, 0xae,
+	0x69, 0x2b, 0x8e, 0x69, 0xc9, 0x78, 0x5f, 0xc2, 0xb8, 0x3d, 0x1f, 0x9e, 0xde, 0x28, 0x89, 0x29,
+	0xda, 0x47, 0xa2, 0x36, 0x12, 0x2b, 0x7c, 0x55, 0xd9, 0x9e, 0xe6, 0x85, 0xf5, 0x2f, 0xf4, 0x99,
+	0x4e, 0xb3, 0xe7, 0xce, 0xeb, 0xb9, 0x1b, 0xd3, 0xf8, 0x7b, 0x11, 0x56, 0x77, 0xfd, 0x81, 0xd3,
+	0xb3, 0xdc, 0x3d, 0x1d, 0x92, 0x1e, 0x8b, 0xdf, 0xc2, 0xb9, 0xf4, 0xd3, 0x59, 0x0d, 0xd0, 0xa4,
+	0x67, 0x3e, 0x7d, 0x97, 0x7e, 0x27, 0x6b, 0xbc, 0x6a, 0xcf, 0x8e, 0xdd, 0x47, 0x50, 0x56, 0xba,
+	0xa6, 0xaf, 0x7b, 0x21, 0xee, 0xf1, 0x8b, 0xf3, 0xdb, 0x31, 0x6e, 0x18, 0x5e, 0x1a, 0x4d, 0x08,
+	0xf5, 0x3e, 0xc1, 0x96, 0x8c, 0x5c, 0x39, 0x7e, 0xfb, 0xe4, 0x28, 0xb1, 0x8a, 0xe6, 0x26, 0x8f,
+	0x9d, 0x67, 0xb0, 0x1e, 0xc3, 0x66, 0xee, 0xec, 0x45, 0x2a, 0x78, 0x7a, 0x2e, 0x72, 0x02, 0x4c,
+	0xdf, 0xdc, 0xab, 0x5a, 0xab, 0x93, 0xbe, 0xbf, 0xd5, 0xae, 0x8c, 0x1b, 0x75, 0x1c, 0x7a, 0xfe,
+	0x8c, 0xbb, 0x32, 0xdb, 0xff, 0xbc, 0x1a, 0xcc, 0x4e, 0x84, 0x1f, 0x61, 0x8d, 0x0a, 0x48, 0xc4,
+	0x1d, 0x64, 0xf6, 0xa8, 0x54, 0xe9, 0x6d, 0x53, 0x6a, 0xdd, 0xf9, 0x0f, 0xdd, 0xd7, 0x3e, 0x8f,
+	0x09, 0xce, 0x69, 0x7b, 0xce, 0x94, 0xa3, 0x99, 0x51, 0x80, 0x8f, 0xa5, 0x11, 0x75, 0x48, 0xe2,
+	0xf7, 0xac, 0x8f, 0xa5, 0x74, 0x5f, 0xf1, 0xf2, 0x28, 0xdd, 0x65, 0xf8, 0xd2, 0xd3, 0xed, 0x40,
+	0x17, 0xa2, 0x7e, 0x16, 0x5f, 0x3f, 0x7b, 0x23, 0xf0, 0xa2, 0x3d, 0x6e, 0xaf, 0x36, 0x5c, 0x3c,
+	0x51, 0x93, 0xf8, 0xa9, 0xe0, 0x0d, 0xf0, 0x63, 0x20, 0xc0, 0x2c, 0xe8, 0x19, 0x96, 0xe3, 0x1f,
+	0xce, 0x16, 0xdb, 0xf6, 0x04, 0xf2, 0x55, 0xae, 0x90, 0xa9, 0x2e, 0xe0, 0xef, 0x52, 0x35, 0xdf,
+	0xf8, 0x39, 0x03, 0x6b, 0xd3, 0xb5, 0xaf, 0x0b, 0x01, 0xdf, 0x60, 0x4b, 0xfa, 0xbb, 0x8b, 0x1a,
+	0xa8, 0xd4, 0x5a, 0xa5, 0x2f, 0x90, 0xf8, 0x93, 0xcc, 0xe8, 0xd0, 0x82, 0xc7, 0x10, 0xb6, 0x09,
+	0x39, 0xba, 0x82, 0x75, 0x73, 0xdc, 0x7e, 0xd7, 0xcb, 0x90, 0x93, 0x76, 0x7b, 0xe5, 0x75, 0x65,
+	0x0a, 0xd6, 0x5d, 0xa2, 0x2f, 0xaf, 0x3b, 0xff, 0x02, 0x9e, 0x12, 0x48, 0xde, 0xe3, 0x0e, 0x00,
+	0x00,
 }
 
 func (this *MetadataInfo) Equal(that interface{}) bool {
@@ -1157,6 +1225,33 @@ func (this *TableInfo) Equal(that interface{}) bool {
 	}
 	return true
 }
+func (this *TableStats) Equal(that interface{}) bool {
+	if that == nil {
+		return this == nil
+	}
+
+	that1, ok := that.(*TableStats)
+	if !ok {
+		that2, ok := that.(TableStats)
+		if ok {
+			that1 = &that2
+		} else {
+			return false
+		}
+	}
+	if that1 == nil {
+		return this == nil
+	} else if this == nil {
+		return false
+	}
+	if this.Bytes != that1.Bytes {
+		return false
+	}
+	if this.NumRows != that1.NumRows {
+		return false
+	}
+	return true
+}
 func (this *SchemaInfo) Equal(that interface{}) bool {
 	if that == nil {
 		return this == nil
@@ -1190,6 +1285,9 @@ func (this *SchemaInfo) Equal(that interface{}) bool {
 			return false
 		}
 	}
+	if !this.Stats.Equal(that1.Stats) {
+		return false
+	}
 	return true
 }
 func (this *DistributedState) Equal(that interface{}) bool {
@@ -1460,6 +1558,9 @@ func (this *LogicalPlannerState) Equal(that interface{}) bool {
 	if !this.DebugInfo.Equal(that1.DebugInfo) {
 		return false
 	}
+	if this.DistributedStateFingerprint != that1.DistributedStateFingerprint {
+		return false
+	}
 	return true
 }
 func (this *LogicalPlannerResult) Equal(that interface{}) bool {
@@ -1548,11 +1649,22 @@ func (this *TableInfo) GoString() string {
 	s = append(s, "}")
 	return strings.Join(s, "")
 }
+func (this *TableStats) GoString() string {
+	if this == nil {
+		return "nil"
+	}
+	s := make([]string, 0, 6)
+	s = append(s, "&distributedpb.TableStats{")
+	s = append(s, "Bytes: "+fmt.Sprintf("%#v", this.Bytes)+",\n")
+	s = append(s, "NumRows: "+fmt.Sprintf("%#v", this.NumRows)+",\n")
+	s = append(s, "}")
+	return strings.Join(s, "")
+}
 func (this *SchemaInfo) GoString() string {
 	if this == nil {
 		return "nil"
 	}
-	s := make([]string, 0, 7)
+	s := make([]string, 0, 8)
 	s = append(s, "&distributedpb.SchemaInfo{")
 	s = append(s, "Name: "+fmt.Sprintf("%#v", this.Name)+",\n")
 	if this.Relation != nil {
@@ -1561,6 +1673,9 @@ func (this *SchemaInfo) GoString() string {
 	if this.AgentList != nil {
 		s = append(s, "AgentList: "+fmt.Sprintf("%#v", this.AgentList)+",\n")
 	}
+	if this.Stats != nil {
+		s = append(s, "Stats: "+fmt.Sprintf("%#v", this.Stats)+",\n")
+	}
 	s = append(s, "}")
 	return strings.Join(s, "")
 }
@@ -1691,7 +1806,7 @@ func (this *LogicalPlannerState) GoString() string {
 	if this == nil {
 		return "nil"
 	}
-	s := make([]string, 0, 12)
+	s := make([]string, 0, 13)
 	s = append(s, "&distributedpb.LogicalPlannerState{")
 	if this.DistributedState != nil {
 		s = append(s, "DistributedState: "+fmt.Sprintf("%#v", this.DistributedState)+",\n")
@@ -1713,6 +1828,7 @@ func (this *LogicalPlannerState) GoString() string {
 	if this.DebugInfo != nil {
 		s = append(s, "DebugInfo: "+fmt.Sprintf("%#v", this.DebugInfo)+",\n")
 	}
+	s = append(s, "DistributedStateFingerprint: "+fmt.Sprintf("%#v", this.DistributedStateFingerprint)+",\n")
 	s = append(s, "}")
 	return strings.Join(s, "")
 }
@@ -1983,6 +2099,39 @@ func (m *TableInfo) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	return len(dAtA) - i, nil
 }
 
+func (m *TableStats) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalToSizedBuffer(dAtA[:size])
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *TableStats) MarshalTo(dAtA []byte) (int, error) {
+	size := m.Size()
+	return m.MarshalToSizedBuffer(dAtA[:size])
+}
+
+func (m *TableStats) MarshalToSizedBuffer(dAtA []byte) (int, error) {
+	i := len(dAtA)
+	_ = i
+	var l int
+	_ = l
+	if m.NumRows != 0 {
+		i = encodeVarintDistributedPlan(dAtA, i, uint64(m.NumRows))
+		i--
+		dAtA[i] = 0x10
+	}
+	if m.Bytes != 0 {
+		i = encodeVarintDistributedPlan(dAtA, i, uint64(m.Bytes))
+		i--
+		dAtA[i] = 0x8
+	}
+	return len(dAtA) - i, nil
+}
+
 func (m *SchemaInfo) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
@@ -2003,6 +2152,18 @@ func (m *SchemaInfo) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	_ = i
 	var l int
 	_ = l
+	if m.Stats != nil {
+		{
+			size, err := m.Stats.MarshalToSizedBuffer(dAtA[:i])
+			if err != nil {
+				return 0, err
+			}
+			i -= size
+			i = encodeVarintDistributedPlan(dAtA, i, uint64(size))
+		}
+		i--
+		dAtA[i] = 0x22
+	}
 	if len(m.AgentList) > 0 {
 		for iNdEx := len(m.AgentList) - 1; iNdEx >= 0; iNdEx-- {
 			{
@@ -2402,6 +2563,11 @@ func (m *LogicalPlannerState) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	_ = i
 	var l int
 	_ = l
+	if m.DistributedStateFingerprint != 0 {
+		i = encodeVarintDistributedPlan(dAtA, i, uint64(m.DistributedStateFingerprint))
+		i--
+		dAtA[i] = 0x58
+	}
 	if m.DebugInfo != nil {
 		{
 			size, err := m.DebugInfo.MarshalToSizedBuffer(dAtA[:i])
@@ -2653,6 +2819,21 @@ func (m *TableInfo) Size() (n int) {
 	return n
 }
 
+func (m *TableStats) Size() (n int) {
+	if m == nil {
+		return 0
+	}
+	var l int
+	_ = l
+	if m.Bytes != 0 {
+		n += 1 + sovDistributedPlan(uint64(m.Bytes))
+	}
+	if m.NumRows != 0 {
+		n += 1 + sovDistributedPlan(uint64(m.NumRows))
+	}
+	return n
+}
+
 func (m *SchemaInfo) Size() (n int) {
 	if m == nil {
 		return 0
@@ -2673,6 +2854,10 @@ func (m *SchemaInfo) Size() (n int) {
 			n += 1 + l + sovDistributedPlan(uint64(l))
 		}
 	}
+	if m.Stats != nil {
+		l = m.Stats.Size()
+		n += 1 + l + sovDistributedPlan(uint64(l))
+	}
 	return n
 }
 
@@ -2858,6 +3043,9 @@ func (m *LogicalPlannerState) Size() (n int) {
 		l = m.DebugInfo.Size()
 		n += 1 + l + sovDistributedPlan(uint64(l))
 	}
+	if m.DistributedStateFingerprint != 0 {
+		n += 1 + sovDistributedPlan(uint64(m.DistributedStateFingerprint))
+	}
 	return n
 }
 
@@ -2942,6 +3130,17 @@ func (this *TableInfo) String() string {
 	}, "")
 	return s
 }
+func (this *TableStats) String() string {
+	if this == nil {
+		return "nil"
+	}
+	s := strings.Join([]string{`&TableStats{`,
+		`Bytes:` + fmt.Sprintf("%v", this.Bytes) + `,`,
+		`NumRows:` + fmt.Sprintf("%v", this.NumRows) + `,`,
+		`}`,
+	}, "")
+	return s
+}
 func (this *SchemaInfo) String() string {
 	if this == nil {
 		return "nil"
@@ -2955,6 +3154,7 @@ func (this *SchemaInfo) String() string {
 		`Name:` + fmt.Sprintf("%v", this.Name) + `,`,
 		`Relation:` + strings.Replace(fmt.Sprintf("%v", this.Relation), "Relation", "schemapb.Relation", 1) + `,`,
 		`AgentList:` + repeatedStringForAgentList + `,`,
+		`Stats:` + strings.Replace(this.Stats.String(), "TableStats", "TableStats", 1) + `,`,
 		`}`,
 	}, "")
 	return s
@@ -3096,6 +3296,7 @@ func (this *LogicalPlannerState) String() string {
 		`OTelEndpointConfig:` + strings.Replace(this.OTelEndpointConfig.String(), "OTelEndpointConfig", "OTelEndpointConfig", 1) + `,`,
 		`PluginConfig:` + strings.Replace(this.PluginConfig.String(), "PluginConfig", "PluginConfig", 1) + `,`,
 		`DebugInfo:` + strings.Replace(this.DebugInfo.String(), "DebugInfo", "DebugInfo", 1) + `,`,
+		`DistributedStateFingerprint:` + fmt.Sprintf("%v", this.DistributedStateFingerprint) + `,`,
 		`}`,
 	}, "")
 	return s
@@ -3770,6 +3971,94 @@ func (m *TableInfo) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
+func (m *TableStats) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowDistributedPlan
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= uint64(b&0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: TableStats: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: TableStats: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Bytes", wireType)
+			}
+			m.Bytes = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowDistributedPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.Bytes |= uint64(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 2:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field NumRows", wireType)
+			}
+			m.NumRows = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowDistributedPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.NumRows |= uint64(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		default:
+			iNdEx = preIndex
+			skippy, err := skipDistributedPlan(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if (skippy < 0) || (iNdEx+skippy) < 0 {
+				return ErrInvalidLengthDistributedPlan
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
 func (m *SchemaInfo) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
@@ -3901,6 +4190,42 @@ func (m *SchemaInfo) Unmarshal(dAtA []byte) error {
 				return err
 			}
 			iNdEx = postIndex
+		case 4:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Stats", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowDistributedPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= int(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthDistributedPlan
+			}
+			postIndex := iNdEx + msglen
+			if postIndex < 0 {
+				return ErrInvalidLengthDistributedPlan
+			}
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Stats == nil {
+				m.Stats = &TableStats{}
+			}
+			if err := m.Stats.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipDistributedPlan(dAtA[iNdEx:])
@@ -5301,6 +5626,25 @@ func (m *LogicalPlannerState) Unmarshal(dAtA []byte) error {
 				return err
 			}
 			iNdEx = postIndex
+		case 11:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field DistributedStateFingerprint", wireType)
+			}
+			m.DistributedStateFingerprint = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowDistributedPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.DistributedStateFingerprint |= uint64(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipDistributedPlan(dAtA[iNdEx:])
@@ -31,6 +31,8 @@ Status GRPCSinkIR::CopyFromNodeImpl(const IRNode* node,
   destination_ssl_targetname_ = grpc_sink->destination_ssl_targetname_;
   name_ = grpc_sink->name_;
   out_columns_ = grpc_sink->out_columns_;
+  shuffle_key_columns_ = grpc_sink->shuffle_key_columns_;
+  agent_id_to_shuffle_destinations_ = grpc_sink->agent_id_to_shuffle_destinations_;
   return Status::OK();
 }
 
@@ -62,6 +64,31 @@ Status GRPCSinkIR::ToProto(planpb::Operator* op, int64_t agent_id) const {
     return CreateIRNodeError("No agent ID '$0' found in grpc sink '$1'", agent_id, DebugString());
   }
   pb->set_grpc_source_id(agent_id_to_destination_id_.find(agent_id)->second);
+
+  // A shuffled sink with multiple resolved destinations for this agent additionally emits the
+  // hash-partition spec; with a single destination, the plain single-destination sink above is
+  // already correct (and cheaper at exec time).
+  auto shuffle_it = agent_id_to_shuffle_destinations_.find(agent_id);
+  if (is_shuffle() && shuffle_it != agent_id_to_shuffle_destinations_.end() &&
+      shuffle_it->second.size() > 1) {
+    DCHECK(is_type_resolved());
+    auto* shuffle_pb = pb->mutable_hash_shuffle();
+    const auto col_names = resolved_table_type()->ColumnNames();
+    for (const auto& key_col : shuffle_key_columns_) {
+      const auto col_it = std::find(col_names.begin(), col_names.end(), key_col);
+      if (col_it == col_names.end()) {
+        return CreateIRNodeError("Shuffle key column '$0' not found in input of grpc sink '$1'",
+                                 key_col, DebugString());
+      }
+      shuffle_pb->add_key_column_idxs(std::distance(col_names.begin(), col_it));
+    }
+    for (const auto& dest : shuffle_it->second) {
+      auto* dest_pb = shuffle_pb->add_destinations();
+      dest_pb->set_address(dest.address);
+      dest_pb->set_grpc_source_id(dest.grpc_source_id);
+      dest_pb->set_ssl_targetname(dest.ssl_targetname);
+    }
+  }
   return Status::OK();
 }
 
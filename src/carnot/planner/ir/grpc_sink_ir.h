@@ -138,6 +138,29 @@ class GRPCSinkIR : public OperatorIR {
     return agent_id_to_destination_id_;
   }
 
+  // A single resolved shuffle destination: the GRPC source grpc_source_id on the Carnot
+  // instance at address.
+  struct ShuffleDestination {
+    std::string address;
+    std::string ssl_targetname;
+    int64_t grpc_source_id;
+  };
+
+  // Marks this sink as hash-shuffled by the given key columns. The per-agent destinations are
+  // recorded by the GRPCSourceGroup conversion as the distributed plan is stitched; ToProto
+  // emits a HashShuffleSpec for agents with more than one recorded destination.
+  void SetShuffleKeyColumns(std::vector<std::string> columns) {
+    shuffle_key_columns_ = std::move(columns);
+  }
+  bool is_shuffle() const { return !shuffle_key_columns_.empty(); }
+  const std::vector<std::string>& shuffle_key_columns() const { return shuffle_key_columns_; }
+
+  void AddAgentShuffleDestination(int64_t agent_id, const std::string& address,
+                                  const std::string& ssl_targetname, int64_t grpc_source_id) {
+    agent_id_to_shuffle_destinations_[agent_id].push_back(
+        ShuffleDestination{address, ssl_targetname, grpc_source_id});
+  }
+
  protected:
   Status CopyFromNodeImpl(const IRNode* node,
                           absl::flat_hash_map<const IRNode*, IRNode*>* copied_nodes_map) override;
@@ -156,6 +179,9 @@ class GRPCSinkIR : public OperatorIR {
   std::string name_;
   std::vector<std::string> out_columns_;
   absl::flat_hash_map<int64_t, int64_t> agent_id_to_destination_id_;
+  // Used when the sink hash-partitions its output across multiple destinations.
+  std::vector<std::string> shuffle_key_columns_;
+  absl::flat_hash_map<int64_t, std::vector<ShuffleDestination>> agent_id_to_shuffle_destinations_;
 };
 
 }  // namespace planner
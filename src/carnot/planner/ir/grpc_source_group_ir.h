@@ -73,6 +73,7 @@ class GRPCSourceGroupIR : public OperatorIR {
   Status AddGRPCSink(GRPCSinkIR* sink_op, const absl::flat_hash_set<int64_t>& agents);
   bool GRPCAddressSet() const { return grpc_address_ != ""; }
   const std::string& grpc_address() const { return grpc_address_; }
+  const std::string& ssl_targetname() const { return ssl_targetname_; }
   int64_t source_id() const { return source_id_; }
   const std::vector<std::pair<GRPCSinkIR*, absl::flat_hash_set<int64_t>>>& dependent_sinks() {
     return dependent_sinks_;
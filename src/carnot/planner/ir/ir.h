@@ -139,6 +139,13 @@ class IR {
 
   bool HasNode(int64_t node_id) const { return dag().HasNode(node_id); }
 
+  /**
+   * @brief Ensures ids assigned to newly created nodes start at or above min_id. Used when
+   * independent subgraphs are analyzed as separate graphs that are later merged back together,
+   * so the nodes each analysis creates land in disjoint id ranges.
+   */
+  void ReserveNodeIdsFrom(int64_t min_id) { id_node_counter = std::max(id_node_counter, min_id); }
+
   Status DeleteEdge(int64_t from_node, int64_t to_node);
   Status DeleteEdge(IRNode* from_node, IRNode* to_node);
   Status DeleteNode(int64_t node);
@@ -17,6 +17,7 @@
  */
 #include <map>
 #include <memory>
+#include <utility>
 
 #include "src/carnot/planner/ir/column_ir.h"
 #include "src/carnot/planner/ir/ir.h"
@@ -139,6 +140,30 @@ Status JoinIR::Init(const std::vector<OperatorIR*>& parents, const std::string&
   return SetJoinType(how_type);
 }
 
+Status JoinIR::FlipParentOrder() {
+  DCHECK_EQ(2UL, parents().size());
+  DCHECK(join_type_ == JoinType::kInner) << "Parent order carries semantics for non-inner joins.";
+  DCHECK(!output_columns_.empty()) << "Output columns must be resolved before flipping parents.";
+
+  std::vector<OperatorIR*> old_parents = parents();
+  for (OperatorIR* parent : old_parents) {
+    PX_RETURN_IF_ERROR(RemoveParent(parent));
+  }
+  PX_RETURN_IF_ERROR(AddParent(old_parents[1]));
+  PX_RETURN_IF_ERROR(AddParent(old_parents[0]));
+
+  // The left on-columns must keep referring to parents()[0], so the vectors swap along with the
+  // parents and every column's parent index flips.
+  std::swap(left_on_columns_, right_on_columns_);
+  for (const auto& columns : {left_on_columns_, right_on_columns_, output_columns_}) {
+    for (ColumnIR* col : columns) {
+      DCHECK_LT(col->container_op_parent_idx(), 2);
+      col->SetContainingOperatorParentIdx(1 - col->container_op_parent_idx());
+    }
+  }
+  return Status::OK();
+}
+
 Status JoinIR::SetJoinColumns(const std::vector<ColumnIR*>& left_columns,
                               const std::vector<ColumnIR*>& right_columns) {
   DCHECK(left_on_columns_.empty());
@@ -119,6 +119,15 @@ class JoinIR : public OperatorIR {
 
   Status UpdateOpAfterParentTypesResolvedImpl() override;
 
+  /**
+   * @brief Swaps the order of the two parents, updating the on-columns and the output columns to
+   * match. The join's output relation is unchanged, so this must only be called once the output
+   * columns have been resolved, and only for inner joins, where the parent order carries no
+   * semantics. The execution engine builds its hash table from the left input, so cost-based rules
+   * use this to make the smaller input the build side.
+   */
+  Status FlipParentOrder();
+
  protected:
   StatusOr<absl::flat_hash_set<std::string>> PruneOutputColumnsToImpl(
       const absl::flat_hash_set<std::string>& kept_columns) override;
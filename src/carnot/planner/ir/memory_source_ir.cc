@@ -64,6 +64,7 @@ Status MemorySourceIR::ToProto(planpb::Operator* op) const {
   }
 
   pb->set_streaming(streaming());
+  pb->set_sample_every_n(sample_every_n());
   return Status::OK();
 }
 
@@ -106,6 +107,7 @@ Status MemorySourceIR::CopyFromNodeImpl(const IRNode* node,
   column_index_map_set_ = source_ir->column_index_map_set_;
   column_index_map_ = source_ir->column_index_map_;
   streaming_ = source_ir->streaming_;
+  sample_every_n_ = source_ir->sample_every_n_;
 
   return Status::OK();
 }
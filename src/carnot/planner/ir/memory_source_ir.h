@@ -61,6 +61,11 @@ class MemorySourceIR : public OperatorIR {
   bool streaming() const { return streaming_; }
   void set_streaming(bool streaming) { streaming_ = streaming; }
 
+  // When > 1, the MemorySource reads only every Nth row batch, producing an approximate
+  // sample of the table instead of a full scan.
+  int64_t sample_every_n() const { return sample_every_n_; }
+  void set_sample_every_n(int64_t sample_every_n) { sample_every_n_ = sample_every_n; }
+
   void SetTimeStartNS(int64_t time_start_ns) { time_start_ns_ = time_start_ns; }
   void SetTimeStopNS(int64_t time_stop_ns) { time_stop_ns_ = time_stop_ns; }
   bool IsTimeStartSet() const { return time_start_ns_.has_value(); }
@@ -113,6 +118,7 @@ class MemorySourceIR : public OperatorIR {
  private:
   std::string table_name_;
   bool streaming_ = false;
+  int64_t sample_every_n_ = 0;
 
   std::optional<int64_t> time_start_ns_;
   std::optional<int64_t> time_stop_ns_;
@@ -35,6 +35,7 @@ PX_CARNOT_IR_NODE(GroupBy)
 PX_CARNOT_IR_NODE(UDTFSource)
 PX_CARNOT_IR_NODE(Rolling)
 PX_CARNOT_IR_NODE(Stream)
+PX_CARNOT_IR_NODE(Sample)
 PX_CARNOT_IR_NODE(EmptySource)
 PX_CARNOT_IR_NODE(OTelExportSink)
 
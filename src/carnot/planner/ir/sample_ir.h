@@ -0,0 +1,83 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <queue>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "src/carnot/planner/compiler_state/compiler_state.h"
+#include "src/carnot/planner/ir/operator_ir.h"
+#include "src/carnot/planner/types/types.h"
+#include "src/common/base/base.h"
+#include "src/shared/types/types.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+
+// SampleIR is a logical node that marks that a DataFrame should be read as an approximate
+// sample: its ancestor MemorySources read only every Nth row batch instead of scanning the
+// whole table. It is resolved into the MemorySources and removed before execution.
+class SampleIR : public OperatorIR {
+ public:
+  SampleIR() = delete;
+  explicit SampleIR(int64_t id) : OperatorIR(id, IRNodeType::kSample) {}
+  Status Init(OperatorIR* parent, int64_t sample_every_n) {
+    PX_RETURN_IF_ERROR(AddParent(parent));
+    sample_every_n_ = sample_every_n;
+    return Status::OK();
+  }
+
+  int64_t sample_every_n() const { return sample_every_n_; }
+
+  Status ToProto(planpb::Operator*) const override {
+    return error::Unimplemented("SampleIR::ToProto should not be called");
+  }
+  Status CopyFromNodeImpl(const IRNode* node,
+                          absl::flat_hash_map<const IRNode*, IRNode*>*) override {
+    sample_every_n_ = static_cast<const SampleIR*>(node)->sample_every_n_;
+    return Status::OK();
+  }
+
+  StatusOr<std::vector<absl::flat_hash_set<std::string>>> RequiredInputColumns() const override {
+    return error::Unimplemented("SampleIR::RequiredInputColumns should not be called");
+  }
+  static constexpr bool FailOnResolveType() { return true; }
+
+ protected:
+  StatusOr<absl::flat_hash_set<std::string>> PruneOutputColumnsToImpl(
+      const absl::flat_hash_set<std::string>&) override {
+    return error::Unimplemented("SampleIR::PruneOutputColumnsToImpl should not be called");
+  }
+
+ private:
+  int64_t sample_every_n_ = 0;
+};
+
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -18,6 +18,7 @@
 
 #include "src/carnot/planner/logical_planner.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "src/carnot/planner/compiler_state/compiler_state.h"
@@ -65,8 +66,16 @@ static inline RedactionOptions RedactionOptionsFromPb(
 StatusOr<std::unique_ptr<CompilerState>> CreateCompilerState(
     const distributedpb::LogicalPlannerState& logical_state, RegistryInfo* registry_info,
     int64_t max_output_rows_per_table) {
+  return CreateCompilerState(logical_state, logical_state.distributed_state(), registry_info,
+                             max_output_rows_per_table);
+}
+
+StatusOr<std::unique_ptr<CompilerState>> CreateCompilerState(
+    const distributedpb::LogicalPlannerState& logical_state,
+    const distributedpb::DistributedState& distributed_state, RegistryInfo* registry_info,
+    int64_t max_output_rows_per_table) {
   PX_ASSIGN_OR_RETURN(std::unique_ptr<RelationMap> rel_map,
-                      MakeRelationMapFromDistributedState(logical_state.distributed_state()));
+                      MakeRelationMapFromDistributedState(distributed_state));
 
   SensitiveColumnMap sensitive_columns = {
       {"cql_events", {"req_body", "resp_body"}},
@@ -98,7 +107,7 @@ StatusOr<std::unique_ptr<CompilerState>> CreateCompilerState(
     debug_info.otel_debug_attrs.push_back({debug_info_pb.name(), debug_info_pb.value()});
   }
   // Create a CompilerState obj using the relation map and grabbing the current time.
-  return std::make_unique<planner::CompilerState>(
+  auto compiler_state = std::make_unique<planner::CompilerState>(
       std::move(rel_map), sensitive_columns, registry_info, px::CurrentTimeNS(),
       max_output_rows_per_table, logical_state.result_address(),
       logical_state.result_ssl_targetname(),
@@ -106,6 +115,18 @@ StatusOr<std::unique_ptr<CompilerState>> CreateCompilerState(
       RedactionOptionsFromPb(logical_state.redaction_options()), std::move(otel_endpoint_config),
       // TODO(philkuz) propagate the otel debug attributes here.
       std::move(plugin_config), debug_info);
+
+  // Forward any table size statistics the agents reported so that cost-based rules can use them.
+  planner::TableStatsMap table_stats_map;
+  for (const auto& schema_info : distributed_state.schema_info()) {
+    if (!schema_info.has_stats()) {
+      continue;
+    }
+    table_stats_map[schema_info.name()] =
+        planner::TableSizeStats{schema_info.stats().bytes(), schema_info.stats().num_rows()};
+  }
+  compiler_state->set_table_stats_map(std::move(table_stats_map));
+  return compiler_state;
 }
 
 StatusOr<std::unique_ptr<LogicalPlanner>> LogicalPlanner::Create(const udfspb::UDFInfo& udf_info) {
@@ -123,32 +144,106 @@ Status LogicalPlanner::Init(const udfspb::UDFInfo& udf_info) {
   return Status::OK();
 }
 
-StatusOr<std::unique_ptr<distributed::DistributedPlan>> LogicalPlanner::Plan(
-    const plannerpb::QueryRequest& query_request) {
-  // Compile into the IR.
-
-  auto ms = query_request.logical_planner_state().plan_options().max_output_rows_per_table();
-  VLOG(1) << "Max output rows: " << ms;
-  PX_ASSIGN_OR_RETURN(
-      std::unique_ptr<CompilerState> compiler_state,
-      CreateCompilerState(query_request.logical_planner_state(), registry_info_.get(), ms));
+StatusOr<std::shared_ptr<const distributedpb::DistributedState>>
+LogicalPlanner::ResolveDistributedState(const distributedpb::LogicalPlannerState& logical_state) {
+  uint64_t fingerprint = logical_state.distributed_state_fingerprint();
+  if (fingerprint == 0) {
+    // Fingerprinting is not in use; read the state inline from the request. The no-op deleter is
+    // safe because the request outlives planning.
+    return std::shared_ptr<const distributedpb::DistributedState>(
+        &logical_state.distributed_state(), [](const distributedpb::DistributedState*) {});
+  }
+  absl::MutexLock lock(&distributed_state_mu_);
+  if (logical_state.has_distributed_state()) {
+    auto& entry = distributed_state_cache_[fingerprint];
+    if (entry == nullptr) {
+      entry = std::make_shared<const distributedpb::DistributedState>(
+          logical_state.distributed_state());
+      distributed_state_lru_.push_back(fingerprint);
+      while (distributed_state_lru_.size() > kMaxCachedDistributedStates) {
+        distributed_state_cache_.erase(distributed_state_lru_.front());
+        distributed_state_lru_.pop_front();
+      }
+    }
+    return std::shared_ptr<const distributedpb::DistributedState>(entry);
+  }
+  auto it = distributed_state_cache_.find(fingerprint);
+  if (it == distributed_state_cache_.end()) {
+    return error::NotFound(
+        "Distributed state with fingerprint $0 is not cached; resend the request with the full "
+        "distributed state.",
+        fingerprint);
+  }
+  auto lru_it =
+      std::find(distributed_state_lru_.begin(), distributed_state_lru_.end(), fingerprint);
+  distributed_state_lru_.splice(distributed_state_lru_.end(), distributed_state_lru_, lru_it);
+  return std::shared_ptr<const distributedpb::DistributedState>(it->second);
+}
 
+StatusOr<std::unique_ptr<distributed::DistributedPlan>> LogicalPlanner::PlanWithState(
+    const plannerpb::QueryRequest& query_request,
+    const distributedpb::DistributedState& distributed_state, CompilerState* compiler_state) {
+  // Compile into the IR.
   std::vector<plannerpb::FuncToExecute> exec_funcs(query_request.exec_funcs().begin(),
                                                    query_request.exec_funcs().end());
   PX_ASSIGN_OR_RETURN(
       std::shared_ptr<IR> single_node_plan,
-      compiler_.CompileToIR(query_request.query_str(), compiler_state.get(), exec_funcs));
+      compiler_.CompileToIR(query_request.query_str(), compiler_state, exec_funcs));
   // Create the distributed plan.
-  PX_ASSIGN_OR_RETURN(
-      auto distributed_plan,
-      distributed_planner_->Plan(query_request.logical_planner_state().distributed_state(),
-                                 compiler_state.get(), single_node_plan.get()));
+  PX_ASSIGN_OR_RETURN(auto distributed_plan, distributed_planner_->Plan(distributed_state,
+                                                                        compiler_state,
+                                                                        single_node_plan.get()));
   distributed_plan->SetExecutionCompleteAddress(
       query_request.logical_planner_state().result_address(),
       query_request.logical_planner_state().result_ssl_targetname());
   return distributed_plan;
 }
 
+StatusOr<std::unique_ptr<distributed::DistributedPlan>> LogicalPlanner::Plan(
+    const plannerpb::QueryRequest& query_request) {
+  PX_ASSIGN_OR_RETURN(auto distributed_state,
+                      ResolveDistributedState(query_request.logical_planner_state()));
+  auto ms = query_request.logical_planner_state().plan_options().max_output_rows_per_table();
+  VLOG(1) << "Max output rows: " << ms;
+  PX_ASSIGN_OR_RETURN(std::unique_ptr<CompilerState> compiler_state,
+                      CreateCompilerState(query_request.logical_planner_state(),
+                                          *distributed_state, registry_info_.get(), ms));
+
+  return PlanWithState(query_request, *distributed_state, compiler_state.get());
+}
+
+StatusOr<distributedpb::DistributedPlan> LogicalPlanner::PlanCached(
+    const plannerpb::QueryRequest& query_request) {
+  auto cache_key = PlanCache::CacheKey(query_request);
+  auto cached_plan = plan_cache_.Lookup(cache_key);
+  if (cached_plan != nullptr) {
+    return *cached_plan;
+  }
+
+  PX_ASSIGN_OR_RETURN(auto distributed_state,
+                      ResolveDistributedState(query_request.logical_planner_state()));
+  auto ms = query_request.logical_planner_state().plan_options().max_output_rows_per_table();
+  VLOG(1) << "Max output rows: " << ms;
+  PX_ASSIGN_OR_RETURN(std::unique_ptr<CompilerState> compiler_state,
+                      CreateCompilerState(query_request.logical_planner_state(),
+                                          *distributed_state, registry_info_.get(), ms));
+
+  PX_ASSIGN_OR_RETURN(auto distributed_plan,
+                      PlanWithState(query_request, *distributed_state, compiler_state.get()));
+  // In the future, if we actually have plan options that will actually determine how the plan is
+  // constructed, we may want to pass the planOptions to planner.Plan. However, this
+  // will need to go through many more layers (such as the coordinator), so this is fine for now.
+  distributed_plan->SetPlanOptions(query_request.logical_planner_state().plan_options());
+  PX_ASSIGN_OR_RETURN(auto plan_pb, distributed_plan->ToProto());
+
+  // Plans that read the current time embed absolute timestamps resolved at compile time and would
+  // be wrong if replayed later, so only time-independent compilations are cached.
+  if (!compiler_state->time_now_accessed()) {
+    plan_cache_.Insert(cache_key, plan_pb);
+  }
+  return plan_pb;
+}
+
 StatusOr<std::unique_ptr<compiler::MutationsIR>> LogicalPlanner::CompileTrace(
     const plannerpb::CompileMutationsRequest& mutations_req) {
   // Compile into the IR.
@@ -17,14 +17,19 @@
  */
 
 #pragma once
+#include <list>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
+#include <absl/synchronization/mutex.h>
+
 #include "src/carnot/planner/compiler/compiler.h"
 #include "src/carnot/planner/compiler_state/compiler_state.h"
 #include "src/carnot/planner/distributed/distributed_plan/distributed_plan.h"
 #include "src/carnot/planner/distributed/distributed_planner.h"
+#include "src/carnot/planner/plan_cache.h"
 #include "src/carnot/planner/plannerpb/service.pb.h"
 #include "src/carnot/planner/probes/probes.h"
 #include "src/shared/scriptspb/scripts.pb.h"
@@ -57,12 +62,41 @@ class LogicalPlanner : public NotCopyable {
   StatusOr<std::unique_ptr<distributed::DistributedPlan>> Plan(
       const plannerpb::QueryRequest& query);
 
+  /**
+   * @brief Plans the query like Plan(), but serves and populates the plan cache. The returned
+   * proto already has the request's plan options applied.
+   *
+   * Only compilations that never read the current time are cached — time-dependent queries
+   * (px.now(), relative start_times) resolve to absolute timestamps at compile time and must be
+   * recompiled every execution. The cache key is the full serialized request, so schema and agent
+   * topology changes invalidate entries automatically.
+   *
+   * @param query: QueryRequest
+   * @return the serialized distributed plan or error if one occurs during compilation.
+   */
+  StatusOr<distributedpb::DistributedPlan> PlanCached(const plannerpb::QueryRequest& query);
+
   StatusOr<std::unique_ptr<compiler::MutationsIR>> CompileTrace(
       const plannerpb::CompileMutationsRequest& mutations_req);
 
   StatusOr<std::unique_ptr<plannerpb::GenerateOTelScriptResponse>> GenerateOTelScript(
       const plannerpb::GenerateOTelScriptRequest& generate_req);
 
+  /**
+   * @brief Resolves the distributed state for a request, serving and populating the planner's
+   * distributed state cache.
+   *
+   * The distributed state dominates the size of a query request but changes rarely, so clients
+   * may send it once together with a content fingerprint and afterwards send only the
+   * fingerprint (see LogicalPlannerState.distributed_state_fingerprint). Requests without a
+   * fingerprint resolve to their inline state. A fingerprint-only request that misses the cache
+   * fails with NOT_FOUND; the client is expected to resend the full state.
+   */
+  StatusOr<std::shared_ptr<const distributedpb::DistributedState>> ResolveDistributedState(
+      const distributedpb::LogicalPlannerState& logical_state);
+
+  static constexpr size_t kMaxCachedDistributedStates = 8;
+
   Status Init(std::unique_ptr<planner::RegistryInfo> registry_info);
   Status Init(const udfspb::UDFInfo& udf_info);
 
@@ -70,15 +104,32 @@ class LogicalPlanner : public NotCopyable {
   LogicalPlanner() {}
 
  private:
+  StatusOr<std::unique_ptr<distributed::DistributedPlan>> PlanWithState(
+      const plannerpb::QueryRequest& query,
+      const distributedpb::DistributedState& distributed_state, CompilerState* compiler_state);
+
   compiler::Compiler compiler_;
   std::unique_ptr<distributed::Planner> distributed_planner_;
   std::unique_ptr<planner::RegistryInfo> registry_info_;
+  PlanCache plan_cache_;
+
+  absl::Mutex distributed_state_mu_;
+  // Cached distributed states keyed by client-provided content fingerprint. Most recently used
+  // fingerprints are at the back of the LRU list.
+  absl::flat_hash_map<uint64_t, std::shared_ptr<const distributedpb::DistributedState>>
+      distributed_state_cache_ ABSL_GUARDED_BY(distributed_state_mu_);
+  std::list<uint64_t> distributed_state_lru_ ABSL_GUARDED_BY(distributed_state_mu_);
 };
 
 StatusOr<std::unique_ptr<CompilerState>> CreateCompilerState(
     const distributedpb::LogicalPlannerState& logical_state, RegistryInfo* registry_info,
     int64_t max_output_rows_per_table);
 
+StatusOr<std::unique_ptr<CompilerState>> CreateCompilerState(
+    const distributedpb::LogicalPlannerState& logical_state,
+    const distributedpb::DistributedState& distributed_state, RegistryInfo* registry_info,
+    int64_t max_output_rows_per_table);
+
 }  // namespace planner
 }  // namespace carnot
 }  // namespace px
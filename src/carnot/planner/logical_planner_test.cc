@@ -132,6 +132,30 @@ TEST_F(LogicalPlannerTest, max_output_rows) {
   EXPECT_OK(plan->ToProto());
 }
 
+TEST_F(LogicalPlannerTest, plan_cached_serves_repeat_queries) {
+  auto planner = LogicalPlanner::Create(info_).ConsumeValueOrDie();
+  auto request = MakeQueryRequest(testutils::CreateOnePEMOneKelvinPlannerState(),
+                                  "import px\npx.display(px.DataFrame('table1'), 'out')");
+
+  // This query never reads the current time, so the second compilation is served from the cache
+  // and must be byte-identical to the first.
+  ASSERT_OK_AND_ASSIGN(auto first_plan, planner->PlanCached(request));
+  ASSERT_OK_AND_ASSIGN(auto second_plan, planner->PlanCached(request));
+  EXPECT_THAT(second_plan, EqualsProto(first_plan.DebugString()));
+}
+
+TEST_F(LogicalPlannerTest, plan_cached_time_dependent_query) {
+  auto planner = LogicalPlanner::Create(info_).ConsumeValueOrDie();
+  auto state = testutils::CreateTwoPEMsOneKelvinPlannerState(testutils::kHttpEventsSchema);
+  auto request = MakeQueryRequest(state, kSimpleQueryDefaultLimit);
+
+  // Relative start_times resolve to absolute timestamps at compile time, so these plans skip the
+  // cache. Both compilations must still succeed.
+  ASSERT_OK_AND_ASSIGN(auto first_plan, planner->PlanCached(request));
+  EXPECT_GT(first_plan.qb_address_to_plan_size(), 0);
+  EXPECT_OK(planner->PlanCached(request));
+}
+
 constexpr char kCompileTimeQuery[] = R"pxl(
 import px
 
@@ -862,6 +886,50 @@ px.export(otel_df, px.otel.Data(
 )))otel");
 }
 
+constexpr char kSimpleFingerprintQuery[] =
+    "import px\npx.display(px.DataFrame('table1'), 'out')";
+
+TEST_F(LogicalPlannerTest, distributed_state_fingerprint_roundtrip) {
+  auto planner = LogicalPlanner::Create(info_).ConsumeValueOrDie();
+  auto state = testutils::CreateOnePEMOneKelvinPlannerState();
+  state.set_distributed_state_fingerprint(1234);
+  // The first request carries the full distributed state, which the planner caches under the
+  // fingerprint.
+  ASSERT_OK(planner->Plan(MakeQueryRequest(state, kSimpleFingerprintQuery)));
+
+  // Later requests may omit the distributed state and carry only the fingerprint.
+  distributedpb::LogicalPlannerState stripped = state;
+  stripped.clear_distributed_state();
+  ASSERT_OK_AND_ASSIGN(auto plan,
+                       planner->Plan(MakeQueryRequest(stripped, kSimpleFingerprintQuery)));
+  EXPECT_GT(plan->ToProto().ConsumeValueOrDie().qb_address_to_plan_size(), 0);
+
+  // An unknown fingerprint without an inline state cannot be resolved.
+  stripped.set_distributed_state_fingerprint(5678);
+  auto res = planner->Plan(MakeQueryRequest(stripped, kSimpleFingerprintQuery));
+  ASSERT_NOT_OK(res);
+  EXPECT_EQ(statuspb::NOT_FOUND, res.status().code());
+}
+
+TEST_F(LogicalPlannerTest, distributed_state_cache_evicts_least_recently_used) {
+  auto planner = LogicalPlanner::Create(info_).ConsumeValueOrDie();
+  auto state = testutils::CreateOnePEMOneKelvinPlannerState();
+  for (uint64_t fp = 1; fp <= LogicalPlanner::kMaxCachedDistributedStates + 1; ++fp) {
+    state.set_distributed_state_fingerprint(fp);
+    ASSERT_OK(planner->ResolveDistributedState(state));
+  }
+
+  distributedpb::LogicalPlannerState stripped = state;
+  stripped.clear_distributed_state();
+  // Fingerprint 1 was the least recently used entry and got evicted; the rest are resolvable.
+  stripped.set_distributed_state_fingerprint(1);
+  EXPECT_NOT_OK(planner->ResolveDistributedState(stripped));
+  stripped.set_distributed_state_fingerprint(2);
+  EXPECT_OK(planner->ResolveDistributedState(stripped));
+  stripped.set_distributed_state_fingerprint(LogicalPlanner::kMaxCachedDistributedStates + 1);
+  EXPECT_OK(planner->ResolveDistributedState(stripped));
+}
+
 }  // namespace planner
 }  // namespace carnot
 }  // namespace px
@@ -17,6 +17,9 @@
  */
 
 #include "src/carnot/planner/objects/dataframe.h"
+
+#include <cmath>
+
 #include "src/carnot/planner/ast/ast_visitor.h"
 #include "src/carnot/planner/ir/ast_utils.h"
 #include "src/carnot/planner/objects/collection_object.h"
@@ -419,6 +422,25 @@ StatusOr<QLObjectPtr> StreamHandler(CompilerState* compiler_state, IR* graph, Op
   return Dataframe::Create(compiler_state, stream_op, visitor);
 }
 
+/**
+ * @brief Implements the sample() method and creates the sample node.
+ *
+ */
+StatusOr<QLObjectPtr> SampleHandler(CompilerState* compiler_state, IR* graph, OperatorIR* op,
+                                    const pypa::AstPtr& ast, const ParsedArgs& args,
+                                    ASTVisitor* visitor) {
+  PX_ASSIGN_OR_RETURN(FloatIR * frac_node, GetArgAs<FloatIR>(ast, args, "frac"));
+  double frac = frac_node->val();
+  if (frac <= 0 || frac > 1) {
+    return frac_node->CreateIRNodeError("Sample fraction must be in (0, 1], got $0", frac);
+  }
+  // The execution engine samples at batch granularity, reading every Nth batch.
+  int64_t sample_every_n = static_cast<int64_t>(std::round(1.0 / frac));
+  PX_ASSIGN_OR_RETURN(SampleIR * sample_op,
+                      graph->CreateNode<SampleIR>(ast, op, sample_every_n));
+  return Dataframe::Create(compiler_state, sample_op, visitor);
+}
+
 Status Dataframe::Init() {
   PX_ASSIGN_OR_RETURN(
       std::shared_ptr<FuncObject> constructor_fn,
@@ -602,6 +624,22 @@ Status Dataframe::Init() {
   PX_RETURN_IF_ERROR(stream_fn->SetDocString(kStreamOpDocstring));
   AddMethod(kStreamOpId, stream_fn);
 
+  /**
+   * # Equivalent to the python method syntax:
+   * def sample(self, frac):
+   *     ...
+   */
+  PX_ASSIGN_OR_RETURN(std::shared_ptr<FuncObject> sample_fn,
+                      FuncObject::Create(kSampleOpId, {"frac"}, {},
+                                         /* has_variable_len_args */ false,
+                                         /* has_variable_len_kwargs */ false,
+                                         std::bind(&SampleHandler, compiler_state_, graph(), op(),
+                                                   std::placeholders::_1, std::placeholders::_2,
+                                                   std::placeholders::_3),
+                                         ast_visitor()));
+  PX_RETURN_IF_ERROR(sample_fn->SetDocString(kSampleOpDocstring));
+  AddMethod(kSampleOpId, sample_fn);
+
   PX_ASSIGN_OR_RETURN(auto md, MetadataObject::Create(op(), ast_visitor()));
   return AssignAttribute(kMetadataAttrName, md);
 }
@@ -418,6 +418,27 @@ class Dataframe : public QLObject {
     px.DataFrame: the parent DataFrame in streaming mode.
   )doc";
 
+  inline static constexpr char kSampleOpId[] = "sample";
+  inline static constexpr char kSampleOpDocstring[] = R"doc(
+  Read an approximate sample of this DataFrame.
+
+  Returns the input DataFrame in sampling mode: its sources read roughly the given fraction of
+  the table's row batches and skip the rest, so exploratory queries over large tables touch only
+  a fraction of the data. The result is approximate and sampled at batch granularity.
+
+  Examples:
+    df = px.DataFrame('http_events').sample(0.01)
+
+  :topic: dataframe_ops
+  :opname: Sample
+
+  Args:
+    frac (float): the fraction of the data to read, in (0, 1].
+
+  Returns:
+    px.DataFrame: the parent DataFrame in sampling mode.
+  )doc";
+
   // Attribute names.
   inline static constexpr char kMetadataAttrName[] = "ctx";
 
@@ -408,11 +408,13 @@ StatusOr<QLObjectPtr> FormatDuration(IR* graph, const pypa::AstPtr& ast, const P
   return ExprObject::Create(node, visitor);
 }
 
-StatusOr<QLObjectPtr> ParseTime(int64_t time_now, IR* graph, const pypa::AstPtr& ast,
+StatusOr<QLObjectPtr> ParseTime(CompilerState* compiler_state, IR* graph, const pypa::AstPtr& ast,
                                 const ParsedArgs& args, ASTVisitor* visitor) {
   PX_ASSIGN_OR_RETURN(ExpressionIR * time_ir, GetArgAs<ExpressionIR>(ast, args, "time"));
 
-  auto int_or_s = ParseAllTimeFormats(time_now, time_ir);
+  // Read time_now lazily, when the function is actually called, so that compilations that never
+  // parse a time aren't marked as time-dependent.
+  auto int_or_s = ParseAllTimeFormats(compiler_state->time_now().val, time_ir);
   if (!int_or_s.ok()) {
     return WrapAstError(time_ir->ast(), int_or_s.status());
   }
@@ -527,7 +529,7 @@ Status PixieModule::RegisterCompileTimeFuncs() {
       FuncObject::Create(
           kParseTimeOpID, {"time"}, {},
           /* has_variable_len_args */ false, /* has_variable_len_kwargs */ false,
-          std::bind(&ParseTime, compiler_state_->time_now().val, graph_, std::placeholders::_1,
+          std::bind(&ParseTime, compiler_state_, graph_, std::placeholders::_1,
                     std::placeholders::_2, std::placeholders::_3),
           ast_visitor()));
 
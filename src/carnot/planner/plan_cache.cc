@@ -0,0 +1,69 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/planner/plan_cache.h"
+
+#include <utility>
+
+namespace px {
+namespace carnot {
+namespace planner {
+
+std::string PlanCache::CacheKey(const plannerpb::QueryRequest& query_request) {
+  // The full serialized request is used as the key rather than a hash of it, so a collision can
+  // never serve the wrong plan. Keys are only retained for cached entries, so the extra memory is
+  // bounded by the cache capacity.
+  std::string key = query_request.query_str();
+  for (const auto& exec_func : query_request.exec_funcs()) {
+    key += '\0';
+    key += exec_func.SerializeAsString();
+  }
+  key += '\0';
+  key += query_request.logical_planner_state().SerializeAsString();
+  return key;
+}
+
+std::unique_ptr<distributedpb::DistributedPlan> PlanCache::Lookup(const std::string& key) {
+  absl::MutexLock lock(&mu_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    return nullptr;
+  }
+  lru_.splice(lru_.begin(), lru_, it->second);
+  return std::make_unique<distributedpb::DistributedPlan>(it->second->second);
+}
+
+void PlanCache::Insert(const std::string& key, const distributedpb::DistributedPlan& plan) {
+  absl::MutexLock lock(&mu_);
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    lru_.splice(lru_.begin(), lru_, it->second);
+    it->second->second = plan;
+    return;
+  }
+  if (entries_.size() >= capacity_) {
+    entries_.erase(lru_.back().first);
+    lru_.pop_back();
+  }
+  lru_.emplace_front(key, plan);
+  entries_[key] = lru_.begin();
+}
+
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/synchronization/mutex.h>
+
+#include "src/carnot/planner/distributedpb/distributed_plan.pb.h"
+#include "src/carnot/planner/plannerpb/service.pb.h"
+#include "src/common/base/base.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+
+/**
+ * @brief PlanCache is an LRU cache of compiled distributed plans, keyed by the full serialized
+ * query request.
+ *
+ * The key deliberately includes the entire LogicalPlannerState (relation map, agent topology, plan
+ * options) in addition to the query string and exec funcs, so a schema or topology change simply
+ * misses the cache rather than serving a stale plan. Only compilations that never read the current
+ * time may be cached; time-dependent plans bake absolute timestamps in at compile time, and the
+ * caller is responsible for checking CompilerState::time_now_accessed() before inserting.
+ *
+ * Thread-safe: Lookup/Insert may be called concurrently.
+ */
+class PlanCache : public NotCopyable {
+ public:
+  static constexpr size_t kDefaultCapacity = 128;
+
+  explicit PlanCache(size_t capacity = kDefaultCapacity) : capacity_(capacity) {}
+
+  /**
+   * @brief Builds the cache key for a query request.
+   */
+  static std::string CacheKey(const plannerpb::QueryRequest& query_request);
+
+  /**
+   * @brief Returns a copy of the cached plan for the key, or nullptr on a miss. A hit moves the
+   * entry to the front of the LRU list.
+   */
+  std::unique_ptr<distributedpb::DistributedPlan> Lookup(const std::string& key);
+
+  /**
+   * @brief Inserts a plan for the key, evicting the least recently used entry if at capacity.
+   */
+  void Insert(const std::string& key, const distributedpb::DistributedPlan& plan);
+
+  size_t size() const {
+    absl::MutexLock lock(&mu_);
+    return entries_.size();
+  }
+
+ private:
+  using LRUList = std::list<std::pair<std::string, distributedpb::DistributedPlan>>;
+
+  const size_t capacity_;
+  mutable absl::Mutex mu_;
+  // Most recently used entries at the front.
+  LRUList lru_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<std::string, LRUList::iterator> entries_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
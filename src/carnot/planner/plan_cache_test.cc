@@ -0,0 +1,100 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "src/carnot/planner/plan_cache.h"
+#include "src/carnot/planner/test_utils.h"
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+
+plannerpb::QueryRequest MakeRequest(const std::string& query) {
+  plannerpb::QueryRequest request;
+  request.set_query_str(query);
+  *request.mutable_logical_planner_state() = testutils::CreateOnePEMOneKelvinPlannerState();
+  return request;
+}
+
+distributedpb::DistributedPlan MakePlan(const std::string& qb_address) {
+  distributedpb::DistributedPlan plan;
+  (*plan.mutable_qb_address_to_plan())[qb_address] = planpb::Plan();
+  return plan;
+}
+
+TEST(PlanCacheTest, key_changes_with_request) {
+  auto base_key = PlanCache::CacheKey(MakeRequest("import px\npx.display(px.DataFrame('t1'))"));
+
+  // Same request produces the same key.
+  EXPECT_EQ(base_key, PlanCache::CacheKey(MakeRequest("import px\npx.display(px.DataFrame('t1'))")));
+
+  // A different query string produces a different key.
+  EXPECT_NE(base_key, PlanCache::CacheKey(MakeRequest("import px\npx.display(px.DataFrame('t2'))")));
+
+  // A different planner state (schema/topology) produces a different key.
+  auto diff_state_request = MakeRequest("import px\npx.display(px.DataFrame('t1'))");
+  *diff_state_request.mutable_logical_planner_state() =
+      testutils::CreateTwoPEMsOneKelvinPlannerState(testutils::kHttpEventsSchema);
+  EXPECT_NE(base_key, PlanCache::CacheKey(diff_state_request));
+
+  // Different exec funcs produce a different key.
+  auto exec_func_request = MakeRequest("import px\npx.display(px.DataFrame('t1'))");
+  exec_func_request.add_exec_funcs()->set_func_name("f");
+  EXPECT_NE(base_key, PlanCache::CacheKey(exec_func_request));
+}
+
+TEST(PlanCacheTest, lookup_and_insert) {
+  PlanCache cache;
+  EXPECT_EQ(nullptr, cache.Lookup("a"));
+
+  cache.Insert("a", MakePlan("pem"));
+  auto cached = cache.Lookup("a");
+  ASSERT_NE(nullptr, cached);
+  EXPECT_TRUE(cached->qb_address_to_plan().contains("pem"));
+  EXPECT_EQ(nullptr, cache.Lookup("b"));
+
+  // Inserting an existing key replaces the plan.
+  cache.Insert("a", MakePlan("kelvin"));
+  EXPECT_EQ(1, cache.size());
+  cached = cache.Lookup("a");
+  ASSERT_NE(nullptr, cached);
+  EXPECT_TRUE(cached->qb_address_to_plan().contains("kelvin"));
+}
+
+TEST(PlanCacheTest, evicts_least_recently_used) {
+  PlanCache cache(/* capacity */ 2);
+  cache.Insert("a", MakePlan("pem"));
+  cache.Insert("b", MakePlan("pem"));
+
+  // Touch "a" so "b" becomes the eviction candidate.
+  EXPECT_NE(nullptr, cache.Lookup("a"));
+  cache.Insert("c", MakePlan("pem"));
+
+  EXPECT_EQ(2, cache.size());
+  EXPECT_NE(nullptr, cache.Lookup("a"));
+  EXPECT_EQ(nullptr, cache.Lookup("b"));
+  EXPECT_NE(nullptr, cache.Lookup("c"));
+}
+
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
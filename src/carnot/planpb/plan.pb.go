@@ -113,9 +113,11 @@ func (JoinOperator_JoinType) EnumDescriptor() ([]byte, []int) {
 }
 
 type PlanOptions struct {
-	Explain               bool  `protobuf:"varint,2,opt,name=explain,proto3" json:"explain,omitempty"`
-	Analyze               bool  `protobuf:"varint,3,opt,name=analyze,proto3" json:"analyze,omitempty"`
-	MaxOutputRowsPerTable int64 `protobuf:"varint,4,opt,name=max_output_rows_per_table,json=maxOutputRowsPerTable,proto3" json:"max_output_rows_per_table,omitempty"`
+	Explain               bool   `protobuf:"varint,2,opt,name=explain,proto3" json:"explain,omitempty"`
+	Analyze               bool   `protobuf:"varint,3,opt,name=analyze,proto3" json:"analyze,omitempty"`
+	MaxOutputRowsPerTable int64  `protobuf:"varint,4,opt,name=max_output_rows_per_table,json=maxOutputRowsPerTable,proto3" json:"max_output_rows_per_table,omitempty"`
+	StandingQueryKey      string `protobuf:"bytes,5,opt,name=standing_query_key,json=standingQueryKey,proto3" json:"standing_query_key,omitempty"`
+	Priority              int64  `protobuf:"varint,6,opt,name=priority,proto3" json:"priority,omitempty"`
 }
 
 func (m *PlanOptions) Reset()      { *m = PlanOptions{} }
@@ -171,6 +173,20 @@ func (m *PlanOptions) GetMaxOutputRowsPerTable() int64 {
 	return 0
 }
 
+func (m *PlanOptions) GetStandingQueryKey() string {
+	if m != nil {
+		return m.StandingQueryKey
+	}
+	return ""
+}
+
+func (m *PlanOptions) GetPriority() int64 {
+	if m != nil {
+		return m.Priority
+	}
+	return 0
+}
+
 type Plan struct {
 	Dag                         *DAG                               `protobuf:"bytes,1,opt,name=dag,proto3" json:"dag,omitempty"`
 	Nodes                       []*PlanFragment                    `protobuf:"bytes,2,rep,name=nodes,proto3" json:"nodes,omitempty"`
@@ -747,14 +763,15 @@ func (*Operator) XXX_OneofWrappers() []interface{} {
 }
 
 type MemorySourceOperator struct {
-	Name        string             `protobuf:"bytes,1,opt,name=name,proto3" json:"name,omitempty"`
-	ColumnIdxs  []int64            `protobuf:"varint,2,rep,packed,name=column_idxs,json=columnIdxs,proto3" json:"column_idxs,omitempty"`
-	ColumnNames []string           `protobuf:"bytes,3,rep,name=column_names,json=columnNames,proto3" json:"column_names,omitempty"`
-	ColumnTypes []typespb.DataType `protobuf:"varint,4,rep,packed,name=column_types,json=columnTypes,proto3,enum=px.types.DataType" json:"column_types,omitempty"`
-	StartTime   *types.Int64Value  `protobuf:"bytes,5,opt,name=start_time,json=startTime,proto3" json:"start_time,omitempty"`
-	StopTime    *types.Int64Value  `protobuf:"bytes,6,opt,name=stop_time,json=stopTime,proto3" json:"stop_time,omitempty"`
-	Tablet      string             `protobuf:"bytes,7,opt,name=tablet,proto3" json:"tablet,omitempty"`
-	Streaming   bool               `protobuf:"varint,8,opt,name=streaming,proto3" json:"streaming,omitempty"`
+	Name         string             `protobuf:"bytes,1,opt,name=name,proto3" json:"name,omitempty"`
+	ColumnIdxs   []int64            `protobuf:"varint,2,rep,packed,name=column_idxs,json=columnIdxs,proto3" json:"column_idxs,omitempty"`
+	ColumnNames  []string           `protobuf:"bytes,3,rep,name=column_names,json=columnNames,proto3" json:"column_names,omitempty"`
+	ColumnTypes  []typespb.DataType `protobuf:"varint,4,rep,packed,name=column_types,json=columnTypes,proto3,enum=px.types.DataType" json:"column_types,omitempty"`
+	StartTime    *types.Int64Value  `protobuf:"bytes,5,opt,name=start_time,json=startTime,proto3" json:"start_time,omitempty"`
+	StopTime     *types.Int64Value  `protobuf:"bytes,6,opt,name=stop_time,json=stopTime,proto3" json:"stop_time,omitempty"`
+	Tablet       string             `protobuf:"bytes,7,opt,name=tablet,proto3" json:"tablet,omitempty"`
+	Streaming    bool               `protobuf:"varint,8,opt,name=streaming,proto3" json:"streaming,omitempty"`
+	SampleEveryN int64              `protobuf:"varint,9,opt,name=sample_every_n,json=sampleEveryN,proto3" json:"sample_every_n,omitempty"`
 }
 
 func (m *MemorySourceOperator) Reset()      { *m = MemorySourceOperator{} }
@@ -845,6 +862,13 @@ func (m *MemorySourceOperator) GetStreaming() bool {
 	return false
 }
 
+func (m *MemorySourceOperator) GetSampleEveryN() int64 {
+	if m != nil {
+		return m.SampleEveryN
+	}
+	return 0
+}
+
 type MemorySinkOperator struct {
 	Name                string                 `protobuf:"bytes,1,opt,name=name,proto3" json:"name,omitempty"`
 	ColumnTypes         []typespb.DataType     `protobuf:"varint,2,rep,packed,name=column_types,json=columnTypes,proto3,enum=px.types.DataType" json:"column_types,omitempty"`
@@ -971,6 +995,7 @@ type GRPCSinkOperator struct {
 	//	*GRPCSinkOperator_OutputTable
 	Destination       isGRPCSinkOperator_Destination          `protobuf_oneof:"destination"`
 	ConnectionOptions *GRPCSinkOperator_GRPCConnectionOptions `protobuf:"bytes,5,opt,name=connection_options,json=connectionOptions,proto3" json:"connection_options,omitempty"`
+	HashShuffle       *GRPCSinkOperator_HashShuffleSpec       `protobuf:"bytes,6,opt,name=hash_shuffle,json=hashShuffle,proto3" json:"hash_shuffle,omitempty"`
 }
 
 func (m *GRPCSinkOperator) Reset()      { *m = GRPCSinkOperator{} }
@@ -1057,6 +1082,13 @@ func (m *GRPCSinkOperator) GetConnectionOptions() *GRPCSinkOperator_GRPCConnecti
 	return nil
 }
 
+func (m *GRPCSinkOperator) GetHashShuffle() *GRPCSinkOperator_HashShuffleSpec {
+	if m != nil {
+		return m.HashShuffle
+	}
+	return nil
+}
+
 // XXX_OneofWrappers is for the internal use of the proto package.
 func (*GRPCSinkOperator) XXX_OneofWrappers() []interface{} {
 	return []interface{}{
@@ -1177,6 +1209,118 @@ func (m *GRPCSinkOperator_GRPCConnectionOptions) GetSslTargetname() string {
 	return ""
 }
 
+type GRPCSinkOperator_HashShuffleSpec struct {
+	KeyColumnIdxs []int64                                         `protobuf:"varint,1,rep,packed,name=key_column_idxs,json=keyColumnIdxs,proto3" json:"key_column_idxs,omitempty"`
+	Destinations  []*GRPCSinkOperator_HashShuffleSpec_Destination `protobuf:"bytes,2,rep,name=destinations,proto3" json:"destinations,omitempty"`
+}
+
+func (m *GRPCSinkOperator_HashShuffleSpec) Reset()      { *m = GRPCSinkOperator_HashShuffleSpec{} }
+func (*GRPCSinkOperator_HashShuffleSpec) ProtoMessage() {}
+func (*GRPCSinkOperator_HashShuffleSpec) Descriptor() ([]byte, []int) {
+	return fileDescriptor_e5dcfc8666ec3f33, []int{9, 2}
+}
+func (m *GRPCSinkOperator_HashShuffleSpec) XXX_Unmarshal(b []byte) error {
+	return m.Unmarshal(b)
+}
+func (m *GRPCSinkOperator_HashShuffleSpec) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	if deterministic {
+		return xxx_messageInfo_GRPCSinkOperator_HashShuffleSpec.Marshal(b, m, deterministic)
+	} else {
+		b = b[:cap(b)]
+		n, err := m.MarshalToSizedBuffer(b)
+		if err != nil {
+			return nil, err
+		}
+		return b[:n], nil
+	}
+}
+func (m *GRPCSinkOperator_HashShuffleSpec) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_GRPCSinkOperator_HashShuffleSpec.Merge(m, src)
+}
+func (m *GRPCSinkOperator_HashShuffleSpec) XXX_Size() int {
+	return m.Size()
+}
+func (m *GRPCSinkOperator_HashShuffleSpec) XXX_DiscardUnknown() {
+	xxx_messageInfo_GRPCSinkOperator_HashShuffleSpec.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_GRPCSinkOperator_HashShuffleSpec proto.InternalMessageInfo
+
+func (m *GRPCSinkOperator_HashShuffleSpec) GetKeyColumnIdxs() []int64 {
+	if m != nil {
+		return m.KeyColumnIdxs
+	}
+	return nil
+}
+
+func (m *GRPCSinkOperator_HashShuffleSpec) GetDestinations() []*GRPCSinkOperator_HashShuffleSpec_Destination {
+	if m != nil {
+		return m.Destinations
+	}
+	return nil
+}
+
+type GRPCSinkOperator_HashShuffleSpec_Destination struct {
+	Address       string `protobuf:"bytes,1,opt,name=address,proto3" json:"address,omitempty"`
+	GRPCSourceID  uint64 `protobuf:"varint,2,opt,name=grpc_source_id,json=grpcSourceId,proto3" json:"grpc_source_id,omitempty"`
+	SslTargetname string `protobuf:"bytes,3,opt,name=ssl_targetname,json=sslTargetname,proto3" json:"ssl_targetname,omitempty"`
+}
+
+func (m *GRPCSinkOperator_HashShuffleSpec_Destination) Reset() {
+	*m = GRPCSinkOperator_HashShuffleSpec_Destination{}
+}
+func (*GRPCSinkOperator_HashShuffleSpec_Destination) ProtoMessage() {}
+func (*GRPCSinkOperator_HashShuffleSpec_Destination) Descriptor() ([]byte, []int) {
+	return fileDescriptor_e5dcfc8666ec3f33, []int{9, 2, 0}
+}
+func (m *GRPCSinkOperator_HashShuffleSpec_Destination) XXX_Unmarshal(b []byte) error {
+	return m.Unmarshal(b)
+}
+func (m *GRPCSinkOperator_HashShuffleSpec_Destination) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	if deterministic {
+		return xxx_messageInfo_GRPCSinkOperator_HashShuffleSpec_Destination.Marshal(b, m, deterministic)
+	} else {
+		b = b[:cap(b)]
+		n, err := m.MarshalToSizedBuffer(b)
+		if err != nil {
+			return nil, err
+		}
+		return b[:n], nil
+	}
+}
+func (m *GRPCSinkOperator_HashShuffleSpec_Destination) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_GRPCSinkOperator_HashShuffleSpec_Destination.Merge(m, src)
+}
+func (m *GRPCSinkOperator_HashShuffleSpec_Destination) XXX_Size() int {
+	return m.Size()
+}
+func (m *GRPCSinkOperator_HashShuffleSpec_Destination) XXX_DiscardUnknown() {
+	xxx_messageInfo_GRPCSinkOperator_HashShuffleSpec_Destination.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_GRPCSinkOperator_HashShuffleSpec_Destination proto.InternalMessageInfo
+
+func (m *GRPCSinkOperator_HashShuffleSpec_Destination) GetAddress() string {
+	if m != nil {
+		return m.Address
+	}
+	return ""
+}
+
+func (m *GRPCSinkOperator_HashShuffleSpec_Destination) GetGRPCSourceID() uint64 {
+	if m != nil {
+		return m.GRPCSourceID
+	}
+	return 0
+}
+
+func (m *GRPCSinkOperator_HashShuffleSpec_Destination) GetSslTargetname() string {
+	if m != nil {
+		return m.SslTargetname
+	}
+	return ""
+}
+
 type MapOperator struct {
 	Expressions []*ScalarExpression `protobuf:"bytes,1,rep,name=expressions,proto3" json:"expressions,omitempty"`
 	ColumnNames []string            `protobuf:"bytes,2,rep,name=column_names,json=columnNames,proto3" json:"column_names,omitempty"`
@@ -3153,6 +3297,8 @@ func init() {
 	proto.RegisterType((*GRPCSinkOperator)(nil), "px.carnot.planpb.GRPCSinkOperator")
 	proto.RegisterType((*GRPCSinkOperator_ResultTable)(nil), "px.carnot.planpb.GRPCSinkOperator.ResultTable")
 	proto.RegisterType((*GRPCSinkOperator_GRPCConnectionOptions)(nil), "px.carnot.planpb.GRPCSinkOperator.GRPCConnectionOptions")
+	proto.RegisterType((*GRPCSinkOperator_HashShuffleSpec)(nil), "px.carnot.planpb.GRPCSinkOperator.HashShuffleSpec")
+	proto.RegisterType((*GRPCSinkOperator_HashShuffleSpec_Destination)(nil), "px.carnot.planpb.GRPCSinkOperator.HashShuffleSpec.Destination")
 	proto.RegisterType((*MapOperator)(nil), "px.carnot.planpb.MapOperator")
 	proto.RegisterType((*AggregateOperator)(nil), "px.carnot.planpb.AggregateOperator")
 	proto.RegisterType((*FilterOperator)(nil), "px.carnot.planpb.FilterOperator")
@@ -3186,208 +3332,211 @@ func init() {
 func init() { proto.RegisterFile("src/carnot/planpb/plan.proto", fileDescriptor_e5dcfc8666ec3f33) }
 
 var fileDescriptor_e5dcfc8666ec3f33 = []byte{
-	// 3202 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xd4, 0x59, 0xcf, 0x6f, 0x1b, 0xc7,
-	0xf5, 0xe7, 0x92, 0x14, 0x45, 0x3e, 0xfe, 0x10, 0x35, 0xb6, 0x1c, 0x99, 0xb6, 0x29, 0x87, 0xb1,
-	0xbf, 0x51, 0xfc, 0x4d, 0x68, 0x5b, 0x76, 0x5c, 0xc7, 0x71, 0x9a, 0x50, 0x12, 0x25, 0x51, 0x91,
-	0x44, 0x75, 0x44, 0x25, 0x4d, 0x1b, 0x74, 0x31, 0xe2, 0x8e, 0xd6, 0x1b, 0x93, 0xbb, 0x9b, 0xfd,
-	0x11, 0x4b, 0x01, 0x8a, 0xa6, 0xe8, 0xa5, 0x87, 0x14, 0xe8, 0xa1, 0x87, 0xa2, 0xf7, 0x16, 0x39,
-	0x15, 0x39, 0xf4, 0x0f, 0x68, 0x81, 0x02, 0xe9, 0xa1, 0x08, 0xdc, 0x9e, 0x72, 0x32, 0x62, 0xe5,
-	0xe2, 0x43, 0x51, 0xa4, 0xf7, 0x1e, 0x8a, 0xf9, 0xb1, 0xe4, 0x92, 0x5c, 0x5a, 0x4a, 0x0e, 0x05,
-	0x7a, 0xb0, 0xc5, 0x79, 0xf3, 0x79, 0x6f, 0xde, 0xaf, 0x79, 0xf3, 0x66, 0x16, 0xce, 0xbb, 0x4e,
-	0xfb, 0x6a, 0x9b, 0x38, 0xa6, 0xe5, 0x5d, 0xb5, 0x3b, 0xc4, 0xb4, 0xf7, 0xf8, 0x9f, 0xaa, 0xed,
-	0x58, 0x9e, 0x85, 0x8a, 0xf6, 0x41, 0x55, 0x4c, 0x56, 0xc5, 0x64, 0xe9, 0x25, 0xdd, 0xf0, 0xee,
-	0xf9, 0x7b, 0xd5, 0xb6, 0xd5, 0xbd, 0xaa, 0x5b, 0xba, 0x75, 0x95, 0x03, 0xf7, 0xfc, 0x7d, 0x3e,
-	0xe2, 0x03, 0xfe, 0x4b, 0x08, 0x28, 0x95, 0x75, 0xcb, 0xd2, 0x3b, 0xb4, 0x8f, 0x7a, 0xe0, 0x10,
-	0xdb, 0xa6, 0x8e, 0x2b, 0xe7, 0xe7, 0xd8, 0xf2, 0xc4, 0x36, 0x04, 0xe0, 0xaa, 0xef, 0x1b, 0x9a,
-	0xbd, 0xc7, 0xff, 0x48, 0xc0, 0x25, 0x06, 0x70, 0xef, 0x11, 0x87, 0x6a, 0x57, 0xbd, 0x43, 0x9b,
-	0xba, 0xe2, 0x7f, 0x7b, 0x4f, 0xfc, 0x15, 0xa8, 0xca, 0x4f, 0x15, 0xc8, 0x6e, 0x77, 0x88, 0xd9,
-	0xb4, 0x3d, 0xc3, 0x32, 0x5d, 0x34, 0x0b, 0x93, 0xf4, 0xc0, 0xee, 0x10, 0xc3, 0x9c, 0x8d, 0x5f,
-	0x54, 0xe6, 0xd3, 0x38, 0x18, 0xb2, 0x19, 0x62, 0x92, 0xce, 0xe1, 0x87, 0x74, 0x36, 0x21, 0x66,
-	0xe4, 0x10, 0xdd, 0x86, 0xb3, 0x5d, 0x72, 0xa0, 0x5a, 0xbe, 0x67, 0xfb, 0x9e, 0xea, 0x58, 0x0f,
-	0x5c, 0xd5, 0xa6, 0x8e, 0xea, 0x91, 0xbd, 0x0e, 0x9d, 0x4d, 0x5e, 0x54, 0xe6, 0x13, 0x78, 0xa6,
-	0x4b, 0x0e, 0x9a, 0x7c, 0x1e, 0x5b, 0x0f, 0xdc, 0x6d, 0xea, 0xb4, 0xd8, 0xe4, 0x7a, 0x32, 0xad,
-	0x14, 0xe3, 0x95, 0xc7, 0x09, 0x48, 0x32, 0x1d, 0xd0, 0xf3, 0x90, 0xd0, 0x88, 0x3e, 0xab, 0x5c,
-	0x54, 0xe6, 0xb3, 0x0b, 0x33, 0xd5, 0x61, 0x17, 0x56, 0x97, 0x6b, 0xab, 0x98, 0x21, 0xd0, 0x4d,
-	0x98, 0x30, 0x2d, 0x8d, 0xba, 0xb3, 0xf1, 0x8b, 0x89, 0xf9, 0xec, 0x42, 0x79, 0x14, 0xca, 0xe4,
-	0xad, 0x38, 0x44, 0xef, 0x52, 0xd3, 0xc3, 0x02, 0x8c, 0xde, 0x80, 0x1c, 0x9b, 0x55, 0x2d, 0x61,
-	0x2b, 0x57, 0x2d, 0xbb, 0x70, 0x21, 0x9a, 0x59, 0x3a, 0x04, 0x67, 0xed, 0x90, 0x77, 0x76, 0x00,
-	0x19, 0x66, 0xdb, 0xea, 0x1a, 0xa6, 0xae, 0x12, 0x9d, 0x9a, 0x9e, 0x6a, 0x68, 0xee, 0xec, 0x04,
-	0x57, 0x62, 0x8a, 0xc9, 0x11, 0x61, 0xa8, 0xee, 0xee, 0x36, 0x96, 0x17, 0x4f, 0x1f, 0x3d, 0x9a,
-	0x2b, 0x36, 0x24, 0xbc, 0xc6, 0xd0, 0x8d, 0x65, 0x17, 0x17, 0x8d, 0x01, 0x8a, 0xe6, 0x22, 0x1f,
-	0x2e, 0xd0, 0x03, 0xda, 0xf6, 0xd9, 0x12, 0xaa, 0xeb, 0x11, 0xcf, 0x77, 0x55, 0x8d, 0xba, 0x9e,
-	0x61, 0x12, 0xa1, 0x67, 0x8a, 0xcb, 0xbf, 0x1e, 0xad, 0x67, 0xb5, 0x1e, 0xf0, 0xee, 0x70, 0xd6,
-	0xe5, 0x3e, 0x27, 0x3e, 0x47, 0xc7, 0xce, 0xb9, 0xa5, 0x7d, 0x28, 0x8d, 0x67, 0x45, 0xcf, 0x42,
-	0x4e, 0x77, 0xec, 0xb6, 0x4a, 0x34, 0xcd, 0xa1, 0xae, 0xcb, 0x63, 0x92, 0xc1, 0x59, 0x46, 0xab,
-	0x09, 0x12, 0xba, 0x0c, 0x05, 0xd7, 0xed, 0xa8, 0x1e, 0x71, 0x74, 0xea, 0x99, 0xa4, 0x4b, 0x79,
-	0xc6, 0x64, 0x70, 0xde, 0x75, 0x3b, 0xad, 0x1e, 0x71, 0x3d, 0x99, 0x4e, 0x14, 0x93, 0x95, 0x43,
-	0xc8, 0x85, 0x43, 0x82, 0x0a, 0x10, 0x37, 0x34, 0x2e, 0x35, 0x89, 0xe3, 0x86, 0x16, 0x84, 0x3e,
-	0x7e, 0x6c, 0xe8, 0xaf, 0x05, 0xa1, 0x4f, 0x70, 0xaf, 0x94, 0xa2, 0xbd, 0xb2, 0x65, 0x69, 0x54,
-	0x86, 0xbd, 0xf2, 0x5b, 0x05, 0x12, 0xcb, 0xb5, 0x55, 0x74, 0x23, 0xe0, 0x54, 0x38, 0xe7, 0x85,
-	0xc8, 0x45, 0xd8, 0xbf, 0x10, 0x73, 0xc9, 0x80, 0x49, 0x49, 0x19, 0x51, 0x99, 0xd9, 0x6f, 0x39,
-	0x1e, 0xd5, 0x54, 0x9b, 0x38, 0xd4, 0xf4, 0x58, 0x42, 0x25, 0xe6, 0x93, 0x38, 0x2f, 0xa8, 0xdb,
-	0x82, 0x88, 0x9e, 0x87, 0x29, 0x09, 0x6b, 0xdf, 0x33, 0x3a, 0x9a, 0x43, 0x4d, 0xae, 0x7a, 0x12,
-	0x4b, 0xee, 0x25, 0x49, 0xad, 0xac, 0x40, 0x3a, 0x50, 0x7d, 0x64, 0xad, 0x2b, 0x10, 0xb7, 0x6c,
-	0xe9, 0x9d, 0x08, 0x93, 0x9b, 0x36, 0x75, 0x88, 0x67, 0x39, 0x38, 0x6e, 0xd9, 0x95, 0x9f, 0xa5,
-	0x21, 0x1d, 0x10, 0xd0, 0x77, 0x60, 0xd2, 0xb2, 0x55, 0xb6, 0xe3, 0xb9, 0xb4, 0x42, 0xd4, 0x5e,
-	0x09, 0xc0, 0xad, 0x43, 0x9b, 0xe2, 0x94, 0x65, 0xb3, 0xbf, 0x68, 0x03, 0xf2, 0x5d, 0xda, 0x55,
-	0x5d, 0xcb, 0x77, 0xda, 0x54, 0xed, 0x2d, 0xfe, 0x7f, 0xa3, 0xec, 0x9b, 0xb4, 0x6b, 0x39, 0x87,
-	0x3b, 0x1c, 0x18, 0x88, 0x5a, 0x8b, 0xe1, 0x6c, 0x97, 0x76, 0x03, 0x22, 0xba, 0x05, 0xa9, 0x2e,
-	0xb1, 0x99, 0x98, 0xc4, 0xb8, 0x4d, 0xb7, 0x49, 0xec, 0x10, 0xf7, 0x44, 0x97, 0x0d, 0xd1, 0x5d,
-	0x48, 0x11, 0x5d, 0x67, 0x7c, 0x62, 0xb3, 0x3e, 0x37, 0xca, 0x57, 0xd3, 0x75, 0x87, 0xea, 0xc4,
-	0x0b, 0xaf, 0x3d, 0x41, 0x74, 0xbd, 0x69, 0xa3, 0x15, 0xc8, 0x72, 0x1b, 0x0c, 0xf3, 0x3e, 0x13,
-	0x31, 0xc1, 0x45, 0x5c, 0x1a, 0x6b, 0x81, 0x61, 0xde, 0x0f, 0xc9, 0xc8, 0x30, 0xfd, 0x39, 0x09,
-	0xbd, 0x0e, 0x99, 0x7d, 0xa3, 0xe3, 0x51, 0x87, 0x49, 0x49, 0x71, 0x29, 0x17, 0x47, 0xa5, 0xac,
-	0x70, 0x48, 0x48, 0x42, 0x7a, 0x5f, 0x52, 0xd0, 0x5d, 0x48, 0x77, 0x8c, 0xae, 0xe1, 0x31, 0xfe,
-	0x49, 0xce, 0x3f, 0x37, 0xca, 0xbf, 0xc1, 0x10, 0x21, 0xf6, 0xc9, 0x8e, 0x20, 0x30, 0x6e, 0xdf,
-	0x64, 0xc5, 0xc1, 0xb2, 0x67, 0xd3, 0xe3, 0xb8, 0x77, 0x19, 0x22, 0xcc, 0xed, 0x0b, 0x02, 0xfa,
-	0x11, 0x14, 0xf8, 0x4e, 0xee, 0x47, 0x32, 0x33, 0xce, 0x0f, 0xab, 0x78, 0x7b, 0x69, 0x30, 0x8e,
-	0x8b, 0xc5, 0xa3, 0x47, 0x73, 0xb9, 0x30, 0x7d, 0x2d, 0x86, 0x79, 0x65, 0xe8, 0x85, 0xf6, 0x6d,
-	0x59, 0x29, 0x02, 0x2f, 0x3f, 0x11, 0x06, 0x56, 0xc6, 0x88, 0x0f, 0x39, 0x79, 0xb1, 0x70, 0xf4,
-	0x68, 0x0e, 0xfa, 0xd4, 0xb5, 0x18, 0x06, 0x2e, 0x5a, 0x78, 0xfd, 0x15, 0x98, 0x7c, 0xcf, 0x32,
-	0xb8, 0xd5, 0x59, 0x2e, 0x32, 0x22, 0x75, 0xd7, 0x2d, 0x23, 0x6c, 0x74, 0xea, 0x3d, 0x3e, 0x46,
-	0x1b, 0x50, 0xf0, 0x35, 0x6f, 0x3f, 0x64, 0x73, 0x6e, 0x9c, 0xcd, 0xbb, 0xcb, 0xad, 0x95, 0x91,
-	0xdc, 0xcd, 0x31, 0xee, 0x9e, 0x85, 0x4d, 0x98, 0xa2, 0x5d, 0xdb, 0x3b, 0x0c, 0x89, 0xcb, 0x73,
-	0x71, 0x97, 0x47, 0xc5, 0xd5, 0x19, 0x70, 0x44, 0x5e, 0x9e, 0x86, 0xc9, 0xe8, 0x5d, 0xc8, 0x59,
-	0x1e, 0xed, 0xf4, 0x5c, 0x56, 0xe0, 0xd2, 0xe6, 0x23, 0x76, 0x66, 0x8b, 0x76, 0xea, 0x07, 0xb6,
-	0xe5, 0x78, 0xa3, 0x7e, 0x63, 0x73, 0x7d, 0xbf, 0x31, 0x79, 0x62, 0xb4, 0x98, 0x64, 0xb5, 0xa2,
-	0xf2, 0xb7, 0x38, 0x9c, 0x8e, 0xda, 0x99, 0x08, 0x41, 0x92, 0x17, 0x6b, 0x51, 0xd1, 0xf9, 0x6f,
-	0x34, 0x07, 0xd9, 0xb6, 0xd5, 0xf1, 0xbb, 0xa6, 0x6a, 0x68, 0x07, 0xe2, 0x54, 0x4d, 0x60, 0x10,
-	0xa4, 0x86, 0x76, 0xe0, 0xb2, 0xe3, 0x40, 0x02, 0x18, 0x5e, 0x14, 0xdf, 0x0c, 0x96, 0x4c, 0x5b,
-	0x8c, 0x84, 0x5e, 0xee, 0x41, 0x78, 0x7f, 0xc1, 0x8b, 0x61, 0x61, 0x01, 0x31, 0xa3, 0x44, 0xc3,
-	0xb1, 0x4c, 0x3c, 0xc2, 0x4b, 0x8c, 0x64, 0x63, 0xbf, 0x5d, 0x74, 0x07, 0xc0, 0xf5, 0x88, 0xe3,
-	0xa9, 0x9e, 0xd1, 0xa5, 0x72, 0x8b, 0x9e, 0xab, 0x8a, 0xe6, 0xa7, 0x1a, 0x34, 0x3f, 0xd5, 0x86,
-	0xe9, 0xdd, 0xba, 0xf9, 0x16, 0xe9, 0xf8, 0x14, 0x67, 0x38, 0xbc, 0x65, 0x74, 0x59, 0xe3, 0x91,
-	0x71, 0x3d, 0x56, 0xde, 0x18, 0x6b, 0xea, 0x78, 0xd6, 0x34, 0x43, 0x73, 0xce, 0x33, 0x90, 0xe2,
-	0xed, 0x89, 0xc7, 0xb7, 0x63, 0x06, 0xcb, 0x11, 0x3a, 0xcf, 0x24, 0x3a, 0x94, 0xb0, 0x03, 0x9a,
-	0xef, 0xb5, 0x34, 0xee, 0x13, 0x2a, 0x9f, 0x2b, 0x80, 0x46, 0x6b, 0x45, 0xa4, 0x47, 0x87, 0xbd,
-	0x11, 0x3f, 0x99, 0x37, 0x4e, 0xe0, 0xe7, 0x75, 0x98, 0x91, 0x10, 0x97, 0x76, 0x89, 0xe9, 0x19,
-	0xed, 0x01, 0x87, 0x9f, 0xe9, 0x2f, 0xb1, 0x23, 0xe7, 0xf9, 0x32, 0xa7, 0x04, 0x53, 0x98, 0xe6,
-	0x56, 0x4c, 0x40, 0xa3, 0x7b, 0x7e, 0x44, 0x77, 0xe5, 0xdb, 0xe9, 0x1e, 0x1f, 0xd1, 0xbd, 0xf2,
-	0x79, 0x12, 0x8a, 0xc3, 0x55, 0x80, 0x37, 0x96, 0x03, 0x5d, 0x46, 0x30, 0x44, 0xb7, 0x07, 0x4b,
-	0x97, 0xa1, 0xf1, 0xd3, 0x23, 0x39, 0x5c, 0x94, 0x1a, 0xcb, 0x83, 0x45, 0xa9, 0xa1, 0xa1, 0x1d,
-	0xc8, 0xc9, 0x76, 0xb4, 0xdf, 0x85, 0x66, 0x17, 0xaa, 0xc7, 0xd7, 0xa4, 0x2a, 0xa6, 0xae, 0xdf,
-	0xf1, 0x78, 0x7b, 0xca, 0x0e, 0x31, 0x21, 0x85, 0x0f, 0x91, 0x0e, 0xa8, 0x6d, 0x99, 0x26, 0x6d,
-	0x7b, 0xa2, 0x18, 0x8b, 0xee, 0x4c, 0xa4, 0xec, 0xed, 0x13, 0x88, 0x66, 0x84, 0xa5, 0x9e, 0x80,
-	0xa0, 0xc1, 0x9c, 0x6e, 0x0f, 0x93, 0x4a, 0x7f, 0x57, 0x20, 0x1b, 0xd2, 0x03, 0x5d, 0x00, 0xe0,
-	0x66, 0xa8, 0xa1, 0x34, 0xcb, 0x70, 0xca, 0xd6, 0xff, 0x4c, 0xae, 0x95, 0xbe, 0x0b, 0x33, 0x91,
-	0x0e, 0x88, 0xe8, 0x23, 0x95, 0x88, 0x3e, 0x72, 0x31, 0x0f, 0xd9, 0x50, 0x57, 0xbc, 0x9e, 0x4c,
-	0xc7, 0x8b, 0x89, 0xca, 0x07, 0x90, 0x0d, 0xf5, 0x0d, 0x68, 0x19, 0xb2, 0xf4, 0xc0, 0x66, 0xb9,
-	0xc3, 0x43, 0x23, 0x1a, 0xbd, 0x88, 0x93, 0x68, 0xa7, 0x4d, 0x3a, 0xc4, 0xa9, 0xf7, 0xa0, 0x38,
-	0xcc, 0x76, 0x92, 0x44, 0xfe, 0x7d, 0x1c, 0xa6, 0x47, 0x1a, 0x0f, 0xf4, 0x1a, 0xa4, 0x3e, 0x60,
-	0x85, 0x26, 0x58, 0xf9, 0xf2, 0x53, 0xba, 0x95, 0xd0, 0xe2, 0x92, 0x09, 0x5d, 0x83, 0x94, 0xee,
-	0x58, 0xbe, 0x1d, 0x5c, 0x6b, 0x66, 0x47, 0xd9, 0x97, 0xb8, 0x0e, 0x58, 0xe2, 0x58, 0xdd, 0xe6,
-	0xbf, 0x06, 0x22, 0x08, 0x9c, 0x24, 0x02, 0x38, 0x07, 0x59, 0x2e, 0x5c, 0x02, 0x92, 0x02, 0xc0,
-	0x49, 0x02, 0x50, 0x82, 0xf4, 0x03, 0xc3, 0xd4, 0xac, 0x07, 0x54, 0xe3, 0x99, 0x9c, 0xc6, 0xbd,
-	0x31, 0x63, 0xb6, 0x89, 0xe3, 0x19, 0xa4, 0xa3, 0x12, 0x5d, 0xe7, 0x05, 0x36, 0x8d, 0x41, 0x92,
-	0x6a, 0xba, 0x8e, 0x5e, 0x80, 0xe2, 0xbe, 0x61, 0x92, 0x8e, 0xf1, 0x21, 0x55, 0x1d, 0x9e, 0xaf,
-	0x2e, 0xaf, 0xa7, 0x69, 0x3c, 0x15, 0xd0, 0x45, 0x1a, 0xbb, 0x95, 0x9f, 0x2b, 0x50, 0x18, 0x6c,
-	0x90, 0xd0, 0x22, 0x40, 0xdf, 0xeb, 0xf2, 0xd2, 0x77, 0x92, 0x58, 0x85, 0xb8, 0xd0, 0x02, 0x4c,
-	0x8a, 0xb0, 0x1c, 0xef, 0xb3, 0x00, 0x58, 0xf9, 0x48, 0x81, 0xfc, 0x40, 0xaf, 0x85, 0x4e, 0xc3,
-	0x04, 0xef, 0xb5, 0xb8, 0x12, 0x09, 0x2c, 0x06, 0xdf, 0x46, 0x36, 0xcb, 0x65, 0xb2, 0x67, 0x39,
-	0x62, 0xb7, 0xba, 0x4e, 0xdb, 0x95, 0xbd, 0x7e, 0xbe, 0x47, 0xdd, 0x71, 0xda, 0x6e, 0xe5, 0x89,
-	0x02, 0xf9, 0x81, 0x86, 0x6d, 0x24, 0xe7, 0x94, 0xd1, 0xcd, 0xf8, 0x16, 0x4c, 0x49, 0x48, 0x97,
-	0xd8, 0xb6, 0x61, 0xea, 0x81, 0x5e, 0x2f, 0x1d, 0xd3, 0x0d, 0x4a, 0x2d, 0x37, 0x05, 0x17, 0x2e,
-	0xb4, 0xc3, 0x43, 0x17, 0x5d, 0x82, 0x42, 0xef, 0xce, 0xbe, 0x47, 0xbc, 0xf6, 0x3d, 0x51, 0x65,
-	0x71, 0xce, 0x11, 0x57, 0xf5, 0x45, 0x46, 0x2b, 0xdd, 0x82, 0xfc, 0x80, 0x18, 0x66, 0x6a, 0xd0,
-	0x33, 0x98, 0x1a, 0x3d, 0x90, 0x3a, 0x27, 0x70, 0x5e, 0xb6, 0x0d, 0x82, 0x58, 0xf9, 0x2c, 0x09,
-	0xb9, 0x70, 0x97, 0x86, 0x5e, 0x85, 0x64, 0xe8, 0x3a, 0xf2, 0xfc, 0xd3, 0x7b, 0x3a, 0x3e, 0xe0,
-	0x35, 0x85, 0x33, 0x21, 0x02, 0xa7, 0xe8, 0xfb, 0x3e, 0xe9, 0x18, 0xde, 0xa1, 0xda, 0xb6, 0x4c,
-	0xcd, 0x10, 0x35, 0x58, 0xf8, 0xe1, 0xda, 0x31, 0xb2, 0xea, 0x92, 0x73, 0x29, 0x60, 0xc4, 0x88,
-	0x0e, 0x93, 0x5c, 0x84, 0xa1, 0x20, 0x8f, 0x8e, 0x20, 0xfa, 0xe2, 0xa6, 0xf9, 0xff, 0xc7, 0x48,
-	0x17, 0xf7, 0x3d, 0x99, 0x10, 0x79, 0x21, 0x62, 0x49, 0xa6, 0xc5, 0x70, 0x74, 0x93, 0xa3, 0xd1,
-	0x1d, 0x8d, 0xc2, 0x44, 0x44, 0x14, 0xba, 0x30, 0x3d, 0x62, 0x05, 0xba, 0x02, 0xd3, 0x1d, 0xba,
-	0x1f, 0xe8, 0x2b, 0xc2, 0x21, 0xef, 0x8e, 0x53, 0x6c, 0x62, 0xa9, 0x1f, 0x10, 0xf4, 0x22, 0x20,
-	0xc7, 0xd0, 0xef, 0x0d, 0x81, 0xe3, 0x1c, 0x5c, 0xe4, 0x33, 0x21, 0x74, 0xa9, 0x05, 0xb9, 0xb0,
-	0x59, 0xcc, 0x0e, 0x71, 0xd7, 0x1d, 0x58, 0x24, 0x2b, 0x68, 0x62, 0x81, 0xbe, 0xa9, 0x61, 0xd1,
-	0xd9, 0x50, 0x52, 0x54, 0x5e, 0x86, 0x74, 0x10, 0x56, 0x94, 0x81, 0x89, 0xc6, 0xd6, 0x56, 0x1d,
-	0x17, 0x63, 0xa8, 0x00, 0xb0, 0x51, 0x5f, 0x69, 0xa9, 0xcd, 0xdd, 0x56, 0x1d, 0x17, 0x15, 0x36,
-	0x5e, 0xd9, 0xdd, 0xd8, 0x90, 0xe3, 0x44, 0x65, 0x1f, 0xd0, 0x68, 0xb3, 0x1e, 0xd9, 0x7c, 0xdd,
-	0x05, 0x20, 0x8e, 0xae, 0xca, 0x5a, 0x1c, 0x1f, 0x77, 0xdd, 0x17, 0x95, 0x45, 0x76, 0x95, 0xc4,
-	0xd1, 0xf9, 0x2f, 0xb7, 0x62, 0xc1, 0xa9, 0x88, 0x2e, 0xfe, 0x24, 0x3b, 0xf4, 0xdb, 0x1d, 0xc4,
-	0x95, 0x8f, 0x93, 0x90, 0xe6, 0xdd, 0xbc, 0x4d, 0x98, 0x8b, 0xb3, 0x4c, 0xbe, 0xea, 0x7a, 0x0e,
-	0xeb, 0x41, 0xb9, 0x59, 0xac, 0xc1, 0x67, 0xc4, 0x1d, 0x4e, 0x43, 0x2f, 0xc2, 0x34, 0x87, 0x8c,
-	0xf8, 0x39, 0xb1, 0x16, 0xc3, 0x53, 0x6c, 0x2a, 0x1c, 0xf1, 0xd7, 0x01, 0x88, 0xe7, 0x39, 0xc6,
-	0x9e, 0xef, 0xf5, 0x5e, 0x4d, 0xe6, 0xa2, 0xaf, 0x1a, 0xb5, 0x00, 0x87, 0x43, 0x2c, 0x68, 0x19,
-	0x66, 0x3c, 0x87, 0xf0, 0xfe, 0x6b, 0x70, 0x49, 0xfe, 0xb4, 0xb7, 0x38, 0x7d, 0xf4, 0x68, 0x2e,
-	0xdf, 0x62, 0x80, 0xc6, 0xb2, 0xcc, 0x7e, 0xc4, 0xf1, 0x0d, 0x2d, 0xac, 0x46, 0x0d, 0x4e, 0xbb,
-	0x36, 0x31, 0x47, 0x84, 0x4c, 0x70, 0x21, 0xbc, 0xa3, 0x63, 0xf6, 0xf7, 0x64, 0x4c, 0x33, 0xf4,
-	0xa0, 0x88, 0x16, 0x9c, 0x93, 0xd9, 0x17, 0x29, 0x29, 0xc5, 0x25, 0x9d, 0x39, 0x7a, 0x34, 0x87,
-	0x44, 0xd2, 0x0e, 0xc8, 0x7b, 0xc6, 0xee, 0xd3, 0x06, 0xa4, 0xbe, 0x0c, 0xcf, 0xf4, 0x2f, 0x20,
-	0x83, 0x12, 0x27, 0xf9, 0x71, 0x70, 0xba, 0x77, 0xe1, 0x08, 0xb3, 0x5d, 0x87, 0x19, 0x6a, 0x6a,
-	0x11, 0x4c, 0x69, 0xce, 0x84, 0xa8, 0xa9, 0x0d, 0xb3, 0x5c, 0x00, 0xb8, 0x6f, 0x98, 0x9a, 0xc8,
-	0x4b, 0x7e, 0x0b, 0x4f, 0xe0, 0x0c, 0xa3, 0xf0, 0xc4, 0x5b, 0x4c, 0x89, 0x4c, 0xae, 0xfc, 0x18,
-	0xa6, 0x58, 0x30, 0x36, 0xa9, 0xe7, 0x18, 0xed, 0x55, 0xe2, 0xeb, 0x14, 0x55, 0x01, 0xed, 0x77,
-	0x2c, 0x12, 0xb1, 0xc5, 0x59, 0xc8, 0x8b, 0x7c, 0x2e, 0xbc, 0xd2, 0x15, 0x28, 0x1a, 0xa6, 0x17,
-	0x9d, 0x20, 0x05, 0xc3, 0x0c, 0x63, 0x17, 0x0b, 0x90, 0x13, 0x2d, 0x82, 0x40, 0x57, 0x7e, 0x17,
-	0x87, 0xe9, 0xfe, 0xfa, 0x3b, 0x7e, 0xb7, 0x4b, 0x9c, 0x43, 0x56, 0x37, 0xda, 0x96, 0x6f, 0x46,
-	0x69, 0x80, 0x8b, 0x7c, 0x26, 0xbc, 0xfe, 0x3c, 0x14, 0x5d, 0xbf, 0x1b, 0xb1, 0x3e, 0x2e, 0xb8,
-	0x7e, 0x37, 0x8c, 0x7c, 0x17, 0xa6, 0xde, 0xf7, 0x59, 0x97, 0xd8, 0xa1, 0xc1, 0x7e, 0x15, 0x29,
-	0x7a, 0x23, 0x3a, 0x45, 0x07, 0xb4, 0xaa, 0x72, 0xc7, 0xd5, 0xbc, 0xef, 0x49, 0x09, 0xb8, 0x10,
-	0xc8, 0x12, 0x5b, 0xb9, 0xf4, 0x43, 0x98, 0x1a, 0x82, 0xb0, 0x86, 0x27, 0x00, 0x71, 0xf5, 0x15,
-	0xdc, 0x1b, 0x33, 0x23, 0xc3, 0xae, 0x18, 0x50, 0xbc, 0xc8, 0x67, 0x42, 0xaa, 0x57, 0x3e, 0x8d,
-	0x43, 0x7e, 0x60, 0xd7, 0x44, 0xd6, 0xa2, 0x37, 0x20, 0x25, 0xa4, 0x8d, 0x7f, 0x40, 0x1b, 0x10,
-	0x22, 0x0f, 0xeb, 0xb5, 0x18, 0x96, 0x7c, 0xe8, 0x39, 0xc8, 0x89, 0x62, 0x20, 0x13, 0x27, 0x21,
-	0x4b, 0x42, 0x56, 0x50, 0xb9, 0x81, 0xa5, 0xdf, 0x28, 0x90, 0x92, 0x45, 0xfa, 0x46, 0xef, 0x32,
-	0x1f, 0x3a, 0x67, 0xa3, 0x8a, 0x10, 0xf4, 0x8b, 0x50, 0x64, 0xd9, 0x4e, 0x0c, 0x94, 0x6d, 0x74,
-	0x1b, 0xce, 0xb6, 0x89, 0xa9, 0xee, 0x51, 0xf5, 0x3d, 0xd7, 0x32, 0x55, 0x6a, 0xb6, 0x2d, 0x8d,
-	0x6a, 0x2a, 0x71, 0x1c, 0x72, 0x28, 0x3f, 0x09, 0xcc, 0xb4, 0x89, 0xb9, 0x48, 0xd7, 0x5d, 0xcb,
-	0xac, 0x8b, 0xd9, 0x1a, 0x9b, 0x5c, 0x9c, 0x84, 0x09, 0xae, 0x7a, 0xe5, 0xb3, 0x38, 0x40, 0x3f,
-	0x8a, 0x91, 0xfe, 0xba, 0xc8, 0xdb, 0xfc, 0xb6, 0x63, 0xf0, 0xdb, 0x81, 0x7c, 0x52, 0x0e, 0x93,
-	0x18, 0x97, 0x6f, 0x1a, 0x9e, 0xf0, 0x03, 0xe6, 0xbf, 0x87, 0x8a, 0x5c, 0xf2, 0x9b, 0x17, 0xb9,
-	0x2b, 0x30, 0x3d, 0xba, 0x95, 0x79, 0x6d, 0xc2, 0x53, 0xde, 0xd0, 0x3e, 0x7e, 0x05, 0x26, 0x74,
-	0xb6, 0x2d, 0x67, 0x29, 0x8f, 0xe8, 0xb3, 0x4f, 0xcb, 0x54, 0xbe, 0x7f, 0xd7, 0x62, 0x58, 0x70,
-	0xa0, 0xd7, 0x61, 0xd2, 0x15, 0xb9, 0x3b, 0xbb, 0x3f, 0xee, 0x41, 0x73, 0x24, 0xcd, 0xd7, 0x62,
-	0x38, 0xe0, 0x62, 0x45, 0x42, 0x23, 0x1e, 0xa9, 0xfc, 0x53, 0x01, 0xc4, 0x5f, 0x87, 0x4c, 0xcd,
-	0xb6, 0xf8, 0x8e, 0x36, 0xf7, 0x0d, 0x1d, 0x9d, 0x85, 0x84, 0xef, 0x74, 0x84, 0x43, 0x17, 0x27,
-	0x8f, 0x1e, 0xcd, 0x25, 0x76, 0xf1, 0x06, 0x66, 0x34, 0xf4, 0x26, 0x4c, 0xde, 0xa3, 0x44, 0xa3,
-	0x4e, 0x70, 0x22, 0x5e, 0x1f, 0xf3, 0xde, 0x34, 0x20, 0xb1, 0xba, 0x26, 0x78, 0xea, 0xa6, 0xe7,
-	0x1c, 0xe2, 0x40, 0x02, 0xdb, 0x45, 0x86, 0xe9, 0xd2, 0xb6, 0xef, 0x04, 0x5f, 0x83, 0x7a, 0x63,
-	0x76, 0x9f, 0x67, 0x1e, 0xb3, 0x7c, 0x4f, 0x7e, 0xfc, 0x09, 0x86, 0xa5, 0x3b, 0x90, 0x0b, 0x8b,
-	0x43, 0x45, 0x48, 0xdc, 0xa7, 0x87, 0x32, 0xfc, 0xec, 0x27, 0xeb, 0xc4, 0x45, 0x92, 0x8b, 0xb8,
-	0x8b, 0xc1, 0x9d, 0xf8, 0x6d, 0xa5, 0xd2, 0x84, 0x1c, 0xd3, 0x0e, 0x53, 0xf1, 0x18, 0x30, 0x14,
-	0x71, 0xe5, 0x1b, 0x47, 0xbc, 0xf2, 0x8b, 0x38, 0x9c, 0x89, 0x7e, 0x5f, 0x43, 0x9b, 0x30, 0x45,
-	0xa5, 0x17, 0x58, 0x97, 0xb9, 0x6f, 0x04, 0xdf, 0xa4, 0x2e, 0x9d, 0xc4, 0x65, 0xb8, 0x40, 0x07,
-	0x83, 0x72, 0x07, 0xd2, 0x8e, 0x54, 0x5b, 0x16, 0x81, 0x72, 0xb4, 0x9c, 0xc0, 0x38, 0xdc, 0xc3,
-	0xa3, 0x5b, 0x30, 0xd9, 0xe5, 0xb9, 0x10, 0xd4, 0xc5, 0xf3, 0x4f, 0x4b, 0x18, 0x1c, 0x80, 0xd1,
-	0x35, 0x98, 0x60, 0x87, 0x64, 0xb0, 0x17, 0x4a, 0xd1, 0x5c, 0xec, 0x34, 0xc4, 0x02, 0x58, 0xf9,
-	0xa3, 0x02, 0xc5, 0xe1, 0xbb, 0x16, 0x7a, 0x15, 0xd2, 0x6d, 0xcb, 0x74, 0x3d, 0x62, 0x7a, 0xd2,
-	0x05, 0x4f, 0xef, 0xa3, 0xd6, 0x62, 0xb8, 0xc7, 0x80, 0x16, 0x86, 0x4a, 0xdf, 0xd8, 0xfb, 0x53,
-	0xa8, 0xd8, 0x2d, 0x40, 0x72, 0xdf, 0x37, 0xdb, 0xf2, 0x33, 0xc1, 0xf9, 0x71, 0x8b, 0xad, 0xf8,
-	0x66, 0x7b, 0x2d, 0x86, 0x39, 0xb6, 0x5f, 0x5e, 0xfe, 0x14, 0x87, 0x6c, 0x48, 0x19, 0x74, 0x15,
-	0x32, 0x6c, 0xb3, 0x1c, 0x57, 0x07, 0xd3, 0x9a, 0xfc, 0x85, 0xe6, 0x00, 0xf6, 0x2c, 0xab, 0xa3,
-	0xf6, 0x73, 0x30, 0xbd, 0x16, 0xc3, 0x19, 0x46, 0x13, 0x12, 0x9f, 0x85, 0xac, 0x61, 0x7a, 0xb7,
-	0x6e, 0x86, 0x4a, 0x31, 0x3b, 0x53, 0xc1, 0xe8, 0x3d, 0x32, 0xa2, 0xcb, 0x90, 0xe7, 0xe7, 0x71,
-	0x0f, 0xc4, 0x36, 0x81, 0xb2, 0x16, 0xc3, 0x39, 0x49, 0x16, 0xb0, 0xe1, 0xaa, 0x3e, 0x11, 0x51,
-	0xd5, 0xd1, 0x3c, 0xf0, 0xe2, 0x73, 0xeb, 0xa6, 0x6a, 0xba, 0x12, 0x97, 0x92, 0x4b, 0xe6, 0xc5,
-	0xc4, 0x96, 0x2b, 0x90, 0xb7, 0x21, 0xef, 0x1b, 0xa6, 0x77, 0x7d, 0xe1, 0xb6, 0xc4, 0x89, 0x57,
-	0xf8, 0xe9, 0xbe, 0xb9, 0xbb, 0x0d, 0x3e, 0xcd, 0x5f, 0xb7, 0x05, 0x52, 0xb4, 0x1d, 0x81, 0xf7,
-	0xd6, 0x93, 0xe9, 0x74, 0x31, 0x53, 0xf9, 0x52, 0x01, 0xe8, 0xfb, 0x38, 0xb2, 0x44, 0xdf, 0x81,
-	0x8c, 0x61, 0x1a, 0x9e, 0x4a, 0x1c, 0xfd, 0x84, 0xdd, 0x75, 0x9a, 0xe1, 0x6b, 0x8e, 0xee, 0xa2,
-	0x5b, 0x90, 0xe4, 0x6c, 0x89, 0x13, 0x3f, 0xcd, 0x70, 0xbc, 0xfc, 0x20, 0x26, 0xea, 0x49, 0xdc,
-	0xd0, 0xd0, 0x1d, 0x98, 0x62, 0x74, 0xb5, 0x17, 0x5f, 0xf1, 0x19, 0x36, 0x3a, 0xc0, 0x79, 0x06,
-	0x0d, 0x46, 0x6e, 0xe5, 0x5f, 0x71, 0x38, 0x15, 0xf1, 0x0e, 0xd3, 0xb3, 0x35, 0x31, 0xce, 0xd6,
-	0xe4, 0x37, 0xb3, 0xf5, 0x35, 0x69, 0xab, 0xf8, 0x3e, 0xfc, 0xc2, 0x89, 0x1e, 0x83, 0xaa, 0x35,
-	0x47, 0x1f, 0x30, 0x39, 0xf5, 0x34, 0x93, 0x27, 0x4f, 0x68, 0x72, 0xe9, 0x27, 0x90, 0xa8, 0x39,
-	0xfa, 0x7f, 0x7d, 0x3b, 0xf7, 0xb7, 0xe6, 0x42, 0xaf, 0x3d, 0x61, 0x5e, 0xb6, 0x34, 0x2a, 0xef,
-	0x8e, 0xfc, 0x37, 0x2b, 0xfb, 0xe1, 0xdb, 0xa2, 0x18, 0x5c, 0xf9, 0x47, 0x1c, 0x72, 0xe1, 0x6f,
-	0x93, 0xe8, 0x2c, 0xcc, 0x34, 0xb7, 0xeb, 0xb8, 0xd6, 0x6a, 0x62, 0xb5, 0xf5, 0xce, 0x76, 0x5d,
-	0xdd, 0xdd, 0x7a, 0x73, 0xab, 0xf9, 0xf6, 0x56, 0x31, 0x86, 0xce, 0xc1, 0x99, 0xcd, 0xfa, 0x66,
-	0x13, 0xbf, 0xa3, 0xee, 0x34, 0x77, 0xf1, 0x52, 0x5d, 0x0d, 0x80, 0xc5, 0x27, 0x93, 0xe8, 0x2c,
-	0x9c, 0x5e, 0xc5, 0xdb, 0x4b, 0x23, 0x53, 0x7f, 0x4d, 0xb3, 0x29, 0x76, 0xa9, 0x1c, 0x99, 0xfa,
-	0x34, 0x83, 0x4a, 0x30, 0x53, 0xdf, 0xdc, 0x6e, 0x8d, 0x4a, 0xfc, 0x15, 0xa0, 0x69, 0xc8, 0x6d,
-	0xd6, 0xb6, 0xfb, 0xa4, 0x87, 0x53, 0xe8, 0x19, 0x40, 0xb5, 0xd5, 0x55, 0x5c, 0x5f, 0xad, 0xb5,
-	0x42, 0xd8, 0x3f, 0x14, 0xd1, 0x69, 0x98, 0x5a, 0x69, 0x6c, 0xb4, 0xea, 0xb8, 0x4f, 0xfd, 0xf5,
-	0x34, 0x3a, 0x05, 0x85, 0x8d, 0xc6, 0x66, 0xa3, 0xd5, 0x27, 0xfe, 0x9b, 0x13, 0x77, 0xb7, 0x1a,
-	0xcd, 0xad, 0x3e, 0xf1, 0x4b, 0x84, 0x10, 0xe4, 0xd7, 0x9b, 0x8d, 0x10, 0xed, 0xcf, 0xa7, 0x98,
-	0xda, 0x81, 0xb9, 0x8d, 0xad, 0x37, 0xfb, 0x53, 0x9f, 0xac, 0x30, 0x3d, 0x84, 0xb1, 0x03, 0x13,
-	0x1f, 0xaf, 0xa2, 0x32, 0x9c, 0x6d, 0xb6, 0xea, 0x1b, 0x6a, 0xfd, 0xfb, 0xdb, 0x4d, 0xdc, 0x1a,
-	0x9a, 0xff, 0x7a, 0x75, 0xf1, 0xee, 0xc3, 0xc7, 0xe5, 0xd8, 0x17, 0x8f, 0xcb, 0xb1, 0xaf, 0x1f,
-	0x97, 0x95, 0x8f, 0x8e, 0xca, 0xca, 0x27, 0x47, 0x65, 0xe5, 0x2f, 0x47, 0x65, 0xe5, 0xe1, 0x51,
-	0x59, 0xf9, 0xf2, 0xa8, 0xac, 0x3c, 0x39, 0x2a, 0xc7, 0xbe, 0x3e, 0x2a, 0x2b, 0xbf, 0xfc, 0xaa,
-	0x1c, 0x7b, 0xf8, 0x55, 0x39, 0xf6, 0xc5, 0x57, 0xe5, 0xd8, 0x0f, 0x52, 0x22, 0xf4, 0x7b, 0x29,
-	0xfe, 0xc1, 0xe5, 0xc6, 0x7f, 0x02, 0x00, 0x00, 0xff, 0xff, 0x7a, 0x49, 0xc5, 0x4d, 0x17, 0x23,
-	0x00, 0x00,
+	// 3261 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xd5, 0x59, 0x4b, 0x6f, 0x23, 0xc7,
+	0x11, 0x36, 0x1f, 0xe2, 0xa3, 0xf8, 0x54, 0xef, 0x6a, 0x2d, 0x73, 0x9f, 0x1e, 0xaf, 0x9f, 0x89,
+	0xb9, 0x5e, 0xad, 0xbd, 0x59, 0x6f, 0xfc, 0x12, 0x25, 0x4a, 0xe6, 0xae, 0x24, 0xca, 0x23, 0xca,
+	0x8e, 0x13, 0x23, 0x83, 0x11, 0x39, 0xa2, 0xc6, 0x26, 0x67, 0xe8, 0x79, 0x78, 0x57, 0x06, 0x82,
+	0x04, 0x08, 0x10, 0xe4, 0xe0, 0xdc, 0x72, 0x08, 0x72, 0x4f, 0x90, 0x53, 0xe0, 0x43, 0x7e, 0x40,
+	0x02, 0x04, 0xf0, 0x21, 0x81, 0x11, 0xe4, 0x07, 0x04, 0x4e, 0x4e, 0x3e, 0x04, 0x41, 0x72, 0xca,
+	0x25, 0x87, 0x54, 0x75, 0xf7, 0x90, 0x43, 0xce, 0x70, 0xa5, 0xf5, 0x21, 0x40, 0x0e, 0xbb, 0x62,
+	0x57, 0x7f, 0x55, 0xdd, 0xf5, 0xe8, 0xea, 0xaa, 0x1e, 0xb8, 0xe0, 0x3a, 0xdd, 0x6b, 0x5d, 0xdd,
+	0xb1, 0x6c, 0xef, 0xda, 0x68, 0xa0, 0x5b, 0xa3, 0x03, 0xfe, 0xa7, 0x3e, 0x72, 0x6c, 0xcf, 0x66,
+	0xd5, 0xd1, 0xfd, 0xba, 0x98, 0xac, 0x8b, 0xc9, 0xda, 0xf3, 0x7d, 0xd3, 0x3b, 0xf2, 0x0f, 0xea,
+	0x5d, 0x7b, 0x78, 0xad, 0x6f, 0xf7, 0xed, 0x6b, 0x1c, 0x78, 0xe0, 0x1f, 0xf2, 0x11, 0x1f, 0xf0,
+	0x5f, 0x42, 0x40, 0xed, 0x52, 0xdf, 0xb6, 0xfb, 0x03, 0x63, 0x82, 0xba, 0xe7, 0xe8, 0xa3, 0x91,
+	0xe1, 0xb8, 0x72, 0xfe, 0x32, 0x2d, 0xaf, 0x8f, 0x4c, 0x01, 0xb8, 0xe6, 0xfb, 0x66, 0x0f, 0x77,
+	0x40, 0x7f, 0x24, 0xe0, 0x2a, 0x01, 0xdc, 0x23, 0xdd, 0x31, 0x7a, 0xd7, 0xbc, 0xe3, 0x91, 0xe1,
+	0x8a, 0xff, 0x11, 0xc4, 0xff, 0x0a, 0x94, 0xf2, 0x87, 0x04, 0x14, 0x76, 0x71, 0x83, 0xed, 0x91,
+	0x67, 0xda, 0x96, 0xcb, 0x96, 0x21, 0x6b, 0xdc, 0xc7, 0x1d, 0x9b, 0xd6, 0x72, 0xf2, 0x4a, 0xe2,
+	0x99, 0x9c, 0x1a, 0x0c, 0x69, 0x46, 0xb7, 0xf4, 0xc1, 0xf1, 0xc7, 0xc6, 0x72, 0x4a, 0xcc, 0xc8,
+	0x21, 0xbb, 0x05, 0x8f, 0x0d, 0xf5, 0xfb, 0x9a, 0xed, 0x7b, 0x23, 0xdf, 0xd3, 0x1c, 0xfb, 0x9e,
+	0xab, 0xe1, 0x46, 0x35, 0x4f, 0x3f, 0x18, 0x18, 0xcb, 0x69, 0xc4, 0xa6, 0xd4, 0x25, 0x04, 0xb4,
+	0xf9, 0xbc, 0x8a, 0xd3, 0xbb, 0x86, 0xd3, 0xa1, 0x49, 0xf6, 0x75, 0x60, 0xae, 0xa7, 0x5b, 0x3d,
+	0xd3, 0xea, 0x6b, 0x1f, 0xfa, 0x86, 0x73, 0xac, 0x7d, 0x60, 0x1c, 0x2f, 0x2f, 0x20, 0x4b, 0x5e,
+	0xad, 0x06, 0x33, 0x6f, 0xd1, 0xc4, 0x5d, 0xe3, 0x98, 0xd5, 0x20, 0x37, 0x72, 0x4c, 0xdb, 0x31,
+	0xbd, 0xe3, 0xe5, 0x0c, 0x17, 0x3b, 0x1e, 0xdf, 0x49, 0xe7, 0x12, 0xd5, 0xa4, 0xf2, 0xd7, 0x14,
+	0xa4, 0x49, 0x1b, 0xf6, 0x34, 0xa4, 0x7a, 0x7a, 0x7f, 0x39, 0x81, 0xa8, 0xc2, 0xca, 0x52, 0x7d,
+	0xd6, 0x19, 0xf5, 0xf5, 0xd5, 0x4d, 0x95, 0x10, 0xec, 0x45, 0x58, 0xb0, 0xec, 0x9e, 0xe1, 0xa2,
+	0xb6, 0x29, 0x84, 0x5e, 0x8a, 0x42, 0x49, 0xde, 0x86, 0xa3, 0xf7, 0x87, 0x86, 0xe5, 0xa9, 0x02,
+	0xcc, 0xde, 0x80, 0x22, 0xcd, 0x6a, 0xb6, 0xb0, 0x1a, 0x57, 0xb2, 0xb0, 0x72, 0x31, 0x9e, 0x59,
+	0x9a, 0x56, 0x2d, 0x8c, 0x42, 0x76, 0xde, 0x03, 0x66, 0x5a, 0x18, 0x0a, 0xa4, 0xb9, 0xde, 0x47,
+	0xd1, 0x9a, 0xd9, 0x73, 0x51, 0x73, 0xda, 0x44, 0x85, 0xe4, 0x08, 0x87, 0xd6, 0xf7, 0xf7, 0x5b,
+	0xeb, 0x8d, 0xb3, 0x7f, 0xfb, 0xcb, 0xe5, 0x6a, 0x4b, 0xc2, 0x57, 0x09, 0xdd, 0x5a, 0x77, 0xd5,
+	0xaa, 0x39, 0x45, 0xe9, 0xb9, 0xcc, 0x87, 0x8b, 0xc6, 0x7d, 0xa3, 0xeb, 0xd3, 0x12, 0x1a, 0x9a,
+	0xcf, 0xf3, 0x5d, 0x0d, 0xb7, 0xeb, 0x99, 0x96, 0x2e, 0xf6, 0x99, 0xe1, 0xf2, 0xaf, 0xc7, 0xef,
+	0xb3, 0xde, 0x0c, 0x78, 0xf7, 0x38, 0xeb, 0xfa, 0x84, 0x53, 0x3d, 0x6f, 0xcc, 0x9d, 0x73, 0x6b,
+	0x87, 0x50, 0x9b, 0xcf, 0xca, 0x1e, 0x87, 0x62, 0xdf, 0x19, 0x75, 0x35, 0xbd, 0xd7, 0x73, 0x0c,
+	0xd7, 0xe5, 0x3e, 0xc9, 0xab, 0x05, 0xa2, 0xad, 0x0a, 0x12, 0x7b, 0x12, 0xca, 0xae, 0x3b, 0xc0,
+	0x80, 0x71, 0xfa, 0x86, 0x67, 0xe9, 0x43, 0x83, 0xc7, 0x5e, 0x5e, 0x2d, 0x21, 0xb5, 0x33, 0x26,
+	0xa2, 0x8f, 0x53, 0xd5, 0xb4, 0x72, 0x0c, 0xc5, 0xb0, 0x4b, 0x58, 0x19, 0x92, 0x66, 0x8f, 0x4b,
+	0x4d, 0xab, 0xf8, 0x2b, 0x70, 0x7d, 0xf2, 0x44, 0xd7, 0xbf, 0x10, 0xb8, 0x3e, 0xc5, 0xad, 0x52,
+	0x8b, 0xb7, 0xca, 0x0e, 0x42, 0xa4, 0xdb, 0x95, 0x5f, 0x24, 0x20, 0x85, 0xec, 0xec, 0x46, 0xc0,
+	0x99, 0xe0, 0x9c, 0x17, 0x63, 0x17, 0xa1, 0x7f, 0x21, 0xe6, 0x9a, 0x09, 0x59, 0x49, 0x89, 0x6c,
+	0x99, 0xf4, 0xb7, 0x1d, 0xcf, 0xe8, 0x69, 0x23, 0x3c, 0xae, 0x96, 0x47, 0x01, 0x95, 0xc2, 0xb9,
+	0x92, 0xa0, 0xee, 0x0a, 0x22, 0x6a, 0x56, 0x91, 0xb0, 0xee, 0x91, 0x39, 0x40, 0xd3, 0x59, 0x7c,
+	0xeb, 0x69, 0x55, 0x72, 0xaf, 0x49, 0xaa, 0xb2, 0x01, 0xb9, 0x60, 0xeb, 0x91, 0xb5, 0x9e, 0x83,
+	0xa4, 0x3d, 0x92, 0xd6, 0x89, 0x51, 0xb9, 0x8d, 0x27, 0x57, 0xf7, 0x6c, 0x47, 0x45, 0x94, 0xf2,
+	0xc3, 0x1c, 0xe4, 0x02, 0x02, 0xfb, 0x06, 0x64, 0xed, 0x91, 0x46, 0xb9, 0x83, 0x4b, 0x2b, 0xc7,
+	0x9d, 0x95, 0x00, 0xdc, 0x41, 0x94, 0x9a, 0xb1, 0x47, 0xf4, 0x97, 0x6d, 0x41, 0x69, 0x68, 0x0c,
+	0x35, 0xd7, 0xf6, 0x9d, 0xae, 0xa1, 0x8d, 0x17, 0x7f, 0x2a, 0xca, 0xbe, 0x6d, 0x0c, 0x6d, 0xe7,
+	0x78, 0x8f, 0x03, 0x03, 0x51, 0x6f, 0x3e, 0xa2, 0x16, 0x90, 0x3d, 0x20, 0xb2, 0x9b, 0x90, 0x19,
+	0xea, 0x23, 0x12, 0x93, 0x9a, 0x77, 0xe8, 0xb6, 0xf5, 0x51, 0x88, 0x7b, 0x61, 0x48, 0x43, 0xf6,
+	0x0a, 0x64, 0xf4, 0x7e, 0x9f, 0xf8, 0xc4, 0x61, 0x7d, 0x22, 0xca, 0xb7, 0xda, 0xef, 0x3b, 0x46,
+	0x5f, 0xf7, 0xc2, 0x6b, 0x2f, 0x20, 0x13, 0x72, 0x6f, 0x40, 0x81, 0xeb, 0x60, 0x5a, 0x1f, 0x90,
+	0x88, 0x05, 0x2e, 0xe2, 0xea, 0x5c, 0x0d, 0x10, 0x16, 0x92, 0x91, 0xa7, 0xfd, 0x73, 0x12, 0x7b,
+	0x1d, 0xf2, 0x87, 0xe6, 0xc0, 0xc3, 0xec, 0x88, 0x52, 0x32, 0x5c, 0xca, 0x95, 0xa8, 0x94, 0x0d,
+	0x0e, 0x09, 0x49, 0xc8, 0x1d, 0x4a, 0x0a, 0xaa, 0x91, 0x1b, 0x98, 0x43, 0xd3, 0x23, 0xfe, 0x2c,
+	0xe7, 0xbf, 0x1c, 0xe5, 0xdf, 0x22, 0x44, 0x88, 0x3d, 0x3b, 0x10, 0x04, 0xe2, 0xf6, 0x2d, 0x4a,
+	0x0e, 0xc8, 0x9d, 0x9b, 0xc7, 0xbd, 0x4f, 0x88, 0x30, 0xb7, 0x2f, 0x08, 0xec, 0xbb, 0x50, 0xe6,
+	0x27, 0x79, 0xe2, 0xc9, 0xfc, 0x3c, 0x3b, 0x6c, 0xaa, 0xbb, 0x6b, 0xd3, 0x7e, 0x6c, 0x54, 0x31,
+	0x89, 0x15, 0xc3, 0x74, 0x14, 0xcd, 0x33, 0xc3, 0xd8, 0xb5, 0xef, 0xc8, 0x4c, 0x11, 0x58, 0xf9,
+	0x4b, 0xa1, 0xa0, 0x32, 0x47, 0x7c, 0xc8, 0xc8, 0x8d, 0x32, 0x0a, 0x87, 0x09, 0x15, 0x45, 0x03,
+	0x17, 0x2d, 0xac, 0xfe, 0x32, 0x64, 0xdf, 0xb7, 0x4d, 0xae, 0x75, 0x81, 0x8b, 0x8c, 0x09, 0xdd,
+	0x3b, 0x08, 0x08, 0x29, 0x9d, 0x79, 0x9f, 0x8f, 0x31, 0x78, 0xcb, 0x7e, 0xcf, 0x3b, 0x0c, 0xe9,
+	0x5c, 0x9c, 0xa7, 0xf3, 0xfe, 0x7a, 0x67, 0x23, 0x12, 0xbb, 0x45, 0xe2, 0x1e, 0x6b, 0xd8, 0x86,
+	0x8a, 0x31, 0x1c, 0x79, 0xc7, 0x21, 0x71, 0x25, 0x2e, 0xee, 0xc9, 0xa8, 0xb8, 0x26, 0x01, 0x23,
+	0xf2, 0x4a, 0x46, 0x98, 0xcc, 0xde, 0x83, 0xa2, 0xed, 0x19, 0x83, 0xb1, 0xc9, 0xca, 0x5c, 0xda,
+	0x33, 0x31, 0x27, 0xb3, 0x63, 0x0c, 0x9a, 0xf7, 0x47, 0x98, 0x27, 0xa2, 0x76, 0xa3, 0xb9, 0x89,
+	0xdd, 0x48, 0x9e, 0x18, 0x35, 0xd2, 0x94, 0x2b, 0x94, 0x7f, 0x27, 0xe1, 0x6c, 0xdc, 0xc9, 0x64,
+	0x0c, 0xd2, 0x3c, 0x59, 0x8b, 0x8c, 0xce, 0x7f, 0xb3, 0xcb, 0x50, 0xe8, 0xda, 0x03, 0x7f, 0x68,
+	0xe1, 0x7d, 0x76, 0x5f, 0xdc, 0xaa, 0x29, 0x15, 0x04, 0xa9, 0x85, 0x14, 0xba, 0x0e, 0x24, 0x80,
+	0xf0, 0x22, 0xf9, 0xe2, 0x75, 0x20, 0x68, 0x3b, 0x44, 0x62, 0x2f, 0x8d, 0x21, 0xbc, 0x52, 0xe1,
+	0xc9, 0xb0, 0xbc, 0xc2, 0x48, 0x29, 0x51, 0xba, 0xac, 0xeb, 0x9e, 0xce, 0x53, 0x8c, 0x64, 0xa3,
+	0xdf, 0x2e, 0xbb, 0x0d, 0x80, 0x77, 0x9e, 0xe3, 0x69, 0x9e, 0x89, 0x9b, 0x12, 0x47, 0xf4, 0x7c,
+	0x5d, 0x94, 0x51, 0xf5, 0xa0, 0x8c, 0xaa, 0xb7, 0x2c, 0xef, 0xe6, 0x8b, 0x6f, 0xeb, 0x03, 0xdf,
+	0x50, 0xf3, 0x1c, 0xde, 0x41, 0x34, 0x96, 0x30, 0x38, 0xa0, 0xf4, 0x46, 0xac, 0x99, 0x93, 0x59,
+	0x73, 0x84, 0xe6, 0x9c, 0xe7, 0x20, 0xc3, 0x0b, 0x1d, 0x8f, 0x1f, 0xc7, 0xbc, 0x2a, 0x47, 0xec,
+	0x02, 0x49, 0x74, 0x0c, 0x9d, 0x2e, 0x68, 0x7e, 0xd6, 0x72, 0xea, 0x84, 0xc0, 0xae, 0x62, 0xc6,
+	0xd7, 0x87, 0xa3, 0x81, 0xa1, 0x19, 0x1f, 0x51, 0xd9, 0x63, 0xf1, 0xa3, 0x94, 0x52, 0x8b, 0x82,
+	0xda, 0x24, 0xe2, 0x8e, 0xf2, 0x79, 0x02, 0x58, 0x34, 0xa3, 0xc4, 0xda, 0x7d, 0xd6, 0x66, 0xc9,
+	0xd3, 0xd9, 0xec, 0x14, 0xde, 0xb8, 0x03, 0x4b, 0x12, 0xe2, 0x1a, 0x43, 0xdd, 0xf2, 0xcc, 0xee,
+	0x94, 0x5b, 0xce, 0x4d, 0x96, 0xd8, 0x93, 0xf3, 0x7c, 0x99, 0x33, 0x82, 0x29, 0x4c, 0x73, 0x15,
+	0x0b, 0x58, 0x34, 0x33, 0x44, 0xf6, 0x9e, 0xf8, 0x6a, 0x7b, 0x4f, 0x46, 0xf6, 0xae, 0x7c, 0x9e,
+	0x85, 0xea, 0x6c, 0xae, 0xe0, 0x85, 0xec, 0x54, 0x2d, 0x12, 0x0c, 0x31, 0x0a, 0xa6, 0x12, 0x1c,
+	0xde, 0x9b, 0x74, 0xc7, 0xa4, 0x67, 0x53, 0x57, 0x6b, 0x7d, 0x3a, 0x75, 0xb5, 0x7a, 0x58, 0xce,
+	0x15, 0x65, 0xf9, 0x3b, 0xa9, 0x7a, 0x0b, 0x2b, 0xf5, 0x93, 0x33, 0x57, 0x5d, 0x35, 0x5c, 0x7f,
+	0xe0, 0xf1, 0x72, 0x98, 0xae, 0x3a, 0x21, 0x45, 0x54, 0xc7, 0x7d, 0x60, 0x5d, 0xdb, 0xb2, 0x8c,
+	0xae, 0x27, 0x52, 0xb6, 0xa8, 0xe1, 0x44, 0x60, 0xdf, 0x3a, 0x85, 0x68, 0x22, 0xac, 0x8d, 0x05,
+	0x04, 0x65, 0xe8, 0x62, 0x77, 0x96, 0xc4, 0xf6, 0xa1, 0x78, 0xa4, 0xbb, 0x47, 0x9a, 0x7b, 0xe4,
+	0x1f, 0x1e, 0x0e, 0x82, 0x03, 0xb0, 0x72, 0x8a, 0x25, 0xde, 0x44, 0xb6, 0x3d, 0xc1, 0xb5, 0x37,
+	0x32, 0xba, 0x6a, 0xe1, 0x68, 0x42, 0xa8, 0xfd, 0x19, 0x7b, 0x8b, 0x90, 0x7a, 0xec, 0x22, 0x00,
+	0xb7, 0x8e, 0x16, 0x8a, 0xde, 0x3c, 0xa7, 0xec, 0xfc, 0xdf, 0x84, 0x70, 0xed, 0x35, 0x58, 0x8a,
+	0xb5, 0x6b, 0x4c, 0x11, 0x9b, 0x88, 0x29, 0x62, 0x6b, 0xbf, 0x4c, 0x42, 0x65, 0xc6, 0x6a, 0xec,
+	0x29, 0xa8, 0x60, 0xdf, 0xa3, 0x85, 0x13, 0x67, 0x82, 0x27, 0xce, 0x12, 0x92, 0xd7, 0x26, 0xb9,
+	0xf3, 0x00, 0x8a, 0x53, 0xe5, 0xbc, 0xe8, 0x59, 0x5e, 0x7b, 0x78, 0x3f, 0xd5, 0xc3, 0xb5, 0xfd,
+	0x94, 0xcc, 0xda, 0x8f, 0xd0, 0x69, 0xe1, 0xf2, 0x7d, 0xfe, 0x69, 0xb9, 0x19, 0x39, 0x2d, 0xc9,
+	0xf8, 0xd3, 0x32, 0x73, 0x56, 0xa2, 0x86, 0x4a, 0xc5, 0x18, 0xaa, 0x51, 0x82, 0x42, 0x68, 0x63,
+	0x58, 0xfc, 0x27, 0xab, 0x29, 0xe5, 0x23, 0x28, 0x84, 0xaa, 0x3b, 0xb6, 0x0e, 0x05, 0x6c, 0x4f,
+	0x69, 0x37, 0xdc, 0x1e, 0xa2, 0x1c, 0x8f, 0xa9, 0x17, 0xf6, 0xba, 0xfa, 0x40, 0x77, 0x9a, 0x63,
+	0xa8, 0x1a, 0x66, 0x3b, 0x4d, 0x22, 0xf9, 0x75, 0x12, 0x16, 0x23, 0xe5, 0x21, 0x7b, 0x15, 0x32,
+	0x1f, 0xd1, 0x75, 0x10, 0xac, 0xfc, 0xe4, 0x03, 0x6a, 0xca, 0xd0, 0xe2, 0x92, 0x09, 0x1b, 0x90,
+	0x4c, 0xdf, 0xb1, 0xfd, 0x51, 0xe0, 0xc8, 0xe5, 0x28, 0xbb, 0x70, 0xbe, 0x2a, 0x71, 0x74, 0xbb,
+	0xf2, 0x5f, 0x53, 0xa1, 0x0e, 0x9c, 0x24, 0x22, 0x1d, 0x01, 0x5c, 0xb8, 0x04, 0xa4, 0x05, 0x80,
+	0x93, 0x04, 0x00, 0x7b, 0xe8, 0x7b, 0xa6, 0xd5, 0xb3, 0xef, 0x19, 0x3d, 0x9e, 0x49, 0x72, 0xea,
+	0x78, 0x4c, 0xcc, 0xd8, 0x7f, 0x78, 0xa6, 0x3e, 0xc0, 0x96, 0xb4, 0xcf, 0xb3, 0x40, 0x4e, 0x05,
+	0x49, 0x42, 0x45, 0xd8, 0xb3, 0x50, 0x3d, 0x44, 0x7f, 0x0c, 0xcc, 0x8f, 0x0d, 0xcd, 0xe1, 0x07,
+	0xdb, 0xe5, 0xb7, 0x5e, 0x4e, 0xad, 0x04, 0x74, 0x71, 0xde, 0x5d, 0xe5, 0xc7, 0x09, 0x28, 0x4f,
+	0x97, 0xb1, 0xac, 0x01, 0x30, 0xb1, 0xba, 0x6c, 0xcd, 0x4f, 0xe3, 0xab, 0x10, 0x17, 0x5b, 0x81,
+	0xac, 0x70, 0xcb, 0xc9, 0x36, 0x0b, 0x80, 0xca, 0x0f, 0x12, 0x50, 0x9a, 0xaa, 0x88, 0xd9, 0x59,
+	0x58, 0xe0, 0x15, 0x31, 0xdf, 0x44, 0x4a, 0x15, 0x83, 0xaf, 0x22, 0x9b, 0x62, 0x59, 0x3f, 0xc0,
+	0xa2, 0x8a, 0xa7, 0x35, 0xd7, 0xe9, 0xba, 0xb2, 0x23, 0x2b, 0x8d, 0xa9, 0x7b, 0x48, 0x54, 0xbe,
+	0xc4, 0x2d, 0x4c, 0x95, 0xd5, 0x91, 0x98, 0x4b, 0x44, 0xb3, 0xd6, 0xdb, 0x50, 0x91, 0x10, 0xec,
+	0x60, 0x46, 0x58, 0x35, 0x04, 0xfb, 0x7a, 0xfe, 0x84, 0x9a, 0x5d, 0xee, 0x72, 0x5b, 0x70, 0xa9,
+	0xe5, 0x6e, 0x78, 0xe8, 0x52, 0xed, 0x31, 0x7e, 0xa3, 0x39, 0xd0, 0xbd, 0xee, 0x91, 0xb8, 0xe5,
+	0xd4, 0xa2, 0x23, 0x9e, 0x66, 0x1a, 0x44, 0xab, 0xdd, 0x84, 0xd2, 0x94, 0x18, 0x52, 0x35, 0x48,
+	0x50, 0x56, 0xcf, 0xb8, 0x6f, 0x8c, 0x73, 0x94, 0x2c, 0xee, 0x04, 0x51, 0xf9, 0x2c, 0x0d, 0xc5,
+	0x70, 0x2d, 0xcd, 0xbe, 0x09, 0xe9, 0x50, 0xd3, 0xf8, 0xf4, 0x83, 0x2b, 0x6f, 0x3e, 0xe0, 0xc9,
+	0x97, 0x33, 0x31, 0x1d, 0xce, 0x18, 0x1f, 0xfa, 0x18, 0x59, 0x1e, 0xa5, 0x47, 0xab, 0x67, 0x86,
+	0x13, 0xdf, 0x0b, 0x27, 0xc8, 0x6a, 0x4a, 0xce, 0xb5, 0x80, 0x51, 0x65, 0xc6, 0x2c, 0xc9, 0x65,
+	0x2a, 0x94, 0xe5, 0xd5, 0x1d, 0x78, 0x5f, 0xbc, 0x07, 0x7c, 0xed, 0x04, 0xe9, 0xa2, 0x2b, 0x97,
+	0x01, 0x51, 0x12, 0x22, 0xd6, 0x64, 0x58, 0xcc, 0x7a, 0x37, 0x1d, 0xf5, 0x6e, 0xd4, 0x0b, 0x0b,
+	0x31, 0x5e, 0x18, 0xc2, 0x62, 0x44, 0x0b, 0x6c, 0xe1, 0x17, 0x07, 0xc6, 0xa1, 0xa7, 0x85, 0xdd,
+	0x21, 0x3b, 0xfc, 0x0a, 0x4d, 0xac, 0x4d, 0x1c, 0x42, 0x2f, 0x6c, 0x8e, 0xd9, 0x3f, 0x9a, 0x01,
+	0xf3, 0x44, 0xad, 0x56, 0xf9, 0x4c, 0x08, 0x5d, 0xeb, 0x40, 0x31, 0xac, 0x16, 0xe9, 0x21, 0x5e,
+	0x24, 0xa6, 0x16, 0x29, 0x08, 0x9a, 0x58, 0x60, 0xa2, 0x6a, 0x58, 0x74, 0x21, 0x14, 0x14, 0xca,
+	0x4b, 0x90, 0x0b, 0xdc, 0xca, 0xf2, 0xb0, 0xd0, 0xda, 0xd9, 0x69, 0xaa, 0xd5, 0x47, 0x58, 0x19,
+	0x60, 0xab, 0xb9, 0xd1, 0xd1, 0xda, 0xfb, 0x1d, 0x1c, 0x27, 0x68, 0xbc, 0xb1, 0xbf, 0xb5, 0x25,
+	0xc7, 0x29, 0xe5, 0x10, 0x58, 0xb4, 0xa5, 0x8a, 0x2d, 0x7e, 0x5f, 0x01, 0xc0, 0x7b, 0x43, 0x93,
+	0xb9, 0x38, 0x39, 0xef, 0x51, 0x46, 0x64, 0x16, 0x59, 0xfb, 0x23, 0x03, 0xff, 0xe5, 0x2a, 0x36,
+	0x9c, 0x89, 0xe9, 0xb5, 0x4e, 0x73, 0x42, 0xbf, 0x5a, 0xc5, 0xa2, 0x7c, 0x92, 0x86, 0x1c, 0xef,
+	0xb9, 0x46, 0x3a, 0x99, 0xb8, 0x40, 0xf2, 0x35, 0xec, 0x0d, 0xa8, 0x53, 0xe0, 0x6a, 0x51, 0x1b,
+	0x46, 0xc4, 0x3d, 0x4e, 0x43, 0x1f, 0x2e, 0x72, 0x48, 0xc4, 0xce, 0x29, 0x04, 0x56, 0x68, 0x2a,
+	0xec, 0xf1, 0xd7, 0xd1, 0x18, 0x1e, 0x32, 0x1e, 0xf8, 0xde, 0xf8, 0x6d, 0xeb, 0x72, 0x7c, 0x43,
+	0xb8, 0x1a, 0xe0, 0xd4, 0x10, 0x0b, 0x5e, 0xaa, 0x4b, 0x9e, 0xa3, 0xf3, 0x1b, 0x7d, 0x7a, 0x49,
+	0xfe, 0x94, 0xdb, 0x58, 0xc4, 0xeb, 0xbd, 0xd4, 0x21, 0x40, 0x6b, 0x5d, 0x46, 0x3f, 0xe3, 0xf8,
+	0x56, 0x2f, 0xbc, 0x8d, 0x55, 0x38, 0xeb, 0xa2, 0x7e, 0x11, 0x21, 0x0b, 0x5c, 0x08, 0xaf, 0x11,
+	0x48, 0xff, 0xb1, 0x8c, 0x45, 0x42, 0x4f, 0x8b, 0xe8, 0xc0, 0x79, 0x19, 0x7d, 0xb1, 0x92, 0xf8,
+	0x13, 0x70, 0xe3, 0x1c, 0x4a, 0x62, 0x22, 0x68, 0xa7, 0xe4, 0x3d, 0x3a, 0x9a, 0xd0, 0xa6, 0xa4,
+	0xbe, 0x04, 0x8f, 0x4e, 0xda, 0xc4, 0x69, 0x89, 0x59, 0x7e, 0x1d, 0x9c, 0x1d, 0xb7, 0x85, 0x61,
+	0xb6, 0xeb, 0xb0, 0x64, 0x58, 0xbd, 0x18, 0xa6, 0x1c, 0x67, 0x62, 0x38, 0x39, 0xcb, 0x82, 0xf5,
+	0xee, 0x07, 0x88, 0x11, 0x71, 0x29, 0x1b, 0xbc, 0x3c, 0x51, 0x78, 0xe0, 0x35, 0x32, 0x22, 0x92,
+	0x95, 0xef, 0x41, 0x85, 0x9c, 0xb1, 0x6d, 0xa0, 0x07, 0xba, 0x9b, 0xba, 0xdf, 0x37, 0x58, 0x1d,
+	0xd8, 0xe1, 0xc0, 0xd6, 0x63, 0x8e, 0x38, 0xb9, 0xbc, 0xca, 0xe7, 0xc2, 0x2b, 0x3d, 0x07, 0x55,
+	0xd3, 0xf2, 0xe2, 0x03, 0xa4, 0x6c, 0x5a, 0x61, 0x6c, 0xa3, 0x0c, 0x45, 0x51, 0x22, 0x08, 0xb4,
+	0x82, 0x05, 0xe9, 0xe2, 0x64, 0xfd, 0x3d, 0x7f, 0x38, 0xd4, 0x9d, 0x63, 0xca, 0x1b, 0x5d, 0xdb,
+	0xb7, 0xe2, 0x76, 0xa0, 0x56, 0xf9, 0x4c, 0x78, 0xfd, 0x67, 0xa0, 0xea, 0xfa, 0xc3, 0x98, 0xf5,
+	0xd5, 0x32, 0xd2, 0xc3, 0xc8, 0xf7, 0xa0, 0x82, 0xf9, 0x0c, 0xcb, 0x69, 0xbc, 0x2f, 0xe5, 0x79,
+	0x15, 0x21, 0x7a, 0x23, 0x3e, 0x44, 0xa7, 0x76, 0x55, 0xe7, 0x86, 0x5b, 0xf5, 0xde, 0x92, 0x12,
+	0xd4, 0x72, 0x20, 0x4b, 0x1c, 0xe5, 0xda, 0x77, 0xa0, 0x32, 0x03, 0xa1, 0x82, 0x27, 0x00, 0xf1,
+	0xed, 0x27, 0xd4, 0xf1, 0x98, 0x94, 0x0c, 0x9b, 0x62, 0x6a, 0xe3, 0x55, 0x3e, 0x13, 0xda, 0xba,
+	0xf2, 0x69, 0x12, 0x4a, 0x53, 0xa7, 0x26, 0x36, 0x17, 0xbd, 0x01, 0x19, 0x21, 0x6d, 0xfe, 0x33,
+	0xe7, 0x94, 0x10, 0x79, 0x59, 0xd3, 0x93, 0x93, 0xe0, 0x63, 0x4f, 0x40, 0x51, 0x24, 0x03, 0x19,
+	0x38, 0x29, 0x99, 0x12, 0x0a, 0x82, 0xca, 0x15, 0xac, 0xfd, 0x3c, 0x01, 0x19, 0x99, 0xa4, 0x6f,
+	0x8c, 0x9f, 0x5c, 0x42, 0xf7, 0x6c, 0x5c, 0x12, 0x82, 0x49, 0x12, 0x8a, 0x4d, 0xdb, 0xa9, 0xa9,
+	0xb4, 0x4d, 0x9f, 0x75, 0xba, 0x78, 0xec, 0x0e, 0x0c, 0xed, 0x7d, 0x17, 0xfb, 0x4f, 0xc3, 0xea,
+	0xda, 0x3d, 0xa3, 0xa7, 0xe9, 0x8e, 0xa3, 0x1f, 0xcb, 0x4f, 0x40, 0x4b, 0x08, 0x68, 0x18, 0x77,
+	0x70, 0xba, 0x29, 0x66, 0x57, 0x69, 0xb2, 0x91, 0x85, 0x05, 0xbe, 0x75, 0xe5, 0xb3, 0x24, 0xc0,
+	0xc4, 0x8b, 0xb1, 0xf6, 0xba, 0xc2, 0xcb, 0xfc, 0xae, 0x63, 0xf2, 0x36, 0x4a, 0x3e, 0xfc, 0x87,
+	0x49, 0xc4, 0xe5, 0x5b, 0x58, 0xac, 0x89, 0x2e, 0x81, 0xff, 0x9e, 0x49, 0x72, 0xe9, 0x87, 0x4f,
+	0x72, 0x78, 0x87, 0x46, 0x8f, 0x32, 0xcf, 0x4d, 0x6a, 0xc5, 0x9b, 0x39, 0xc7, 0x2f, 0xc3, 0x42,
+	0x9f, 0x8e, 0xe5, 0xb2, 0xc1, 0x3d, 0xfa, 0xf8, 0x83, 0x22, 0x95, 0x9f, 0x5f, 0x7a, 0x37, 0xe6,
+	0x1c, 0xb8, 0xcf, 0xac, 0x2b, 0x62, 0x77, 0xf9, 0x70, 0xde, 0xb3, 0x73, 0x24, 0xcc, 0xe9, 0xcd,
+	0x55, 0x72, 0x51, 0x92, 0xe8, 0xa1, 0xff, 0x94, 0x7f, 0x24, 0x80, 0xf1, 0x37, 0x3c, 0xab, 0x37,
+	0xb2, 0xf9, 0x89, 0xb6, 0x0e, 0xcd, 0x3e, 0x7b, 0x0c, 0x52, 0xbe, 0x33, 0x10, 0x06, 0x6d, 0x64,
+	0x31, 0x15, 0xa6, 0xf6, 0xd5, 0x2d, 0x95, 0x68, 0xec, 0x2e, 0x64, 0x8f, 0x0c, 0xbd, 0x67, 0x38,
+	0xc1, 0x8d, 0x78, 0x7d, 0xce, 0xab, 0xe0, 0x94, 0xc4, 0xfa, 0x9b, 0x82, 0xa7, 0x69, 0x79, 0xce,
+	0xb1, 0x1a, 0x48, 0xa0, 0x53, 0x64, 0x5a, 0xae, 0xd1, 0xf5, 0x9d, 0xe0, 0xeb, 0xdf, 0x78, 0x4c,
+	0x1d, 0x22, 0x59, 0x0c, 0x2b, 0x20, 0xf9, 0xb1, 0x2f, 0x18, 0xd6, 0x6e, 0x43, 0x31, 0x2c, 0x8e,
+	0x55, 0x21, 0x45, 0xdf, 0xf7, 0x84, 0xfb, 0xe9, 0x27, 0x55, 0xe2, 0x22, 0xc8, 0x85, 0xdf, 0xc5,
+	0xe0, 0x76, 0xf2, 0x56, 0x42, 0x69, 0x43, 0x91, 0x76, 0x87, 0xfd, 0x04, 0xbf, 0x96, 0x67, 0x3c,
+	0x9e, 0x78, 0x68, 0x8f, 0x2b, 0x3f, 0x49, 0xc2, 0xb9, 0xf8, 0x57, 0x50, 0xb6, 0x0d, 0x15, 0x43,
+	0x5a, 0x81, 0xaa, 0x4c, 0x34, 0x83, 0x6c, 0x4f, 0xae, 0x9e, 0xc6, 0x64, 0x6a, 0xd9, 0x98, 0x76,
+	0xca, 0x6d, 0xc8, 0x39, 0x72, 0xdb, 0x32, 0x09, 0x5c, 0x8a, 0x97, 0x13, 0x28, 0xa7, 0x8e, 0xf1,
+	0xd8, 0x54, 0x67, 0x87, 0x3c, 0x16, 0x82, 0xbc, 0x78, 0xe1, 0x41, 0x01, 0xa3, 0x06, 0x60, 0xfa,
+	0x98, 0x45, 0x97, 0x64, 0x70, 0x16, 0x6a, 0xf1, 0x5c, 0x74, 0x1b, 0xaa, 0x02, 0xa8, 0xfc, 0x36,
+	0x01, 0xd5, 0xd9, 0x5e, 0x0b, 0x8b, 0xf5, 0x1c, 0x1a, 0x80, 0xbe, 0xbc, 0x7a, 0xd2, 0x04, 0x0f,
+	0xae, 0xa3, 0xe8, 0xdb, 0x44, 0xc0, 0x80, 0x0d, 0xd4, 0x74, 0xea, 0x9b, 0xdb, 0x3f, 0x85, 0x92,
+	0xdd, 0x0a, 0xa4, 0x0f, 0x7d, 0xab, 0x2b, 0x3f, 0xe6, 0x5c, 0x98, 0xb7, 0xd8, 0x06, 0x62, 0x90,
+	0x8b, 0x63, 0x27, 0xe9, 0xe5, 0x77, 0x49, 0x28, 0x84, 0x36, 0xc3, 0xae, 0x41, 0x9e, 0x0e, 0xcb,
+	0x49, 0x79, 0x30, 0xd7, 0x93, 0xbf, 0xb0, 0xe3, 0x85, 0x03, 0xdb, 0x1e, 0x68, 0x93, 0x18, 0xcc,
+	0xd1, 0xf7, 0x1a, 0xa2, 0x09, 0x89, 0x58, 0x9d, 0x99, 0xf4, 0xea, 0x1b, 0x4a, 0xc5, 0x74, 0xa7,
+	0x82, 0x39, 0x7e, 0x0a, 0xc6, 0xbe, 0xa8, 0xc4, 0xef, 0xe3, 0x31, 0x88, 0x0e, 0x41, 0x82, 0x5e,
+	0x08, 0x25, 0x59, 0xc0, 0x66, 0xb3, 0xfa, 0x42, 0x4c, 0x56, 0xc7, 0x7b, 0x94, 0x27, 0x1f, 0x14,
+	0x65, 0xb9, 0x12, 0x97, 0x91, 0x4b, 0x96, 0xc4, 0xc4, 0x8e, 0x2b, 0x90, 0xb7, 0xa0, 0xe4, 0xe3,
+	0x26, 0xae, 0xaf, 0xdc, 0x92, 0x38, 0xf1, 0xad, 0x64, 0x71, 0xa2, 0xee, 0x7e, 0x8b, 0x4f, 0xf3,
+	0x6f, 0x10, 0x02, 0x29, 0xca, 0x8e, 0xc0, 0x7a, 0x77, 0xd2, 0xb9, 0x5c, 0x35, 0xaf, 0x7c, 0x91,
+	0x00, 0x98, 0xd8, 0x38, 0x36, 0x45, 0xdf, 0x86, 0xbc, 0x89, 0x49, 0x17, 0x33, 0x7f, 0xff, 0x94,
+	0xd5, 0x75, 0x8e, 0xf0, 0xab, 0x08, 0xc7, 0x78, 0x4e, 0x73, 0xb6, 0xd4, 0xa9, 0x9f, 0x66, 0x38,
+	0x5e, 0x7e, 0xb6, 0x14, 0xf9, 0x84, 0x3e, 0x5b, 0xde, 0x86, 0x0a, 0xd1, 0xb5, 0xb1, 0x7f, 0xc5,
+	0xc7, 0xf2, 0x78, 0x07, 0x97, 0x08, 0x1a, 0x8c, 0x5c, 0xe5, 0x5f, 0x49, 0x38, 0x13, 0xf3, 0x0e,
+	0x33, 0xd6, 0x35, 0x35, 0x4f, 0xd7, 0xf4, 0xc3, 0xe9, 0xfa, 0xaa, 0xd4, 0x55, 0x7c, 0xc5, 0x7f,
+	0xf6, 0x54, 0x8f, 0x41, 0x75, 0xe4, 0x9c, 0x52, 0x39, 0xf3, 0x20, 0x95, 0xb3, 0xa7, 0x54, 0xb9,
+	0xf6, 0x7d, 0x48, 0xa1, 0xe0, 0xff, 0xf9, 0x71, 0x9e, 0x1c, 0xcd, 0x95, 0x71, 0x79, 0x42, 0x56,
+	0xc6, 0xd2, 0x40, 0xf6, 0x8e, 0xfc, 0x37, 0xa5, 0xfd, 0x70, 0xb7, 0x28, 0x06, 0xcf, 0xfd, 0x3d,
+	0x89, 0x39, 0x3f, 0xf4, 0x05, 0x19, 0x6f, 0xb7, 0xa5, 0xf6, 0x6e, 0x53, 0x5d, 0xed, 0xb4, 0x55,
+	0xad, 0xf3, 0xee, 0x6e, 0x53, 0xdb, 0xdf, 0xb9, 0xbb, 0xd3, 0x7e, 0x67, 0x07, 0x9b, 0xc7, 0xf3,
+	0x70, 0x6e, 0xbb, 0xb9, 0xdd, 0x56, 0xdf, 0xd5, 0xf6, 0xda, 0xfb, 0xea, 0x5a, 0x53, 0x0b, 0x80,
+	0xd5, 0x2f, 0xb3, 0xc8, 0x77, 0x96, 0xde, 0x1f, 0x23, 0x53, 0x7f, 0xcc, 0xd1, 0x14, 0x35, 0x95,
+	0x91, 0xa9, 0x4f, 0xf3, 0x78, 0xc7, 0x2d, 0x35, 0xb7, 0x77, 0x3b, 0x51, 0x89, 0x3f, 0x05, 0xb6,
+	0x08, 0xc5, 0xed, 0xd5, 0xdd, 0x09, 0xe9, 0x4f, 0x15, 0xf6, 0x28, 0xb0, 0xd5, 0xcd, 0x4d, 0xb5,
+	0xb9, 0xb9, 0xda, 0x09, 0x61, 0x7f, 0x53, 0x45, 0xe5, 0x2a, 0x1b, 0xad, 0x2d, 0xec, 0x61, 0x27,
+	0xd4, 0x9f, 0x2d, 0xb2, 0x33, 0x50, 0xde, 0x6a, 0x6d, 0xb7, 0x3a, 0x13, 0xe2, 0x7f, 0x38, 0x71,
+	0x7f, 0xa7, 0xd5, 0xde, 0x99, 0x10, 0xbf, 0x60, 0x68, 0xb0, 0xd2, 0x9d, 0x76, 0x2b, 0x44, 0xfb,
+	0xfd, 0x19, 0xda, 0x76, 0xa0, 0x6e, 0x6b, 0xe7, 0xee, 0x64, 0xea, 0x57, 0x1b, 0xb4, 0x0f, 0xa1,
+	0xec, 0xd4, 0xc4, 0x27, 0x9b, 0xec, 0x12, 0x3c, 0xd6, 0xee, 0x34, 0xb7, 0xb4, 0xe6, 0xb7, 0x76,
+	0xdb, 0x6a, 0x67, 0x66, 0xfe, 0x9f, 0x9b, 0x8d, 0xdc, 0xb7, 0x33, 0xc2, 0x8d, 0x07, 0x19, 0xfe,
+	0x89, 0xeb, 0xc6, 0x7f, 0x01, 0xaf, 0x91, 0xb0, 0x5c, 0xd3, 0x24, 0x00, 0x00,
 }
 
 func (x OperatorType) String() string {
@@ -3432,6 +3581,12 @@ func (this *PlanOptions) Equal(that interface{}) bool {
 	if this.MaxOutputRowsPerTable != that1.MaxOutputRowsPerTable {
 		return false
 	}
+	if this.StandingQueryKey != that1.StandingQueryKey {
+		return false
+	}
+	if this.Priority != that1.Priority {
+		return false
+	}
 	return true
 }
 func (this *Plan) Equal(that interface{}) bool {
@@ -4046,6 +4201,9 @@ func (this *MemorySourceOperator) Equal(that interface{}) bool {
 	if this.Streaming != that1.Streaming {
 		return false
 	}
+	if this.SampleEveryN != that1.SampleEveryN {
+		return false
+	}
 	return true
 }
 func (this *MemorySinkOperator) Equal(that interface{}) bool {
@@ -4167,6 +4325,9 @@ func (this *GRPCSinkOperator) Equal(that interface{}) bool {
 	if !this.ConnectionOptions.Equal(that1.ConnectionOptions) {
 		return false
 	}
+	if !this.HashShuffle.Equal(that1.HashShuffle) {
+		return false
+	}
 	return true
 }
 func (this *GRPCSinkOperator_GRPCSourceID) Equal(that interface{}) bool {
@@ -4289,6 +4450,73 @@ func (this *GRPCSinkOperator_GRPCConnectionOptions) Equal(that interface{}) bool
 	}
 	return true
 }
+func (this *GRPCSinkOperator_HashShuffleSpec) Equal(that interface{}) bool {
+	if that == nil {
+		return this == nil
+	}
+
+	that1, ok := that.(*GRPCSinkOperator_HashShuffleSpec)
+	if !ok {
+		that2, ok := that.(GRPCSinkOperator_HashShuffleSpec)
+		if ok {
+			that1 = &that2
+		} else {
+			return false
+		}
+	}
+	if that1 == nil {
+		return this == nil
+	} else if this == nil {
+		return false
+	}
+	if len(this.KeyColumnIdxs) != len(that1.KeyColumnIdxs) {
+		return false
+	}
+	for i := range this.KeyColumnIdxs {
+		if this.KeyColumnIdxs[i] != that1.KeyColumnIdxs[i] {
+			return false
+		}
+	}
+	if len(this.Destinations) != len(that1.Destinations) {
+		return false
+	}
+	for i := range this.Destinations {
+		if !this.Destinations[i].Equal(that1.Destinations[i]) {
+			return false
+		}
+	}
+	return true
+}
+func (this *GRPCSinkOperator_HashShuffleSpec_Destination) Equal(that interface{}) bool {
+	if that == nil {
+		return this == nil
+	}
+
+	that1, ok := that.(*GRPCSinkOperator_HashShuffleSpec_Destination)
+	if !ok {
+		that2, ok := that.(GRPCSinkOperator_HashShuffleSpec_Destination)
+		if ok {
+			that1 = &that2
+		} else {
+			return false
+		}
+	}
+	if that1 == nil {
+		return this == nil
+	} else if this == nil {
+		return false
+	}
+	if this.Address != that1.Address {
+		return false
+	}
+	if this.GRPCSourceID != that1.GRPCSourceID {
+		return false
+	}
+	if this.SslTargetname != that1.SslTargetname {
+		return false
+	}
+	return true
+}
 func (this *MapOperator) Equal(that interface{}) bool {
 	if that == nil {
 		return this == nil
@@ -5756,11 +5984,13 @@ func (this *PlanOptions) GoString() string {
 	if this == nil {
 		return "nil"
 	}
-	s := make([]string, 0, 7)
+	s := make([]string, 0, 9)
 	s = append(s, "&planpb.PlanOptions{")
 	s = append(s, "Explain: "+fmt.Sprintf("%#v", this.Explain)+",\n")
 	s = append(s, "Analyze: "+fmt.Sprintf("%#v", this.Analyze)+",\n")
 	s = append(s, "MaxOutputRowsPerTable: "+fmt.Sprintf("%#v", this.MaxOutputRowsPerTable)+",\n")
+	s = append(s, "StandingQueryKey: "+fmt.Sprintf("%#v", this.StandingQueryKey)+",\n")
+	s = append(s, "Priority: "+fmt.Sprintf("%#v", this.Priority)+",\n")
 	s = append(s, "}")
 	return strings.Join(s, "")
 }
@@ -5973,7 +6203,7 @@ func (this *MemorySourceOperator) GoString() string {
 	if this == nil {
 		return "nil"
 	}
-	s := make([]string, 0, 12)
+	s := make([]string, 0, 13)
 	s = append(s, "&planpb.MemorySourceOperator{")
 	s = append(s, "Name: "+fmt.Sprintf("%#v", this.Name)+",\n")
 	s = append(s, "ColumnIdxs: "+fmt.Sprintf("%#v", this.ColumnIdxs)+",\n")
@@ -5987,6 +6217,7 @@ func (this *MemorySourceOperator) GoString() string {
 	}
 	s = append(s, "Tablet: "+fmt.Sprintf("%#v", this.Tablet)+",\n")
 	s = append(s, "Streaming: "+fmt.Sprintf("%#v", this.Streaming)+",\n")
+	s = append(s, "SampleEveryN: "+fmt.Sprintf("%#v", this.SampleEveryN)+",\n")
 	s = append(s, "}")
 	return strings.Join(s, "")
 }
@@ -6018,7 +6249,7 @@ func (this *GRPCSinkOperator) GoString() string {
 	if this == nil {
 		return "nil"
 	}
-	s := make([]string, 0, 8)
+	s := make([]string, 0, 9)
 	s = append(s, "&planpb.GRPCSinkOperator{")
 	s = append(s, "Address: "+fmt.Sprintf("%#v", this.Address)+",\n")
 	if this.Destination != nil {
@@ -6027,6 +6258,9 @@ func (this *GRPCSinkOperator) GoString() string {
 	if this.ConnectionOptions != nil {
 		s = append(s, "ConnectionOptions: "+fmt.Sprintf("%#v", this.ConnectionOptions)+",\n")
 	}
+	if this.HashShuffle != nil {
+		s = append(s, "HashShuffle: "+fmt.Sprintf("%#v", this.HashShuffle)+",\n")
+	}
 	s = append(s, "}")
 	return strings.Join(s, "")
 }
@@ -6069,6 +6303,31 @@ func (this *GRPCSinkOperator_GRPCConnectionOptions) GoString() string {
 	s = append(s, "}")
 	return strings.Join(s, "")
 }
+func (this *GRPCSinkOperator_HashShuffleSpec) GoString() string {
+	if this == nil {
+		return "nil"
+	}
+	s := make([]string, 0, 6)
+	s = append(s, "&planpb.GRPCSinkOperator_HashShuffleSpec{")
+	s = append(s, "KeyColumnIdxs: "+fmt.Sprintf("%#v", this.KeyColumnIdxs)+",\n")
+	if this.Destinations != nil {
+		s = append(s, "Destinations: "+fmt.Sprintf("%#v", this.Destinations)+",\n")
+	}
+	s = append(s, "}")
+	return strings.Join(s, "")
+}
+func (this *GRPCSinkOperator_HashShuffleSpec_Destination) GoString() string {
+	if this == nil {
+		return "nil"
+	}
+	s := make([]string, 0, 7)
+	s = append(s, "&planpb.GRPCSinkOperator_HashShuffleSpec_Destination{")
+	s = append(s, "Address: "+fmt.Sprintf("%#v", this.Address)+",\n")
+	s = append(s, "GRPCSourceID: "+fmt.Sprintf("%#v", this.GRPCSourceID)+",\n")
+	s = append(s, "SslTargetname: "+fmt.Sprintf("%#v", this.SslTargetname)+",\n")
+	s = append(s, "}")
+	return strings.Join(s, "")
+}
 func (this *MapOperator) GoString() string {
 	if this == nil {
 		return "nil"
@@ -6643,6 +6902,18 @@ func (m *PlanOptions) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	_ = i
 	var l int
 	_ = l
+	if m.Priority != 0 {
+		i = encodeVarintPlan(dAtA, i, uint64(m.Priority))
+		i--
+		dAtA[i] = 0x30
+	}
+	if len(m.StandingQueryKey) > 0 {
+		i -= len(m.StandingQueryKey)
+		copy(dAtA[i:], m.StandingQueryKey)
+		i = encodeVarintPlan(dAtA, i, uint64(len(m.StandingQueryKey)))
+		i--
+		dAtA[i] = 0x2a
+	}
 	if m.MaxOutputRowsPerTable != 0 {
 		i = encodeVarintPlan(dAtA, i, uint64(m.MaxOutputRowsPerTable))
 		i--
@@ -7324,6 +7595,11 @@ func (m *MemorySourceOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	_ = i
 	var l int
 	_ = l
+	if m.SampleEveryN != 0 {
+		i = encodeVarintPlan(dAtA, i, uint64(m.SampleEveryN))
+		i--
+		dAtA[i] = 0x48
+	}
 	if m.Streaming {
 		i--
 		if m.Streaming {
@@ -7566,6 +7842,18 @@ func (m *GRPCSinkOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	_ = i
 	var l int
 	_ = l
+	if m.HashShuffle != nil {
+		{
+			size, err := m.HashShuffle.MarshalToSizedBuffer(dAtA[:i])
+			if err != nil {
+				return 0, err
+			}
+			i -= size
+			i = encodeVarintPlan(dAtA, i, uint64(size))
+		}
+		i--
+		dAtA[i] = 0x32
+	}
 	if m.ConnectionOptions != nil {
 		{
 			size, err := m.ConnectionOptions.MarshalToSizedBuffer(dAtA[:i])
@@ -7735,7 +8023,7 @@ func (m *GRPCSinkOperator_GRPCConnectionOptions) MarshalToSizedBuffer(dAtA []byt
 	return len(dAtA) - i, nil
 }
 
-func (m *MapOperator) Marshal() (dAtA []byte, err error) {
+func (m *GRPCSinkOperator_HashShuffleSpec) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalToSizedBuffer(dAtA[:size])
@@ -7745,29 +8033,20 @@ func (m *MapOperator) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *MapOperator) MarshalTo(dAtA []byte) (int, error) {
+func (m *GRPCSinkOperator_HashShuffleSpec) MarshalTo(dAtA []byte) (int, error) {
 	size := m.Size()
 	return m.MarshalToSizedBuffer(dAtA[:size])
 }
 
-func (m *MapOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
+func (m *GRPCSinkOperator_HashShuffleSpec) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	i := len(dAtA)
 	_ = i
 	var l int
 	_ = l
-	if len(m.ColumnNames) > 0 {
-		for iNdEx := len(m.ColumnNames) - 1; iNdEx >= 0; iNdEx-- {
-			i -= len(m.ColumnNames[iNdEx])
-			copy(dAtA[i:], m.ColumnNames[iNdEx])
-			i = encodeVarintPlan(dAtA, i, uint64(len(m.ColumnNames[iNdEx])))
-			i--
-			dAtA[i] = 0x12
-		}
-	}
-	if len(m.Expressions) > 0 {
-		for iNdEx := len(m.Expressions) - 1; iNdEx >= 0; iNdEx-- {
+	if len(m.Destinations) > 0 {
+		for iNdEx := len(m.Destinations) - 1; iNdEx >= 0; iNdEx-- {
 			{
-				size, err := m.Expressions[iNdEx].MarshalToSizedBuffer(dAtA[:i])
+				size, err := m.Destinations[iNdEx].MarshalToSizedBuffer(dAtA[:i])
 				if err != nil {
 					return 0, err
 				}
@@ -7775,13 +8054,32 @@ func (m *MapOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 				i = encodeVarintPlan(dAtA, i, uint64(size))
 			}
 			i--
-			dAtA[i] = 0xa
+			dAtA[i] = 0x12
+		}
+	}
+	if len(m.KeyColumnIdxs) > 0 {
+		dAtA2 := make([]byte, len(m.KeyColumnIdxs)*10)
+		var j1 int
+		for _, num1 := range m.KeyColumnIdxs {
+			num := uint64(num1)
+			for num >= 1<<7 {
+				dAtA2[j1] = uint8(uint64(num)&0x7f | 0x80)
+				num >>= 7
+				j1++
+			}
+			dAtA2[j1] = uint8(num)
+			j1++
 		}
+		i -= j1
+		copy(dAtA[i:], dAtA2[:j1])
+		i = encodeVarintPlan(dAtA, i, uint64(j1))
+		i--
+		dAtA[i] = 0xa
 	}
 	return len(dAtA) - i, nil
 }
 
-func (m *AggregateOperator) Marshal() (dAtA []byte, err error) {
+func (m *GRPCSinkOperator_HashShuffleSpec_Destination) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalToSizedBuffer(dAtA[:size])
@@ -7791,43 +8089,131 @@ func (m *AggregateOperator) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *AggregateOperator) MarshalTo(dAtA []byte) (int, error) {
+func (m *GRPCSinkOperator_HashShuffleSpec_Destination) MarshalTo(dAtA []byte) (int, error) {
 	size := m.Size()
 	return m.MarshalToSizedBuffer(dAtA[:size])
 }
 
-func (m *AggregateOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
+func (m *GRPCSinkOperator_HashShuffleSpec_Destination) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	i := len(dAtA)
 	_ = i
 	var l int
 	_ = l
-	if m.FinalizeResults {
-		i--
-		if m.FinalizeResults {
-			dAtA[i] = 1
-		} else {
-			dAtA[i] = 0
-		}
+	if len(m.SslTargetname) > 0 {
+		i -= len(m.SslTargetname)
+		copy(dAtA[i:], m.SslTargetname)
+		i = encodeVarintPlan(dAtA, i, uint64(len(m.SslTargetname)))
 		i--
-		dAtA[i] = 0x38
+		dAtA[i] = 0x1a
 	}
-	if m.PartialAgg {
-		i--
-		if m.PartialAgg {
-			dAtA[i] = 1
-		} else {
-			dAtA[i] = 0
-		}
+	if m.GRPCSourceID != 0 {
+		i = encodeVarintPlan(dAtA, i, uint64(m.GRPCSourceID))
 		i--
-		dAtA[i] = 0x30
+		dAtA[i] = 0x10
 	}
-	if m.Windowed {
-		i--
-		if m.Windowed {
-			dAtA[i] = 1
-		} else {
-			dAtA[i] = 0
-		}
+	if len(m.Address) > 0 {
+		i -= len(m.Address)
+		copy(dAtA[i:], m.Address)
+		i = encodeVarintPlan(dAtA, i, uint64(len(m.Address)))
+		i--
+		dAtA[i] = 0xa
+	}
+	return len(dAtA) - i, nil
+}
+
+func (m *MapOperator) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalToSizedBuffer(dAtA[:size])
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *MapOperator) MarshalTo(dAtA []byte) (int, error) {
+	size := m.Size()
+	return m.MarshalToSizedBuffer(dAtA[:size])
+}
+
+func (m *MapOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
+	i := len(dAtA)
+	_ = i
+	var l int
+	_ = l
+	if len(m.ColumnNames) > 0 {
+		for iNdEx := len(m.ColumnNames) - 1; iNdEx >= 0; iNdEx-- {
+			i -= len(m.ColumnNames[iNdEx])
+			copy(dAtA[i:], m.ColumnNames[iNdEx])
+			i = encodeVarintPlan(dAtA, i, uint64(len(m.ColumnNames[iNdEx])))
+			i--
+			dAtA[i] = 0x12
+		}
+	}
+	if len(m.Expressions) > 0 {
+		for iNdEx := len(m.Expressions) - 1; iNdEx >= 0; iNdEx-- {
+			{
+				size, err := m.Expressions[iNdEx].MarshalToSizedBuffer(dAtA[:i])
+				if err != nil {
+					return 0, err
+				}
+				i -= size
+				i = encodeVarintPlan(dAtA, i, uint64(size))
+			}
+			i--
+			dAtA[i] = 0xa
+		}
+	}
+	return len(dAtA) - i, nil
+}
+
+func (m *AggregateOperator) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalToSizedBuffer(dAtA[:size])
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *AggregateOperator) MarshalTo(dAtA []byte) (int, error) {
+	size := m.Size()
+	return m.MarshalToSizedBuffer(dAtA[:size])
+}
+
+func (m *AggregateOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
+	i := len(dAtA)
+	_ = i
+	var l int
+	_ = l
+	if m.FinalizeResults {
+		i--
+		if m.FinalizeResults {
+			dAtA[i] = 1
+		} else {
+			dAtA[i] = 0
+		}
+		i--
+		dAtA[i] = 0x38
+	}
+	if m.PartialAgg {
+		i--
+		if m.PartialAgg {
+			dAtA[i] = 1
+		} else {
+			dAtA[i] = 0
+		}
+		i--
+		dAtA[i] = 0x30
+	}
+	if m.Windowed {
+		i--
+		if m.Windowed {
+			dAtA[i] = 1
+		} else {
+			dAtA[i] = 0
+		}
 		i--
 		dAtA[i] = 0x28
 	}
@@ -9478,6 +9864,13 @@ func (m *PlanOptions) Size() (n int) {
 	if m.MaxOutputRowsPerTable != 0 {
 		n += 1 + sovPlan(uint64(m.MaxOutputRowsPerTable))
 	}
+	l = len(m.StandingQueryKey)
+	if l > 0 {
+		n += 1 + l + sovPlan(uint64(l))
+	}
+	if m.Priority != 0 {
+		n += 1 + sovPlan(uint64(m.Priority))
+	}
 	return n
 }
 
@@ -9828,6 +10221,9 @@ func (m *MemorySourceOperator) Size() (n int) {
 	if m.Streaming {
 		n += 2
 	}
+	if m.SampleEveryN != 0 {
+		n += 1 + sovPlan(uint64(m.SampleEveryN))
+	}
 	return n
 }
 
@@ -9903,6 +10299,10 @@ func (m *GRPCSinkOperator) Size() (n int) {
 		l = m.ConnectionOptions.Size()
 		n += 1 + l + sovPlan(uint64(l))
 	}
+	if m.HashShuffle != nil {
+		l = m.HashShuffle.Size()
+		n += 1 + l + sovPlan(uint64(l))
+	}
 	return n
 }
 
@@ -9973,6 +10373,48 @@ func (m *GRPCSinkOperator_GRPCConnectionOptions) Size() (n int) {
 	return n
 }
 
+func (m *GRPCSinkOperator_HashShuffleSpec) Size() (n int) {
+	if m == nil {
+		return 0
+	}
+	var l int
+	_ = l
+	if len(m.KeyColumnIdxs) > 0 {
+		l = 0
+		for _, e := range m.KeyColumnIdxs {
+			l += sovPlan(uint64(e))
+		}
+		n += 1 + sovPlan(uint64(l)) + l
+	}
+	if len(m.Destinations) > 0 {
+		for _, e := range m.Destinations {
+			l = e.Size()
+			n += 1 + l + sovPlan(uint64(l))
+		}
+	}
+	return n
+}
+
+func (m *GRPCSinkOperator_HashShuffleSpec_Destination) Size() (n int) {
+	if m == nil {
+		return 0
+	}
+	var l int
+	_ = l
+	l = len(m.Address)
+	if l > 0 {
+		n += 1 + l + sovPlan(uint64(l))
+	}
+	if m.GRPCSourceID != 0 {
+		n += 1 + sovPlan(uint64(m.GRPCSourceID))
+	}
+	l = len(m.SslTargetname)
+	if l > 0 {
+		n += 1 + l + sovPlan(uint64(l))
+	}
+	return n
+}
+
 func (m *MapOperator) Size() (n int) {
 	if m == nil {
 		return 0
@@ -10785,6 +11227,8 @@ func (this *PlanOptions) String() string {
 		`Explain:` + fmt.Sprintf("%v", this.Explain) + `,`,
 		`Analyze:` + fmt.Sprintf("%v", this.Analyze) + `,`,
 		`MaxOutputRowsPerTable:` + fmt.Sprintf("%v", this.MaxOutputRowsPerTable) + `,`,
+		`StandingQueryKey:` + fmt.Sprintf("%v", this.StandingQueryKey) + `,`,
+		`Priority:` + fmt.Sprintf("%v", this.Priority) + `,`,
 		`}`,
 	}, "")
 	return s
@@ -11038,6 +11482,7 @@ func (this *MemorySourceOperator) String() string {
 		`StopTime:` + strings.Replace(fmt.Sprintf("%v", this.StopTime), "Int64Value", "types.Int64Value", 1) + `,`,
 		`Tablet:` + fmt.Sprintf("%v", this.Tablet) + `,`,
 		`Streaming:` + fmt.Sprintf("%v", this.Streaming) + `,`,
+		`SampleEveryN:` + fmt.Sprintf("%v", this.SampleEveryN) + `,`,
 		`}`,
 	}, "")
 	return s
@@ -11074,6 +11519,7 @@ func (this *GRPCSinkOperator) String() string {
 		`Address:` + fmt.Sprintf("%v", this.Address) + `,`,
 		`Destination:` + fmt.Sprintf("%v", this.Destination) + `,`,
 		`ConnectionOptions:` + strings.Replace(fmt.Sprintf("%v", this.ConnectionOptions), "GRPCSinkOperator_GRPCConnectionOptions", "GRPCSinkOperator_GRPCConnectionOptions", 1) + `,`,
+		`HashShuffle:` + strings.Replace(fmt.Sprintf("%v", this.HashShuffle), "GRPCSinkOperator_HashShuffleSpec", "GRPCSinkOperator_HashShuffleSpec", 1) + `,`,
 		`}`,
 	}, "")
 	return s
@@ -11121,6 +11567,34 @@ func (this *GRPCSinkOperator_GRPCConnectionOptions) String() string {
 	}, "")
 	return s
 }
+func (this *GRPCSinkOperator_HashShuffleSpec) String() string {
+	if this == nil {
+		return "nil"
+	}
+	repeatedStringForDestinations := "[]*GRPCSinkOperator_HashShuffleSpec_Destination{"
+	for _, f := range this.Destinations {
+		repeatedStringForDestinations += strings.Replace(fmt.Sprintf("%v", f), "GRPCSinkOperator_HashShuffleSpec_Destination", "GRPCSinkOperator_HashShuffleSpec_Destination", 1) + ","
+	}
+	repeatedStringForDestinations += "}"
+	s := strings.Join([]string{`&GRPCSinkOperator_HashShuffleSpec{`,
+		`KeyColumnIdxs:` + fmt.Sprintf("%v", this.KeyColumnIdxs) + `,`,
+		`Destinations:` + repeatedStringForDestinations + `,`,
+		`}`,
+	}, "")
+	return s
+}
+func (this *GRPCSinkOperator_HashShuffleSpec_Destination) String() string {
+	if this == nil {
+		return "nil"
+	}
+	s := strings.Join([]string{`&GRPCSinkOperator_HashShuffleSpec_Destination{`,
+		`Address:` + fmt.Sprintf("%v", this.Address) + `,`,
+		`GRPCSourceID:` + fmt.Sprintf("%v", this.GRPCSourceID) + `,`,
+		`SslTargetname:` + fmt.Sprintf("%v", this.SslTargetname) + `,`,
+		`}`,
+	}, "")
+	return s
+}
 func (this *MapOperator) String() string {
 	if this == nil {
 		return "nil"
@@ -11836,6 +12310,57 @@ func (m *PlanOptions) Unmarshal(dAtA []byte) error {
 					break
 				}
 			}
+		case 5:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field StandingQueryKey", wireType)
+			}
+			var stringLen uint64
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				stringLen |= uint64(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			intStringLen := int(stringLen)
+			if intStringLen < 0 {
+				return ErrInvalidLengthPlan
+			}
+			postIndex := iNdEx + intStringLen
+			if postIndex < 0 {
+				return ErrInvalidLengthPlan
+			}
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.StandingQueryKey = string(dAtA[iNdEx:postIndex])
+			iNdEx = postIndex
+		case 6:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Priority", wireType)
+			}
+			m.Priority = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.Priority |= int64(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipPlan(dAtA[iNdEx:])
@@ -13630,6 +14155,25 @@ func (m *MemorySourceOperator) Unmarshal(dAtA []byte) error {
 				}
 			}
 			m.Streaming = bool(v != 0)
+		case 9:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field SampleEveryN", wireType)
+			}
+			m.SampleEveryN = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.SampleEveryN |= int64(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipPlan(dAtA[iNdEx:])
@@ -14206,6 +14750,42 @@ func (m *GRPCSinkOperator) Unmarshal(dAtA []byte) error {
 				return err
 			}
 			iNdEx = postIndex
+		case 6:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field HashShuffle", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= int(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthPlan
+			}
+			postIndex := iNdEx + msglen
+			if postIndex < 0 {
+				return ErrInvalidLengthPlan
+			}
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.HashShuffle == nil {
+				m.HashShuffle = &GRPCSinkOperator_HashShuffleSpec{}
+			}
+			if err := m.HashShuffle.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipPlan(dAtA[iNdEx:])
@@ -14561,6 +15141,299 @@ func (m *GRPCSinkOperator_GRPCConnectionOptions) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
+func (m *GRPCSinkOperator_HashShuffleSpec) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowPlan
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= uint64(b&0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: HashShuffleSpec: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: HashShuffleSpec: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType == 0 {
+				var v int64
+				for shift := uint(0); ; shift += 7 {
+					if shift >= 64 {
+						return ErrIntOverflowPlan
+					}
+					if iNdEx >= l {
+						return io.ErrUnexpectedEOF
+					}
+					b := dAtA[iNdEx]
+					iNdEx++
+					v |= int64(b&0x7F) << shift
+					if b < 0x80 {
+						break
+					}
+				}
+				m.KeyColumnIdxs = append(m.KeyColumnIdxs, v)
+			} else if wireType == 2 {
+				var packedLen int
+				for shift := uint(0); ; shift += 7 {
+					if shift >= 64 {
+						return ErrIntOverflowPlan
+					}
+					if iNdEx >= l {
+						return io.ErrUnexpectedEOF
+					}
+					b := dAtA[iNdEx]
+					iNdEx++
+					packedLen |= int(b&0x7F) << shift
+					if b < 0x80 {
+						break
+					}
+				}
+				if packedLen < 0 {
+					return ErrInvalidLengthPlan
+				}
+				postIndex := iNdEx + packedLen
+				if postIndex < 0 {
+					return ErrInvalidLengthPlan
+				}
+				if postIndex > l {
+					return io.ErrUnexpectedEOF
+				}
+				var elementCount int
+				var count int
+				for _, integer := range dAtA[iNdEx:postIndex] {
+					if integer < 128 {
+						count++
+					}
+				}
+				elementCount = count
+				if elementCount != 0 && len(m.KeyColumnIdxs) == 0 {
+					m.KeyColumnIdxs = make([]int64, 0, elementCount)
+				}
+				for iNdEx < postIndex {
+					var v int64
+					for shift := uint(0); ; shift += 7 {
+						if shift >= 64 {
+							return ErrIntOverflowPlan
+						}
+						if iNdEx >= l {
+							return io.ErrUnexpectedEOF
+						}
+						b := dAtA[iNdEx]
+						iNdEx++
+						v |= int64(b&0x7F) << shift
+						if b < 0x80 {
+							break
+						}
+					}
+					m.KeyColumnIdxs = append(m.KeyColumnIdxs, v)
+				}
+			} else {
+				return fmt.Errorf("proto: wrong wireType = %d for field KeyColumnIdxs", wireType)
+			}
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Destinations", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= int(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthPlan
+			}
+			postIndex := iNdEx + msglen
+			if postIndex < 0 {
+				return ErrInvalidLengthPlan
+			}
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Destinations = append(m.Destinations, &GRPCSinkOperator_HashShuffleSpec_Destination{})
+			if err := m.Destinations[len(m.Destinations)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipPlan(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if (skippy < 0) || (iNdEx+skippy) < 0 {
+				return ErrInvalidLengthPlan
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *GRPCSinkOperator_HashShuffleSpec_Destination) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowPlan
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= uint64(b&0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: Destination: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: Destination: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Address", wireType)
+			}
+			var stringLen uint64
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				stringLen |= uint64(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			intStringLen := int(stringLen)
+			if intStringLen < 0 {
+				return ErrInvalidLengthPlan
+			}
+			postIndex := iNdEx + intStringLen
+			if postIndex < 0 {
+				return ErrInvalidLengthPlan
+			}
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Address = string(dAtA[iNdEx:postIndex])
+			iNdEx = postIndex
+		case 2:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field GRPCSourceID", wireType)
+			}
+			m.GRPCSourceID = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.GRPCSourceID |= uint64(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 3:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field SslTargetname", wireType)
+			}
+			var stringLen uint64
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				stringLen |= uint64(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			intStringLen := int(stringLen)
+			if intStringLen < 0 {
+				return ErrInvalidLengthPlan
+			}
+			postIndex := iNdEx + intStringLen
+			if postIndex < 0 {
+				return ErrInvalidLengthPlan
+			}
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.SslTargetname = string(dAtA[iNdEx:postIndex])
+			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipPlan(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if (skippy < 0) || (iNdEx+skippy) < 0 {
+				return ErrInvalidLengthPlan
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
 func (m *MapOperator) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
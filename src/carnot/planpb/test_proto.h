@@ -137,6 +137,15 @@ column_names: "usage"
 streaming: false
 )";
 
+constexpr char kSampledMemSourceOperator1[] = R"(
+name: "$0"
+column_idxs: 1
+column_types: FLOAT64
+column_names: "usage"
+streaming: false
+sample_every_n: 2
+)";
+
 constexpr char kStreamingMemSourceOperator1[] = R"(
 name: "$0"
 column_idxs: 1
@@ -1328,6 +1337,15 @@ planpb::Operator CreateTestSource1PB(const std::string& table_name = "cpu") {
   return op;
 }
 
+planpb::Operator CreateTestSampledSource1PB(const std::string& table_name = "cpu") {
+  planpb::Operator op;
+  auto mem_proto = absl::Substitute(kSampledMemSourceOperator1, table_name);
+  auto op_proto =
+      absl::Substitute(kOperatorProtoTmpl, "MEMORY_SOURCE_OPERATOR", "mem_source_op", mem_proto);
+  CHECK(google::protobuf::TextFormat::MergeFromString(op_proto, &op)) << "Failed to parse proto";
+  return op;
+}
+
 planpb::Operator CreateTestStreamingSource1PB(const std::string& table_name = "cpu") {
   planpb::Operator op;
   auto mem_proto = absl::Substitute(kStreamingMemSourceOperator1, table_name);
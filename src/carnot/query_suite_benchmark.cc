@@ -0,0 +1,166 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include <sys/resource.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sole.hpp>
+
+#include "src/carnot/carnot.h"
+#include "src/carnot/exec/local_grpc_result_server.h"
+#include "src/carnot/exec/test_utils.h"
+#include "src/carnot/funcs/funcs.h"
+#include "src/common/base/base.h"
+#include "src/common/benchmark/benchmark.h"
+#include "src/datagen/datagen.h"
+#include "src/table_store/test_utils.h"
+
+// End-to-end query benchmark suite: a canonical set of observability-shaped PXL queries run
+// through the whole engine (compiler, planner, exec graph) against generated data in a
+// TableStore. This is the yardstick for engine-level improvements; the per-operator benchmarks
+// (e.g. blocking_agg_benchmark) isolate individual nodes instead.
+//
+// Each benchmark reports rows/sec (items_per_second, from the engine's records_processed stat)
+// and peak_rss_mb. Note that peak RSS is a process-wide high-water mark, so it is only
+// meaningful for the benchmarks run in this invocation up to that point; use
+// --benchmark_filter to measure one query's footprint in isolation.
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+using table_store::schema::RowDescriptor;
+
+// Service dependency rollup: aggregate request counts and mean latency per service, then join
+// the two rollups on the service key. Exercises blocking aggs feeding an equijoin.
+constexpr char kServiceMapJoinQuery[] = R"pxl(
+import px
+requests = px.DataFrame(table='http_events', select=['service', 'latency_ms'])
+counts = requests.groupby('service').agg(request_count=('latency_ms', px.count))
+latency = requests.groupby('service').agg(mean_latency=('latency_ms', px.mean))
+edges = counts.merge(latency, how='inner', left_on=['service'], right_on=['service'], suffixes=['', '_x'])
+df = edges[['service', 'request_count', 'mean_latency']]
+px.display(df, '$0')
+)pxl";
+
+// Latency percentile rollup per service via the t-digest quantiles UDA.
+constexpr char kP99LatencyRollupQuery[] = R"pxl(
+import px
+df = px.DataFrame(table='http_events', select=['service', 'latency_ms'])
+df = df.groupby('service').agg(latency_dist=('latency_ms', px.quantiles))
+df.latency_p99 = px.pluck_float64(df.latency_dist, 'p99')
+df = df[['service', 'latency_p99']]
+px.display(df, '$0')
+)pxl";
+
+// Heaviest endpoints of a high-cardinality path column via the space-saving top-k UDA.
+constexpr char kTopKEndpointsQuery[] = R"pxl(
+import px
+df = px.DataFrame(table='http_events', select=['req_path'])
+df = df.agg(top_endpoints=('req_path', px.topk))
+px.display(df, '$0')
+)pxl";
+
+std::unique_ptr<Carnot> SetUpCarnot(std::shared_ptr<table_store::TableStore> table_store,
+                                    LocalGRPCResultSinkServer* server) {
+  auto func_registry = std::make_unique<px::carnot::udf::Registry>("default_registry");
+  funcs::RegisterFuncsOrDie(func_registry.get());
+  auto clients_config = std::make_unique<Carnot::ClientsConfig>(Carnot::ClientsConfig{
+      [server](const std::string& address, const std::string&) {
+        return server->StubGenerator(address);
+      },
+      [](grpc::ClientContext*) {},
+  });
+  auto server_config = std::make_unique<Carnot::ServerConfig>();
+  server_config->grpc_server_port = 0;
+
+  return px::carnot::Carnot::Create(sole::uuid4(), std::move(func_registry), table_store,
+                                    std::move(clients_config), std::move(server_config))
+      .ConsumeValueOrDie();
+}
+
+double PeakRSSMegabytes() {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+  // ru_maxrss is in kilobytes on Linux.
+  return static_cast<double>(usage.ru_maxrss) / 1024.0;
+}
+
+// NOLINTNEXTLINE : runtime/references.
+void BM_QuerySuite(benchmark::State& state, const std::string& query, int64_t num_batches) {
+  auto table_store = std::make_shared<table_store::TableStore>();
+  auto server = LocalGRPCResultSinkServer();
+  auto carnot = SetUpCarnot(table_store, &server);
+
+  // A request-log shaped table: a low-cardinality (zipfian) service column, a high-cardinality
+  // (zipfian) request path column, and a uniform integer latency column.
+  const datagen::ZipfianParams service_params{2, 2, 99};
+  const datagen::UniformParams len_params{8, 64};
+  auto table =
+      table_store::CreateTable({"service", "req_path", "latency_ms"},
+                               {types::DataType::STRING, types::DataType::STRING,
+                                types::DataType::INT64},
+                               {datagen::DistributionType::kZipfian,
+                                datagen::DistributionType::kZipfian,
+                                datagen::DistributionType::kUniform},
+                               state.range(0), num_batches, &service_params, &len_params)
+          .ConsumeValueOrDie();
+  table_store->AddTable("http_events", table);
+
+  int64_t rows_processed = 0;
+  int64_t bytes_processed = 0;
+  int i = 0;
+  for (auto _ : state) {
+    auto query_with_table_name = absl::Substitute(query, "results_" + std::to_string(i));
+    auto res = carnot->ExecuteQuery(query_with_table_name, sole::uuid4(), CurrentTimeNS());
+    if (!res.ok()) {
+      LOG(FATAL) << absl::Substitute("Benchmark query failed: $0", res.msg());
+    }
+    auto exec_stats = server.exec_stats().ConsumeValueOrDie();
+    rows_processed += exec_stats.execution_stats().records_processed();
+    bytes_processed += exec_stats.execution_stats().bytes_processed();
+    server.ResetQueryResults();
+    ++i;
+  }
+
+  state.SetItemsProcessed(rows_processed);
+  state.SetBytesProcessed(bytes_processed);
+  state.counters["peak_rss_mb"] = PeakRSSMegabytes();
+}
+
+BENCHMARK_CAPTURE(BM_QuerySuite, service_map_join, kServiceMapJoinQuery, 20)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 16);
+
+BENCHMARK_CAPTURE(BM_QuerySuite, p99_latency_rollup, kP99LatencyRollupQuery, 20)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 16);
+
+BENCHMARK_CAPTURE(BM_QuerySuite, topk_endpoints, kTopKEndpointsQuery, 20)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 16);
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -19,8 +19,13 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
+
 #include "src/carnot/udf/model_pool.h"
 #include "src/shared/metadata/metadata_state.h"
 #include "src/shared/types/types.h"
@@ -29,6 +34,49 @@ namespace px {
 namespace carnot {
 namespace udf {
 
+/**
+ * Bounded per-context pool for string results produced by UDFs. Funcs returning low-cardinality
+ * strings (service names, normalized paths, formatted constants) see the same handful of inputs
+ * millions of times per query; the pool lets them compute each distinct result once and serve
+ * repeats from the pooled entry with a hash lookup. Keys are namespaced by a caller-supplied tag
+ * so UDFs sharing a context cannot collide. Once full, results pass through uncached, so
+ * high-cardinality data degrades to per-row computation instead of unbounded growth.
+ * A FunctionContext is used from a single exec thread, so the pool is unsynchronized.
+ */
+class StringInternPool {
+ public:
+  static constexpr size_t kMaxEntries = 4096;
+
+  /**
+   * Returns the pooled result for the given input, running compute to produce it the first time
+   * this (tag, input) pair is seen.
+   */
+  template <typename TCompute>
+  types::StringValue InternOrCompute(std::string_view tag, const types::StringValue& input,
+                                     TCompute&& compute) {
+    key_buffer_.clear();
+    key_buffer_.append(tag);
+    key_buffer_.push_back('\x1f');
+    key_buffer_.append(input);
+    auto it = results_.find(key_buffer_);
+    if (it != results_.end()) {
+      return it->second;
+    }
+    types::StringValue result = compute();
+    if (results_.size() < kMaxEntries) {
+      results_.emplace(key_buffer_, result);
+    }
+    return result;
+  }
+
+  size_t size() const { return results_.size(); }
+
+ private:
+  // Reused across calls to build lookup keys without a per-row allocation.
+  std::string key_buffer_;
+  absl::flat_hash_map<std::string, types::StringValue> results_;
+};
+
 /**
  * Function context contains contextual resources such as mempools that functions
  * can use while executing.
@@ -40,10 +88,12 @@ class FunctionContext {
       : metadata_state_(metadata_state), model_pool_(model_pool) {}
   const px::md::AgentMetadataState* metadata_state() const { return metadata_state_.get(); }
   ModelPool* model_pool() { return model_pool_; }
+  StringInternPool* string_pool() { return &string_pool_; }
 
  private:
   std::shared_ptr<const px::md::AgentMetadataState> metadata_state_;
   ModelPool* model_pool_;
+  StringInternPool string_pool_;
 };
 
 /**
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "src/carnot/udf/base.h"
+
+namespace px {
+namespace carnot {
+namespace udf {
+
+TEST(StringInternPool, computes_each_distinct_input_once) {
+  StringInternPool pool;
+  int compute_count = 0;
+  auto compute = [&]() -> types::StringValue {
+    compute_count++;
+    return "result";
+  };
+
+  EXPECT_EQ("result", pool.InternOrCompute("tag", "input", compute));
+  EXPECT_EQ("result", pool.InternOrCompute("tag", "input", compute));
+  EXPECT_EQ(1, compute_count);
+  EXPECT_EQ(1, pool.size());
+
+  EXPECT_EQ("result", pool.InternOrCompute("tag", "other_input", compute));
+  EXPECT_EQ(2, compute_count);
+}
+
+TEST(StringInternPool, tags_namespace_the_keys) {
+  StringInternPool pool;
+  auto lower = pool.InternOrCompute("lower", "IN", [&]() -> types::StringValue { return "in"; });
+  auto upper = pool.InternOrCompute("upper", "IN", [&]() -> types::StringValue { return "IN"; });
+  EXPECT_EQ("in", lower);
+  EXPECT_EQ("IN", upper);
+}
+
+TEST(StringInternPool, passes_through_uncached_once_full) {
+  StringInternPool pool;
+  for (size_t i = 0; i < StringInternPool::kMaxEntries; i++) {
+    pool.InternOrCompute("tag", std::to_string(i),
+                         [&]() -> types::StringValue { return std::to_string(i); });
+  }
+  EXPECT_EQ(StringInternPool::kMaxEntries, pool.size());
+
+  // Results past the budget still compute correctly but aren't retained.
+  EXPECT_EQ("overflow", pool.InternOrCompute("tag", "overflow",
+                                             [&]() -> types::StringValue { return "overflow"; }));
+  EXPECT_EQ(StringInternPool::kMaxEntries, pool.size());
+}
+
+}  // namespace udf
+}  // namespace carnot
+}  // namespace px
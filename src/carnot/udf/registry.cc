@@ -190,11 +190,11 @@ StatusOr<ScalarUDFDefinition*> Registry::GetScalarUDFDefinition(
 StatusOr<UDFDefinition*> Registry::GetDefinition(
     const std::string& name, const std::vector<types::DataType>& registry_arg_types) const {
   auto key = RegistryKey(name, registry_arg_types);
-  auto it = map_.find(key);
-  if (it == map_.end()) {
+  auto it = lookup_index_.find(key);
+  if (it == lookup_index_.end()) {
     return error::NotFound("No UDF matching $0 found.", key.DebugString());
   }
-  return it->second.get();
+  return it->second;
 }
 
 }  // namespace udf
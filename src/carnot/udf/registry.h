@@ -24,6 +24,7 @@
 #include <utility>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/strings/str_format.h>
 
 #include "src/carnot/udf/doc.h"
@@ -69,6 +70,15 @@ class RegistryKey {
    */
   bool operator<(const RegistryKey& lhs) const;
 
+  bool operator==(const RegistryKey& other) const {
+    return name_ == other.name_ && registry_arg_types_ == other.registry_arg_types_;
+  }
+
+  template <typename H>
+  friend H AbslHashValue(H h, const RegistryKey& key) {
+    return H::combine(std::move(h), key.name_, key.registry_arg_types_);
+  }
+
  protected:
   std::string name_;
   std::vector<types::DataType> registry_arg_types_;
@@ -121,6 +131,7 @@ class Registry {
           "The UDF with name \"$0\" already exists with the same arg types \"$1\".", name,
           key.DebugString());
     }
+    lookup_index_[key] = udf_def.get();
     map_[key] = std::move(udf_def);
     RegisterSemanticTypes<T>(name);
 
@@ -192,6 +203,7 @@ class Registry {
           "The UDTF with name \"$0\" already exists with same exec args \"$1\".", name,
           key.DebugString());
     }
+    lookup_index_[key] = udf_def.get();
     map_[key] = std::move(udf_def);
     return Status::OK();
   }
@@ -239,6 +251,11 @@ class Registry {
 
   std::string name_;
   RegistryMap map_;
+  // Hash index over map_ used on the lookup path; map_ stays the canonical ordered store so
+  // DebugString/ToProto output remains deterministic. Plan instantiation resolves every func in
+  // a plan by name+types, so for high-QPS small queries the O(log n) string compares of the
+  // ordered map showed up in profiles.
+  absl::flat_hash_map<RegistryKey, UDFDefinition*> lookup_index_;
   std::map<std::string, ExplicitRuleSet> semantic_type_rules_;
   udfspb::Docs docs_pb_;
 };
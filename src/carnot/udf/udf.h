@@ -74,6 +74,14 @@ class AnyUDA : public BaseFunc {
  *      Status Init(FunctionContext *ctx, UDFValue... init_args) {}
  *  This function is called once during initialization of each instance (many instances
  *  may exists in a given query). The arguments are as provided by the query.
+ *
+ * It can also _optionally_ implement a vectorized version of Exec:
+ *      Status ExecBatch(FunctionContext *ctx, size_t count, RetValue* out, const UDFValue*...) {}
+ *  The argument and return value types must match those of Exec, with each argument passed as a
+ *  pointer to a contiguous array of count values and the results written through out. When
+ *  present, the expression evaluator calls it with whole columns instead of looping over Exec
+ *  row by row, which lets the implementation be written as a tight (auto-vectorizable) loop.
+ *  The results must match what repeated calls to Exec would produce.
  */
 class ScalarUDF : public AnyUDF {
  public:
@@ -143,6 +151,33 @@ static constexpr bool IsValidExecFunc(ReturnType (TUDF::*)(FunctionContext*, Typ
   return true;
 }
 
+/**
+ * Checks to see if a valid looking ExecBatch function exists.
+ * Like IsValidInitFn, this only validates the shape of the function; argument and return value
+ * types that don't line up with Exec fail to compile at the wrapper's call site.
+ */
+template <typename ReturnType, typename TUDF, typename... Types>
+static constexpr bool IsValidExecBatchFn(ReturnType (TUDF::*)(Types...)) {
+  return false;
+}
+
+template <typename TUDF, typename ReturnType, typename... Types>
+static constexpr bool IsValidExecBatchFn(Status (TUDF::*)(FunctionContext*, size_t, ReturnType*,
+                                                          const Types*...)) {
+  return true;
+}
+
+// SFINAE test for vectorized exec fn.
+template <typename T, typename = void>
+struct has_udf_exec_batch_fn : std::false_type {};
+
+template <typename T>
+struct has_udf_exec_batch_fn<T, std::void_t<decltype(&T::ExecBatch)>> : std::true_type {
+  static_assert(IsValidExecBatchFn(&T::ExecBatch),
+                "If an ExecBatch function exists, it must have the form: Status "
+                "ExecBatch(FunctionContext*, size_t count, RetValue* out, const ArgValue*...)");
+};
+
 /**
  * Checks to see if a valid looking Executor function exists.
  */
@@ -223,6 +258,12 @@ class ScalarUDFTraits {
    */
   static constexpr bool HasInit() { return has_udf_init_fn<T>::value; }
 
+  /**
+   * Checks if the UDF has a vectorized ExecBatch function that processes a whole column per call.
+   * @return true if it has an ExecBatch function.
+   */
+  static constexpr bool HasExecBatch() { return has_udf_exec_batch_fn<T>::value; }
+
   /**
    * Returns the executor type of this UDF.
    */
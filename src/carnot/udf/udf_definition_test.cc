@@ -52,6 +52,20 @@ class AddUDF : public ScalarUDF {
   }
 };
 
+class VectorizedAddUDF : public ScalarUDF {
+ public:
+  types::Int64Value Exec(FunctionContext*, types::Int64Value v1, types::Int64Value v2) {
+    return v1.val + v2.val;
+  }
+  Status ExecBatch(FunctionContext*, size_t count, types::Int64Value* out,
+                   const types::Int64Value* v1, const types::Int64Value* v2) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = v1[i].val + v2[i].val;
+    }
+    return Status::OK();
+  }
+};
+
 class InitArgUDF : public ScalarUDF {
  public:
   Status Init(FunctionContext*, types::StringValue str, types::Int64Value i) {
@@ -137,6 +151,45 @@ TEST(UDFDefinition, arrow_write) {
   EXPECT_EQ(6, resArr->Value(1));
 }
 
+TEST(UDFDefinition, vectorized_exec_batch) {
+  auto ctx = FunctionContext(nullptr, nullptr);
+  ScalarUDFDefinition def("vec_add");
+  EXPECT_OK(def.Init<VectorizedAddUDF>());
+
+  types::Int64ValueColumnWrapper v1({1, 2, 3});
+  types::Int64ValueColumnWrapper v2({3, 4, 5});
+
+  types::Int64ValueColumnWrapper out(v1.Size());
+  auto u = def.Make();
+  EXPECT_TRUE(def.ExecBatch(u.get(), &ctx, {&v1, &v2}, &out, v1.Size()).ok());
+  EXPECT_EQ(4, out[0].val);
+  EXPECT_EQ(6, out[1].val);
+  EXPECT_EQ(8, out[2].val);
+}
+
+TEST(UDFDefinition, vectorized_exec_batch_arrow) {
+  auto ctx = FunctionContext(nullptr, nullptr);
+  std::vector<types::Int64Value> v1 = {1, 2, 3};
+  std::vector<types::Int64Value> v2 = {3, 4, 5};
+
+  auto v1a = ToArrow(v1, arrow::default_memory_pool());
+  auto v2a = ToArrow(v2, arrow::default_memory_pool());
+
+  auto output_builder = std::make_shared<arrow::Int64Builder>();
+  auto u = std::make_shared<VectorizedAddUDF>();
+  EXPECT_TRUE(ScalarUDFWrapper<VectorizedAddUDF>::ExecBatchArrow(u.get(), &ctx,
+                                                                 {v1a.get(), v2a.get()},
+                                                                 output_builder.get(), 3)
+                  .ok());
+
+  std::shared_ptr<arrow::Array> res;
+  EXPECT_TRUE(output_builder->Finish(&res).ok());
+  auto* resArr = static_cast<arrow::Int64Array*>(res.get());
+  EXPECT_EQ(4, resArr->Value(0));
+  EXPECT_EQ(6, resArr->Value(1));
+  EXPECT_EQ(8, resArr->Value(2));
+}
+
 TEST(UDFDefinition, init_args) {
   auto ctx = FunctionContext(nullptr, nullptr);
   ScalarUDFDefinition def("initargudf");
@@ -43,12 +43,26 @@ class ScalarUDF1WithInit : ScalarUDF {
   types::Int64Value Exec(FunctionContext*, types::BoolValue, types::BoolValue) { return 0; }
 };
 
+class ScalarUDF1WithExecBatch : ScalarUDF {
+ public:
+  types::Int64Value Exec(FunctionContext*, types::Int64Value v) { return v.val + 1; }
+  Status ExecBatch(FunctionContext*, size_t count, types::Int64Value* out,
+                   const types::Int64Value* v) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = v[i].val + 1;
+    }
+    return Status::OK();
+  }
+};
+
 TEST(ScalarUDF, basic_tests) {
   EXPECT_EQ(types::DataType::INT64, ScalarUDFTraits<ScalarUDF1>::ReturnType());
   EXPECT_THAT(ScalarUDFTraits<ScalarUDF1>::ExecArguments(),
               ElementsAre(types::DataType::BOOLEAN, types::DataType::INT64));
   EXPECT_FALSE(ScalarUDFTraits<ScalarUDF1>::HasInit());
   EXPECT_TRUE(ScalarUDFTraits<ScalarUDF1WithInit>::HasInit());
+  EXPECT_FALSE(ScalarUDFTraits<ScalarUDF1>::HasExecBatch());
+  EXPECT_TRUE(ScalarUDFTraits<ScalarUDF1WithExecBatch>::HasExecBatch());
 }
 
 TEST(UDFDataTypes, valid_tests) {
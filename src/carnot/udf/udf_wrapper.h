@@ -22,6 +22,8 @@
 
 #include <memory>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "src/carnot/udf/udf.h"
@@ -54,7 +56,8 @@ constexpr auto CastToUDFValueType(const types::BaseValueType* arg) {
  * based on the type and arity of the input arguments.
  *
  * This function takes calls the Exec function of the UDF after type casting all the
- * input values. The function is called once for each row of the input batch.
+ * input values. The function is called once for each row of the input batch. If the UDF
+ * implements a vectorized ExecBatch, that is called once with the whole batch instead.
  *
  * @return Status of execution.
  */
@@ -63,10 +66,14 @@ Status ExecWrapper(TUDF* udf, FunctionContext* ctx, size_t count, TOutput* out,
                    const std::vector<const types::BaseValueType*>& args,
                    std::index_sequence<I...>) {
   [[maybe_unused]] constexpr auto exec_argument_types = ScalarUDFTraits<TUDF>::ExecArguments();
-  for (size_t idx = 0; idx < count; ++idx) {
-    out[idx] = udf->Exec(ctx, CastToUDFValueType<exec_argument_types[I]>(args[I])[idx]...);
+  if constexpr (ScalarUDFTraits<TUDF>::HasExecBatch()) {
+    return udf->ExecBatch(ctx, count, out, CastToUDFValueType<exec_argument_types[I]>(args[I])...);
+  } else {
+    for (size_t idx = 0; idx < count; ++idx) {
+      out[idx] = udf->Exec(ctx, CastToUDFValueType<exec_argument_types[I]>(args[I])[idx]...);
+    }
+    return Status::OK();
   }
-  return Status::OK();
 }
 
 template <typename TUDF, std::size_t... I>
@@ -85,52 +92,100 @@ Status UDAInitWrapper(TUDA* udf, FunctionContext* ctx,
   return udf->Init(ctx, *CastToUDFValueType<init_argument_types[I]>(args[I].get())...);
 }
 
-// Returns the underlying data from a UDF value.
+// Returns the underlying data from a UDF value. For strings this is a reference to the value
+// itself, so no copy is made; the value must stay alive while the result is in use.
 template <typename T>
-inline auto UnWrap(const T& v) {
+inline decltype(auto) UnWrap(const T& v) {
   return v.val;
 }
 
 template <>
-inline auto UnWrap<types::StringValue>(const types::StringValue& s) {
+inline decltype(auto) UnWrap<types::StringValue>(const types::StringValue& s) {
   return s;
 }
 
+/**
+ * Copies an arrow array into a contiguous array of UDF values, so that a vectorized
+ * ExecBatch sees the same layout as the ColumnWrapper path.
+ */
+template <types::DataType TDataType>
+std::vector<typename types::DataTypeTraits<TDataType>::value_type> StageArrowArray(
+    const arrow::Array* arr, size_t count) {
+  std::vector<typename types::DataTypeTraits<TDataType>::value_type> staged(count);
+  for (size_t idx = 0; idx < count; ++idx) {
+    staged[idx] = types::GetValueFromArrowArray<TDataType>(arr, idx);
+  }
+  return staged;
+}
+
+/**
+ * The vectorized variant of the arrow wrapper: the inputs are staged into contiguous value
+ * arrays, the UDF's ExecBatch runs once over the whole batch, and the results are appended to
+ * the builder in bulk. Staging is a straight copy of the values, comparable to what the
+ * per-row loop already pays to pluck each value out of the arrow arrays.
+ */
+template <typename TUDF, typename TOutput, std::size_t... I>
+Status ExecBatchWrapperArrow(TUDF* udf, FunctionContext* ctx, size_t count, TOutput* out,
+                             const std::vector<arrow::Array*>& args, std::index_sequence<I...>) {
+  [[maybe_unused]] constexpr auto exec_argument_types = ScalarUDFTraits<TUDF>::ExecArguments();
+  constexpr types::DataType return_type = ScalarUDFTraits<TUDF>::ReturnType();
+  auto staged_args = std::make_tuple(StageArrowArray<exec_argument_types[I]>(args[I], count)...);
+  PX_UNUSED(staged_args);
+  std::vector<typename types::DataTypeTraits<return_type>::value_type> out_values(count);
+  PX_RETURN_IF_ERROR(
+      udf->ExecBatch(ctx, count, out_values.data(), std::get<I>(staged_args).data()...));
+  CHECK(out->Reserve(count).ok());
+  for (size_t idx = 0; idx < count; ++idx) {
+    out->UnsafeAppend(UnWrap(out_values[idx]));
+  }
+  return Status::OK();
+}
+
 /**
  * This is the inner wrapper for the arrow type.
  * This performs type casting and storing the data in the output builder.
+ * UDFs with a vectorized ExecBatch are dispatched to it, except for string outputs, which
+ * need the builder's incremental data reservation below.
  */
 template <typename TUDF, typename TOutput, std::size_t... I>
 Status ExecWrapperArrow(TUDF* udf, FunctionContext* ctx, size_t count, TOutput* out,
                         const std::vector<arrow::Array*>& args, std::index_sequence<I...>) {
   [[maybe_unused]] static constexpr auto exec_argument_types =
       ScalarUDFTraits<TUDF>::ExecArguments();
-  CHECK(out->Reserve(count).ok());
-  size_t reserved = count * kStringAssumedSizeHeuristic;
-  size_t total_size = 0;
-  // If it's a string type we also need to allocate memory for the data.
-  // This actually applies to all non-fixed data allocations.
-  // PX_CARNOT_UPDATE_FOR_NEW_TYPES.
-  if constexpr (std::is_same_v<arrow::StringBuilder, TOutput>) {
-    CHECK(out->ReserveData(reserved).ok());
-  }
-  for (size_t idx = 0; idx < count; ++idx) {
-    auto res = UnWrap(
-        udf->Exec(ctx, types::GetValueFromArrowArray<exec_argument_types[I]>(args[I], idx)...));
-
-    // We use doubling to make sure we minimize the number of allocations.
+  if constexpr (ScalarUDFTraits<TUDF>::HasExecBatch() &&
+                !std::is_same_v<arrow::StringBuilder, TOutput>) {
+    return ExecBatchWrapperArrow<TUDF>(udf, ctx, count, out, args, std::index_sequence<I...>{});
+  } else {
+    CHECK(out->Reserve(count).ok());
+    size_t reserved = count * kStringAssumedSizeHeuristic;
+    size_t total_size = 0;
+    // If it's a string type we also need to allocate memory for the data.
+    // This actually applies to all non-fixed data allocations.
     // PX_CARNOT_UPDATE_FOR_NEW_TYPES.
     if constexpr (std::is_same_v<arrow::StringBuilder, TOutput>) {
-      total_size += res.size();
-      while (total_size >= reserved) {
-        reserved *= 2;
-        PX_RETURN_IF_ERROR(out->ReserveData(reserved));
+      CHECK(out->ReserveData(reserved).ok());
+    }
+    for (size_t idx = 0; idx < count; ++idx) {
+      // Keep the Exec result alive and unwrap by reference, so string outputs are not copied
+      // on their way into the builder.
+      auto v =
+          udf->Exec(ctx, types::GetValueFromArrowArray<exec_argument_types[I]>(args[I], idx)...);
+      const auto& res = UnWrap(v);
+
+      // We use doubling to make sure we minimize the number of allocations.
+      // PX_CARNOT_UPDATE_FOR_NEW_TYPES.
+      if constexpr (std::is_same_v<arrow::StringBuilder, TOutput>) {
+        total_size += res.size();
+        while (total_size >= reserved) {
+          reserved *= 2;
+          PX_RETURN_IF_ERROR(out->ReserveData(reserved));
+        }
       }
+      // This function is "safe" now because we manually allocated memory.
+      out->UnsafeAppend(res);
     }
-    // This function is "safe" now because we manually allocated memory.
-    out->UnsafeAppend(res);
+    return Status::OK();
   }
-  return Status::OK();
 }
 
 /**
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 #include <utility>
 
@@ -34,6 +35,25 @@ namespace px {
  * @tparam TEnumType The enum to encode into the map representation.
  * @return A map that defines the enum declaration.
  */
+/**
+ * Compile-time variant of EnumDefToMap(): converts an enum definition to a constexpr array of
+ * (value, name) pairs. Unlike the map version, the result requires no dynamic initialization,
+ * so it is suitable for static metadata (e.g. column enum decoders in table schemas).
+ *
+ * @tparam TEnumType The enum to encode into the array representation.
+ * @return An array of (value, name) pairs that defines the enum declaration.
+ */
+template <typename TEnumType>
+constexpr auto EnumDefToArray() {
+  constexpr auto entries = magic_enum::enum_entries<TEnumType>();
+  std::array<std::pair<int64_t, std::string_view>, entries.size()> result{};
+  for (size_t i = 0; i < entries.size(); ++i) {
+    result[i].first = static_cast<int64_t>(entries[i].first);
+    result[i].second = entries[i].second;
+  }
+  return result;
+}
+
 template <typename TEnumType>
 std::map<int64_t, std::string_view> EnumDefToMap() {
   constexpr int kEnumCount = magic_enum::enum_count<TEnumType>();
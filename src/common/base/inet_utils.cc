@@ -310,4 +310,59 @@ CIDRBlock MapIPv4ToIPv6(const CIDRBlock& addr) {
   return CIDRBlock{MapIPv4ToIPv6(addr.ip_addr), kBitPrefixLen + addr.prefix_length};
 }
 
+namespace {
+
+// Returns bit i (0 = most significant) of an IPv6 address.
+int IPv6AddrBit(const struct in6_addr& addr, size_t i) {
+  return (addr.s6_addr[i / 8] >> (7 - (i % 8))) & 1;
+}
+
+}  // namespace
+
+void CIDRTrieSet::Insert(const CIDRBlock& block) {
+  CIDRBlock block6 = (block.ip_addr.family == InetAddrFamily::kIPv4) ? MapIPv4ToIPv6(block) : block;
+  DCHECK(block6.ip_addr.family == InetAddrFamily::kIPv6);
+  const auto& addr = std::get<struct in6_addr>(block6.ip_addr.addr);
+
+  int32_t node = 0;
+  for (size_t i = 0; i < block6.prefix_length; ++i) {
+    int bit = IPv6AddrBit(addr, i);
+    if (nodes_[node].child[bit] == -1) {
+      nodes_[node].child[bit] = static_cast<int32_t>(nodes_.size());
+      nodes_.emplace_back();
+    }
+    node = nodes_[node].child[bit];
+  }
+  if (!nodes_[node].terminal) {
+    nodes_[node].terminal = true;
+    ++num_cidrs_;
+  }
+}
+
+bool CIDRTrieSet::ContainsIPAddr(const InetAddr& ip_addr) const {
+  InetAddr ip_addr6 = (ip_addr.family == InetAddrFamily::kIPv4) ? MapIPv4ToIPv6(ip_addr) : ip_addr;
+  if (ip_addr6.family != InetAddrFamily::kIPv6) {
+    return false;
+  }
+  const auto& addr = std::get<struct in6_addr>(ip_addr6.addr);
+
+  int32_t node = 0;
+  for (int i = 0; i < kIPv6BitLen; ++i) {
+    if (nodes_[node].terminal) {
+      return true;
+    }
+    int bit = IPv6AddrBit(addr, i);
+    node = nodes_[node].child[bit];
+    if (node == -1) {
+      return false;
+    }
+  }
+  return nodes_[node].terminal;
+}
+
+void CIDRTrieSet::clear() {
+  nodes_.assign(1, Node{});
+  num_cidrs_ = 0;
+}
+
 }  // namespace px
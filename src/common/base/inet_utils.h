@@ -30,6 +30,7 @@
 #include <string>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "src/common/base/enum_utils.h"
 #include "src/common/base/error.h"
@@ -117,8 +118,7 @@ struct CIDRBlock {
 };
 
 enum class SockAddrFamily { kUnspecified, kIPv4, kIPv6, kUnix, kOther };
-static const std::map<int64_t, std::string_view> kSockAddrFamilyDecoder =
-    px::EnumDefToMap<SockAddrFamily>();
+constexpr auto kSockAddrFamilyDecoder = px::EnumDefToArray<SockAddrFamily>();
 
 struct SockAddrUnix {
   std::string path;
@@ -259,4 +259,40 @@ bool CIDRContainsIPAddr(const CIDRBlock& block, const InetAddr& ip_addr);
  */
 CIDRBlock MapIPv4ToIPv6(const CIDRBlock& addr);
 
+/**
+ * CIDRTrieSet indexes a set of CIDR blocks in a binary (bitwise) trie for longest-prefix-match
+ * containment checks. A lookup walks at most one address worth of bits regardless of how many
+ * blocks are indexed, vs. the O(blocks) cost of calling CIDRContainsIPAddr in a loop.
+ *
+ * IPv4 blocks and addresses are indexed in their IPv4-mapped IPv6 form, so mixed-family checks
+ * behave the same as CIDRContainsIPAddr.
+ */
+class CIDRTrieSet {
+ public:
+  /**
+   * Insert adds a CIDR block to the set.
+   */
+  void Insert(const CIDRBlock& block);
+
+  /**
+   * ContainsIPAddr returns true if any inserted block contains the given address.
+   */
+  bool ContainsIPAddr(const InetAddr& addr) const;
+
+  void clear();
+
+  size_t num_cidrs() const { return num_cidrs_; }
+
+ private:
+  // A trie node; children index into nodes_, -1 if absent. A terminal node marks the end of an
+  // inserted prefix.
+  struct Node {
+    int32_t child[2] = {-1, -1};
+    bool terminal = false;
+  };
+
+  std::vector<Node> nodes_ = std::vector<Node>(1);
+  size_t num_cidrs_ = 0;
+};
+
 }  // namespace px
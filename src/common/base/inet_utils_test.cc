@@ -276,4 +276,87 @@ TEST(MapIPv4ToIPv6Test, WorksAsExpected) {
   }
 }
 
+TEST(CIDRTrieSet, ipv4) {
+  CIDRTrieSet trie;
+  EXPECT_EQ(0, trie.num_cidrs());
+
+  CIDRBlock cidr;
+  ASSERT_OK(ParseCIDRBlock("10.64.0.0/16", &cidr));
+  trie.Insert(cidr);
+  ASSERT_OK(ParseCIDRBlock("192.168.1.0/24", &cidr));
+  trie.Insert(cidr);
+  EXPECT_EQ(2, trie.num_cidrs());
+
+  InetAddr addr;
+  ASSERT_OK(ParseIPAddress("10.64.5.1", &addr));
+  EXPECT_TRUE(trie.ContainsIPAddr(addr));
+  ASSERT_OK(ParseIPAddress("10.65.5.1", &addr));
+  EXPECT_FALSE(trie.ContainsIPAddr(addr));
+  ASSERT_OK(ParseIPAddress("192.168.1.255", &addr));
+  EXPECT_TRUE(trie.ContainsIPAddr(addr));
+  ASSERT_OK(ParseIPAddress("192.168.2.0", &addr));
+  EXPECT_FALSE(trie.ContainsIPAddr(addr));
+
+  trie.clear();
+  EXPECT_EQ(0, trie.num_cidrs());
+  ASSERT_OK(ParseIPAddress("10.64.5.1", &addr));
+  EXPECT_FALSE(trie.ContainsIPAddr(addr));
+}
+
+TEST(CIDRTrieSet, ipv6) {
+  CIDRTrieSet trie;
+
+  CIDRBlock cidr;
+  ASSERT_OK(ParseCIDRBlock("1111:1112:1113:1114::/64", &cidr));
+  trie.Insert(cidr);
+
+  InetAddr addr;
+  ASSERT_OK(ParseIPAddress("1111:1112:1113:1114:1115:1116:1117:1118", &addr));
+  EXPECT_TRUE(trie.ContainsIPAddr(addr));
+  ASSERT_OK(ParseIPAddress("1111:1112:1113:1115:1115:1116:1117:1118", &addr));
+  EXPECT_FALSE(trie.ContainsIPAddr(addr));
+}
+
+TEST(CIDRTrieSet, mixed_families) {
+  CIDRTrieSet trie;
+
+  // An IPv4 block matches the IPv4-mapped IPv6 form of the same addresses, and vice versa,
+  // mirroring CIDRContainsIPAddr.
+  CIDRBlock cidr;
+  ASSERT_OK(ParseCIDRBlock("1.2.3.4/32", &cidr));
+  trie.Insert(cidr);
+
+  InetAddr addr;
+  ASSERT_OK(ParseIPAddress("::ffff:1.2.3.4", &addr));
+  EXPECT_TRUE(trie.ContainsIPAddr(addr));
+
+  ASSERT_OK(ParseCIDRBlock("::ffff:5.6.7.0/120", &cidr));
+  trie.Insert(cidr);
+  ASSERT_OK(ParseIPAddress("5.6.7.8", &addr));
+  EXPECT_TRUE(trie.ContainsIPAddr(addr));
+}
+
+TEST(CIDRTrieSet, nested_prefixes) {
+  CIDRTrieSet trie;
+
+  CIDRBlock cidr;
+  ASSERT_OK(ParseCIDRBlock("10.0.0.0/8", &cidr));
+  trie.Insert(cidr);
+  ASSERT_OK(ParseCIDRBlock("10.1.0.0/16", &cidr));
+  trie.Insert(cidr);
+  EXPECT_EQ(2, trie.num_cidrs());
+
+  InetAddr addr;
+  ASSERT_OK(ParseIPAddress("10.2.0.1", &addr));
+  EXPECT_TRUE(trie.ContainsIPAddr(addr));
+  ASSERT_OK(ParseIPAddress("11.0.0.1", &addr));
+  EXPECT_FALSE(trie.ContainsIPAddr(addr));
+
+  // The /0 block matches everything.
+  ASSERT_OK(ParseCIDRBlock("0.0.0.0/0", &cidr));
+  trie.Insert(cidr);
+  ASSERT_OK(ParseIPAddress("11.0.0.1", &addr));
+  EXPECT_TRUE(trie.ContainsIPAddr(addr));
+}
+
 }  // namespace px
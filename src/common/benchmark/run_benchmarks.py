@@ -0,0 +1,202 @@
+# Copyright 2018- The Pixie Authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""Benchmark regression harness.
+
+Runs every registered benchmark target (cc_binary targets named *_benchmark), collects the
+google/benchmark JSON output into one machine-readable results file, and compares against a
+stored baseline with a configurable regression threshold.
+
+Times are compared in cycles/op (ns/op scaled by the measured CPU frequency) so baselines
+recorded on one machine remain meaningful on another; raw ns/op, bytes/s and user counters are
+preserved in the results file.
+
+Usage (from the workspace root, or via bazel run):
+    bazel run //src/common/benchmark:benchmark_harness
+    bazel run //src/common/benchmark:benchmark_harness -- --update_baselines
+    bazel run //src/common/benchmark:benchmark_harness -- --filter //src/shared/types/...
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+BENCHMARK_QUERY = 'attr(name, ".*_benchmark$", kind(cc_binary, set({scope})))'
+
+# BPF benchmarks need root and a kernel with BTF; they cannot run on the build machines.
+DEFAULT_EXCLUDES = [
+    "//src/stirling/source_connectors/socket_tracer/...",
+]
+
+
+def workspace_root():
+    # Set by `bazel run`; fall back to cwd for direct invocation.
+    return os.environ.get("BUILD_WORKSPACE_DIRECTORY", os.getcwd())
+
+
+def query_benchmark_targets(scope, excludes):
+    query = BENCHMARK_QUERY.format(scope=scope)
+    out = subprocess.check_output(
+        ["bazel", "query", query], cwd=workspace_root(), text=True)
+    targets = [t for t in out.splitlines() if t.strip()]
+
+    def excluded(target):
+        return any(target.startswith(e[: -len("...")]) for e in excludes if e.endswith("..."))
+
+    return sorted(t for t in targets if not excluded(t))
+
+
+def run_benchmark(target):
+    """Runs one benchmark target and returns the parsed google/benchmark JSON."""
+    out_path = os.path.join("/tmp", target.replace("/", "_").replace(":", "_") + ".json")
+    subprocess.check_call(
+        [
+            "bazel",
+            "run",
+            "-c",
+            "opt",
+            target,
+            "--",
+            "--benchmark_format=json",
+            "--benchmark_out=" + out_path,
+        ],
+        cwd=workspace_root(),
+    )
+    with open(out_path) as f:
+        return json.load(f)
+
+
+def to_ns(time, unit):
+    return time * {"ns": 1, "us": 1e3, "ms": 1e6, "s": 1e9}[unit]
+
+
+def normalize_results(target, raw):
+    """Flattens google/benchmark JSON into per-benchmark records with normalized units."""
+    context = raw.get("context", {})
+    mhz = context.get("mhz_per_cpu", 0)
+    records = {}
+    for bm in raw.get("benchmarks", []):
+        if bm.get("run_type") == "aggregate" and bm.get("aggregate_name") != "mean":
+            continue
+        ns_per_op = to_ns(bm["real_time"], bm.get("time_unit", "ns"))
+        record = {
+            "target": target,
+            "ns_per_op": ns_per_op,
+            # Cycles are comparable across machines with different clocks.
+            "cycles_per_op": ns_per_op * mhz / 1e3 if mhz else None,
+            "iterations": bm.get("iterations"),
+        }
+        for key in ("bytes_per_second", "items_per_second"):
+            if key in bm:
+                record[key] = bm[key]
+        # User counters (SetBytesProcessed etc. land above; counters are everything custom).
+        counters = {
+            k: v
+            for k, v in bm.items()
+            if isinstance(v, (int, float)) and k not in record
+            and k not in ("real_time", "cpu_time", "repetition_index", "family_index",
+                          "per_family_instance_index", "threads")
+        }
+        if counters:
+            record["counters"] = counters
+        records[bm["name"]] = record
+    return records
+
+
+def compare(results, baselines, threshold):
+    """Returns (regressions, improvements) vs. the baseline, using cycles/op when available."""
+    regressions = []
+    improvements = []
+    for name, record in results.items():
+        base = baselines.get(name)
+        if base is None:
+            continue
+        metric = "cycles_per_op" if record.get("cycles_per_op") and base.get(
+            "cycles_per_op") else "ns_per_op"
+        if not base.get(metric):
+            continue
+        ratio = record[metric] / base[metric]
+        entry = (name, metric, base[metric], record[metric], ratio)
+        if ratio > 1.0 + threshold:
+            regressions.append(entry)
+        elif ratio < 1.0 - threshold:
+            improvements.append(entry)
+    return regressions, improvements
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--filter", default="//src/...",
+                        help="Target pattern to search for benchmarks.")
+    parser.add_argument("--baselines",
+                        default=os.path.join(workspace_root(),
+                                             "src/common/benchmark/baselines.json"),
+                        help="Path to the stored baseline file.")
+    parser.add_argument("--output", default="/tmp/benchmark_results.json",
+                        help="Where to write the merged machine-readable results.")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="Relative slowdown treated as a regression (0.10 == 10%%).")
+    parser.add_argument("--update_baselines", action="store_true",
+                        help="Overwrite the baseline file with this run's results.")
+    args = parser.parse_args()
+
+    targets = query_benchmark_targets(args.filter, DEFAULT_EXCLUDES)
+    if not targets:
+        print("No benchmark targets found for pattern: " + args.filter)
+        return 1
+
+    results = {}
+    for target in targets:
+        print("Running " + target)
+        results.update(normalize_results(target, run_benchmark(target)))
+
+    with open(args.output, "w") as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+    print("Wrote {} results to {}".format(len(results), args.output))
+
+    if args.update_baselines:
+        with open(args.baselines, "w") as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+        print("Updated baselines at " + args.baselines)
+        return 0
+
+    if not os.path.exists(args.baselines):
+        print("No baseline file at {}; run with --update_baselines to record one.".format(
+            args.baselines))
+        return 0
+
+    with open(args.baselines) as f:
+        baselines = json.load(f)
+
+    regressions, improvements = compare(results, baselines, args.threshold)
+    for name, metric, base, cur, ratio in improvements:
+        print("IMPROVED  {}: {} {:.1f} -> {:.1f} ({:+.1%})".format(
+            name, metric, base, cur, ratio - 1.0))
+    for name, metric, base, cur, ratio in regressions:
+        print("REGRESSED {}: {} {:.1f} -> {:.1f} ({:+.1%})".format(
+            name, metric, base, cur, ratio - 1.0))
+    if regressions:
+        print("{} benchmark(s) regressed beyond the {:.0%} threshold.".format(
+            len(regressions), args.threshold))
+        return 1
+    print("All benchmarks within the {:.0%} threshold.".format(args.threshold))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -51,6 +51,16 @@ class Dispatcher {
    */
   virtual TimerUPtr CreateTimer(TimerCB cb) = 0;
 
+  /**
+   * CreateWheelTimer
+   * Creates a timer on the dispatcher's hashed timer wheel. Create/cancel are O(1) and many
+   * thousands of pending timers share a single underlying loop timer, at the cost of firing with
+   * the wheel's tick granularity instead of millisecond precision. Use for dense, fine-grained
+   * timeouts (stream expiry, tracker death countdowns); the default falls back to CreateTimer
+   * for dispatchers without a wheel.
+   */
+  virtual TimerUPtr CreateWheelTimer(TimerCB cb) { return CreateTimer(std::move(cb)); }
+
   /**
    * Returns a time-source to use with this dispatcher.
    */
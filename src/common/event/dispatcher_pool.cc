@@ -0,0 +1,96 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/event/dispatcher_pool.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <utility>
+
+#include "src/common/base/base.h"
+
+namespace px {
+namespace event {
+
+DispatcherPool::DispatcherPool(API* api, std::string_view name, size_t num_workers,
+                               bool pin_worker_cpus)
+    : name_(std::string(name)), pin_worker_cpus_(pin_worker_cpus) {
+  CHECK_GT(num_workers, 0U) << "DispatcherPool requires at least one worker";
+  dispatchers_.reserve(num_workers);
+  for (size_t i = 0; i < num_workers; ++i) {
+    dispatchers_.push_back(api->AllocateDispatcher(absl::Substitute("$0-$1", name_, i)));
+  }
+}
+
+DispatcherPool::~DispatcherPool() { Stop(); }
+
+void DispatcherPool::WorkerThread(size_t worker_index) {
+  if (pin_worker_cpus_) {
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(worker_index % std::thread::hardware_concurrency(), &cpuset);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) != 0) {
+      // Pinning is an optimization; keep running unpinned if the mask is restricted.
+      LOG(WARNING) << absl::Substitute("Could not pin worker $0-$1 to a CPU. [errno=$2]", name_,
+                                       worker_index, errno);
+    }
+  }
+  dispatchers_[worker_index]->Run(Dispatcher::RunType::Block);
+}
+
+void DispatcherPool::Run() {
+  CHECK(!running_) << "DispatcherPool is already running";
+  running_ = true;
+  worker_threads_.reserve(dispatchers_.size());
+  for (size_t i = 0; i < dispatchers_.size(); ++i) {
+    worker_threads_.emplace_back(&DispatcherPool::WorkerThread, this, i);
+  }
+}
+
+void DispatcherPool::Stop() {
+  if (!running_) {
+    return;
+  }
+  for (auto& dispatcher : dispatchers_) {
+    dispatcher->Stop();
+  }
+  for (auto& thread : worker_threads_) {
+    thread.join();
+  }
+  worker_threads_.clear();
+  // The loops are no longer running, so it is safe to tear them down from this thread.
+  for (auto& dispatcher : dispatchers_) {
+    dispatcher->Exit();
+  }
+  running_ = false;
+}
+
+Dispatcher* DispatcherPool::NextDispatcher() {
+  return dispatchers_[next_worker_.fetch_add(1) % dispatchers_.size()].get();
+}
+
+void DispatcherPool::Post(PostCB callback) { NextDispatcher()->Post(std::move(callback)); }
+
+void DispatcherPool::PostAt(size_t worker_index, PostCB callback) {
+  DCHECK_LT(worker_index, dispatchers_.size());
+  dispatchers_[worker_index]->Post(std::move(callback));
+}
+
+}  // namespace event
+}  // namespace px
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/common/event/api.h"
+#include "src/common/event/dispatcher.h"
+
+namespace px {
+namespace event {
+
+/**
+ * DispatcherPool runs N dispatchers, each on its own worker thread, so event handling can scale
+ * across cores instead of serializing through a single loop. Each worker thread can optionally be
+ * pinned to a CPU so a loop's handles stay cache-warm on one core.
+ *
+ * Work is spread with a round-robin policy: NextDispatcher() is the accept policy — callers park
+ * long-lived handles (sockets, timers) on the returned loop and all events for those handles then
+ * fire on that loop's thread. Post() spreads one-off tasks the same way, and PostAt() targets a
+ * specific loop for cross-loop task posting. Dispatcher::Post is already thread safe, so tasks may
+ * be posted from any thread, including another worker loop.
+ */
+class DispatcherPool : public NotCopyable {
+ public:
+  /**
+   * @param api used to allocate the worker dispatchers.
+   * @param name prefix for the worker loop names ("<name>-<index>").
+   * @param num_workers number of worker loops/threads.
+   * @param pin_worker_cpus if true, worker i is pinned to CPU i modulo the number of CPUs.
+   */
+  DispatcherPool(API* api, std::string_view name, size_t num_workers, bool pin_worker_cpus);
+  ~DispatcherPool();
+
+  /**
+   * Spawns the worker threads and runs each dispatcher loop until Stop() is called.
+   */
+  void Run();
+
+  /**
+   * Stops all worker loops and joins the worker threads. Safe to call more than once.
+   */
+  void Stop();
+
+  /**
+   * Returns the next worker dispatcher, round-robin. Thread safe. Handles created on the returned
+   * dispatcher must only be touched from its loop thread (same rule as a single dispatcher);
+   * use Post on the returned dispatcher to get onto that thread.
+   */
+  Dispatcher* NextDispatcher();
+
+  /**
+   * Posts a functor to one of the worker loops, round-robin. Safe from any thread.
+   */
+  void Post(PostCB callback);
+
+  /**
+   * Posts a functor to a specific worker loop. Safe from any thread, including another worker.
+   */
+  void PostAt(size_t worker_index, PostCB callback);
+
+  size_t num_workers() const { return dispatchers_.size(); }
+
+ private:
+  void WorkerThread(size_t worker_index);
+
+  const std::string name_;
+  const bool pin_worker_cpus_;
+  std::vector<DispatcherUPtr> dispatchers_;
+  std::vector<std::thread> worker_threads_;
+  std::atomic<size_t> next_worker_ = 0;
+  bool running_ = false;
+};
+
+using DispatcherPoolUPtr = std::unique_ptr<DispatcherPool>;
+
+}  // namespace event
+}  // namespace px
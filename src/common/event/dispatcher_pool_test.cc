@@ -0,0 +1,122 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <absl/container/flat_hash_set.h>
+#include <absl/synchronization/mutex.h>
+
+#include "src/common/base/base.h"
+#include "src/common/event/api_impl.h"
+#include "src/common/event/dispatcher_pool.h"
+#include "src/common/event/real_time_system.h"
+
+namespace px {
+namespace event {
+
+namespace {
+// Spin until pred holds, or fail the test after a generous timeout.
+template <typename TPred>
+void WaitFor(const TPred& pred) {
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (!pred()) {
+    ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+}  // namespace
+
+TEST(DispatcherPoolTest, posts_spread_across_workers) {
+  constexpr size_t kNumWorkers = 4;
+  constexpr int kNumPosts = 100;
+
+  RealTimeSystem time_system;
+  APIImpl api(&time_system);
+  DispatcherPool pool(&api, "test", kNumWorkers, /* pin_worker_cpus */ false);
+  ASSERT_EQ(kNumWorkers, pool.num_workers());
+  pool.Run();
+
+  std::atomic<int> num_run = 0;
+  absl::Mutex mu;
+  absl::flat_hash_set<std::thread::id> worker_tids;
+  for (int i = 0; i < kNumPosts; ++i) {
+    pool.Post([&] {
+      {
+        absl::MutexLock lock(&mu);
+        worker_tids.insert(std::this_thread::get_id());
+      }
+      ++num_run;
+    });
+  }
+
+  WaitFor([&] { return num_run == kNumPosts; });
+  pool.Stop();
+
+  // Round-robin posting must have exercised every worker loop.
+  absl::MutexLock lock(&mu);
+  EXPECT_EQ(kNumWorkers, worker_tids.size());
+}
+
+TEST(DispatcherPoolTest, post_at_targets_one_worker) {
+  RealTimeSystem time_system;
+  APIImpl api(&time_system);
+  DispatcherPool pool(&api, "test", /* num_workers */ 2, /* pin_worker_cpus */ false);
+  pool.Run();
+
+  constexpr int kNumPosts = 10;
+  std::atomic<int> num_run = 0;
+  absl::Mutex mu;
+  absl::flat_hash_set<std::thread::id> worker_tids;
+  for (int i = 0; i < kNumPosts; ++i) {
+    pool.PostAt(1, [&] {
+      {
+        absl::MutexLock lock(&mu);
+        worker_tids.insert(std::this_thread::get_id());
+      }
+      ++num_run;
+    });
+  }
+
+  WaitFor([&] { return num_run == kNumPosts; });
+  pool.Stop();
+
+  // Everything posted at worker 1 must have run on that worker's thread.
+  absl::MutexLock lock(&mu);
+  EXPECT_EQ(1, worker_tids.size());
+}
+
+TEST(DispatcherPoolTest, cross_loop_posting) {
+  RealTimeSystem time_system;
+  APIImpl api(&time_system);
+  DispatcherPool pool(&api, "test", /* num_workers */ 2, /* pin_worker_cpus */ false);
+  pool.Run();
+
+  // A task on worker 0 hands off to worker 1, which completes the round trip.
+  std::atomic<bool> done = false;
+  pool.PostAt(0, [&] { pool.PostAt(1, [&] { done = true; }); });
+
+  WaitFor([&] { return done.load(); });
+  pool.Stop();
+}
+
+}  // namespace event
+}  // namespace px
@@ -20,6 +20,7 @@
 
 #include <uv.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -103,6 +104,107 @@ LibuvTimer::~LibuvTimer() {
   }
 }
 
+//----- TimerWheel
+
+WheelTimer::~WheelTimer() {
+  if (Enabled()) {
+    DisableTimer();
+  }
+}
+
+void WheelTimer::DisableTimer() { wheel_->Cancel(this); }
+
+void WheelTimer::EnableTimer(const std::chrono::milliseconds& ms) { wheel_->Schedule(this, ms); }
+
+TimerWheel::TimerWheel(uv_loop_t* loop) : loop_(loop) {
+  int rc = uv_timer_init(loop_, &driver_);
+  CHECK(rc == 0) << "Failed to initialize timer wheel driver";
+  driver_.data = this;
+}
+
+TimerWheel::~TimerWheel() {
+  if (driver_running_) {
+    uv_timer_stop(&driver_);
+  }
+  auto h = reinterpret_cast<uv_handle_t*>(&driver_);
+  if (!uv_is_closing(h)) {
+    uv_close(h, nullptr);
+  }
+}
+
+TimerUPtr TimerWheel::CreateTimer(const TimerCB& cb) {
+  return std::make_unique<WheelTimer>(cb, this);
+}
+
+void TimerWheel::StartDriverIfStopped() {
+  if (driver_running_) {
+    return;
+  }
+  // Re-sync the epoch so the idle period doesn't count as elapsed ticks.
+  epoch_ms_ = uv_now(loop_) - current_tick_ * kTickPeriod.count();
+  uv_timer_cb driver_cb = [](uv_timer_t* t) {
+    reinterpret_cast<TimerWheel*>(t->data)->Advance();
+  };
+  int rc = uv_timer_start(&driver_, driver_cb, kTickPeriod.count(), kTickPeriod.count());
+  CHECK(rc == 0) << "Failed to start timer wheel driver";
+  driver_running_ = true;
+}
+
+void TimerWheel::Schedule(WheelTimer* timer, const std::chrono::milliseconds& ms) {
+  if (timer->home_ != nullptr) {
+    Cancel(timer);
+  }
+  // Round up, and always land at least one tick out so a fresh timer can't fire synchronously.
+  uint64_t ticks = (ms.count() + kTickPeriod.count() - 1) / kTickPeriod.count();
+  timer->deadline_tick_ = current_tick_ + std::max<uint64_t>(1, ticks);
+  auto& slot = slots_[timer->deadline_tick_ % kNumSlots];
+  slot.push_back(timer);
+  timer->home_ = &slot;
+  timer->it_ = std::prev(slot.end());
+  ++pending_timers_;
+  StartDriverIfStopped();
+}
+
+void TimerWheel::Cancel(WheelTimer* timer) {
+  if (timer->home_ == nullptr) {
+    return;
+  }
+  timer->home_->erase(timer->it_);
+  timer->home_ = nullptr;
+  --pending_timers_;
+}
+
+void TimerWheel::Advance() {
+  const uint64_t target_tick = (uv_now(loop_) - epoch_ms_) / kTickPeriod.count();
+  while (current_tick_ < target_tick) {
+    ++current_tick_;
+    auto& slot = slots_[current_tick_ % kNumSlots];
+    // Timers parked here for a later wheel revolution stay; due ones move to the firing list.
+    for (auto it = slot.begin(); it != slot.end();) {
+      auto cur = it++;
+      WheelTimer* timer = *cur;
+      if (timer->deadline_tick_ <= current_tick_) {
+        firing_.splice(firing_.end(), slot, cur);
+        timer->home_ = &firing_;
+        timer->it_ = std::prev(firing_.end());
+      }
+    }
+    // Fire outside the slot walk: callbacks may schedule or cancel timers freely, including
+    // ones still in firing_.
+    while (!firing_.empty()) {
+      WheelTimer* timer = firing_.front();
+      firing_.pop_front();
+      timer->home_ = nullptr;
+      --pending_timers_;
+      timer->cb_();
+    }
+  }
+  if (pending_timers_ == 0 && driver_running_) {
+    uv_timer_stop(&driver_);
+    driver_running_ = false;
+  }
+}
+
 //----- Scheduler
 
 TimerUPtr LibuvScheduler::CreateTimer(const TimerCB& cb, Dispatcher*) {
@@ -222,6 +324,7 @@ LibuvDispatcher::LibuvDispatcher(std::string_view name, const API& api, TimeSyst
     : name_(std::string(name)),
       api_(api),
       base_scheduler_(name),
+      timer_wheel_(base_scheduler_.uv_loop()),
       scheduler_(time_system->CreateScheduler(&base_scheduler_)),
       current_to_delete_(&to_delete_1_),
       deferred_delete_timer_(CreateTimer([this]() { DoDeferredDelete(); })) {
@@ -241,6 +344,11 @@ TimerUPtr LibuvDispatcher::CreateTimer(TimerCB cb) {
   return scheduler_->CreateTimer(cb, this);
 }
 
+TimerUPtr LibuvDispatcher::CreateWheelTimer(TimerCB cb) {
+  CHECK(IsCorrectThread());
+  return timer_wheel_.CreateTimer(cb);
+}
+
 void LibuvDispatcher::RunPostCallbacks() {
   while (true) {
     PostCB cb;
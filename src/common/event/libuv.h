@@ -20,6 +20,7 @@
 
 #include <uv.h>
 
+#include <array>
 #include <chrono>
 #include <functional>
 #include <list>
@@ -27,6 +28,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include <absl/base/attributes.h>
@@ -57,6 +59,79 @@ class LibuvTimer : public Timer {
   uv_timer_t timer_;
 };
 
+class TimerWheel;
+
+// A timer parked on a TimerWheel. Created via Dispatcher::CreateWheelTimer; all operations must
+// happen on the loop thread, like LibuvTimer.
+class WheelTimer : public Timer {
+ public:
+  WheelTimer(TimerCB cb, TimerWheel* wheel) : cb_(std::move(cb)), wheel_(wheel) {}
+  ~WheelTimer() override;
+
+  void DisableTimer() override;
+  void EnableTimer(const std::chrono::milliseconds& ms) override;
+  bool Enabled() override { return home_ != nullptr; }
+
+ private:
+  friend class TimerWheel;
+
+  TimerCB cb_;
+  TimerWheel* wheel_;
+  // Tick at which this timer is due; meaningful only while parked in a slot.
+  uint64_t deadline_tick_ = 0;
+  // The slot (or firing) list currently holding this timer, with the position for O(1) removal.
+  // nullptr when the timer is disabled.
+  std::list<WheelTimer*>* home_ = nullptr;
+  std::list<WheelTimer*>::iterator it_;
+};
+
+/**
+ * A hashed timer wheel multiplexing many timers onto a single libuv timer.
+ *
+ * Each libuv timer is a heap entry in the loop, so tens of thousands of short-lived timeouts
+ * (per-stream expiry, per-tracker death countdowns) get expensive. The wheel hashes each
+ * deadline into one of kNumSlots slot lists keyed by tick; create and cancel are O(1) list
+ * splices, and each tick only walks the one slot whose turn has come. Timers fire with
+ * kTickPeriod granularity rather than millisecond precision, and the driving timer runs only
+ * while timers are pending.
+ *
+ * Note the wheel reads the loop's clock directly, so (unlike CreateTimer) it does not follow a
+ * simulated TimeSystem.
+ */
+class TimerWheel {
+ public:
+  static constexpr std::chrono::milliseconds kTickPeriod{10};
+  static constexpr size_t kNumSlots = 512;
+
+  explicit TimerWheel(uv_loop_t* loop);
+  ~TimerWheel();
+
+  TimerUPtr CreateTimer(const TimerCB& cb);
+
+ private:
+  friend class WheelTimer;
+
+  void Schedule(WheelTimer* timer, const std::chrono::milliseconds& ms);
+  void Cancel(WheelTimer* timer);
+  // Catches the wheel up to the loop's clock, firing due timers tick by tick.
+  void Advance();
+  void StartDriverIfStopped();
+
+  uv_loop_t* loop_;
+  uv_timer_t driver_;
+  bool driver_running_ = false;
+  // Loop time corresponding to tick 0; re-synced whenever the driver restarts so an idle wheel
+  // doesn't have to replay ticks for the idle period.
+  uint64_t epoch_ms_ = 0;
+  uint64_t current_tick_ = 0;
+  // Timers parked in slots or awaiting fire; the driver stops when this reaches zero.
+  size_t pending_timers_ = 0;
+  std::array<std::list<WheelTimer*>, kNumSlots> slots_;
+  // Due timers are spliced here before their callbacks run, so a callback cancelling a
+  // not-yet-fired timer just unlinks it like any other cancel.
+  std::list<WheelTimer*> firing_;
+};
+
 class LibuvScheduler : public Scheduler {
  public:
   explicit LibuvScheduler(std::string_view name);
@@ -83,6 +158,7 @@ class LibuvDispatcher : public Dispatcher {
  public:
   LibuvDispatcher(std::string_view name, const API& api, TimeSystem* time_system);
   TimerUPtr CreateTimer(TimerCB cb) override;
+  TimerUPtr CreateWheelTimer(TimerCB cb) override;
   const TimeSource& GetTimeSource() const override;
   void Stop() override;
   void Exit() override;
@@ -114,6 +190,7 @@ class LibuvDispatcher : public Dispatcher {
 
   const API& api_;
   LibuvScheduler base_scheduler_;
+  TimerWheel timer_wheel_;
   SchedulerUPtr scheduler_;
   MonotonicTimePoint approximate_monotonic_time_;
 
@@ -129,6 +129,51 @@ TEST_F(LibuvDispatcherTest, test_timed_events) {
   EXPECT_EQ(3, timer2_call_count);
 }
 
+TEST_F(LibuvDispatcherTest, wheel_timers) {
+  // Like test_timed_events, this exercises the machinery rather than asserting precise timing.
+  constexpr int kNumTimers = 1000;
+  std::atomic<int> fired = 0;
+  std::atomic<int> repeat_count = 0;
+
+  std::thread watcher_th([&fired, &repeat_count, this] {
+    while (fired != kNumTimers || repeat_count != 3) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      // Spin.
+    }
+    this->dispatcher_->Stop();
+  });
+
+  // Many cheap one-shot timers, spread over a few deadlines.
+  std::vector<px::event::TimerUPtr> timers;
+  for (int i = 0; i < kNumTimers; ++i) {
+    timers.push_back(dispatcher_->CreateWheelTimer([&fired] { ++fired; }));
+    timers.back()->EnableTimer(std::chrono::milliseconds(50 + 20 * (i % 5)));
+    EXPECT_TRUE(timers.back()->Enabled());
+  }
+
+  // A cancelled timer must not fire.
+  auto cancelled = dispatcher_->CreateWheelTimer([] { ADD_FAILURE() << "cancelled timer fired"; });
+  cancelled->EnableTimer(std::chrono::milliseconds(100));
+  cancelled->DisableTimer();
+  EXPECT_FALSE(cancelled->Enabled());
+
+  // Wheel timers can re-enable themselves from their own callback.
+  std::unique_ptr<px::event::Timer> repeating;
+  repeating = dispatcher_->CreateWheelTimer([&repeating, &repeat_count] {
+    if (++repeat_count < 3) {
+      repeating->EnableTimer(std::chrono::milliseconds(30));
+    }
+  });
+  repeating->EnableTimer(std::chrono::milliseconds(30));
+
+  dispatcher_->Run(Dispatcher::RunType::Block);
+  dispatcher_->Exit();
+  watcher_th.join();
+
+  EXPECT_EQ(kNumTimers, fired);
+  EXPECT_EQ(3, repeat_count);
+}
+
 TEST_F(LibuvDispatcherTest, threadpool) {
   auto task = std::make_unique<ComputePi>();
   // Store the pointer so that we can access the results later.
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <absl/container/btree_map.h>
+#include <absl/strings/str_cat.h>
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
@@ -29,6 +31,7 @@
 
 #include "src/common/base/types.h"
 #include "src/common/base/utils.h"
+#include "src/common/json/json_escape.h"
 
 namespace px {
 namespace utils {
@@ -100,6 +103,17 @@ rapidjson::Value JSONObj(const std::multimap<TKeyType, TValType, TComparator, TA
   return json_obj;
 }
 
+template <typename TKeyType, typename TValType, typename TComparator, typename TAllocator>
+rapidjson::Value JSONObj(const absl::btree_multimap<TKeyType, TValType, TComparator, TAllocator>& x,
+                         rapidjson::Document::AllocatorType* allocator) {
+  rapidjson::Value json_obj;
+  json_obj.SetObject();
+  for (const auto& [k, v] : x) {
+    json_obj.AddMember(JSONObj(k, allocator).Move(), JSONObj(v, allocator).Move(), *allocator);
+  }
+  return json_obj;
+}
+
 }  // namespace internal
 
 /**
@@ -129,73 +143,75 @@ std::string ToJSONString(const T& x) {
 /*
  * Exposes a limited set of APIs to build JSON string, with mixed data structures; which could not
  * be processed by the above ToJSONString().
+ *
+ * Output goes into a plain growable string, with strings escaped by the bulk scanner in
+ * json_escape.h, which keeps this builder cheap on hot paths (Stirling record serialization,
+ * JSON-typed protocol columns). An external output buffer can be supplied to append the object
+ * directly into already-allocated storage, e.g. a ColumnWrapper string value.
  */
 class JSONObjectBuilder {
  public:
-  JSONObjectBuilder() : object_ended_{false}, buffer_{}, writer_{buffer_} { writer_.StartObject(); }
+  JSONObjectBuilder() : output_(&storage_) { output_->push_back('{'); }
+
+  // Appends the object to the given buffer instead of internal storage. The caller keeps
+  // ownership of the buffer, and must call Finish() instead of GetString().
+  explicit JSONObjectBuilder(std::string* output) : output_(output) { output_->push_back('{'); }
+
+  // Closes the JSON object. Only needed when building into an external buffer.
+  void Finish() {
+    DCHECK(!object_ended_);
+    object_ended_ = true;
+    output_->push_back('}');
+  }
 
   // Closes JSON object and return the string.
   std::string GetString() {
-    object_ended_ = true;
-    writer_.EndObject();
-    return buffer_.GetString();
+    DCHECK(output_ == &storage_) << "GetString() requires an internally-buffered builder";
+    Finish();
+    return std::move(storage_);
   }
 
   // Writes a key-value pair.
   void WriteKV(std::string_view key, std::string_view value) {
     DCHECK(!object_ended_);
-    writer_.String(key.data(), key.size());
-    writer_.String(value.data(), value.size());
+    WriteKey(key);
+    AppendEscapedJSONString(value, output_);
   }
 
   // Writes a key-value pair where value is an int.
-  void WriteKV(std::string_view key, int value) {
-    DCHECK(!object_ended_);
-    writer_.String(key.data(), key.size());
-    writer_.Int(value);
-  }
+  void WriteKV(std::string_view key, int value) { WriteNumberKV(key, value); }
 
   // Writes a key-value pair where value is an uint32_t.
-  void WriteKV(std::string_view key, uint32_t value) {
-    DCHECK(!object_ended_);
-    writer_.String(key.data(), key.size());
-    writer_.Uint(value);
-  }
+  void WriteKV(std::string_view key, uint32_t value) { WriteNumberKV(key, value); }
 
-  // Writes a key-value pair where value is an int.
-  void WriteKV(std::string_view key, int64_t value) {
-    DCHECK(!object_ended_);
-    writer_.String(key.data(), key.size());
-    writer_.Int64(value);
-  }
+  // Writes a key-value pair where value is an int64_t.
+  void WriteKV(std::string_view key, int64_t value) { WriteNumberKV(key, value); }
 
   // Writes a key-value pair where value is an uint64_t.
-  void WriteKV(std::string_view key, uint64_t value) {
-    DCHECK(!object_ended_);
-    writer_.String(key.data(), key.size());
-    writer_.Uint64(value);
-  }
+  void WriteKV(std::string_view key, uint64_t value) { WriteNumberKV(key, value); }
 
   // Writes a key-value pair where value is an array of strings.
   void WriteKV(std::string_view key, VectorView<std::string> value) {
-    DCHECK(!object_ended_);
-    writer_.String(key.data(), key.size());
-    writer_.StartArray();
-    for (auto v : value) {
-      writer_.String(v.data(), v.size());
-    }
-    writer_.EndArray();
+    WriteStringArrayKV(key, value);
+  }
+
+  // Writes a key-value pair where value is an array of string views.
+  void WriteKV(std::string_view key, VectorView<std::string_view> value) {
+    WriteStringArrayKV(key, value);
   }
 
   // Writes a key-value pair where value is an array of ints.
   void WriteKV(std::string_view key, VectorView<int32_t> value) {
     DCHECK(!object_ended_);
-    writer_.String(key.data(), key.size());
-    writer_.StartArray();
-    for (auto v : value) {
-      writer_.Int(v);
+    WriteKey(key);
+    output_->push_back('[');
+    for (size_t i = 0; i < value.size(); ++i) {
+      if (i != 0) {
+        output_->push_back(',');
+      }
+      absl::StrAppend(output_, value[i]);
     }
-    writer_.EndArray();
+    output_->push_back(']');
   }
 
   // Writes all values that are assigned to the keys sequentially.
@@ -203,20 +219,16 @@ class JSONObjectBuilder {
   // For example:
   // WriteRepeatedKVs("foo", {"a", "b"}, {"1", "2", "3", "4"});
   //
-  // Returns: "foo": [{"a":"1","b":"2"}, {"a":"3","b":"4"}]
+  // Returns: "foo": [{"a":"1"},{"b":"2"},{"a":"3"},{"b":"4"}]
   void WriteRepeatedKVs(std::string_view key, const std::vector<std::string_view>& keys,
                         VectorView<std::string> values) {
-    DCHECK(!object_ended_);
-    DCHECK_EQ(values.size() % keys.size(), 0U);
+    WriteRepeatedKVsImpl(key, keys, values);
+  }
 
-    writer_.String(key.data(), key.size());
-    writer_.StartArray();
-    for (size_t i = 0; i < values.size(); ++i) {
-      writer_.StartObject();
-      WriteKV(keys[i % keys.size()], values[i]);
-      writer_.EndObject();
-    }
-    writer_.EndArray();
+  // Same as above, for values that are views into an externally-owned buffer.
+  void WriteRepeatedKVs(std::string_view key, const std::vector<std::string_view>& keys,
+                        VectorView<std::string_view> values) {
+    WriteRepeatedKVsImpl(key, keys, values);
   }
 
   // Writes a key and an object as value.
@@ -229,10 +241,12 @@ class JSONObjectBuilder {
   void WriteKVRecursive(std::string_view key, const T& value) {
     DCHECK(!object_ended_);
 
-    writer_.String(key.data(), key.size());
-    writer_.StartObject();
+    WriteKey(key);
+    output_->push_back('{');
+    need_comma_ = false;
     value.ToJSON(this);
-    writer_.EndObject();
+    output_->push_back('}');
+    need_comma_ = true;
   }
 
   // Writes a key and an array of objects as value.
@@ -245,20 +259,79 @@ class JSONObjectBuilder {
   void WriteKVArrayRecursive(std::string_view key, const VectorView<T>& values) {
     DCHECK(!object_ended_);
 
-    writer_.String(key.data(), key.size());
-    writer_.StartArray();
+    WriteKey(key);
+    output_->push_back('[');
     for (size_t i = 0; i < values.size(); ++i) {
-      writer_.StartObject();
+      if (i != 0) {
+        output_->push_back(',');
+      }
+      output_->push_back('{');
+      need_comma_ = false;
       values[i].ToJSON(this);
-      writer_.EndObject();
+      output_->push_back('}');
     }
-    writer_.EndArray();
+    output_->push_back(']');
+    need_comma_ = true;
   }
 
  private:
-  bool object_ended_;
-  rapidjson::StringBuffer buffer_;
-  rapidjson::Writer<rapidjson::StringBuffer> writer_;
+  // Writes the element separator (if needed) and the escaped key, followed by ':'. The value
+  // written by the caller completes the pair, so the next element needs a separator.
+  void WriteKey(std::string_view key) {
+    if (need_comma_) {
+      output_->push_back(',');
+    }
+    AppendEscapedJSONString(key, output_);
+    output_->push_back(':');
+    need_comma_ = true;
+  }
+
+  template <typename T>
+  void WriteNumberKV(std::string_view key, T value) {
+    DCHECK(!object_ended_);
+    WriteKey(key);
+    absl::StrAppend(output_, value);
+  }
+
+  template <typename T>
+  void WriteStringArrayKV(std::string_view key, VectorView<T> value) {
+    DCHECK(!object_ended_);
+    WriteKey(key);
+    output_->push_back('[');
+    for (size_t i = 0; i < value.size(); ++i) {
+      if (i != 0) {
+        output_->push_back(',');
+      }
+      AppendEscapedJSONString(value[i], output_);
+    }
+    output_->push_back(']');
+  }
+
+  template <typename T>
+  void WriteRepeatedKVsImpl(std::string_view key, const std::vector<std::string_view>& keys,
+                            VectorView<T> values) {
+    DCHECK(!object_ended_);
+    DCHECK_EQ(values.size() % keys.size(), 0U);
+
+    WriteKey(key);
+    output_->push_back('[');
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (i != 0) {
+        output_->push_back(',');
+      }
+      output_->push_back('{');
+      need_comma_ = false;
+      WriteKV(keys[i % keys.size()], values[i]);
+      output_->push_back('}');
+    }
+    output_->push_back(']');
+    need_comma_ = true;
+  }
+
+  bool object_ended_ = false;
+  bool need_comma_ = false;
+  std::string storage_;
+  std::string* output_;
 };
 
 }  // namespace utils
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/json/json_escape.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace px {
+namespace utils {
+
+namespace {
+
+constexpr uint64_t kOnes = 0x0101010101010101ULL;
+constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+
+// SWAR byte-wise comparisons (see Bit Twiddling Hacks): the formulas flag matching bytes by
+// setting their high bits. Borrow propagation can set spurious flags, but only in bytes above a
+// genuine match, so the lowest set bit always marks a real match -- which is all the scanner
+// consumes.
+uint64_t BytesEqual(uint64_t word, uint8_t c) {
+  uint64_t x = word ^ (kOnes * c);
+  return (x - kOnes) & ~x & kHighBits;
+}
+
+uint64_t BytesBelow0x20(uint64_t word) { return (word - kOnes * 0x20) & ~word & kHighBits; }
+
+// Flags bytes that need escaping in a JSON string: control chars, '"' and '\\'. Bytes >= 0x80
+// (UTF-8 continuation/lead bytes) pass through unescaped.
+uint64_t EscapeMask(uint64_t word) {
+  return BytesBelow0x20(word) | BytesEqual(word, '"') | BytesEqual(word, '\\');
+}
+
+void AppendEscapedChar(uint8_t c, std::string* out) {
+  switch (c) {
+    case '"':
+      out->append("\\\"", 2);
+      break;
+    case '\\':
+      out->append("\\\\", 2);
+      break;
+    case '\b':
+      out->append("\\b", 2);
+      break;
+    case '\f':
+      out->append("\\f", 2);
+      break;
+    case '\n':
+      out->append("\\n", 2);
+      break;
+    case '\r':
+      out->append("\\r", 2);
+      break;
+    case '\t':
+      out->append("\\t", 2);
+      break;
+    default: {
+      constexpr char kHexDigits[] = "0123456789ABCDEF";
+      const char buf[6] = {'\\', 'u', '0', '0', kHexDigits[(c >> 4) & 0xf], kHexDigits[c & 0xf]};
+      out->append(buf, sizeof(buf));
+    }
+  }
+}
+
+}  // namespace
+
+void AppendEscapedJSONString(std::string_view s, std::string* out) {
+  out->reserve(out->size() + s.size() + 2);
+  out->push_back('"');
+
+  size_t clean_start = 0;
+  size_t i = 0;
+  while (i + sizeof(uint64_t) <= s.size()) {
+    uint64_t word;
+    std::memcpy(&word, s.data() + i, sizeof(word));
+    uint64_t mask = EscapeMask(word);
+    if (mask == 0) {
+      i += sizeof(uint64_t);
+      continue;
+    }
+    // Lowest set bit gives the first byte needing escape (little-endian byte order).
+    i += static_cast<size_t>(__builtin_ctzll(mask)) / 8;
+    out->append(s.data() + clean_start, i - clean_start);
+    AppendEscapedChar(static_cast<uint8_t>(s[i]), out);
+    ++i;
+    clean_start = i;
+  }
+  for (; i < s.size(); ++i) {
+    uint8_t c = static_cast<uint8_t>(s[i]);
+    if (c < 0x20 || c == '"' || c == '\\') {
+      out->append(s.data() + clean_start, i - clean_start);
+      AppendEscapedChar(c, out);
+      clean_start = i + 1;
+    }
+  }
+  out->append(s.data() + clean_start, s.size() - clean_start);
+
+  out->push_back('"');
+}
+
+}  // namespace utils
+}  // namespace px
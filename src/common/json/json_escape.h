@@ -0,0 +1,38 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace px {
+namespace utils {
+
+/**
+ * Appends s to out as a quoted JSON string, escaping '"', '\\' and control characters.
+ *
+ * The scan checks 8 bytes per step for characters that need escaping and copies clean spans in
+ * bulk, since in practice almost all payload bytes pass through unescaped. The output buffer
+ * grows geometrically like any std::string append, so callers serializing many values into one
+ * buffer amortize the allocations.
+ */
+void AppendEscapedJSONString(std::string_view s, std::string* out);
+
+}  // namespace utils
+}  // namespace px
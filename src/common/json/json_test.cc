@@ -84,5 +84,55 @@ TEST(JSONBuilderTest, ResultsAreAsExpected) {
 
 // Note: if making a test using std::unordered_map, ensure that the test is robust to ordering.
 
+TEST(JSONBuilderTest, StringsAreEscaped) {
+  JSONObjectBuilder builder;
+  builder.WriteKV("msg", "say \"hi\"\n");
+  builder.WriteKV("path", "C:\\temp");
+  builder.WriteKV("ctrl", std::string_view("\x01\x1f", 2));
+  EXPECT_THAT(builder.GetString(),
+              StrEq(R"({"msg":"say \"hi\"\n","path":"C:\\temp","ctrl":"\u0001\u001F"})"));
+}
+
+TEST(JSONBuilderTest, WritesIntoExternalBuffer) {
+  std::string out = "prefix:";
+  JSONObjectBuilder builder(&out);
+  builder.WriteKV("a", 1);
+  builder.WriteKV("b", "two");
+  builder.Finish();
+  EXPECT_THAT(out, StrEq(R"(prefix:{"a":1,"b":"two"})"));
+}
+
+TEST(JSONBuilderTest, RepeatedKVs) {
+  JSONObjectBuilder builder;
+  std::vector<std::string> values = {"1", "2", "3", "4"};
+  builder.WriteRepeatedKVs("foo", {"a", "b"}, VectorView<std::string>(values));
+  EXPECT_THAT(builder.GetString(), StrEq(R"({"foo":[{"a":"1"},{"b":"2"},{"a":"3"},{"b":"4"}]})"));
+}
+
+TEST(AppendEscapedJSONStringTest, EscapesAcrossWordBoundaries) {
+  // Long enough to exercise the 8-bytes-at-a-time scan, with escapes at varying offsets.
+  std::string input;
+  for (int i = 0; i < 100; ++i) {
+    input += "plain text ";
+    input.push_back(i % 2 == 0 ? '"' : '\n');
+  }
+  std::string out;
+  AppendEscapedJSONString(input, &out);
+
+  std::string expected = "\"";
+  for (int i = 0; i < 100; ++i) {
+    expected += "plain text ";
+    expected += (i % 2 == 0) ? "\\\"" : "\\n";
+  }
+  expected += "\"";
+  EXPECT_THAT(out, StrEq(expected));
+}
+
+TEST(AppendEscapedJSONStringTest, PassesUTF8Through) {
+  std::string out;
+  AppendEscapedJSONString("héllo — 世界", &out);
+  EXPECT_THAT(out, StrEq("\"héllo — 世界\""));
+}
+
 }  // namespace utils
 }  // namespace px
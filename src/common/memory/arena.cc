@@ -0,0 +1,101 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/memory/arena.h"
+
+#include <algorithm>
+
+#include <prometheus/gauge.h>
+
+#include "src/common/metrics/metrics.h"
+
+namespace px {
+
+namespace {
+
+prometheus::Gauge* ReservedBytesGauge(const std::string& arena_name) {
+  static auto& family = prometheus::BuildGauge()
+                            .Name("memory_arena_reserved_bytes")
+                            .Help("Bytes of chunk memory currently held by a named arena.")
+                            .Register(GetMetricsRegistry());
+  return &family.Add({{"arena", arena_name}});
+}
+
+}  // namespace
+
+Arena::Arena(std::string_view name, size_t initial_chunk_size)
+    : name_(name), next_chunk_size_(initial_chunk_size) {
+  DCHECK_GT(initial_chunk_size, 0U);
+  if (!name_.empty()) {
+    reserved_bytes_gauge_ = ReservedBytesGauge(name_);
+  }
+}
+
+Arena::~Arena() {
+  Reset();
+  bytes_reserved_ = 0;
+  UpdateReservedBytesGauge();
+}
+
+void Arena::UpdateReservedBytesGauge() {
+  if (reserved_bytes_gauge_ != nullptr) {
+    reserved_bytes_gauge_->Set(static_cast<double>(bytes_reserved_));
+  }
+}
+
+void* Arena::AllocateSlow(size_t size, size_t alignment) {
+  // Oversized requests get a dedicated chunk; normal growth doubles up to the cap.
+  size_t chunk_size = std::max(next_chunk_size_, size + alignment);
+  next_chunk_size_ = std::min(next_chunk_size_ * 2, kMaxChunkSize);
+
+  Chunk chunk;
+  chunk.data = std::make_unique<uint8_t[]>(chunk_size);
+  chunk.size = chunk_size;
+  bytes_reserved_ += chunk_size;
+  chunks_.push_back(std::move(chunk));
+  UpdateReservedBytesGauge();
+
+  // The fresh chunk is guaranteed to fit the request.
+  Chunk& back = chunks_.back();
+  uintptr_t base = reinterpret_cast<uintptr_t>(back.data.get());
+  uintptr_t aligned = (base + alignment - 1) & ~uintptr_t{alignment - 1};
+  back.used = (aligned + size) - base;
+  bytes_allocated_ += size;
+  return reinterpret_cast<void*>(aligned);
+}
+
+void Arena::Reset() {
+  // Reverse construction order, so objects can refer to earlier arena objects in their dtors.
+  for (auto it = dtors_.rbegin(); it != dtors_.rend(); ++it) {
+    it->destroy_fn(it->obj);
+  }
+  dtors_.clear();
+
+  if (!chunks_.empty()) {
+    // Keep the newest (largest) chunk so a steady-state arena stops allocating.
+    Chunk last = std::move(chunks_.back());
+    last.used = 0;
+    bytes_reserved_ = last.size;
+    chunks_.clear();
+    chunks_.push_back(std::move(last));
+  }
+  bytes_allocated_ = 0;
+  UpdateReservedBytesGauge();
+}
+
+}  // namespace px
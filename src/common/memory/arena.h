@@ -0,0 +1,161 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "src/common/base/base.h"
+
+namespace prometheus {
+class Gauge;
+}  // namespace prometheus
+
+namespace px {
+
+/**
+ * Arena is a chunked bump allocator: allocations are pointer increments into geometrically
+ * growing chunks, and everything is freed at once on Reset() or destruction. Use it where many
+ * short-lived allocations share one lifetime (per-batch exec state, per-record parse results)
+ * so the hot path avoids malloc/free per object.
+ *
+ * New<T>() constructs objects in the arena; non-trivially-destructible objects have their
+ * destructors run (in reverse construction order) on Reset/destruction. ArenaAllocator<T> below
+ * adapts an arena for use with standard containers.
+ *
+ * Arenas are single-threaded, like the containers they typically back. Give long-lived arenas a
+ * name to export their reserved bytes as a gauge in the metrics registry; unnamed (short-lived)
+ * arenas skip metrics so they don't grow the registry.
+ */
+class Arena final : public px::NotCopyable {
+ public:
+  static constexpr size_t kDefaultInitialChunkSize = 4096;
+  // Chunk sizes double up to this cap, which bounds overshoot for large arenas.
+  static constexpr size_t kMaxChunkSize = 1024 * 1024;
+
+  Arena() = default;
+  explicit Arena(std::string_view name, size_t initial_chunk_size = kDefaultInitialChunkSize);
+  ~Arena();
+
+  /**
+   * Returns size bytes with the given alignment, valid until Reset() or destruction.
+   */
+  void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+    DCHECK_EQ(0U, alignment & (alignment - 1)) << "alignment must be a power of two";
+    if (!chunks_.empty()) {
+      Chunk& chunk = chunks_.back();
+      uintptr_t base = reinterpret_cast<uintptr_t>(chunk.data.get());
+      uintptr_t aligned = (base + chunk.used + alignment - 1) & ~uintptr_t{alignment - 1};
+      if (aligned + size <= base + chunk.size) {
+        chunk.used = (aligned + size) - base;
+        bytes_allocated_ += size;
+        return reinterpret_cast<void*>(aligned);
+      }
+    }
+    return AllocateSlow(size, alignment);
+  }
+
+  /**
+   * Constructs a T in the arena. The object must not be deleted; it is destroyed with the arena.
+   */
+  template <typename T, typename... Args>
+  T* New(Args&&... args) {
+    T* obj = new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      dtors_.push_back({obj, [](void* p) { reinterpret_cast<T*>(p)->~T(); }});
+    }
+    return obj;
+  }
+
+  /**
+   * Destroys arena objects and recycles the memory. The most recent chunk is kept, so a
+   * steady-state arena that is Reset() per iteration stops allocating once it reaches its
+   * high-water mark.
+   */
+  void Reset();
+
+  /**
+   * Bytes handed out to callers since the last Reset(). Excludes alignment padding.
+   */
+  size_t bytes_allocated() const { return bytes_allocated_; }
+
+  /**
+   * Bytes of chunk memory currently held, whether or not handed out.
+   */
+  size_t bytes_reserved() const { return bytes_reserved_; }
+
+ private:
+  struct Chunk {
+    std::unique_ptr<uint8_t[]> data;
+    size_t size = 0;
+    size_t used = 0;
+  };
+
+  // A destructor to run on Reset, mirroring ObjectPool's type-erased deleter.
+  struct Dtor {
+    void* obj;
+    void (*destroy_fn)(void*);
+  };
+
+  void* AllocateSlow(size_t size, size_t alignment);
+  void UpdateReservedBytesGauge();
+
+  const std::string name_;
+  std::vector<Chunk> chunks_;
+  std::vector<Dtor> dtors_;
+  size_t next_chunk_size_ = kDefaultInitialChunkSize;
+  size_t bytes_allocated_ = 0;
+  size_t bytes_reserved_ = 0;
+  // Only set for named arenas.
+  prometheus::Gauge* reserved_bytes_gauge_ = nullptr;
+};
+
+/**
+ * ArenaAllocator adapts an Arena for standard containers, e.g.
+ *   std::vector<int64_t, ArenaAllocator<int64_t>> vals{ArenaAllocator<int64_t>(&arena)};
+ * Deallocation is a no-op; memory is reclaimed when the arena resets.
+ */
+template <typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit ArenaAllocator(Arena* arena) : arena_(arena) { DCHECK(arena != nullptr); }
+  template <typename U>
+  // NOLINTNEXTLINE(google-explicit-constructor): allocator rebind requires implicit conversion.
+  ArenaAllocator(const ArenaAllocator<U>& other) : arena_(other.arena()) {}
+
+  T* allocate(size_t n) { return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T))); }
+  void deallocate(T*, size_t) {}
+
+  Arena* arena() const { return arena_; }
+
+  friend bool operator==(const ArenaAllocator& a, const ArenaAllocator& b) {
+    return a.arena_ == b.arena_;
+  }
+  friend bool operator!=(const ArenaAllocator& a, const ArenaAllocator& b) { return !(a == b); }
+
+ private:
+  Arena* arena_;
+};
+
+}  // namespace px
@@ -0,0 +1,130 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/memory/arena.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace px {
+
+TEST(ArenaTest, allocations_are_aligned_and_usable) {
+  Arena arena;
+  auto* a = static_cast<uint8_t*>(arena.Allocate(3, 1));
+  auto* b = static_cast<int64_t*>(arena.Allocate(sizeof(int64_t), alignof(int64_t)));
+  EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(b) % alignof(int64_t));
+  std::memset(a, 0xab, 3);
+  *b = 42;
+  EXPECT_EQ(0xab, a[0]);
+  EXPECT_EQ(42, *b);
+  EXPECT_EQ(3 + sizeof(int64_t), arena.bytes_allocated());
+  EXPECT_GE(arena.bytes_reserved(), arena.bytes_allocated());
+}
+
+TEST(ArenaTest, grows_past_first_chunk) {
+  Arena arena("", /* initial_chunk_size */ 64);
+  std::vector<uint8_t*> ptrs;
+  for (int i = 0; i < 100; ++i) {
+    auto* p = static_cast<uint8_t*>(arena.Allocate(32, 1));
+    *p = static_cast<uint8_t>(i);
+    ptrs.push_back(p);
+  }
+  // Earlier chunks must remain valid after growth.
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(static_cast<uint8_t>(i), *ptrs[i]);
+  }
+  EXPECT_EQ(100 * 32U, arena.bytes_allocated());
+}
+
+TEST(ArenaTest, oversized_allocation_gets_dedicated_chunk) {
+  Arena arena("", /* initial_chunk_size */ 64);
+  auto* p = static_cast<uint8_t*>(arena.Allocate(10000, 1));
+  std::memset(p, 0, 10000);
+  EXPECT_GE(arena.bytes_reserved(), 10000U);
+}
+
+struct DtorCounter {
+  explicit DtorCounter(int* count) : count(count) {}
+  ~DtorCounter() { (*count)++; }
+  int* count;
+};
+
+TEST(ArenaTest, new_runs_destructors_on_reset) {
+  int destroy_count = 0;
+  Arena arena;
+  arena.New<DtorCounter>(&destroy_count);
+  arena.New<DtorCounter>(&destroy_count);
+  // Trivially destructible objects don't get tracked.
+  auto* val = arena.New<int64_t>(7);
+  EXPECT_EQ(7, *val);
+
+  arena.Reset();
+  EXPECT_EQ(2, destroy_count);
+  EXPECT_EQ(0U, arena.bytes_allocated());
+
+  arena.New<DtorCounter>(&destroy_count);
+}  // Destruction of the arena runs the remaining dtor.
+
+TEST(ArenaTest, destructor_runs_pending_dtors) {
+  int destroy_count = 0;
+  {
+    Arena arena;
+    arena.New<DtorCounter>(&destroy_count);
+    arena.New<DtorCounter>(&destroy_count);
+  }
+  EXPECT_EQ(2, destroy_count);
+}
+
+TEST(ArenaTest, reset_reaches_steady_state) {
+  Arena arena("", /* initial_chunk_size */ 64);
+  for (int i = 0; i < 64; ++i) {
+    arena.Allocate(64, 1);
+  }
+  arena.Reset();
+  size_t reserved = arena.bytes_reserved();
+  // The retained chunk covers the next round without growing.
+  for (int iter = 0; iter < 3; ++iter) {
+    auto* p = arena.Allocate(reserved / 2, 1);
+    EXPECT_NE(nullptr, p);
+    EXPECT_EQ(reserved, arena.bytes_reserved());
+    arena.Reset();
+  }
+}
+
+TEST(ArenaAllocatorTest, works_with_std_containers) {
+  Arena arena;
+  std::vector<int64_t, ArenaAllocator<int64_t>> vals{ArenaAllocator<int64_t>(&arena)};
+  for (int64_t i = 0; i < 1000; ++i) {
+    vals.push_back(i);
+  }
+  for (int64_t i = 0; i < 1000; ++i) {
+    EXPECT_EQ(i, vals[i]);
+  }
+  EXPECT_GE(arena.bytes_allocated(), 1000 * sizeof(int64_t));
+}
+
+TEST(ArenaTest, named_arena_exports_reserved_bytes) {
+  Arena arena("arena_test", /* initial_chunk_size */ 128);
+  arena.Allocate(64, 1);
+  EXPECT_GE(arena.bytes_reserved(), 128U);
+}
+
+}  // namespace px
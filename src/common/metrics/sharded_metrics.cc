@@ -0,0 +1,116 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/metrics/sharded_metrics.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+namespace px {
+
+namespace {
+
+// Live sharded metrics, walked by FlushShardedMetrics(). Registration happens at metric
+// construction (rare); the hot path never touches this.
+std::mutex g_sharded_metrics_mu;
+std::vector<ShardedMetric*>& ShardedMetricsList() {
+  static std::vector<ShardedMetric*> list;
+  return list;
+}
+
+}  // namespace
+
+ShardedMetric::ShardedMetric() {
+  std::lock_guard<std::mutex> lock(g_sharded_metrics_mu);
+  ShardedMetricsList().push_back(this);
+}
+
+ShardedMetric::~ShardedMetric() {
+  std::lock_guard<std::mutex> lock(g_sharded_metrics_mu);
+  auto& list = ShardedMetricsList();
+  list.erase(std::remove(list.begin(), list.end(), this), list.end());
+}
+
+void FlushShardedMetrics() {
+  std::lock_guard<std::mutex> lock(g_sharded_metrics_mu);
+  for (auto* metric : ShardedMetricsList()) {
+    metric->Flush();
+  }
+}
+
+void ShardedCounter::Flush() {
+  uint64_t total = Value();
+  // Shards only increase, so the delta since the last flush is non-negative.
+  counter_.Increment(static_cast<double>(total - flushed_));
+  flushed_ = total;
+}
+
+ShardedHistogram::ShardedHistogram(const std::string& name, const std::string& help,
+                                   std::vector<double> bounds)
+    : bounds_(std::move(bounds)),
+      histogram_(prometheus::BuildHistogram()
+                     .Name(name)
+                     .Help(help)
+                     .Register(GetMetricsRegistry())
+                     .Add({{"name", name}}, prometheus::Histogram::BucketBoundaries(bounds_))),
+      flushed_counts_(bounds_.size() + 1, 0) {
+  DCHECK(std::is_sorted(bounds_.begin(), bounds_.end()));
+  for (auto& shard : shards_) {
+    shard.counts = std::make_unique<std::atomic<uint64_t>[]>(bounds_.size() + 1);
+    for (size_t i = 0; i <= bounds_.size(); ++i) {
+      shard.counts[i].store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+uint64_t ShardedHistogram::TotalCount() const {
+  uint64_t total = 0;
+  for (const auto& shard : shards_) {
+    for (size_t i = 0; i <= bounds_.size(); ++i) {
+      total += shard.counts[i].load(std::memory_order_relaxed);
+    }
+  }
+  return total;
+}
+
+void ShardedHistogram::Flush() {
+  const size_t num_buckets = bounds_.size() + 1;
+  std::vector<double> deltas(num_buckets, 0.0);
+  double total_sum = 0;
+  std::vector<uint64_t> totals(num_buckets, 0);
+  for (const auto& shard : shards_) {
+    for (size_t i = 0; i < num_buckets; ++i) {
+      totals[i] += shard.counts[i].load(std::memory_order_relaxed);
+    }
+    total_sum += shard.sum.load(std::memory_order_relaxed);
+  }
+  bool any = false;
+  for (size_t i = 0; i < num_buckets; ++i) {
+    deltas[i] = static_cast<double>(totals[i] - flushed_counts_[i]);
+    any = any || totals[i] != flushed_counts_[i];
+  }
+  if (!any) {
+    return;
+  }
+  histogram_.ObserveMultiple(deltas, total_sum - flushed_sum_);
+  flushed_counts_ = std::move(totals);
+  flushed_sum_ = total_sum;
+}
+
+}  // namespace px
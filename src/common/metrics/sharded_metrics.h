@@ -0,0 +1,144 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <prometheus/counter.h>
+#include <prometheus/histogram.h>
+
+#include "src/common/base/base.h"
+#include "src/common/metrics/metrics.h"
+
+namespace px {
+
+/**
+ * Sharded metric primitives for hot paths.
+ *
+ * The prometheus-cpp metrics behind GetMetricsRegistry() synchronize on every update, which is
+ * why per-event paths (socket tracer events, per-batch exec counters) have avoided dense
+ * instrumentation. These primitives stripe updates across cache-line-padded shards, one per
+ * thread, so the hot-path cost is a relaxed add to a cache line no other thread touches.
+ *
+ * Each sharded metric fronts a regular prometheus metric in the global registry.
+ * FlushShardedMetrics() folds the shard deltas into the backing metrics; the metrics push path
+ * calls it right before collecting the registry, so scrapes see up-to-date values while updates
+ * stay unsynchronized.
+ */
+
+// Base class wiring a sharded metric into the flush-on-scrape list.
+class ShardedMetric : public NotCopyable {
+ public:
+  virtual ~ShardedMetric();
+  // Folds shard contents into the backing prometheus metric.
+  virtual void Flush() = 0;
+
+ protected:
+  ShardedMetric();
+
+  static constexpr size_t kNumShards = 64;
+
+  // Each thread sticks to one shard, assigned round-robin on first use.
+  static size_t ShardIndex() {
+    static std::atomic<size_t> next_shard{0};
+    thread_local size_t idx = next_shard.fetch_add(1, std::memory_order_relaxed) % kNumShards;
+    return idx;
+  }
+};
+
+// Flushes all live sharded metrics into their backing prometheus metrics. Called by the metrics
+// push/scrape path before collecting the registry.
+void FlushShardedMetrics();
+
+class ShardedCounter final : public ShardedMetric {
+ public:
+  ShardedCounter(const std::string& name, const std::string& help)
+      : counter_(::BuildCounter(name, help)) {}
+
+  void Increment(uint64_t n = 1) {
+    shards_[ShardIndex()].val.fetch_add(n, std::memory_order_relaxed);
+  }
+
+  // Aggregate across shards; approximate while writers are active (like any scrape).
+  uint64_t Value() const {
+    uint64_t total = 0;
+    for (const auto& shard : shards_) {
+      total += shard.val.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  void Flush() override;
+
+ private:
+  struct alignas(64) Shard {
+    std::atomic<uint64_t> val{0};
+  };
+  std::array<Shard, kNumShards> shards_;
+
+  prometheus::Counter& counter_;
+  uint64_t flushed_ = 0;
+};
+
+class ShardedHistogram final : public ShardedMetric {
+ public:
+  // bounds are the upper bucket boundaries, sorted ascending (the +Inf bucket is implicit).
+  ShardedHistogram(const std::string& name, const std::string& help, std::vector<double> bounds);
+
+  void Observe(double val) {
+    auto& shard = shards_[ShardIndex()];
+    shard.counts[BucketIndex(val)].fetch_add(1, std::memory_order_relaxed);
+    // fetch_add on atomic<double> needs C++20, so add via CAS. Uncontended in practice since
+    // the shard belongs to this thread.
+    double sum = shard.sum.load(std::memory_order_relaxed);
+    while (!shard.sum.compare_exchange_weak(sum, sum + val, std::memory_order_relaxed)) {
+    }
+  }
+
+  uint64_t TotalCount() const;
+
+  void Flush() override;
+
+ private:
+  size_t BucketIndex(double val) const {
+    size_t i = 0;
+    while (i < bounds_.size() && val > bounds_[i]) {
+      ++i;
+    }
+    return i;
+  }
+
+  struct alignas(64) Shard {
+    std::unique_ptr<std::atomic<uint64_t>[]> counts;
+    std::atomic<double> sum{0.0};
+  };
+
+  const std::vector<double> bounds_;
+  std::array<Shard, kNumShards> shards_;
+
+  prometheus::Histogram& histogram_;
+  std::vector<uint64_t> flushed_counts_;
+  double flushed_sum_ = 0.0;
+};
+
+}  // namespace px
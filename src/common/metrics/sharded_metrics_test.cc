@@ -0,0 +1,109 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/metrics/sharded_metrics.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace px {
+
+TEST(ShardedCounterTest, concurrent_increments_are_all_counted) {
+  TestOnlyResetMetricsRegistry();
+  ShardedCounter counter("sharded_counter_test", "test counter");
+
+  constexpr int kNumThreads = 8;
+  constexpr int kIncrementsPerThread = 10000;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&counter] {
+      for (int j = 0; j < kIncrementsPerThread; ++j) {
+        counter.Increment();
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  EXPECT_EQ(kNumThreads * kIncrementsPerThread, counter.Value());
+}
+
+TEST(ShardedCounterTest, flush_folds_deltas_into_registry) {
+  TestOnlyResetMetricsRegistry();
+  ShardedCounter counter("sharded_counter_flush_test", "test counter");
+  counter.Increment(5);
+  FlushShardedMetrics();
+  counter.Increment(3);
+  FlushShardedMetrics();
+  // A third flush with no new increments must not double-count.
+  FlushShardedMetrics();
+
+  auto families = GetMetricsRegistry().Collect();
+  for (const auto& family : families) {
+    if (family.name != "sharded_counter_flush_test") {
+      continue;
+    }
+    ASSERT_EQ(1U, family.metric.size());
+    EXPECT_DOUBLE_EQ(8.0, family.metric[0].counter.value);
+    return;
+  }
+  FAIL() << "counter family not found in registry";
+}
+
+TEST(ShardedHistogramTest, observations_land_in_buckets) {
+  TestOnlyResetMetricsRegistry();
+  ShardedHistogram hist("sharded_histogram_test", "test histogram", {10.0, 100.0});
+
+  constexpr int kNumThreads = 4;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&hist] {
+      hist.Observe(1.0);    // <= 10
+      hist.Observe(50.0);   // <= 100
+      hist.Observe(1000.0);  // +Inf
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  EXPECT_EQ(3U * kNumThreads, hist.TotalCount());
+
+  FlushShardedMetrics();
+  auto families = GetMetricsRegistry().Collect();
+  for (const auto& family : families) {
+    if (family.name != "sharded_histogram_test") {
+      continue;
+    }
+    ASSERT_EQ(1U, family.metric.size());
+    const auto& h = family.metric[0].histogram;
+    EXPECT_EQ(3U * kNumThreads, h.sample_count);
+    EXPECT_DOUBLE_EQ(kNumThreads * (1.0 + 50.0 + 1000.0), h.sample_sum);
+    ASSERT_EQ(3U, h.bucket.size());
+    // Prometheus buckets are cumulative.
+    EXPECT_EQ(1U * kNumThreads, h.bucket[0].cumulative_count);
+    EXPECT_EQ(2U * kNumThreads, h.bucket[1].cumulative_count);
+    EXPECT_EQ(3U * kNumThreads, h.bucket[2].cumulative_count);
+    return;
+  }
+  FAIL() << "histogram family not found in registry";
+}
+
+}  // namespace px
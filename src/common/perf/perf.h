@@ -22,6 +22,7 @@
  * importing them everywhere.
  */
 
+#include "src/common/perf/cycle_counter.h"    // IWYU pragma: export
 #include "src/common/perf/elapsed_timer.h"    // IWYU pragma: export
 #include "src/common/perf/profiler.h"         // IWYU pragma: export
 #include "src/common/perf/scoped_profiler.h"  // IWYU pragma: export
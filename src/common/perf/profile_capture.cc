@@ -0,0 +1,79 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/perf/profile_capture.h"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+#include <absl/synchronization/mutex.h>
+
+#include "src/common/base/file.h"
+
+#ifdef TCMALLOC
+#include <gperftools/malloc_extension.h>
+#endif
+
+namespace px {
+namespace profiler {
+
+namespace {
+
+// Serializes CPU captures: the gperftools CPU profiler is process-global.
+absl::Mutex cpu_capture_mutex;
+
+}  // namespace
+
+StatusOr<std::string> ProfileCapture::CPUProfile(std::chrono::milliseconds duration) {
+  absl::MutexLock lock(&cpu_capture_mutex);
+
+  if (!CPU::ProfilerAvailable()) {
+    return error::FailedPrecondition(
+        "CPU profiler is not available (not built with tcmalloc, or a profile is already "
+        "running).");
+  }
+
+  // The profiler only writes to files, so capture through a scratch file and read it back.
+  static std::atomic<int> seq = 0;
+  std::string path = absl::Substitute("/tmp/px_cpu_profile_$0_$1.pprof", getpid(), seq++);
+  if (!CPU::StartProfiler(path)) {
+    return error::Internal("Failed to start the CPU profiler.");
+  }
+  std::this_thread::sleep_for(duration);
+  CPU::StopProfiler();
+
+  PX_ASSIGN_OR_RETURN(std::string profile, ReadFileToString(path, std::ios_base::binary));
+  std::remove(path.c_str());
+  return profile;
+}
+
+StatusOr<std::string> ProfileCapture::HeapProfile() {
+#ifdef TCMALLOC
+  std::string profile;
+  MallocExtension::instance()->GetHeapSample(&profile);
+  return profile;
+#else
+  return error::FailedPrecondition("Heap profiler is not available (not built with tcmalloc).");
+#endif
+}
+
+}  // namespace profiler
+}  // namespace px
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include "src/common/base/base.h"
+#include "src/common/perf/profiler.h"
+
+namespace px {
+namespace profiler {
+
+/**
+ * On-demand, in-memory profile captures for running binaries.
+ *
+ * The raw CPU/Heap wrappers in profiler.h write files on disk and require the operator to know
+ * the gperftools start/stop protocol (env-var triggering does not work in our statically-linked
+ * binaries, see README.md). This class packages a complete capture -- start, sample, stop, read
+ * back -- and hands the pprof-format bytes to the caller, so an in-process surface (e.g. a debug
+ * UDTF) can return a profile from a live agent without a redeploy.
+ *
+ * Captures are serialized internally: the gperftools CPU profiler is process-global, so a capture
+ * that arrives while another is in flight fails with FailedPrecondition rather than corrupting
+ * the running profile.
+ */
+class ProfileCapture {
+ public:
+  /**
+   * Profiles the CPU for the given duration (blocking the calling thread), and returns the
+   * pprof-format profile bytes. Call from a background thread, not a latency-sensitive one.
+   */
+  static StatusOr<std::string> CPUProfile(std::chrono::milliseconds duration);
+
+  /**
+   * Returns a sampled snapshot of live heap allocations in pprof text format.
+   *
+   * Relies on tcmalloc's always-on allocation sampling, so it is cheap and does not require the
+   * heap profiler to have been started. Note the sampling rate is controlled by the
+   * TCMALLOC_SAMPLE_PARAMETER env var; with sampling disabled the snapshot contains no stacks.
+   */
+  static StatusOr<std::string> HeapProfile();
+};
+
+}  // namespace profiler
+}  // namespace px
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/perf/profile_capture.h"
+
+#include <gtest/gtest.h>
+
+#include "src/common/base/error.h"
+
+namespace px {
+namespace profiler {
+
+// Whether the profilers are compiled in depends on the build configuration, so these tests
+// verify both possible outcomes of each capture.
+
+TEST(ProfileCaptureTest, cpu_profile) {
+  auto profile_or_s = ProfileCapture::CPUProfile(std::chrono::milliseconds{100});
+  if (CPU::ProfilerAvailable()) {
+    ASSERT_OK(profile_or_s);
+    EXPECT_FALSE(profile_or_s.ConsumeValueOrDie().empty());
+  } else {
+    EXPECT_TRUE(error::IsFailedPrecondition(profile_or_s.status()));
+  }
+}
+
+TEST(ProfileCaptureTest, heap_profile) {
+  auto profile_or_s = ProfileCapture::HeapProfile();
+#ifdef TCMALLOC
+  ASSERT_OK(profile_or_s);
+  EXPECT_FALSE(profile_or_s.ConsumeValueOrDie().empty());
+#else
+  EXPECT_TRUE(error::IsFailedPrecondition(profile_or_s.status()));
+#endif
+}
+
+}  // namespace profiler
+}  // namespace px
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/system/numa.h"
+
+#include <sched.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <thread>
+#include <utility>
+
+#include <absl/strings/str_split.h>
+
+#include "src/common/base/file.h"
+
+namespace px {
+namespace system {
+
+StatusOr<std::vector<int>> ParseCpuList(std::string_view cpulist) {
+  std::vector<int> cpus;
+  for (std::string_view part : absl::StrSplit(cpulist, ',', absl::SkipWhitespace())) {
+    part = absl::StripAsciiWhitespace(part);
+    size_t dash = part.find('-');
+    int lo;
+    int hi;
+    if (dash == part.npos) {
+      if (!absl::SimpleAtoi(part, &lo)) {
+        return error::InvalidArgument("Invalid cpulist entry: $0", std::string(part));
+      }
+      hi = lo;
+    } else {
+      if (!absl::SimpleAtoi(part.substr(0, dash), &lo) ||
+          !absl::SimpleAtoi(part.substr(dash + 1), &hi) || hi < lo) {
+        return error::InvalidArgument("Invalid cpulist range: $0", std::string(part));
+      }
+    }
+    for (int cpu = lo; cpu <= hi; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+NumaTopology::NumaTopology() {
+  const std::filesystem::path node_dir = "/sys/devices/system/node";
+  for (size_t node = 0;; ++node) {
+    auto cpulist_path = node_dir / absl::Substitute("node$0/cpulist", node);
+    auto contents_or_s = ReadFileToString(cpulist_path.string());
+    if (!contents_or_s.ok()) {
+      break;
+    }
+    auto cpus_or_s = ParseCpuList(contents_or_s.ConsumeValueOrDie());
+    if (!cpus_or_s.ok()) {
+      LOG(WARNING) << absl::Substitute("Could not parse $0: $1", cpulist_path.string(),
+                                       cpus_or_s.msg());
+      break;
+    }
+    cpus_per_node_.push_back(cpus_or_s.ConsumeValueOrDie());
+  }
+
+  if (cpus_per_node_.empty()) {
+    // No NUMA information: treat the machine as one node owning every CPU.
+    std::vector<int> cpus(std::thread::hardware_concurrency());
+    for (size_t i = 0; i < cpus.size(); ++i) {
+      cpus[i] = static_cast<int>(i);
+    }
+    cpus_per_node_.push_back(std::move(cpus));
+  }
+
+  for (size_t node = 0; node < cpus_per_node_.size(); ++node) {
+    for (int cpu : cpus_per_node_[node]) {
+      if (static_cast<size_t>(cpu) >= cpu_to_node_.size()) {
+        cpu_to_node_.resize(cpu + 1, -1);
+      }
+      cpu_to_node_[cpu] = static_cast<int>(node);
+    }
+  }
+}
+
+const NumaTopology& NumaTopology::GetInstance() {
+  static const NumaTopology topology;
+  return topology;
+}
+
+int NumaTopology::NodeOfCpu(int cpu) const {
+  if (cpu < 0 || static_cast<size_t>(cpu) >= cpu_to_node_.size()) {
+    return -1;
+  }
+  return cpu_to_node_[cpu];
+}
+
+int NumaTopology::NodeOfCurrentThread() const { return NodeOfCpu(sched_getcpu()); }
+
+Status NumaTopology::BindCurrentThreadToNode(size_t node) const {
+  if (node >= cpus_per_node_.size()) {
+    return error::InvalidArgument("No such NUMA node: $0", node);
+  }
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  for (int cpu : cpus_per_node_[node]) {
+    CPU_SET(cpu, &cpuset);
+  }
+  if (sched_setaffinity(0, sizeof(cpuset), &cpuset) != 0) {
+    return error::Internal("sched_setaffinity failed [errno=$0]", errno);
+  }
+  return Status::OK();
+}
+
+}  // namespace system
+}  // namespace px
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "src/common/base/base.h"
+
+namespace px {
+namespace system {
+
+/**
+ * NUMA topology of the host, parsed once from /sys/devices/system/node.
+ *
+ * On single-socket machines (or when sysfs is unavailable) the topology collapses to one node
+ * holding every CPU, so callers can use it unconditionally. Does not require libnuma.
+ */
+class NumaTopology : public NotCopyable {
+ public:
+  static const NumaTopology& GetInstance();
+
+  size_t num_nodes() const { return cpus_per_node_.size(); }
+
+  // Returns the node owning the given CPU, or -1 if unknown.
+  int NodeOfCpu(int cpu) const;
+
+  // Returns the node the calling thread is currently running on, or -1 if unknown.
+  int NodeOfCurrentThread() const;
+
+  const std::vector<int>& CpusOnNode(size_t node) const { return cpus_per_node_[node]; }
+
+  // Restricts the calling thread to the CPUs of the given node.
+  Status BindCurrentThreadToNode(size_t node) const;
+
+ private:
+  NumaTopology();
+
+  std::vector<std::vector<int>> cpus_per_node_;
+  std::vector<int> cpu_to_node_;
+};
+
+// Parses a sysfs cpulist string, e.g. "0-3,8,10-11". Exposed for testing.
+StatusOr<std::vector<int>> ParseCpuList(std::string_view cpulist);
+
+}  // namespace system
+}  // namespace px
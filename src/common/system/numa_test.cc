@@ -0,0 +1,58 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/system/numa.h"
+
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace system {
+
+TEST(ParseCpuListTest, single_values_and_ranges) {
+  ASSERT_OK_AND_THAT(ParseCpuList("0"), ::testing::ElementsAre(0));
+  ASSERT_OK_AND_THAT(ParseCpuList("0-3"), ::testing::ElementsAre(0, 1, 2, 3));
+  ASSERT_OK_AND_THAT(ParseCpuList("0-3,8,10-11"), ::testing::ElementsAre(0, 1, 2, 3, 8, 10, 11));
+  // Sysfs cpulist files end with a newline.
+  ASSERT_OK_AND_THAT(ParseCpuList("4-5\n"), ::testing::ElementsAre(4, 5));
+}
+
+TEST(ParseCpuListTest, invalid_inputs) {
+  EXPECT_NOT_OK(ParseCpuList("abc"));
+  EXPECT_NOT_OK(ParseCpuList("3-1"));
+  EXPECT_NOT_OK(ParseCpuList("1-"));
+}
+
+TEST(NumaTopologyTest, topology_is_consistent) {
+  const auto& topology = NumaTopology::GetInstance();
+  // Even without NUMA information the topology falls back to a single node.
+  ASSERT_GE(topology.num_nodes(), 1);
+  for (size_t node = 0; node < topology.num_nodes(); ++node) {
+    for (int cpu : topology.CpusOnNode(node)) {
+      EXPECT_EQ(static_cast<int>(node), topology.NodeOfCpu(cpu));
+    }
+  }
+  EXPECT_EQ(-1, topology.NodeOfCpu(-1));
+
+  int node = topology.NodeOfCurrentThread();
+  if (node >= 0) {
+    EXPECT_LT(static_cast<size_t>(node), topology.num_nodes());
+  }
+}
+
+}  // namespace system
+}  // namespace px
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/system/proc_connector.h"
+
+#include <linux/cn_proc.h>
+#include <linux/connector.h>
+#include <linux/netlink.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace px {
+namespace system {
+
+Status NetlinkProcEventListener::Connect() {
+  fd_ = socket(AF_NETLINK, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_CONNECTOR);
+  if (fd_ < 0) {
+    return error::Internal("Could not create NETLINK_CONNECTOR socket. [errno=$0]", errno);
+  }
+
+  struct sockaddr_nl nl_addr = {};
+  nl_addr.nl_family = AF_NETLINK;
+  nl_addr.nl_groups = CN_IDX_PROC;
+
+  if (bind(fd_, reinterpret_cast<struct sockaddr*>(&nl_addr), sizeof(nl_addr)) < 0) {
+    return error::Internal("Could not bind to proc connector multicast group. [errno=$0]", errno);
+  }
+
+  return SetMulticastListen(true);
+}
+
+Status NetlinkProcEventListener::SetMulticastListen(bool enable) {
+  struct __attribute__((aligned(NLMSG_ALIGNTO))) {
+    struct nlmsghdr nl_hdr;
+    struct __attribute__((__packed__)) {
+      struct cn_msg cn_msg;
+      enum proc_cn_mcast_op mcast_op;
+    } body;
+  } msg = {};
+
+  msg.nl_hdr.nlmsg_len = sizeof(msg);
+  msg.nl_hdr.nlmsg_type = NLMSG_DONE;
+
+  msg.body.cn_msg.id.idx = CN_IDX_PROC;
+  msg.body.cn_msg.id.val = CN_VAL_PROC;
+  msg.body.cn_msg.len = sizeof(enum proc_cn_mcast_op);
+  msg.body.mcast_op = enable ? PROC_CN_MCAST_LISTEN : PROC_CN_MCAST_IGNORE;
+
+  if (send(fd_, &msg, sizeof(msg), 0) != sizeof(msg)) {
+    return error::Internal("Could not subscribe to proc connector events. [errno=$0]", errno);
+  }
+  return Status::OK();
+}
+
+StatusOr<std::unique_ptr<NetlinkProcEventListener>> NetlinkProcEventListener::Create() {
+  auto listener = std::unique_ptr<NetlinkProcEventListener>(new NetlinkProcEventListener);
+  PX_RETURN_IF_ERROR(listener->Connect());
+  return listener;
+}
+
+NetlinkProcEventListener::~NetlinkProcEventListener() {
+  if (fd_ >= 0) {
+    // Best effort: tell the kernel we no longer want events before closing.
+    Status s = SetMulticastListen(false);
+    PX_UNUSED(s);
+    close(fd_);
+  }
+}
+
+Status NetlinkProcEventListener::PollEvents(std::vector<ProcEvent>* events) {
+  DCHECK(events != nullptr);
+
+  alignas(NLMSG_ALIGNTO) char buf[4096];
+  while (true) {
+    ssize_t len = recv(fd_, buf, sizeof(buf), 0);
+    if (len < 0) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        // The queue is drained.
+        return Status::OK();
+      }
+      if (errno == ENOBUFS) {
+        // The kernel dropped events because we fell behind; the caller must resync.
+        return error::ResourceUnavailable("Proc connector event queue overflowed.");
+      }
+      return error::Internal("Failed to read proc connector events. [errno=$0]", errno);
+    }
+
+    for (struct nlmsghdr* nl_hdr = reinterpret_cast<struct nlmsghdr*>(buf); NLMSG_OK(nl_hdr, len);
+         nl_hdr = NLMSG_NEXT(nl_hdr, len)) {
+      if (nl_hdr->nlmsg_type != NLMSG_DONE) {
+        continue;
+      }
+      auto* cn_hdr = reinterpret_cast<struct cn_msg*>(NLMSG_DATA(nl_hdr));
+      if (cn_hdr->id.idx != CN_IDX_PROC || cn_hdr->id.val != CN_VAL_PROC) {
+        continue;
+      }
+      auto* proc_ev = reinterpret_cast<struct proc_event*>(cn_hdr->data);
+      switch (proc_ev->what) {
+        case proc_event::PROC_EVENT_FORK:
+          // Only report new thread group leaders: thread creation is also delivered as a fork.
+          if (proc_ev->event_data.fork.child_pid == proc_ev->event_data.fork.child_tgid) {
+            events->push_back({ProcEvent::Type::kFork,
+                               static_cast<uint32_t>(proc_ev->event_data.fork.child_tgid)});
+          }
+          break;
+        case proc_event::PROC_EVENT_EXEC:
+          events->push_back({ProcEvent::Type::kExec,
+                             static_cast<uint32_t>(proc_ev->event_data.exec.process_tgid)});
+          break;
+        case proc_event::PROC_EVENT_EXIT:
+          // Only report the exit of the thread group leader, which ends the process.
+          if (proc_ev->event_data.exit.process_pid == proc_ev->event_data.exit.process_tgid) {
+            events->push_back({ProcEvent::Type::kExit,
+                               static_cast<uint32_t>(proc_ev->event_data.exit.process_tgid)});
+          }
+          break;
+        default:
+          break;
+      }
+    }
+  }
+}
+
+}  // namespace system
+}  // namespace px
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "src/common/base/base.h"
+
+namespace px {
+namespace system {
+
+/**
+ * A process lifecycle event from the kernel's proc connector.
+ * Events are reported at process (thread group) granularity.
+ */
+struct ProcEvent {
+  enum class Type {
+    kFork,
+    kExec,
+    kExit,
+  };
+
+  Type type;
+  uint32_t pid;
+};
+
+/**
+ * NetlinkProcEventListener subscribes to the kernel's proc connector (NETLINK_CONNECTOR /
+ * CN_IDX_PROC) and reports process fork/exec/exit events, so process discovery can be
+ * event-driven instead of repeatedly listing /proc.
+ *
+ * Requires CAP_NET_ADMIN; Create() fails otherwise and callers are expected to fall back to
+ * /proc scanning.
+ */
+class NetlinkProcEventListener : NotCopyable {
+ public:
+  static StatusOr<std::unique_ptr<NetlinkProcEventListener>> Create();
+  ~NetlinkProcEventListener();
+
+  /**
+   * Drains pending events from the netlink socket (non-blocking) and appends them to events.
+   * Kernel-side queue overruns are reported as an error, in which case the caller should resync
+   * with a full /proc scan.
+   */
+  Status PollEvents(std::vector<ProcEvent>* events);
+
+ private:
+  NetlinkProcEventListener() = default;
+
+  Status Connect();
+  Status SetMulticastListen(bool enable);
+
+  int fd_ = -1;
+};
+
+}  // namespace system
+}  // namespace px
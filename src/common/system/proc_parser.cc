@@ -16,6 +16,9 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <fcntl.h>
+#include <unistd.h>
+
 #include <fstream>
 #include <limits>
 #include <string>
@@ -215,56 +218,87 @@ Status ProcParser::ParseProcPIDStat(int32_t pid, int64_t page_size_bytes,
   }
 
   std::string line;
-  bool ok = true;
-  if (std::getline(ifs, line)) {
-    std::vector<std::string_view> split = absl::StrSplit(line, " ", absl::SkipWhitespace());
-    // We check less than in case more fields are added later.
-    if (split.size() < kProcStatNumFields) {
-      return error::Unknown("Incorrect number of fields in stat file: $0.", fpath.string());
-    }
+  if (!std::getline(ifs, line)) {
+    return error::Internal("Failed to read proc stat file: $0.", fpath.string());
+  }
 
-    // The name is surrounded by (). We remove it first.
-    size_t open_paren_idx = line.find_first_of('(');
-    size_t close_paren_idx = line.find_last_of(')');
-    if (open_paren_idx == std::string::npos || close_paren_idx == std::string::npos) {
-      return error::Internal("Invalid command name in file $0.", fpath.string());
-    }
-    out->process_name = line.substr(open_paren_idx + 1, close_paren_idx - open_paren_idx - 1);
+  Status s = ParseProcPIDStatContents(line, page_size_bytes, kernel_tick_time_ns, out);
+  if (!s.ok()) {
+    return error::Internal("$0 [file=$1]", s.msg(), fpath.string());
+  }
+  return Status::OK();
+}
 
-    // When split_size > kProcStatNumFields, there are spaces in the command we need to handle.
-    // command_offset adjusts index for the number of spaces in the command field.
-    int command_offset = std::count(out->process_name.begin(), out->process_name.end(), ' ');
+Status ProcParser::ParseProcPIDStatContents(std::string_view contents, int64_t page_size_bytes,
+                                            int64_t kernel_tick_time_ns, ProcessStats* out) {
+  DCHECK(out != nullptr);
 
-    ok &= absl::SimpleAtoi(split[kProcStatPIDField], &out->pid);
+  // Only the first line is meaningful; the file normally contains exactly one.
+  std::string_view line = contents.substr(0, contents.find('\n'));
 
-    ok &= absl::SimpleAtoi(split[kProcStatMinorFaultsField + command_offset], &out->minor_faults);
-    ok &= absl::SimpleAtoi(split[kProcStatMajorFaultsField + command_offset], &out->major_faults);
+  std::vector<std::string_view> split = absl::StrSplit(line, " ", absl::SkipWhitespace());
+  // We check less than in case more fields are added later.
+  if (split.size() < kProcStatNumFields) {
+    return error::Unknown("Incorrect number of fields in proc stat data.");
+  }
 
-    ok &= absl::SimpleAtoi(split[kProcStatUTimeField + command_offset], &out->utime_ns);
-    ok &= absl::SimpleAtoi(split[kProcStatKTimeField + command_offset], &out->ktime_ns);
-    // The kernel tracks utime and ktime in kernel ticks.
-    out->utime_ns *= kernel_tick_time_ns;
-    out->ktime_ns *= kernel_tick_time_ns;
+  // The name is surrounded by (). We remove it first.
+  size_t open_paren_idx = line.find_first_of('(');
+  size_t close_paren_idx = line.find_last_of(')');
+  if (open_paren_idx == std::string_view::npos || close_paren_idx == std::string_view::npos) {
+    return error::Internal("Invalid command name in proc stat data.");
+  }
+  out->process_name =
+      std::string(line.substr(open_paren_idx + 1, close_paren_idx - open_paren_idx - 1));
 
-    ok &= absl::SimpleAtoi(split[kProcStatNumThreadsField + command_offset], &out->num_threads);
-    ok &= absl::SimpleAtoi(split[kProcStatVSizeField + command_offset], &out->vsize_bytes);
-    ok &= absl::SimpleAtoi(std::string(split[kProcStatRSSField + command_offset]), &out->rss_bytes);
+  // When split_size > kProcStatNumFields, there are spaces in the command we need to handle.
+  // command_offset adjusts index for the number of spaces in the command field.
+  int command_offset = std::count(out->process_name.begin(), out->process_name.end(), ' ');
 
-    // RSS is in pages.
-    out->rss_bytes *= page_size_bytes;
+  bool ok = true;
+  ok &= absl::SimpleAtoi(split[kProcStatPIDField], &out->pid);
 
-  } else {
-    return error::Internal("Failed to read proc stat file: $0.", fpath.string());
-  }
+  ok &= absl::SimpleAtoi(split[kProcStatMinorFaultsField + command_offset], &out->minor_faults);
+  ok &= absl::SimpleAtoi(split[kProcStatMajorFaultsField + command_offset], &out->major_faults);
+
+  ok &= absl::SimpleAtoi(split[kProcStatUTimeField + command_offset], &out->utime_ns);
+  ok &= absl::SimpleAtoi(split[kProcStatKTimeField + command_offset], &out->ktime_ns);
+  // The kernel tracks utime and ktime in kernel ticks.
+  out->utime_ns *= kernel_tick_time_ns;
+  out->ktime_ns *= kernel_tick_time_ns;
+
+  ok &= absl::SimpleAtoi(split[kProcStatNumThreadsField + command_offset], &out->num_threads);
+  ok &= absl::SimpleAtoi(split[kProcStatVSizeField + command_offset], &out->vsize_bytes);
+  ok &= absl::SimpleAtoi(std::string(split[kProcStatRSSField + command_offset]), &out->rss_bytes);
+
+  // RSS is in pages.
+  out->rss_bytes *= page_size_bytes;
 
   if (!ok) {
     // This should never happen since it requires the file to be ill-formed
     // by the kernel.
-    return error::Internal("Failed to parse stat file: $0. ATOI failed.", fpath.string());
+    return error::Internal("Failed to parse proc stat data. ATOI failed.");
   }
   return Status::OK();
 }
 
+namespace {
+
+const absl::flat_hash_map<std::string_view, size_t>& ProcIOFieldToOffsetMap() {
+  // Just to be safe when using offsetof, make sure object is standard layout.
+  static_assert(std::is_standard_layout<ProcParser::ProcessStats>::value);
+
+  static const absl::flat_hash_map<std::string_view, size_t> field_name_to_offset_map{
+      {"rchar", offsetof(ProcParser::ProcessStats, rchar_bytes)},
+      {"wchar", offsetof(ProcParser::ProcessStats, wchar_bytes)},
+      {"read_bytes", offsetof(ProcParser::ProcessStats, read_bytes)},
+      {"write_bytes", offsetof(ProcParser::ProcessStats, write_bytes)},
+  };
+  return field_name_to_offset_map;
+}
+
+}  // namespace
+
 Status ProcParser::ParseProcPIDStatIO(int32_t pid, ProcessStats* out) const {
   /**
    * Sample file:
@@ -279,17 +313,16 @@ Status ProcParser::ParseProcPIDStatIO(int32_t pid, ProcessStats* out) const {
   DCHECK(out != nullptr);
   const auto fpath = ProcPidPath(pid, "io");
 
-  // Just to be safe when using offsetof, make sure object is standard layout.
-  static_assert(std::is_standard_layout<ProcessStats>::value);
+  return ParseFromKeyValueFile(fpath, ProcIOFieldToOffsetMap(), reinterpret_cast<uint8_t*>(out));
+}
 
-  static absl::flat_hash_map<std::string_view, size_t> field_name_to_offset_map{
-      {"rchar", offsetof(ProcessStats, rchar_bytes)},
-      {"wchar", offsetof(ProcessStats, wchar_bytes)},
-      {"read_bytes", offsetof(ProcessStats, read_bytes)},
-      {"write_bytes", offsetof(ProcessStats, write_bytes)},
-  };
+Status ProcParser::ParseProcPIDStatIOContents(std::string_view contents, ProcessStats* out) {
+  DCHECK(out != nullptr);
 
-  return ParseFromKeyValueFile(fpath, field_name_to_offset_map, reinterpret_cast<uint8_t*>(out));
+  for (std::string_view line : absl::StrSplit(contents, '\n', absl::SkipEmpty())) {
+    ParseFromKeyValueLine(line, ProcIOFieldToOffsetMap(), reinterpret_cast<uint8_t*>(out));
+  }
+  return Status::OK();
 }
 
 Status ProcParser::ParseProcStat(SystemStats* out) const {
@@ -536,7 +569,7 @@ Status ProcParser::ParseProcPIDSMaps(int32_t pid, std::vector<ProcessSMaps>* out
 }
 
 void ProcParser::ParseFromKeyValueLine(
-    const std::string& line,
+    std::string_view line,
     const absl::flat_hash_map<std::string_view, size_t>& field_name_to_value_map,
     uint8_t* out_base) {
   std::vector<std::string_view> split = absl::StrSplit(line, ':', absl::SkipWhitespace());
@@ -646,6 +679,30 @@ Status ProcParser::ReadProcPIDFDLink(int32_t pid, int32_t fd, std::string* out)
   return Status::OK();
 }
 
+Status ProcParser::ReadProcPIDFDLinks(int32_t pid,
+                                      absl::flat_hash_map<int32_t, std::string>* out) const {
+  const auto fd_dir = ProcPidPath(pid, "fd");
+
+  std::error_code ec;
+  std::filesystem::directory_iterator dir_iter(fd_dir, ec);
+  if (ec) {
+    return error::Internal("Failed to open $0 [msg=$1].", fd_dir.string(), ec.message());
+  }
+
+  for (const auto& p : dir_iter) {
+    int32_t fd = 0;
+    if (!absl::SimpleAtoi(p.path().filename().string(), &fd)) {
+      continue;
+    }
+
+    // An FD may be closed between the directory listing and the readlink; just skip it.
+    PX_ASSIGN_OR(std::filesystem::path link, fs::ReadSymlink(p.path()), continue);
+    (*out)[fd] = std::move(link);
+  }
+
+  return Status::OK();
+}
+
 std::string_view LineWithPrefix(std::string_view content, std::string_view prefix) {
   const std::vector<std::string_view> lines = absl::StrSplit(content, "\n");
   for (const auto& line : lines) {
@@ -842,5 +899,108 @@ StatusOr<ProcParser::ProcessSMaps> ProcParser::GetExecutableMapEntry(pid_t pid,
   return error::NotFound(absl::Substitute("Could not find maps entry for $0", libpath));
 }
 
+BatchedProcStatsReader::~BatchedProcStatsReader() {
+  for (const auto& [pid, fds] : fds_) {
+    if (fds.stat_fd >= 0) {
+      close(fds.stat_fd);
+    }
+    if (fds.io_fd >= 0) {
+      close(fds.io_fd);
+    }
+  }
+}
+
+Status BatchedProcStatsReader::ReadWholeFile(int32_t pid, const char* file, int* fd,
+                                             std::string* contents) {
+  if (*fd < 0) {
+    const std::filesystem::path fpath = ProcPidPath(pid, file);
+    *fd = open(fpath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (*fd < 0) {
+      return error::Internal("Failed to open file: $0.", fpath.string());
+    }
+  }
+
+  contents->clear();
+  char buf[4096];
+  off_t offset = 0;
+  while (true) {
+    const ssize_t n = pread(*fd, buf, sizeof(buf), offset);
+    if (n < 0) {
+      // The fd is likely stale (the process exited). Drop it so the next cycle reopens.
+      close(*fd);
+      *fd = -1;
+      return error::Internal("Failed to read /proc/$0/$1.", pid, file);
+    }
+    if (n == 0) {
+      break;
+    }
+    contents->append(buf, n);
+    offset += n;
+  }
+
+  if (contents->empty()) {
+    close(*fd);
+    *fd = -1;
+    return error::Internal("Empty read of /proc/$0/$1.", pid, file);
+  }
+  return Status::OK();
+}
+
+Status BatchedProcStatsReader::ReadPIDStats(int32_t pid, ProcParser::ProcessStats* out) {
+  DCHECK(out != nullptr);
+  PIDFds& fds = fds_[pid];
+
+  Status s = ReadWholeFile(pid, "stat", &fds.stat_fd, &contents_);
+  if (s.ok()) {
+    s = ProcParser::ParseProcPIDStatContents(contents_, page_size_bytes_, kernel_tick_time_ns_,
+                                             out);
+  }
+  if (!s.ok()) {
+    DropPID(pid);
+    return s;
+  }
+
+  s = ReadWholeFile(pid, "io", &fds.io_fd, &contents_);
+  if (s.ok()) {
+    s = ProcParser::ParseProcPIDStatIOContents(contents_, out);
+  }
+  if (!s.ok()) {
+    DropPID(pid);
+    return s;
+  }
+
+  return Status::OK();
+}
+
+void BatchedProcStatsReader::DropPID(int32_t pid) {
+  auto it = fds_.find(pid);
+  if (it == fds_.end()) {
+    return;
+  }
+  if (it->second.stat_fd >= 0) {
+    close(it->second.stat_fd);
+  }
+  if (it->second.io_fd >= 0) {
+    close(it->second.io_fd);
+  }
+  fds_.erase(it);
+}
+
+void BatchedProcStatsReader::RetainPIDs(const absl::flat_hash_set<int32_t>& pids) {
+  for (auto it = fds_.begin(); it != fds_.end();) {
+    if (pids.contains(it->first)) {
+      ++it;
+      continue;
+    }
+    if (it->second.stat_fd >= 0) {
+      close(it->second.stat_fd);
+    }
+    if (it->second.io_fd >= 0) {
+      close(it->second.io_fd);
+    }
+    fds_.erase(it++);
+  }
+}
+
 }  // namespace system
 }  // namespace px
@@ -40,6 +40,7 @@ using ::testing::Contains;
 using ::testing::ElementsAre;
 using ::testing::IsEmpty;
 using ::testing::MatchesRegex;
+using ::testing::Pair;
 using ::testing::Return;
 using ::testing::ReturnArg;
 using ::testing::ReturnRef;
@@ -134,6 +135,35 @@ TEST_F(ProcParserTest, ParsePidStatLargePageSize) {
   EXPECT_EQ(2577 * large_page_size, stats.rss_bytes);
 }
 
+TEST_F(ProcParserTest, BatchedProcStatsReader) {
+  PX_SET_FOR_SCOPE(FLAGS_proc_path, GetPathToTestDataFile("testdata/proc"));
+  BatchedProcStatsReader reader(bytes_per_page_, kernel_tick_time_ns_);
+
+  // Read twice: the second read exercises the cached-fd pread path.
+  for (int i = 0; i < 2; ++i) {
+    ProcParser::ProcessStats stats;
+    PX_CHECK_OK(reader.ReadPIDStats(123, &stats));
+
+    // The expected values are from the test files, and match ParsePidStat/ParseStatIO above.
+    EXPECT_EQ("npm (start)", stats.process_name);
+    EXPECT_EQ(800, stats.utime_ns);
+    EXPECT_EQ(2300, stats.ktime_ns);
+    EXPECT_EQ(2577 * bytes_per_page_, stats.rss_bytes);
+    EXPECT_EQ(5405203, stats.rchar_bytes);
+    EXPECT_EQ(634880, stats.write_bytes);
+  }
+  EXPECT_EQ(1, reader.num_cached_pids());
+
+  // A PID that doesn't exist fails and leaves no cached fds behind.
+  ProcParser::ProcessStats stats;
+  EXPECT_NOT_OK(reader.ReadPIDStats(456, &stats));
+  EXPECT_EQ(1, reader.num_cached_pids());
+
+  // Retaining an empty set drops all cached fds.
+  reader.RetainPIDs({});
+  EXPECT_EQ(0, reader.num_cached_pids());
+}
+
 TEST_F(ProcParserTest, ParsePSS) {
   PX_SET_FOR_SCOPE(FLAGS_proc_path, GetPathToTestDataFile("testdata/proc"));
   const size_t pss_bytes = parser_->ParseProcPIDPss(123).ConsumeValueOrDie();
@@ -323,6 +353,30 @@ TEST_F(ProcParserTest, read_proc_fd_link) {
   EXPECT_NOT_OK(s);
 }
 
+TEST_F(ProcParserTest, read_proc_fd_links) {
+  PX_SET_FOR_SCOPE(FLAGS_proc_path, GetPathToTestDataFile("testdata/proc"));
+  {
+    // Bazel doesn't copy symlink testdata as symlinks, so we create the missing symlink testdata
+    // here.
+    ASSERT_OK(
+        fs::CreateSymlinkIfNotExists("/dev/null", GetPathToTestDataFile("testdata/proc/123/fd/0")));
+    ASSERT_OK(
+        fs::CreateSymlinkIfNotExists("/foobar", GetPathToTestDataFile("testdata/proc/123/fd/1")));
+    ASSERT_OK(fs::CreateSymlinkIfNotExists("socket:[12345]",
+                                           GetPathToTestDataFile("testdata/proc/123/fd/2")));
+  }
+
+  absl::flat_hash_map<int32_t, std::string> links;
+  ASSERT_OK(parser_->ReadProcPIDFDLinks(123, &links));
+  EXPECT_THAT(links, UnorderedElementsAre(Pair(0, "/dev/null"), Pair(1, "/foobar"),
+                                          Pair(2, "socket:[12345]")));
+
+  // PID 456 has no fd directory in the testdata.
+  links.clear();
+  EXPECT_NOT_OK(parser_->ReadProcPIDFDLinks(456, &links));
+  EXPECT_THAT(links, IsEmpty());
+}
+
 TEST_F(ProcParserTest, ReadUIDs) {
   PX_SET_FOR_SCOPE(FLAGS_proc_path, GetPathToTestDataFile("testdata/proc"));
   ProcParser::ProcUIDs uids;
@@ -35,5 +35,15 @@ namespace zlib {
  */
 StatusOr<std::string> Inflate(std::string_view in, size_t output_block_size = 16384);
 
+/**
+ * @brief Deflates (gzip) a source buffer and returns the compressed content as a string.
+ * The output round-trips through Inflate above.
+ *
+ * @param in A view into the source buffer.
+ * @param level zlib compression level (0-9), or -1 for the zlib default.
+ * @return Status or the compressed content as a string.
+ */
+StatusOr<std::string> Deflate(std::string_view in, int level = -1);
+
 }  // namespace zlib
 }  // namespace px
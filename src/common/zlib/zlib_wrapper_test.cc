@@ -46,4 +46,13 @@ TEST_F(ZlibTest, inflate_test) {
   EXPECT_OK_AND_EQ(result, GetExpectedResult());
 }
 
+TEST_F(ZlibTest, deflate_round_trip_test) {
+  std::string input(10000, 'a');
+  input += "This is a test\n";
+
+  ASSERT_OK_AND_ASSIGN(auto compressed, px::zlib::Deflate(input));
+  EXPECT_LT(compressed.size(), input.size());
+  EXPECT_OK_AND_EQ(px::zlib::Inflate(compressed), input);
+}
+
 }  // namespace px
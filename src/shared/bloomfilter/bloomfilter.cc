@@ -17,6 +17,7 @@
  */
 
 #include <math.h>
+#include <cstring>
 #include <memory>
 #include <utility>
 
@@ -116,5 +117,128 @@ bool XXHash64BloomFilter::Contains(std::string_view item) const {
   return true;
 }
 
+StatusOr<std::unique_ptr<XXHash64BlockBloomFilter>> XXHash64BlockBloomFilter::Create(
+    int64_t max_entries, double error_rate) {
+  if (error_rate <= 0.0 || error_rate >= 1.0) {
+    return error::Internal(
+        "Bloom filter error rate must be greater than 0 and less than 1, received %e", error_rate);
+  }
+  if (max_entries <= 0) {
+    return error::Internal("Bloom filter must have a maximum of at least 1 entry, received %d",
+                           max_entries);
+  }
+
+  // Size the bit array as for a classic bloom filter, then round up to whole 512-bit blocks.
+  // Blocked filters have a slightly higher false positive rate at the same density (all 8 probe
+  // bits land in one block), so budget an extra block of headroom for small filters.
+  double bpe = -(std::log(error_rate) / std::pow(std::log(2), 2));
+  int64_t num_bits = static_cast<int64_t>(std::ceil(max_entries * bpe));
+  int64_t num_blocks = (num_bits + 511) / 512 + 1;
+
+  // Round the block count up to a power of two so block selection is a mask, not a modulo.
+  int64_t pow2_blocks = 1;
+  while (pow2_blocks < num_blocks) {
+    pow2_blocks <<= 1;
+  }
+
+  return std::unique_ptr<XXHash64BlockBloomFilter>(new XXHash64BlockBloomFilter(pow2_blocks));
+}
+
+StatusOr<std::unique_ptr<XXHash64BlockBloomFilter>> XXHash64BlockBloomFilter::FromProto(
+    const XXHash64BloomFilterPB& pb) {
+  const auto& bytes_str = pb.data();
+
+  if (pb.num_hashes() != kLanesPerBlock) {
+    return error::Internal("Expected $0 hash functions in block BloomFilter, received $1",
+                           kLanesPerBlock, pb.num_hashes());
+  }
+  constexpr size_t kBlockBytes = kLanesPerBlock * sizeof(uint64_t);
+  size_t num_blocks = bytes_str.size() / kBlockBytes;
+  if (num_blocks == 0 || bytes_str.size() % kBlockBytes != 0 ||
+      (num_blocks & (num_blocks - 1)) != 0) {
+    return error::Internal(
+        "Block BloomFilter data must be a power-of-two number of $0-byte blocks, received $1 "
+        "bytes",
+        kBlockBytes, bytes_str.size());
+  }
+
+  std::vector<uint64_t> blocks(bytes_str.size() / sizeof(uint64_t));
+  std::memcpy(blocks.data(), bytes_str.data(), bytes_str.size());
+  return std::unique_ptr<XXHash64BlockBloomFilter>(new XXHash64BlockBloomFilter(std::move(blocks)));
+}
+
+XXHash64BloomFilterPB XXHash64BlockBloomFilter::ToProto() {
+  XXHash64BloomFilterPB output;
+  output.set_num_hashes(kLanesPerBlock);
+  // Lanes are serialized in host byte order; all supported targets (x86_64, aarch64) are
+  // little-endian.
+  output.set_data(std::string(reinterpret_cast<const char*>(blocks_.data()),
+                              blocks_.size() * sizeof(uint64_t)));
+  return output;
+}
+
+XXHash64BlockBloomFilter::BlockMask XXHash64BlockBloomFilter::HashToBlockMask(
+    std::string_view item) const {
+  uint64_t a = XXH64(item.data(), item.size(), seed_);
+  uint64_t b = XXH64(item.data(), item.size(), a);
+
+  BlockMask bm;
+  bm.block = a & (num_blocks() - 1);
+  for (auto i = 0; i < kLanesPerBlock; ++i) {
+    // Same double-hashing scheme as XXHash64BloomFilter; each lane derives an independent 6-bit
+    // slice selecting one of the 64 bits in that lane.
+    absl::uint128 x = a + (i + 1) * absl::uint128(b);
+    bm.mask[i] = 1ULL << static_cast<int>(x % 64);
+  }
+  return bm;
+}
+
+void XXHash64BlockBloomFilter::InsertMask(const BlockMask& bm) {
+  uint64_t* block = &blocks_[bm.block * kLanesPerBlock];
+  for (auto i = 0; i < kLanesPerBlock; ++i) {
+    block[i] |= bm.mask[i];
+  }
+}
+
+bool XXHash64BlockBloomFilter::ContainsMask(const BlockMask& bm) const {
+  const uint64_t* block = &blocks_[bm.block * kLanesPerBlock];
+  uint64_t missing = 0;
+  for (auto i = 0; i < kLanesPerBlock; ++i) {
+    missing |= bm.mask[i] & ~block[i];
+  }
+  return missing == 0;
+}
+
+void XXHash64BlockBloomFilter::Insert(std::string_view item) { InsertMask(HashToBlockMask(item)); }
+
+bool XXHash64BlockBloomFilter::Contains(std::string_view item) const {
+  return ContainsMask(HashToBlockMask(item));
+}
+
+void XXHash64BlockBloomFilter::InsertBatch(const std::vector<std::string_view>& items) {
+  std::vector<BlockMask> masks;
+  masks.reserve(items.size());
+  for (const auto& item : items) {
+    masks.push_back(HashToBlockMask(item));
+  }
+  for (const auto& bm : masks) {
+    InsertMask(bm);
+  }
+}
+
+std::vector<bool> XXHash64BlockBloomFilter::ContainsBatch(
+    const std::vector<std::string_view>& items) const {
+  std::vector<BlockMask> masks;
+  masks.reserve(items.size());
+  for (const auto& item : items) {
+    masks.push_back(HashToBlockMask(item));
+  }
+  std::vector<bool> results(items.size());
+  for (size_t i = 0; i < masks.size(); ++i) {
+    results[i] = ContainsMask(masks[i]);
+  }
+  return results;
+}
+
 }  // namespace bloomfilter
 }  // namespace px
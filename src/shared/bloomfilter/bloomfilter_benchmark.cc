@@ -79,5 +79,82 @@ BENCHMARK_REGISTER_F(BloomFilterBenchmark, InsertTest)
 BENCHMARK_REGISTER_F(BloomFilterBenchmark, LookupTest)
     ->Ranges({{1 << 10, 1 << 20}, {10, 100000}, {8, 256}});
 
+class BlockBloomFilterBenchmark : public benchmark::Fixture {
+  void SetUp(const ::benchmark::State& state) {
+    auto num_items = state.range(0);
+    auto error_rate = 1.0 / state.range(1);
+    auto strlen = state.range(2);
+    insert_bf_ = XXHash64BlockBloomFilter::Create(num_items * 2, error_rate).ConsumeValueOrDie();
+    lookup_bf_ = XXHash64BlockBloomFilter::Create(num_items * 2, error_rate).ConsumeValueOrDie();
+    random_strs_.reserve(num_items);
+    for (auto i = 0; i < num_items; ++i) {
+      random_strs_.push_back(datagen::RandomString(strlen));
+      lookup_bf_->Insert(random_strs_[i]);
+    }
+    random_str_views_.reserve(num_items);
+    for (const auto& str : random_strs_) {
+      random_str_views_.push_back(str);
+    }
+  }
+
+ protected:
+  std::vector<std::string> random_strs_;
+  std::vector<std::string_view> random_str_views_;
+  std::unique_ptr<XXHash64BlockBloomFilter> insert_bf_;
+  std::unique_ptr<XXHash64BlockBloomFilter> lookup_bf_;
+};
+
+// NOLINTNEXTLINE : runtime/references.
+BENCHMARK_DEFINE_F(BlockBloomFilterBenchmark, InsertTest)(benchmark::State& state) {
+  for (auto _ : state) {
+    for (const auto& random_str : random_strs_) {
+      insert_bf_->Insert(random_str);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * random_strs_.size() * random_strs_[0].size());
+  state.SetItemsProcessed(state.iterations() * random_strs_.size());
+}
+
+// NOLINTNEXTLINE : runtime/references.
+BENCHMARK_DEFINE_F(BlockBloomFilterBenchmark, LookupTest)(benchmark::State& state) {
+  bool result = false;
+  for (auto _ : state) {
+    for (const auto& random_str : random_strs_) {
+      result = lookup_bf_->Contains(random_str);
+    }
+  }
+  PX_UNUSED(result);
+  state.SetBytesProcessed(state.iterations() * random_strs_.size() * random_strs_[0].size());
+  state.SetItemsProcessed(state.iterations() * random_strs_.size());
+}
+
+// NOLINTNEXTLINE : runtime/references.
+BENCHMARK_DEFINE_F(BlockBloomFilterBenchmark, InsertBatchTest)(benchmark::State& state) {
+  for (auto _ : state) {
+    insert_bf_->InsertBatch(random_str_views_);
+  }
+  state.SetBytesProcessed(state.iterations() * random_strs_.size() * random_strs_[0].size());
+  state.SetItemsProcessed(state.iterations() * random_strs_.size());
+}
+
+// NOLINTNEXTLINE : runtime/references.
+BENCHMARK_DEFINE_F(BlockBloomFilterBenchmark, LookupBatchTest)(benchmark::State& state) {
+  for (auto _ : state) {
+    auto results = lookup_bf_->ContainsBatch(random_str_views_);
+    benchmark::DoNotOptimize(results);
+  }
+  state.SetBytesProcessed(state.iterations() * random_strs_.size() * random_strs_[0].size());
+  state.SetItemsProcessed(state.iterations() * random_strs_.size());
+}
+
+BENCHMARK_REGISTER_F(BlockBloomFilterBenchmark, InsertTest)
+    ->Ranges({{1 << 10, 1 << 20}, {10, 100000}, {8, 256}});
+BENCHMARK_REGISTER_F(BlockBloomFilterBenchmark, LookupTest)
+    ->Ranges({{1 << 10, 1 << 20}, {10, 100000}, {8, 256}});
+BENCHMARK_REGISTER_F(BlockBloomFilterBenchmark, InsertBatchTest)
+    ->Ranges({{1 << 10, 1 << 20}, {10, 100000}, {8, 256}});
+BENCHMARK_REGISTER_F(BlockBloomFilterBenchmark, LookupBatchTest)
+    ->Ranges({{1 << 10, 1 << 20}, {10, 100000}, {8, 256}});
+
 }  // namespace bloomfilter
 }  // namespace px
@@ -18,6 +18,7 @@
 
 #include <gtest/gtest.h>
 
+#include "src/common/testing/testing.h"
 #include "src/shared/bloomfilter/bloomfilter.h"
 
 namespace px {
@@ -113,5 +114,67 @@ TEST(XXHash64BloomFilter, test_create_from_proto) {
   }
 }
 
+TEST(XXHash64BlockBloomFilter, test_create) {
+  auto bf1 = XXHash64BlockBloomFilter::Create(10, 0.1).ConsumeValueOrDie();
+  // Always whole 64-byte blocks, and a power-of-two number of them.
+  EXPECT_EQ(bf1->num_blocks(), 2);
+  EXPECT_EQ(bf1->buffer_size_bytes(), 128);
+
+  auto bf2 = XXHash64BlockBloomFilter::Create(100000, 0.01).ConsumeValueOrDie();
+  EXPECT_EQ(bf2->num_blocks(), 2048);
+  EXPECT_EQ(bf2->buffer_size_bytes(), 2048 * 64);
+}
+
+TEST(XXHash64BlockBloomFilter, test_insert_contains) {
+  auto bf = XXHash64BlockBloomFilter::Create(10, 0.1).ConsumeValueOrDie();
+  EXPECT_FALSE(bf->Contains(std::string_view("foo")));
+  EXPECT_FALSE(bf->Contains(std::string_view("bar")));
+  bf->Insert(std::string_view("foo"));
+  bf->Insert(std::string("bar"));
+  EXPECT_TRUE(bf->Contains(std::string_view("foo")));
+  EXPECT_TRUE(bf->Contains(std::string("bar")));
+  EXPECT_FALSE(bf->Contains(std::string_view("not_present")));
+  EXPECT_FALSE(bf->Contains(std::string_view("")));
+}
+
+TEST(XXHash64BlockBloomFilter, test_batch) {
+  auto bf = XXHash64BlockBloomFilter::Create(1000, 0.01).ConsumeValueOrDie();
+
+  std::vector<std::string_view> items{"foo", "bar", "abc"};
+  bf->InsertBatch(items);
+
+  auto present = bf->ContainsBatch(items);
+  EXPECT_EQ(present, std::vector<bool>({true, true, true}));
+
+  auto absent = bf->ContainsBatch({"123", "456", "789"});
+  EXPECT_EQ(absent, std::vector<bool>({false, false, false}));
+}
+
+TEST(XXHash64BlockBloomFilter, test_create_from_proto) {
+  std::vector<std::string> matches{"foo", "bar", "abc"};
+  std::vector<std::string> non_matches{"123", "456", "789"};
+
+  auto bf = XXHash64BlockBloomFilter::Create(100000, 0.01).ConsumeValueOrDie();
+  for (const auto& match : matches) {
+    bf->Insert(match);
+  }
+
+  auto proto = bf->ToProto();
+  EXPECT_EQ(proto.num_hashes(), XXHash64BlockBloomFilter::kLanesPerBlock);
+  auto reconstructed = XXHash64BlockBloomFilter::FromProto(proto).ConsumeValueOrDie();
+  EXPECT_EQ(reconstructed->num_blocks(), bf->num_blocks());
+
+  for (const auto& match : matches) {
+    EXPECT_TRUE(reconstructed->Contains(match));
+  }
+  for (const auto& non_match : non_matches) {
+    EXPECT_FALSE(reconstructed->Contains(non_match));
+  }
+
+  // A proto from the classic (non-blocked) filter is rejected rather than misread.
+  auto classic = XXHash64BloomFilter::Create(100, 0.01).ConsumeValueOrDie();
+  EXPECT_NOT_OK(XXHash64BlockBloomFilter::FromProto(classic->ToProto()));
+}
+
 }  // namespace bloomfilter
 }  // namespace px
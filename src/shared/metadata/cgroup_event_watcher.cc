@@ -0,0 +1,100 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "src/shared/metadata/cgroup_event_watcher.h"
+
+namespace px {
+namespace md {
+
+StatusOr<std::unique_ptr<CGroupEventWatcher>> CGroupEventWatcher::Create() {
+  int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (fd < 0) {
+    return error::Internal("Failed to create inotify instance [errno=$0]", errno);
+  }
+  return std::unique_ptr<CGroupEventWatcher>(new CGroupEventWatcher(fd));
+}
+
+CGroupEventWatcher::~CGroupEventWatcher() {
+  if (inotify_fd_ >= 0) {
+    close(inotify_fd_);
+  }
+}
+
+Status CGroupEventWatcher::AddContainerWatch(const CID& cid, std::string_view cgroup_procs_path) {
+  std::string dir = std::filesystem::path(cgroup_procs_path).parent_path().string();
+  int wd = inotify_add_watch(inotify_fd_, dir.c_str(), IN_DELETE_SELF);
+  if (wd < 0) {
+    if (errno == ENOENT) {
+      // This might not be a real error since the container could have disappeared.
+      return error::NotFound("cgroup directory $0 does not exist", dir);
+    }
+    return error::Internal("Failed to watch cgroup directory $0 [errno=$1]", dir, errno);
+  }
+  RemoveContainerWatch(cid);
+  cid_by_wd_[wd] = cid;
+  wd_by_cid_[cid] = wd;
+  return Status::OK();
+}
+
+void CGroupEventWatcher::RemoveContainerWatch(const CID& cid) {
+  auto it = wd_by_cid_.find(cid);
+  if (it == wd_by_cid_.end()) {
+    return;
+  }
+  // Best effort: the kernel has already dropped the watch if the directory is gone.
+  inotify_rm_watch(inotify_fd_, it->second);
+  cid_by_wd_.erase(it->second);
+  wd_by_cid_.erase(it);
+}
+
+absl::flat_hash_set<CID> CGroupEventWatcher::PollRemovedContainers() {
+  absl::flat_hash_set<CID> removed;
+  // IN_DELETE_SELF events carry no name payload, so this comfortably holds a batch of events.
+  alignas(struct inotify_event) char buf[4096];
+  while (true) {
+    ssize_t len = read(inotify_fd_, buf, sizeof(buf));
+    if (len <= 0) {
+      // EAGAIN: the queue is drained.
+      break;
+    }
+    for (char* p = buf; p < buf + len;) {
+      auto* event = reinterpret_cast<struct inotify_event*>(p);
+      // IN_IGNORED follows IN_DELETE_SELF; whichever arrives first retires the watch.
+      if (event->mask & (IN_DELETE_SELF | IN_IGNORED)) {
+        auto it = cid_by_wd_.find(event->wd);
+        if (it != cid_by_wd_.end()) {
+          removed.insert(it->second);
+          wd_by_cid_.erase(it->second);
+          cid_by_wd_.erase(it);
+        }
+      }
+      p += sizeof(struct inotify_event) + event->len;
+    }
+  }
+  return removed;
+}
+
+}  // namespace md
+}  // namespace px
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+
+#include "src/common/base/base.h"
+#include "src/shared/upid/upid.h"
+
+namespace px {
+namespace md {
+
+/**
+ * CGroupEventWatcher holds inotify watches on container cgroup directories so that container
+ * removal is observed as an event instead of a failed cgroup.procs read on the next update
+ * period.
+ *
+ * Note that cgroupfs only generates fsnotify events for changes to the directory structure
+ * (cgroup creation and removal); processes attaching to or leaving a cgroup do not produce
+ * events on cgroup.procs. The watcher therefore covers container lifecycle only, and the
+ * periodic cgroup.procs poll remains the source of truth for PID membership.
+ */
+class CGroupEventWatcher : public NotCopyable {
+ public:
+  static StatusOr<std::unique_ptr<CGroupEventWatcher>> Create();
+  ~CGroupEventWatcher();
+
+  /**
+   * Watches the cgroup directory containing the given cgroup.procs path for removal.
+   * Re-adding a watch for a cid replaces the previous one.
+   *
+   * @return NotFound if the directory has already disappeared.
+   */
+  Status AddContainerWatch(const CID& cid, std::string_view cgroup_procs_path);
+
+  /**
+   * Drops the watch for the given container, if one exists.
+   */
+  void RemoveContainerWatch(const CID& cid);
+
+  bool HasContainerWatch(const CID& cid) const { return wd_by_cid_.contains(cid); }
+
+  /**
+   * Drains pending inotify events and returns the containers whose cgroup directory has been
+   * removed since the last poll. Watches for the returned containers are cleaned up.
+   */
+  absl::flat_hash_set<CID> PollRemovedContainers();
+
+ private:
+  explicit CGroupEventWatcher(int inotify_fd) : inotify_fd_(inotify_fd) {}
+
+  int inotify_fd_ = -1;
+  absl::flat_hash_map<int, CID> cid_by_wd_;
+  absl::flat_hash_map<CID, int> wd_by_cid_;
+};
+
+}  // namespace md
+}  // namespace px
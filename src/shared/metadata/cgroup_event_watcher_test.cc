@@ -0,0 +1,73 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <filesystem>
+#include <memory>
+
+#include "src/common/testing/temp_dir.h"
+#include "src/common/testing/testing.h"
+#include "src/shared/metadata/cgroup_event_watcher.h"
+
+namespace px {
+namespace md {
+
+using ::testing::Contains;
+
+TEST(CGroupEventWatcherTest, detects_removed_container_dirs) {
+  testing::TempDir tmp_dir;
+  std::filesystem::path container_dir = tmp_dir.path() / "pod0" / "container0";
+  std::filesystem::create_directories(container_dir);
+
+  ASSERT_OK_AND_ASSIGN(auto watcher, CGroupEventWatcher::Create());
+  ASSERT_OK(watcher->AddContainerWatch("container0", (container_dir / "cgroup.procs").string()));
+  EXPECT_TRUE(watcher->HasContainerWatch("container0"));
+
+  // Nothing has happened yet.
+  EXPECT_TRUE(watcher->PollRemovedContainers().empty());
+
+  std::filesystem::remove(container_dir);
+  EXPECT_THAT(watcher->PollRemovedContainers(), Contains("container0"));
+  EXPECT_FALSE(watcher->HasContainerWatch("container0"));
+}
+
+TEST(CGroupEventWatcherTest, missing_dir_is_not_found) {
+  testing::TempDir tmp_dir;
+  ASSERT_OK_AND_ASSIGN(auto watcher, CGroupEventWatcher::Create());
+  auto s = watcher->AddContainerWatch(
+      "container0", (tmp_dir.path() / "does_not_exist" / "cgroup.procs").string());
+  ASSERT_NOT_OK(s);
+  EXPECT_TRUE(error::IsNotFound(s));
+  EXPECT_FALSE(watcher->HasContainerWatch("container0"));
+}
+
+TEST(CGroupEventWatcherTest, remove_watch_stops_events) {
+  testing::TempDir tmp_dir;
+  std::filesystem::path container_dir = tmp_dir.path() / "container0";
+  std::filesystem::create_directories(container_dir);
+
+  ASSERT_OK_AND_ASSIGN(auto watcher, CGroupEventWatcher::Create());
+  ASSERT_OK(watcher->AddContainerWatch("container0", (container_dir / "cgroup.procs").string()));
+  watcher->RemoveContainerWatch("container0");
+  EXPECT_FALSE(watcher->HasContainerWatch("container0"));
+
+  std::filesystem::remove(container_dir);
+  EXPECT_TRUE(watcher->PollRemovedContainers().empty());
+}
+
+}  // namespace md
+}  // namespace px
@@ -55,10 +55,14 @@ class CGroupMetadataReader : public NotCopyable {
                           std::string_view container_id, ContainerType container_type,
                           absl::flat_hash_set<uint32_t>* pid_set) const;
 
- private:
-  StatusOr<std::string> PodPath(PodQOSClass qos_class, std::string_view pod_id,
-                                std::string_view container_id, ContainerType container_type) const;
+  /**
+   * Returns the path of the cgroup.procs file for a container running as part of a given pod.
+   */
+  virtual StatusOr<std::string> PodPath(PodQOSClass qos_class, std::string_view pod_id,
+                                        std::string_view container_id,
+                                        ContainerType container_type) const;
 
+ private:
   std::unique_ptr<LegacyCGroupPathResolver> legacy_path_resolver_;
   std::unique_ptr<CGroupPathResolver> path_resolver_;
 };
@@ -28,6 +28,7 @@
 #include <absl/container/flat_hash_set.h>
 #include "src/common/base/base.h"
 #include "src/shared/k8s/metadatapb/metadata.pb.h"
+#include "src/shared/metadata/string_pool.h"
 #include "src/shared/upid/upid.h"
 
 namespace px {
@@ -65,8 +66,8 @@ class K8sMetadataObject {
                     int64_t start_time_ns = 0, int64_t stop_time_ns = 0)
       : type_(type),
         uid_(std::move(uid)),
-        ns_(ns),
-        name_(name),
+        ns_(InternString(ns)),
+        name_(InternString(name)),
         start_time_ns_(start_time_ns),
         stop_time_ns_(stop_time_ns) {}
 
@@ -74,8 +75,8 @@ class K8sMetadataObject {
 
   const UID& uid() const { return uid_; }
 
-  const std::string& name() const { return name_; }
-  const std::string& ns() const { return ns_; }
+  const std::string& name() const { return *name_; }
+  const std::string& ns() const { return *ns_; }
 
   int64_t start_time_ns() const { return start_time_ns_; }
   void set_start_time_ns(int64_t start_time_ns) { start_time_ns_ = start_time_ns; }
@@ -108,15 +109,16 @@ class K8sMetadataObject {
   const UID uid_ = 0;
 
   /**
-   * The namespace for this object.
+   * The namespace for this object. Interned: equal names across objects and state clones share
+   * one buffer.
    */
 
-  std::string ns_;
+  InternedString ns_;
 
   /**
-   * The name which is unique in space but not time.
+   * The name which is unique in space but not time. Interned like ns_.
    */
-  std::string name_;
+  InternedString name_;
 
   /**
    * Start time of this K8s object.
@@ -396,8 +398,8 @@ class ContainerInfo {
   ContainerInfo(CID cid, std::string_view name, ContainerState state, ContainerType type,
                 std::string_view state_message, std::string_view state_reason,
                 int64_t start_time_ns, int64_t stop_time_ns = 0)
-      : cid_(std::move(cid)),
-        name_(std::string(name)),
+      : cid_(InternString(cid)),
+        name_(InternString(name)),
         state_(state),
         type_(type),
         state_message_(state_message),
@@ -413,8 +415,8 @@ class ContainerInfo {
                       container_update_info.start_timestamp_ns(),
                       container_update_info.stop_timestamp_ns()) {}
 
-  const CID& cid() const { return cid_; }
-  const std::string& name() const { return name_; }
+  const CID& cid() const { return *cid_; }
+  const std::string& name() const { return *name_; }
   ContainerType type() const { return type_; }
 
   void set_pod_id(std::string_view pod_id) { pod_id_ = pod_id; }
@@ -448,8 +450,10 @@ class ContainerInfo {
   ContainerInfo& operator=(const ContainerInfo& other) = delete;
 
  private:
-  const CID cid_;
-  const std::string name_;
+  // Both interned: the CID is shared with every PIDInfo in the container, and container names
+  // repeat across pods of the same workload.
+  const InternedString cid_;
+  const InternedString name_;
   UID pod_id_ = "";
 
   /**
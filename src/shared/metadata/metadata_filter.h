@@ -33,7 +33,7 @@
 namespace px {
 namespace md {
 
-using bloomfilter::XXHash64BloomFilter;
+using bloomfilter::XXHash64BlockBloomFilter;
 using carnot::planner::distributedpb::MetadataInfo;
 using shared::metadatapb::MetadataType;
 using shared::metadatapb::MetadataType_Name;
@@ -102,13 +102,14 @@ class AgentMetadataFilter {
 };
 
 /**
- * An implementation of AgentMetadataFilter backed by an XXHASH64-based bloom filter.
+ * An implementation of AgentMetadataFilter backed by an XXHASH64-based cache-line-blocked bloom
+ * filter.
  */
 class AgentMetadataFilterImpl : public AgentMetadataFilter {
  public:
   static StatusOr<std::unique_ptr<AgentMetadataFilter>> Create(
       int64_t max_entries, double error_rate, const absl::flat_hash_set<MetadataType>& types) {
-    PX_ASSIGN_OR_RETURN(auto bf, XXHash64BloomFilter::Create(max_entries, error_rate));
+    PX_ASSIGN_OR_RETURN(auto bf, XXHash64BlockBloomFilter::Create(max_entries, error_rate));
     return std::unique_ptr<AgentMetadataFilter>(new AgentMetadataFilterImpl(std::move(bf), types));
   }
 
@@ -120,11 +121,11 @@ class AgentMetadataFilterImpl : public AgentMetadataFilter {
   MetadataInfo ToProtoImpl() const override;
 
  private:
-  AgentMetadataFilterImpl(std::unique_ptr<XXHash64BloomFilter> bloomfilter,
+  AgentMetadataFilterImpl(std::unique_ptr<XXHash64BlockBloomFilter> bloomfilter,
                           const absl::flat_hash_set<MetadataType>& types)
       : AgentMetadataFilter(types), bloomfilter_(std::move(bloomfilter)) {}
 
-  std::unique_ptr<XXHash64BloomFilter> bloomfilter_;
+  std::unique_ptr<XXHash64BlockBloomFilter> bloomfilter_;
 };
 
 }  // namespace md
@@ -165,15 +165,11 @@ std::unique_ptr<K8sMetadataState> K8sMetadataState::Clone() const {
   other->pod_cidrs_ = pod_cidrs_;
   other->service_cidr_ = service_cidr_;
 
-  other->k8s_objects_by_id_.reserve(k8s_objects_by_id_.size());
-  for (const auto& [k, v] : k8s_objects_by_id_) {
-    other->k8s_objects_by_id_[k] = v->Clone();
-  }
-
-  other->containers_by_id_.reserve(containers_by_id_.size());
-  for (const auto& [k, v] : containers_by_id_) {
-    other->containers_by_id_[k] = v->Clone();
-  }
+  // Objects are shared with the clone rather than deep-copied; any subsequent mutation goes
+  // through UniquifyForWrite, which clones just the object being modified. This makes the cost
+  // of an update cycle proportional to the K8s delta instead of the cluster size.
+  other->k8s_objects_by_id_ = k8s_objects_by_id_;
+  other->containers_by_id_ = containers_by_id_;
 
   other->pods_by_name_ = pods_by_name_;
   other->services_by_name_ = services_by_name_;
@@ -257,7 +253,7 @@ Status K8sMetadataState::HandlePodUpdate(const PodUpdate& update) {
     VLOG(1) << "Adding Pod: " << pod->DebugString();
     it = k8s_objects_by_id_.try_emplace(object_uid, std::move(pod)).first;
   }
-  auto pod_info = static_cast<PodInfo*>(it->second.get());
+  auto pod_info = static_cast<PodInfo*>(UniquifyForWrite(&it->second));
 
   // We always just add to the container set even if the container is stopped.
   // We expect all cleanup to happen periodically to allow stale objects to be queried for some
@@ -275,7 +271,10 @@ Status K8sMetadataState::HandlePodUpdate(const PodUpdate& update) {
     }
 
     pod_info->AddContainer(cid);
-    containers_by_id_[cid]->set_pod_id(object_uid);
+    auto cit = containers_by_id_.find(cid);
+    if (cit->second->pod_id() != object_uid) {
+      UniquifyForWrite(&cit->second)->set_pod_id(object_uid);
+    }
   }
 
   for (const auto& owner_ref : update.owner_references()) {
@@ -316,7 +315,7 @@ Status K8sMetadataState::HandleContainerUpdate(const ContainerUpdate& update) {
   }
   VLOG(1) << "container update: " << update.name();
 
-  auto* container_info = it->second.get();
+  auto* container_info = UniquifyForWrite(&it->second);
   container_info->set_stop_time_ns(update.stop_timestamp_ns());
   container_info->set_state(ConvertToContainerState(update.container_state()));
   container_info->set_state_message(update.message());
@@ -338,20 +337,24 @@ Status K8sMetadataState::HandleServiceUpdate(const ServiceUpdate& update) {
     VLOG(1) << "Adding Service: " << service->DebugString();
     it = k8s_objects_by_id_.try_emplace(service_uid, std::move(service)).first;
   }
-  auto service_info = static_cast<ServiceInfo*>(it->second.get());
+  auto service_info = static_cast<ServiceInfo*>(UniquifyForWrite(&it->second));
 
   for (const auto& uid : update.pod_ids()) {
-    if (k8s_objects_by_id_.find(uid) == k8s_objects_by_id_.end()) {
+    auto pod_it = k8s_objects_by_id_.find(uid);
+    if (pod_it == k8s_objects_by_id_.end()) {
       // We should be resilient to the case where we happened to miss a pod update
       // in the stream of events. If we did miss a pod update, just skip adding the
       // pod to this particular service to avoid dangling references.
       LOG(INFO) << absl::Substitute("Didn't find pod UID $0 for service $1/$2", uid, ns, name);
       continue;
     }
-    ECHECK(k8s_objects_by_id_[uid]->type() == K8sObjectType::kPod);
+    ECHECK(pod_it->second->type() == K8sObjectType::kPod);
     // We add the service uid to the pod. Lifetime of service still handled by the service object.
-    PodInfo* pod_info = static_cast<PodInfo*>(k8s_objects_by_id_[uid].get());
-    pod_info->AddService(service_uid);
+    // Skip the copy-on-write if the pod already references this service.
+    if (!static_cast<const PodInfo*>(pod_it->second.get())->services().contains(service_uid)) {
+      PodInfo* pod_info = static_cast<PodInfo*>(UniquifyForWrite(&pod_it->second));
+      pod_info->AddService(service_uid);
+    }
   }
   if (update.start_timestamp_ns() != 0) {
     service_info->set_start_time_ns(update.start_timestamp_ns());
@@ -385,7 +388,7 @@ Status K8sMetadataState::HandleNamespaceUpdate(const NamespaceUpdate& update) {
     VLOG(1) << "Adding Namespace: " << ns_obj->DebugString();
     it = k8s_objects_by_id_.try_emplace(namespace_uid, std::move(ns_obj)).first;
   }
-  auto ns_info = static_cast<NamespaceInfo*>(it->second.get());
+  auto ns_info = static_cast<NamespaceInfo*>(UniquifyForWrite(&it->second));
 
   ns_info->set_start_time_ns(update.start_timestamp_ns());
   ns_info->set_stop_time_ns(update.stop_timestamp_ns());
@@ -414,7 +417,7 @@ Status K8sMetadataState::HandleReplicaSetUpdate(const ReplicaSetUpdate& update)
     VLOG(1) << "Adding ReplicaSet: " << replica_set->DebugString();
     it = k8s_objects_by_id_.try_emplace(replica_set_uid, std::move(replica_set)).first;
   }
-  auto replica_set_info = static_cast<ReplicaSetInfo*>(it->second.get());
+  auto replica_set_info = static_cast<ReplicaSetInfo*>(UniquifyForWrite(&it->second));
 
   for (const auto& owner_ref : update.owner_references()) {
     replica_set_info->AddOwnerReference(owner_ref.uid(), owner_ref.name(), owner_ref.kind());
@@ -447,7 +450,7 @@ Status K8sMetadataState::HandleDeploymentUpdate(const DeploymentUpdate& update)
     VLOG(1) << "Adding Deployment: " << deployment->DebugString();
     it = k8s_objects_by_id_.try_emplace(deployment_uid, std::move(deployment)).first;
   }
-  auto deployment_info = static_cast<DeploymentInfo*>(it->second.get());
+  auto deployment_info = static_cast<DeploymentInfo*>(UniquifyForWrite(&it->second));
 
   deployment_info->set_start_time_ns(update.start_timestamp_ns());
   deployment_info->set_stop_time_ns(update.stop_timestamp_ns());
@@ -43,8 +43,24 @@ namespace md {
 using K8sMetadataObjectUPtr = std::unique_ptr<K8sMetadataObject>;
 using ContainerInfoUPtr = std::unique_ptr<ContainerInfo>;
 using PIDInfoUPtr = std::unique_ptr<PIDInfo>;
+using K8sMetadataObjectSPtr = std::shared_ptr<K8sMetadataObject>;
+using ContainerInfoSPtr = std::shared_ptr<ContainerInfo>;
 using AgentID = sole::uuid;
 
+/**
+ * Returns a mutable pointer to the object held by ptr, cloning it first if the object is shared
+ * with reader snapshots (copy-on-write). K8s objects and containers are shared across cloned
+ * metadata states, so all in-place mutations of them must go through this helper; otherwise
+ * readers holding an older snapshot would observe the change.
+ */
+template <typename T>
+T* UniquifyForWrite(std::shared_ptr<T>* ptr) {
+  if (ptr->use_count() > 1) {
+    *ptr = (*ptr)->Clone();
+  }
+  return ptr->get();
+}
+
 using UIDAndStart = std::pair<UID, int64_t>;
 struct SortByStart {
   bool operator()(const UIDAndStart& lhs, const UIDAndStart& rhs) const {
@@ -273,7 +289,7 @@ class K8sMetadataState : NotCopyable {
 
   Status CleanupExpiredMetadata(int64_t now, int64_t retention_time_ns);
 
-  absl::flat_hash_map<CID, ContainerInfoUPtr>& containers_by_id() { return containers_by_id_; }
+  absl::flat_hash_map<CID, ContainerInfoSPtr>& containers_by_id() { return containers_by_id_; }
   std::string DebugString(int indent_level = 0) const;
 
  private:
@@ -286,10 +302,12 @@ class K8sMetadataState : NotCopyable {
   std::vector<CIDRBlock> pod_cidrs_;
 
   // This stores K8s native objects (services, pods, etc).
-  absl::flat_hash_map<UID, K8sMetadataObjectUPtr> k8s_objects_by_id_;
+  // Values are shared with cloned states (copy-on-write); mutate only via UniquifyForWrite.
+  absl::flat_hash_map<UID, K8sMetadataObjectSPtr> k8s_objects_by_id_;
 
   // This stores container objects, complementing k8s_objects_by_id_.
-  absl::flat_hash_map<CID, ContainerInfoUPtr> containers_by_id_;
+  // Values are shared with cloned states (copy-on-write); mutate only via UniquifyForWrite.
+  absl::flat_hash_map<CID, ContainerInfoSPtr> containers_by_id_;
 
   /**
    * Mapping of pods by name.
@@ -324,6 +324,35 @@ TEST(K8sMetadataStateTest, CloneCopiedCIDR) {
   EXPECT_EQ(service_cidr.prefix_length, state_copy->service_cidr()->prefix_length);
 }
 
+TEST(K8sMetadataStateTest, CloneSharesObjectsCopyOnWrite) {
+  K8sMetadataState state;
+
+  K8sMetadataState::ContainerUpdate container_update;
+  ASSERT_TRUE(TextFormat::MergeFromString(kContainer0UpdatePbTxt, &container_update))
+      << "Failed to parse proto";
+  K8sMetadataState::PodUpdate pod_update;
+  ASSERT_TRUE(TextFormat::MergeFromString(kPod0UpdatePbTxt, &pod_update))
+      << "Failed to parse proto";
+
+  EXPECT_OK(state.HandleContainerUpdate(container_update));
+  EXPECT_OK(state.HandlePodUpdate(pod_update));
+
+  auto state_copy = state.Clone();
+
+  // Clones share the underlying objects until one side writes.
+  EXPECT_EQ(state.PodInfoByID("pod0_uid"), state_copy->PodInfoByID("pod0_uid"));
+  EXPECT_EQ(state.ContainerInfoByID("container0_uid"),
+            state_copy->ContainerInfoByID("container0_uid"));
+
+  // An update applied to one state must not leak into the other's snapshot.
+  pod_update.set_message("an updated pod message");
+  EXPECT_OK(state.HandlePodUpdate(pod_update));
+
+  EXPECT_NE(state.PodInfoByID("pod0_uid"), state_copy->PodInfoByID("pod0_uid"));
+  EXPECT_EQ("an updated pod message", state.PodInfoByID("pod0_uid")->phase_message());
+  EXPECT_EQ("a pod message", state_copy->PodInfoByID("pod0_uid")->phase_message());
+}
+
 TEST(K8sMetadataStateTest, HandleContainerUpdate) {
   K8sMetadataState state;
 
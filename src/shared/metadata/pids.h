@@ -23,6 +23,7 @@
 #include <utility>
 
 #include "src/common/base/base.h"
+#include "src/shared/metadata/string_pool.h"
 #include "src/shared/upid/upid.h"
 
 namespace px {
@@ -36,9 +37,9 @@ class PIDInfo {
   PIDInfo() = delete;
   PIDInfo(UPID upid, std::string exe_path, std::string cmdline, CID cid)
       : upid_(upid),
-        exe_path_(std::move(exe_path)),
+        exe_path_(InternString(exe_path)),
         cmdline_(std::move(cmdline)),
-        cid_(std::move(cid)),
+        cid_(InternString(cid)),
         stop_time_ns_(0) {}
 
   UPID upid() const { return upid_; }
@@ -49,11 +50,11 @@ class PIDInfo {
 
   void set_stop_time_ns(int64_t ts) { stop_time_ns_ = ts; }
 
-  const std::string& exe_path() const { return exe_path_; }
+  const std::string& exe_path() const { return *exe_path_; }
 
   const std::string& cmdline() const { return cmdline_; }
 
-  const CID& cid() const { return cid_; }
+  const CID& cid() const { return *cid_; }
 
   std::unique_ptr<PIDInfo> Clone() {
     auto pid_info = std::make_unique<PIDInfo>(*this);
@@ -74,9 +75,9 @@ class PIDInfo {
   UPID upid_;
 
   /**
-   * The path to the executable of this process.
+   * The path to the executable of this process. Interned: many processes share one binary.
    */
-  std::string exe_path_;
+  InternedString exe_path_;
 
   /**
    * The command line used to start this PID.
@@ -84,9 +85,9 @@ class PIDInfo {
   std::string cmdline_;
 
   /**
-   * The container running this PID.
+   * The container running this PID. Interned: all PIDs in a container share one CID buffer.
    */
-  CID cid_;
+  InternedString cid_;
 
   /**
    * The time that this PID stopped running. If 0 we can assume it's still running.
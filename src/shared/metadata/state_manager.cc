@@ -89,8 +89,8 @@ Status AgentMetadataStateManagerImpl::PerformMetadataStateUpdate() {
 
   if (collects_data_) {
     // Update PID information.
-    PX_RETURN_IF_ERROR(
-        ProcessPIDUpdates(ts, proc_parser_, shadow_state.get(), md_reader_.get(), &pid_updates_));
+    PX_RETURN_IF_ERROR(ProcessPIDUpdates(ts, proc_parser_, shadow_state.get(), md_reader_.get(),
+                                         &pid_updates_, cgroup_watcher_.get()));
   }
 
   // Update the pod/service CIDRs if they have been updated.
@@ -234,15 +234,24 @@ void ProcessContainerPIDUpdates(
 Status ProcessPIDUpdates(
     int64_t ts, const system::ProcParser& proc_parser, AgentMetadataState* md,
     CGroupMetadataReader* md_reader,
-    moodycamel::BlockingConcurrentQueue<std::unique_ptr<PIDStatusEvent>>* pid_updates) {
+    moodycamel::BlockingConcurrentQueue<std::unique_ptr<PIDStatusEvent>>* pid_updates,
+    CGroupEventWatcher* cgroup_watcher) {
   const auto& k8s_md_state = md->k8s_metadata_state();
 
-  for (const auto& [cid, cinfo] : k8s_md_state->containers_by_id()) {
+  absl::flat_hash_set<CID> removed_containers;
+  if (cgroup_watcher != nullptr) {
+    removed_containers = cgroup_watcher->PollRemovedContainers();
+  }
+
+  for (auto& [cid, cinfo] : k8s_md_state->containers_by_id()) {
     if (cinfo->stop_time_ns() != 0) {
       // Ignore dead containers.
       // TODO(zasgar): Come up with a cleaner way of doing this. Probably by using active/inactive
       // containers.
       VLOG(1) << "Ignore dead container: " << cinfo->DebugString();
+      if (cgroup_watcher != nullptr) {
+        cgroup_watcher->RemoveContainerWatch(cid);
+      }
       continue;
     }
 
@@ -263,10 +272,34 @@ Status ProcessPIDUpdates(
     if (pod_info->stop_time_ns() != 0) {
       VLOG(1) << absl::Substitute("Found a running container in a deleted pod [cid=$0, pod_id=$1]",
                                   cid, pod_id);
-      cinfo->set_stop_time_ns(pod_info->stop_time_ns());
+      UniquifyForWrite(&cinfo)->set_stop_time_ns(pod_info->stop_time_ns());
       continue;
     }
 
+    if (removed_containers.contains(cid)) {
+      // The container's cgroup directory was removed; mark everything in it dead right away
+      // instead of discovering the removal through a failed cgroup.procs read.
+      ContainerInfo* mutable_cinfo = UniquifyForWrite(&cinfo);
+      mutable_cinfo->set_stop_time_ns(ts);
+      for (const auto& upid : mutable_cinfo->active_upids()) {
+        md->MarkUPIDAsStopped(upid, ts);
+      }
+      mutable_cinfo->mutable_active_upids()->clear();
+      continue;
+    }
+
+    if (cgroup_watcher != nullptr && !cgroup_watcher->HasContainerWatch(cid)) {
+      auto path_or_s = md_reader->PodPath(pod_info->qos_class(), pod_id, cid, cinfo->type());
+      if (path_or_s.ok()) {
+        Status watch_status = cgroup_watcher->AddContainerWatch(cid, path_or_s.ValueOrDie());
+        // NotFound means the container is already gone; the read below handles that case.
+        if (!watch_status.ok() && !error::IsNotFound(watch_status)) {
+          VLOG(1) << absl::Substitute("Failed to watch cgroup directory for cid=$0 [msg=$1]", cid,
+                                      watch_status.msg());
+        }
+      }
+    }
+
     absl::flat_hash_set<uint32_t> cgroups_active_pids;
     Status s = md_reader->ReadPIDs(pod_info->qos_class(), pod_id, cid, cinfo->type(),
                                    &cgroups_active_pids);
@@ -281,16 +314,32 @@ Status ProcessPIDUpdates(
       // NOTE: Currently, MDS sends pods that do no belong to this Agent, so this is actually
       // required to avoid repeatedly printing out the warning message above.
       if (error::IsNotFound(s)) {
-        cinfo->set_stop_time_ns(ts);
-        for (const auto& upid : cinfo->active_upids()) {
+        ContainerInfo* mutable_cinfo = UniquifyForWrite(&cinfo);
+        mutable_cinfo->set_stop_time_ns(ts);
+        for (const auto& upid : mutable_cinfo->active_upids()) {
           md->MarkUPIDAsStopped(upid, ts);
         }
-        cinfo->mutable_active_upids()->clear();
+        mutable_cinfo->mutable_active_upids()->clear();
       }
       continue;
     }
 
-    ProcessContainerPIDUpdates(cid, ts, proc_parser, md, cinfo->mutable_active_upids(),
+    // Skip the copy-on-write of the container when its PID set is unchanged (the common case).
+    bool pids_changed = cgroups_active_pids.size() != cinfo->active_upids().size();
+    if (!pids_changed) {
+      for (const auto& upid : cinfo->active_upids()) {
+        if (!cgroups_active_pids.contains(upid.pid())) {
+          pids_changed = true;
+          break;
+        }
+      }
+    }
+    if (!pids_changed) {
+      continue;
+    }
+
+    ProcessContainerPIDUpdates(cid, ts, proc_parser, md,
+                               UniquifyForWrite(&cinfo)->mutable_active_upids(),
                                &cgroups_active_pids, pid_updates);
   }
 
@@ -33,6 +33,7 @@
 #include "src/common/event/time_system.h"
 #include "src/common/system/system.h"
 #include "src/shared/k8s/metadatapb/metadata.pb.h"
+#include "src/shared/metadata/cgroup_event_watcher.h"
 #include "src/shared/metadata/cgroup_metadata_reader.h"
 #include "src/shared/metadata/k8s_objects.h"
 #include "src/shared/metadata/metadata_filter.h"
@@ -127,6 +128,17 @@ class AgentMetadataStateManagerImpl : public AgentMetadataStateManager {
                                 event::TimeSystem* time_system)
       : pod_name_(pod_name), collects_data_(collects_data), metadata_filter_(metadata_filter) {
     md_reader_ = std::make_unique<CGroupMetadataReader>(config);
+    if (collects_data_) {
+      auto cgroup_watcher_or_s = CGroupEventWatcher::Create();
+      if (cgroup_watcher_or_s.ok()) {
+        cgroup_watcher_ = cgroup_watcher_or_s.ConsumeValueOrDie();
+      } else {
+        LOG(WARNING) << absl::Substitute(
+            "Failed to create cgroup event watcher; falling back to poll-only container "
+            "tracking. [error = $0]",
+            cgroup_watcher_or_s.ToString());
+      }
+    }
     agent_metadata_state_ =
         std::make_shared<AgentMetadataState>(hostname, asid, pid, agent_id, pod_name, vizier_id,
                                              vizier_name, vizier_namespace, time_system);
@@ -164,6 +176,9 @@ class AgentMetadataStateManagerImpl : public AgentMetadataStateManager {
   system::ProcParser proc_parser_;
 
   std::unique_ptr<CGroupMetadataReader> md_reader_;
+  // Watches container cgroup directories so removals arrive as events; may be null when inotify
+  // is unavailable, in which case container death is detected by failed cgroup.procs reads.
+  std::unique_ptr<CGroupEventWatcher> cgroup_watcher_;
   // The metadata state stored here is immutable so that we can easily share a read only
   // copy across threads. The pointer is atomically updated in PerformMetadataStateUpdate(),
   // which is responsible for applying the queued updates.
@@ -197,10 +212,15 @@ void RemoveDeadPods(int64_t ts, AgentMetadataState* md, CGroupMetadataReader* md
 
 /**
  * Processes PID updates.
+ *
+ * When a cgroup_watcher is supplied, containers whose cgroup directory has been removed since the
+ * last update are marked dead from the watcher's events, without attempting to read their
+ * cgroup.procs file first.
  */
 Status ProcessPIDUpdates(
     int64_t ts, const system::ProcParser& proc_parser, AgentMetadataState*, CGroupMetadataReader*,
-    moodycamel::BlockingConcurrentQueue<std::unique_ptr<PIDStatusEvent>>* pid_updates);
+    moodycamel::BlockingConcurrentQueue<std::unique_ptr<PIDStatusEvent>>* pid_updates,
+    CGroupEventWatcher* cgroup_watcher = nullptr);
 
 /**
  * Deletes metadata for dead objects.
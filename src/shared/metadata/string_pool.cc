@@ -0,0 +1,72 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/shared/metadata/string_pool.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+namespace px {
+namespace md {
+
+InternedString::InternedString() {
+  static const std::shared_ptr<const std::string>* kEmpty =
+      new std::shared_ptr<const std::string>(std::make_shared<const std::string>());
+  str_ = *kEmpty;
+}
+
+StringPool* StringPool::GetInstance() {
+  static StringPool* pool = new StringPool();
+  return pool;
+}
+
+InternedString StringPool::Intern(std::string_view str) {
+  absl::MutexLock lock(&mu_);
+
+  auto it = pool_.find(str);
+  if (it != pool_.end()) {
+    if (auto existing = it->second.lock()) {
+      return InternedString(std::move(existing));
+    }
+  }
+
+  auto pooled = std::make_shared<const std::string>(str);
+  pool_.insert_or_assign(std::string(str), pooled);
+
+  if (pool_.size() > sweep_threshold_) {
+    for (auto sweep_it = pool_.begin(); sweep_it != pool_.end();) {
+      if (sweep_it->second.expired()) {
+        pool_.erase(sweep_it++);
+      } else {
+        ++sweep_it;
+      }
+    }
+    sweep_threshold_ = std::max(sweep_threshold_, 2 * pool_.size());
+  }
+
+  return InternedString(std::move(pooled));
+}
+
+size_t StringPool::size() const {
+  absl::MutexLock lock(&mu_);
+  return pool_.size();
+}
+
+}  // namespace md
+}  // namespace px
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <absl/base/thread_annotations.h>
+#include <absl/container/flat_hash_map.h>
+#include <absl/synchronization/mutex.h>
+
+#include "src/common/base/base.h"
+
+namespace px {
+namespace md {
+
+/**
+ * A handle to a string interned in the process-wide StringPool.
+ *
+ * All handles for equal contents share a single underlying buffer, so copying a handle is a
+ * refcount bump and equality checks are usually a pointer compare. The underlying buffer lives as
+ * long as any handle to it does.
+ */
+class InternedString {
+ public:
+  // Default-constructed handles refer to the empty string.
+  InternedString();
+
+  const std::string& operator*() const { return *str_; }
+  const std::string* operator->() const { return str_.get(); }
+  std::string_view view() const { return *str_; }
+
+  bool operator==(const InternedString& other) const {
+    return str_ == other.str_ || *str_ == *other.str_;
+  }
+  bool operator!=(const InternedString& other) const { return !(*this == other); }
+
+  template <typename H>
+  friend H AbslHashValue(H h, const InternedString& s) {
+    return H::combine(std::move(h), *s.str_);
+  }
+
+ private:
+  friend class StringPool;
+  explicit InternedString(std::shared_ptr<const std::string> str) : str_(std::move(str)) {}
+
+  std::shared_ptr<const std::string> str_;
+};
+
+/**
+ * StringPool is a process-wide interning pool for strings that are heavily duplicated across the
+ * metadata state: pod/service/namespace/container names, container IDs and executable paths.
+ *
+ * The pool holds weak references, so an interned string is dropped once the last handle to it
+ * goes away; expired entries are swept opportunistically as the pool grows.
+ */
+class StringPool : public NotCopyable {
+ public:
+  static StringPool* GetInstance();
+
+  /**
+   * Intern returns a handle to a pooled copy of str, creating one if needed.
+   */
+  InternedString Intern(std::string_view str);
+
+  /**
+   * The number of pooled entries, including not-yet-swept expired ones. Exposed for tests.
+   */
+  size_t size() const;
+
+ private:
+  StringPool() = default;
+
+  mutable absl::Mutex mu_;
+  absl::flat_hash_map<std::string, std::weak_ptr<const std::string>> pool_ ABSL_GUARDED_BY(mu_);
+  // Expired entries are swept when the pool grows past this; doubles after each sweep.
+  size_t sweep_threshold_ ABSL_GUARDED_BY(mu_) = 1024;
+};
+
+/**
+ * Convenience wrapper to intern into the process-wide pool.
+ */
+inline InternedString InternString(std::string_view str) {
+  return StringPool::GetInstance()->Intern(str);
+}
+
+}  // namespace md
+}  // namespace px
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "src/shared/metadata/string_pool.h"
+
+namespace px {
+namespace md {
+
+TEST(StringPool, equal_strings_share_one_buffer) {
+  auto a = InternString("pod-name");
+  auto b = InternString(std::string("pod-name"));
+
+  EXPECT_EQ(&*a, &*b);
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(*a, "pod-name");
+  EXPECT_EQ(a.view(), "pod-name");
+}
+
+TEST(StringPool, distinct_strings) {
+  auto a = InternString("pod-a");
+  auto b = InternString("pod-b");
+
+  EXPECT_NE(&*a, &*b);
+  EXPECT_NE(a, b);
+}
+
+TEST(StringPool, default_is_empty_string) {
+  InternedString s;
+  EXPECT_EQ(*s, "");
+  EXPECT_EQ(s, InternedString());
+}
+
+TEST(StringPool, handles_outlive_reintern) {
+  auto a = InternString("long-lived");
+  {
+    auto b = InternString("long-lived");
+    EXPECT_EQ(&*a, &*b);
+  }
+  // a still valid after b went away; re-interning reuses a's buffer.
+  auto c = InternString("long-lived");
+  EXPECT_EQ(&*a, &*c);
+}
+
+}  // namespace md
+}  // namespace px
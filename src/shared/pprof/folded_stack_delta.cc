@@ -0,0 +1,128 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/shared/pprof/folded_stack_delta.h"
+
+#include <absl/strings/numbers.h>
+#include <absl/strings/str_cat.h>
+
+#include <algorithm>
+
+namespace px {
+namespace shared {
+
+namespace {
+constexpr char kFrameSep = ';';
+
+// Returns the number of whole leading frames shared between a and b.
+size_t SharedFrameCount(std::string_view a, std::string_view b) {
+  const size_t max_len = std::min(a.size(), b.size());
+  size_t common_len = 0;
+  while (common_len < max_len && a[common_len] == b[common_len]) {
+    ++common_len;
+  }
+
+  // Count the whole frames inside the common run. The frame the common run stops in only counts
+  // when both strings have a frame boundary (separator or end) right after it; otherwise the
+  // match ends mid-symbol and that frame is not actually shared.
+  size_t num_frames = 0;
+  size_t frame_start = 0;
+  for (size_t i = 0; i < common_len; ++i) {
+    if (a[i] == kFrameSep) {
+      ++num_frames;
+      frame_start = i + 1;
+    }
+  }
+  const bool a_boundary = common_len == a.size() || a[common_len] == kFrameSep;
+  const bool b_boundary = common_len == b.size() || b[common_len] == kFrameSep;
+  if (common_len > frame_start && a_boundary && b_boundary) {
+    ++num_frames;
+  }
+  return num_frames;
+}
+
+// Returns the byte offset just past the n-th frame separator of s,
+// i.e. the start of frame n (0-based).
+size_t FrameOffset(std::string_view s, size_t n) {
+  size_t offset = 0;
+  for (size_t i = 0; i < n; ++i) {
+    const size_t pos = s.find(kFrameSep, offset);
+    if (pos == std::string_view::npos) {
+      return s.size();
+    }
+    offset = pos + 1;
+  }
+  return offset;
+}
+}  // namespace
+
+std::string FoldedStackDeltaEncoder::Encode(std::string_view stack_trace_str) {
+  const size_t shared = SharedFrameCount(prev_, stack_trace_str);
+  prev_ = stack_trace_str;
+
+  if (shared == 0) {
+    return prev_;
+  }
+  const std::string_view suffix = stack_trace_str.substr(FrameOffset(stack_trace_str, shared));
+  std::string out(1, kFoldedStackDeltaMarker);
+  absl::StrAppend(&out, shared);
+  out.push_back(kFrameSep);
+  out.append(suffix);
+  return out;
+}
+
+std::string FoldedStackDeltaDecoder::Decode(std::string_view s) {
+  if (!IsFoldedStackDelta(s)) {
+    prev_ = s;
+    return prev_;
+  }
+
+  std::string_view rest = s.substr(1);
+  const size_t sep_pos = rest.find(kFrameSep);
+  size_t shared = 0;
+  if (sep_pos == std::string_view::npos ||
+      !absl::SimpleAtoi(absl::string_view(rest.data(), sep_pos), &shared)) {
+    // Malformed: pass through minus the marker rather than dropping the sample.
+    prev_ = rest;
+    return prev_;
+  }
+  std::string_view suffix = rest.substr(sep_pos + 1);
+
+  const size_t prefix_len = FrameOffset(prev_, shared);
+  std::string decoded;
+  if (prefix_len >= prev_.size()) {
+    // The whole previous string is the shared prefix (or the chain head is missing upstream:
+    // best effort, keep what we have).
+    decoded = prev_;
+    if (!decoded.empty() && !suffix.empty()) {
+      decoded.push_back(kFrameSep);
+    }
+    decoded.append(suffix);
+  } else if (suffix.empty()) {
+    // Frame boundary offsets include the trailing separator; strip it.
+    decoded = prev_.substr(0, prefix_len - 1);
+  } else {
+    decoded = prev_.substr(0, prefix_len);
+    decoded.append(suffix);
+  }
+  prev_ = std::move(decoded);
+  return prev_;
+}
+
+}  // namespace shared
+}  // namespace px
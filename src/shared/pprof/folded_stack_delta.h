@@ -0,0 +1,80 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace px {
+namespace shared {
+
+// Marker byte that prefixes a delta-encoded folded stack-trace string. It cannot occur in
+// symbolized stack traces (symbol names are printable text), so a plain folded string is
+// always distinguishable from an encoded one.
+constexpr char kFoldedStackDeltaMarker = '\x01';
+
+// Returns whether a stack-trace string carries the delta encoding (vs. a plain folded string).
+inline bool IsFoldedStackDelta(std::string_view s) {
+  return !s.empty() && s.front() == kFoldedStackDeltaMarker;
+}
+
+/**
+ * Delta-encodes folded (semicolon-separated) stack-trace strings against the previously
+ * encoded string. Consecutive stack traces sorted lexicographically share long prefixes of
+ * whole frames; an encoded string replaces the shared prefix with its frame count:
+ *
+ *   main;qux;baz       =>  main;qux;baz        (first in chain: emitted as-is)
+ *   main;qux;quux      =>  \x01 "2;quux"       (2 frames shared with the previous string)
+ *
+ * The prefix always ends on a frame boundary, so decoding yields valid folded strings.
+ * Decoding depends on the previous string in the chain: chains must be restarted (via Reset())
+ * at any boundary across which row order or completeness is not guaranteed.
+ */
+class FoldedStackDeltaEncoder {
+ public:
+  // Returns the encoding of stack_trace_str relative to the previously encoded string, or the
+  // full string when no whole frame is shared.
+  std::string Encode(std::string_view stack_trace_str);
+
+  // Restarts the chain: the next Encode() emits its input verbatim.
+  void Reset() { prev_.clear(); }
+
+ private:
+  std::string prev_;
+};
+
+/**
+ * Reconstructs full folded strings from a chain produced by FoldedStackDeltaEncoder.
+ * Strings must be presented in their original emission order; a plain (un-encoded) string
+ * restarts the chain, so interleaved chains that each begin with a plain string also decode
+ * correctly.
+ */
+class FoldedStackDeltaDecoder {
+ public:
+  // Returns the full folded string for s, which may be plain or delta-encoded.
+  // If an encoded string arrives with no preceding chain (e.g. the chain head was filtered
+  // out upstream), the un-shared suffix frames are returned as a best effort.
+  std::string Decode(std::string_view s);
+
+ private:
+  std::string prev_;
+};
+
+}  // namespace shared
+}  // namespace px
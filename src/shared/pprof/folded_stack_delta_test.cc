@@ -0,0 +1,103 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/shared/pprof/folded_stack_delta.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace px {
+namespace shared {
+
+namespace {
+// Encodes & decodes a chain, expecting the round trip to reproduce the input.
+std::vector<std::string> RoundTrip(const std::vector<std::string>& stacks) {
+  FoldedStackDeltaEncoder encoder;
+  FoldedStackDeltaDecoder decoder;
+  std::vector<std::string> out;
+  for (const auto& stack : stacks) {
+    out.push_back(decoder.Decode(encoder.Encode(stack)));
+  }
+  return out;
+}
+}  // namespace
+
+TEST(FoldedStackDelta, round_trip_of_sorted_chain) {
+  const std::vector<std::string> stacks = {
+      "main;compute;map",
+      "main;compute;map;reduce",
+      "main;compute;reduce",
+      "main;io;read",
+      "main;io;write",
+  };
+  EXPECT_EQ(RoundTrip(stacks), stacks);
+}
+
+TEST(FoldedStackDelta, first_string_and_unrelated_strings_pass_through) {
+  FoldedStackDeltaEncoder encoder;
+  EXPECT_EQ(encoder.Encode("main;foo;bar"), "main;foo;bar");
+  // No whole frame shared: emitted verbatim, which also restarts the decode chain.
+  EXPECT_EQ(encoder.Encode("qux;foo;bar"), "qux;foo;bar");
+}
+
+TEST(FoldedStackDelta, shared_prefix_replaced_with_frame_count) {
+  FoldedStackDeltaEncoder encoder;
+  EXPECT_EQ(encoder.Encode("main;foo;bar"), "main;foo;bar");
+
+  const std::string encoded = encoder.Encode("main;foo;baz");
+  ASSERT_TRUE(IsFoldedStackDelta(encoded));
+  EXPECT_EQ(encoded.substr(1), "2;baz");
+}
+
+TEST(FoldedStackDelta, partial_symbol_match_is_not_a_shared_frame) {
+  FoldedStackDeltaEncoder encoder;
+  EXPECT_EQ(encoder.Encode("main"), "main");
+  // "main" is a prefix of "maintain", but not a whole shared frame.
+  EXPECT_EQ(encoder.Encode("maintain"), "maintain");
+}
+
+TEST(FoldedStackDelta, prefix_and_extension_of_previous_stack) {
+  const std::vector<std::string> stacks = {
+      "main;foo;bar",
+      "main;foo",            // Previous stack truncated at a frame boundary.
+      "main;foo;bar;baz",    // Extension of the previous stack.
+      "main;foo;bar;baz",    // Identical to the previous stack.
+  };
+  EXPECT_EQ(RoundTrip(stacks), stacks);
+}
+
+TEST(FoldedStackDelta, reset_restarts_the_chain) {
+  FoldedStackDeltaEncoder encoder;
+  EXPECT_EQ(encoder.Encode("main;foo;bar"), "main;foo;bar");
+  encoder.Reset();
+  EXPECT_EQ(encoder.Encode("main;foo;baz"), "main;foo;baz");
+}
+
+TEST(FoldedStackDelta, unresolved_address_frames_round_trip) {
+  // The stringifier emits hex addresses or placeholder text when symbols cannot be resolved.
+  const std::vector<std::string> stacks = {
+      "main;0x00000000006b8f11;0x00000000006b9001",
+      "main;0x00000000006b8f11;[UNKNOWN]",
+  };
+  EXPECT_EQ(RoundTrip(stacks), stacks);
+}
+
+}  // namespace shared
+}  // namespace px
@@ -28,48 +28,109 @@
 namespace px {
 namespace shared {
 
-PProfProfile CreatePProfProfile(const uint32_t period_ms, const PProfHisto& histo) {
+PProfBuilder::PProfBuilder(const uint32_t period_ms) : period_ns_(period_ms * 1000 * 1000) {
   // Info on the pprof proto format:
   // https://github.com/google/pprof/blob/main/proto/profile.proto
 
-  // period_ms is the stack trace sampling period used by the eBPF stack trace sampling probe.
-  // period_ns will be used when populating the nanos count.
-  const uint64_t period_ns = period_ms * 1000 * 1000;
-
-  // Tracks which strings have been inserted into the profile.
-  absl::flat_hash_map<std::string, uint64_t> strings;
-
-  // This is the pprof profile.
-  ::perftools::profiles::Profile profile;
-
   // The pprof profiles start by describing their sample types. For CPU profiling,
   // the convention is to describe two different metrics:
   // "samples" with units of "count", and
   // "cpu" with units of "nanoseconds".
   // Note, the first entry in the strings table is required to be an empty string.
-  auto sample_type = profile.add_sample_type();
+  auto sample_type = tables_.add_sample_type();
   sample_type->set_type(1);
   sample_type->set_unit(2);
-  profile.add_string_table("");
-  profile.add_string_table("samples");
-  profile.add_string_table("count");
-  sample_type = profile.add_sample_type();
+  tables_.add_string_table("");
+  tables_.add_string_table("samples");
+  tables_.add_string_table("count");
+  sample_type = tables_.add_sample_type();
   sample_type->set_type(3);
   sample_type->set_unit(4);
-  profile.add_string_table("cpu");
-  profile.add_string_table("nanoseconds");
+  tables_.add_string_table("cpu");
+  tables_.add_string_table("nanoseconds");
 
   // Store the underlying stack trace sampling period.
-  auto period_type = profile.mutable_period_type();
+  auto period_type = tables_.mutable_period_type();
   period_type->set_type(3);
   period_type->set_unit(4);
-  profile.set_period(period_ns);
+  tables_.set_period(period_ns_);
+}
+
+const std::vector<uint64_t>& PProfBuilder::LocationIDsForStackTrace(
+    const std::string& stack_trace_str) {
+  const auto [stack_iter, stack_inserted] = stack_trace_location_ids_.try_emplace(stack_trace_str);
+  std::vector<uint64_t>& loc_ids = stack_iter->second;
+  if (!stack_inserted) {
+    // This stack trace was already interned (possibly by an earlier build): reuse its
+    // location-id sequence directly, with no splitting or per-symbol lookups.
+    return loc_ids;
+  }
+
+  // Our stack traces are symbolized like so: main;foo;bar
+  // thus, we split on ';' to iterate over the individual symbols.
+  const std::vector<std::string_view> symbols = absl::StrSplit(stack_trace_str, ";");
+  loc_ids.reserve(symbols.size());
+
+  // Iterate over the symbols in this stack trace.
+  // Each symbol is represented by a "location" message, which in turn refers to a
+  // string in the strings table (more details below).
+  // Note, because of how we built the stack trace string and how the pprof profile is
+  // organized, we iterate in reverse order.
+  for (auto symbols_iter = symbols.rbegin(); symbols_iter != symbols.rend(); ++symbols_iter) {
+    const auto& symbol = *symbols_iter;
+
+    // try_emplace() looks up an existing entry for the symbol, or creates a new entry
+    // that maps from symbol to the next available location id.
+    const uint64_t next_location_id = tables_.location_size() + 1;
+    const auto [ids_iter, inserted] = location_ids_.try_emplace(symbol, next_location_id);
+
+    if (inserted) {
+      // New symbol: create a new location, function & string-table entry.
+      const uint64_t location_id = next_location_id;
+      const uint64_t string_id = tables_.string_table_size();
+
+      // Add a new "location" to the tables.
+      // Each sample is a sequence of locations. The locations, in their sequence, represent a
+      // stack trace. Each location may include an address and a reference to a mapping (useful
+      // if symbols are not included in the profile, enables post-hoc symbolization).
+      // Lacking both address and mapping here, we skip those.
+      auto location = tables_.add_location();
+      location->set_id(location_id);
+
+      // To connect a location to a symbol, we need to go through a "line" and a "function".
+
+      // Add a "line" message to the location message.
+      // In our usage, this is essentially a pointer to a function message that points to a
+      // symbol. The function message may contain more information (e.g. starting line number).
+      auto line = location->add_line();
+      line->set_function_id(location_id);
+
+      // Add a "function" (to point to the string table).
+      auto function = tables_.add_function();
+      function->set_id(location_id);
+
+      // Add a reference to the string table entry in the function message.
+      function->set_name(string_id);
+
+      // Add the string to the string table.
+      tables_.add_string_table(std::string(symbol));
+    }
 
-  // State variables useful as we build the pprof profile message.
-  // No locations messages exist (yet); next_location_id starts at 1.
-  // We already added some strings; next_string_id starts at 5.
-  uint64_t next_location_id = 1;
-  uint64_t next_string_id = 5;
+    loc_ids.push_back(ids_iter->second);
+  }
+  return loc_ids;
+}
+
+PProfProfile PProfBuilder::BuildProfile(const PProfHisto& histo) {
+  // First, intern any stack traces not seen before, so that tables_ is complete for this
+  // window before it is copied into the output profile.
+  for (const auto& [stack_trace_str, count] : histo) {
+    PX_UNUSED(count);
+    LocationIDsForStackTrace(stack_trace_str);
+  }
+
+  // The profile starts as a copy of the accumulated tables; pprof profiles are self-contained.
+  PProfProfile profile = tables_;
 
   // To build the profile, we iterate over the stack traces histogram.
   for (const auto& [stack_trace_str, count] : histo) {
@@ -77,73 +138,22 @@ PProfProfile CreatePProfProfile(const uint32_t period_ms, const PProfHisto& hist
     auto sample = profile.add_sample();
 
     // That sample will record its count and time in nanos.
-    const uint64_t nanos = count * period_ns;
+    const uint64_t nanos = count * period_ns_;
     sample->add_value(count);
     sample->add_value(nanos);
 
-    // Our stack traces are symbolized like so: main;foo;bar
-    // thus, we split on ';' to iterate over the individual symbols.
-    const std::vector<std::string_view> symbols = absl::StrSplit(stack_trace_str, ";");
-
-    // Iterate over the symbols in this stack trace.
-    // Each symbol will be added to the sample as a "location" message, which in turn refers to a
-    // string in the strings table (tracked in map "strings") (more details below).
-    // Note, because of how we built the stack trace string and how the pprof profile is
-    // organized, we iterate in reverse order.
-    for (auto symbols_iter = symbols.rbegin(); symbols_iter != symbols.rend(); ++symbols_iter) {
-      const auto& symbol = *symbols_iter;
-
-      // try_emplace() looks up an existing entry in the strings table, or creates a new entry
-      // with the key provided. Here a new entry maps from symbol to next_location_id.
-      const auto [strings_iter, inserted] = strings.try_emplace(symbol, next_location_id);
-
-      if (inserted) {
-        // New symbol: create a new location, add it to the sample, and create a new symbol.
-
-        const uint64_t location_id = next_location_id;
-        const uint64_t string_id = next_string_id;
-        ++next_location_id;
-        ++next_string_id;
-
-        // Add a new "location" to the profile.
-        // Each sample is a sequence of locations. The locations, in their sequence, represent a
-        // stack trace. Each location may include an address and a reference to a mapping (useful
-        // if symbols are not included in the profile, enables post-hoc symbolization).
-        // Lacking both address and mapping here, we skip those.
-        auto location = profile.add_location();
-        location->set_id(location_id);
-
-        // To connect a location to a symbol, we need to go through a "line" and a "function".
-
-        // Add a "line" message to the location message.
-        // In our usage, this is essentially a pointer to a function message that points to a
-        // symbol. The function message may contain more information (e.g. starting line number).
-        auto line = location->add_line();
-        line->set_function_id(location_id);
-
-        // Add a "function" to the profile (to point to the string table).
-        auto function = profile.add_function();
-        function->set_id(location_id);
-
-        // Add a reference to the string table entry in the function message.
-        function->set_name(string_id);
-
-        // Add the string to the string table in the profile.
-        profile.add_string_table(std::string(symbol));
-
-        // Add the new location-id into the sample in the profile.
-        sample->add_location_id(location_id);
-      } else {
-        // Existing symbol.
-        // Just place the pre-existing location id into the sample.
-        const uint64_t location_id = strings_iter->second;
-        sample->add_location_id(location_id);
-      }
+    for (const uint64_t location_id : LocationIDsForStackTrace(stack_trace_str)) {
+      sample->add_location_id(location_id);
     }
   }
   return profile;
 }
 
+PProfProfile CreatePProfProfile(const uint32_t period_ms, const PProfHisto& histo) {
+  PProfBuilder builder(period_ms);
+  return builder.BuildProfile(histo);
+}
+
 absl::flat_hash_map<std::string, uint64_t> DeserializePProfProfile(const PProfProfile& pprof) {
   // This function reads from the protobuf pprof to populate and return this stack trace histogram.
   absl::flat_hash_map<std::string, uint64_t> histo;
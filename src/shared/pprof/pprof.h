@@ -19,6 +19,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include <absl/container/flat_hash_map.h>
 
@@ -30,6 +31,42 @@ namespace shared {
 using PProfProfile = ::perftools::profiles::Profile;
 using PProfHisto = absl::flat_hash_map<std::string, uint64_t>;
 
+/**
+ * Builds pprof profiles from stack-trace histograms, interning the string, location & function
+ * tables across builds. A standing profiler query produces a new window of stack traces with
+ * mostly recurring stacks; by keeping the builder alive across windows, recurring stacks skip
+ * the split/hash/table-append work, and consecutive profiles share table prefixes and ids
+ * (which also makes them diff- and compression-friendly).
+ *
+ * For one-shot usage, see CreatePProfProfile() below.
+ */
+class PProfBuilder {
+ public:
+  // period_ms is the stack trace sampling period used by the eBPF stack trace sampling probe.
+  explicit PProfBuilder(uint32_t period_ms);
+
+  // Builds a self-contained profile for one window of stack-trace data.
+  // Symbols & stacks seen by earlier builds reuse their interned ids and table entries.
+  PProfProfile BuildProfile(const PProfHisto& histo);
+
+ private:
+  // Returns the pprof location-id sequence for a stack trace string (in pprof's leaf-first
+  // order), interning any locations/functions/strings not seen before into tables_.
+  const std::vector<uint64_t>& LocationIDsForStackTrace(const std::string& stack_trace_str);
+
+  const uint64_t period_ns_;
+
+  // The accumulated sample types, string table, locations & functions. Each built profile
+  // starts as a copy of these tables; newly seen symbols are appended here first.
+  PProfProfile tables_;
+
+  // symbol => location id (and function id & string-table id, which track it).
+  absl::flat_hash_map<std::string, uint64_t> location_ids_;
+
+  // stack trace string => location-id sequence, memoized across builds.
+  absl::flat_hash_map<std::string, std::vector<uint64_t>> stack_trace_location_ids_;
+};
+
 // https://github.com/google/pprof/blob/main/proto/profile.proto
 PProfProfile CreatePProfProfile(const uint32_t period_ms, const PProfHisto& histo);
 PProfHisto DeserializePProfProfile(const PProfProfile& pprof);
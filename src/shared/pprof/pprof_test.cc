@@ -0,0 +1,78 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/shared/pprof/pprof.h"
+
+#include <gtest/gtest.h>
+
+namespace px {
+namespace shared {
+
+namespace {
+constexpr uint32_t kProfilerPeriodMS = 11;
+}
+
+TEST(PProf, create_and_deserialize_round_trip) {
+  const PProfHisto histo = {
+      {"foo;bar;baz", 3},
+      {"foo;bar;qux", 2},
+      {"main;compute;map;reduce", 21},
+  };
+
+  const PProfProfile pprof = CreatePProfProfile(kProfilerPeriodMS, histo);
+  EXPECT_EQ(DeserializePProfProfile(pprof), histo);
+}
+
+TEST(PProfBuilder, reuses_interned_tables_across_builds) {
+  PProfBuilder builder(kProfilerPeriodMS);
+
+  // First window of stack-trace data.
+  const PProfHisto window_1 = {
+      {"main;foo;bar", 3},
+      {"main;foo;qux", 2},
+  };
+  const PProfProfile pprof_1 = builder.BuildProfile(window_1);
+  EXPECT_EQ(DeserializePProfProfile(pprof_1), window_1);
+
+  // Second window: one recurring stack and one new one.
+  const PProfHisto window_2 = {
+      {"main;foo;bar", 5},
+      {"main;baz", 1},
+  };
+  const PProfProfile pprof_2 = builder.BuildProfile(window_2);
+  EXPECT_EQ(DeserializePProfProfile(pprof_2), window_2);
+
+  // Tables interned by the first build are carried into the second: the second profile's
+  // string & location tables extend the first's, with stable ids for recurring symbols.
+  ASSERT_GE(pprof_2.string_table_size(), pprof_1.string_table_size());
+  for (int i = 0; i < pprof_1.string_table_size(); ++i) {
+    EXPECT_EQ(pprof_2.string_table(i), pprof_1.string_table(i));
+  }
+
+  ASSERT_GE(pprof_2.location_size(), pprof_1.location_size());
+  for (int i = 0; i < pprof_1.location_size(); ++i) {
+    EXPECT_EQ(pprof_2.location(i).id(), pprof_1.location(i).id());
+    EXPECT_EQ(pprof_2.function(i).name(), pprof_1.function(i).name());
+  }
+
+  // The new symbol ("baz") appears only in the second profile's tables.
+  EXPECT_GT(pprof_2.location_size(), pprof_1.location_size());
+}
+
+}  // namespace shared
+}  // namespace px
@@ -26,6 +26,7 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -227,6 +228,35 @@ class ArrowArrayIterator
   int64_t curr_idx_ = 0;
 };
 
+/**
+ * Branchless lower_bound over a sorted int64 buffer: the index of the first element >= val, or
+ * `size` when there is none. Each step narrows the search window with a conditional move instead
+ * of a data-dependent branch the predictor can't guess, which measurably helps the sorted-time
+ * lookups that position every table cursor.
+ */
+inline int64_t BranchlessLowerBoundInt64(const int64_t* data, int64_t size, int64_t val) {
+  const int64_t* base = data;
+  while (size > 1) {
+    const int64_t half = size / 2;
+    base += (base[half - 1] < val) ? half : 0;
+    size -= half;
+  }
+  return (base - data) + ((size == 1 && *base < val) ? 1 : 0);
+}
+
+/**
+ * Branchless upper_bound counterpart: the index of the first element > val, or `size`.
+ */
+inline int64_t BranchlessUpperBoundInt64(const int64_t* data, int64_t size, int64_t val) {
+  const int64_t* base = data;
+  while (size > 1) {
+    const int64_t half = size / 2;
+    base += (base[half - 1] <= val) ? half : 0;
+    size -= half;
+  }
+  return (base - data) + ((size == 1 && *base <= val) ? 1 : 0);
+}
+
 /**
  * Search through the arrow array for the index of the first item equal or greater than the given
  * value.
@@ -240,12 +270,21 @@ int64_t SearchArrowArrayGreaterThanOrEqual(
     arrow::Array* arr,
     typename types::ValueTypeTraits<typename types::DataTypeTraits<T>::value_type>::native_type
         val) {
-  auto arr_iterator = ArrowArrayIterator<T>(arr);
-  auto res = std::lower_bound(arr_iterator, arr_iterator.end(), val);
-  if (res != arr_iterator.end()) {
-    return std::distance(arr_iterator.begin(), res);
+  // Int64-backed arrays (INT64, TIME64NS) search their raw value buffer branchlessly, skipping
+  // the per-element iterator indirection. Time columns are the overwhelmingly common case.
+  if constexpr (std::is_same_v<typename types::DataTypeTraits<T>::native_type, int64_t>) {
+    const auto* typed_arr =
+        static_cast<const typename types::DataTypeTraits<T>::arrow_array_type*>(arr);
+    auto res = BranchlessLowerBoundInt64(typed_arr->raw_values(), arr->length(), val);
+    return res == arr->length() ? -1 : res;
+  } else {
+    auto arr_iterator = ArrowArrayIterator<T>(arr);
+    auto res = std::lower_bound(arr_iterator, arr_iterator.end(), val);
+    if (res != arr_iterator.end()) {
+      return std::distance(arr_iterator.begin(), res);
+    }
+    return -1;
   }
-  return -1;
 }
 
 /**
@@ -285,15 +324,22 @@ int64_t SearchArrowArrayLessThanOrEqual(
     arrow::Array* arr,
     typename types::ValueTypeTraits<typename types::DataTypeTraits<T>::value_type>::native_type
         val) {
-  auto arr_iterator = ArrowArrayIterator<T>(arr);
-  auto res = std::upper_bound(arr_iterator, arr_iterator.end(), val);
-  if (res == arr_iterator.begin()) {
-    // All elements are greater than val.
-    return -1;
+  if constexpr (std::is_same_v<typename types::DataTypeTraits<T>::native_type, int64_t>) {
+    const auto* typed_arr =
+        static_cast<const typename types::DataTypeTraits<T>::arrow_array_type*>(arr);
+    // The element before the first greater-than element is the last less-than-or-equal element.
+    return BranchlessUpperBoundInt64(typed_arr->raw_values(), arr->length(), val) - 1;
+  } else {
+    auto arr_iterator = ArrowArrayIterator<T>(arr);
+    auto res = std::upper_bound(arr_iterator, arr_iterator.end(), val);
+    if (res == arr_iterator.begin()) {
+      // All elements are greater than val.
+      return -1;
+    }
+    // The element before the first greater than element is the last less than or equal element.
+    res--;
+    return std::distance(arr_iterator.begin(), res);
   }
-  // The element before the first greater than element is the last less than or equal element.
-  res--;
-  return std::distance(arr_iterator.begin(), res);
 }
 
 class TypeErasedArrowBuilder {
@@ -337,6 +383,18 @@ class TypeErasedArrowBuilderImpl : public TypeErasedArrowBuilder {
     }
   }
 
+  /**
+   * Bulk append a contiguous range of fixed-width values. Arrow copies the whole range with a
+   * single memcpy, so this should be preferred over the iterator overload whenever the source
+   * values are contiguous in memory (e.g. during compaction of numeric columns).
+   */
+  void UnsafeAppendValues(const typename types::DataTypeTraits<TDataType>::native_type* values,
+                          size_t length) {
+    static_assert(TDataType != types::DataType::STRING && TDataType != types::DataType::BOOLEAN,
+                  "Contiguous bulk append is only supported for fixed-width columns.");
+    PX_CHECK_OK(typed_builder_->AppendValues(values, length));
+  }
+
  private:
   std::unique_ptr<arrow::ArrayBuilder> builder_;
   BuilderType* typed_builder_;
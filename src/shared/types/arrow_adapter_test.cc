@@ -44,5 +44,31 @@ TEST(BinarySearchTest, find_index_lower_or_eq) {
   EXPECT_EQ(3, SearchArrowArrayLessThan<types::DataType::INT64>(col_rb1_arrow.get(), 8));
 }
 
+TEST(BinarySearchTest, time64_columns_with_duplicates) {
+  std::vector<types::Time64NSValue> times = {10, 10, 20, 20, 20, 30};
+  auto times_arrow = types::ToArrow(times, arrow::default_memory_pool());
+
+  EXPECT_EQ(0, SearchArrowArrayGreaterThanOrEqual<types::DataType::TIME64NS>(times_arrow.get(), 5));
+  EXPECT_EQ(2,
+            SearchArrowArrayGreaterThanOrEqual<types::DataType::TIME64NS>(times_arrow.get(), 15));
+  EXPECT_EQ(2,
+            SearchArrowArrayGreaterThanOrEqual<types::DataType::TIME64NS>(times_arrow.get(), 20));
+  EXPECT_EQ(-1,
+            SearchArrowArrayGreaterThanOrEqual<types::DataType::TIME64NS>(times_arrow.get(), 31));
+
+  EXPECT_EQ(-1, SearchArrowArrayLessThanOrEqual<types::DataType::TIME64NS>(times_arrow.get(), 5));
+  EXPECT_EQ(4, SearchArrowArrayLessThanOrEqual<types::DataType::TIME64NS>(times_arrow.get(), 20));
+  EXPECT_EQ(5, SearchArrowArrayLessThanOrEqual<types::DataType::TIME64NS>(times_arrow.get(), 31));
+}
+
+TEST(BinarySearchTest, empty_array) {
+  std::vector<types::Time64NSValue> times;
+  auto times_arrow = types::ToArrow(times, arrow::default_memory_pool());
+
+  EXPECT_EQ(-1,
+            SearchArrowArrayGreaterThanOrEqual<types::DataType::TIME64NS>(times_arrow.get(), 1));
+  EXPECT_EQ(-1, SearchArrowArrayLessThanOrEqual<types::DataType::TIME64NS>(times_arrow.get(), 1));
+}
+
 }  // namespace types
 }  // namespace px
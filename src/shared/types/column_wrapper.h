@@ -42,11 +42,48 @@ using ColumnWrapperRecordBatch = std::vector<types::SharedColumnWrapper>;
 using TabletID = std::string;
 using TabletIDView = std::string_view;
 
+namespace internal {
+
+/**
+ * An arrow::Buffer view over memory owned by another object; shares ownership of that object so
+ * the memory stays alive as long as the buffer does.
+ */
+class OwnedBuffer : public arrow::Buffer {
+ public:
+  OwnedBuffer(const uint8_t* data, int64_t size, std::shared_ptr<const void> owner)
+      : arrow::Buffer(data, size), owner_(std::move(owner)) {}
+
+ private:
+  std::shared_ptr<const void> owner_;
+};
+
+// Value types whose in-memory representation matches the corresponding Arrow data buffer layout,
+// so an Arrow array can alias ColumnWrapper storage without a copy. BoolValue is excluded because
+// Arrow bit-packs booleans; UINT128 and STRING need their own buffer layouts.
+template <typename T>
+constexpr bool kHasArrowCompatibleLayout = std::is_same_v<T, Int64Value> ||
+                                           std::is_same_v<T, Float64Value> ||
+                                           std::is_same_v<T, Time64NSValue>;
+
+template <typename T>
+std::shared_ptr<arrow::DataType> ArrowDataTypeFor() {
+  if constexpr (std::is_same_v<T, Time64NSValue>) {
+    return arrow::time64(arrow::TimeUnit::NANO);
+  } else if constexpr (std::is_same_v<T, Int64Value>) {
+    return arrow::int64();
+  } else {
+    static_assert(std::is_same_v<T, Float64Value>, "Unexpected type for zero-copy conversion.");
+    return arrow::float64();
+  }
+}
+
+}  // namespace internal
+
 /**
  * Column wrapper stores underlying data so that it can be retrieved in a type erased way
  * to allow column chucks to be transparently passed.
  */
-class ColumnWrapper {
+class ColumnWrapper : public std::enable_shared_from_this<ColumnWrapper> {
  public:
   ColumnWrapper() = default;
   virtual ~ColumnWrapper() = default;
@@ -69,6 +106,9 @@ class ColumnWrapper {
   virtual void Reserve(size_t size) = 0;
   virtual void Clear() = 0;
   virtual void ShrinkToFit() = 0;
+  // For fixed-width columns on shared_ptr-managed wrappers, the returned array aliases this
+  // wrapper's storage (and keeps the wrapper alive) instead of copying. The wrapper must not be
+  // appended to, resized or cleared while such an array is in use.
   virtual std::shared_ptr<arrow::Array> ConvertToArrow(arrow::MemoryPool* mem_pool) = 0;
   // GetView returns an empty string view for all non-string columns.
   virtual std::string_view GetView(size_t idx) const = 0;
@@ -122,6 +162,23 @@ class ColumnWrapperTmpl : public ColumnWrapper {
   bool Empty() const override { return data_.empty(); }
 
   std::shared_ptr<arrow::Array> ConvertToArrow(arrow::MemoryPool* mem_pool) override {
+    if constexpr (internal::kHasArrowCompatibleLayout<T>) {
+      static_assert(sizeof(T) == sizeof(decltype(std::declval<T>().val)),
+                    "Zero-copy conversion requires the value wrapper to add no storage.");
+      // Zero-copy path: wrap this wrapper's storage in an Arrow buffer that shares ownership of
+      // the wrapper. Requires the wrapper to be shared_ptr-managed; stack-allocated wrappers fall
+      // through to the copying path.
+      if (!weak_from_this().expired()) {
+        auto buffer = std::make_shared<internal::OwnedBuffer>(
+            reinterpret_cast<const uint8_t*>(data_.data()),
+            static_cast<int64_t>(data_.size() * sizeof(T)), shared_from_this());
+        auto arr_data =
+            arrow::ArrayData::Make(internal::ArrowDataTypeFor<T>(),
+                                   static_cast<int64_t>(data_.size()),
+                                   {nullptr, std::move(buffer)}, /*null_count=*/0);
+        return arrow::MakeArray(arr_data);
+      }
+    }
     return ToArrow(data_, mem_pool);
   }
 
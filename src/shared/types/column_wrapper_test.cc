@@ -283,5 +283,45 @@ TEST(ColumnWrapperTest, MoveIndexes) {
   }
 }
 
+TEST(ColumnWrapperTest, convert_to_arrow_zero_copy) {
+  auto wrapper = ColumnWrapper::Make(DataType::INT64, 0);
+  for (int64_t i = 0; i < 100; ++i) {
+    wrapper->Append<Int64Value>(i);
+  }
+
+  auto arrow_arr = wrapper->ConvertToArrow(arrow::default_memory_pool());
+  ASSERT_EQ(DataTypeTraits<DataType::INT64>::arrow_type_id, arrow_arr->type_id());
+  ASSERT_EQ(100, arrow_arr->length());
+
+  // The array aliases the wrapper's storage rather than copying it.
+  auto typed_arr = std::static_pointer_cast<arrow::Int64Array>(arrow_arr);
+  EXPECT_EQ(reinterpret_cast<const void*>(typed_arr->raw_values()),
+            reinterpret_cast<const void*>(wrapper->UnsafeRawData()));
+  for (int64_t i = 0; i < 100; ++i) {
+    EXPECT_EQ(i, typed_arr->Value(i));
+  }
+
+  // The array keeps the data alive after the wrapper handle is released.
+  wrapper.reset();
+  EXPECT_EQ(42, typed_arr->Value(42));
+}
+
+TEST(ColumnWrapperTest, convert_to_arrow_unshared_wrapper_copies) {
+  Int64ValueColumnWrapper wrapper(0);
+  for (int64_t i = 0; i < 10; ++i) {
+    wrapper.Append(i);
+  }
+
+  // A stack-allocated wrapper cannot hand out shared ownership, so conversion copies.
+  auto arrow_arr = wrapper.ConvertToArrow(arrow::default_memory_pool());
+  ASSERT_EQ(10, arrow_arr->length());
+  auto typed_arr = std::static_pointer_cast<arrow::Int64Array>(arrow_arr);
+  EXPECT_NE(reinterpret_cast<const void*>(typed_arr->raw_values()),
+            reinterpret_cast<const void*>(wrapper.UnsafeRawData()));
+  for (int64_t i = 0; i < 10; ++i) {
+    EXPECT_EQ(i, typed_arr->Value(i));
+  }
+}
+
 }  // namespace types
 }  // namespace px
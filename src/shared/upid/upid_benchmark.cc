@@ -19,9 +19,11 @@
 #include <absl/container/flat_hash_set.h>
 #include <benchmark/benchmark.h>
 #include <random>
+#include <vector>
 
 #include "src/common/benchmark/benchmark.h"
 #include "src/shared/upid/upid.h"
+#include "src/shared/upid/upid_kernels.h"
 
 using ::px::md::UPID;
 
@@ -37,3 +39,53 @@ static void BM_set_insertion(benchmark::State& state) {  // NOLINT
 
 BENCHMARK_TEMPLATE(BM_set_insertion, std::set<UPID>)->DenseRange(100, 1000, 100);
 BENCHMARK_TEMPLATE(BM_set_insertion, absl::flat_hash_set<UPID>)->DenseRange(100, 1000, 100);
+
+static std::vector<UPID> MakeUPIDs(int64_t count) {
+  std::vector<UPID> upids;
+  upids.reserve(count);
+  for (int64_t i = 0; i < count; ++i) {
+    upids.emplace_back(static_cast<uint32_t>(i), static_cast<uint32_t>(i), i);
+  }
+  return upids;
+}
+
+// NOLINTNEXTLINE : runtime/references.
+static void BM_batch_hash(benchmark::State& state) {
+  auto upids = MakeUPIDs(state.range(0));
+  std::vector<uint64_t> hashes(upids.size());
+  for (auto _ : state) {
+    px::md::HashUPIDs(upids.data(), upids.size(), hashes.data());
+    benchmark::DoNotOptimize(hashes.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// NOLINTNEXTLINE : runtime/references.
+static void BM_scalar_absl_hash(benchmark::State& state) {
+  auto upids = MakeUPIDs(state.range(0));
+  std::vector<uint64_t> hashes(upids.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < upids.size(); ++i) {
+      hashes[i] = absl::Hash<UPID>{}(upids[i]);
+    }
+    benchmark::DoNotOptimize(hashes.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// NOLINTNEXTLINE : runtime/references.
+static void BM_batch_equal_constant(benchmark::State& state) {
+  auto upids = MakeUPIDs(state.range(0));
+  UPID needle(1, 1, 1);
+  std::vector<uint8_t> matches(upids.size());
+  for (auto _ : state) {
+    px::md::UPIDsEqual(upids.data(), upids.size(), needle,
+                       reinterpret_cast<bool*>(matches.data()));
+    benchmark::DoNotOptimize(matches.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_batch_hash)->Range(1024, 64 * 1024);
+BENCHMARK(BM_scalar_absl_hash)->Range(1024, 64 * 1024);
+BENCHMARK(BM_batch_equal_constant)->Range(1024, 64 * 1024);
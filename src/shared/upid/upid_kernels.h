@@ -0,0 +1,99 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <absl/numeric/int128.h>
+
+#include "src/shared/upid/upid.h"
+
+namespace px {
+namespace md {
+
+/**
+ * Batch kernels over UPIDs.
+ *
+ * UPID is the join/group/lookup key in effectively every query, so the hot paths see long runs of
+ * 128-bit keys that get hashed or compared one row at a time. The kernels here are plain
+ * fixed-trip, branch-free loops over contiguous inputs, which the compiler auto-vectorizes; they
+ * write results into caller-provided arrays so batch callers pay no per-row allocation.
+ *
+ * The hash is the Hash128to64 construction from CityHash: multiply/xorshift only, so it
+ * vectorizes cleanly and avoids pulling a hashing library into this (dependency-light) target.
+ * It is deterministic across runs; callers that need a process-seeded hash (e.g. absl
+ * containers) should keep using AbslHashValue.
+ */
+
+/**
+ * Mixes a 128-bit value (as high/low words) down to 64 bits.
+ */
+inline uint64_t HashUPID128(uint64_t hi, uint64_t lo) {
+  constexpr uint64_t kMul = 0x9ddfea08eb382d69ULL;
+  uint64_t a = (lo ^ hi) * kMul;
+  a ^= (a >> 47);
+  uint64_t b = (hi ^ a) * kMul;
+  b ^= (b >> 47);
+  return b * kMul;
+}
+
+inline uint64_t HashUPID(const UPID& upid) {
+  return HashUPID128(absl::Uint128High64(upid.value()), absl::Uint128Low64(upid.value()));
+}
+
+/**
+ * Hashes count UPIDs into a caller-allocated array of count hashes.
+ */
+inline void HashUPIDs(const UPID* upids, size_t count, uint64_t* hashes_out) {
+  for (size_t i = 0; i < count; ++i) {
+    hashes_out[i] = HashUPID(upids[i]);
+  }
+}
+
+/**
+ * Same as HashUPIDs, for callers that hold raw 128-bit values (e.g. UINT128 columns).
+ */
+inline void HashUPIDValues(const absl::uint128* values, size_t count, uint64_t* hashes_out) {
+  for (size_t i = 0; i < count; ++i) {
+    hashes_out[i] = HashUPID128(absl::Uint128High64(values[i]), absl::Uint128Low64(values[i]));
+  }
+}
+
+/**
+ * Compares count UPIDs against a single needle, writing one bool per input.
+ */
+inline void UPIDsEqual(const UPID* upids, size_t count, const UPID& needle, bool* out) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = upids[i] == needle;
+  }
+}
+
+/**
+ * Same as UPIDsEqual, over raw 128-bit values.
+ */
+inline void UPIDValuesEqual(const absl::uint128* values, size_t count, absl::uint128 needle,
+                            bool* out) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = values[i] == needle;
+  }
+}
+
+}  // namespace md
+}  // namespace px
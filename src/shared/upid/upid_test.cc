@@ -19,9 +19,11 @@
 #include <absl/hash/hash_testing.h>
 #include <gtest/gtest.h>
 #include <set>
+#include <vector>
 
 #include "src/common/testing/testing.h"
 #include "src/shared/upid/upid.h"
+#include "src/shared/upid/upid_kernels.h"
 
 namespace px {
 namespace md {
@@ -85,5 +87,53 @@ TEST(UPID, comparison) {
   EXPECT_THAT(upids, ElementsAre(UPID(0, 1, 2), UPID(0, 1, 3), UPID(0, 2, 3), UPID(1, 2, 3)));
 }
 
+TEST(UPIDKernels, hash_upids_matches_scalar_hash) {
+  std::vector<UPID> upids;
+  for (uint32_t i = 0; i < 100; ++i) {
+    upids.emplace_back(i, i + 1, 3420030816657ULL + i);
+  }
+  std::vector<uint64_t> hashes(upids.size());
+  HashUPIDs(upids.data(), upids.size(), hashes.data());
+  for (size_t i = 0; i < upids.size(); ++i) {
+    EXPECT_EQ(HashUPID(upids[i]), hashes[i]);
+  }
+}
+
+TEST(UPIDKernels, hash_upids_distinguishes_close_keys) {
+  // UPIDs that differ in a single component must not collide; close keys are the common case
+  // (same ASID, adjacent pids/start times).
+  std::set<uint64_t> hashes;
+  hashes.insert(HashUPID(UPID(123, 456, 3420030816657ULL)));
+  hashes.insert(HashUPID(UPID(123, 456, 3420030816658ULL)));
+  hashes.insert(HashUPID(UPID(123, 457, 3420030816657ULL)));
+  hashes.insert(HashUPID(UPID(124, 456, 3420030816657ULL)));
+  EXPECT_EQ(4, hashes.size());
+}
+
+TEST(UPIDKernels, hash_upid_values_matches_upid_overload) {
+  std::vector<UPID> upids = {UPID(1, 2, 3), UPID(123, 456, 3420030816657ULL)};
+  std::vector<absl::uint128> values;
+  for (const auto& upid : upids) {
+    values.push_back(upid.value());
+  }
+  std::vector<uint64_t> upid_hashes(upids.size());
+  std::vector<uint64_t> value_hashes(values.size());
+  HashUPIDs(upids.data(), upids.size(), upid_hashes.data());
+  HashUPIDValues(values.data(), values.size(), value_hashes.data());
+  EXPECT_EQ(upid_hashes, value_hashes);
+}
+
+TEST(UPIDKernels, upids_equal_constant) {
+  UPID needle(123, 456, 3420030816657ULL);
+  std::vector<UPID> upids = {UPID(1, 2, 3), needle, UPID(123, 456, 3000000000000ULL), needle};
+  std::vector<bool> expected = {false, true, false, true};
+
+  std::vector<uint8_t> matches(upids.size());
+  UPIDsEqual(upids.data(), upids.size(), needle, reinterpret_cast<bool*>(matches.data()));
+  for (size_t i = 0; i < upids.size(); ++i) {
+    EXPECT_EQ(expected[i], matches[i] != 0) << "row " << i;
+  }
+}
+
 }  // namespace md
 }  // namespace px
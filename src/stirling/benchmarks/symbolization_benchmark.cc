@@ -123,9 +123,12 @@ static void BM_elf_reader_symbolization_indexed(benchmark::State& state) {
   PX_ASSIGN_OR_EXIT(std::unique_ptr<ElfReader::Symbolizer> symbolizer, elf_reader->GetSymbolizer());
 
   for (auto _ : state) {
+    // Convert the whole stack in one pass, then symbolize frame by frame.
+    std::vector<uintptr_t> binary_addrs = addrs;
+    converter->VirtualAddrsToBinaryAddrs(&binary_addrs);
+
     std::vector<std::string> symbols;
-    for (const auto addr : addrs) {
-      auto binary_addr = converter->VirtualAddrToBinaryAddr(addr);
+    for (const auto binary_addr : binary_addrs) {
       symbols.push_back(std::string(symbolizer->Lookup(binary_addr)));
     }
     benchmark::DoNotOptimize(symbols);
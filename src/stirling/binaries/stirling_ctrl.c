@@ -33,6 +33,14 @@ int main(int argc, char** argv) {
     printf("    Argument: PID\n");
     printf("    Positive PID values enable tracing; negative PID values disable tracing.\n");
     printf("    Note: Can be used multiple times to enable/disable tracing of multiple PIDs.\n");
+    printf("  opcode 3: Override profiler sampling of individual PIDs\n");
+    printf("    Argument: PID\n");
+    printf("    Positive PID values restore full-rate sampling; negative PID values stop\n");
+    printf("    sampling of that PID; 0 clears all per-PID overrides.\n");
+    printf("  opcode 4: Set the profiler's default downsampling divisor\n");
+    printf("    Argument: divisor\n");
+    printf("    Only 1 of every <divisor> stack-trace samples is kept for processes without\n");
+    printf("    a per-PID override. A divisor of 1 restores the default behavior.\n");
     printf("\n");
     printf("Remember to use sudo if required.");
     printf("\n");
@@ -20,9 +20,17 @@
 
 #include <linux/perf_event.h>
 #include <sys/mount.h>
+#include <sys/utsname.h>
 
+#include <absl/container/flat_hash_map.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <optional>
 #include <string>
+#include <thread>
 
 #include <magic_enum.hpp>
 
@@ -33,6 +41,13 @@
 #include "src/stirling/bpf_tools/task_struct_resolver.h"
 #include "src/stirling/utils/linux_headers.h"
 
+DEFINE_string(stirling_task_struct_offsets_cache_path,
+              gflags::StringFromEnv("PX_STIRLING_TASK_STRUCT_OFFSETS_CACHE_PATH", ""),
+              "If set, path of a file in which resolved task_struct offsets are persisted, keyed "
+              "by the kernel release. On restart on the same kernel, the BPF-based offset "
+              "resolution (and its LLVM compile) is skipped. Point this at persistent storage "
+              "(e.g. a hostPath mount) for it to survive restarts.");
+
 namespace px {
 namespace stirling {
 namespace bpf_tools {
@@ -70,6 +85,129 @@ Status MountDebugFS() {
   return Status::OK();
 }
 
+namespace {
+
+// On-disk format of the persistent task_struct offsets cache
+// (--stirling_task_struct_offsets_cache_path). A versioned header, the kernel release string,
+// then the offsets struct. The offsets depend on the exact kernel build, so a release mismatch
+// (or any layout mismatch) invalidates the file, which is then rewritten.
+constexpr char kTaskStructOffsetsCacheMagic[4] = {'P', 'X', 'T', 'S'};
+constexpr uint32_t kTaskStructOffsetsCacheVersion = 1;
+
+struct TaskStructOffsetsCacheHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t offsets_size;
+  uint32_t release_len;
+};
+
+std::string KernelReleaseString() {
+  struct utsname buf;
+  if (uname(&buf) != 0) {
+    return "";
+  }
+  return std::string(buf.release);
+}
+
+std::optional<utils::TaskStructOffsets> LoadTaskStructOffsetsCache() {
+  const std::string& path = FLAGS_stirling_task_struct_offsets_cache_path;
+  if (path.empty()) {
+    return std::nullopt;
+  }
+  const std::string release = KernelReleaseString();
+  if (release.empty()) {
+    return std::nullopt;
+  }
+
+  std::ifstream f(path, std::ios::binary);
+  if (!f) {
+    VLOG(1) << absl::Substitute("No task_struct offsets cache found at $0", path);
+    return std::nullopt;
+  }
+
+  // Kernel releases are short strings; anything oversized indicates a corrupt file.
+  constexpr uint32_t kMaxReleaseLen = 256;
+
+  TaskStructOffsetsCacheHeader header = {};
+  f.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!f ||
+      memcmp(header.magic, kTaskStructOffsetsCacheMagic, sizeof(kTaskStructOffsetsCacheMagic)) !=
+          0 ||
+      header.version != kTaskStructOffsetsCacheVersion ||
+      header.offsets_size != sizeof(utils::TaskStructOffsets) || header.release_len == 0 ||
+      header.release_len > kMaxReleaseLen) {
+    LOG(WARNING) << absl::Substitute(
+        "Ignoring task_struct offsets cache at $0: incompatible version or corrupt file.", path);
+    return std::nullopt;
+  }
+
+  std::string cached_release(header.release_len, '\0');
+  f.read(cached_release.data(), header.release_len);
+
+  utils::TaskStructOffsets offsets = {};
+  f.read(reinterpret_cast<char*>(&offsets), sizeof(offsets));
+  if (!f) {
+    LOG(WARNING) << absl::Substitute("Ignoring corrupt task_struct offsets cache at $0", path);
+    return std::nullopt;
+  }
+
+  if (cached_release != release) {
+    VLOG(1) << absl::Substitute(
+        "Ignoring task_struct offsets cache at $0: kernel release changed ($1 -> $2).", path,
+        cached_release, release);
+    return std::nullopt;
+  }
+
+  return offsets;
+}
+
+void SaveTaskStructOffsetsCache(const utils::TaskStructOffsets& offsets) {
+  const std::string& path = FLAGS_stirling_task_struct_offsets_cache_path;
+  if (path.empty()) {
+    return;
+  }
+  const std::string release = KernelReleaseString();
+  if (release.empty()) {
+    return;
+  }
+
+  // Write to a temporary file and rename into place, so a crash mid-write cannot leave a
+  // truncated cache behind.
+  const std::string tmp_path = absl::StrCat(path, ".tmp");
+  {
+    std::ofstream f(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!f) {
+      LOG(WARNING) << absl::Substitute("Could not write task_struct offsets cache to $0",
+                                       tmp_path);
+      return;
+    }
+
+    TaskStructOffsetsCacheHeader header = {};
+    memcpy(header.magic, kTaskStructOffsetsCacheMagic, sizeof(header.magic));
+    header.version = kTaskStructOffsetsCacheVersion;
+    header.offsets_size = sizeof(utils::TaskStructOffsets);
+    header.release_len = release.size();
+    f.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    f.write(release.data(), release.size());
+    f.write(reinterpret_cast<const char*>(&offsets), sizeof(offsets));
+
+    if (!f) {
+      LOG(WARNING) << absl::Substitute("Could not write task_struct offsets cache to $0",
+                                       tmp_path);
+      return;
+    }
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(tmp_path, path, ec);
+  if (ec) {
+    LOG(WARNING) << absl::Substitute(
+        "Could not move task_struct offsets cache into place at $0: $1", path, ec.message());
+  }
+}
+
+}  // namespace
+
 StatusOr<utils::TaskStructOffsets> ResolveTaskStructOffsetsWithRetry() {
   constexpr int kNumAttempts = 3;
 
@@ -89,11 +227,20 @@ StatusOr<utils::TaskStructOffsets> BCCWrapper::ComputeTaskStructOffsets() {
     return task_struct_offsets_opt_.value();
   }
 
+  std::optional<utils::TaskStructOffsets> cached_offsets = LoadTaskStructOffsetsCache();
+  if (cached_offsets.has_value()) {
+    task_struct_offsets_opt_ = cached_offsets;
+    LOG(INFO) << absl::Substitute("Loaded task_struct offsets from on-disk cache: $0",
+                                  task_struct_offsets_opt_.value().ToString());
+    return task_struct_offsets_opt_.value();
+  }
+
   LOG(INFO) << "Resolving task_struct offsets.";
   PX_ASSIGN_OR_RETURN(task_struct_offsets_opt_, ResolveTaskStructOffsetsWithRetry());
 
   LOG(INFO) << absl::Substitute("Successfully resolved task_struct offsets: $0",
                                 task_struct_offsets_opt_.value().ToString());
+  SaveTaskStructOffsetsCache(task_struct_offsets_opt_.value());
   return task_struct_offsets_opt_.value();
 }
 
@@ -257,7 +404,15 @@ Status BCCWrapperImpl::AttachTracepoints(const ArrayView<TracepointSpec>& probes
 }
 
 Status BCCWrapperImpl::AttachUProbes(const ArrayView<UProbeSpec>& probes) {
+  // Resolve symbols up-front, one ELF pass per target binary, so BCC does not re-parse the
+  // binary for every probe. The attach syscalls themselves must stay serial: ebpf::BPF is not
+  // thread-safe.
+  std::vector<UProbeSpec> specs;
+  specs.reserve(probes.size());
   for (const UProbeSpec& p : probes) {
+    specs.push_back(p);
+  }
+  for (const UProbeSpec& p : BatchResolveUProbeSymbols(std::move(specs))) {
     PX_RETURN_IF_ERROR(AttachUProbe(p));
   }
   return Status::OK();
@@ -346,7 +501,23 @@ void BCCWrapperImpl::DetachTracepoints() {
   tracepoints_.clear();
 }
 
+namespace {
+
+// Adapts libbpf's ring buffer sample callback to the perf_reader_raw_cb carried in
+// PerfBufferSpec, so source connectors use the same callback type on either transport.
+int RingBufferSampleCallback(void* ctx, void* data, size_t data_size) {
+  const auto* spec = static_cast<const PerfBufferSpec*>(ctx);
+  spec->probe_output_fn(spec->cb_cookie, data, static_cast<int>(data_size));
+  return 0;
+}
+
+}  // namespace
+
 Status BCCWrapperImpl::OpenPerfBuffer(const PerfBufferSpec& perf_buffer) {
+  if (perf_buffer.transport == PerfBufferSpec::Transport::kRingBuffer) {
+    return OpenRingBuffer(perf_buffer);
+  }
+
   const int kPageSizeBytes = system::Config::GetInstance().PageSizeBytes();
   int num_pages = IntRoundUpDivide(perf_buffer.size_bytes, kPageSizeBytes);
 
@@ -364,6 +535,22 @@ Status BCCWrapperImpl::OpenPerfBuffer(const PerfBufferSpec& perf_buffer) {
   return Status::OK();
 }
 
+Status BCCWrapperImpl::OpenRingBuffer(const PerfBufferSpec& perf_buffer) {
+  // Unlike perf buffers, ring buffers are a single buffer shared across CPUs, and their size
+  // comes from the BPF_RINGBUF_OUTPUT declaration in the probe code.
+  VLOG(1) << absl::Substitute("Opening ring buffer: [$0] (shared across cpus)",
+                              perf_buffer.ToString());
+  // The callback context must outlive the ring buffer and keep a stable address, so pass a
+  // heap-allocated copy of the spec rather than a pointer into perf_buffers_.
+  auto spec_copy = std::make_unique<PerfBufferSpec>(perf_buffer);
+  PX_RETURN_IF_ERROR(bpf_.open_ring_buf(std::string(perf_buffer.name), &RingBufferSampleCallback,
+                                        spec_copy.get()));
+  ring_buffer_specs_.push_back(std::move(spec_copy));
+  perf_buffers_.push_back(perf_buffer);
+  ++num_open_perf_buffers_;
+  return Status::OK();
+}
+
 Status BCCWrapperImpl::OpenPerfBuffers(const ArrayView<PerfBufferSpec>& perf_buffers) {
   for (const PerfBufferSpec& p : perf_buffers) {
     PX_RETURN_IF_ERROR(OpenPerfBuffer(p));
@@ -373,7 +560,11 @@ Status BCCWrapperImpl::OpenPerfBuffers(const ArrayView<PerfBufferSpec>& perf_buf
 
 Status BCCWrapperImpl::ClosePerfBuffer(const PerfBufferSpec& perf_buffer) {
   VLOG(1) << "Closing perf buffer: " << perf_buffer.name;
-  PX_RETURN_IF_ERROR(bpf_.close_perf_buffer(std::string(perf_buffer.name)));
+  if (perf_buffer.transport == PerfBufferSpec::Transport::kRingBuffer) {
+    bpf_.close_ring_buf(std::string(perf_buffer.name));
+  } else {
+    PX_RETURN_IF_ERROR(bpf_.close_perf_buffer(std::string(perf_buffer.name)));
+  }
   --num_open_perf_buffers_;
   return Status::OK();
 }
@@ -384,6 +575,8 @@ void BCCWrapperImpl::ClosePerfBuffers() {
     LOG_IF(ERROR, !res.ok()) << res.msg();
   }
   perf_buffers_.clear();
+  // Safe to drop the callback contexts now that the ring buffers are closed.
+  ring_buffer_specs_.clear();
 }
 
 Status BCCWrapperImpl::AttachPerfEvent(const PerfEventSpec& perf_event) {
@@ -429,6 +622,12 @@ std::string BCCWrapperImpl::GetKProbeTargetName(const KProbeSpec& probe) {
 }
 
 void BCCWrapperImpl::PollPerfBuffer(std::string_view perf_buffer_name, int timeout_ms) {
+  for (const auto& spec : ring_buffer_specs_) {
+    if (spec->name == perf_buffer_name) {
+      bpf_.poll_ring_buf(std::string(perf_buffer_name), timeout_ms);
+      return;
+    }
+  }
   auto perf_buffer = bpf_.get_perf_buffer(std::string(perf_buffer_name));
   if (perf_buffer != nullptr) {
     perf_buffer->poll(timeout_ms);
@@ -451,6 +650,67 @@ void BCCWrapperImpl::Close() {
 
 std::unique_ptr<BCCWrapper> CreateBCC() { return std::make_unique<BCCWrapperImpl>(); }
 
+namespace {
+
+// Resolves the symbols of the indexed specs against a single ElfReader instance for the binary.
+// Specs that fail to resolve are left untouched.
+void ResolveSymbolsForBinary(const std::string& binary, const std::vector<size_t>& indices,
+                             std::vector<UProbeSpec>* specs) {
+  auto elf_reader_or = obj_tools::ElfReader::Create(binary);
+  if (!elf_reader_or.ok()) {
+    VLOG(1) << absl::Substitute("Could not open ELF binary $0 for batch symbol resolution: $1",
+                                binary, elf_reader_or.ToString());
+    return;
+  }
+  std::unique_ptr<obj_tools::ElfReader> elf_reader = elf_reader_or.ConsumeValueOrDie();
+
+  for (size_t i : indices) {
+    UProbeSpec& spec = (*specs)[i];
+    std::optional<int64_t> addr = elf_reader->SymbolAddress(spec.symbol);
+    if (addr.has_value() && addr.value() != 0) {
+      spec.address = addr.value();
+      spec.symbol.clear();
+    }
+  }
+}
+
+}  // namespace
+
+std::vector<UProbeSpec> BatchResolveUProbeSymbols(std::vector<UProbeSpec> specs) {
+  absl::flat_hash_map<std::string, std::vector<size_t>> specs_by_binary;
+  for (size_t i = 0; i < specs.size(); ++i) {
+    if (!specs[i].symbol.empty() && specs[i].address == 0) {
+      specs_by_binary[specs[i].binary_path.string()].push_back(i);
+    }
+  }
+
+  // A binary with a single probe gains nothing over BCC's own per-attach resolution.
+  auto iter = specs_by_binary.begin();
+  while (iter != specs_by_binary.end()) {
+    if (iter->second.size() < 2) {
+      specs_by_binary.erase(iter++);
+    } else {
+      ++iter;
+    }
+  }
+
+  if (specs_by_binary.size() == 1) {
+    const auto& [binary, indices] = *specs_by_binary.begin();
+    ResolveSymbolsForBinary(binary, indices, &specs);
+  } else {
+    std::vector<std::thread> threads;
+    threads.reserve(specs_by_binary.size());
+    for (const auto& [binary, indices] : specs_by_binary) {
+      threads.emplace_back(ResolveSymbolsForBinary, binary, indices, &specs);
+    }
+    for (std::thread& t : threads) {
+      t.join();
+    }
+  }
+
+  return specs;
+}
+
 std::unique_ptr<WrappedBCCStackTable> WrappedBCCStackTable::Create(bpf_tools::BCCWrapper* bcc,
                                                                    const std::string& name) {
   return std::make_unique<WrappedBCCStackTableImpl>(bcc, name);
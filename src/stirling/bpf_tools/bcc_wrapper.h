@@ -294,6 +294,7 @@ class BCCWrapperImpl : public BCCWrapper {
  private:
   FRIEND_TEST(BCCWrapperTest, DetachUProbe);
 
+  Status OpenRingBuffer(const PerfBufferSpec& perf_buffer);
   Status DetachKProbe(const KProbeSpec& probe);
   Status DetachUProbe(const UProbeSpec& probe);
   Status DetachTracepoint(const TracepointSpec& probe);
@@ -315,6 +316,10 @@ class BCCWrapperImpl : public BCCWrapper {
   std::vector<TracepointSpec> tracepoints_;
   std::vector<PerfEventSpec> perf_events_;
 
+  // Stable-address copies of ring buffer specs, passed as the callback context to libbpf's
+  // ring buffer sample callback. Kept separate from perf_buffers_, whose storage can move.
+  std::vector<std::unique_ptr<PerfBufferSpec>> ring_buffer_specs_;
+
   std::string system_headers_include_dir_;
 
   // Initialize this with one of the below bitmask flags to turn on different debug output.
@@ -332,6 +337,15 @@ class BCCWrapperImpl : public BCCWrapper {
 
 std::unique_ptr<BCCWrapper> CreateBCC();
 
+/**
+ * Resolves symbol-based uprobe specs to address-based ones, reading each distinct target binary
+ * only once (BCC's own resolver re-parses the ELF binary for every attach call). Distinct
+ * binaries are resolved in parallel. Specs whose symbol cannot be resolved are returned
+ * unchanged, so BCC's resolver (which also consults external debug symbols) still gets a chance
+ * at attach time.
+ */
+std::vector<UProbeSpec> BatchResolveUProbeSymbols(std::vector<UProbeSpec> specs);
+
 // Wrapped maps & arrays.
 template <typename T>
 class WrappedBCCArrayTable {
@@ -124,6 +124,58 @@ TEST(BCCWrapperTest, DetachUProbe) {
   }
 }
 
+TEST(BCCWrapperTest, AttachUProbes) {
+  TestExeWrapper test_exe;
+
+  BCCWrapperImpl bcc_wrapper;
+  ASSERT_OK(bcc_wrapper.InitBPFProgram(kBCCProgram));
+
+  // Two symbol-based probes on the same binary trigger the batched symbol resolution path.
+  std::vector<UProbeSpec> specs = {
+      {
+          .binary_path = test_exe.path(),
+          .symbol = "CanYouFindThis",
+          .probe_fn = "foo",
+      },
+      {
+          .binary_path = test_exe.path(),
+          .symbol = "SomeFunctionWithPointerArgs",
+          .probe_fn = "foo",
+      },
+  };
+
+  ASSERT_OK(bcc_wrapper.AttachUProbes(ArrayView<UProbeSpec>(specs.data(), specs.size())));
+  EXPECT_EQ(2, bcc_wrapper.num_attached_probes());
+}
+
+TEST(BCCWrapperTest, BatchResolveUProbeSymbols) {
+  const obj_tools::TestExeFixture kTestExeFixture;
+
+  std::vector<UProbeSpec> specs = {
+      {
+          .binary_path = kTestExeFixture.Path(),
+          .symbol = "CanYouFindThis",
+          .probe_fn = "foo",
+      },
+      {
+          .binary_path = kTestExeFixture.Path(),
+          .symbol = "ThisSymbolDoesNotExist",
+          .probe_fn = "foo",
+      },
+  };
+
+  std::vector<UProbeSpec> resolved = BatchResolveUProbeSymbols(specs);
+  ASSERT_EQ(resolved.size(), 2);
+
+  // The resolvable symbol is converted to an address-based spec.
+  EXPECT_TRUE(resolved[0].symbol.empty());
+  EXPECT_NE(resolved[0].address, 0);
+
+  // The unresolvable one is left untouched, for BCC's own resolver to try at attach time.
+  EXPECT_EQ(resolved[1].symbol, "ThisSymbolDoesNotExist");
+  EXPECT_EQ(resolved[1].address, 0);
+}
+
 TEST(BCCWrapperTest, GetTGIDStartTime) {
   // Force the TaskStructResolver to run,
   // since we're trying to check that it correctly gets the task_struct offsets.
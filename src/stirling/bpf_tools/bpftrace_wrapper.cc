@@ -161,10 +161,16 @@ Status BPFTraceWrapper::Compile(std::string_view script, const std::vector<std::
   int success;
   std::string err_msg;
 
-  // This ensures system headers be installed correctly inside a container.
-  PX_ASSIGN_OR_RETURN(std::filesystem::path sys_headers_dir, utils::FindOrInstallLinuxHeaders());
-  LOG(INFO) << absl::Substitute("Using linux headers found at $0 for BPFtrace runtime.",
-                                sys_headers_dir.string());
+  // When the kernel exposes BTF, bpftrace resolves kernel types from it and the headers are not
+  // needed, so skip the (potentially expensive) headers discovery/installation entirely.
+  if (!bpftrace_.feature_->has_btf()) {
+    // This ensures system headers be installed correctly inside a container.
+    PX_ASSIGN_OR_RETURN(std::filesystem::path sys_headers_dir, utils::FindOrInstallLinuxHeaders());
+    LOG(INFO) << absl::Substitute("Using linux headers found at $0 for BPFtrace runtime.",
+                                  sys_headers_dir.string());
+  } else {
+    VLOG(1) << "Kernel BTF available; skipping linux headers setup for BPFtrace.";
+  }
 
   // Reset some BPFTrace global state, which may be dirty because of a previous compile.
   bpftrace::TracepointFormatParser::clear_struct_list();
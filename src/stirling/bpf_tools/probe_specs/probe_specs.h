@@ -159,8 +159,19 @@ enum class PerfBufferSizeCategory {
  * Describes a BPF perf buffer, through which data is returned to user-space.
  */
 struct PerfBufferSpec {
+  // Transport used to move events to user space.
+  // kPerfBuffer allocates size_bytes per CPU and is polled per CPU.
+  // kRingBuffer (kernel 5.8+) is a single buffer shared across CPUs, sized by the
+  // BPF_RINGBUF_OUTPUT declaration in the probe code, so it avoids the per-CPU over-allocation
+  // and the event loss seen when a single CPU bursts past its per-CPU quota.
+  enum class Transport {
+    kPerfBuffer,
+    kRingBuffer,
+  };
+
   // Name of the perf buffer.
-  // Must be the same as the perf buffer name declared in the probe code with BPF_PERF_OUTPUT.
+  // Must be the same as the buffer name declared in the probe code with BPF_PERF_OUTPUT
+  // (or BPF_RINGBUF_OUTPUT when transport is kRingBuffer).
   std::string name;
 
   // Function that will be called for every event in the perf buffer,
@@ -168,21 +179,26 @@ struct PerfBufferSpec {
   perf_reader_raw_cb probe_output_fn;
 
   // Function that will be called if there are lost/clobbered perf events.
+  // Not used by the ring buffer transport: a ring buffer never clobbers committed events, so
+  // losses surface as failed reservations on the BPF side instead.
   perf_reader_lost_cb probe_loss_fn;
 
   // Used to invoke callback.
   void* cb_cookie;
 
   // Size of perf buffer. Will be rounded up to and allocated in a power of 2 number of pages.
+  // Ignored by the ring buffer transport, which is sized in the probe code.
   int size_bytes = 1024 * 1024;
 
   // We specify a maximum total size per PerfBufferSizeCategory, this specifies which size category
   // to count this buffer's size against.
   PerfBufferSizeCategory size_category = PerfBufferSizeCategory::kUncategorized;
 
+  Transport transport = Transport::kPerfBuffer;
+
   std::string ToString() const {
-    return absl::Substitute("name=$0 size_bytes=$1 size_category=$2", name, size_bytes,
-                            magic_enum::enum_name(size_category));
+    return absl::Substitute("name=$0 size_bytes=$1 size_category=$2 transport=$3", name, size_bytes,
+                            magic_enum::enum_name(size_category), magic_enum::enum_name(transport));
   }
 };
 
@@ -22,8 +22,10 @@
 #include <poll.h>
 #include <sys/wait.h>
 
+#include <cstring>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "src/common/base/base.h"
@@ -403,7 +405,195 @@ StatusOr<uint64_t> ResolveTaskStructExitCodeOffset() {
 
 }  // namespace
 
+namespace {
+
+// Minimal parser for the kernel's BTF type information, covering only what is needed to
+// find member offsets of struct task_struct.
+// Format reference: Documentation/bpf/btf.rst in the kernel tree.
+
+constexpr uint16_t kBTFMagic = 0xeB9F;
+
+struct BTFHeader {
+  uint16_t magic;
+  uint8_t version;
+  uint8_t flags;
+  uint32_t hdr_len;
+  uint32_t type_off;
+  uint32_t type_len;
+  uint32_t str_off;
+  uint32_t str_len;
+};
+
+struct BTFType {
+  uint32_t name_off;
+  // Bits 0-15: vlen, bits 24-28: kind, bit 31: kind_flag.
+  uint32_t info;
+  uint32_t size_or_type;
+};
+
+struct BTFMember {
+  uint32_t name_off;
+  uint32_t type;
+  // Bit offset of the member. If the parent's kind_flag is set, the low 24 bits are the
+  // bit offset and the top byte is the bitfield size.
+  uint32_t offset;
+};
+
+// BTF kinds, per the kernel's BTF format.
+enum BTFKind : uint32_t {
+  kBTFKindInt = 1,
+  kBTFKindPtr = 2,
+  kBTFKindArray = 3,
+  kBTFKindStruct = 4,
+  kBTFKindUnion = 5,
+  kBTFKindEnum = 6,
+  kBTFKindFwd = 7,
+  kBTFKindTypedef = 8,
+  kBTFKindVolatile = 9,
+  kBTFKindConst = 10,
+  kBTFKindRestrict = 11,
+  kBTFKindFunc = 12,
+  kBTFKindFuncProto = 13,
+  kBTFKindVar = 14,
+  kBTFKindDataSec = 15,
+  kBTFKindFloat = 16,
+  kBTFKindDeclTag = 17,
+  kBTFKindTypeTag = 18,
+  kBTFKindEnum64 = 19,
+};
+
+// Returns the size in bytes of the variable-length data that follows a btf_type record.
+StatusOr<size_t> BTFTypeExtraSize(uint32_t kind, uint32_t vlen) {
+  switch (kind) {
+    case kBTFKindInt:
+    case kBTFKindVar:
+    case kBTFKindDeclTag:
+      return 4;
+    case kBTFKindArray:
+      return 12;
+    case kBTFKindStruct:
+    case kBTFKindUnion:
+      return vlen * sizeof(BTFMember);
+    case kBTFKindEnum:
+    case kBTFKindFuncProto:
+      return vlen * 8;
+    case kBTFKindDataSec:
+    case kBTFKindEnum64:
+      return vlen * 12;
+    case kBTFKindPtr:
+    case kBTFKindFwd:
+    case kBTFKindTypedef:
+    case kBTFKindVolatile:
+    case kBTFKindConst:
+    case kBTFKindRestrict:
+    case kBTFKindFunc:
+    case kBTFKindFloat:
+    case kBTFKindTypeTag:
+      return 0;
+    default:
+      // A kind this parser does not know about: the record length is unknowable, so bail.
+      return error::Internal("Unknown BTF kind: $0", kind);
+  }
+}
+
+}  // namespace
+
+StatusOr<TaskStructOffsets> ResolveTaskStructOffsetsFromBTFFile(
+    const std::filesystem::path& btf_path) {
+  PX_ASSIGN_OR_RETURN(std::string btf, ReadFileToString(btf_path.string()));
+
+  if (btf.size() < sizeof(BTFHeader)) {
+    return error::Internal("BTF file too small: $0", btf_path.string());
+  }
+
+  BTFHeader header;
+  std::memcpy(&header, btf.data(), sizeof(header));
+  if (header.magic != kBTFMagic) {
+    return error::Internal("Bad BTF magic in $0", btf_path.string());
+  }
+
+  const size_t types_start = static_cast<size_t>(header.hdr_len) + header.type_off;
+  const size_t types_end = types_start + header.type_len;
+  const size_t strs_start = static_cast<size_t>(header.hdr_len) + header.str_off;
+  const size_t strs_end = strs_start + header.str_len;
+  if (types_end > btf.size() || strs_end > btf.size()) {
+    return error::Internal("Corrupt BTF section offsets in $0", btf_path.string());
+  }
+
+  auto string_at = [&](uint32_t off) -> std::string_view {
+    if (off >= header.str_len) {
+      return {};
+    }
+    const char* s = btf.data() + strs_start + off;
+    return std::string_view(s, strnlen(s, header.str_len - off));
+  };
+
+  size_t pos = types_start;
+  while (pos + sizeof(BTFType) <= types_end) {
+    BTFType t;
+    std::memcpy(&t, btf.data() + pos, sizeof(t));
+    pos += sizeof(BTFType);
+
+    const uint32_t vlen = t.info & 0xffff;
+    const uint32_t kind = (t.info >> 24) & 0x1f;
+    const bool kind_flag = ((t.info >> 31) & 0x1) != 0;
+    PX_ASSIGN_OR_RETURN(const size_t extra_size, BTFTypeExtraSize(kind, vlen));
+    if (pos + extra_size > types_end) {
+      return error::Internal("Corrupt BTF type record in $0", btf_path.string());
+    }
+
+    if (kind == kBTFKindStruct && string_at(t.name_off) == "task_struct") {
+      TaskStructOffsets offsets;
+      for (uint32_t i = 0; i < vlen; ++i) {
+        BTFMember member;
+        std::memcpy(&member, btf.data() + pos + i * sizeof(BTFMember), sizeof(member));
+        const uint32_t bit_offset = kind_flag ? (member.offset & 0x00ffffff) : member.offset;
+        if (bit_offset % 8 != 0) {
+          // Bitfield members: none of the fields we look for is one.
+          continue;
+        }
+        const uint64_t byte_offset = bit_offset / 8;
+        const std::string_view name = string_at(member.name_off);
+        if (name == "start_boottime" || name == "real_start_time") {
+          // The name of this member changed in Linux 5.5.
+          offsets.real_start_time_offset = byte_offset;
+        } else if (name == "group_leader") {
+          offsets.group_leader_offset = byte_offset;
+        } else if (name == "exit_code") {
+          offsets.exit_code_offset = byte_offset;
+        }
+      }
+
+      if (offsets.real_start_time_offset == 0 || offsets.group_leader_offset == 0 ||
+          offsets.exit_code_offset == 0) {
+        return error::Internal("BTF task_struct is missing one of the required members.");
+      }
+      return offsets;
+    }
+
+    pos += extra_size;
+  }
+
+  return error::NotFound("struct task_struct not found in BTF data of $0", btf_path.string());
+}
+
+StatusOr<TaskStructOffsets> ResolveTaskStructOffsetsFromBTF() {
+  return ResolveTaskStructOffsetsFromBTFFile("/sys/kernel/btf/vmlinux");
+}
+
 StatusOr<TaskStructOffsets> ResolveTaskStructOffsets() {
+  // On kernels with BTF, read the offsets straight from the kernel's own type information.
+  // This has no BPF compile, no subprocess, and no trigger that can time out on a busy node.
+  StatusOr<TaskStructOffsets> btf_offsets = ResolveTaskStructOffsetsFromBTF();
+  if (btf_offsets.ok()) {
+    LOG(INFO) << "Resolved task_struct offsets from kernel BTF.";
+    return btf_offsets;
+  }
+  VLOG(1) << absl::Substitute(
+      "BTF-based task_struct offset resolution unavailable, falling back to the BPF probe "
+      "experiment. Reason: $0",
+      btf_offsets.ToString());
+
   PX_ASSIGN_OR_RETURN(TaskStructOffsets res, ResolveTaskStructStartTimeOffsets());
   PX_ASSIGN_OR_RETURN(uint64_t exit_code_offset, ResolveTaskStructExitCodeOffset());
   res.exit_code_offset = exit_code_offset;
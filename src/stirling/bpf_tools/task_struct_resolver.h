@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <filesystem>
 #include <string>
 
 #include "src/common/base/base.h"
@@ -69,6 +70,21 @@ StatusOr<TaskStructOffsets> ResolveTaskStructOffsets();
  */
 StatusOr<TaskStructOffsets> ResolveTaskStructOffsetsCore();
 
+/**
+ * Reads the task_struct member offsets directly from the kernel's BTF type information
+ * (/sys/kernel/btf/vmlinux), on kernels that expose it. This is much cheaper than the
+ * BPF probe experiment above (no BPF compile, no subprocess, no trigger that can time out),
+ * so ResolveTaskStructOffsets() tries it first and only falls back to the experiment.
+ */
+StatusOr<TaskStructOffsets> ResolveTaskStructOffsetsFromBTF();
+
+/**
+ * The core logic for ResolveTaskStructOffsetsFromBTF, parameterized on the BTF file path.
+ * This is exposed for testing purposes only.
+ */
+StatusOr<TaskStructOffsets> ResolveTaskStructOffsetsFromBTFFile(
+    const std::filesystem::path& btf_path);
+
 }  // namespace utils
 }  // namespace stirling
 }  // namespace px
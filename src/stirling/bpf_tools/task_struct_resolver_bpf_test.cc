@@ -18,6 +18,7 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
 #include <future>
 #include <thread>
 
@@ -54,6 +55,21 @@ TEST(ResolveTaskStructOffsets, CoreAsWorkerThread) {
   thread.join();
 }
 
+// On kernels that expose BTF, the BTF-based resolution must agree with the BPF probe
+// experiment, since both describe the same running kernel.
+TEST(ResolveTaskStructOffsets, BTFMatchesExperiment) {
+  if (!std::filesystem::exists("/sys/kernel/btf/vmlinux")) {
+    GTEST_SKIP() << "Kernel does not expose BTF.";
+  }
+
+  ASSERT_OK_AND_ASSIGN(TaskStructOffsets btf_offsets, ResolveTaskStructOffsetsFromBTF());
+  ASSERT_OK_AND_ASSIGN(TaskStructOffsets experiment_offsets, ResolveTaskStructOffsetsCore());
+
+  EXPECT_EQ(btf_offsets.real_start_time_offset, experiment_offsets.real_start_time_offset);
+  EXPECT_EQ(btf_offsets.group_leader_offset, experiment_offsets.group_leader_offset);
+  EXPECT_NE(btf_offsets.exit_code_offset, 0);
+}
+
 // Test ResolveTaskStructOffsets when run as a subprocess.
 TEST(ResolveTaskStructOffsets, AsSubProcess) {
   ASSERT_OK_AND_ASSIGN(TaskStructOffsets offsets, ResolveTaskStructOffsets());
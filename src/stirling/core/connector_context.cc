@@ -99,7 +99,62 @@ SystemWideStandaloneContext::SystemWideStandaloneContext(const std::filesystem::
     : StandaloneContext(ListUPIDs(proc_path, /*asid*/ 0), proc_path) {}
 
 void EverythingLocalContext::RefreshUPIDList() {
-  upids_ = ListUPIDs(::px::system::ProcPath(), GetASID());
+  if (!proc_event_listener_init_done_) {
+    proc_event_listener_init_done_ = true;
+    auto listener_or_s = system::NetlinkProcEventListener::Create();
+    if (listener_or_s.ok()) {
+      proc_event_listener_ = listener_or_s.ConsumeValueOrDie();
+    } else {
+      LOG(WARNING) << absl::Substitute(
+          "Could not subscribe to proc connector events; falling back to scanning /proc on every "
+          "refresh. [error = $0]",
+          listener_or_s.ToString());
+    }
+  }
+
+  if (proc_event_listener_ == nullptr || refreshes_until_full_scan_ <= 0) {
+    upids_ = ListUPIDs(::px::system::ProcPath(), GetASID());
+    refreshes_until_full_scan_ = kRefreshesPerFullScan;
+    return;
+  }
+  --refreshes_until_full_scan_;
+
+  std::vector<system::ProcEvent> events;
+  Status s = proc_event_listener_->PollEvents(&events);
+  if (!s.ok()) {
+    // Events were dropped; resync with a full scan.
+    VLOG(1) << absl::Substitute("Proc connector poll failed; resyncing from /proc. [msg=$0]",
+                                s.msg());
+    upids_ = ListUPIDs(::px::system::ProcPath(), GetASID());
+    refreshes_until_full_scan_ = kRefreshesPerFullScan;
+    return;
+  }
+
+  for (const auto& event : events) {
+    switch (event.type) {
+      case system::ProcEvent::Type::kFork:
+      case system::ProcEvent::Type::kExec: {
+        StatusOr<int64_t> start_time =
+            system::GetPIDStartTimeTicks(system::ProcPidPath(event.pid));
+        if (!start_time.ok()) {
+          // The process is already dead.
+          continue;
+        }
+        upids_.emplace(GetASID(), event.pid, start_time.ValueOrDie());
+        break;
+      }
+      case system::ProcEvent::Type::kExit: {
+        for (auto it = upids_.begin(); it != upids_.end();) {
+          if (it->pid() == event.pid) {
+            upids_.erase(it++);
+          } else {
+            ++it;
+          }
+        }
+        break;
+      }
+    }
+  }
 }
 
 }  // namespace stirling
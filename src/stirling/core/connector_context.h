@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "src/common/base/base.h"
+#include "src/common/system/proc_connector.h"
 #include "src/common/system/proc_pid_path.h"
 #include "src/shared/metadata/metadata_state.h"
 #include "src/shared/types/types.h"
@@ -172,6 +173,18 @@ class EverythingLocalContext : public SystemWideStandaloneContext {
  public:
   bool UPIDIsInContext(const md::UPID& /*upid*/) const override { return true; }
   void RefreshUPIDList() override;
+
+ private:
+  // Number of refreshes between full /proc scans while the proc connector is active. Refreshes
+  // in between apply fork/exec/exit events only, so their cost scales with event count rather
+  // than process count; the periodic full scan is kept as a consistency sweep.
+  static constexpr int kRefreshesPerFullScan = 60;
+
+  // May be null when proc connector events are unavailable (e.g. no CAP_NET_ADMIN), in which
+  // case every refresh falls back to a full /proc scan.
+  std::unique_ptr<system::NetlinkProcEventListener> proc_event_listener_;
+  bool proc_event_listener_init_done_ = false;
+  int refreshes_until_full_scan_ = 0;
 };
 
 }  // namespace stirling
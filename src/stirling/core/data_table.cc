@@ -54,7 +54,14 @@ void DataTable::InitBuffers(types::ColumnWrapperRecordBatch* record_batch_ptr) {
 Tablet* DataTable::GetTablet(types::TabletIDView tablet_id) {
   auto& tablet = tablets_[tablet_id];
   if (tablet.records.empty()) {
-    InitBuffers(&tablet.records);
+    // Prefer a pooled batch, pre-initialized by the previous ConsumeRecords(), so the first
+    // record appended after a consume doesn't pay for allocating and reserving every column.
+    if (!spare_buffers_.empty()) {
+      tablet.records = std::move(spare_buffers_.back());
+      spare_buffers_.pop_back();
+    } else {
+      InitBuffers(&tablet.records);
+    }
   }
   return &tablet;
 }
@@ -65,9 +72,6 @@ std::vector<TaggedRecordBatch> DataTable::ConsumeRecords() {
   uint64_t next_start_time = start_time_;
 
   for (auto& [tablet_id, tablet] : tablets_) {
-    // Sort based on times.
-    std::vector<size_t> sort_indexes = utils::SortedIndexes(tablet.times);
-
     // End time is cutoff time + 1, so call to SplitSortedVector() produces the following
     // classification: which classified according to:
     //   expired < start_time
@@ -75,6 +79,19 @@ std::vector<TaggedRecordBatch> DataTable::ConsumeRecords() {
     uint64_t end_time = cutoff_time_.has_value() ? (cutoff_time_.value() + 1)
                                                  : std::numeric_limits<uint64_t>::max();
 
+    // Fast path: records already arrived in time order and all fall in the pushable window.
+    // This is the common case, since builders append records roughly as events are processed.
+    // Move the columns out wholesale, avoiding the per-record copy of the sort/split path below.
+    if (!tablet.times.empty() && tablet.times.front() >= start_time_ &&
+        tablet.times.back() < end_time && std::is_sorted(tablet.times.begin(), tablet.times.end())) {
+      next_start_time = std::max(next_start_time, tablet.times.back());
+      tablets_out.push_back(TaggedRecordBatch{tablet_id, std::move(tablet.records)});
+      continue;
+    }
+
+    // Sort based on times.
+    std::vector<size_t> sort_indexes = utils::SortedIndexes(tablet.times);
+
     // Split the indexes into three groups:
     // 1) Expired indexes: these are too old to return.
     // 2) Pushable indexes: these are the ones that we return.
@@ -127,6 +144,16 @@ std::vector<TaggedRecordBatch> DataTable::ConsumeRecords() {
 
   start_time_ = next_start_time;
 
+  // Replenish the spare buffer pool to cover the tablets whose columns were just moved out.
+  // This shifts the buffer initialization cost from the append path (next RecordBuilder) to the
+  // consume path, which runs far less frequently.
+  const size_t target_spares = std::min(std::max<size_t>(tablets_out.size(), 1), kMaxSpareBuffers);
+  while (spare_buffers_.size() < target_spares) {
+    types::ColumnWrapperRecordBatch batch;
+    InitBuffers(&batch);
+    spare_buffers_.push_back(std::move(batch));
+  }
+
   return tablets_out;
 }
 
@@ -265,6 +265,11 @@ class DataTable : public NotCopyable {
   // ColumnWrapper specific members
   static constexpr size_t kTargetCapacity = 1024;
 
+  // Maximum number of pre-initialized record batches kept in the spare buffer pool.
+  // Bounds the pool for heavily tabletized tables; additional tablets fall back to
+  // initializing their buffers on first append.
+  static constexpr size_t kMaxSpareBuffers = 4;
+
   // Unique ID set by InfoClassManager.
   const uint64_t id_;
 
@@ -280,6 +285,11 @@ class DataTable : public NotCopyable {
   // Key is tablet id, value is tablet records.
   absl::flat_hash_map<types::TabletID, Tablet> tablets_;
 
+  // Pool of pre-initialized record batches, replenished by ConsumeRecords() and handed out by
+  // GetTablet() when a tablet's columns have been moved out. Appending into a pooled batch avoids
+  // re-allocating and re-reserving every column on the record append path.
+  std::vector<types::ColumnWrapperRecordBatch> spare_buffers_;
+
   uint64_t start_time_ = 0;
 
   // The cutoff time is an optional field that sets up to which time
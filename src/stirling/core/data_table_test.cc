@@ -69,6 +69,40 @@ TEST_F(DataTableTest, ResultIsSorted) {
   }
 }
 
+// Records arrive already in time order, which triggers the wholesale column move in
+// ConsumeRecords() instead of the sort/split path. Results should be identical.
+TEST_F(DataTableTest, AlreadySortedInput) {
+  std::vector<int> time_vals = {0, 10, 20, 30, 40, 50, 60, 70, 80, 90};
+
+  for (size_t i = 0; i < time_vals.size(); ++i) {
+    DataTable::RecordBuilder<&kSchema> r(data_table_.get(), time_vals[i]);
+    r.Append<r.ColIndex("time_")>(time_vals[i]);
+    r.Append<r.ColIndex("x")>(static_cast<int>(i));
+    r.Append<r.ColIndex("s")>(std::string(1, 'a' + i));
+  }
+
+  std::vector<TaggedRecordBatch> record_batches = data_table_->ConsumeRecords();
+
+  ASSERT_EQ(record_batches.size(), 1);
+  types::ColumnWrapperRecordBatch& rb = record_batches[0].records;
+
+  ASSERT_EQ(rb[0]->Size(), 10);
+  for (size_t i = 0; i < time_vals.size(); ++i) {
+    EXPECT_EQ(rb[0]->Get<types::Time64NSValue>(i), 10 * static_cast<int>(i));
+    EXPECT_EQ(rb[1]->Get<types::Int64Value>(i), static_cast<int>(i));
+    EXPECT_EQ(rb[2]->Get<types::StringValue>(i), std::string(1, 'a' + i));
+  }
+
+  // A later record older than the previous batch must still be expired by the slow path.
+  {
+    DataTable::RecordBuilder<&kSchema> r(data_table_.get(), 40);
+    r.Append<r.ColIndex("time_")>(40);
+    r.Append<r.ColIndex("x")>(4);
+    r.Append<r.ColIndex("s")>("e");
+  }
+  EXPECT_EQ(data_table_->ConsumeRecords().size(), 0);
+}
+
 // No time passed to RecordBuilder, so all timestamps should be zero.
 // That means there should never be any expired or carry-over records.
 // Also, nothing should be sorted in any way.
@@ -314,6 +348,52 @@ TEST_F(DataTableTest, Carryover) {
   }
 }
 
+class DataTablePoolTest : public DataTableTest {
+ protected:
+  // Exposes the spare buffer pool size for inspection.
+  class PooledDataTable : public DataTable {
+   public:
+    using DataTable::DataTable;
+    size_t num_spare_buffers() const { return spare_buffers_.size(); }
+  };
+};
+
+// ConsumeRecords() replenishes a pool of pre-initialized column buffers, which the next append
+// takes instead of allocating fresh columns. Verify the pool bookkeeping, and that results are
+// unaffected as buffers are recycled across multiple consume cycles.
+TEST_F(DataTablePoolTest, SpareBufferPoolRecycling) {
+  PooledDataTable table(/*id*/ 0, kSchema);
+
+  // No spares exist before the first consume; the first append initializes buffers directly.
+  EXPECT_EQ(table.num_spare_buffers(), 0);
+
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 5; ++i) {
+      int time_val = 100 * round + 10 * i;
+      DataTable::RecordBuilder<&kSchema> r(&table, time_val);
+      r.Append<r.ColIndex("time_")>(time_val);
+      r.Append<r.ColIndex("x")>(i);
+      r.Append<r.ColIndex("s")>(std::string(1, 'a' + i));
+    }
+
+    std::vector<TaggedRecordBatch> record_batches = table.ConsumeRecords();
+
+    ASSERT_EQ(record_batches.size(), 1);
+    types::ColumnWrapperRecordBatch& rb = record_batches[0].records;
+
+    ASSERT_EQ(rb[0]->Size(), 5);
+    for (int i = 0; i < 5; ++i) {
+      EXPECT_EQ(rb[0]->Get<types::Time64NSValue>(i), 100 * round + 10 * i);
+      EXPECT_EQ(rb[1]->Get<types::Int64Value>(i), i);
+      EXPECT_EQ(rb[2]->Get<types::StringValue>(i), std::string(1, 'a' + i));
+    }
+
+    // One tablet's columns were moved out, so the pool holds one replacement batch.
+    // On later rounds, the first append drains the pool, and the consume refills it.
+    EXPECT_EQ(table.num_spare_buffers(), 1);
+  }
+}
+
 class DataTableStressTest : public ::testing::Test {
  private:
   std::default_random_engine rng_;
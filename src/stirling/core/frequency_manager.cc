@@ -18,6 +18,8 @@
 
 #include "src/stirling/core/frequency_manager.h"
 
+#include <algorithm>
+
 namespace px {
 namespace stirling {
 
@@ -26,5 +28,20 @@ void FrequencyManager::Reset(const time_point now) {
   ++count_;
 }
 
+void FrequencyManager::UpdatePeriod(size_t records_produced) {
+  if (!adaptive_ || base_period_.count() == 0) {
+    return;
+  }
+
+  if (records_produced == 0) {
+    period_ = std::min(period_ * 2, base_period_ * kMaxBackoffFactor);
+  } else if (records_produced >= kBurstRecordsThreshold) {
+    period_ = std::max({period_ / 2, base_period_ / kMaxTightenFactor,
+                        std::chrono::milliseconds{1}});
+  } else {
+    period_ = base_period_;
+  }
+}
+
 }  // namespace stirling
 }  // namespace px
@@ -42,15 +42,49 @@ class FrequencyManager {
    */
   void Reset(const time_point now);
 
-  void set_period(std::chrono::milliseconds period) { period_ = period; }
+  /**
+   * Adjusts the period based on how many records the just-expired cycle produced, for
+   * closed-loop scheduling: idle cycles back off exponentially (up to kMaxBackoffFactor x the
+   * configured period), bursty cycles tighten (down to 1/kMaxTightenFactor x), and moderate
+   * production snaps back to the configured period.
+   * Call before Reset(), so the next cycle uses the adjusted period.
+   * No-op unless set_adaptive(true) has been called.
+   */
+  void UpdatePeriod(size_t records_produced);
+
+  void set_period(std::chrono::milliseconds period) {
+    period_ = period;
+    base_period_ = period;
+  }
+
+  /**
+   * Allows UpdatePeriod() to adjust the period. Only suitable for sources whose sampling is a
+   * pure poll of current state; sources that drain BPF buffers must keep a fixed cadence to
+   * avoid kernel-side drops.
+   */
+  void set_adaptive(bool adaptive) { adaptive_ = adaptive; }
   const auto& period() const { return period_; }
   const auto& next() const { return next_; }
   uint32_t count() const { return count_; }
 
+  // Records per cycle at or above which the period is tightened. Matches the occupancy
+  // threshold that triggers an early push in Stirling's run loop.
+  static constexpr size_t kBurstRecordsThreshold = 1024;
+
+  // Bounds on how far UpdatePeriod() may move the period away from the configured one.
+  static constexpr uint32_t kMaxBackoffFactor = 32;
+  static constexpr uint32_t kMaxTightenFactor = 4;
+
  private:
   // The cycle's period.
   std::chrono::milliseconds period_ = {};
 
+  // The configured period, which UpdatePeriod() uses as the anchor for its adjustments.
+  std::chrono::milliseconds base_period_ = {};
+
+  // Whether UpdatePeriod() is allowed to adjust the period.
+  bool adaptive_ = false;
+
   // When the current cycle should end.
   std::chrono::steady_clock::time_point next_ = {};
 
@@ -49,5 +49,45 @@ TEST(FrequencyManagerTest, SetPeriodEndAndCheck) {
   EXPECT_GE(computed_period, std::chrono::milliseconds{9990});
 }
 
+// Tests that UpdatePeriod() is a no-op unless adaptive mode is enabled.
+TEST(FrequencyManagerTest, UpdatePeriodRequiresAdaptiveMode) {
+  FrequencyManager mgr;
+  mgr.set_period(std::chrono::milliseconds{1000});
+  mgr.UpdatePeriod(/*records_produced*/ 0);
+  EXPECT_EQ(mgr.period(), std::chrono::milliseconds{1000});
+}
+
+// Tests the closed-loop period adjustments: backoff when idle, tighten when bursty,
+// and snap back to the configured period on moderate production.
+TEST(FrequencyManagerTest, AdaptivePeriod) {
+  FrequencyManager mgr;
+  mgr.set_period(std::chrono::milliseconds{1000});
+  mgr.set_adaptive(true);
+
+  // Idle cycles back off exponentially, up to kMaxBackoffFactor x the configured period.
+  mgr.UpdatePeriod(/*records_produced*/ 0);
+  EXPECT_EQ(mgr.period(), std::chrono::milliseconds{2000});
+  for (int i = 0; i < 10; ++i) {
+    mgr.UpdatePeriod(/*records_produced*/ 0);
+  }
+  EXPECT_EQ(mgr.period(), std::chrono::milliseconds{32000});
+
+  // Any production snaps back to the configured period.
+  mgr.UpdatePeriod(/*records_produced*/ 1);
+  EXPECT_EQ(mgr.period(), std::chrono::milliseconds{1000});
+
+  // Bursty cycles tighten the period, down to 1/kMaxTightenFactor x the configured period.
+  mgr.UpdatePeriod(FrequencyManager::kBurstRecordsThreshold);
+  EXPECT_EQ(mgr.period(), std::chrono::milliseconds{500});
+  for (int i = 0; i < 10; ++i) {
+    mgr.UpdatePeriod(FrequencyManager::kBurstRecordsThreshold);
+  }
+  EXPECT_EQ(mgr.period(), std::chrono::milliseconds{250});
+
+  // Moderate production returns to the configured period from a tightened one too.
+  mgr.UpdatePeriod(/*records_produced*/ 1);
+  EXPECT_EQ(mgr.period(), std::chrono::milliseconds{1000});
+}
+
 }  // namespace stirling
 }  // namespace px
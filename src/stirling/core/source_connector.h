@@ -122,11 +122,23 @@ class SourceConnector : public NotCopyable {
   virtual void EnablePIDTrace(int pid) { pids_to_trace_.insert(pid); }
   virtual void DisablePIDTrace(int pid) { pids_to_trace_.erase(pid); }
 
+  // Profiler sampling-policy controls, driven by the user signal handler
+  // (see SignalOpCode in stirling.cc). Only the PerfProfileConnector currently implements these.
+  // A positive pid restores full-rate sampling of that PID, a negative pid stops sampling of
+  // that PID, and zero clears all per-PID overrides.
+  virtual void SetProfilerPIDSampling(int /*pid*/) {}
+  // Sets the default downsampling divisor: 1 of every <divisor> samples is kept for processes
+  // without a per-PID override. A divisor of 1 restores the default behavior.
+  virtual void SetProfilerSampleDivisor(int /*divisor*/) {}
+
   FrequencyManager& sampling_freq_mgr() { return sampling_freq_mgr_; }
   FrequencyManager& push_freq_mgr() { return push_freq_mgr_; }
   const std::vector<DataTable*>& data_tables() const { return data_tables_; }
 
-  void set_data_tables(std::vector<DataTable*> data_tables) {
+  // Virtual so that connectors can react to the set of tables being collected.
+  // A nullptr entry means the table is not subscribed, and the connector may skip the
+  // corresponding collection work entirely.
+  virtual void set_data_tables(std::vector<DataTable*> data_tables) {
     data_tables_ = std::move(data_tables);
   }
 
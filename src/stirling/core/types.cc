@@ -28,9 +28,11 @@ stirlingpb::Element DataElement::ToProto() const {
   element_proto.set_ptype(ptype_);
   element_proto.set_stype(stype_);
   element_proto.set_desc(std::string(desc_));
-  if (decoder_ != nullptr) {
+  if (decoder_.size() != 0) {
     google::protobuf::Map<int64_t, std::string>* decoder = element_proto.mutable_decoder();
-    *decoder = google::protobuf::Map<int64_t, std::string>(decoder_->begin(), decoder_->end());
+    for (const auto& entry : decoder_) {
+      (*decoder)[entry.first] = std::string(entry.second);
+    }
   }
   return element_proto;
 }
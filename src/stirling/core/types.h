@@ -43,12 +43,17 @@ using AgentMetadataType = std::shared_ptr<const px::md::AgentMetadataState>;
  */
 using AgentMetadataCallback = std::function<AgentMetadataType()>;
 
+// An enum decoder is static metadata mapping a column's raw enum values to human-readable names.
+// Decoders are built at compile time (see EnumDefToArray()), so they can be embedded in
+// constexpr DataElement definitions without any runtime construction.
+using EnumDecoderView = ArrayView<std::pair<int64_t, std::string_view>>;
+
 class DataElement {
  public:
   constexpr DataElement() = delete;
   constexpr DataElement(std::string_view name, std::string_view desc, types::DataType type,
                         types::SemanticType stype, types::PatternType ptype,
-                        const std::map<int64_t, std::string_view>* decoder = {})
+                        EnumDecoderView decoder = {})
       : name_(name), desc_(desc), type_(type), stype_(stype), ptype_(ptype), decoder_(decoder) {
     // Note: Ideally, we'd call CheckSchema() here because GCC chokes.
     // This is because we use initializers, in our table definitions (e.g. http_table.h),
@@ -65,7 +70,7 @@ class DataElement {
   constexpr types::PatternType ptype() const { return ptype_; }
   constexpr types::SemanticType stype() const { return stype_; }
   constexpr std::string_view desc() const { return desc_; }
-  constexpr const std::map<int64_t, std::string_view>* decoder() const { return decoder_; }
+  constexpr EnumDecoderView decoder() const { return decoder_; }
   stirlingpb::Element ToProto() const;
 
   constexpr void CheckSchema() const {
@@ -74,7 +79,7 @@ class DataElement {
                         "Element may not have unknown data type.");
     COMPILE_TIME_ASSERT(ptype_ != types::PatternType::UNSPECIFIED,
                         "Element may not have unspecified pattern type.");
-    if (decoder_ != nullptr) {
+    if (decoder_.size() != 0) {
       COMPILE_TIME_ASSERT(type_ == types::DataType::INT64,
                           "Enum decoders are only valid for columns with type INT64");
       COMPILE_TIME_ASSERT(ptype_ == types::PatternType::GENERAL_ENUM,
@@ -88,7 +93,7 @@ class DataElement {
   const types::DataType type_ = types::DataType::DATA_TYPE_UNKNOWN;
   const types::SemanticType stype_ = types::SemanticType::ST_NONE;
   const types::PatternType ptype_ = types::PatternType::UNSPECIFIED;
-  const std::map<int64_t, std::string_view>* decoder_ = nullptr;
+  const EnumDecoderView decoder_ = {};
 };
 
 class DataTableSchema {
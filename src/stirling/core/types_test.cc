@@ -47,11 +47,11 @@ TEST(DataElementTest, data_element_proto_getters_test) {
 
 TEST(DataTableSchemaTest, table_schema_proto_getters_test) {
   enum class BEnum : int64_t { kLow, kMed, kHigh = 99 };
-  const std::map<int64_t, std::string_view> enum_decoder = EnumDefToMap<BEnum>();
+  constexpr auto enum_decoder = EnumDefToArray<BEnum>();
   DataElement elements[] = {
       {"time_", "", DataType::TIME64NS, SemanticType::ST_NONE, PatternType::METRIC_COUNTER},
       {"a", "", DataType::INT64, SemanticType::ST_NONE, PatternType::GENERAL},
-      {"b", "", DataType::INT64, SemanticType::ST_NONE, PatternType::GENERAL_ENUM, &enum_decoder},
+      {"b", "", DataType::INT64, SemanticType::ST_NONE, PatternType::GENERAL_ENUM, enum_decoder},
       {"c", "", DataType::INT64, SemanticType::ST_NONE, PatternType::GENERAL},
       {"d", "", DataType::INT64, SemanticType::ST_NONE, PatternType::GENERAL},
       {"e", "", DataType::FLOAT64, SemanticType::ST_NONE, PatternType::GENERAL},
@@ -65,8 +65,8 @@ TEST(DataTableSchemaTest, table_schema_proto_getters_test) {
   EXPECT_EQ(false, table_schema.tabletized());
   EXPECT_EQ(6, table_schema.elements().size());
   EXPECT_EQ("c", table_schema.elements()[3].name());
-  EXPECT_EQ(nullptr, table_schema.elements()[1].decoder());
-  EXPECT_NE(nullptr, table_schema.elements()[2].decoder());
+  EXPECT_EQ(0, table_schema.elements()[1].decoder().size());
+  EXPECT_EQ(3, table_schema.elements()[2].decoder().size());
 
   stirlingpb::TableSchema table_schema_pb;
   table_schema_pb = table_schema.ToProto();
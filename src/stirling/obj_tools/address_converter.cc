@@ -39,6 +39,12 @@ uint64_t ElfAddressConverter::BinaryAddrToVirtualAddr(uint64_t binary_addr) cons
   return binary_addr - virtual_to_binary_addr_offset_;
 }
 
+void ElfAddressConverter::VirtualAddrsToBinaryAddrs(std::vector<uintptr_t>* virtual_addrs) const {
+  for (uintptr_t& addr : *virtual_addrs) {
+    addr += virtual_to_binary_addr_offset_;
+  }
+}
+
 StatusOr<uint32_t> GetProcMapsIndexForBinary(const std::string& binary_path,
                                              const std::vector<ProcSMaps>& map_entries) {
   for (const auto& [idx, entry] : Enumerate(map_entries)) {
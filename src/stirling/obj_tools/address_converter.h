@@ -19,6 +19,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "src/common/base/base.h"
 #include "src/stirling/obj_tools/elf_reader.h"
@@ -33,6 +34,11 @@ class ElfAddressConverter {
   uint64_t VirtualAddrToBinaryAddr(uint64_t virtual_addr) const;
   uint64_t BinaryAddrToVirtualAddr(uint64_t binary_addr) const;
 
+  // Converts all frame addresses of a stack trace in place, in a single pass.
+  // The process's memory map is resolved once at Create() time, so batch conversion costs one
+  // sweep over the frames with no per-frame resolution work.
+  void VirtualAddrsToBinaryAddrs(std::vector<uintptr_t>* virtual_addrs) const;
+
  private:
   explicit ElfAddressConverter(int64_t offset) : virtual_to_binary_addr_offset_(offset) {}
   int64_t virtual_to_binary_addr_offset_;
@@ -18,6 +18,8 @@
 
 #include "src/stirling/obj_tools/address_converter.h"
 
+#include <unistd.h>
+
 #include "src/stirling/obj_tools/testdata/containers/vaddr_convert_self_func_container.h"
 #include "src/stirling/testing/common.h"
 
@@ -38,6 +40,24 @@ TEST(ElfAddressConverterTest, VirtualAddrToBinaryAddr) {
   EXPECT_EQ(0, status);
 }
 
+TEST(ElfAddressConverterTest, BatchConversionMatchesScalarConversion) {
+  const int64_t self_pid = getpid();
+  const std::string self_path = absl::Substitute("/proc/$0/exe", self_pid);
+  ASSERT_OK_AND_ASSIGN(std::unique_ptr<ElfReader> elf_reader, ElfReader::Create(self_path));
+  ASSERT_OK_AND_ASSIGN(std::unique_ptr<ElfAddressConverter> converter,
+                       ElfAddressConverter::Create(elf_reader.get(), self_pid));
+
+  std::vector<uintptr_t> addrs = {0x1000, 0xdeadbeef, 0x7f0000001000ULL};
+
+  std::vector<uintptr_t> expected;
+  for (const uintptr_t addr : addrs) {
+    expected.push_back(converter->VirtualAddrToBinaryAddr(addr));
+  }
+
+  converter->VirtualAddrsToBinaryAddrs(&addrs);
+  EXPECT_EQ(addrs, expected);
+}
+
 TEST(ElfAddressConverterTest, VirtualAddrToBinaryAddrForReorderedVirtualMemoryMappings) {
   // Setting an unlimited stack size ulimit causes the VMAs of a process to be reordered and
   // caused a previous crash (as described in https://github.com/pixie-io/pixie/issues/1630).
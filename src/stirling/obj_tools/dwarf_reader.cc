@@ -29,9 +29,12 @@
 #include <llvm/DebugInfo/DIContext.h>
 #include <llvm/Object/ObjectFile.h>
 
+#include <absl/synchronization/mutex.h>
+
 #include "src/shared/types/typespb/wrapper/types_pb_wrapper.h"
 #include "src/stirling/obj_tools/abi_model.h"
 #include "src/stirling/obj_tools/dwarf_utils.h"
+#include "src/stirling/obj_tools/elf_reader.h"
 #include "src/stirling/obj_tools/init.h"
 
 namespace px {
@@ -42,6 +45,59 @@ using llvm::DWARFContext;
 using llvm::DWARFDie;
 using llvm::DWARFFormValue;
 
+// Caches the results of the expensive DwarfReader queries. One instance is shared by all
+// DwarfReaders for binaries with the same build-id: the results depend only on the binary's
+// debug information, so replicas of the same image, and repeated tracepoint deployments against
+// the same binary, reuse each other's DIE walks. Only successful results are cached.
+struct DwarfQueryCache {
+  absl::Mutex mu;
+  absl::flat_hash_map<std::string, std::map<std::string, ArgInfo>> function_arg_info
+      ABSL_GUARDED_BY(mu);
+  absl::flat_hash_map<std::string, StructMemberInfo> struct_member_info ABSL_GUARDED_BY(mu);
+};
+
+namespace {
+
+// Cap on build-id-keyed query caches. When reached, caches no longer referenced by any live
+// DwarfReader are pruned.
+constexpr size_t kMaxDwarfQueryCaches = 64;
+
+std::shared_ptr<DwarfQueryCache> QueryCacheForBinary(const std::filesystem::path& path) {
+  static absl::Mutex mu;
+  static auto* caches ABSL_GUARDED_BY(mu) =
+      new absl::flat_hash_map<std::string, std::shared_ptr<DwarfQueryCache>>();
+
+  auto elf_reader_or = ElfReader::Create(path.string());
+  if (!elf_reader_or.ok()) {
+    return nullptr;
+  }
+  auto build_id_or = elf_reader_or.ValueOrDie()->BuildID();
+  if (!build_id_or.ok()) {
+    // Binaries without a build-id get no shared cache.
+    return nullptr;
+  }
+
+  absl::MutexLock lock(&mu);
+  if (caches->size() >= kMaxDwarfQueryCaches) {
+    auto iter = caches->begin();
+    while (iter != caches->end()) {
+      // A use count of 1 means only the registry itself still references the cache.
+      if (iter->second.use_count() == 1) {
+        caches->erase(iter++);
+      } else {
+        ++iter;
+      }
+    }
+  }
+  auto& cache = (*caches)[build_id_or.ConsumeValueOrDie()];
+  if (cache == nullptr) {
+    cache = std::make_shared<DwarfQueryCache>();
+  }
+  return cache;
+}
+
+}  // namespace
+
 namespace {
 
 std::vector<DWARFDie> GetParamDIEs(const DWARFDie& function_die) {
@@ -94,9 +150,13 @@ StatusOr<std::unique_ptr<DwarfReader>> DwarfReader::CreateWithoutIndexing(
 
   PX_RETURN_IF_ERROR(dwarf_reader->DetectSourceLanguage());
 
+  dwarf_reader->query_cache_ = QueryCacheForBinary(path);
+
   return dwarf_reader;
 }
 
+DwarfReader::~DwarfReader() = default;
+
 StatusOr<std::unique_ptr<DwarfReader>> DwarfReader::CreateIndexingAll(
     const std::filesystem::path& path) {
   PX_ASSIGN_OR_RETURN(auto dwarf_reader, CreateWithoutIndexing(path));
@@ -266,6 +326,12 @@ void DwarfReader::IndexDIEs(
 
 StatusOr<std::vector<DWARFDie>> DwarfReader::GetMatchingDIEs(
     std::string_view name, std::optional<llvm::dwarf::Tag> type_opt) {
+  absl::MutexLock lock(&mu_);
+  return GetMatchingDIEsLocked(name, type_opt);
+}
+
+StatusOr<std::vector<DWARFDie>> DwarfReader::GetMatchingDIEsLocked(
+    std::string_view name, std::optional<llvm::dwarf::Tag> type_opt) {
   DCHECK(dwarf_context_ != nullptr);
 
   // Special case for types that are indexed.
@@ -294,7 +360,13 @@ StatusOr<std::vector<DWARFDie>> DwarfReader::GetMatchingDIEs(
 
 StatusOr<DWARFDie> DwarfReader::GetMatchingDIE(std::string_view name,
                                                std::optional<llvm::dwarf::Tag> type) {
-  PX_ASSIGN_OR_RETURN(std::vector<DWARFDie> dies, GetMatchingDIEs(name, type));
+  absl::MutexLock lock(&mu_);
+  return GetMatchingDIELocked(name, type);
+}
+
+StatusOr<DWARFDie> DwarfReader::GetMatchingDIELocked(std::string_view name,
+                                                     std::optional<llvm::dwarf::Tag> type) {
+  PX_ASSIGN_OR_RETURN(std::vector<DWARFDie> dies, GetMatchingDIEsLocked(name, type));
   if (dies.empty()) {
     return error::Internal("Could not locate symbol name=$0", name);
   }
@@ -637,8 +709,9 @@ bool IsDeclaration(const llvm::DWARFDie& die) {
 }  // namespace
 
 StatusOr<uint64_t> DwarfReader::GetStructByteSize(std::string_view struct_name) {
+  absl::MutexLock lock(&mu_);
   PX_ASSIGN_OR_RETURN(const DWARFDie& struct_die,
-                      GetMatchingDIE(struct_name, llvm::dwarf::DW_TAG_structure_type));
+                      GetMatchingDIELocked(struct_name, llvm::dwarf::DW_TAG_structure_type));
 
   return GetTypeByteSize(struct_die);
 }
@@ -647,9 +720,21 @@ StatusOr<StructMemberInfo> DwarfReader::GetStructMemberInfo(std::string_view str
                                                             llvm::dwarf::Tag tag,
                                                             std::string_view member_name,
                                                             llvm::dwarf::Tag member_tag) {
+  const std::string cache_key = absl::StrCat(struct_name, "#", magic_enum::enum_name(tag), "#",
+                                             member_name, "#", magic_enum::enum_name(member_tag));
+  if (query_cache_ != nullptr) {
+    absl::MutexLock lock(&query_cache_->mu);
+    auto iter = query_cache_->struct_member_info.find(cache_key);
+    if (iter != query_cache_->struct_member_info.end()) {
+      return iter->second;
+    }
+  }
+
+  absl::MutexLock lock(&mu_);
+
   StructMemberInfo member_info;
 
-  PX_ASSIGN_OR_RETURN(std::vector<DWARFDie> dies, GetMatchingDIEs(struct_name, {tag}));
+  PX_ASSIGN_OR_RETURN(std::vector<DWARFDie> dies, GetMatchingDIEsLocked(struct_name, {tag}));
 
   const DWARFDie* struct_def_die = nullptr;
 
@@ -676,6 +761,10 @@ StatusOr<StructMemberInfo> DwarfReader::GetStructMemberInfo(std::string_view str
     PX_ASSIGN_OR_RETURN(member_info.offset, GetMemberOffset(die));
     PX_ASSIGN_OR_RETURN(DWARFDie type_die, GetTypeDie(die));
     PX_ASSIGN_OR_RETURN(member_info.type_info, GetTypeInfo(die, type_die));
+    if (query_cache_ != nullptr) {
+      absl::MutexLock lock(&query_cache_->mu);
+      query_cache_->struct_member_info[cache_key] = member_info;
+    }
     return member_info;
   }
 
@@ -683,10 +772,12 @@ StatusOr<StructMemberInfo> DwarfReader::GetStructMemberInfo(std::string_view str
 }
 
 StatusOr<std::vector<StructSpecEntry>> DwarfReader::GetStructSpec(std::string_view struct_name) {
+  absl::MutexLock lock(&mu_);
+
   StructMemberInfo member_info;
 
   PX_ASSIGN_OR_RETURN(const DWARFDie& struct_die,
-                      GetMatchingDIE(struct_name, llvm::dwarf::DW_TAG_structure_type));
+                      GetMatchingDIELocked(struct_name, llvm::dwarf::DW_TAG_structure_type));
 
   std::vector<StructSpecEntry> output;
   // Start at the beginning (no prefix and offset 0).
@@ -758,16 +849,18 @@ std::optional<llvm::DWARFDie> DwarfReader::FindInDIEMap(const std::string& name,
 }
 
 StatusOr<TypeInfo> DwarfReader::DereferencePointerType(std::string type_name) {
+  absl::MutexLock lock(&mu_);
   PX_ASSIGN_OR_RETURN(const DWARFDie& die,
-                      GetMatchingDIE(type_name, llvm::dwarf::DW_TAG_pointer_type));
+                      GetMatchingDIELocked(type_name, llvm::dwarf::DW_TAG_pointer_type));
   PX_ASSIGN_OR_RETURN(const DWARFDie type_die, GetTypeDie(die));
   return GetTypeInfo(die, type_die);
 }
 
 StatusOr<uint64_t> DwarfReader::GetArgumentTypeByteSize(std::string_view function_symbol_name,
                                                         std::string_view arg_name) {
+  absl::MutexLock lock(&mu_);
   PX_ASSIGN_OR_RETURN(const DWARFDie& function_die,
-                      GetMatchingDIE(function_symbol_name, llvm::dwarf::DW_TAG_subprogram));
+                      GetMatchingDIELocked(function_symbol_name, llvm::dwarf::DW_TAG_subprogram));
 
   for (const auto& die : GetParamDIEs(function_die)) {
     if (GetShortName(die) == arg_name) {
@@ -876,8 +969,9 @@ StatusOr<VarLocation> GetDieLocationAttr(const DWARFDie& die) {
 
 StatusOr<VarLocation> DwarfReader::GetArgumentLocation(std::string_view function_symbol_name,
                                                        std::string_view arg_name) {
+  absl::MutexLock lock(&mu_);
   PX_ASSIGN_OR_RETURN(const DWARFDie& function_die,
-                      GetMatchingDIE(function_symbol_name, llvm::dwarf::DW_TAG_subprogram));
+                      GetMatchingDIELocked(function_symbol_name, llvm::dwarf::DW_TAG_subprogram));
 
   for (const auto& die : GetParamDIEs(function_die)) {
     if (die.getShortName() == arg_name) {
@@ -917,6 +1011,16 @@ ABI LanguageToABI(llvm::dwarf::SourceLanguage lang, const std::string& compiler)
 
 StatusOr<std::map<std::string, ArgInfo>> DwarfReader::GetFunctionArgInfo(
     std::string_view function_symbol_name) {
+  if (query_cache_ != nullptr) {
+    absl::MutexLock lock(&query_cache_->mu);
+    auto iter = query_cache_->function_arg_info.find(function_symbol_name);
+    if (iter != query_cache_->function_arg_info.end()) {
+      return iter->second;
+    }
+  }
+
+  absl::MutexLock lock(&mu_);
+
   std::map<std::string, ArgInfo> arg_info;
 
   // Ideally, we'd use DW_AT_location directly from DWARF, (via GetDieLocationAttr(die),
@@ -931,7 +1035,7 @@ StatusOr<std::map<std::string, ArgInfo>> DwarfReader::GetFunctionArgInfo(
   std::unique_ptr<ABICallingConventionModel> arg_tracker = ABICallingConventionModel::Create(abi);
 
   PX_ASSIGN_OR_RETURN(const DWARFDie& function_die,
-                      GetMatchingDIE(function_symbol_name, llvm::dwarf::DW_TAG_subprogram));
+                      GetMatchingDIELocked(function_symbol_name, llvm::dwarf::DW_TAG_subprogram));
 
   // If function has a return value, process that first.
   // This is important, because in some ABIs (e.g. SystemV ABI),
@@ -981,12 +1085,18 @@ StatusOr<std::map<std::string, ArgInfo>> DwarfReader::GetFunctionArgInfo(
         arg_tracker->PopLocation(type_class, type_size, alignment_size, num_vars, arg.retarg));
   }
 
+  if (query_cache_ != nullptr) {
+    absl::MutexLock lock(&query_cache_->mu);
+    query_cache_->function_arg_info.emplace(function_symbol_name, arg_info);
+  }
+
   return arg_info;
 }
 
 StatusOr<RetValInfo> DwarfReader::GetFunctionRetValInfo(std::string_view function_symbol_name) {
+  absl::MutexLock lock(&mu_);
   PX_ASSIGN_OR_RETURN(const DWARFDie& function_die,
-                      GetMatchingDIE(function_symbol_name, llvm::dwarf::DW_TAG_subprogram));
+                      GetMatchingDIELocked(function_symbol_name, llvm::dwarf::DW_TAG_subprogram));
 
   if (!function_die.find(llvm::dwarf::DW_AT_type).hasValue()) {
     // No return type means the function has a void return type.
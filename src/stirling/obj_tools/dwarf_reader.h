@@ -22,6 +22,7 @@
 #include <llvm/Support/TargetSelect.h>
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/synchronization/mutex.h>
 
 #include <filesystem>
 #include <limits>
@@ -141,12 +142,24 @@ inline bool operator==(const StructSpecEntry& a, const StructSpecEntry& b) {
   return a.offset == b.offset && a.size == b.size && a.type_info == b.type_info && a.path == b.path;
 }
 
+// Process-wide cache of DWARF query results, keyed by binary build-id. Defined in the .cc file.
+struct DwarfQueryCache;
+
 /**
  * Accepts an executable and reads DWARF information from it.
  * APIs are provided for accessing the needed data.
+ *
+ * Results of the expensive queries (e.g. GetFunctionArgInfo, GetStructMemberInfo) are cached
+ * process-wide, keyed by the binary's GNU build-id, so repeated queries against the same binary
+ * (including via a new DwarfReader instance) become hash lookups.
+ *
+ * Queries are internally serialized, so a single instance may be shared across threads (see
+ * ReaderRegistry): the underlying llvm::DWARFContext parses debug info lazily on access, so
+ * concurrent queries would otherwise race. Query-cache hits are served before taking the lock.
  */
 class DwarfReader {
  public:
+  ~DwarfReader();
   /**
    * Creates a DwarfReader that provides access to DWARF Debugging information entries (DIEs).
    * @param obj_filename The object file from which to read DWARF information.
@@ -289,7 +302,10 @@ class DwarfReader {
    */
   StatusOr<RetValInfo> GetFunctionRetValInfo(std::string_view function_symbol_name);
 
-  bool IsValid() const { return dwarf_context_->getNumCompileUnits() != 0; }
+  bool IsValid() const {
+    absl::MutexLock lock(&mu_);
+    return dwarf_context_->getNumCompileUnits() != 0;
+  }
 
   const llvm::dwarf::SourceLanguage& source_language() const { return source_language_; }
   const std::string& compiler() const { return compiler_; }
@@ -312,7 +328,17 @@ class DwarfReader {
   // to capture information of all base type members of the struct in a flattened form.
   // See GetStructSpec() for the public interface, and the output format.
   Status FlattenedStructSpec(const llvm::DWARFDie& struct_die, std::vector<StructSpecEntry>* output,
-                             const std::string& path_prefix, int offset);
+                             const std::string& path_prefix, int offset)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Lock-free bodies of GetMatchingDIEs/GetMatchingDIE, for use by the query methods that already
+  // hold mu_.
+  StatusOr<std::vector<llvm::DWARFDie>> GetMatchingDIEsLocked(std::string_view name,
+                                                              std::optional<llvm::dwarf::Tag> type)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  StatusOr<llvm::DWARFDie> GetMatchingDIELocked(std::string_view name,
+                                                std::optional<llvm::dwarf::Tag> type)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   void InsertToDIEMap(std::string name, llvm::dwarf::Tag tag, llvm::DWARFDie die);
   std::optional<llvm::DWARFDie> FindInDIEMap(const std::string& name, llvm::dwarf::Tag tag) const;
@@ -323,11 +349,20 @@ class DwarfReader {
   // Records the name of the compiler that produces this file.
   std::string compiler_;
 
+  // Serializes queries against dwarf_context_, which parses debug info lazily and so is mutated
+  // by reads. The Create() path (DetectSourceLanguage, IndexDIEs) runs before the reader is
+  // shared and does not take the lock.
+  mutable absl::Mutex mu_;
+
   std::unique_ptr<llvm::MemoryBuffer> memory_buffer_;
   std::unique_ptr<llvm::DWARFContext> dwarf_context_;
 
   // Nested map: [tag][symbol_name] -> DWARFDie
   absl::flat_hash_map<llvm::dwarf::Tag, absl::flat_hash_map<std::string, llvm::DWARFDie>> die_map_;
+
+  // Query results cache shared with all DwarfReaders for binaries with the same build-id.
+  // nullptr if the binary has no build-id.
+  std::shared_ptr<DwarfQueryCache> query_cache_;
 };
 
 }  // namespace obj_tools
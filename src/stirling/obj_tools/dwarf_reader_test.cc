@@ -365,6 +365,18 @@ TEST_P(CppDwarfReaderTest, FunctionArgInfo) {
                             {LocationType::kRegister, 8, {RegisterName::kRSI}}})));
 }
 
+TEST_P(CppDwarfReaderTest, FunctionArgInfoSharedAcrossReaders) {
+  // Query results are cached process-wide by build-id, so a second reader on the same binary
+  // (e.g. a re-deployed tracepoint) must return identical results, whether served from the
+  // shared cache or recomputed (for binaries without a build-id).
+  ASSERT_OK_AND_ASSIGN(std::map<std::string, ArgInfo> first,
+                       dwarf_reader->GetFunctionArgInfo("CanYouFindThis"));
+
+  DwarfReaderTestParam p = GetParam();
+  ASSERT_OK_AND_ASSIGN(auto second_reader, CreateDwarfReader(p.binary_path, p.index));
+  EXPECT_OK_AND_EQ(second_reader->GetFunctionArgInfo("CanYouFindThis"), first);
+}
+
 TEST_P(CppDwarfReaderTest, FunctionRetValInfo) {
   EXPECT_OK_AND_EQ(dwarf_reader->GetFunctionRetValInfo("CanYouFindThis"),
                    (RetValInfo{TypeInfo{VarType::kBaseType, "int"}, 4}));
@@ -24,6 +24,7 @@
 #include <llvm/Support/TargetSelect.h>
 
 #include <absl/container/flat_hash_set.h>
+#include <absl/synchronization/mutex.h>
 #include <set>
 #include <utility>
 
@@ -46,11 +47,44 @@ struct LowercaseHex {
 };
 }  // namespace
 
+StatusOr<std::string> ElfReader::BuildID() {
+  absl::MutexLock lock(&mu_);
+  ELFIO::Elf_Half sec_num = elf_reader_.sections.size();
+  for (int i = 0; i < sec_num; ++i) {
+    ELFIO::section* psec = elf_reader_.sections[i];
+    if (psec->get_name() != ".note.gnu.build-id") {
+      continue;
+    }
+
+    // Structure of this section:
+    //    namesz :   32-bit, size of "name" field
+    //    descsz :   32-bit, size of "desc" field
+    //    type   :   32-bit, vendor specific "type"
+    //    name   :   "namesz" bytes, null-terminated string
+    //    desc   :   "descsz" bytes, binary data
+    int32_t name_size =
+        utils::LEndianBytesToInt<int32_t>(std::string_view(psec->get_data(), sizeof(int32_t)));
+    int32_t desc_size = utils::LEndianBytesToInt<int32_t>(
+        std::string_view(psec->get_data() + sizeof(int32_t), sizeof(int32_t)));
+
+    int32_t desc_pos = 3 * sizeof(int32_t) + name_size;
+    std::string_view desc = std::string_view(psec->get_data() + desc_pos, desc_size);
+
+    return BytesToString<LowercaseHex>(desc);
+  }
+
+  return error::NotFound("Binary $0 does not have a .note.gnu.build-id section", binary_path_);
+}
+
 Status ElfReader::LocateDebugSymbols(const std::filesystem::path& debug_file_dir) {
-  std::string build_id;
   std::string debug_link;
   bool found_symtab = false;
 
+  std::string build_id = BuildID().ConsumeValueOr("");
+  if (!build_id.empty()) {
+    VLOG(1) << absl::Substitute("Found build-id: $0", build_id);
+  }
+
   // Scan all sections to find the symbol table (SHT_SYMTAB), or links to debug symbols.
   ELFIO::Elf_Half sec_num = elf_reader_.sections.size();
   for (int i = 0; i < sec_num; ++i) {
@@ -59,32 +93,8 @@ Status ElfReader::LocateDebugSymbols(const std::filesystem::path& debug_file_dir
       found_symtab = true;
     }
 
-    // There are two ways to specify a debug link:
-    //  1) build-id
-    //  2) debuglink
+    // In addition to the build-id above, a debug link may be specified via .gnu_debuglink.
     // For more details: https://sourceware.org/gdb/onlinedocs/gdb/Separate-Debug-Files.html
-
-    // Method 1: build-id.
-    if (psec->get_name() == ".note.gnu.build-id") {
-      // Structure of this section:
-      //    namesz :   32-bit, size of "name" field
-      //    descsz :   32-bit, size of "desc" field
-      //    type   :   32-bit, vendor specific "type"
-      //    name   :   "namesz" bytes, null-terminated string
-      //    desc   :   "descsz" bytes, binary data
-      int32_t name_size =
-          utils::LEndianBytesToInt<int32_t>(std::string_view(psec->get_data(), sizeof(int32_t)));
-      int32_t desc_size = utils::LEndianBytesToInt<int32_t>(
-          std::string_view(psec->get_data() + sizeof(int32_t), sizeof(int32_t)));
-
-      int32_t desc_pos = 3 * sizeof(int32_t) + name_size;
-      std::string_view desc = std::string_view(psec->get_data() + desc_pos, desc_size);
-
-      build_id = BytesToString<LowercaseHex>(desc);
-      VLOG(1) << absl::Substitute("Found build-id: $0", build_id);
-    }
-
-    // Method 2: .gnu_debuglink.
     if (psec->get_name() == ".gnu_debuglink") {
       constexpr int kCRCBytes = 4;
       debug_link = std::string(psec->get_data(), psec->get_size() - kCRCBytes);
@@ -218,7 +228,8 @@ StatusOr<ELFIO::section*> ElfReader::SymtabSection() {
 // This function should be able to handle any section, but for the time being its is limited
 // in scope.
 StatusOr<int32_t> ElfReader::FindSegmentOffsetOfSection(std::string_view section_name) {
-  PX_ASSIGN_OR_RETURN(ELFIO::section * text_section, SectionWithName(section_name));
+  absl::MutexLock lock(&mu_);
+  PX_ASSIGN_OR_RETURN(ELFIO::section * text_section, SectionWithNameLocked(section_name));
   auto section_offset = text_section->get_offset();
 
   for (int i = 0; i < elf_reader_.segments.size() - 1; ++i) {
@@ -248,6 +259,13 @@ static auto NoTextStartAddrError =
 StatusOr<std::vector<ElfReader::SymbolInfo>> ElfReader::SearchSymbols(
     std::string_view search_symbol, SymbolMatchType match_type, std::optional<int> symbol_type,
     bool stop_at_first_match) {
+  absl::MutexLock lock(&mu_);
+  return SearchSymbolsLocked(search_symbol, match_type, symbol_type, stop_at_first_match);
+}
+
+StatusOr<std::vector<ElfReader::SymbolInfo>> ElfReader::SearchSymbolsLocked(
+    std::string_view search_symbol, SymbolMatchType match_type, std::optional<int> symbol_type,
+    bool stop_at_first_match) {
   PX_ASSIGN_OR_RETURN(ELFIO::section * symtab_section, SymtabSection());
 
   std::vector<SymbolInfo> symbol_infos;
@@ -283,8 +301,11 @@ StatusOr<std::vector<ElfReader::SymbolInfo>> ElfReader::SearchSymbols(
 
 StatusOr<std::vector<ElfReader::SymbolInfo>> ElfReader::ListFuncSymbols(
     std::string_view search_symbol, SymbolMatchType match_type) {
+  absl::MutexLock lock(&mu_);
   PX_ASSIGN_OR_RETURN(std::vector<ElfReader::SymbolInfo> symbol_infos,
-                      SearchSymbols(search_symbol, match_type, /*symbol_type*/ ELFIO::STT_FUNC));
+                      SearchSymbolsLocked(search_symbol, match_type,
+                                          /*symbol_type*/ ELFIO::STT_FUNC,
+                                          /*stop_at_first_match*/ false));
 
   absl::flat_hash_set<uint64_t> symbol_addrs;
   for (auto& symbol_info : symbol_infos) {
@@ -303,9 +324,11 @@ StatusOr<std::vector<ElfReader::SymbolInfo>> ElfReader::ListFuncSymbols(
 }
 
 StatusOr<ElfReader::SymbolInfo> ElfReader::SearchTheOnlySymbol(std::string_view symbol) {
-  PX_ASSIGN_OR_RETURN(std::vector<ElfReader::SymbolInfo> symbol_infos,
-                      SearchSymbols(symbol, SymbolMatchType::kExact, /*symbol_type*/ std::nullopt,
-                                    /*stop_at_first_match*/ true));
+  absl::MutexLock lock(&mu_);
+  PX_ASSIGN_OR_RETURN(
+      std::vector<ElfReader::SymbolInfo> symbol_infos,
+      SearchSymbolsLocked(symbol, SymbolMatchType::kExact, /*symbol_type*/ std::nullopt,
+                          /*stop_at_first_match*/ true));
   if (symbol_infos.empty()) {
     return error::NotFound("Symbol $0 not found", symbol);
   }
@@ -313,7 +336,10 @@ StatusOr<ElfReader::SymbolInfo> ElfReader::SearchTheOnlySymbol(std::string_view
 }
 
 std::optional<int64_t> ElfReader::SymbolAddress(std::string_view symbol) {
-  auto symbol_infos_or = SearchSymbols(symbol, SymbolMatchType::kExact);
+  absl::MutexLock lock(&mu_);
+  auto symbol_infos_or = SearchSymbolsLocked(symbol, SymbolMatchType::kExact,
+                                             /*symbol_type*/ std::nullopt,
+                                             /*stop_at_first_match*/ false);
   if (symbol_infos_or.ok()) {
     const auto& symbol_infos = symbol_infos_or.ValueOrDie();
     if (!symbol_infos.empty()) {
@@ -325,6 +351,7 @@ std::optional<int64_t> ElfReader::SymbolAddress(std::string_view symbol) {
 }
 
 StatusOr<std::optional<std::string>> ElfReader::AddrToSymbol(size_t sym_addr) {
+  absl::MutexLock lock(&mu_);
   PX_ASSIGN_OR_RETURN(ELFIO::section * symtab_section, SymtabSection());
 
   const ELFIO::symbol_section_accessor symbols(elf_reader_, symtab_section);
@@ -351,6 +378,7 @@ StatusOr<std::optional<std::string>> ElfReader::AddrToSymbol(size_t sym_addr) {
 // TODO(oazizi): Optimize by indexing or switching to binary search if we can guarantee addresses
 //               are ordered.
 StatusOr<std::optional<std::string>> ElfReader::InstrAddrToSymbol(size_t sym_addr) {
+  absl::MutexLock lock(&mu_);
   PX_ASSIGN_OR_RETURN(ELFIO::section * symtab_section, SymtabSection());
 
   const ELFIO::symbol_section_accessor symbols(elf_reader_, symtab_section);
@@ -376,6 +404,7 @@ StatusOr<std::optional<std::string>> ElfReader::InstrAddrToSymbol(size_t sym_add
 }
 
 StatusOr<std::unique_ptr<ElfReader::Symbolizer>> ElfReader::GetSymbolizer() {
+  absl::MutexLock lock(&mu_);
   PX_ASSIGN_OR_RETURN(ELFIO::section * symtab_section, SymtabSection());
 
   auto symbolizer = std::make_unique<ElfReader::Symbolizer>();
@@ -406,6 +435,13 @@ void ElfReader::Symbolizer::AddEntry(size_t addr, size_t size, std::string name)
   symbols_.emplace(addr, SymbolAddrInfo{size, std::move(name)});
 }
 
+void ElfReader::Symbolizer::ForEachEntry(
+    const std::function<void(uintptr_t addr, size_t size, std::string_view name)>& fn) const {
+  for (const auto& [addr, info] : symbols_) {
+    fn(addr, info.size, info.name);
+  }
+}
+
 std::string_view ElfReader::Symbolizer::Lookup(size_t addr) const {
   static std::string symbol_str;
 
@@ -521,9 +557,16 @@ class LLVMDisasmContext {
   IsRetInstFn is_ret_inst_impl_;
 };
 
-std::unique_ptr<absl::flat_hash_map<Arch, std::unique_ptr<LLVMDisasmContext>>> g_disasm_registry;
+// The disasm contexts are created lazily and hold mutable decoder state, so both registry access
+// and disassembly through a context are serialized. Disassembly is rare (a few symbols per
+// scanned binary), so a single process-wide lock is not a contention concern.
+absl::Mutex g_disasm_mu;
+
+std::unique_ptr<absl::flat_hash_map<Arch, std::unique_ptr<LLVMDisasmContext>>> g_disasm_registry
+    ABSL_GUARDED_BY(g_disasm_mu);
 
-LLVMDisasmContext* GetLLVMDisasmContextForArch(Arch arch) {
+LLVMDisasmContext* GetLLVMDisasmContextForArch(Arch arch)
+    ABSL_EXCLUSIVE_LOCKS_REQUIRED(g_disasm_mu) {
   if (g_disasm_registry == nullptr) {
     g_disasm_registry =
         std::make_unique<absl::flat_hash_map<Arch, std::unique_ptr<LLVMDisasmContext>>>();
@@ -539,6 +582,7 @@ std::vector<uint64_t> FindRetInsts(Arch arch, utils::u8string_view byte_code) {
     return {};
   }
 
+  absl::MutexLock lock(&g_disasm_mu);
   auto disasm = GetLLVMDisasmContextForArch(arch);
 
   // Size of the buffer to hold disassembled assembly code. Since we do not really use the assembly
@@ -585,9 +629,22 @@ StatusOr<Arch> GetArchFromELFMachine(ELFIO::Elf_Half machine) {
 }  // namespace
 
 StatusOr<std::vector<uint64_t>> ElfReader::FuncRetInstAddrs(const SymbolInfo& func_symbol) {
+  absl::MutexLock lock(&mu_);
   constexpr std::string_view kDotText = ".text";
-  PX_ASSIGN_OR_RETURN(utils::u8string byte_code, SymbolByteCode(kDotText, func_symbol));
   PX_ASSIGN_OR_RETURN(auto arch, GetArchFromELFMachine(elf_reader_.get_machine()));
+
+  // Scan the function's byte code directly in the read-only mapping of the binary (no copy);
+  // fall back to a copying file read if the binary could not be mapped.
+  utils::u8string byte_code_storage;
+  utils::u8string_view byte_code;
+  auto view_or = SymbolByteCodeView(kDotText, func_symbol);
+  if (view_or.ok()) {
+    byte_code = view_or.ValueOrDie();
+  } else {
+    PX_ASSIGN_OR_RETURN(byte_code_storage, SymbolByteCodeLocked(kDotText, func_symbol));
+    byte_code = byte_code_storage;
+  }
+
   std::vector<uint64_t> addrs = FindRetInsts(arch, byte_code);
   for (auto& offset : addrs) {
     offset += func_symbol.address;
@@ -596,6 +653,15 @@ StatusOr<std::vector<uint64_t>> ElfReader::FuncRetInstAddrs(const SymbolInfo& fu
 }
 
 StatusOr<ELFIO::section*> ElfReader::SectionWithName(std::string_view section_name) {
+  absl::MutexLock lock(&mu_);
+  PX_ASSIGN_OR_RETURN(ELFIO::section * psec, SectionWithNameLocked(section_name));
+  // Force the lazy section-data load while the lock is held, so callers can query the returned
+  // section without synchronizing with other users of this reader.
+  psec->get_data();
+  return psec;
+}
+
+StatusOr<ELFIO::section*> ElfReader::SectionWithNameLocked(std::string_view section_name) {
   for (int i = 0; i < elf_reader_.sections.size(); ++i) {
     ELFIO::section* psec = elf_reader_.sections[i];
     if (psec->get_name() == section_name) {
@@ -605,9 +671,43 @@ StatusOr<ELFIO::section*> ElfReader::SectionWithName(std::string_view section_na
   return error::NotFound("Could not find section=$0 in binary=$1", section_name, binary_path_);
 }
 
+StatusOr<std::string_view> ElfReader::BinaryImageView(size_t offset, size_t length) {
+  if (elf_image_ == nullptr) {
+    PX_ASSIGN_OR_RETURN(elf_image_, MmapFile::MapReadOnly(binary_path_));
+  }
+  const std::string_view data = elf_image_->data();
+  if (offset > data.size() || length > data.size() - offset) {
+    return error::Internal("Requested range [$0, $1) is out of bounds of binary=$2 (size=$3)",
+                           offset, offset + length, binary_path_, data.size());
+  }
+  return data.substr(offset, length);
+}
+
+StatusOr<utils::u8string_view> ElfReader::SymbolByteCodeView(std::string_view section,
+                                                             const SymbolInfo& symbol) {
+  PX_ASSIGN_OR_RETURN(ELFIO::section * text_section, SectionWithNameLocked(section));
+  const size_t offset = symbol.address - text_section->get_address() + text_section->get_offset();
+
+  // Size sanity bound; see the rationale in SymbolByteCode() below.
+  if (symbol.size > 100 * 2048) {
+    return error::Internal(
+        "ELF symbol=$0 bytecode detected as size=$1 bytes. Refusing to map that much memory",
+        symbol.name, symbol.size);
+  }
+
+  PX_ASSIGN_OR_RETURN(const std::string_view view, BinaryImageView(offset, symbol.size));
+  return utils::u8string_view(reinterpret_cast<const uint8_t*>(view.data()), view.size());
+}
+
 StatusOr<utils::u8string> ElfReader::SymbolByteCode(std::string_view section,
                                                     const SymbolInfo& symbol) {
-  PX_ASSIGN_OR_RETURN(ELFIO::section * text_section, SectionWithName(section));
+  absl::MutexLock lock(&mu_);
+  return SymbolByteCodeLocked(section, symbol);
+}
+
+StatusOr<utils::u8string> ElfReader::SymbolByteCodeLocked(std::string_view section,
+                                                          const SymbolInfo& symbol) {
+  PX_ASSIGN_OR_RETURN(ELFIO::section * text_section, SectionWithNameLocked(section));
   int offset = symbol.address - text_section->get_address() + text_section->get_offset();
 
   std::ifstream ifs(binary_path_, std::ios::binary);
@@ -640,6 +740,7 @@ StatusOr<utils::u8string> ElfReader::SymbolByteCode(std::string_view section,
 }
 
 StatusOr<uint64_t> ElfReader::GetVirtualAddrAtOffsetZero() {
+  absl::MutexLock lock(&mu_);
   const ELFIO::segment* first_loadable_segment = nullptr;
   for (int i = 0; i < elf_reader_.segments.size(); i++) {
     ELFIO::segment* segment = elf_reader_.segments[i];
@@ -657,7 +758,10 @@ StatusOr<uint64_t> ElfReader::GetVirtualAddrAtOffsetZero() {
   return virt_addr - offset;
 }
 
-ELFIO::Elf_Half ElfReader::ELFType() { return elf_reader_.get_type(); }
+ELFIO::Elf_Half ElfReader::ELFType() {
+  absl::MutexLock lock(&mu_);
+  return elf_reader_.get_type();
+}
 
 }  // namespace obj_tools
 }  // namespace stirling
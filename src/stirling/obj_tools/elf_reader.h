@@ -19,16 +19,19 @@
 #pragma once
 
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include <absl/container/btree_map.h>
 #include <absl/container/flat_hash_map.h>
+#include <absl/synchronization/mutex.h>
 
 #include <elfio/elfio.hpp>
 
 #include "src/common/base/base.h"
+#include "src/stirling/obj_tools/mmap_file.h"
 #include "src/stirling/obj_tools/utils.h"
 
 using ::px::utils::u8string;
@@ -37,6 +40,13 @@ namespace px {
 namespace stirling {
 namespace obj_tools {
 
+/**
+ * ElfReader extracts symbol and section information from an ELF binary.
+ *
+ * Queries are internally serialized, so a single instance may be shared across threads (see
+ * ReaderRegistry): ELFIO loads section data lazily on access and the binary image mapping is
+ * created on first use, so concurrent queries would otherwise race on that state.
+ */
 class ElfReader {
  public:
   /**
@@ -71,6 +81,12 @@ class ElfReader {
 
   StatusOr<int32_t> FindSegmentOffsetOfSection(std::string_view section_name);
 
+  /**
+   * Returns the GNU build-id of the binary (contents of the .note.gnu.build-id section),
+   * as a lowercase hex string. Returns error if the binary was built without a build-id.
+   */
+  StatusOr<std::string> BuildID();
+
   /**
    * Returns a list of symbol names that meets the search criteria.
    *
@@ -138,6 +154,15 @@ class ElfReader {
      */
     std::string_view Lookup(uintptr_t addr) const;
 
+    /**
+     * Invokes fn on every entry of the index, in ascending address order.
+     * Used to serialize the index (see ElfSymbolizer's persistent symbol index).
+     */
+    void ForEachEntry(
+        const std::function<void(uintptr_t addr, size_t size, std::string_view name)>& fn) const;
+
+    size_t size() const { return symbols_.size(); }
+
    private:
     struct SymbolAddrInfo {
       size_t size;
@@ -167,7 +192,9 @@ class ElfReader {
   StatusOr<uint64_t> GetVirtualAddrAtOffsetZero();
 
   /**
-   * Returns the ELF section with the corresponding name
+   * Returns the ELF section with the corresponding name.
+   * The section's data is loaded before returning, so callers may query the returned section
+   * without synchronizing with other users of this reader.
    */
   StatusOr<ELFIO::section*> SectionWithName(std::string_view section_name);
 
@@ -197,7 +224,19 @@ class ElfReader {
  private:
   ElfReader() = default;
 
-  StatusOr<ELFIO::section*> SymtabSection();
+  StatusOr<ELFIO::section*> SymtabSection() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  StatusOr<ELFIO::section*> SectionWithNameLocked(std::string_view section_name)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  StatusOr<std::vector<SymbolInfo>> SearchSymbolsLocked(std::string_view search_symbol,
+                                                        SymbolMatchType match_type,
+                                                        std::optional<int> symbol_type,
+                                                        bool stop_at_first_match)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  StatusOr<u8string> SymbolByteCodeLocked(std::string_view section, const SymbolInfo& symbol)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   /**
    * Locates the debug symbols for the currently loaded ELF object.
@@ -213,8 +252,32 @@ class ElfReader {
    */
   StatusOr<px::utils::u8string> FuncByteCode(const SymbolInfo& func_symbol);
 
+  /**
+   * Returns a view of [offset, offset+length) within the read-only mapping of the binary,
+   * creating the mapping on first use. Error if the binary cannot be mapped or the range is
+   * out-of-bounds.
+   */
+  StatusOr<std::string_view> BinaryImageView(size_t offset, size_t length)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  /**
+   * Zero-copy variant of SymbolByteCode(): a view into the read-only mapping of the binary.
+   * The view is valid for the lifetime of this ElfReader.
+   */
+  StatusOr<utils::u8string_view> SymbolByteCodeView(std::string_view section,
+                                                    const SymbolInfo& symbol)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   std::string binary_path_;
 
+  // Serializes queries, which mutate lazily-loaded state (ELFIO section data and elf_image_).
+  // The Create() path runs before the reader is shared and does not take the lock.
+  mutable absl::Mutex mu_;
+
+  // Lazily-created read-only mapping of binary_path_, used to serve byte-code reads without
+  // per-read file IO or copies. Released when the reader is destroyed.
+  std::unique_ptr<MmapFile> elf_image_ ABSL_GUARDED_BY(mu_);
+
   std::filesystem::path debug_symbols_path_;
 
   // Set up an elf reader, so we can extract debug symbols.
@@ -182,6 +182,17 @@ TEST(ElfReaderTest, InstrAddrToSymbol) {
   }
 }
 
+TEST(ElfReaderTest, BuildID) {
+  const std::string stripped_bin =
+      px::testing::BazelRunfilePath("src/stirling/obj_tools/testdata/cc/stripped_test_exe");
+
+  ASSERT_OK_AND_ASSIGN(std::unique_ptr<ElfReader> elf_reader, ElfReader::Create(stripped_bin));
+
+  // The build-id is pinned by the testdata build rules, which is also why the external debug
+  // symbols for this binary live at usr/lib/debug/.build-id/7d/eb0e3f89deba61.debug.
+  EXPECT_OK_AND_EQ(elf_reader->BuildID(), "7deb0e3f89deba61");
+}
+
 TEST(ElfReaderTest, ExternalDebugSymbolsBuildID) {
   const std::string stripped_bin =
       px::testing::BazelRunfilePath("src/stirling/obj_tools/testdata/cc/stripped_test_exe");
@@ -208,6 +219,18 @@ TEST(ElfReaderTest, ExternalDebugSymbolsDebugLink) {
                      ElementsAre(SymbolNameIs("CanYouFindThis")));
 }
 
+TEST(MmapFileTest, MapReadOnly) {
+  const std::string path =
+      px::testing::BazelRunfilePath("src/stirling/obj_tools/testdata/cc/prebuilt_test_exe");
+  ASSERT_OK_AND_ASSIGN(std::unique_ptr<MmapFile> mmap_file, MmapFile::MapReadOnly(path));
+
+  const std::string_view data = mmap_file->data();
+  ASSERT_GE(data.size(), 4U);
+  EXPECT_EQ(data.substr(0, 4), std::string_view("\x7fELF", 4));
+
+  EXPECT_NOT_OK(MmapFile::MapReadOnly("/path/does/not/exist"));
+}
+
 TEST(ElfReaderTest, FuncByteCode) {
   {
     const std::string path =
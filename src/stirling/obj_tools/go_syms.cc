@@ -19,8 +19,11 @@
 #include "src/stirling/obj_tools/go_syms.h"
 #include "src/stirling/utils/binary_decoder.h"
 
+#include <optional>
 #include <utility>
 
+#include <absl/synchronization/mutex.h>
+
 namespace px {
 namespace stirling {
 namespace obj_tools {
@@ -41,6 +44,37 @@ struct gostring {
   int64_t len;
 };
 
+// Go runtime metadata extracted from a binary, cached process-wide and keyed by build-id.
+// The metadata depends only on the binary contents, and the same Go binary is typically scanned
+// many times (one scan per process, and pods of one deployment share an image), so caching keeps
+// the repeated buildinfo parsing and itable symbol scans off the uprobe-attachment critical path.
+struct GoBinaryMetadata {
+  std::optional<std::string> build_version;
+  std::optional<absl::flat_hash_map<std::string, std::vector<IntfImplTypeInfo>>> interfaces;
+};
+
+constexpr size_t kMaxGoMetadataCacheEntries = 64;
+
+absl::Mutex go_metadata_cache_mu(absl::kConstInit);
+
+absl::flat_hash_map<std::string, GoBinaryMetadata>& GoMetadataCache()
+    ABSL_EXCLUSIVE_LOCKS_REQUIRED(go_metadata_cache_mu) {
+  static auto* cache = new absl::flat_hash_map<std::string, GoBinaryMetadata>();
+  return *cache;
+}
+
+// Returns the cache slot for the binary read by elf_reader, or nullopt if the binary has no
+// build-id (in which case results are not cached). Bounds the cache by discarding all entries
+// when full; the entries are cheap to recompute, and in practice the working set of distinct
+// Go images on one node is far below the cap.
+std::optional<std::string> GoMetadataCacheKey(ElfReader* elf_reader) {
+  StatusOr<std::string> build_id = elf_reader->BuildID();
+  if (!build_id.ok()) {
+    return std::nullopt;
+  }
+  return build_id.ConsumeValueOrDie();
+}
+
 }  // namespace
 
 bool IsGoExecutable(ElfReader* elf_reader) {
@@ -74,7 +108,7 @@ StatusOr<std::string> ReadGoString(ElfReader* elf_reader, uint64_t ptr_size, uin
 // Reads the buildinfo header embedded in the .go.buildinfo ELF section in order to determine the go
 // toolchain version. This function emulates what the go version cli performs as seen
 // https://github.com/golang/go/blob/cb7a091d729eab75ccfdaeba5a0605f05addf422/src/debug/buildinfo/buildinfo.go#L151-L221
-StatusOr<std::string> ReadGoBuildVersion(ElfReader* elf_reader) {
+StatusOr<std::string> ReadGoBuildVersionImpl(ElfReader* elf_reader) {
   PX_ASSIGN_OR_RETURN(ELFIO::section * section, elf_reader->SectionWithName(kGoBuildInfoSection));
   int offset = section->get_offset();
   PX_ASSIGN_OR_RETURN(std::string_view buildInfoByteCode,
@@ -144,8 +178,45 @@ StatusOr<std::string> ReadGoBuildVersion(ElfReader* elf_reader) {
   return ReadGoString(elf_reader, ptr_size, ptr_addr, read_ptr);
 }
 
+StatusOr<std::string> ReadGoBuildVersion(ElfReader* elf_reader) {
+  const std::optional<std::string> cache_key = GoMetadataCacheKey(elf_reader);
+
+  if (cache_key.has_value()) {
+    absl::MutexLock lock(&go_metadata_cache_mu);
+    auto& cache = GoMetadataCache();
+    auto iter = cache.find(cache_key.value());
+    if (iter != cache.end() && iter->second.build_version.has_value()) {
+      return iter->second.build_version.value();
+    }
+  }
+
+  PX_ASSIGN_OR_RETURN(std::string build_version, ReadGoBuildVersionImpl(elf_reader));
+
+  if (cache_key.has_value()) {
+    absl::MutexLock lock(&go_metadata_cache_mu);
+    auto& cache = GoMetadataCache();
+    if (cache.size() >= kMaxGoMetadataCacheEntries && !cache.contains(cache_key.value())) {
+      cache.clear();
+    }
+    cache[cache_key.value()].build_version = build_version;
+  }
+
+  return build_version;
+}
+
 StatusOr<absl::flat_hash_map<std::string, std::vector<IntfImplTypeInfo>>> ExtractGolangInterfaces(
     ElfReader* elf_reader) {
+  const std::optional<std::string> cache_key = GoMetadataCacheKey(elf_reader);
+
+  if (cache_key.has_value()) {
+    absl::MutexLock lock(&go_metadata_cache_mu);
+    auto& cache = GoMetadataCache();
+    auto iter = cache.find(cache_key.value());
+    if (iter != cache.end() && iter->second.interfaces.has_value()) {
+      return iter->second.interfaces.value();
+    }
+  }
+
   absl::flat_hash_map<std::string, std::vector<IntfImplTypeInfo>> interface_types;
 
   // All itable objects in the symbols are prefixed with this string.
@@ -176,6 +247,15 @@ StatusOr<absl::flat_hash_map<std::string, std::vector<IntfImplTypeInfo>>> Extrac
     interface_types[std::string(interface_name)].push_back(std::move(info));
   }
 
+  if (cache_key.has_value()) {
+    absl::MutexLock lock(&go_metadata_cache_mu);
+    auto& cache = GoMetadataCache();
+    if (cache.size() >= kMaxGoMetadataCacheEntries && !cache.contains(cache_key.value())) {
+      cache.clear();
+    }
+    cache[cache_key.value()].interfaces = interface_types;
+  }
+
   return interface_types;
 }
 
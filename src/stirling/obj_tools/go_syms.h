@@ -34,7 +34,7 @@ namespace obj_tools {
 bool IsGoExecutable(ElfReader* elf_reader);
 
 // Returns the build version of a Golang executable. The executable is read through the input
-// elf_reader.
+// elf_reader. Successful results are cached process-wide, keyed by the binary's build-id.
 // TODO(yzhao): We'll use this to determine the corresponding Golang executable's TLS data
 // structures and their offsets.
 StatusOr<std::string> ReadGoBuildVersion(ElfReader* elf_reader);
@@ -53,6 +53,7 @@ struct IntfImplTypeInfo {
 };
 
 // Returns a map of all interfaces, and types that implement that interface in a go binary.
+// Successful results are cached process-wide, keyed by the binary's build-id.
 StatusOr<absl::flat_hash_map<std::string, std::vector<IntfImplTypeInfo>>> ExtractGolangInterfaces(
     ElfReader* elf_reader);
 
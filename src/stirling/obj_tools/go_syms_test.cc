@@ -62,6 +62,18 @@ TEST(ReadGoBuildVersionTest, BuildinfoLittleEndiani386) {
   EXPECT_THAT(version, StrEq("go1.13.15"));
 }
 
+TEST(ReadGoBuildVersionTest, RepeatedReadsServedFromCache) {
+  const std::string kPath = px::testing::BazelRunfilePath(kTestGoBinaryPath);
+  ASSERT_OK_AND_ASSIGN(std::unique_ptr<ElfReader> elf_reader, ElfReader::Create(kPath));
+  ASSERT_OK_AND_ASSIGN(std::string version, ReadGoBuildVersion(elf_reader.get()));
+
+  // A fresh reader on the same binary is served from the build-id-keyed metadata cache
+  // (when the binary carries a build-id); the result must match a cold parse either way.
+  ASSERT_OK_AND_ASSIGN(std::unique_ptr<ElfReader> elf_reader2, ElfReader::Create(kPath));
+  ASSERT_OK_AND_ASSIGN(std::string version2, ReadGoBuildVersion(elf_reader2.get()));
+  EXPECT_EQ(version2, version);
+}
+
 TEST(IsGoExecutableTest, WorkingOnBasicGoBinary) {
   const std::string kPath = px::testing::BazelRunfilePath(kTestGoBinaryPath);
   ASSERT_OK_AND_ASSIGN(std::unique_ptr<ElfReader> elf_reader, ElfReader::Create(kPath));
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/stirling/obj_tools/mmap_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+
+namespace px {
+namespace stirling {
+namespace obj_tools {
+
+StatusOr<std::unique_ptr<MmapFile>> MmapFile::MapReadOnly(const std::filesystem::path& path) {
+  const int fd = open(path.string().c_str(), O_RDONLY);
+  if (fd < 0) {
+    return error::Internal("Could not open file $0 [errno=$1]", path.string(), errno);
+  }
+
+  struct stat stat_buf;
+  if (fstat(fd, &stat_buf) != 0) {
+    close(fd);
+    return error::Internal("Could not stat file $0 [errno=$1]", path.string(), errno);
+  }
+  if (stat_buf.st_size == 0) {
+    close(fd);
+    return error::Internal("Cannot mmap empty file $0", path.string());
+  }
+
+  void* addr = mmap(nullptr, stat_buf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping remains valid after the fd is closed.
+  close(fd);
+  if (addr == MAP_FAILED) {
+    return error::Internal("Could not mmap file $0 [errno=$1]", path.string(), errno);
+  }
+
+  return std::unique_ptr<MmapFile>(new MmapFile(addr, stat_buf.st_size));
+}
+
+MmapFile::~MmapFile() { munmap(addr_, size_); }
+
+}  // namespace obj_tools
+}  // namespace stirling
+}  // namespace px
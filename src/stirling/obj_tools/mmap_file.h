@@ -0,0 +1,55 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string_view>
+
+#include "src/common/base/base.h"
+
+namespace px {
+namespace stirling {
+namespace obj_tools {
+
+/**
+ * A read-only memory mapping of a file.
+ *
+ * The pages are faulted in on demand and can be reclaimed by the kernel under memory pressure,
+ * so large files (e.g. debug-laden binaries) can be parsed without a matching RSS spike.
+ * The mapping is released when the object is destroyed.
+ */
+class MmapFile : public NotCopyMoveable {
+ public:
+  static StatusOr<std::unique_ptr<MmapFile>> MapReadOnly(const std::filesystem::path& path);
+
+  ~MmapFile();
+
+  std::string_view data() const { return {static_cast<const char*>(addr_), size_}; }
+
+ private:
+  MmapFile(void* addr, size_t size) : addr_(addr), size_(size) {}
+
+  void* const addr_;
+  const size_t size_;
+};
+
+}  // namespace obj_tools
+}  // namespace stirling
+}  // namespace px
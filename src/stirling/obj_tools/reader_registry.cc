@@ -0,0 +1,201 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/stirling/obj_tools/reader_registry.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <absl/strings/str_cat.h>
+
+DEFINE_int64(stirling_obj_tools_reader_cache_limit_bytes,
+             gflags::Int64FromEnv("PL_STIRLING_OBJ_TOOLS_READER_CACHE_LIMIT_BYTES",
+                                  256 * 1024 * 1024),
+             "Approximate cap on the bytes retained by cached ELF/DWARF readers, measured as the "
+             "size of the backing binaries. Least-recently-used readers are evicted once the cap "
+             "is exceeded. 0 disables the byte cap (the entry-count cap still applies).");
+
+namespace px {
+namespace stirling {
+namespace obj_tools {
+
+ReaderRegistry* ReaderRegistry::GetInstance() {
+  static ReaderRegistry* registry = new ReaderRegistry();
+  return registry;
+}
+
+StatusOr<std::string> ReaderRegistry::PathSignature(const std::filesystem::path& path) {
+  std::error_code ec;
+  const auto size = std::filesystem::file_size(path, ec);
+  if (ec) {
+    return error::NotFound("Could not stat binary $0: $1", path.string(), ec.message());
+  }
+  const auto mtime = std::filesystem::last_write_time(path, ec);
+  if (ec) {
+    return error::NotFound("Could not stat binary $0: $1", path.string(), ec.message());
+  }
+  return absl::StrCat(path.string(), ":", size, ":",
+                      mtime.time_since_epoch().count());
+}
+
+void ReaderRegistry::Touch(Entry* entry) { entry->last_used = ++use_seq_; }
+
+void ReaderRegistry::InsertAndMaybeEvict(const std::string& key, Entry entry) {
+  entry.last_used = ++use_seq_;
+  total_bytes_ += entry.bytes;
+  readers_.insert_or_assign(key, std::move(entry));
+
+  const int64_t limit = FLAGS_stirling_obj_tools_reader_cache_limit_bytes;
+  // Evict LRU-first until under the caps, but always keep the entry just inserted. Evicted
+  // readers stay alive as long as callers hold references; the registry just drops its own.
+  while (readers_.size() > 1 &&
+         (readers_.size() > kMaxCachedReaders || (limit > 0 && total_bytes_ > limit))) {
+    auto lru = readers_.begin();
+    for (auto iter = readers_.begin(); iter != readers_.end(); ++iter) {
+      if (iter->second.last_used < lru->second.last_used) {
+        lru = iter;
+      }
+    }
+    total_bytes_ -= lru->second.bytes;
+    readers_.erase(lru);
+  }
+
+  // Path memos of evicted readers are cleaned lazily on lookup; bound the map in case a churning
+  // workload (e.g. short-lived pids) accumulates memos faster than lookups retire them.
+  if (path_to_key_.size() > 4 * kMaxCachedReaders) {
+    path_to_key_.clear();
+  }
+}
+
+StatusOr<std::shared_ptr<ElfReader>> ReaderRegistry::GetElfReader(
+    const std::string& binary_path, const std::filesystem::path& debug_file_dir) {
+  PX_ASSIGN_OR_RETURN(const std::string path_sig, PathSignature(binary_path));
+  const std::string memo_key = absl::StrCat("elf:", path_sig);
+
+  {
+    absl::MutexLock lock(&mu_);
+    auto memo_iter = path_to_key_.find(memo_key);
+    if (memo_iter != path_to_key_.end()) {
+      auto iter = readers_.find(memo_iter->second);
+      if (iter != readers_.end() && iter->second.elf_reader != nullptr) {
+        Touch(&iter->second);
+        return iter->second.elf_reader;
+      }
+      path_to_key_.erase(memo_iter);
+    }
+  }
+
+  // Parse outside the lock so a slow load doesn't block lookups of other binaries. Two threads
+  // racing on the same uncached binary may both parse; the loser adopts the winner's instance.
+  PX_ASSIGN_OR_RETURN(std::unique_ptr<ElfReader> reader,
+                      ElfReader::Create(binary_path, debug_file_dir));
+  // Dedup by build-id when available, so the same binary reached through different paths (e.g.
+  // /proc/<pid>/root of containers sharing an image) maps to one cached reader.
+  const std::string key = absl::StrCat("elf:", reader->BuildID().ConsumeValueOr(path_sig));
+
+  std::error_code ec;
+  const int64_t bytes = static_cast<int64_t>(std::filesystem::file_size(binary_path, ec));
+
+  absl::MutexLock lock(&mu_);
+  path_to_key_[memo_key] = key;
+  auto iter = readers_.find(key);
+  if (iter != readers_.end() && iter->second.elf_reader != nullptr) {
+    Touch(&iter->second);
+    return iter->second.elf_reader;
+  }
+  Entry entry;
+  entry.elf_reader = std::shared_ptr<ElfReader>(std::move(reader));
+  entry.bytes = ec ? 0 : bytes;
+  auto shared = entry.elf_reader;
+  InsertAndMaybeEvict(key, std::move(entry));
+  return shared;
+}
+
+StatusOr<std::shared_ptr<DwarfReader>> ReaderRegistry::GetDwarfReader(
+    const std::filesystem::path& path) {
+  PX_ASSIGN_OR_RETURN(const std::string path_sig, PathSignature(path));
+  const std::string memo_key = absl::StrCat("dwarf:", path_sig);
+
+  {
+    absl::MutexLock lock(&mu_);
+    auto memo_iter = path_to_key_.find(memo_key);
+    if (memo_iter != path_to_key_.end()) {
+      auto iter = readers_.find(memo_iter->second);
+      if (iter != readers_.end() && iter->second.dwarf_reader != nullptr) {
+        Touch(&iter->second);
+        return iter->second.dwarf_reader;
+      }
+      path_to_key_.erase(memo_iter);
+    }
+  }
+
+  // The build-id probe is cheap relative to DWARF indexing, so resolve the key first and check
+  // for a reader cached under a different path before paying for indexing.
+  std::string id = path_sig;
+  auto elf_reader_or = ElfReader::Create(path.string());
+  if (elf_reader_or.ok()) {
+    id = elf_reader_or.ValueOrDie()->BuildID().ConsumeValueOr(path_sig);
+  }
+  const std::string key = absl::StrCat("dwarf:", id);
+
+  {
+    absl::MutexLock lock(&mu_);
+    auto iter = readers_.find(key);
+    if (iter != readers_.end() && iter->second.dwarf_reader != nullptr) {
+      path_to_key_[memo_key] = key;
+      Touch(&iter->second);
+      return iter->second.dwarf_reader;
+    }
+  }
+
+  PX_ASSIGN_OR_RETURN(std::unique_ptr<DwarfReader> reader, DwarfReader::CreateIndexingAll(path));
+
+  std::error_code ec;
+  const int64_t bytes = static_cast<int64_t>(std::filesystem::file_size(path, ec));
+
+  absl::MutexLock lock(&mu_);
+  path_to_key_[memo_key] = key;
+  auto iter = readers_.find(key);
+  if (iter != readers_.end() && iter->second.dwarf_reader != nullptr) {
+    Touch(&iter->second);
+    return iter->second.dwarf_reader;
+  }
+  Entry entry;
+  entry.dwarf_reader = std::shared_ptr<DwarfReader>(std::move(reader));
+  entry.bytes = ec ? 0 : bytes;
+  auto shared = entry.dwarf_reader;
+  InsertAndMaybeEvict(key, std::move(entry));
+  return shared;
+}
+
+size_t ReaderRegistry::num_cached_readers() const {
+  absl::MutexLock lock(&mu_);
+  return readers_.size();
+}
+
+void ReaderRegistry::Clear() {
+  absl::MutexLock lock(&mu_);
+  path_to_key_.clear();
+  readers_.clear();
+  total_bytes_ = 0;
+}
+
+}  // namespace obj_tools
+}  // namespace stirling
+}  // namespace px
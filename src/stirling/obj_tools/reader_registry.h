@@ -0,0 +1,112 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/synchronization/mutex.h>
+
+#include "src/common/base/base.h"
+#include "src/stirling/obj_tools/dwarf_reader.h"
+#include "src/stirling/obj_tools/elf_reader.h"
+
+DECLARE_int64(stirling_obj_tools_reader_cache_limit_bytes);
+
+namespace px {
+namespace stirling {
+namespace obj_tools {
+
+/**
+ * ReaderRegistry hands out shared ElfReader/DwarfReader instances, so the subsystems that inspect
+ * the same binary (uprobe manager, dynamic tracer, perf profiler, JVM tooling) parse it once per
+ * PEM lifetime instead of each paying the full parse cost and holding a duplicate copy.
+ *
+ * Readers are deduplicated by GNU build-id, so the same binary reached through different
+ * /proc/<pid>/root paths (e.g. many containers of one image) still maps to one instance. Binaries
+ * without a build-id fall back to a path+size+mtime key. Cached readers are evicted LRU-first once
+ * their approximate retained bytes (the size of the backing files) exceed
+ * --stirling_obj_tools_reader_cache_limit_bytes; outstanding references keep evicted readers
+ * alive until their users drop them.
+ *
+ * Both the registry and the readers it returns are thread-safe: ElfReader and DwarfReader
+ * serialize their queries internally, so subsystems that end up sharing an instance (e.g. the
+ * uprobe scan workers and the profiler's symbolization thread both inspecting a newly-started
+ * binary) need no external locking. DwarfReader's expensive query results are additionally
+ * cached process-wide (see DwarfQueryCache); cache hits are served without touching the
+ * per-reader lock.
+ */
+class ReaderRegistry {
+ public:
+  static ReaderRegistry* GetInstance();
+
+  /**
+   * Returns a shared ElfReader for the binary, creating and caching it on first use.
+   */
+  StatusOr<std::shared_ptr<ElfReader>> GetElfReader(
+      const std::string& binary_path,
+      const std::filesystem::path& debug_file_dir = "/usr/lib/debug");
+
+  /**
+   * Returns a shared, fully-indexed DwarfReader for the binary, creating and caching it on first
+   * use. Callers needing selective indexing should use the DwarfReader factories directly; those
+   * readers are request-specific and not worth caching.
+   */
+  StatusOr<std::shared_ptr<DwarfReader>> GetDwarfReader(const std::filesystem::path& path);
+
+  size_t num_cached_readers() const;
+
+  // Drops all cached readers and path memos. Outstanding references remain valid. For tests.
+  void Clear();
+
+ private:
+  struct Entry {
+    // Exactly one of the two is set, depending on the key's kind prefix.
+    std::shared_ptr<ElfReader> elf_reader;
+    std::shared_ptr<DwarfReader> dwarf_reader;
+    // Approximate retained bytes, measured as the size of the backing file.
+    int64_t bytes = 0;
+    uint64_t last_used = 0;
+  };
+
+  // Bound on the number of cached readers, independent of the byte cap, so many tiny binaries
+  // can't grow the maps without limit.
+  static constexpr size_t kMaxCachedReaders = 64;
+
+  // A cheap stat-based signature of a path, used to memoize path -> build-id so cache hits don't
+  // re-open the binary, and as the dedup key for binaries without a build-id.
+  static StatusOr<std::string> PathSignature(const std::filesystem::path& path);
+
+  void InsertAndMaybeEvict(const std::string& key, Entry entry) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void Touch(Entry* entry) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  mutable absl::Mutex mu_;
+  // Memoizes a path signature to the reader cache key, so repeat lookups of the same binary path
+  // skip the ELF open needed to read the build-id.
+  absl::flat_hash_map<std::string, std::string> path_to_key_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<std::string, Entry> readers_ ABSL_GUARDED_BY(mu_);
+  int64_t total_bytes_ ABSL_GUARDED_BY(mu_) = 0;
+  uint64_t use_seq_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+}  // namespace obj_tools
+}  // namespace stirling
+}  // namespace px
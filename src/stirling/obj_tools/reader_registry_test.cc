@@ -0,0 +1,140 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/stirling/obj_tools/reader_registry.h"
+
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/common/testing/temp_dir.h"
+#include "src/common/testing/testing.h"
+#include "src/stirling/obj_tools/testdata/cc/test_exe_fixture.h"
+
+namespace px {
+namespace stirling {
+namespace obj_tools {
+
+const TestExeFixture kTestExeFixture;
+
+TEST(ReaderRegistryTest, SharesReadersForSamePath) {
+  ReaderRegistry registry;
+  const std::string path = kTestExeFixture.Path().string();
+
+  ASSERT_OK_AND_ASSIGN(auto elf_reader1, registry.GetElfReader(path));
+  ASSERT_OK_AND_ASSIGN(auto elf_reader2, registry.GetElfReader(path));
+  EXPECT_EQ(elf_reader1.get(), elf_reader2.get());
+  EXPECT_EQ(1, registry.num_cached_readers());
+
+  ASSERT_OK_AND_ASSIGN(auto dwarf_reader1, registry.GetDwarfReader(path));
+  ASSERT_OK_AND_ASSIGN(auto dwarf_reader2, registry.GetDwarfReader(path));
+  EXPECT_EQ(dwarf_reader1.get(), dwarf_reader2.get());
+  EXPECT_EQ(2, registry.num_cached_readers());
+}
+
+TEST(ReaderRegistryTest, DedupsByBuildIDAcrossPaths) {
+  const std::string path = kTestExeFixture.Path().string();
+  {
+    ASSERT_OK_AND_ASSIGN(auto elf_reader, ElfReader::Create(path));
+    if (!elf_reader->BuildID().ok()) {
+      GTEST_SKIP() << "Test exe has no build-id; nothing to dedup by.";
+    }
+  }
+
+  // The same binary at a different path (e.g. containers sharing an image, seen through
+  // different /proc/<pid>/root paths) maps to one cached reader.
+  testing::TempDir temp_dir;
+  const std::filesystem::path copy_path = temp_dir.path() / "test_exe_copy";
+  std::filesystem::copy(path, copy_path);
+
+  ReaderRegistry registry;
+  ASSERT_OK_AND_ASSIGN(auto elf_reader1, registry.GetElfReader(path));
+  ASSERT_OK_AND_ASSIGN(auto elf_reader2, registry.GetElfReader(copy_path.string()));
+  EXPECT_EQ(elf_reader1.get(), elf_reader2.get());
+  EXPECT_EQ(1, registry.num_cached_readers());
+}
+
+TEST(ReaderRegistryTest, EvictsLRUOverByteCap) {
+  const int64_t old_limit = FLAGS_stirling_obj_tools_reader_cache_limit_bytes;
+  // A 1-byte budget forces every insertion to evict everything else; the newest entry is always
+  // kept so the registry still dedups repeat lookups of the current binary.
+  FLAGS_stirling_obj_tools_reader_cache_limit_bytes = 1;
+
+  ReaderRegistry registry;
+  const std::string path = kTestExeFixture.Path().string();
+
+  ASSERT_OK_AND_ASSIGN(auto elf_reader, registry.GetElfReader(path));
+  EXPECT_EQ(1, registry.num_cached_readers());
+
+  ASSERT_OK_AND_ASSIGN(auto dwarf_reader, registry.GetDwarfReader(path));
+  EXPECT_EQ(1, registry.num_cached_readers());
+
+  // The evicted ElfReader is still valid for existing holders.
+  EXPECT_OK(elf_reader->SearchSymbols("main", SymbolMatchType::kSubstr));
+
+  FLAGS_stirling_obj_tools_reader_cache_limit_bytes = old_limit;
+}
+
+// Hammers the same shared readers from several threads, mimicking the uprobe scan workers and
+// the profiler's symbolization thread inspecting one newly-started binary at the same time.
+// The assertions are basic; the real check is that this runs clean under TSAN, exercising the
+// readers' internal query serialization.
+TEST(ReaderRegistryTest, ConcurrentQueriesOnSharedReaders) {
+  ReaderRegistry registry;
+  const std::string path = kTestExeFixture.Path().string();
+
+  ASSERT_OK_AND_ASSIGN(auto elf_reader, registry.GetElfReader(path));
+  ASSERT_OK_AND_ASSIGN(auto dwarf_reader, registry.GetDwarfReader(path));
+
+  constexpr int kNumThreads = 4;
+  constexpr int kIterationsPerThread = 10;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&]() {
+      for (int iter = 0; iter < kIterationsPerThread; ++iter) {
+        EXPECT_OK(elf_reader->SearchSymbols("CanYouFindThis", SymbolMatchType::kSubstr));
+        EXPECT_OK(elf_reader->GetSymbolizer());
+        elf_reader->SymbolAddress("main");
+        // These may legitimately fail depending on how the test exe was built (e.g. no
+        // build-id); they are here to exercise the readers' lazily-loaded state concurrently.
+        elf_reader->BuildID();
+        dwarf_reader->GetFunctionArgInfo("CanYouFindThis");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+TEST(ReaderRegistryTest, ClearDropsCachedReaders) {
+  ReaderRegistry registry;
+  const std::string path = kTestExeFixture.Path().string();
+
+  ASSERT_OK_AND_ASSIGN(auto elf_reader1, registry.GetElfReader(path));
+  registry.Clear();
+  EXPECT_EQ(0, registry.num_cached_readers());
+
+  ASSERT_OK_AND_ASSIGN(auto elf_reader2, registry.GetElfReader(path));
+  EXPECT_NE(elf_reader1.get(), elf_reader2.get());
+}
+
+}  // namespace obj_tools
+}  // namespace stirling
+}  // namespace px
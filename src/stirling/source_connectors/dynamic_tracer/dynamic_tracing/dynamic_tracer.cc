@@ -20,11 +20,14 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <regex>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <absl/synchronization/mutex.h>
+
 #include "src/common/fs/fs_wrapper.h"
 #include "src/common/system/proc_pid_path.h"
 #include "src/common/system/system.h"
@@ -35,6 +38,7 @@
 #include "src/stirling/bpf_tools/utils.h"
 #include "src/stirling/obj_tools/dwarf_reader.h"
 #include "src/stirling/obj_tools/elf_reader.h"
+#include "src/stirling/obj_tools/reader_registry.h"
 #include "src/stirling/source_connectors/dynamic_tracer/dynamic_tracing/autogen.h"
 #include "src/stirling/source_connectors/dynamic_tracer/dynamic_tracing/code_gen.h"
 #include "src/stirling/source_connectors/dynamic_tracer/dynamic_tracing/dwarvifier.h"
@@ -99,8 +103,8 @@ StatusOr<BCCProgram::PerfBufferSpec> GetPerfBufferSpec(
 
 // Return value for Prepare(), so we can return multiple pointers.
 struct ObjInfo {
-  std::unique_ptr<ElfReader> elf_reader;
-  std::unique_ptr<DwarfReader> dwarf_reader;
+  std::shared_ptr<ElfReader> elf_reader;
+  std::shared_ptr<DwarfReader> dwarf_reader;
 };
 
 // Prepares the input program for compilation by:
@@ -112,16 +116,42 @@ StatusOr<ObjInfo> Prepare(const ir::logical::TracepointDeployment& input_program
   const auto& binary_path = input_program.deployment_spec().path_list().paths(0);
   LOG(INFO) << absl::Substitute("Tracepoint binary: $0", binary_path);
 
-  PX_ASSIGN_OR_RETURN(obj_info.elf_reader, ElfReader::Create(binary_path));
+  PX_ASSIGN_OR_RETURN(obj_info.elf_reader,
+                      obj_tools::ReaderRegistry::GetInstance()->GetElfReader(binary_path));
 
   const auto& debug_symbols_path = obj_info.elf_reader->debug_symbols_path().string();
 
-  obj_info.dwarf_reader =
-      DwarfReader::CreateIndexingAll(debug_symbols_path).ConsumeValueOr(nullptr);
+  obj_info.dwarf_reader = obj_tools::ReaderRegistry::GetInstance()
+                              ->GetDwarfReader(debug_symbols_path)
+                              .ConsumeValueOr(nullptr);
 
   return obj_info;
 }
 
+// Process-wide cache of compiled tracepoint programs, keyed by the serialized input program
+// and the target binary's build-id. Redeploying the same px.trace script (e.g. after a pod
+// restart) then skips the whole DWARF + codegen pipeline; the build-id component makes a
+// recompiled binary at the same path miss. Bounded in size; cleared wholesale when full,
+// since entries are cheap to recompute. Binaries without a build-id are not cached.
+constexpr size_t kMaxCompiledProgramCacheEntries = 64;
+
+absl::Mutex compiled_program_cache_mu(absl::kConstInit);
+
+absl::flat_hash_map<std::string, BCCProgram>& CompiledProgramCache()
+    ABSL_EXCLUSIVE_LOCKS_REQUIRED(compiled_program_cache_mu) {
+  static auto* cache = new absl::flat_hash_map<std::string, BCCProgram>();
+  return *cache;
+}
+
+std::optional<std::string> CompiledProgramCacheKey(
+    const ir::logical::TracepointDeployment& input_program, ElfReader* elf_reader) {
+  auto build_id_or = elf_reader->BuildID();
+  if (!build_id_or.ok() || build_id_or.ValueOrDie().empty()) {
+    return std::nullopt;
+  }
+  return absl::StrCat(build_id_or.ConsumeValueOrDie(), "\n", input_program.SerializeAsString());
+}
+
 }  // namespace
 
 StatusOr<BCCProgram> CompileProgram(ir::logical::TracepointDeployment* input_program) {
@@ -137,6 +167,19 @@ StatusOr<BCCProgram> CompileProgram(ir::logical::TracepointDeployment* input_pro
   // Get the ELF and DWARF readers for the program.
   PX_ASSIGN_OR_RETURN(ObjInfo obj_info, Prepare(*input_program));
 
+  // The key must be computed now, before the pipeline below starts mutating input_program.
+  const std::optional<std::string> cache_key =
+      CompiledProgramCacheKey(*input_program, obj_info.elf_reader.get());
+  if (cache_key.has_value()) {
+    absl::MutexLock lock(&compiled_program_cache_mu);
+    auto& cache = CompiledProgramCache();
+    auto iter = cache.find(cache_key.value());
+    if (iter != cache.end()) {
+      LOG(INFO) << "CompileProgram: serving previously compiled tracepoint program from cache.";
+      return iter->second;
+    }
+  }
+
   // --------------------------
   // Pre-processing pipeline
   // --------------------------
@@ -204,6 +247,15 @@ StatusOr<BCCProgram> CompileProgram(ir::logical::TracepointDeployment* input_pro
     bcc_program.perf_buffer_specs.push_back(std::move(pf_spec));
   }
 
+  if (cache_key.has_value()) {
+    absl::MutexLock lock(&compiled_program_cache_mu);
+    auto& cache = CompiledProgramCache();
+    if (cache.size() >= kMaxCompiledProgramCacheEntries && !cache.contains(cache_key.value())) {
+      cache.clear();
+    }
+    cache.emplace(cache_key.value(), bcc_program);
+  }
+
   return bcc_program;
 }
 
@@ -520,6 +520,26 @@ TEST(DynamicTracerTest, Compile) {
   EXPECT_THAT(code_lines, ElementsAreArray(kExpectedBCC));
 }
 
+// Compiling the same input program twice must produce the same result, with the second
+// compile served from the compiled-program cache (keyed by program and target build-id).
+TEST(DynamicTracerTest, RepeatedCompileServedFromCache) {
+  std::string input_program_str =
+      absl::Substitute(kLogicalProgramSpec, px::testing::BazelRunfilePath(kBinaryPath).string());
+
+  ir::logical::TracepointDeployment input_program1;
+  ASSERT_TRUE(TextFormat::ParseFromString(input_program_str, &input_program1));
+  ASSERT_OK_AND_ASSIGN(BCCProgram bcc_program1, CompileProgram(&input_program1));
+
+  // A fresh parse, as a redeployment of the same script would produce.
+  ir::logical::TracepointDeployment input_program2;
+  ASSERT_TRUE(TextFormat::ParseFromString(input_program_str, &input_program2));
+  ASSERT_OK_AND_ASSIGN(BCCProgram bcc_program2, CompileProgram(&input_program2));
+
+  EXPECT_EQ(bcc_program1.code, bcc_program2.code);
+  EXPECT_EQ(bcc_program1.uprobe_specs.size(), bcc_program2.uprobe_specs.size());
+  EXPECT_EQ(bcc_program1.perf_buffer_specs.size(), bcc_program2.perf_buffer_specs.size());
+}
+
 }  // namespace dynamic_tracing
 }  // namespace stirling
 }  // namespace px
@@ -38,6 +38,7 @@ namespace stirling {
 
 Status JVMStatsConnector::InitImpl() {
   sampling_freq_mgr_.set_period(kSamplingPeriod);
+  sampling_freq_mgr_.set_adaptive(true);
   push_freq_mgr_.set_period(kPushPeriod);
   return Status::OK();
 }
@@ -46,6 +47,12 @@ void JVMStatsConnector::FindJavaUPIDs(const ConnectorContext& ctx) {
   proc_tracker_.Update(ctx.GetUPIDs());
   const auto& upid_pidinfo_map = ctx.GetPIDInfoMap();
 
+  // Terminated processes must be dropped explicitly: reads through the persistent mmap never
+  // fail after the process (and its hsperfdata file) is gone, they just return stale values.
+  for (const auto& upid : proc_tracker_.deleted_upids()) {
+    java_procs_.erase(upid);
+  }
+
   for (const auto& upid : proc_tracker_.new_upids()) {
     // The host PID 1 is not a Java app. However, when later invoking HsperfdataPath(), it could be
     // confused to conclude that there is a hsperfdata file for PID 1, because of the limitations
@@ -69,21 +76,21 @@ void JVMStatsConnector::FindJavaUPIDs(const ConnectorContext& ctx) {
   }
 }
 
-Status JVMStatsConnector::ExportStats(const md::UPID& upid,
-                                      const std::filesystem::path& hsperf_data_path,
+Status JVMStatsConnector::ExportStats(const md::UPID& upid, JavaProcInfo* java_proc,
                                       DataTable* data_table) const {
-  PX_ASSIGN_OR_RETURN(std::string hsperf_data_str, ReadFileToString(hsperf_data_path));
-
-  if (hsperf_data_str.empty()) {
-    // Assume this is a transient failure.
-    return Status::OK();
+  if (java_proc->stats_reader == nullptr) {
+    // Map the hsperfdata file once; later cycles only re-read counter values through the
+    // mapping, without any per-cycle open/read/parse syscalls.
+    PX_ASSIGN_OR_RETURN(java_proc->stats_reader,
+                        java::StatsReader::Create(java_proc->hsperf_data_path));
   }
 
-  java::Stats stats(std::move(hsperf_data_str));
-  if (!stats.Parse().ok()) {
-    // Assumes this is a transient failure.
+  auto stats_or = java_proc->stats_reader->ReadStats();
+  if (!stats_or.ok()) {
+    // Assumes this is a transient failure (e.g. the JVM is still initializing its counters).
     return Status::OK();
   }
+  const java::Stats& stats = stats_or.ValueOrDie();
 
   uint64_t time = AdjustedSteadyClockNowNS();
 
@@ -114,7 +121,7 @@ void JVMStatsConnector::TransferDataImpl(ConnectorContext* ctx) {
     JavaProcInfo& java_proc = iter->second;
 
     md::UPID upid_with_asid(ctx->GetASID(), upid.pid(), upid.start_ts());
-    auto status = ExportStats(upid_with_asid, java_proc.hsperf_data_path, data_table);
+    auto status = ExportStats(upid_with_asid, &java_proc, data_table);
     if (!status.ok()) {
       ++java_proc.export_failure_count;
     }
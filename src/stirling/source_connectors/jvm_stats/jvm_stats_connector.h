@@ -64,20 +64,23 @@ class JVMStatsConnector : public SourceConnector {
   // Finds the UPIDs of newly-created processes as monitoring targets.
   void FindJavaUPIDs(const ConnectorContext& ctx);
 
-  // Exports JVM performance metrics to data table.
-  Status ExportStats(const md::UPID& upid, const std::filesystem::path& hsperf_data_path,
-                     DataTable* data_table) const;
-
-  // Keeps track of the currently-running processes. Used to find the newly-created processes.
-  ProcTracker proc_tracker_;
-
   // Records the PIDs of previously scanned Java processes, and their hsperfdata file path.
   struct JavaProcInfo {
     // How many times we have failed to export stats for this process. Once this reaches a limit,
     // the process will no longer be monitored.
     int export_failure_count = 0;
     std::filesystem::path hsperf_data_path;
+    // Persistent mmap of the hsperfdata file, created on the first export. Later cycles only
+    // re-read counter values through it, instead of re-opening and re-parsing the file.
+    std::unique_ptr<java::StatsReader> stats_reader;
   };
+
+  // Exports JVM performance metrics to data table.
+  Status ExportStats(const md::UPID& upid, JavaProcInfo* java_proc, DataTable* data_table) const;
+
+  // Keeps track of the currently-running processes. Used to find the newly-created processes.
+  ProcTracker proc_tracker_;
+
   absl::flat_hash_map<md::UPID, JavaProcInfo> java_procs_;
 };
 
@@ -18,11 +18,19 @@
 
 #include "src/stirling/source_connectors/jvm_stats/utils/java.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <absl/strings/match.h>
 
+#include <cerrno>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "src/common/base/byte_utils.h"
@@ -106,6 +114,70 @@ uint64_t Stats::SumStatsForSuffixes(const std::vector<std::string_view>& suffixe
   return sum;
 }
 
+StatusOr<std::unique_ptr<StatsReader>> StatsReader::Create(
+    const std::filesystem::path& hsperf_data_path) {
+  const int fd = open(hsperf_data_path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return error::NotFound("Could not open hsperfdata file $0: $1", hsperf_data_path.string(),
+                           std::strerror(errno));
+  }
+
+  struct stat stat_buf;
+  if (fstat(fd, &stat_buf) == -1 || stat_buf.st_size == 0) {
+    close(fd);
+    return error::Internal("Could not stat hsperfdata file $0", hsperf_data_path.string());
+  }
+
+  // MAP_SHARED, so counter updates written by the JVM through its own mapping of the file are
+  // visible through this one. The fd is not needed once the mapping exists.
+  const size_t mmap_size = stat_buf.st_size;
+  void* mmap_addr = mmap(nullptr, mmap_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mmap_addr == MAP_FAILED) {
+    return error::Internal("Could not mmap hsperfdata file $0: $1", hsperf_data_path.string(),
+                           std::strerror(errno));
+  }
+
+  std::unique_ptr<StatsReader> reader(new StatsReader(mmap_addr, mmap_size));
+  PX_RETURN_IF_ERROR(reader->ParseEntryIndex());
+  return reader;
+}
+
+StatsReader::StatsReader(void* mmap_addr, size_t mmap_size)
+    : mmap_addr_(mmap_addr), mmap_size_(mmap_size) {}
+
+StatsReader::~StatsReader() { munmap(mmap_addr_, mmap_size_); }
+
+Status StatsReader::ParseEntryIndex() {
+  hsperf::HsperfData hsperf_data = {};
+  PX_RETURN_IF_ERROR(hsperf::ParseHsperfData(DataView(), &hsperf_data));
+  long_entries_.clear();
+  for (const auto& entry : hsperf_data.data_entries) {
+    if (entry.header->data_type != static_cast<uint8_t>(hsperf::DataType::kLong)) {
+      continue;
+    }
+    long_entries_.emplace_back(entry.name, entry.data);
+  }
+  parsed_num_entries_ = hsperf_data.prologue->num_entries;
+  return Status::OK();
+}
+
+StatusOr<Stats> StatsReader::ReadStats() {
+  // The JVM registers counters incrementally during startup; re-parse the index when new
+  // entries have appeared since the last read.
+  const auto* prologue = reinterpret_cast<const hsperf::Prologue*>(mmap_addr_);
+  if (prologue->num_entries != parsed_num_entries_) {
+    PX_RETURN_IF_ERROR(ParseEntryIndex());
+  }
+
+  std::vector<Stats::Stat> stats;
+  stats.reserve(long_entries_.size());
+  for (const auto& [name, data] : long_entries_) {
+    stats.push_back({name, LEndianBytesToInt<uint64_t>(data)});
+  }
+  return Stats(std::move(stats));
+}
+
 StatusOr<std::filesystem::path> HsperfdataPath(pid_t pid) {
   ProcParser parser;
 
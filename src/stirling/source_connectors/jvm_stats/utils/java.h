@@ -19,6 +19,7 @@
 #pragma once
 
 #include <filesystem>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -64,6 +65,49 @@ class Stats {
   std::vector<Stat> stats_;
 };
 
+/**
+ * StatsReader keeps a persistent read-only mmap of a JVM's hsperfdata file, with the perf-data
+ * entry index parsed once. Each call to ReadStats() then only re-reads the counter values in
+ * place, since the JVM updates them through its own mapping of the same file. This avoids
+ * re-opening, re-reading and re-parsing the file on every sampling cycle.
+ */
+class StatsReader {
+ public:
+  /**
+   * Opens and maps the hsperfdata file at the given path, and parses the entry index.
+   */
+  static StatusOr<std::unique_ptr<StatsReader>> Create(
+      const std::filesystem::path& hsperf_data_path);
+
+  ~StatsReader();
+
+  StatsReader(const StatsReader&) = delete;
+  StatsReader& operator=(const StatsReader&) = delete;
+
+  /**
+   * Returns the current values of the long-typed counters. The entry index is re-parsed only
+   * when the JVM has added counters since the last read (e.g. during startup).
+   */
+  StatusOr<Stats> ReadStats();
+
+ private:
+  StatsReader(void* mmap_addr, size_t mmap_size);
+
+  Status ParseEntryIndex();
+
+  std::string_view DataView() const {
+    return std::string_view(static_cast<const char*>(mmap_addr_), mmap_size_);
+  }
+
+  void* mmap_addr_;
+  size_t mmap_size_;
+
+  // Number of entries in the file when the index was last parsed.
+  uint32_t parsed_num_entries_ = 0;
+  // Long-typed counter entries; name and data views point into the mapping.
+  std::vector<std::pair<std::string_view, std::string_view>> long_entries_;
+};
+
 /**
  * Returns the path of the hsperfdata for a JVM process.
  */
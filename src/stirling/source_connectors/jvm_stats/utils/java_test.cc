@@ -59,6 +59,27 @@ TEST(StatsTest, CommonValues) {
   EXPECT_EQ(2, stats.MaxHeapSizeBytes());
 }
 
+// Tests that the persistent reader returns the same values as parsing the file contents.
+TEST(StatsReaderTest, MatchesOneShotParse) {
+  const std::filesystem::path hsperf_data_path = testing::BazelRunfilePath(
+      "src/stirling/source_connectors/jvm_stats/utils/test_hsperfdata");
+
+  ASSERT_OK_AND_ASSIGN(const std::string content, ReadFileToString(hsperf_data_path));
+  Stats parsed_stats(content);
+  ASSERT_OK(parsed_stats.Parse());
+
+  ASSERT_OK_AND_ASSIGN(auto reader, StatsReader::Create(hsperf_data_path));
+  // Read twice: the second read reuses the entry index parsed by the first.
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK_AND_ASSIGN(Stats stats, reader->ReadStats());
+    EXPECT_EQ(parsed_stats.YoungGCTimeNanos(), stats.YoungGCTimeNanos());
+    EXPECT_EQ(parsed_stats.FullGCTimeNanos(), stats.FullGCTimeNanos());
+    EXPECT_EQ(parsed_stats.UsedHeapSizeBytes(), stats.UsedHeapSizeBytes());
+    EXPECT_EQ(parsed_stats.TotalHeapSizeBytes(), stats.TotalHeapSizeBytes());
+    EXPECT_EQ(parsed_stats.MaxHeapSizeBytes(), stats.MaxHeapSizeBytes());
+  }
+}
+
 TEST(HsperfdataPathTest, ResultIsAsExpected) {
   const std::string javaBinPath =
       testing::BazelRunfilePath("src/stirling/source_connectors/jvm_stats/testing/HelloWorld");
@@ -0,0 +1,99 @@
+/*
+ * This code runs using bpf in the Linux kernel.
+ * Copyright 2018- The Pixie Authors.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * SPDX-License-Identifier: GPL-2.0
+ */
+
+// LINT_C_FILE: Do not remove this line. It ensures cpplint treats this as a C file.
+
+#include <linux/netdevice.h>
+#include <linux/skbuff.h>
+
+#include "src/stirling/bpf_tools/bcc_bpf/utils.h"
+#include "src/stirling/source_connectors/network_stats/bcc_bpf_intf/network_stats.h"
+
+// Traffic counters keyed by network namespace inode number.
+// User space snapshots this map per sampling period, so the per-sample cost is proportional to
+// the number of namespaces (~pods), not to the packet rate.
+// Sized for nodes running hundreds of pods.
+BPF_HASH(netns_stats, uint32_t, struct netns_stats_t, 1024);
+
+// Returns the inode number of the network namespace that owns the skb's device, or 0 if it can't
+// be determined (e.g. the skb is not yet bound to a device).
+static uint32_t skb_netns_inum(struct sk_buff* skb) {
+  struct net_device* dev = NULL;
+  BPF_PROBE_READ_KERNEL_VAR(dev, &skb->dev);
+  if (dev == NULL) {
+    return 0;
+  }
+  struct net* net = NULL;
+  BPF_PROBE_READ_KERNEL_VAR(net, &dev->nd_net.net);
+  if (net == NULL) {
+    return 0;
+  }
+  uint32_t inum = 0;
+  BPF_PROBE_READ_KERNEL_VAR(inum, &net->ns.inum);
+  return inum;
+}
+
+static struct netns_stats_t* lookup_or_init_stats(uint32_t inum) {
+  struct netns_stats_t zero = {};
+  return netns_stats.lookup_or_try_init(&inum, &zero);
+}
+
+int probe_entry_netif_receive_skb(struct pt_regs* ctx, struct sk_buff* skb) {
+  uint32_t inum = skb_netns_inum(skb);
+  if (inum == 0) {
+    return 0;
+  }
+  uint32_t len = 0;
+  BPF_PROBE_READ_KERNEL_VAR(len, &skb->len);
+  struct netns_stats_t* stats = lookup_or_init_stats(inum);
+  if (stats != NULL) {
+    __sync_fetch_and_add(&stats->rx_bytes, len);
+    __sync_fetch_and_add(&stats->rx_packets, 1);
+  }
+  return 0;
+}
+
+int probe_entry_dev_queue_xmit(struct pt_regs* ctx, struct sk_buff* skb) {
+  uint32_t inum = skb_netns_inum(skb);
+  if (inum == 0) {
+    return 0;
+  }
+  uint32_t len = 0;
+  BPF_PROBE_READ_KERNEL_VAR(len, &skb->len);
+  struct netns_stats_t* stats = lookup_or_init_stats(inum);
+  if (stats != NULL) {
+    __sync_fetch_and_add(&stats->tx_bytes, len);
+    __sync_fetch_and_add(&stats->tx_packets, 1);
+  }
+  return 0;
+}
+
+int probe_entry_kfree_skb(struct pt_regs* ctx, struct sk_buff* skb) {
+  uint32_t inum = skb_netns_inum(skb);
+  if (inum == 0) {
+    return 0;
+  }
+  struct netns_stats_t* stats = lookup_or_init_stats(inum);
+  if (stats != NULL) {
+    __sync_fetch_and_add(&stats->drops, 1);
+  }
+  return 0;
+}
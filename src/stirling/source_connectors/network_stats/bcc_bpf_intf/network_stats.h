@@ -0,0 +1,33 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+// Per-network-namespace traffic counters, aggregated in-kernel.
+// All pods in a K8s pod sandbox share one network namespace, so user space maps each pod to its
+// namespace inode and reads one entry per pod.
+// Counters accumulate from the moment the probes attach (not from boot, unlike /proc/net/dev).
+struct netns_stats_t {
+  uint64_t rx_bytes;
+  uint64_t rx_packets;
+  uint64_t tx_bytes;
+  uint64_t tx_packets;
+  // Dropped skbs. The kernel's free hook doesn't attribute a direction, so drops are not split
+  // into rx/tx.
+  uint64_t drops;
+};
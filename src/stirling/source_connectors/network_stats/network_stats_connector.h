@@ -27,8 +27,10 @@
 #include "src/common/base/base.h"
 #include "src/common/system/system.h"
 #include "src/shared/metadata/metadata.h"
+#include "src/stirling/bpf_tools/bcc_wrapper.h"
 #include "src/stirling/core/canonical_types.h"
 #include "src/stirling/core/source_connector.h"
+#include "src/stirling/source_connectors/network_stats/bcc_bpf_intf/network_stats.h"
 #include "src/stirling/source_connectors/network_stats/network_stats_table.h"
 
 namespace px {
@@ -38,6 +40,9 @@ class NetworkStatsConnector : public SourceConnector {
  public:
   static constexpr std::string_view kName = "network_stats";
   static constexpr auto kSamplingPeriod = std::chrono::milliseconds{1000};
+  // Sampling period when the in-kernel aggregation is active: each sample is one map snapshot
+  // plus a hash lookup per pod, so sub-second resolution is affordable.
+  static constexpr auto kBPFSamplingPeriod = std::chrono::milliseconds{500};
   static constexpr auto kPushPeriod = std::chrono::milliseconds{1000};
   static constexpr auto kTables = MakeArray(kNetworkStatsTable);
   static constexpr uint32_t kNetStatsTableNum = TableNum(kTables, kNetworkStatsTable);
@@ -63,13 +68,28 @@ class NetworkStatsConnector : public SourceConnector {
 
  private:
   void TransferNetworkStatsTable(ConnectorContext* ctx, DataTable* data_table);
+  void TransferNetworkStatsTableBPF(ConnectorContext* ctx, DataTable* data_table);
+
+  // Deploys the in-kernel per-network-namespace traffic aggregation (enabled by
+  // --stirling_enable_bpf_network_stats). On success, TransferDataImpl snapshots the kernel map
+  // instead of reading /proc/<pid>/net/dev per pod.
+  Status InitBPFStats();
 
   static Status GetNetworkStatsForPod(const system::ProcParser& proc_parser,
                                       const md::PodInfo& pod_info,
                                       const md::K8sMetadataState& k8s_metadata_state,
                                       system::ProcParser::NetworkStats* stats);
 
+  // Returns the inode number of the pod's network namespace, determined from any live process in
+  // the pod (all containers of a pod share one network namespace).
+  static StatusOr<uint32_t> GetNetNamespaceForPod(const md::PodInfo& pod_info,
+                                                  const md::K8sMetadataState& k8s_metadata_state);
+
   std::unique_ptr<system::ProcParser> proc_parser_;
+
+  // Set only when the BPF path deployed successfully; otherwise the proc-based path is used.
+  std::unique_ptr<bpf_tools::BCCWrapper> bcc_;
+  std::unique_ptr<bpf_tools::WrappedBCCMap<uint32_t, struct netns_stats_t>> netns_stats_map_;
 };
 
 }  // namespace stirling
@@ -59,6 +59,19 @@ BPF_STACK_TRACE(stack_traces_b, CFG_STACK_TRACE_ENTRIES);
 // See comments in shared header file "stack_event.h".
 BPF_ARRAY(profiler_state, uint64_t, kProfilerStateVectorSize);
 
+// Per-process sampling policy, managed by user space. The key is a tgid; the value is a
+// sampling divisor that overrides the default divisor in profiler_state:
+//   0: do not sample this process,
+//   N: keep 1 of every N samples of this process.
+// Processes without an entry use the default divisor. This lets user space skip idle
+// processes or keep hot ones at full rate without redeploying the sampling probe.
+BPF_HASH(profiler_sampling_overrides, uint32_t, uint64_t, 1024);
+
+// Per-tgid sample counters used to implement the 1-of-N downsampling above.
+// Increments race across CPUs; as with the sample counts in profiler_state, an occasional
+// lost update only perturbs the downsampling phase, which is acceptable.
+BPF_HASH(profiler_sampling_counts, uint32_t, uint64_t, 1024);
+
 int sample_call_stack(struct bpf_perf_event_data* ctx) {
   int transfer_count_idx = kTransferCountIdx;
   int sample_count_a_idx = kSampleCountAIdx;
@@ -84,6 +97,38 @@ int sample_call_stack(struct bpf_perf_event_data* ctx) {
   key.upid.tgid = bpf_get_current_pid_tgid() >> 32;
   key.upid.start_time_ticks = get_tgid_start_time();
 
+  // Apply the sampling policy for this process: the per-tgid override if present,
+  // otherwise the default divisor from the shared state vector (0 or 1: no downsampling).
+  uint32_t tgid = key.upid.tgid;
+  int sample_divisor_idx = kSampleDivisorIdx;
+  uint64_t divisor = 1;
+
+  uint64_t* default_divisor_ptr = profiler_state.lookup(&sample_divisor_idx);
+  if (default_divisor_ptr != NULL && *default_divisor_ptr > 1) {
+    divisor = *default_divisor_ptr;
+  }
+
+  uint64_t* override_ptr = profiler_sampling_overrides.lookup(&tgid);
+  if (override_ptr != NULL) {
+    divisor = *override_ptr;
+  }
+
+  if (divisor == 0) {
+    // This process is excluded from sampling.
+    return 0;
+  }
+  if (divisor > 1) {
+    uint64_t kZero = 0;
+    uint64_t* count_ptr = profiler_sampling_counts.lookup_or_init(&tgid, &kZero);
+    if (count_ptr != NULL) {
+      *count_ptr += 1;
+      if (*count_ptr % divisor != 0) {
+        // Downsampled: keep only 1 of every `divisor` samples of this process.
+        return 0;
+      }
+    }
+  }
+
   uint64_t sample_count = 0;
 
   if (transfer_count % 2 == 0) {
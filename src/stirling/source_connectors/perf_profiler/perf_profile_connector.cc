@@ -21,17 +21,23 @@
 
 #include <sys/sysinfo.h>
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "src/shared/pprof/folded_stack_delta.h"
 #include "src/stirling/bpf_tools/macros.h"
 
 OBJ_STRVIEW(profiler_bcc_script, profiler);
 
 DEFINE_string(stirling_profiler_symbolizer, "bcc",
               "Choice of which symbolizer to use. Options: bcc, elf");
+DEFINE_bool(stirling_profiler_symbolize_async, true,
+            "Whether to symbolize stack traces on a background thread, so that draining the BPF "
+            "stack-trace tables is not extended by symbolization cost.");
 DEFINE_bool(stirling_profiler_cache_symbols, true, "Whether to cache symbols");
 DEFINE_uint32(stirling_profiler_log_period_minutes, 10,
               "Number of minutes between profiler stats log printouts.");
@@ -40,6 +46,10 @@ DEFINE_uint32(stirling_profiler_table_update_period_seconds,
               "Number of seconds between profiler table updates.");
 DEFINE_uint32(stirling_profiler_stack_trace_sample_period_ms, 11,
               "Number of milliseconds between stack trace samples.");
+DEFINE_bool(stirling_profiler_delta_encode_stack_traces, true,
+            "Whether to delta-encode the folded stack trace strings written to the stack_traces "
+            "table. Adjacent stack traces share long frame prefixes; encoding them shrinks the "
+            "profiler's table-store footprint. The pprof UDFs reconstruct the full strings.");
 
 // Scaling factor is sized to avoid hash table collisions and timing variations.
 DEFINE_double(stirling_profiler_stack_trace_size_factor, 3.0,
@@ -150,6 +160,11 @@ Status PerfProfileConnector::InitImpl() {
 
   profiler_state_ = WrappedBCCArrayTable<uint64_t>::Create(bcc_.get(), "profiler_state");
 
+  sampling_overrides_ =
+      bpf_tools::WrappedBCCMap<uint32_t, uint64_t>::Create(bcc_.get(), "profiler_sampling_overrides");
+  sampling_counts_ =
+      bpf_tools::WrappedBCCMap<uint32_t, uint64_t>::Create(bcc_.get(), "profiler_sampling_counts");
+
   LOG(INFO) << "PerfProfiler: Stack trace profiling sampling probe successfully deployed.";
 
   // Create a symbolizer for user symbols.
@@ -182,9 +197,14 @@ Status PerfProfileConnector::InitImpl() {
 }
 
 Status PerfProfileConnector::StopImpl() {
-  // Must call Close() after attach_uprobes_thread_ has joined,
-  // otherwise the two threads will cause concurrent accesses to BCC,
-  // that will cause races and undefined behavior.
+  // Symbolization of the final iteration may still be in flight; finish it and incorporate its
+  // records so they are not lost. This also guarantees the symbolization thread has joined
+  // before Close(), so that the two threads cannot cause concurrent accesses to BCC.
+  if (!data_tables_.empty() && data_tables_[0] != nullptr) {
+    HarvestSymbolizationResults(data_tables_[0]);
+  } else if (symbolization_thread_.joinable()) {
+    symbolization_thread_.join();
+  }
   bcc_->Close();
   return Status::OK();
 }
@@ -206,6 +226,52 @@ void PerfProfileConnector::HandleHistoLoss(void* cb_cookie, uint64_t lost) {
   connector->stats_.Increment(StatKey::kLossHistoEvent, lost);
 }
 
+void PerfProfileConnector::SetProfilerPIDSampling(int pid) {
+  absl::base_internal::SpinLockHolder lock(&sampling_policy_lock_);
+  pending_sampling_policy_updates_.push_back({SamplingPolicyUpdate::Type::kPIDOverride, pid});
+}
+
+void PerfProfileConnector::SetProfilerSampleDivisor(int divisor) {
+  absl::base_internal::SpinLockHolder lock(&sampling_policy_lock_);
+  pending_sampling_policy_updates_.push_back({SamplingPolicyUpdate::Type::kDefaultDivisor, divisor});
+}
+
+void PerfProfileConnector::ApplyPendingSamplingPolicyUpdates() {
+  std::vector<SamplingPolicyUpdate> updates;
+  {
+    absl::base_internal::SpinLockHolder lock(&sampling_policy_lock_);
+    updates.swap(pending_sampling_policy_updates_);
+  }
+
+  for (const auto& update : updates) {
+    switch (update.type) {
+      case SamplingPolicyUpdate::Type::kPIDOverride: {
+        const int pid = update.value;
+        if (pid > 0) {
+          // Full-rate sampling of this PID, regardless of the default divisor.
+          constexpr uint64_t kFullRate = 1;
+          PX_UNUSED(sampling_overrides_->SetValue(static_cast<uint32_t>(pid), kFullRate));
+          LOG(INFO) << absl::Substitute("PerfProfiler: full-rate sampling enabled for PID $0", pid);
+        } else if (pid < 0) {
+          constexpr uint64_t kSkip = 0;
+          PX_UNUSED(sampling_overrides_->SetValue(static_cast<uint32_t>(-pid), kSkip));
+          LOG(INFO) << absl::Substitute("PerfProfiler: sampling stopped for PID $0", -pid);
+        } else {
+          sampling_overrides_->GetTableOffline(/* clear_table */ true);
+          LOG(INFO) << "PerfProfiler: cleared all per-PID sampling overrides.";
+        }
+        break;
+      }
+      case SamplingPolicyUpdate::Type::kDefaultDivisor: {
+        const uint64_t divisor = update.value < 1 ? 1 : static_cast<uint64_t>(update.value);
+        PX_UNUSED(profiler_state_->SetValue(kSampleDivisorIdx, divisor));
+        LOG(INFO) << absl::Substitute("PerfProfiler: default sample divisor set to $0", divisor);
+        break;
+      }
+    }
+  }
+}
+
 void PerfProfileConnector::CleanupSymbolizers(const absl::flat_hash_set<md::UPID>& deleted_upids) {
   for (const auto& md_upid : deleted_upids) {
     // Clean-up caches.
@@ -213,6 +279,10 @@ void PerfProfileConnector::CleanupSymbolizers(const absl::flat_hash_set<md::UPID
     upid.pid = md_upid.pid();
     upid.start_time_ticks = md_upid.start_ts();
     u_symbolizer_->DeleteUPID(upid);
+
+    // Drop any sampling-policy state for the exited process.
+    PX_UNUSED(sampling_overrides_->RemoveValue(md_upid.pid()));
+    PX_UNUSED(sampling_counts_->RemoveValue(md_upid.pid()));
   }
 
   if (FLAGS_stirling_profiler_cache_symbols) {
@@ -227,110 +297,144 @@ void PerfProfileConnector::CleanupSymbolizers(const absl::flat_hash_set<md::UPID
   }
 }
 
-PerfProfileConnector::StackTraceHisto PerfProfileConnector::AggregateStackTraces(
+std::unique_ptr<PerfProfileConnector::SymbolizationTask> PerfProfileConnector::ExtractRawStacks(
     ConnectorContext* ctx, WrappedBCCStackTable* stack_traces) {
-  // TODO(jps): switch from using get_table_offline() to directly stepping through
-  // the histogram data structure. Inline populating our own data structures with this.
-  // Avoid an unnecessary copy of the information in local stack_trace_keys_and_counts.
-  StackTraceHisto symbolic_histogram;
-  uint64_t cum_sum_count = 0;
-
-  const uint32_t asid = ctx->GetASID();
-
-  // Cause symbolizers to perform any necessary updates before we put them to work.
-  u_symbolizer_->IterationPreTick();
-  k_symbolizer_->IterationPreTick();
-
-  // Create a new stringifier for this iteration of the continuous perf profiler.
-  Stringifier stringifier(u_symbolizer_.get(), k_symbolizer_.get(), stack_traces);
+  auto task = std::make_unique<SymbolizationTask>();
+  task->timestamp_ns = AdjustedSteadyClockNowNS();
+  task->asid = ctx->GetASID();
+  task->cum_sum_count = raw_histo_data_.size();
 
   absl::flat_hash_set<int> k_stack_ids_to_remove;
 
   for (const auto& stack_trace_key : raw_histo_data_) {
-    std::string stack_trace_str;
-
-    const md::UPID upid(asid, stack_trace_key.upid.pid, stack_trace_key.upid.start_time_ticks);
+    const md::UPID upid(task->asid, stack_trace_key.upid.pid,
+                        stack_trace_key.upid.start_time_ticks);
 
     if (ctx->UPIDIsInContext(upid)) {
-      // The stringifier clears stack-ids out of the stack traces table when it
-      // first encounters them. If a stack-id is reused by a different stack-trace-key,
-      // the stringifier returns its memoized stack trace string. Because the stack-ids
-      // are not stable across profiler iterations, we create and destroy a stringifer
-      // on each profiler iteration.
-      stack_trace_str = stringifier.FoldedStackTraceString(stack_trace_key);
+      // Read the raw address stacks out of the BPF table now; symbolization happens later,
+      // off this thread. The read is destructive, which also clears the entry from the table.
+      // Stack-ids are commonly reused across stack-trace-keys (e.g. the same kernel stack
+      // observed from multiple user stacks), so each id is fetched only once.
+      for (const int stack_id : {stack_trace_key.user_stack_id, stack_trace_key.kernel_stack_id}) {
+        if (stack_id >= 0 && !task->stack_addrs.contains(stack_id)) {
+          constexpr bool kClearStackId = true;
+          task->stack_addrs[stack_id] = stack_traces->GetStackAddr(stack_id, kClearStackId);
+        }
+      }
+      task->keys.push_back(stack_trace_key);
     } else {
-      // If we do not stringifiy this stack trace, we still need to clear
+      // If we do not symbolize this stack trace, we still need to clear
       // its entry from the stack traces table. It is safe to do so immediately
       // for the user stack-id, but we need to allow the kernel stack-id to remain
       // in the stack-traces table in case it gets used by a stack trace that we
       // have not yet encountered on this iteration, but will need to symbolize.
-      if (stack_trace_key.user_stack_id >= 0) {
+      if (stack_trace_key.user_stack_id >= 0 &&
+          !task->stack_addrs.contains(stack_trace_key.user_stack_id)) {
         stack_traces->ClearStackID(stack_trace_key.user_stack_id);
       }
       if (stack_trace_key.kernel_stack_id >= 0) {
         k_stack_ids_to_remove.insert(stack_trace_key.kernel_stack_id);
       }
-      stack_trace_str = std::string(profiler::kNotSymbolizedMessage);
+      ++task->histogram[{upid, std::string(profiler::kNotSymbolizedMessage)}];
     }
-
-    profiler::SymbolicStackTrace symbolic_stack_trace = {upid, std::move(stack_trace_str)};
-
-    ++symbolic_histogram[symbolic_stack_trace];
-    ++cum_sum_count;
-
-    // TODO(jps): If we see a perf. issue with having two maps keyed by symbolic-stack-trace,
-    // refactor such that creating/finding symoblic-stack-trace-id and count aggregation
-    // are both done here, in AggregateStackTraces().
-    // One possible implementation:
-    // make the histogram a map from "symbolic-track-trace" => "count & stack-trace-id"
-    // e.g.:
-    // ... auto& count_and_id = symbolic_histogram[symbolic_stack_trace];
-    // ... count_and_id.id = id;
-    // ... count_and_id.count += count;
-    // alternate impl. is a map from "stack-trace-id" => "count & symbolic-stack-trace"
   }
 
   // Clear any kernel stack-ids, that were potentially not already cleared,
   // out of the stack traces table.
   for (const int k_stack_id : k_stack_ids_to_remove) {
-    stack_traces->ClearStackID(k_stack_id);
+    if (!task->stack_addrs.contains(k_stack_id)) {
+      stack_traces->ClearStackID(k_stack_id);
+    }
   }
 
   raw_histo_data_.clear();
-
-  VLOG(1) << "PerfProfileConnector::AggregateStackTraces(): cum_sum_count: " << cum_sum_count;
-  stats_.Increment(StatKey::kCumulativeSumOfAllStackTraces, cum_sum_count);
-  return symbolic_histogram;
+  return task;
 }
 
-void PerfProfileConnector::CreateRecords(WrappedBCCStackTable* stack_traces, ConnectorContext* ctx,
-                                         DataTable* data_table) {
-  constexpr size_t kMaxSymbolSize = 512;
-  constexpr size_t kMaxStackDepth = 64;
-  constexpr size_t kMaxStackTraceSize = kMaxStackDepth * kMaxSymbolSize;
-
-  const uint64_t timestamp_ns = AdjustedSteadyClockNowNS();
+void PerfProfileConnector::SymbolizeTask(SymbolizationTask* task) {
+  // Cause symbolizers to perform any necessary updates before we put them to work.
+  u_symbolizer_->IterationPreTick();
+  k_symbolizer_->IterationPreTick();
 
   // Stack traces from kernel/BPF are ordered lists of instruction pointers (addresses).
-  // AggregateStackTraces() will collapse some of those into identical symbolic stack traces;
+  // Symbolization will collapse some of those into identical symbolic stack traces;
   // for example, consider the following two stack traces from BPF:
   // p0, p1, p2 => main;qux;baz   # both p2 & p3 point into baz.
   // p0, p1, p3 => main;qux;baz
 
-  StackTraceHisto stack_trace_histogram = AggregateStackTraces(ctx, stack_traces);
+  // The stringifier memoizes its results by stack-id, in case a stack-id is reused by a
+  // different stack-trace-key. Because the stack-ids are not stable across profiler
+  // iterations, we create and destroy a stringifier on each profiler iteration.
+  Stringifier stringifier(u_symbolizer_.get(), k_symbolizer_.get(), &task->stack_addrs);
+
+  for (const auto& stack_trace_key : task->keys) {
+    const md::UPID upid(task->asid, stack_trace_key.upid.pid,
+                        stack_trace_key.upid.start_time_ticks);
+
+    profiler::SymbolicStackTrace symbolic_stack_trace = {
+        upid, stringifier.FoldedStackTraceString(stack_trace_key)};
+    ++task->histogram[symbolic_stack_trace];
+  }
+
+  VLOG(1) << "PerfProfileConnector::SymbolizeTask(): cum_sum_count: " << task->cum_sum_count;
+}
+
+void PerfProfileConnector::HarvestSymbolizationResults(DataTable* data_table) {
+  if (symbolization_thread_.joinable()) {
+    symbolization_thread_.join();
+  }
+  if (symbolization_task_ == nullptr) {
+    return;
+  }
+  const std::unique_ptr<SymbolizationTask> task = std::move(symbolization_task_);
+
+  stats_.Increment(StatKey::kCumulativeSumOfAllStackTraces, task->cum_sum_count);
+
+  constexpr size_t kMaxSymbolSize = 512;
+  constexpr size_t kMaxStackDepth = 64;
+  constexpr size_t kMaxStackTraceSize = kMaxStackDepth * kMaxSymbolSize;
 
   constexpr auto age_tick_period = std::chrono::minutes(5);
   if (sampling_freq_mgr_.count() % (age_tick_period / sampling_period_) == 0) {
     stack_trace_ids_.AgeTick();
   }
 
-  for (const auto& [key, count] : stack_trace_histogram) {
-    DataTable::RecordBuilder<&kStackTraceTable> r(data_table, timestamp_ns);
+  // Emit rows sorted by (upid, stack trace): lexicographically adjacent stack traces share long
+  // frame prefixes, which the delta encoding below replaces with a frame count. The pprof UDFs
+  // reconstruct the full folded strings at query time. All rows in this batch share one
+  // timestamp, so a time-range predicate keeps or drops each delta chain whole; the chain is
+  // restarted per upid so that upid-level predicates do the same.
+  std::vector<const std::pair<const profiler::SymbolicStackTrace, uint64_t>*> sorted_histo;
+  sorted_histo.reserve(task->histogram.size());
+  for (const auto& entry : task->histogram) {
+    sorted_histo.push_back(&entry);
+  }
+  std::sort(sorted_histo.begin(), sorted_histo.end(), [](const auto* a, const auto* b) {
+    if (a->first.upid != b->first.upid) {
+      return a->first.upid < b->first.upid;
+    }
+    return a->first.stack_trace_str < b->first.stack_trace_str;
+  });
+
+  const bool delta_encode = FLAGS_stirling_profiler_delta_encode_stack_traces;
+  shared::FoldedStackDeltaEncoder encoder;
+  std::optional<md::UPID> prev_upid;
+
+  for (const auto* entry : sorted_histo) {
+    const auto& [key, count] = *entry;
+    if (prev_upid != key.upid) {
+      encoder.Reset();
+      prev_upid = key.upid;
+    }
+    const std::string stack_trace_str =
+        delta_encode ? encoder.Encode(key.stack_trace_str) : key.stack_trace_str;
+
+    DataTable::RecordBuilder<&kStackTraceTable> r(data_table, task->timestamp_ns);
 
-    r.Append<r.ColIndex("time_")>(timestamp_ns);
+    r.Append<r.ColIndex("time_")>(task->timestamp_ns);
     r.Append<r.ColIndex("upid")>(key.upid.value());
     r.Append<r.ColIndex("stack_trace_id")>(stack_trace_ids_.Lookup(key));
-    r.Append<r.ColIndex("stack_trace")>(key.stack_trace_str, kMaxStackTraceSize);
+    r.Append<r.ColIndex("stack_trace")>(stack_trace_str, kMaxStackTraceSize);
     r.Append<r.ColIndex("count")>(count);
   }
 }
@@ -353,8 +457,22 @@ void PerfProfileConnector::ProcessBPFStackTraces(ConnectorContext* ctx, DataTabl
   const auto s = profiler_state_->SetValue(kTransferCountIdx, transfer_count_);
   LOG_IF(ERROR, !s.ok()) << "Error writing transfer_count_";
 
-  // Read BPF stack traces & histogram, build records, incorporate records to data table.
-  CreateRecords(stack_traces.get(), ctx, data_table);
+  // Read the raw address stacks out of BPF. This is the only part of the drain path whose
+  // cost grows with the data; it does not depend on symbolizer cost.
+  std::unique_ptr<SymbolizationTask> task = ExtractRawStacks(ctx, stack_traces.get());
+
+  if (FLAGS_stirling_profiler_symbolize_async) {
+    // Symbolize on a background thread; the records are incorporated into the data table on
+    // the next iteration (or on Stop), keeping this drain path fast even when symbolization
+    // is expensive (e.g. JIT-heavy Java pods).
+    symbolization_task_ = std::move(task);
+    symbolization_thread_ =
+        std::thread(&PerfProfileConnector::SymbolizeTask, this, symbolization_task_.get());
+  } else {
+    SymbolizeTask(task.get());
+    symbolization_task_ = std::move(task);
+    HarvestSymbolizationResults(data_table);
+  }
 
   const uint64_t num_stack_traces_sampled = profiler_state_->GetValue(sample_count_idx).ValueOr(0);
   CheckProfilerState(num_stack_traces_sampled);
@@ -410,17 +528,27 @@ void PerfProfileConnector::TransferDataImpl(ConnectorContext* ctx) {
     return;
   }
 
-  ProcessBPFStackTraces(ctx, data_table);
+  // Incorporate the records symbolized in the background since the previous iteration.
+  // The join inside is expected to be instantaneous: the symbolization thread has had a full
+  // sampling period to complete.
+  HarvestSymbolizationResults(data_table);
 
-  // Cleanup the symbolizer so we don't leak memory.
+  // Cleanup the symbolizer so we don't leak memory. This must happen while the symbolization
+  // thread is idle, i.e. after the harvest above and before the next task is launched.
   proc_tracker_.Update(ctx->GetUPIDs());
   CleanupSymbolizers(proc_tracker_.deleted_upids());
 
-  stats_.Increment(StatKey::kBPFMapSwitchoverEvent, 1);
-
   if (sampling_freq_mgr_.count() % stats_log_interval_ == 0) {
     PrintStats();
   }
+
+  // Apply any sampling-policy changes queued by the signal handler path. This is done on the
+  // Stirling thread (and while the symbolization thread is idle) because BCC is not thread-safe.
+  ApplyPendingSamplingPolicyUpdates();
+
+  ProcessBPFStackTraces(ctx, data_table);
+
+  stats_.Increment(StatKey::kBPFMapSwitchoverEvent, 1);
 }
 
 void PerfProfileConnector::PrintStats() const {
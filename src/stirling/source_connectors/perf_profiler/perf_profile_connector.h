@@ -20,9 +20,12 @@
 
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include <absl/base/internal/spinlock.h>
+
 #include "src/common/metrics/metrics.h"
 #include "src/shared/types/types.h"
 #include "src/stirling/bpf_tools/bcc_wrapper.h"
@@ -59,10 +62,22 @@ class PerfProfileConnector : public BCCSourceConnector {
     return std::unique_ptr<PerfProfileConnector>(new PerfProfileConnector(name));
   }
 
+  ~PerfProfileConnector() override {
+    if (symbolization_thread_.joinable()) {
+      symbolization_thread_.join();
+    }
+  }
+
   Status InitImpl() override;
   Status StopImpl() override;
   void TransferDataImpl(ConnectorContext* ctx) override;
 
+  // Sampling-policy controls, invoked from the user signal handler path in stirling.cc.
+  // The updates are queued here, and applied to the BPF sampling-policy maps on the Stirling
+  // thread at the top of the next TransferData iteration, since BCC is not thread-safe.
+  void SetProfilerPIDSampling(int pid) override;
+  void SetProfilerSampleDivisor(int divisor) override;
+
   std::chrono::milliseconds SamplingPeriod() const { return sampling_period_; }
   std::chrono::milliseconds StackTraceSamplingPeriod() const {
     return stack_trace_sampling_period_;
@@ -94,16 +109,48 @@ class PerfProfileConnector : public BCCSourceConnector {
 
   explicit PerfProfileConnector(std::string_view source_name);
 
+  // A unit of work for the symbolization thread: the raw address stacks extracted from the BPF
+  // stack-traces table, plus the symbolized histogram that the thread produces from them.
+  struct SymbolizationTask {
+    uint64_t timestamp_ns = 0;
+    uint32_t asid = 0;
+    // Stack-trace keys (in the connector context at extraction time) to be symbolized.
+    std::vector<stack_trace_key_t> keys;
+    // Raw address stacks, keyed by BPF stack-id, read destructively out of the BPF table.
+    absl::flat_hash_map<int, std::vector<uintptr_t>> stack_addrs;
+    // Produced by SymbolizeTask().
+    StackTraceHisto histogram;
+    uint64_t cum_sum_count = 0;
+  };
+
   void ProcessBPFStackTraces(ConnectorContext* ctx, DataTable* data_table);
 
-  // Read BPF data structures, build & incorporate records to the table.
-  void CreateRecords(WrappedBCCStackTable* stack_traces, ConnectorContext* ctx,
-                     DataTable* data_table);
+  // Read the raw address stacks referenced by this iteration's samples out of the BPF
+  // stack-traces table. The cost is bounded by the sample count; it is independent of
+  // symbolizer cost.
+  std::unique_ptr<SymbolizationTask> ExtractRawStacks(ConnectorContext* ctx,
+                                                      WrappedBCCStackTable* stack_traces);
+
+  // Symbolize the raw address stacks in the task and aggregate them into its histogram.
+  // Runs on symbolization_thread_ (or inline if async symbolization is disabled).
+  void SymbolizeTask(SymbolizationTask* task);
 
-  StackTraceHisto AggregateStackTraces(ConnectorContext* ctx, WrappedBCCStackTable* stack_traces);
+  // Join the symbolization thread (if running) and incorporate the completed task's
+  // histogram into the data table.
+  void HarvestSymbolizationResults(DataTable* data_table);
 
   void CleanupSymbolizers(const absl::flat_hash_set<md::UPID>& deleted_upids);
 
+  // A queued sampling-policy change, to be applied to the BPF maps on the Stirling thread.
+  struct SamplingPolicyUpdate {
+    enum class Type { kPIDOverride, kDefaultDivisor };
+    Type type;
+    int value;
+  };
+
+  // Applies any queued sampling-policy updates to the BPF sampling-policy maps.
+  void ApplyPendingSamplingPolicyUpdates();
+
   void PrintStats() const;
   void CheckProfilerState(const uint64_t num_stack_traces);
 
@@ -112,6 +159,17 @@ class PerfProfileConnector : public BCCSourceConnector {
   std::unique_ptr<WrappedBCCStackTable> stack_traces_b_;
 
   std::unique_ptr<WrappedBCCArrayTable<uint64_t>> profiler_state_;
+
+  // Per-process sampling policy shared with BPF: overrides are written here and read on the
+  // BPF side; the counts implement the 1-of-N downsampling and are cleaned up as processes
+  // terminate.
+  std::unique_ptr<bpf_tools::WrappedBCCMap<uint32_t, uint64_t>> sampling_overrides_;
+  std::unique_ptr<bpf_tools::WrappedBCCMap<uint32_t, uint64_t>> sampling_counts_;
+
+  // Sampling-policy updates queued by the signal handler path, drained on the Stirling thread.
+  absl::base_internal::SpinLock sampling_policy_lock_;
+  std::vector<SamplingPolicyUpdate> pending_sampling_policy_updates_
+      ABSL_GUARDED_BY(sampling_policy_lock_);
   prometheus::Gauge& profiler_state_overflow_gauge_;
   prometheus::Counter& profiler_transfer_data_counter_;
   prometheus::Counter& profiler_state_overflow_counter_;
@@ -129,6 +187,11 @@ class PerfProfileConnector : public BCCSourceConnector {
   // The raw histogram from BPF; it is populated on each iteration by a call to PollPerfBuffer().
   RawHistoData raw_histo_data_;
 
+  // The task currently owned by (or awaiting) the symbolization thread, and the thread itself.
+  // The Stirling thread only touches the task after joining the thread.
+  std::unique_ptr<SymbolizationTask> symbolization_task_;
+  std::thread symbolization_thread_;
+
   // For converting stack trace addresses to symbols.
   std::unique_ptr<Symbolizer> k_symbolizer_;
   std::unique_ptr<Symbolizer> u_symbolizer_;
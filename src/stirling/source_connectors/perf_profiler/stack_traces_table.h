@@ -38,7 +38,8 @@ static constexpr DataElement kElements[] = {
     {"stack_trace",
      "A stack trace within the sampled process, in folded format. "
      "The call stack symbols are separated by semicolons. "
-     "If symbols cannot be resolved, addresses are populated instead.",
+     "If symbols cannot be resolved, addresses are populated instead. "
+     "May be delta-encoded against the previous row; the pprof UDFs reconstruct the full string.",
      types::DataType::STRING, types::SemanticType::ST_NONE, types::PatternType::GENERAL},
     {"count",
      "Number of times the stack trace has been sampled.",
@@ -31,7 +31,17 @@ namespace stirling {
 
 Stringifier::Stringifier(Symbolizer* u_symbolizer, Symbolizer* k_symbolizer,
                          WrappedBCCStackTable* stack_traces)
-    : u_symbolizer_(u_symbolizer), k_symbolizer_(k_symbolizer), stack_traces_(stack_traces) {}
+    : u_symbolizer_(u_symbolizer),
+      k_symbolizer_(k_symbolizer),
+      stack_traces_(stack_traces),
+      stack_addrs_(nullptr) {}
+
+Stringifier::Stringifier(Symbolizer* u_symbolizer, Symbolizer* k_symbolizer,
+                         const absl::flat_hash_map<int, std::vector<uintptr_t>>* stack_addrs)
+    : u_symbolizer_(u_symbolizer),
+      k_symbolizer_(k_symbolizer),
+      stack_traces_(nullptr),
+      stack_addrs_(stack_addrs) {}
 
 std::string Stringifier::BuildStackTraceString(const std::vector<uintptr_t>& addrs,
                                                profiler::SymbolizerFn symbolize_fn,
@@ -88,12 +98,21 @@ std::string Stringifier::FindOrBuildStackTraceString(const int stack_id,
   // if no memoized result is available, build the folded stack trace string.
   auto [iter, inserted] = stack_trace_strs_.try_emplace(stack_id, "");
   if (inserted) {
-    // Clear the stack-traces map as we go along here; this has lower overhead
-    // compared to first reading the stack-traces map, then using clear_table_non_atomic().
-    constexpr bool kClearStackId = true;
-
-    // Get the stack trace (as a vector of addresses) from the shared BPF stack trace table.
-    const std::vector<uintptr_t> addrs = stack_traces_->GetStackAddr(stack_id, kClearStackId);
+    std::vector<uintptr_t> addrs;
+    if (stack_traces_ != nullptr) {
+      // Clear the stack-traces map as we go along here; this has lower overhead
+      // compared to first reading the stack-traces map, then using clear_table_non_atomic().
+      constexpr bool kClearStackId = true;
+
+      // Get the stack trace (as a vector of addresses) from the shared BPF stack trace table.
+      addrs = stack_traces_->GetStackAddr(stack_id, kClearStackId);
+    } else {
+      // The address stacks were extracted from the BPF table (and cleared) ahead of time.
+      auto addrs_iter = stack_addrs_->find(stack_id);
+      if (addrs_iter != stack_addrs_->end()) {
+        addrs = addrs_iter->second;
+      }
+    }
     VLOG_IF(1, addrs.empty()) << absl::Substitute("[empty_stack_trace] stack_id: $0", stack_id);
 
     iter->second = BuildStackTraceString(addrs, symbolize_fn, prefix);
@@ -21,6 +21,8 @@
 #include <string>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
+
 #include "src/stirling/bpf_tools/bcc_wrapper.h"
 #include "src/stirling/source_connectors/perf_profiler/bcc_bpf_intf/stack_event.h"
 #include "src/stirling/source_connectors/perf_profiler/symbolizers/symbolizer.h"
@@ -64,6 +66,18 @@ class Stringifier {
   Stringifier(Symbolizer* u_symbolizer, Symbolizer* k_symbolizer,
               WrappedBCCStackTable* stack_traces);
 
+  /**
+   * Construct a stack trace stringifier that reads raw address stacks from pre-extracted
+   * per-stack-id vectors instead of the live BPF table. Used by the asynchronous symbolization
+   * path, where BPF map reads stay on the Stirling thread.
+   *
+   * @param u_symbolizer A symbolizer for user-space addresses.
+   * @param k_symbolizer A symbolizer for kernel-space addresses.
+   * @param stack_addrs Raw address stacks, keyed by BPF stack-id.
+   */
+  Stringifier(Symbolizer* u_symbolizer, Symbolizer* k_symbolizer,
+              const absl::flat_hash_map<int, std::vector<uintptr_t>>* stack_addrs);
+
   // Returns a folded stack trace string based on the stack trace histogram key.
   // The key contains both a user & kernel stack-trace-id, which are subsequently
   // passed into FindOrBuildStackTraceString().
@@ -89,7 +103,10 @@ class Stringifier {
   // a destructive read, i.e. such that the BPF stack trace table does not need
   // to be explicitly cleared (by re-iterating the histogram) after an iteration
   // of the continuous perf. profiler is completed.
+  // Exactly one of stack_traces_ & stack_addrs_ is set; when symbolizing asynchronously, the
+  // address stacks have already been read (and cleared) out of the BPF table.
   WrappedBCCStackTable* const stack_traces_;
+  const absl::flat_hash_map<int, std::vector<uintptr_t>>* const stack_addrs_;
 };
 
 }  // namespace stirling
@@ -16,7 +16,11 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include <absl/functional/bind_front.h>
@@ -25,9 +29,18 @@
 #include "src/common/system/proc_pid_path.h"
 #include "src/stirling/obj_tools/address_converter.h"
 #include "src/stirling/obj_tools/elf_reader.h"
+#include "src/stirling/obj_tools/reader_registry.h"
 #include "src/stirling/source_connectors/perf_profiler/symbolizers/elf_symbolizer.h"
 #include "src/stirling/utils/proc_path_tools.h"
 
+DEFINE_string(stirling_profiler_symbol_index_path,
+              gflags::StringFromEnv("PX_STIRLING_PROFILER_SYMBOL_INDEX_PATH", ""),
+              "If set, directory in which profiler symbol indexes are persisted, one file per "
+              "binary keyed by GNU build-id. Restarts and new processes running previously-seen "
+              "images then load the sorted index directly instead of re-reading and demangling "
+              "the ELF symbol table. Point this at persistent storage (e.g. the PEM's data dir) "
+              "for it to survive restarts.");
+
 using ::px::stirling::obj_tools::ElfReader;
 using ::px::system::ProcPidRootPath;
 
@@ -42,20 +55,196 @@ StatusOr<std::unique_ptr<Symbolizer>> ElfSymbolizer::Create() {
 
 void ElfSymbolizer::DeleteUPID(const struct upid_t& upid) { symbolizers_.erase(upid); }
 
-StatusOr<std::unique_ptr<ElfSymbolizer::SymbolizerWithConverter>> CreateUPIDSymbolizer(
-    const struct upid_t& upid) {
+StatusOr<std::unique_ptr<ElfSymbolizer::SymbolizerWithConverter>>
+ElfSymbolizer::CreateUPIDSymbolizer(const struct upid_t& upid) {
   const pid_t pid = upid.pid;
   const system::ProcParser proc_parser;
   PX_ASSIGN_OR_RETURN(const auto proc_exe, proc_parser.GetExePath(pid));
-  PX_ASSIGN_OR_RETURN(auto elf_reader, ElfReader::Create(ProcPidRootPath(pid, proc_exe.string())));
+  PX_ASSIGN_OR_RETURN(auto elf_reader, obj_tools::ReaderRegistry::GetInstance()->GetElfReader(
+                                           ProcPidRootPath(pid, proc_exe.string()).string()));
+
+  // Reuse the symbol index of any binary with the same build-id that we have already indexed:
+  // replicas of the same container image would otherwise each rebuild an identical index.
+  // Binaries without a build-id get a private index.
+  const std::string build_id = elf_reader->BuildID().ConsumeValueOr("");
+  std::shared_ptr<ElfReader::Symbolizer> symbolizer;
+  if (!build_id.empty()) {
+    auto iter = symbolizers_by_build_id_.find(build_id);
+    if (iter != symbolizers_by_build_id_.end()) {
+      symbolizer = iter->second;
+    } else {
+      // A previous run of Stirling may have persisted an index for this image.
+      symbolizer = LoadSymbolIndexFromDisk(build_id);
+    }
+  }
+  if (symbolizer == nullptr) {
+    PX_ASSIGN_OR_RETURN(std::unique_ptr<ElfReader::Symbolizer> new_symbolizer,
+                        elf_reader->GetSymbolizer());
+    symbolizer = std::move(new_symbolizer);
+    if (!build_id.empty()) {
+      SaveSymbolIndexToDisk(build_id, *symbolizer);
+    }
+  }
+  if (!build_id.empty() && !symbolizers_by_build_id_.contains(build_id)) {
+    if (symbolizers_by_build_id_.size() >= kMaxSharedSymbolIndexes) {
+      PruneSharedSymbolIndexes();
+    }
+    symbolizers_by_build_id_[build_id] = symbolizer;
+  }
 
-  PX_ASSIGN_OR_RETURN(auto symbolizer, elf_reader->GetSymbolizer());
   PX_ASSIGN_OR_RETURN(auto converter,
                       obj_tools::ElfAddressConverter::Create(elf_reader.get(), pid));
   return std::make_unique<ElfSymbolizer::SymbolizerWithConverter>(std::move(symbolizer),
                                                                   std::move(converter));
 }
 
+namespace {
+
+// On-disk format of a persisted symbol index (--stirling_profiler_symbol_index_path).
+// A versioned header followed by one record per symbol, in ascending address order, so a
+// reloaded index reconstructs the sorted structure without touching the ELF binary.
+// Any mismatch or corruption invalidates the file, which is then rebuilt from the binary.
+constexpr char kSymbolIndexMagic[4] = {'P', 'X', 'S', 'I'};
+constexpr uint32_t kSymbolIndexVersion = 1;
+
+struct SymbolIndexHeader {
+  char magic[4];
+  uint32_t version;
+  uint64_t num_entries;
+};
+
+std::filesystem::path SymbolIndexPath(const std::string& build_id) {
+  return std::filesystem::path(FLAGS_stirling_profiler_symbol_index_path) /
+         absl::StrCat(build_id, ".symindex");
+}
+
+}  // namespace
+
+std::shared_ptr<ElfReader::Symbolizer> ElfSymbolizer::LoadSymbolIndexFromDisk(
+    const std::string& build_id) {
+  if (FLAGS_stirling_profiler_symbol_index_path.empty()) {
+    return nullptr;
+  }
+
+  const std::filesystem::path path = SymbolIndexPath(build_id);
+  std::ifstream f(path, std::ios::binary);
+  if (!f) {
+    return nullptr;
+  }
+
+  SymbolIndexHeader header = {};
+  f.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!f || memcmp(header.magic, kSymbolIndexMagic, sizeof(kSymbolIndexMagic)) != 0 ||
+      header.version != kSymbolIndexVersion) {
+    LOG(WARNING) << absl::Substitute("Ignoring incompatible profiler symbol index at $0",
+                                     path.string());
+    return nullptr;
+  }
+
+  auto symbolizer = std::make_shared<ElfReader::Symbolizer>();
+  for (uint64_t i = 0; i < header.num_entries; ++i) {
+    uint64_t addr = 0;
+    uint64_t size = 0;
+    uint32_t name_len = 0;
+    f.read(reinterpret_cast<char*>(&addr), sizeof(addr));
+    f.read(reinterpret_cast<char*>(&size), sizeof(size));
+    f.read(reinterpret_cast<char*>(&name_len), sizeof(name_len));
+
+    // Demangled C++ names can be long, but anything beyond this indicates a corrupt file.
+    constexpr uint32_t kMaxSymbolNameLen = 1 << 16;
+    if (!f || name_len > kMaxSymbolNameLen) {
+      LOG(WARNING) << absl::Substitute("Ignoring corrupt profiler symbol index at $0",
+                                       path.string());
+      return nullptr;
+    }
+
+    std::string name(name_len, '\0');
+    f.read(name.data(), name_len);
+    if (!f) {
+      LOG(WARNING) << absl::Substitute("Ignoring corrupt profiler symbol index at $0",
+                                       path.string());
+      return nullptr;
+    }
+
+    symbolizer->AddEntry(addr, size, std::move(name));
+  }
+
+  VLOG(1) << absl::Substitute("Loaded $0 symbols for build-id $1 from $2", symbolizer->size(),
+                              build_id, path.string());
+  return symbolizer;
+}
+
+void ElfSymbolizer::SaveSymbolIndexToDisk(const std::string& build_id,
+                                          const ElfReader::Symbolizer& symbolizer) {
+  if (FLAGS_stirling_profiler_symbol_index_path.empty()) {
+    return;
+  }
+
+  const std::filesystem::path path = SymbolIndexPath(build_id);
+
+  std::error_code ec;
+  std::filesystem::create_directories(path.parent_path(), ec);
+  if (ec) {
+    LOG(WARNING) << absl::Substitute("Could not create profiler symbol index dir $0: $1",
+                                     path.parent_path().string(), ec.message());
+    return;
+  }
+
+  // Write to a temporary file and rename into place, so a crash mid-write cannot leave a
+  // truncated index behind.
+  const std::string tmp_path = absl::StrCat(path.string(), ".tmp");
+  {
+    std::ofstream f(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!f) {
+      LOG(WARNING) << absl::Substitute("Could not write profiler symbol index to $0", tmp_path);
+      return;
+    }
+
+    SymbolIndexHeader header = {};
+    memcpy(header.magic, kSymbolIndexMagic, sizeof(header.magic));
+    header.version = kSymbolIndexVersion;
+    header.num_entries = symbolizer.size();
+    f.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    symbolizer.ForEachEntry([&f](uintptr_t addr, size_t size, std::string_view name) {
+      const uint64_t addr64 = addr;
+      const uint64_t size64 = size;
+      const uint32_t name_len = name.size();
+      f.write(reinterpret_cast<const char*>(&addr64), sizeof(addr64));
+      f.write(reinterpret_cast<const char*>(&size64), sizeof(size64));
+      f.write(reinterpret_cast<const char*>(&name_len), sizeof(name_len));
+      f.write(name.data(), name.size());
+    });
+
+    if (!f) {
+      LOG(WARNING) << absl::Substitute("Could not write profiler symbol index to $0", tmp_path);
+      return;
+    }
+  }
+
+  std::filesystem::rename(tmp_path, path, ec);
+  if (ec) {
+    LOG(WARNING) << absl::Substitute("Could not move profiler symbol index into place at $0: $1",
+                                     path.string(), ec.message());
+    return;
+  }
+
+  VLOG(1) << absl::Substitute("Saved $0 symbols for build-id $1 to $2", symbolizer.size(),
+                              build_id, path.string());
+}
+
+void ElfSymbolizer::PruneSharedSymbolIndexes() {
+  auto iter = symbolizers_by_build_id_.begin();
+  while (iter != symbolizers_by_build_id_.end()) {
+    // A use count of 1 means only the cache itself still references the index.
+    if (iter->second.use_count() == 1) {
+      symbolizers_by_build_id_.erase(iter++);
+    } else {
+      ++iter;
+    }
+  }
+}
+
 std::string_view EmptySymbolizerFn(const uintptr_t addr) {
   static std::string symbol;
   symbol = absl::StrFormat("0x%016llx", addr);
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "src/stirling/obj_tools/address_converter.h"
@@ -41,21 +42,47 @@ class ElfSymbolizer : public Symbolizer, public NotCopyMoveable {
 
   class SymbolizerWithConverter {
    public:
-    SymbolizerWithConverter(std::unique_ptr<obj_tools::ElfReader::Symbolizer> symbolizer,
+    SymbolizerWithConverter(std::shared_ptr<obj_tools::ElfReader::Symbolizer> symbolizer,
                             std::unique_ptr<obj_tools::ElfAddressConverter> converter)
         : symbolizer_(std::move(symbolizer)), converter_(std::move(converter)) {}
     std::string_view Lookup(uintptr_t addr) const;
 
    private:
-    std::unique_ptr<obj_tools::ElfReader::Symbolizer> symbolizer_;
+    // The symbol index is shared across all UPIDs running a binary with the same build-id.
+    std::shared_ptr<obj_tools::ElfReader::Symbolizer> symbolizer_;
+    // The address-space mapping is the only truly per-process state.
     std::unique_ptr<obj_tools::ElfAddressConverter> converter_;
   };
 
+  size_t num_shared_symbol_indexes() const { return symbolizers_by_build_id_.size(); }
+
+  // Cap on build-id-keyed symbol indexes. When reached, entries no longer referenced by any
+  // live UPID are pruned.
+  static constexpr size_t kMaxSharedSymbolIndexes = 128;
+
  private:
   ElfSymbolizer() = default;
 
+  StatusOr<std::unique_ptr<SymbolizerWithConverter>> CreateUPIDSymbolizer(
+      const struct upid_t& upid);
+  void PruneSharedSymbolIndexes();
+
+  // Persistent on-disk symbol index (--stirling_profiler_symbol_index_path), one file per
+  // build-id. LoadSymbolIndexFromDisk returns nullptr if the feature is disabled or no valid
+  // index exists for the build-id.
+  std::shared_ptr<obj_tools::ElfReader::Symbolizer> LoadSymbolIndexFromDisk(
+      const std::string& build_id);
+  void SaveSymbolIndexToDisk(const std::string& build_id,
+                             const obj_tools::ElfReader::Symbolizer& symbolizer);
+
   // A symbolizer per UPID.
   absl::flat_hash_map<struct upid_t, std::unique_ptr<SymbolizerWithConverter>> symbolizers_;
+
+  // Symbol indexes shared across processes, keyed by the binary's GNU build-id. Entries outlive
+  // the processes that created them, so replicas and restarts of the same container image reuse
+  // one index instead of each rebuilding it from the ELF binary.
+  absl::flat_hash_map<std::string, std::shared_ptr<obj_tools::ElfReader::Symbolizer>>
+      symbolizers_by_build_id_;
 };
 
 }  // namespace stirling
@@ -16,6 +16,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <iterator>
 #include <string>
 
 #include <absl/functional/bind_front.h>
@@ -172,11 +173,35 @@ void JavaSymbolizationContext::UpdateSymbolMap() {
 
     // TODO(jps): Change to uint32_t in java::RawSymbolUpdate.
     const uint32_t code_size = static_cast<uint32_t>(update.code_size);
+
+    // The JIT reuses code cache regions as methods are recompiled or freed without always
+    // emitting a method_unload for every prior occupant. Compact any entries that overlap the
+    // new code range out of the map; they are dead, and (if left in place) a stale entry
+    // starting below update.addr could shadow the new symbol at lookup time.
+    RemoveOverlappingEntries(update.addr, code_size);
     symbol_map_.try_emplace(update.addr, demangled, code_size);
   }
   DCHECK(symbol_file_->good());
 }
 
+void JavaSymbolizationContext::RemoveOverlappingEntries(const uint64_t addr, const uint32_t size) {
+  const uint64_t addr_upper = addr + size;
+
+  // The only entry that can start below addr and still overlap is the one immediately below.
+  auto iter = symbol_map_.upper_bound(addr);
+  if (iter != symbol_map_.begin()) {
+    auto prev = std::prev(iter);
+    if (prev->first + prev->second.size > addr) {
+      iter = prev;
+    }
+  }
+
+  // Erase it, and every entry that starts inside [addr, addr_upper).
+  while (iter != symbol_map_.end() && iter->first < addr_upper) {
+    iter = symbol_map_.erase(iter);
+  }
+}
+
 JavaSymbolizationContext::JavaSymbolizationContext(const struct upid_t& target_upid,
                                                    profiler::SymbolizerFn native_symbolizer_fn,
                                                    std::unique_ptr<std::ifstream> symbol_file)
@@ -58,6 +58,10 @@ class JavaSymbolizationContext {
  private:
   void UpdateSymbolMap();
 
+  // Erase map entries whose code ranges overlap [addr, addr+size). Called before inserting a
+  // new entry: the JIT has reused that code region, so any overlapping entries are dead.
+  void RemoveOverlappingEntries(uint64_t addr, uint32_t size);
+
   bool requires_refresh_ = false;
   SymbolMapType symbol_map_;
   profiler::SymbolizerFn native_symbolizer_fn_;
@@ -20,6 +20,7 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
 #include <set>
 
 #include "src/common/exec/subprocess.h"
@@ -39,6 +40,8 @@
 
 DEFINE_string(java_image_name, "none", "Java docker image for test cases.");
 
+DECLARE_string(stirling_profiler_symbol_index_path);
+
 namespace test {
 // foo() & bar() are not used directly, but in this test,
 // we will find their symbols using the device under test, the symbolizer.
@@ -82,6 +85,56 @@ TYPED_TEST(SymbolizerTest, UserSymbols) {
   EXPECT_EQ(symbolize(kBarAddr), "test::bar()");
 }
 
+TEST_F(ElfSymbolizerTest, SymbolIndexSharedByBuildID) {
+  // Two UPIDs for the same binary (here: ourself, under two different start times) should share
+  // one build-id-keyed symbol index.
+  const struct upid_t upid_a = {{static_cast<uint32_t>(getpid())}, 0};
+  const struct upid_t upid_b = {{static_cast<uint32_t>(getpid())}, 1};
+
+  auto symbolize_a = symbolizer_->GetSymbolizerFn(upid_a);
+  auto symbolize_b = symbolizer_->GetSymbolizerFn(upid_b);
+  EXPECT_EQ(symbolize_a(kFooAddr), "test::foo()");
+  EXPECT_EQ(symbolize_b(kFooAddr), "test::foo()");
+
+  auto* elf_symbolizer = static_cast<ElfSymbolizer*>(symbolizer_.get());
+  if (elf_symbolizer->num_shared_symbol_indexes() == 0) {
+    GTEST_SKIP() << "Test binary was linked without a GNU build-id; sharing not applicable.";
+  }
+  EXPECT_EQ(elf_symbolizer->num_shared_symbol_indexes(), 1);
+
+  // The shared index outlives the processes, so a restarted pod reuses it.
+  symbolizer_->DeleteUPID(upid_a);
+  symbolizer_->DeleteUPID(upid_b);
+  EXPECT_EQ(elf_symbolizer->num_shared_symbol_indexes(), 1);
+}
+
+TEST_F(ElfSymbolizerTest, PersistentSymbolIndex) {
+  ::px::testing::TempDir index_dir;
+  PX_SET_FOR_SCOPE(FLAGS_stirling_profiler_symbol_index_path, index_dir.path().string());
+
+  const struct upid_t this_upid = {{static_cast<uint32_t>(getpid())}, 0};
+
+  // The first symbolizer builds the index from the ELF binary and persists it to disk.
+  auto symbolize = symbolizer_->GetSymbolizerFn(this_upid);
+  EXPECT_EQ(symbolize(kFooAddr), "test::foo()");
+
+  size_t num_index_files = 0;
+  for (const auto& entry : std::filesystem::directory_iterator(index_dir.path())) {
+    num_index_files += (entry.path().extension() == ".symindex");
+  }
+  if (num_index_files == 0) {
+    GTEST_SKIP() << "Test binary was linked without a GNU build-id; persistence not applicable.";
+  }
+  EXPECT_EQ(num_index_files, 1);
+
+  // A fresh symbolizer (empty in-memory cache, as after a restart) must load the persisted
+  // index and resolve the same symbols.
+  ASSERT_OK_AND_ASSIGN(std::unique_ptr<Symbolizer> restarted, ElfSymbolizer::Create());
+  auto symbolize2 = restarted->GetSymbolizerFn(this_upid);
+  EXPECT_EQ(symbolize2(kFooAddr), "test::foo()");
+  EXPECT_EQ(symbolize2(kBarAddr), "test::bar()");
+}
+
 TEST_F(BCCSymbolizerTest, KernelSymbols) {
   ASSERT_OK_AND_ASSIGN(std::unique_ptr<Symbolizer> symbolizer, BCCSymbolizer::Create());
 
@@ -33,6 +33,7 @@ using px::system::ProcPath;
 // Using data from /proc/stat
 Status ProcStatConnector::InitImpl() {
   sampling_freq_mgr_.set_period(kSamplingPeriod);
+  sampling_freq_mgr_.set_adaptive(true);
   push_freq_mgr_.set_period(kPushPeriod);
   const auto proc_stat_path = ProcPath("stat");
   std::ifstream input_file(proc_stat_path);
@@ -27,13 +27,52 @@
 #include "src/common/system/proc_parser.h"
 #include "src/shared/metadata/metadata.h"
 
+DEFINE_bool(stirling_process_stats_diff_emission,
+            gflags::BoolFromEnv("PL_STIRLING_PROCESS_STATS_DIFF_EMISSION", false),
+            "If true, the process_stats source only emits a row for a process when its counters "
+            "moved beyond thresholds since the last emitted row, plus a periodic keyframe row. "
+            "This suppresses the per-sample rows of idle processes.");
+
+DEFINE_int32(stirling_process_stats_keyframe_period,
+             gflags::Int32FromEnv("PL_STIRLING_PROCESS_STATS_KEYFRAME_PERIOD", 60),
+             "With --stirling_process_stats_diff_emission, emit a row for every live process at "
+             "least once every this many sample periods, even if its counters are unchanged, so "
+             "time-windowed queries always see a recent row per process.");
+
+DEFINE_int64(stirling_process_stats_min_cpu_delta_ns,
+             gflags::Int64FromEnv("PL_STIRLING_PROCESS_STATS_MIN_CPU_DELTA_NS", 1000 * 1000),
+             "With --stirling_process_stats_diff_emission, the minimum CPU time accumulated since "
+             "the last emitted row for the CPU counters alone to trigger a new row. Filters the "
+             "occasional scheduler tick of an otherwise idle process.");
+
 namespace px {
 namespace stirling {
 
 using system::ProcParser;
 
+namespace {
+
+// Returns whether stats moved enough relative to the last emitted row to be worth a new row.
+// Fault, I/O and memory counters emit on any movement; CPU time uses a small threshold so an
+// idle process's occasional tick doesn't defeat suppression.
+bool StatsChangedBeyondThreshold(const ProcParser::ProcessStats& prev,
+                                 const ProcParser::ProcessStats& cur) {
+  if (cur.major_faults != prev.major_faults || cur.minor_faults != prev.minor_faults ||
+      cur.num_threads != prev.num_threads || cur.vsize_bytes != prev.vsize_bytes ||
+      cur.rss_bytes != prev.rss_bytes || cur.rchar_bytes != prev.rchar_bytes ||
+      cur.wchar_bytes != prev.wchar_bytes || cur.read_bytes != prev.read_bytes ||
+      cur.write_bytes != prev.write_bytes) {
+    return true;
+  }
+  int64_t cpu_delta_ns = (cur.utime_ns - prev.utime_ns) + (cur.ktime_ns - prev.ktime_ns);
+  return cpu_delta_ns >= FLAGS_stirling_process_stats_min_cpu_delta_ns;
+}
+
+}  // namespace
+
 Status ProcessStatsConnector::InitImpl() {
   sampling_freq_mgr_.set_period(kSamplingPeriod);
+  sampling_freq_mgr_.set_adaptive(true);
   push_freq_mgr_.set_period(kPushPeriod);
   return Status::OK();
 }
@@ -46,6 +85,9 @@ void ProcessStatsConnector::TransferProcessStatsTable(ConnectorContext* ctx,
 
   int64_t timestamp = AdjustedSteadyClockNowNS();
 
+  absl::flat_hash_set<int32_t> live_pids;
+  live_pids.reserve(pid_info_by_upid.size());
+
   for (const auto& [upid, pid_info] : pid_info_by_upid) {
     // TODO(zasgar): Fix condition for dead pids after helper function is added.
     if (pid_info == nullptr || pid_info->stop_time_ns() > 0) {
@@ -55,22 +97,30 @@ void ProcessStatsConnector::TransferProcessStatsTable(ConnectorContext* ctx,
 
     ProcParser::ProcessStats stats;
     int32_t pid = upid.pid();
+    live_pids.insert(pid);
     // TODO(zasgar): We should double check the process start time to make sure it still the same
     // PID.
-    auto s1 =
-        proc_parser_->ParseProcPIDStat(pid, system::Config::GetInstance().PageSizeBytes(),
-                                       system::Config::GetInstance().KernelTickTimeNS(), &stats);
-    if (!s1.ok()) {
+    auto s = proc_stats_reader_.ReadPIDStats(pid, &stats);
+    if (!s.ok()) {
       VLOG(1) << absl::Substitute(
-          "Failed to fetch cpu stat info for PID ($0). Error=\"$1\" skipping.", pid, s1.msg());
+          "Failed to fetch proc stats for PID ($0). Error=\"$1\" skipping.", pid, s.msg());
       continue;
     }
 
-    auto s2 = proc_parser_->ParseProcPIDStatIO(pid, &stats);
-    if (!s2.ok()) {
-      VLOG(1) << absl::Substitute(
-          "Failed to fetch IO stat info for PID ($0). Error=\"$1\" skipping.", pid, s2.msg());
-      continue;
+    if (FLAGS_stirling_process_stats_diff_emission) {
+      auto [it, inserted] = last_emitted_stats_.try_emplace(upid);
+      auto& last_emitted = it->second;
+      if (!inserted) {
+        // A new process always gets a keyframe; existing processes emit on movement or when the
+        // keyframe period expires.
+        ++last_emitted.samples_since_emit;
+        if (last_emitted.samples_since_emit < FLAGS_stirling_process_stats_keyframe_period &&
+            !StatsChangedBeyondThreshold(last_emitted.stats, stats)) {
+          continue;
+        }
+      }
+      last_emitted.stats = stats;
+      last_emitted.samples_since_emit = 0;
     }
 
     DataTable::RecordBuilder<&kProcessStatsTable> r(data_table, timestamp);
@@ -92,6 +142,18 @@ void ProcessStatsConnector::TransferProcessStatsTable(ConnectorContext* ctx,
     r.Append<r.ColIndex("read_bytes")>(stats.read_bytes);
     r.Append<r.ColIndex("write_bytes")>(stats.write_bytes);
   }
+
+  // Drop cached fds for processes that are gone, so we don't leak descriptors.
+  proc_stats_reader_.RetainPIDs(live_pids);
+
+  // Drop diff-emission state for processes that are gone.
+  for (auto it = last_emitted_stats_.begin(); it != last_emitted_stats_.end();) {
+    if (!live_pids.contains(it->first.pid())) {
+      last_emitted_stats_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
 }
 
 void ProcessStatsConnector::TransferDataImpl(ConnectorContext* ctx) {
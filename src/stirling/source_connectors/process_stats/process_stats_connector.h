@@ -24,7 +24,10 @@
 #include <utility>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
+
 #include "src/common/base/base.h"
+#include "src/common/system/proc_parser.h"
 #include "src/common/system/system.h"
 #include "src/shared/metadata/metadata.h"
 #include "src/stirling/core/canonical_types.h"
@@ -57,14 +60,23 @@ class ProcessStatsConnector : public SourceConnector {
 
  protected:
   explicit ProcessStatsConnector(std::string_view source_name)
-      : SourceConnector(source_name, kTables) {
-    proc_parser_ = std::make_unique<system::ProcParser>();
-  }
+      : SourceConnector(source_name, kTables),
+        proc_stats_reader_(system::Config::GetInstance().PageSizeBytes(),
+                           system::Config::GetInstance().KernelTickTimeNS()) {}
 
  private:
   void TransferProcessStatsTable(ConnectorContext* ctx, DataTable* data_table);
 
-  std::unique_ptr<system::ProcParser> proc_parser_;
+  // Reads per-PID stat/io files once per cycle, with fds kept open across cycles.
+  system::BatchedProcStatsReader proc_stats_reader_;
+
+  // Diff-emission state (--stirling_process_stats_diff_emission): the stats of the last emitted
+  // row per process, and how many sample periods ago it was emitted.
+  struct LastEmitted {
+    system::ProcParser::ProcessStats stats;
+    int32_t samples_since_emit = 0;
+  };
+  absl::flat_hash_map<md::UPID, LastEmitted> last_emitted_stats_;
 };
 
 }  // namespace stirling
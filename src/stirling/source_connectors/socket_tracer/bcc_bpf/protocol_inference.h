@@ -744,3 +744,105 @@ static __inline struct protocol_message_t infer_protocol(const char* buf, size_t
 
   return inferred_message;
 }
+
+// Runs only the matcher of the hinted protocol, as a fast path ahead of the full chain in
+// infer_protocol(). The hint comes from the connection's existing classification or from the
+// user-space-populated protocol_hint_port_map, so on established endpoints a single matcher
+// replaces the whole PROTOCOL_LIST scan. On a match, this performs the same conn_info
+// bookkeeping as infer_protocol(); on a miss, conn_info->prev_* is left untouched so that the
+// full chain still sees the correct previous-buffer state.
+static __inline struct protocol_message_t infer_protocol_hinted(enum traffic_protocol_t hint,
+                                                                const char* buf, size_t count,
+                                                                struct conn_info_t* conn_info) {
+  struct protocol_message_t inferred_message;
+  inferred_message.protocol = kProtocolUnknown;
+  inferred_message.type = kUnknown;
+
+  conn_info->prepend_length_header = false;
+
+  // PROTOCOL_LIST: Requires update on new protocols.
+  switch (hint) {
+    case kProtocolHTTP:
+      if (ENABLE_HTTP_TRACING &&
+          (inferred_message.type = infer_http_message(buf, count)) != kUnknown) {
+        inferred_message.protocol = kProtocolHTTP;
+      }
+      break;
+    case kProtocolCQL:
+      if (ENABLE_CQL_TRACING &&
+          (inferred_message.type = infer_cql_message(buf, count)) != kUnknown) {
+        inferred_message.protocol = kProtocolCQL;
+      }
+      break;
+    case kProtocolMongo:
+      if (ENABLE_MONGO_TRACING &&
+          (inferred_message.type = infer_mongo_message(buf, count)) != kUnknown) {
+        inferred_message.protocol = kProtocolMongo;
+      }
+      break;
+    case kProtocolPGSQL:
+      if (ENABLE_PGSQL_TRACING &&
+          (inferred_message.type = infer_pgsql_message(buf, count)) != kUnknown) {
+        inferred_message.protocol = kProtocolPGSQL;
+      }
+      break;
+    case kProtocolMySQL:
+      if (ENABLE_MYSQL_TRACING &&
+          (inferred_message.type = infer_mysql_message(buf, count, conn_info)) != kUnknown) {
+        inferred_message.protocol = kProtocolMySQL;
+      }
+      break;
+    case kProtocolMux:
+      if (ENABLE_MUX_TRACING &&
+          (inferred_message.type = infer_mux_message(buf, count)) != kUnknown) {
+        inferred_message.protocol = kProtocolMux;
+      }
+      break;
+    case kProtocolKafka:
+      if (ENABLE_KAFKA_TRACING &&
+          (inferred_message.type = infer_kafka_message(buf, count, conn_info)) != kUnknown) {
+        inferred_message.protocol = kProtocolKafka;
+      }
+      break;
+    case kProtocolDNS:
+      if (ENABLE_DNS_TRACING &&
+          (inferred_message.type = infer_dns_message(buf, count)) != kUnknown) {
+        inferred_message.protocol = kProtocolDNS;
+      }
+      break;
+    case kProtocolAMQP:
+      if (ENABLE_AMQP_TRACING &&
+          (inferred_message.type = infer_amqp_message(buf, count)) != kUnknown) {
+        inferred_message.protocol = kProtocolAMQP;
+      }
+      break;
+    case kProtocolRedis:
+      // For Redis, the message type is left to be kUnknown, as in infer_protocol().
+      if (ENABLE_REDIS_TRACING && is_redis_message(buf, count)) {
+        inferred_message.protocol = kProtocolRedis;
+      }
+      break;
+    case kProtocolNATS:
+      if (ENABLE_NATS_TRACING &&
+          (inferred_message.type = infer_nats_message(buf, count)) != kUnknown) {
+        inferred_message.protocol = kProtocolNATS;
+      }
+      break;
+    default:
+      break;
+  }
+
+  if (inferred_message.protocol == kProtocolUnknown) {
+    return inferred_message;
+  }
+
+  conn_info->prev_count = count;
+  if (count == 4) {
+    conn_info->prev_buf[0] = buf[0];
+    conn_info->prev_buf[1] = buf[1];
+    conn_info->prev_buf[2] = buf[2];
+    conn_info->prev_buf[3] = buf[3];
+  }
+
+  return inferred_message;
+}
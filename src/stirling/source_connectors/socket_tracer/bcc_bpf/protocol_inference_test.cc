@@ -482,3 +482,29 @@ TEST(ProtocolInferenceTest, AMQPResponse) {
   EXPECT_EQ(protocol_message.protocol, kProtocolAMQP);
   EXPECT_EQ(protocol_message.type, kResponse);
 }
+
+TEST(ProtocolInferenceTest, HintedFastPath) {
+  constexpr char kGet[] =
+      "GET /endpoint1 HTTP/1.1\r\n"
+      "User-Agent: Mozilla/5.0\r\n"
+      "\r\n";
+
+  // The hinted matcher classifies matching traffic without running the full chain.
+  {
+    struct conn_info_t conn_info = {};
+    auto protocol_message = infer_protocol_hinted(kProtocolHTTP, kGet, sizeof(kGet), &conn_info);
+    EXPECT_EQ(kProtocolHTTP, protocol_message.protocol);
+    EXPECT_EQ(kRequest, protocol_message.type);
+    EXPECT_EQ(sizeof(kGet), conn_info.prev_count);
+  }
+
+  // A wrong hint misses, and leaves prev_count untouched for the full chain to use.
+  {
+    struct conn_info_t conn_info = {};
+    conn_info.prev_count = 5;
+    auto protocol_message = infer_protocol_hinted(kProtocolMySQL, kGet, sizeof(kGet), &conn_info);
+    EXPECT_EQ(kProtocolUnknown, protocol_message.protocol);
+    EXPECT_EQ(kUnknown, protocol_message.type);
+    EXPECT_EQ(5U, conn_info.prev_count);
+  }
+}
@@ -40,10 +40,6 @@
 
 const int32_t kInvalidFD = -1;
 
-// This is the amount of activity required on a connection before a new ConnStats event
-// is reported to user-space. It applies to read and write traffic combined.
-const int kConnStatsDataThreshold = 65536;
-
 // This is the perf buffer for BPF program to export data from kernel to user space.
 BPF_PERF_OUTPUT(socket_data_events);
 BPF_PERF_OUTPUT(socket_control_events);
@@ -123,6 +119,20 @@ BPF_PERCPU_ARRAY(conn_stats_event_buffer_heap, struct conn_stats_event_t, 1);
 // number of arrays with only 1 element.
 BPF_PERCPU_ARRAY(control_values, int64_t, kNumControlValues);
 
+// CIDR filter entries, matched against the remote address of each connection.
+// Unused entries have `enabled` set to 0. This map is only written from user-space.
+BPF_ARRAY(filter_cidr_map, struct filter_cidr_t, MAX_FILTER_CIDRS);
+
+// Port filter entries, keyed by the remote endpoint's port in host byte order.
+// The value is an enum filter_action_t. This map is only written from user-space.
+BPF_HASH(filter_port_map, uint16_t, uint64_t, 1024);
+
+// Protocol hints, keyed by the remote endpoint's port in host byte order.
+// The value is an enum traffic_protocol_t. Entries are installed from user-space, seeded from
+// --stirling_protocol_inference_port_hints and extended with protocols observed on previous
+// connections to the same server port. This map is only written from user-space.
+BPF_HASH(protocol_hint_port_map, uint16_t, uint64_t, MAX_PROTOCOL_HINT_PORTS);
+
 /***********************************************************
  * General helper functions
  ***********************************************************/
@@ -266,6 +276,85 @@ static __inline bool should_trace_protocol_data(const struct conn_info_t* conn_i
   return control & conn_info->role;
 }
 
+static __inline bool control_value_is_set(int idx) {
+  int64_t* val = control_values.lookup(&idx);
+  return val != NULL && *val != 0;
+}
+
+static __inline enum filter_action_t filter_action_for_addr(const uint32_t* addr32) {
+  bool matched_allow = false;
+#pragma unroll
+  for (int i = 0; i < MAX_FILTER_CIDRS; i++) {
+    int key = i;
+    struct filter_cidr_t* cidr = filter_cidr_map.lookup(&key);
+    if (cidr == NULL || !cidr->enabled) {
+      continue;
+    }
+    bool match = true;
+#pragma unroll
+    for (int j = 0; j < 4; j++) {
+      if ((addr32[j] & cidr->mask[j]) != cidr->prefix[j]) {
+        match = false;
+      }
+    }
+    if (!match) {
+      continue;
+    }
+    // A deny match always wins, so an allow match must not short-circuit later deny entries.
+    if (cidr->action == kFilterActionDeny) {
+      return kFilterActionDeny;
+    }
+    matched_allow = true;
+  }
+  if (matched_allow) {
+    return kFilterActionAllow;
+  }
+  return control_value_is_set(kCIDRFilterDefaultDenyIndex) ? kFilterActionDeny
+                                                           : kFilterActionAllow;
+}
+
+static __inline enum filter_action_t filter_action_for_port(uint16_t port) {
+  uint64_t* action = filter_port_map.lookup(&port);
+  if (action != NULL) {
+    return (enum filter_action_t)*action;
+  }
+  return control_value_is_set(kPortFilterDefaultDenyIndex) ? kFilterActionDeny
+                                                           : kFilterActionAllow;
+}
+
+// Evaluates the CIDR and port filters against the connection's remote endpoint.
+// The verdict is cached in conn_info, so the filters are evaluated at most once per connection.
+// Connections whose remote address is unknown are never denied, since they *may* be of interest
+// (same reasoning as should_trace_sockaddr_family()).
+static __inline bool endpoint_filters_deny(struct conn_info_t* conn_info) {
+  if (conn_info->filter_verdict == kFilterVerdictUnknown) {
+    sa_family_t family = conn_info->addr.sa.sa_family;
+    uint32_t addr32[4] = {};
+    uint16_t port = 0;
+    if (family == AF_INET) {
+      // Map to the IPv4-mapped IPv6 form used by the filter entries (::ffff:a.b.c.d).
+      addr32[2] = bpf_htonl(0x0000ffff);
+      addr32[3] = conn_info->addr.in4.sin_addr.s_addr;
+      port = bpf_ntohs(conn_info->addr.in4.sin_port);
+    } else if (family == AF_INET6) {
+      addr32[0] = conn_info->addr.in6.sin6_addr.s6_addr32[0];
+      addr32[1] = conn_info->addr.in6.sin6_addr.s6_addr32[1];
+      addr32[2] = conn_info->addr.in6.sin6_addr.s6_addr32[2];
+      addr32[3] = conn_info->addr.in6.sin6_addr.s6_addr32[3];
+      port = bpf_ntohs(conn_info->addr.in6.sin6_port);
+    } else {
+      return false;
+    }
+    if (filter_action_for_addr(addr32) == kFilterActionDeny ||
+        filter_action_for_port(port) == kFilterActionDeny) {
+      conn_info->filter_verdict = kFilterVerdictDeny;
+    } else {
+      conn_info->filter_verdict = kFilterVerdictAllow;
+    }
+  }
+  return conn_info->filter_verdict == kFilterVerdictDeny;
+}
+
 static __inline bool is_stirling_tgid(const uint32_t tgid) {
   int idx = kStirlingTGIDIndex;
   int64_t* stirling_tgid = control_values.lookup(&idx);
@@ -300,6 +389,18 @@ static __inline enum target_tgid_match_result_t match_trace_tgid(const uint32_t
   return TARGET_TGID_UNMATCHED;
 }
 
+// Returns the connection's remote port in host byte order, or 0 if the remote address is not
+// (yet) known.
+static __inline uint16_t remote_endpoint_port(const struct conn_info_t* conn_info) {
+  if (conn_info->addr.sa.sa_family == AF_INET) {
+    return bpf_ntohs(conn_info->addr.in4.sin_port);
+  }
+  if (conn_info->addr.sa.sa_family == AF_INET6) {
+    return bpf_ntohs(conn_info->addr.in6.sin6_port);
+  }
+  return 0;
+}
+
 static __inline void update_traffic_class(struct conn_info_t* conn_info,
                                           enum traffic_direction_t direction, const char* buf,
                                           size_t count) {
@@ -308,8 +409,30 @@ static __inline void update_traffic_class(struct conn_info_t* conn_info,
   }
   conn_info->protocol_total_count += 1;
 
-  // Try to infer connection type (protocol) based on data.
-  struct protocol_message_t inferred_protocol = infer_protocol(buf, count, conn_info);
+  // Fast path: an already-classified connection only needs its own protocol's matcher (to find
+  // message starts for role classification and the HTTP capture budget), and an endpoint with a
+  // user-space-installed hint tries the hinted matcher first. The full inference chain is
+  // reserved for unknown endpoints, and for buffers the hinted matcher misses.
+  enum traffic_protocol_t hint = conn_info->protocol;
+  if (hint == kProtocolUnknown) {
+    uint16_t port = remote_endpoint_port(conn_info);
+    if (port != 0) {
+      uint64_t* hint_value = protocol_hint_port_map.lookup(&port);
+      if (hint_value != NULL) {
+        hint = (enum traffic_protocol_t)*hint_value;
+      }
+    }
+  }
+
+  struct protocol_message_t inferred_protocol;
+  inferred_protocol.protocol = kProtocolUnknown;
+  inferred_protocol.type = kUnknown;
+  if (hint != kProtocolUnknown) {
+    inferred_protocol = infer_protocol_hinted(hint, buf, count, conn_info);
+  }
+  if (inferred_protocol.protocol == kProtocolUnknown) {
+    inferred_protocol = infer_protocol(buf, count, conn_info);
+  }
 
   // Could not infer the traffic.
   if (inferred_protocol.protocol == kProtocolUnknown || conn_info->protocol == kProtocolMongo) {
@@ -321,6 +444,17 @@ static __inline void update_traffic_class(struct conn_info_t* conn_info,
     conn_info->protocol = inferred_protocol.protocol;
   }
 
+  // Each buffer that begins a new HTTP message re-arms the capture budget for its direction.
+  // perf_submit_wrapper() stops submitting a message's data once the budget is spent, so large
+  // bodies don't cost perf-buffer bandwidth beyond what user space retains.
+  if (HTTP_CAPTURE_LIMIT_BYTES >= 0 && inferred_protocol.protocol == kProtocolHTTP) {
+    if (direction == kEgress) {
+      conn_info->wr_http_capture_remaining = HTTP_CAPTURE_LIMIT_BYTES;
+    } else {
+      conn_info->rd_http_capture_remaining = HTTP_CAPTURE_LIMIT_BYTES;
+    }
+  }
+
   // Update role if not set.
   if (conn_info->role == kRoleUnknown &&
       // As of 2020-01, Redis protocol detection doesn't implement message type detection.
@@ -494,12 +628,34 @@ static __inline void perf_submit_wrapper(struct pt_regs* ctx,
   int bytes_sent = 0;
   unsigned int i;
 
+  // For HTTP connections, cap submissions to the per-message capture budget that
+  // update_traffic_class() re-arms at each message head. Chunks beyond the budget are not
+  // submitted at all; since event positions are derived from the connection byte counters,
+  // user space still sees the unsubmitted bytes (as data loss), keeping the stream positions
+  // consistent. Capping is at chunk granularity, so up to one extra chunk may be submitted.
+  int64_t allowed = buf_size;
+  if (HTTP_CAPTURE_LIMIT_BYTES >= 0 && conn_info->protocol == kProtocolHTTP) {
+    allowed = (direction == kEgress) ? conn_info->wr_http_capture_remaining
+                                     : conn_info->rd_http_capture_remaining;
+    if (allowed < 0) {
+      allowed = 0;
+    }
+    const int64_t new_remaining = (allowed > (int64_t)buf_size) ? allowed - (int64_t)buf_size : 0;
+    if (direction == kEgress) {
+      conn_info->wr_http_capture_remaining = new_remaining;
+    } else {
+      conn_info->rd_http_capture_remaining = new_remaining;
+    }
+  }
+
 #pragma unroll
   for (i = 0; i < CHUNK_LIMIT; ++i) {
     const int bytes_remaining = buf_size - bytes_sent;
     const size_t current_size =
         (bytes_remaining > MAX_MSG_SIZE && (i != CHUNK_LIMIT - 1)) ? MAX_MSG_SIZE : bytes_remaining;
-    perf_submit_buf(ctx, direction, buf + bytes_sent, current_size, conn_info, event);
+    if (bytes_sent < allowed) {
+      perf_submit_buf(ctx, direction, buf + bytes_sent, current_size, conn_info, event);
+    }
     bytes_sent += current_size;
 
     // Move the position for the next event.
@@ -695,13 +851,24 @@ static __inline bool should_send_data(uint32_t tgid, uint64_t conn_disabled_tsid
     return false;
   }
 
+  // Never trace connections whose remote endpoint is denied by the configured endpoint filters.
+  // Note that conn open/close control events still flow to user-space, since they are low-volume
+  // and the ConnTracker life-cycle (including BPF map clean-up) depends on them.
+  if (endpoint_filters_deny(conn_info)) {
+    return false;
+  }
+
   // Only trace data for protocols of interest, or if forced on.
   return (force_trace_tgid || should_trace_protocol_data(conn_info));
 }
 
-static __inline void update_conn_stats(struct pt_regs* ctx, struct conn_info_t* conn_info,
+static __inline void update_conn_stats(struct conn_info_t* conn_info,
                                        enum traffic_direction_t direction, ssize_t bytes_count) {
   // Update state of the connection.
+  // No event is submitted here: user-space periodically snapshots these counters straight out of
+  // conn_info_map (see SocketTraceConnector::SnapshotConnStats()). The final counters of a
+  // connection are reported by the close-time conn_stats event, since the map entry is deleted
+  // on close.
   switch (direction) {
     case kEgress:
       conn_info->wr_bytes += bytes_count;
@@ -710,20 +877,6 @@ static __inline void update_conn_stats(struct pt_regs* ctx, struct conn_info_t*
       conn_info->rd_bytes += bytes_count;
       break;
   }
-
-  // Only send event if there's been enough of a change.
-  // TODO(oazizi): Add elapsed time since last send as a triggering condition too.
-  uint64_t total_bytes = conn_info->wr_bytes + conn_info->rd_bytes;
-  bool meets_activity_threshold =
-      total_bytes >= conn_info->last_reported_bytes + kConnStatsDataThreshold;
-  if (meets_activity_threshold) {
-    struct conn_stats_event_t* event = fill_conn_stats_event(conn_info);
-    if (event != NULL) {
-      conn_stats_events.perf_submit(ctx, event, sizeof(struct conn_stats_event_t));
-    }
-
-    conn_info->last_reported_bytes = conn_info->rd_bytes + conn_info->wr_bytes;
-  }
 }
 
 static __inline void process_data(const bool vecs, struct pt_regs* ctx, uint64_t id,
@@ -816,7 +969,7 @@ static __inline void process_data(const bool vecs, struct pt_regs* ctx, uint64_t
   //               For now, keep using plaintext data. In the future, this if statement should be:
   //                     if (!ssl) { ... }
   if (conn_info->ssl == ssl) {
-    update_conn_stats(ctx, conn_info, direction, bytes_count);
+    update_conn_stats(conn_info, direction, bytes_count);
   }
 
   return;
@@ -892,7 +1045,7 @@ static __inline void process_syscall_sendfile(struct pt_regs* ctx, uint64_t id,
     socket_data_events.perf_submit(ctx, event, sizeof(event->attr));
   }
 
-  update_conn_stats(ctx, conn_info, kEgress, bytes_count);
+  update_conn_stats(conn_info, kEgress, bytes_count);
 
   return;
 }
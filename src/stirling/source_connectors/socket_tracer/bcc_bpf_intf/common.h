@@ -89,9 +89,45 @@ enum control_value_index_t {
   // * Support efficient lookup inside bpf to minimize overhead.
   kTargetTGIDIndex = 0,
   kStirlingTGIDIndex,
+  // When non-zero, connections whose remote address (resp. port) matches no endpoint filter
+  // entry are denied rather than allowed. Set from user-space when an allow-list is configured.
+  kCIDRFilterDefaultDenyIndex,
+  kPortFilterDefaultDenyIndex,
   kNumControlValues,
 };
 
+// The maximum number of CIDR filter entries that can be installed in filter_cidr_map.
+// Kept small to bound the BPF instruction count of the filter evaluation loop.
+#define MAX_FILTER_CIDRS 8
+
+// The maximum number of entries in protocol_hint_port_map. Bounds how many server ports
+// user-space may install protocol hints for.
+#define MAX_PROTOCOL_HINT_PORTS 1024
+
+// The action applied when an endpoint filter entry matches a connection's remote endpoint.
+enum filter_action_t {
+  kFilterActionDeny = 0,
+  kFilterActionAllow = 1,
+};
+
+// The verdict of the kernel-side endpoint filters for a connection, cached in conn_info_t.
+enum filter_verdict_t {
+  // The filters have not been evaluated yet (e.g. the remote address is not yet known).
+  kFilterVerdictUnknown = 0,
+  kFilterVerdictAllow,
+  kFilterVerdictDeny,
+};
+
+// A CIDR filter entry, matched against the remote address of a connection.
+// Addresses are stored as 4 32-bit words in network byte order; IPv4 prefixes are stored in
+// IPv4-mapped IPv6 form (::ffff:a.b.c.d) so that all comparisons happen in one address space.
+struct filter_cidr_t {
+  uint32_t prefix[4];
+  uint32_t mask[4];
+  uint64_t action;  // enum filter_action_t
+  uint64_t enabled;
+};
+
 // Indicates the source of the TLS library under trace if TLS is in use.
 enum ssl_source_t {
   kSSLNone = 0,
@@ -32,11 +32,9 @@
 
 constexpr int kNumProtocols = magic_enum::enum_count<traffic_protocol_t>();
 
-static const std::map<int64_t, std::string_view> kTrafficProtocolDecoder =
-    px::EnumDefToMap<traffic_protocol_t>();
+constexpr auto kTrafficProtocolDecoder = px::EnumDefToArray<traffic_protocol_t>();
 
-static const std::map<int64_t, std::string_view> kEndpointRoleDecoder =
-    px::EnumDefToMap<endpoint_role_t>();
+constexpr auto kEndpointRoleDecoder = px::EnumDefToArray<endpoint_role_t>();
 
 inline std::string ToString(const conn_id_t& conn_id) {
   return absl::Substitute("[upid=$0:$1 fd=$2 gen=$3]", conn_id.upid.pid,
@@ -61,14 +61,15 @@ struct conn_info_t {
 
   enum ssl_source_t ssl_source;
 
+  // Cached verdict of the kernel-side endpoint filters (enum filter_verdict_t).
+  // Zero (kFilterVerdictUnknown) means the filters have not been evaluated yet, e.g. because the
+  // remote address is not yet known.
+  enum filter_verdict_t filter_verdict;
+
   // The number of bytes written/read on this connection.
   int64_t wr_bytes;
   int64_t rd_bytes;
 
-  // The previously reported values of bytes written/read.
-  // Used for determining when to send updated conn_stats values.
-  int64_t last_reported_bytes;
-
   // The number of bytes written by application (for uprobe) on this connection.
   int64_t app_wr_bytes;
   // The number of bytes read by application (for uprobe) on this connection.
@@ -87,6 +88,13 @@ struct conn_info_t {
   size_t prev_count;
   char prev_buf[4];
   bool prepend_length_header;
+
+  // For HTTP connections: the remaining capture budget, in bytes, of the current message in each
+  // direction. Re-armed whenever a buffer begins a new HTTP message (see update_traffic_class()),
+  // and drawn down as the message's bytes flow. Once spent, the message's remaining data is not
+  // submitted to the perf buffer; user space observes the loss through event positions.
+  int32_t wr_http_capture_remaining;
+  int32_t rd_http_capture_remaining;
 };
 
 // This struct is a subset of conn_info_t. It is used to communicate connect/accept events.
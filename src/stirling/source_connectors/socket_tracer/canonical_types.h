@@ -51,7 +51,7 @@ constexpr DataElement kTraceRole = {
     types::DataType::INT64,
     types::SemanticType::ST_NONE,
     types::PatternType::GENERAL_ENUM,
-    &kEndpointRoleDecoder,
+    kEndpointRoleDecoder,
 };
 
 constexpr DataElement kLatencyNS = {
@@ -28,10 +28,8 @@
 namespace px {
 namespace stirling {
 
-static const std::map<int64_t, std::string_view> kCQLReqOpDecoder =
-    px::EnumDefToMap<protocols::cass::RespOp>();
-static const std::map<int64_t, std::string_view> kCQLRespOpDecoder =
-    px::EnumDefToMap<protocols::cass::RespOp>();
+constexpr auto kCQLReqOpDecoder = px::EnumDefToArray<protocols::cass::RespOp>();
+constexpr auto kCQLRespOpDecoder = px::EnumDefToArray<protocols::cass::RespOp>();
 
 // clang-format off
 static constexpr DataElement kCQLElements[] = {
@@ -44,7 +42,7 @@ static constexpr DataElement kCQLElements[] = {
          types::DataType::INT64,
          types::SemanticType::ST_NONE,
          types::PatternType::GENERAL_ENUM,
-         &kCQLReqOpDecoder},
+         kCQLReqOpDecoder},
         {"req_body", "Request body",
          types::DataType::STRING,
          types::SemanticType::ST_NONE,
@@ -53,7 +51,7 @@ static constexpr DataElement kCQLElements[] = {
          types::DataType::INT64,
          types::SemanticType::ST_NONE,
          types::PatternType::GENERAL_ENUM,
-         &kCQLRespOpDecoder},
+         kCQLRespOpDecoder},
         {"resp_body", "Request body",
          types::DataType::STRING,
          types::SemanticType::ST_NONE,
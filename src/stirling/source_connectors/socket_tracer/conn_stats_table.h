@@ -34,10 +34,10 @@ constexpr DataElement kConnStatsElements[] = {
         canonical_data_elements::kTraceRole,
         {"addr_family", "The socket address family of the connection.",
          types::DataType::INT64, types::SemanticType::ST_NONE, types::PatternType::GENERAL_ENUM,
-         &kSockAddrFamilyDecoder},
+         kSockAddrFamilyDecoder},
         {"protocol", "The protocol of the traffic on the connections.",
          types::DataType::INT64, types::SemanticType::ST_NONE, types::PatternType::GENERAL_ENUM,
-         &kTrafficProtocolDecoder},
+         kTrafficProtocolDecoder},
         {"ssl", "Was SSL traffic detected on this connection.",
          types::DataType::BOOLEAN, types::SemanticType::ST_NONE, types::PatternType::GENERAL_ENUM},
         {"conn_open", "The number of connections opened since the beginning of tracing.",
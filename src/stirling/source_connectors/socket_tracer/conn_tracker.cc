@@ -174,6 +174,8 @@ void ConnTracker::AddDataEvent(std::unique_ptr<SocketDataEvent> event) {
       recv_data_.AddData(std::move(event));
     } break;
   }
+
+  SyncHotState();
 }
 
 namespace {
@@ -404,6 +406,8 @@ void ConnTracker::Reset() {
   recv_data_.Reset();
 
   protocol_state_.reset();
+
+  SyncHotState();
 }
 
 void ConnTracker::Disable(std::string_view reason) {
@@ -524,6 +528,7 @@ bool ConnTracker::SetProtocol(traffic_protocol_t protocol, std::string_view reas
                                     magic_enum::enum_name(protocol), reason);
   send_data_.set_protocol(protocol);
   recv_data_.set_protocol(protocol);
+  SyncHotState();
   return true;
 }
 
@@ -609,6 +614,21 @@ void ConnTracker::MarkForDeath(int32_t countdown) {
   } else {
     death_countdown_ = countdown;
   }
+
+  SubmitForDestructionIfReady();
+}
+
+void ConnTracker::SubmitForDestructionIfReady() {
+  if (manager_ != nullptr && !destruction_submitted_ && ReadyForDestruction()) {
+    destruction_submitted_ = true;
+    manager_->SubmitForDestruction(this);
+  }
+}
+
+void ConnTracker::SyncHotState() {
+  if (manager_ != nullptr) {
+    manager_->SyncTrackerHotState(*this);
+  }
 }
 
 bool ConnTracker::IsZombie() const { return death_countdown_ >= 0; }
@@ -770,7 +790,7 @@ void ConnTracker::UpdateDataStats(const SocketDataEvent& event) {
 void ConnTracker::IterationPreTick(
     const std::chrono::time_point<std::chrono::steady_clock>& iteration_time,
     const std::vector<CIDRBlock>& cluster_cidrs, system::ProcParser* proc_parser,
-    system::SocketInfoManager* socket_info_mgr) {
+    system::SocketInfoManager* socket_info_mgr, FDLinkCache* fd_link_cache) {
   set_current_time(iteration_time);
 
   // Assume no activity. This flag will be flipped if there is any activity during the iteration.
@@ -785,7 +805,7 @@ void ConnTracker::IterationPreTick(
   // If remote_addr is missing, it means the connect/accept was not traced.
   // Attempt to infer the connection information, to populate remote_addr.
   if (open_info_.remote_addr.family == SockAddrFamily::kUnspecified && socket_info_mgr != nullptr) {
-    InferConnInfo(proc_parser, socket_info_mgr);
+    InferConnInfo(proc_parser, socket_info_mgr, fd_link_cache);
 
     // TODO(oazizi): If connection resolves to SockAddr type "Other",
     //               we should mark the state in BPF to Other too, so BPF stops tracing.
@@ -796,9 +816,16 @@ void ConnTracker::IterationPreTick(
 }
 
 void ConnTracker::IterationPostTick() {
+  // Buffers may have been trimmed by Cleanup() since the last sync. Trackers have distinct
+  // hot-state slots, so syncing here is safe even when post-ticks run on worker threads.
+  SyncHotState();
+
   if (death_countdown_ > 0) {
     --death_countdown_;
     CONN_TRACE(2) << absl::Substitute("Death countdown=$0", death_countdown_);
+    if (death_countdown_ == 0) {
+      SubmitForDestructionIfReady();
+    }
   }
 
   HandleInactivity();
@@ -925,7 +952,8 @@ endpoint_role_t TranslateRole(system::ClientServerRole role) {
 }  // namespace
 
 void ConnTracker::InferConnInfo(system::ProcParser* proc_parser,
-                                system::SocketInfoManager* socket_info_mgr) {
+                                system::SocketInfoManager* socket_info_mgr,
+                                FDLinkCache* fd_link_cache) {
   DCHECK(proc_parser != nullptr);
   DCHECK(socket_info_mgr != nullptr);
 
@@ -938,7 +966,8 @@ void ConnTracker::InferConnInfo(system::ProcParser* proc_parser,
   }
 
   if (conn_resolver_ == nullptr) {
-    conn_resolver_ = std::make_unique<FDResolver>(proc_parser, conn_id_.upid.pid, conn_id_.fd);
+    conn_resolver_ =
+        std::make_unique<FDResolver>(proc_parser, conn_id_.upid.pid, conn_id_.fd, fd_link_cache);
     bool success = conn_resolver_->Setup();
     if (!success) {
       conn_resolver_.reset();
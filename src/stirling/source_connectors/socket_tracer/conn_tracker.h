@@ -244,8 +244,10 @@ class ConnTracker : NotCopyMoveable {
    *
    * @param proc_parser Pointer to a proc_parser for access to /proc filesystem.
    * @param connections A map of inodes to endpoint information.
+   * @param fd_link_cache Optional per-cycle cache of /proc FD links, shared across trackers.
    */
-  void InferConnInfo(system::ProcParser* proc_parser, system::SocketInfoManager* socket_info_mgr);
+  void InferConnInfo(system::ProcParser* proc_parser, system::SocketInfoManager* socket_info_mgr,
+                     FDLinkCache* fd_link_cache = nullptr);
 
   /**
    * Processes the connection tracker, parsing raw events into frames,
@@ -343,6 +345,22 @@ class ConnTracker : NotCopyMoveable {
   // Mutable version of the above, for testing purposes.
   DataStream& recv_data() { return recv_data_; }
 
+  /**
+   * Total bytes currently buffered in the send and recv data streams.
+   * Used as the demand signal when the global buffer retention budget is distributed.
+   */
+  size_t BufferedDataBytes() const {
+    return send_data_.data_buffer().size() + recv_data_.data_buffer().size();
+  }
+
+  /**
+   * Per-tracker data buffer retention limit, assigned by
+   * ConnTrackersManager::UpdateBufferRetentionLimits(). 0 means no per-tracker limit has been
+   * assigned, and the global default (FLAGS_datastream_buffer_retention_size) applies.
+   */
+  size_t buffer_retention_limit_bytes() const { return buffer_retention_limit_bytes_; }
+  void set_buffer_retention_limit_bytes(size_t limit) { buffer_retention_limit_bytes_ = limit; }
+
   /**
    * Get the DataStream of requests for this connection.
    */
@@ -424,7 +442,10 @@ class ConnTracker : NotCopyMoveable {
   /**
    * Marks the ConnTracker as having reported its final conn stats event.
    */
-  void MarkFinalConnStatsReported() { final_conn_stats_reported_ = true; }
+  void MarkFinalConnStatsReported() {
+    final_conn_stats_reported_ = true;
+    SubmitForDestructionIfReady();
+  }
 
   /**
    * Whether this ConnTracker can be destroyed.
@@ -451,11 +472,12 @@ class ConnTracker : NotCopyMoveable {
    *
    * @param proc_parser Pointer to a proc_parser for access to /proc filesystem.
    * @param connections A map of inodes to endpoint information.
+   * @param fd_link_cache Optional per-cycle cache of /proc FD links, shared across trackers.
    */
   void IterationPreTick(const std::chrono::time_point<std::chrono::steady_clock>& iteration_time,
                         const std::vector<CIDRBlock>& cluster_cidrs,
-                        system::ProcParser* proc_parser,
-                        system::SocketInfoManager* socket_info_mgr);
+                        system::ProcParser* proc_parser, system::SocketInfoManager* socket_info_mgr,
+                        FDLinkCache* fd_link_cache = nullptr);
 
   /**
    * Updates the any state that changes per iteration on this connection tracker.
@@ -643,6 +665,12 @@ class ConnTracker : NotCopyMoveable {
 
   void CheckProcForConnClose();
   void HandleInactivity();
+  // Notifies the manager the first time this tracker becomes ReadyForDestruction(), so that
+  // clean-up only visits trackers that are actually ready, instead of scanning all of them.
+  void SubmitForDestructionIfReady();
+  // Re-mirrors the fields read by the manager's per-cycle sweeps (buffered bytes, protocol)
+  // into the manager's packed hot-state array, so the sweeps don't touch this (large) object.
+  void SyncHotState();
   bool IsRemoteAddrInCluster(const std::vector<CIDRBlock>& cluster_cidrs);
   void UpdateState(const std::vector<CIDRBlock>& cluster_cidrs);
 
@@ -695,6 +723,10 @@ class ConnTracker : NotCopyMoveable {
   DataStream send_data_;
   DataStream recv_data_;
 
+  // Per-tracker data buffer retention limit, assigned from the global retention budget.
+  // 0 means unassigned; the global default limit applies.
+  size_t buffer_retention_limit_bytes_ = 0;
+
   // Uprobe-based HTTP2 uses a different scheme, where it holds client and server-initiated streams,
   // instead of send and recv messages. As such, we create aliases for HTTP2.
   HTTP2StreamsContainer http2_client_streams_;
@@ -762,6 +794,22 @@ class ConnTracker : NotCopyMoveable {
   // A pointer to the conn trackers manager, used for notifying a protocol change.
   ConnTrackersManager* manager_ = nullptr;
 
+  // The last ConnTrackersManager generation in which this tracker received a BPF event.
+  // Used by the manager to deduplicate entries in its dirty list.
+  uint64_t last_activity_generation_ = 0;
+
+  // Position of this tracker in the manager's active trackers list, enabling O(1) removal when
+  // the tracker becomes ready for destruction.
+  std::list<ConnTracker*>::iterator active_trackers_pos_;
+
+  // Index of this tracker's slot in the manager's packed hot-state array.
+  size_t hot_state_idx_ = 0;
+
+  // Whether this tracker has already submitted itself to the manager for destruction.
+  // ReadyForDestruction() stays true once reached, but its triggering calls can repeat
+  // (e.g. MarkForDeath()), so this guards against duplicate submissions.
+  bool destruction_submitted_ = false;
+
   friend class ConnTrackersManager;
   // A subclass expose private member as public.
   friend class ConnTrackerTestDouble;
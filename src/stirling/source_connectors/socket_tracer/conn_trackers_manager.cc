@@ -17,6 +17,10 @@
  */
 
 #include "src/stirling/source_connectors/socket_tracer/conn_trackers_manager.h"
+
+#include <algorithm>
+#include <iterator>
+
 #include "src/common/metrics/metrics.h"
 
 DEFINE_double(
@@ -129,16 +133,46 @@ ConnTracker& ConnTrackersManager::GetOrCreateConnTracker(struct conn_id_t conn_i
   if (created) {
     active_trackers_.push_back(conn_tracker_ptr);
     conn_tracker_ptr->manager_ = this;
+    conn_tracker_ptr->active_trackers_pos_ = std::prev(active_trackers_.end());
+    // Trackers recycled from the pool carry the stamp of their previous life.
+    conn_tracker_ptr->last_activity_generation_ = 0;
+
+    // Assign a packed hot-state slot, so the per-cycle sweeps can read this tracker's
+    // sweep-relevant fields without dereferencing the tracker itself.
+    size_t slot_idx;
+    if (!free_hot_slots_.empty()) {
+      slot_idx = free_hot_slots_.back();
+      free_hot_slots_.pop_back();
+    } else {
+      slot_idx = hot_states_.size();
+      hot_states_.emplace_back();
+    }
+    hot_states_[slot_idx] = {};
+    hot_states_[slot_idx].tracker = conn_tracker_ptr;
+    conn_tracker_ptr->hot_state_idx_ = slot_idx;
 
     stats_.Increment(StatKey::kTotal);
     stats_.Increment(StatKey::kCreated);
     conn_tracker_created_.Increment();
   }
 
+  // All BPF events are routed through this function, so this marks the tracker as active for the
+  // current generation. The generation stamp deduplicates trackers that receive many events
+  // between two generations.
+  if (conn_tracker_ptr->last_activity_generation_ != current_generation_) {
+    conn_tracker_ptr->last_activity_generation_ = current_generation_;
+    dirty_trackers_.push_back(conn_tracker_ptr);
+  }
+
   DebugChecks();
   return *conn_tracker_ptr;
 }
 
+void ConnTrackersManager::StartNewGeneration() {
+  dirty_trackers_.clear();
+  ++current_generation_;
+}
+
 StatusOr<const ConnTracker*> ConnTrackersManager::GetConnTracker(uint32_t pid, int32_t fd) const {
   const uint64_t conn_map_key = GetConnMapKey(pid, fd);
 
@@ -159,19 +193,40 @@ StatusOr<const ConnTracker*> ConnTrackersManager::GetConnTracker(uint32_t pid, i
   return tracker_generations.GetActive();
 }
 
+void ConnTrackersManager::SyncTrackerHotState(const ConnTracker& tracker) {
+  TrackerHotState& slot = hot_states_[tracker.hot_state_idx_];
+  // A tracker removed from the active list (pending recycling) may still receive late events;
+  // its slot has been released and possibly reassigned, so leave it alone.
+  if (slot.tracker != &tracker) {
+    return;
+  }
+  slot.buffered_bytes = tracker.BufferedDataBytes();
+  slot.protocol = tracker.protocol();
+}
+
+void ConnTrackersManager::SubmitForDestruction(ConnTracker* tracker) {
+  const std::lock_guard<std::mutex> lock(destruction_candidates_mutex_);
+  destruction_candidates_.push_back(tracker);
+}
+
 void ConnTrackersManager::CleanupTrackers() {
   {
-    auto iter = active_trackers_.begin();
-    while (iter != active_trackers_.end()) {
-      const auto& tracker = *iter;
-      if (tracker->ReadyForDestruction()) {
-        active_trackers_.erase(iter++);
-
-        stats_.Increment(StatKey::kReadyForDestruction);
-      } else {
-        ++iter;
-      }
+    // Trackers submit themselves the moment they become ReadyForDestruction() (see
+    // ConnTracker::SubmitForDestructionIfReady()), so only those trackers are visited here,
+    // instead of scanning the full active list every iteration.
+    const std::lock_guard<std::mutex> lock(destruction_candidates_mutex_);
+    for (ConnTracker* tracker : destruction_candidates_) {
+      DCHECK(tracker->ReadyForDestruction());
+      active_trackers_.erase(tracker->active_trackers_pos_);
+
+      // Release the tracker's hot-state slot for reuse. The tracker itself may linger in its
+      // generations map until the threshold-based cleanup below recycles it.
+      hot_states_[tracker->hot_state_idx_] = {};
+      free_hot_slots_.push_back(tracker->hot_state_idx_);
+
+      stats_.Increment(StatKey::kReadyForDestruction);
     }
+    destruction_candidates_.clear();
   }
 
   // As a performance optimization, we only clean up trackers once we reach a certain threshold
@@ -180,6 +235,14 @@ void ConnTrackersManager::CleanupTrackers() {
   double percent_destroyable =
       1.0 * stats_.Get(StatKey::kReadyForDestruction) / stats_.Get(StatKey::kTotal);
   if (percent_destroyable > FLAGS_stirling_conn_tracker_cleanup_threshold) {
+    // Trackers about to be recycled may still be referenced by the dirty list
+    // (e.g. a tracker that was marked for death right after receiving an event).
+    // Purge them first so the dirty list never holds dangling pointers.
+    dirty_trackers_.erase(
+        std::remove_if(dirty_trackers_.begin(), dirty_trackers_.end(),
+                       [](const ConnTracker* tracker) { return tracker->ReadyForDestruction(); }),
+        dirty_trackers_.end());
+
     // Outer loop iterates through tracker sets (keyed by PID+FD),
     // while inner loop iterates through generations of trackers for that PID+FD pair.
     auto iter = conn_id_tracker_generations_.begin();
@@ -208,9 +271,54 @@ void ConnTrackersManager::CleanupTrackers() {
   DebugChecks();
 }
 
+void ConnTrackersManager::UpdateBufferRetentionLimits(size_t budget_bytes,
+                                                      size_t default_limit_bytes) {
+  if (budget_bytes == 0 || active_trackers_.empty()) {
+    return;
+  }
+
+  // Demand is measured as the bytes currently buffered, so the budget flows to the streams
+  // that are actually accumulating data in this iteration. The demand is read from the packed
+  // hot-state records, so this sweep stays linear in memory rather than chasing tracker
+  // pointers.
+  size_t total_demand = 0;
+  for (const TrackerHotState& slot : hot_states_) {
+    if (slot.tracker != nullptr) {
+      total_demand += slot.buffered_bytes;
+    }
+  }
+
+  // Every tracker keeps a guaranteed floor so that an idle stream can still absorb the start of
+  // a burst. The floor is capped at an even split of the budget, so the distributable remainder
+  // cannot underflow even when the budget is smaller than num_trackers * default_limit.
+  const size_t num_trackers = active_trackers_.size();
+  const size_t guaranteed_share = std::min(default_limit_bytes, budget_bytes / num_trackers);
+  const size_t distributable = budget_bytes - guaranteed_share * num_trackers;
+
+  for (TrackerHotState& slot : hot_states_) {
+    if (slot.tracker == nullptr) {
+      continue;
+    }
+    size_t limit = guaranteed_share;
+    if (total_demand > 0) {
+      const double demand_fraction =
+          static_cast<double>(slot.buffered_bytes) / static_cast<double>(total_demand);
+      limit += static_cast<size_t>(static_cast<double>(distributable) * demand_fraction);
+    }
+    // Only touch the tracker itself when its limit actually changed. Idle trackers keep the
+    // guaranteed share across iterations, so at scale most of this sweep never leaves the
+    // packed array.
+    if (limit != slot.assigned_limit_bytes) {
+      slot.assigned_limit_bytes = limit;
+      slot.tracker->set_buffer_retention_limit_bytes(limit);
+    }
+  }
+}
+
 void ConnTrackersManager::DebugChecks() const {
   DCHECK_EQ(stats_.Get(StatKey::kTotal), static_cast<int64_t>(active_trackers_.size()) +
                                              stats_.Get(StatKey::kReadyForDestruction));
+  DCHECK_EQ(hot_states_.size() - free_hot_slots_.size(), active_trackers_.size());
 }
 
 std::string ConnTrackersManager::DebugInfo() const {
@@ -234,8 +342,10 @@ std::string ConnTrackersManager::StatsString() const {
 
 void ConnTrackersManager::ComputeProtocolStats() {
   absl::flat_hash_map<traffic_protocol_t, int> protocol_count;
-  for (const auto* tracker : active_trackers_) {
-    ++protocol_count[tracker->protocol()];
+  for (const TrackerHotState& slot : hot_states_) {
+    if (slot.tracker != nullptr) {
+      ++protocol_count[slot.protocol];
+    }
   }
   for (auto protocol : magic_enum::enum_values<traffic_protocol_t>()) {
     protocol_stats_.Reset(protocol);
@@ -21,6 +21,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <utility>
@@ -83,6 +84,26 @@ class ConnTrackerGenerations {
   ConnTracker* oldest_generation_ = nullptr;
 };
 
+/**
+ * TrackerHotState is the packed per-tracker record read by the manager's per-cycle sweeps.
+ * The sweeps run at the scale of all tracked connections, so they iterate these records
+ * linearly instead of chasing pointers into the (large) ConnTracker objects; a tracker is
+ * only dereferenced when its record shows there is something to do.
+ */
+struct TrackerHotState {
+  // The tracker owning this slot. nullptr marks a free slot.
+  ConnTracker* tracker = nullptr;
+
+  // Mirror of ConnTracker::BufferedDataBytes(); the demand signal for the retention budget.
+  size_t buffered_bytes = 0;
+
+  // The retention limit last pushed to the tracker, so an unchanged limit skips the tracker.
+  size_t assigned_limit_bytes = 0;
+
+  // Mirror of ConnTracker::protocol().
+  traffic_protocol_t protocol = kProtocolUnknown;
+};
+
 /**
  * ConnTrackersManager is a container that keeps track of all ConnTrackers.
  * Interface designed for two primary operations:
@@ -110,6 +131,20 @@ class ConnTrackersManager {
 
   const std::list<ConnTracker*>& active_trackers() const { return active_trackers_; }
 
+  /**
+   * Returns the trackers that have received BPF events in the current generation.
+   * This is a subset of active_trackers(), meant for iteration paths whose cost should be
+   * proportional to the number of active connections rather than the number of tracked ones.
+   */
+  const std::vector<ConnTracker*>& dirty_trackers() const { return dirty_trackers_; }
+
+  /**
+   * Starts a new generation: clears the dirty list so that only trackers receiving events
+   * from now on are considered active. Call once per TransferData iteration, after the
+   * dirty trackers have been processed.
+   */
+  void StartNewGeneration();
+
   /**
    * Returns the latest generation of a connection tracker for the given pid and fd.
    * If there is no tracker for {pid, fd}, returns error::NotFound.
@@ -123,6 +158,33 @@ class ConnTrackersManager {
    */
   void CleanupTrackers();
 
+  /**
+   * Submits a tracker that has become ReadyForDestruction() for removal on the next call to
+   * CleanupTrackers(). Called by ConnTracker when its destruction conditions are met, so that
+   * clean-up only visits these trackers instead of scanning the full active list.
+   * Thread-safe: trackers may submit themselves from the transfer worker threads.
+   */
+  void SubmitForDestruction(ConnTracker* tracker);
+
+  /**
+   * Re-mirrors a tracker's sweep-relevant fields (buffered bytes, protocol) into its packed
+   * hot-state slot. Called by ConnTracker at the points where those fields change.
+   */
+  void SyncTrackerHotState(const ConnTracker& tracker);
+
+  const std::vector<TrackerHotState>& tracker_hot_states() const { return hot_states_; }
+
+  /**
+   * Distributes a global data buffer retention budget across the active trackers,
+   * proportional to the bytes each tracker currently has buffered. Each tracker is guaranteed
+   * a floor of min(default_limit_bytes, budget_bytes / num_trackers) so that idle streams can
+   * still absorb the start of a burst; the remainder of the budget flows to the streams that
+   * are actually accumulating data. Call once per TransferData iteration, before the trackers'
+   * buffers are cleaned up. A budget of 0 is a no-op, leaving the fixed per-stream limit in
+   * place.
+   */
+  void UpdateBufferRetentionLimits(size_t budget_bytes, size_t default_limit_bytes);
+
   /**
    * Returns extensive debug information about the connection trackers.
    */
@@ -149,6 +211,26 @@ class ConnTrackersManager {
 
   std::list<ConnTracker*> active_trackers_;
 
+  // Trackers that received BPF events in the current generation, in arrival order.
+  // Deduplicated via ConnTracker::last_activity_generation_.
+  std::vector<ConnTracker*> dirty_trackers_;
+
+  // Packed per-tracker hot state, iterated linearly by the per-cycle sweeps
+  // (UpdateBufferRetentionLimits, ComputeProtocolStats) so they don't touch the trackers
+  // themselves. One live slot per tracker in active_trackers_; freed slots are recycled.
+  std::vector<TrackerHotState> hot_states_;
+  std::vector<size_t> free_hot_slots_;
+
+  // Trackers that have become ReadyForDestruction() since the last CleanupTrackers() call.
+  // Deduplicated via ConnTracker::destruction_submitted_. The mutex is required because
+  // trackers can submit themselves from the transfer worker threads.
+  std::vector<ConnTracker*> destruction_candidates_;
+  std::mutex destruction_candidates_mutex_;
+
+  // Monotonically increasing generation counter. Starts at 1 so that a zero
+  // last_activity_generation_ (the reset value for new and recycled trackers) never matches.
+  uint64_t current_generation_ = 1;
+
   // A pool of unused trackers that can be recycled.
   // This is useful for avoiding memory reallocations.
   ConnTrackerPool trackers_pool_;
@@ -20,11 +20,14 @@
 
 #include "src/common/testing/testing.h"
 #include "src/stirling/source_connectors/socket_tracer/conn_trackers_manager.h"
+#include "src/stirling/source_connectors/socket_tracer/testing/event_generator.h"
 
 namespace px {
 namespace stirling {
 
+using ::testing::ElementsAre;
 using ::testing::HasSubstr;
+using ::testing::IsEmpty;
 using ::testing::StrEq;
 
 class ConnTrackersManagerTest : public ::testing::Test {
@@ -112,6 +115,131 @@ TEST_F(ConnTrackersManagerTest, DebugInfo) {
   EXPECT_THAT(debug_info, HasSubstr("conn_tracker=conn_id=[upid=1:1 fd=1 gen=1]"));
 }
 
+// Tests that GetOrCreateConnTracker() marks a tracker dirty at most once per generation,
+// and that StartNewGeneration() resets the dirty list.
+TEST_F(ConnTrackersManagerTest, DirtyListTracksPerGenerationActivity) {
+  struct conn_id_t conn_id1 = {{{1}, 0}, 1, 1};
+  struct conn_id_t conn_id2 = {{{2}, 0}, 1, 1};
+
+  ConnTracker& tracker1 = trackers_mgr_.GetOrCreateConnTracker(conn_id1);
+  ConnTracker& tracker2 = trackers_mgr_.GetOrCreateConnTracker(conn_id2);
+
+  // Repeated events within a generation must not create duplicate entries.
+  trackers_mgr_.GetOrCreateConnTracker(conn_id1);
+  EXPECT_THAT(trackers_mgr_.dirty_trackers(), ElementsAre(&tracker1, &tracker2));
+
+  trackers_mgr_.StartNewGeneration();
+  EXPECT_THAT(trackers_mgr_.dirty_trackers(), IsEmpty());
+
+  // Only trackers with new events show up in the next generation.
+  trackers_mgr_.GetOrCreateConnTracker(conn_id2);
+  EXPECT_THAT(trackers_mgr_.dirty_trackers(), ElementsAre(&tracker2));
+}
+
+// Tests that a tracker whose death countdown expires is removed from the active list on the
+// next CleanupTrackers() call, via its self-submission for destruction.
+TEST_F(ConnTrackersManagerTest, CountdownExpiryRemovesTrackerFromActiveList) {
+  struct conn_id_t conn_id1 = {{{1}, 0}, 1, 1};
+  struct conn_id_t conn_id2 = {{{2}, 0}, 1, 1};
+
+  ConnTracker& tracker1 = trackers_mgr_.GetOrCreateConnTracker(conn_id1);
+  ConnTracker& tracker2 = trackers_mgr_.GetOrCreateConnTracker(conn_id2);
+
+  tracker1.MarkForDeath(/*countdown=*/2);
+  tracker1.MarkFinalConnStatsReported();
+
+  // The countdown has not expired yet, so the tracker must stay in the active list.
+  trackers_mgr_.CleanupTrackers();
+  EXPECT_THAT(trackers_mgr_.active_trackers(), ElementsAre(&tracker1, &tracker2));
+
+  tracker1.IterationPostTick();
+  tracker1.IterationPostTick();
+  trackers_mgr_.CleanupTrackers();
+  EXPECT_THAT(trackers_mgr_.active_trackers(), ElementsAre(&tracker2));
+}
+
+// Tests that trackers destroyed by CleanupTrackers() are also purged from the dirty list,
+// so the dirty list never holds dangling pointers.
+TEST_F(ConnTrackersManagerTest, CleanupTrackersPurgesDirtyList) {
+  struct conn_id_t conn_id1 = {{{1}, 0}, 1, 1};
+  struct conn_id_t conn_id2 = {{{2}, 0}, 1, 1};
+
+  ConnTracker& tracker1 = trackers_mgr_.GetOrCreateConnTracker(conn_id1);
+  ConnTracker& tracker2 = trackers_mgr_.GetOrCreateConnTracker(conn_id2);
+
+  tracker1.MarkForDeath(/*countdown=*/0);
+  tracker1.MarkFinalConnStatsReported();
+  trackers_mgr_.CleanupTrackers();
+
+  EXPECT_THAT(trackers_mgr_.dirty_trackers(), ElementsAre(&tracker2));
+}
+
+// Tests that the global retention budget is distributed in proportion to buffered bytes,
+// with every tracker keeping a guaranteed floor, and that a budget of 0 is a no-op.
+TEST_F(ConnTrackersManagerTest, UpdateBufferRetentionLimits) {
+  struct conn_id_t conn_id1 = {{{1}, 0}, 1, 1};
+  struct conn_id_t conn_id2 = {{{2}, 0}, 1, 1};
+
+  ConnTracker& busy_tracker = trackers_mgr_.GetOrCreateConnTracker(conn_id1);
+  ConnTracker& idle_tracker = trackers_mgr_.GetOrCreateConnTracker(conn_id2);
+
+  // Give the busy tracker some buffered data to create demand.
+  testing::MockClock mock_clock;
+  testing::EventGenerator event_gen(&mock_clock);
+  busy_tracker.AddDataEvent(event_gen.InitSendEvent<kProtocolHTTP>(std::string(1024, 'x')));
+
+  // A zero budget must leave the per-tracker limits unassigned.
+  trackers_mgr_.UpdateBufferRetentionLimits(/*budget_bytes=*/0, /*default_limit_bytes=*/1024);
+  EXPECT_EQ(busy_tracker.buffer_retention_limit_bytes(), 0U);
+  EXPECT_EQ(idle_tracker.buffer_retention_limit_bytes(), 0U);
+
+  constexpr size_t kBudgetBytes = 8192;
+  constexpr size_t kDefaultLimitBytes = 1024;
+  trackers_mgr_.UpdateBufferRetentionLimits(kBudgetBytes, kDefaultLimitBytes);
+
+  // The idle tracker keeps its guaranteed floor; the busy tracker gets the floor plus the
+  // entire distributable remainder, since it holds all of the demand.
+  EXPECT_EQ(idle_tracker.buffer_retention_limit_bytes(), kDefaultLimitBytes);
+  EXPECT_GT(busy_tracker.buffer_retention_limit_bytes(),
+            idle_tracker.buffer_retention_limit_bytes());
+  EXPECT_LE(busy_tracker.buffer_retention_limit_bytes() +
+                idle_tracker.buffer_retention_limit_bytes(),
+            kBudgetBytes);
+}
+
+// Tests that the packed hot-state slots mirror the sweep-relevant tracker fields, and that
+// slots are recycled once their trackers are destroyed.
+TEST_F(ConnTrackersManagerTest, HotStateMirrorsTrackerFields) {
+  struct conn_id_t conn_id1 = {{{1}, 0}, 1, 1};
+  struct conn_id_t conn_id2 = {{{2}, 0}, 1, 1};
+
+  ConnTracker& tracker1 = trackers_mgr_.GetOrCreateConnTracker(conn_id1);
+  ConnTracker& tracker2 = trackers_mgr_.GetOrCreateConnTracker(conn_id2);
+  ASSERT_EQ(trackers_mgr_.tracker_hot_states().size(), 2U);
+  EXPECT_EQ(trackers_mgr_.tracker_hot_states()[1].tracker, &tracker2);
+
+  testing::MockClock mock_clock;
+  testing::EventGenerator event_gen(&mock_clock);
+  tracker1.AddDataEvent(event_gen.InitSendEvent<kProtocolHTTP>(std::string(128, 'x')));
+
+  const TrackerHotState& slot1 = trackers_mgr_.tracker_hot_states()[0];
+  EXPECT_EQ(slot1.tracker, &tracker1);
+  EXPECT_GT(slot1.buffered_bytes, 0U);
+  EXPECT_EQ(slot1.buffered_bytes, tracker1.BufferedDataBytes());
+  EXPECT_EQ(slot1.protocol, kProtocolHTTP);
+
+  // Destroying a tracker frees its slot, which is then reused by the next tracker.
+  tracker1.MarkForDeath(/*countdown=*/0);
+  tracker1.MarkFinalConnStatsReported();
+  trackers_mgr_.CleanupTrackers();
+  EXPECT_EQ(trackers_mgr_.tracker_hot_states()[0].tracker, nullptr);
+
+  struct conn_id_t conn_id3 = {{{3}, 0}, 1, 1};
+  ConnTracker& tracker3 = trackers_mgr_.GetOrCreateConnTracker(conn_id3);
+  EXPECT_EQ(trackers_mgr_.tracker_hot_states().size(), 2U);
+  EXPECT_EQ(trackers_mgr_.tracker_hot_states()[0].tracker, &tracker3);
+}
+
 class ConnTrackerGenerationsTest : public ::testing::Test {
  protected:
   ConnTrackerGenerationsTest() : tracker_pool(1024) {
@@ -19,6 +19,7 @@
 #include <gflags/gflags.h>
 #include <utility>
 
+#include "src/common/perf/cycle_counter.h"
 #include "src/stirling/source_connectors/socket_tracer/data_stream.h"
 #include "src/stirling/source_connectors/socket_tracer/metrics.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/types.h"
@@ -43,6 +44,10 @@ DEFINE_uint32(
     "The duration, in seconds, after which the buffer will be cleared if there is no progress in "
     "the parser.");
 
+DEFINE_uint32(stirling_parse_timing_sample_ratio, 64,
+              "Sample 1-in-N ParseFrames() calls into the per-protocol parse timing histograms. "
+              "0 disables the sampling.");
+
 namespace px {
 namespace stirling {
 
@@ -103,18 +108,44 @@ void DataStream::ProcessBytesToFrames(message_type_t type, TStateType* state) {
 
   bool keep_processing = has_new_events_ || attempt_sync || conn_closed();
 
+  // If the last attempt ended in kNeedsMoreData, and the buffer is byte-for-byte identical to
+  // what that attempt saw (same position, same size, same resync decision), then re-parsing
+  // cannot produce a different result. Skipping the attempt keeps a stream that is waiting on
+  // the tail of a large partial frame from re-scanning the same prefix on every transfer cycle
+  // (e.g. while a closed or stuck connection keeps triggering processing).
+  if (keep_processing && last_parse_state_ == ParseState::kNeedsMoreData &&
+      data_buffer_.position() == last_attempted_pos_ &&
+      data_buffer_.size() == last_attempted_size_ && attempt_sync == last_attempted_resync_) {
+    keep_processing = false;
+  }
+
   protocols::ParseResult parse_result;
   parse_result.state = ParseState::kNeedsMoreData;
   parse_result.end_position = 0;
 
   size_t frame_bytes = 0;
+  bool attempted_parse = false;
 
   while (keep_processing && !data_buffer_.empty()) {
+    attempted_parse = true;
     size_t contiguous_bytes = data_buffer_.Head().size();
 
+    // Sampled parse timing: 1-in-N ParseFrames() calls are timed with the CPU's cycle counter,
+    // which is cheap enough to leave on in production. The histograms attribute parser CPU cost
+    // to a specific protocol.
+    const uint32_t sample_ratio = FLAGS_stirling_parse_timing_sample_ratio;
+    const bool sample_timing =
+        (sample_ratio != 0) && (parse_timing_sample_seq_++ % sample_ratio == 0);
+    const uint64_t start_cycles = sample_timing ? CycleCounter() : 0;
+
     // Now parse the raw data.
     parse_result =
         protocols::ParseFrames(type, &data_buffer_, &typed_messages, IsSyncRequired(), state);
+
+    if (sample_timing) {
+      SocketTracerMetrics::GetProtocolMetrics(protocol_, ssl_source_)
+          .parse_frames_cycles.Observe(static_cast<double>(CycleCounter() - start_cycles));
+    }
     if (contiguous_bytes != data_buffer_.size()) {
       // We weren't able to submit all bytes, which means we ran into a missing event.
       // We don't expect missing events to arrive in the future, so just cut our losses.
@@ -175,6 +206,14 @@ void DataStream::ProcessBytesToFrames(message_type_t type, TStateType* state) {
 
   last_parse_state_ = parse_result.state;
 
+  // Record what this cycle's final parse attempt saw, so the next cycle can recognize an
+  // unchanged buffer and skip re-parsing it.
+  if (attempted_parse) {
+    last_attempted_pos_ = data_buffer_.position();
+    last_attempted_size_ = data_buffer_.size();
+    last_attempted_resync_ = attempt_sync;
+  }
+
   // has_new_events_ should be false for the next transfer cycle.
   has_new_events_ = false;
 }
@@ -35,6 +35,8 @@ DECLARE_uint32(datastream_buffer_allow_before_gap_size);
 DECLARE_uint32(buffer_resync_duration_secs);
 DECLARE_uint32(buffer_expiration_duration_secs);
 
+DECLARE_uint32(stirling_parse_timing_sample_ratio);
+
 namespace px {
 namespace stirling {
 
@@ -311,9 +313,20 @@ class DataStream : NotCopyMoveable {
   int stat_invalid_frames_ = 0;
   int stat_raw_data_gaps_ = 0;
 
+  // Sequence number of ParseFrames() calls on this stream, used to select the 1-in-N calls that
+  // are timed into the per-protocol parse timing histograms.
+  uint64_t parse_timing_sample_seq_ = 0;
+
   // A copy of the parse state from the last call to ProcessToRecords().
   ParseState last_parse_state_ = ParseState::kInvalid;
 
+  // A description of the buffer as of the last ParseFrames() attempt. When that attempt ended
+  // with kNeedsMoreData and the buffer is unchanged, ProcessBytesToFrames() skips re-parsing,
+  // since parsing the identical bytes again cannot make progress.
+  size_t last_attempted_pos_ = 0;
+  size_t last_attempted_size_ = 0;
+  bool last_attempted_resync_ = false;
+
   // Keep track of the byte position after the last processed position, in order to measure data
   // loss.
   size_t last_processed_pos_ = 0;
@@ -102,6 +102,23 @@ TEST_F(DataStreamTest, LostEvent) {
                    .data_loss_bytes.Value());
 }
 
+TEST_F(DataStreamTest, ParseTimingSampled) {
+  PX_SET_FOR_SCOPE(FLAGS_stirling_parse_timing_sample_ratio, 1);
+
+  std::unique_ptr<SocketDataEvent> req0 = event_gen_.InitSendEvent<kProtocolHTTP>(kHTTPReq0);
+  protocols::http::StateWrapper state{};
+
+  DataStream stream;
+  stream.set_protocol(kProtocolHTTP);
+  stream.AddData(std::move(req0));
+  stream.ProcessBytesToFrames<http::Message>(message_type_t::kRequest, &state);
+  EXPECT_THAT(stream.Frames<http::Message>(), SizeIs(1));
+
+  prometheus::ClientMetric metric = SocketTracerMetrics::GetProtocolMetrics(kProtocolHTTP, kSSLNone)
+                                        .parse_frames_cycles.Collect();
+  EXPECT_EQ(1, metric.histogram.sample_count);
+}
+
 TEST_F(DataStreamTest, StuckTemporarily) {
   std::unique_ptr<SocketDataEvent> req0a =
       event_gen_.InitSendEvent<kProtocolHTTP>(kHTTPReq0.substr(0, kHTTPReq0.length() - 10));
@@ -136,6 +153,36 @@ TEST_F(DataStreamTest, StuckTemporarily) {
                    .data_loss_bytes.Value());
 }
 
+TEST_F(DataStreamTest, UnchangedHeadIsNotReparsed) {
+  std::unique_ptr<SocketDataEvent> req0a =
+      event_gen_.InitSendEvent<kProtocolHTTP>(kHTTPReq0.substr(0, kHTTPReq0.length() - 10));
+  std::unique_ptr<SocketDataEvent> req0b =
+      event_gen_.InitSendEvent<kProtocolHTTP>(kHTTPReq0.substr(kHTTPReq0.length() - 10, 10));
+  protocols::http::StateWrapper state{};
+
+  DataStream stream;
+  stream.set_protocol(kProtocolHTTP);
+  stream.AddData(std::move(req0a));
+
+  // A closed connection keeps triggering parse attempts on every transfer cycle, even with no
+  // new events. With an unchanged buffer these attempts are skipped rather than re-parsed, and
+  // must remain invisible: once the remaining bytes arrive, parsing resumes as usual.
+  stream.set_conn_closed();
+
+  stream.ProcessBytesToFrames<http::Message>(message_type_t::kRequest, &state);
+  EXPECT_THAT(stream.Frames<http::Message>(), IsEmpty());
+
+  stream.ProcessBytesToFrames<http::Message>(message_type_t::kRequest, &state);
+  EXPECT_THAT(stream.Frames<http::Message>(), IsEmpty());
+
+  stream.AddData(std::move(req0b));
+
+  stream.ProcessBytesToFrames<http::Message>(message_type_t::kRequest, &state);
+  const auto& requests = stream.Frames<http::Message>();
+  ASSERT_THAT(requests, SizeIs(1));
+  EXPECT_EQ(requests[0].req_path, "/index.html");
+}
+
 TEST_F(DataStreamTest, StuckTooLong) {
   std::unique_ptr<SocketDataEvent> req0a =
       event_gen_.InitSendEvent<kProtocolHTTP>(kHTTPReq0.substr(0, kHTTPReq0.length() - 10));
@@ -26,8 +26,49 @@
 namespace px {
 namespace stirling {
 
-FDResolver::FDResolver(system::ProcParser* proc_parser, int pid, int fd)
-    : proc_parser_(proc_parser), pid_(pid), fd_(fd) {}
+Status FDLinkCache::GetFDLink(int pid, int fd, std::string* out,
+                              std::chrono::time_point<std::chrono::steady_clock>* scan_time) {
+  auto [iter, inserted] = fd_tables_.try_emplace(pid);
+  FDTable& fd_table = iter->second;
+
+  if (inserted) {
+    // Record the time before the scan, so callers get a conservative view of when
+    // the links were read.
+    fd_table.scan_time = std::chrono::steady_clock::now();
+
+    Status s = proc_parser_->ReadProcPIDFDLinks(pid, &fd_table.links);
+    if (!s.ok()) {
+      // Keep the (empty) entry cached, so the PID is not re-scanned this cycle.
+      return s;
+    }
+  }
+
+  auto fd_iter = fd_table.links.find(fd);
+  if (fd_iter == fd_table.links.end()) {
+    return error::NotFound("FD $0 not found in the FD table of pid $1.", fd, pid);
+  }
+
+  *out = fd_iter->second;
+  if (scan_time != nullptr) {
+    *scan_time = fd_table.scan_time;
+  }
+  return Status::OK();
+}
+
+FDResolver::FDResolver(system::ProcParser* proc_parser, int pid, int fd, FDLinkCache* fd_link_cache)
+    : proc_parser_(proc_parser), pid_(pid), fd_(fd), fd_link_cache_(fd_link_cache) {}
+
+Status FDResolver::ReadFDLink(std::string* link,
+                              std::chrono::time_point<std::chrono::steady_clock>* read_start_time) {
+  if (fd_link_cache_ != nullptr) {
+    return fd_link_cache_->GetFDLink(pid_, fd_, link, read_start_time);
+  }
+
+  if (read_start_time != nullptr) {
+    *read_start_time = std::chrono::steady_clock::now();
+  }
+  return proc_parser_->ReadProcPIDFDLink(pid_, fd_, link);
+}
 
 bool FDResolver::Setup() {
   // Record some information about the FD.
@@ -36,7 +77,7 @@ bool FDResolver::Setup() {
   // the hope is that we can recover the socket information on the next iteration,
   // if the connection appears to be stable.
 
-  Status s = proc_parser_->ReadProcPIDFDLink(pid_, fd_, &fd_link_);
+  Status s = ReadFDLink(&fd_link_, /* read_start_time */ nullptr);
   if (!s.ok()) {
     VLOG(2) << absl::Substitute("Can't set-up connection inference [msg=$0].", s.msg());
     active_ = false;
@@ -55,14 +96,15 @@ bool FDResolver::Update() {
   ECHECK(active_) << "FDResolver must be in active state.";
   ECHECK(!fd_link_.empty()) << "Candidate FD link should not be empty";
 
-  // Record the timestamp. Must be done before reading /proc,
+  // The timestamp must be from before the /proc read,
   // to avoid a race where we find the /proc FD entry, then the FD closes, then we grab the
   // timestamp. This would result in having an incorrect window of time during which the FD was
-  // valid.
-  std::chrono::time_point<std::chrono::steady_clock> timestamp = std::chrono::steady_clock::now();
+  // valid. ReadFDLink() provides such a timestamp (for cached reads, this may be earlier in the
+  // current cycle, when the FD table was actually scanned).
+  std::chrono::time_point<std::chrono::steady_clock> timestamp;
 
   std::string current_fd_link;
-  Status s = proc_parser_->ReadProcPIDFDLink(pid_, fd_, &current_fd_link);
+  Status s = ReadFDLink(&current_fd_link, &timestamp);
   if (!s.ok()) {
     VLOG(2) << "Can't infer remote endpoint. FD is not accessible.";
     active_ = false;
@@ -30,6 +30,55 @@
 namespace px {
 namespace stirling {
 
+/**
+ * FDLinkCache batches the /proc reads performed by FDResolvers.
+ *
+ * Instead of each resolver issuing its own readlink of /proc/<pid>/fd/<fd>, the cache reads a
+ * process's entire FD table at most once per cycle, and all resolvers for that process share the
+ * result. This matters during connection storms, where many trackers of the same process are
+ * pending FD resolution at once.
+ *
+ * The cached tables must be invalidated once per sampling cycle via NewCycle(), so that resolvers
+ * observe a fresh sample each cycle (required for their link-stability checks).
+ */
+class FDLinkCache {
+ public:
+  explicit FDLinkCache(system::ProcParser* proc_parser) : proc_parser_(proc_parser) {}
+
+  /**
+   * Returns the link contents of /proc/<pid>/fd/<fd>, reading the process's FD table on the
+   * first access for that PID in the current cycle.
+   *
+   * @param pid The PID whose FD to look up.
+   * @param fd The FD to look up.
+   * @param out A valid pointer to the output link contents.
+   * @param scan_time If non-null, set to a time just before the PID's FD table was scanned.
+   *                  This is a conservative lower bound on when the link was actually read.
+   * @return error if the FD table could not be read, or if the FD was not present in it.
+   */
+  Status GetFDLink(int pid, int fd, std::string* out,
+                   std::chrono::time_point<std::chrono::steady_clock>* scan_time = nullptr);
+
+  /**
+   * Invalidates all cached FD tables. Call once per sampling cycle.
+   */
+  void NewCycle() { fd_tables_.clear(); }
+
+ private:
+  struct FDTable {
+    // Time just before the FD table scan began.
+    std::chrono::time_point<std::chrono::steady_clock> scan_time;
+    absl::flat_hash_map<int32_t, std::string> links;
+  };
+
+  system::ProcParser* proc_parser_;
+
+  // FD tables scanned in the current cycle, keyed by PID.
+  // An entry is created even when the scan fails (leaving the table empty),
+  // so that a dead process is not re-scanned within a cycle.
+  absl::flat_hash_map<int, FDTable> fd_tables_;
+};
+
 /**
  * SocketResolver tries to determine the socket inode number of a given a PID and FD.
  *
@@ -48,8 +97,11 @@ class FDResolver {
    * @param proc_parser Pointer to a /proc parser which is used to read the FD info
    * @param pid The PID to monitor.
    * @param fd The FD of the PID to monitor.
+   * @param fd_link_cache Optional cache that batches FD table reads across resolvers.
+   *                      If nullptr, the resolver reads its FD link directly.
    */
-  FDResolver(system::ProcParser* proc_parser, int pid, int fd);
+  FDResolver(system::ProcParser* proc_parser, int pid, int fd,
+             FDLinkCache* fd_link_cache = nullptr);
 
   /**
    * Collects the first sample from Linux, to begin the tracking process.
@@ -85,10 +137,17 @@ class FDResolver {
   }
 
  private:
+  // Reads the FD link, through the cache if one was provided.
+  // read_start_time, if non-null, is set to a time no later than when the link was actually read.
+  Status ReadFDLink(std::string* link,
+                    std::chrono::time_point<std::chrono::steady_clock>* read_start_time);
+
   system::ProcParser* proc_parser_;
   int pid_;
   int fd_;
 
+  FDLinkCache* fd_link_cache_;
+
   bool active_;
 
   // The FD link contents that at setup time.
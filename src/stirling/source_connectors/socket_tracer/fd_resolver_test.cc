@@ -113,6 +113,60 @@ TEST_F(FDResolverTest, CaptureLongLivedSocket) {
   socket.Close();
 }
 
+TEST_F(FDResolverTest, CaptureLongLivedSocketViaCache) {
+  system::TCPSocket socket;
+  int pid = getpid();
+  int fd = socket.sockfd();
+
+  FDLinkCache cache(proc_parser_.get());
+
+  // Step 1 - Setup FDResolver, with the FD link coming from the shared cache.
+  auto resolver = FDResolver(proc_parser_.get(), pid, fd, &cache);
+  bool success = resolver.Setup();
+  ASSERT_TRUE(success);
+
+  // Assume some activity on the connection before next update (at time t).
+  auto t = std::chrono::steady_clock::now();
+
+  // A new cycle invalidates the cached FD tables, so Update() sees a fresh sample.
+  cache.NewCycle();
+
+  // Step 2 - Update FDResolver to capture connection if stable.
+  success = resolver.Update();
+  EXPECT_TRUE(success);
+
+  // FD link captured during established time window.
+  std::optional<std::string_view> fd_link = resolver.InferFDLink(t);
+  ASSERT_TRUE(fd_link.has_value());
+  EXPECT_THAT(*fd_link, StartsWith("socket:["));
+
+  socket.Close();
+}
+
+TEST_F(FDResolverTest, MissShortLivedSocketViaCache) {
+  system::TCPSocket socket;
+  int pid = getpid();
+  int fd = socket.sockfd();
+
+  FDLinkCache cache(proc_parser_.get());
+
+  // Step 1 - Setup FDResolver, with the FD link coming from the shared cache.
+  auto resolver = FDResolver(proc_parser_.get(), pid, fd, &cache);
+  bool success = resolver.Setup();
+  ASSERT_TRUE(success);
+
+  auto t = std::chrono::steady_clock::now();
+  socket.Close();
+
+  cache.NewCycle();
+
+  // Step 2 - The FD is gone from the fresh FD table sample, so Update() must fail.
+  success = resolver.Update();
+  EXPECT_FALSE(success);
+  std::optional<std::string_view> fd_link = resolver.InferFDLink(t);
+  EXPECT_FALSE(fd_link.has_value());
+}
+
 TEST_F(FDResolverTest, MissShortLivedSocketNoWindow) {
   system::TCPSocket socket;
   int pid = getpid();
@@ -34,8 +34,7 @@ enum class HTTPContentType {
   kGRPC = 2,
 };
 
-static const std::map<int64_t, std::string_view> kHTTPContentTypeDecoder =
-    px::EnumDefToMap<HTTPContentType>();
+constexpr auto kHTTPContentTypeDecoder = px::EnumDefToArray<HTTPContentType>();
 
 // clang-format off
 constexpr DataElement kHTTPElements[] = {
@@ -56,7 +55,7 @@ constexpr DataElement kHTTPElements[] = {
          types::DataType::INT64,
          types::SemanticType::ST_NONE,
          types::PatternType::GENERAL_ENUM,
-         &kHTTPContentTypeDecoder},
+         kHTTPContentTypeDecoder},
         {"req_headers", "Request headers in JSON format",
          types::DataType::STRING,
          types::SemanticType::ST_NONE,
@@ -28,8 +28,7 @@
 namespace px {
 namespace stirling {
 
-static const std::map<int64_t, std::string_view> kKafkaAPIKeyDecoder =
-    px::EnumDefToMap<protocols::kafka::APIKey>();
+constexpr auto kKafkaAPIKeyDecoder = px::EnumDefToArray<protocols::kafka::APIKey>();
 
 // clang-format off
 static constexpr DataElement kKafkaElements[] = {
@@ -42,7 +41,7 @@ static constexpr DataElement kKafkaElements[] = {
        types::DataType::INT64,
        types::SemanticType::ST_NONE,
        types::PatternType::GENERAL_ENUM,
-       &kKafkaAPIKeyDecoder},
+       kKafkaAPIKeyDecoder},
       {"client_id", "Kafka client ID",
        types::DataType::STRING,
        types::SemanticType::ST_NONE,
@@ -66,7 +66,21 @@ SocketTracerMetrics::SocketTracerMetrics(prometheus::Registry* registry,
                            .Add({
                                {"protocol", std::string(magic_enum::enum_name(protocol))},
                                {"tls_source", std::string(magic_enum::enum_name(tls_source))},
-                           })) {}
+                           })),
+      parse_frames_cycles(
+          prometheus::BuildHistogram()
+              .Name("parse_frames_cycles")
+              .Help("Sampled duration of ParseFrames() calls for this protocol, in CPU cycles "
+                    "(constant-rate counter, not normalized to wall time).")
+              .Register(*registry)
+              .Add(
+                  {
+                      {"protocol", std::string(magic_enum::enum_name(protocol))},
+                      {"tls_source", std::string(magic_enum::enum_name(tls_source))},
+                  },
+                  // Exponential buckets covering roughly 1us to 20ms on a ~3GHz machine.
+                  prometheus::Histogram::BucketBoundaries{4096, 16384, 65536, 262144, 1048576,
+                                                          4194304, 16777216, 67108864})) {}
 
 namespace {
 
@@ -28,10 +28,8 @@
 namespace px {
 namespace stirling {
 
-static const std::map<int64_t, std::string_view> kMySQLReqCmdDecoder =
-    px::EnumDefToMap<protocols::mysql::Command>();
-static const std::map<int64_t, std::string_view> kMySQLRespStatusDecoder =
-    px::EnumDefToMap<protocols::mysql::RespStatus>();
+constexpr auto kMySQLReqCmdDecoder = px::EnumDefToArray<protocols::mysql::Command>();
+constexpr auto kMySQLRespStatusDecoder = px::EnumDefToArray<protocols::mysql::RespStatus>();
 
 // clang-format off
 static constexpr DataElement kMySQLElements[] = {
@@ -44,7 +42,7 @@ static constexpr DataElement kMySQLElements[] = {
          types::DataType::INT64,
          types::SemanticType::ST_NONE,
          types::PatternType::GENERAL_ENUM,
-         &kMySQLReqCmdDecoder},
+         kMySQLReqCmdDecoder},
         {"req_body", "MySQL request body",
          types::DataType::STRING,
          types::SemanticType::ST_NONE,
@@ -53,7 +51,7 @@ static constexpr DataElement kMySQLElements[] = {
          types::DataType::INT64,
          types::SemanticType::ST_NONE,
          types::PatternType::GENERAL_ENUM,
-         &kMySQLRespStatusDecoder},
+         kMySQLRespStatusDecoder},
         {"resp_body", "MySQL response body",
          types::DataType::STRING,
          types::SemanticType::ST_NONE,
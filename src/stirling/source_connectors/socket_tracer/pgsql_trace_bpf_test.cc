@@ -180,7 +180,7 @@ TEST_F(PostgreSQLTraceTest, GolangSqlxDemo) {
                      "result_format_codes=[]",
                      "BIND COMPLETE", Tag::kBind),
           ReqRespCmd("query=[SELECT * FROM person WHERE first_name=$1] params=[Jason]",
-                     "Jason,Moiron,jmoiron@jmoiron.net\n"
+                     "1 data rows, 44 bytes\n"
                      "SELECT 1",
                      Tag::kExecute)));
 }
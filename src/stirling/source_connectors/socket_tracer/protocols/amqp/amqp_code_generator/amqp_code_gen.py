@@ -56,9 +56,11 @@ class FieldType(Enum):
             FieldType.short: "uint16_t",
             FieldType.long: "uint32_t",
             FieldType.longlong: "uint64_t",
-            FieldType.shortstr: "std::string",
-            FieldType.longstr: "std::string",
-            FieldType.table: "std::string",
+            # Strings are extracted as views into the frame buffer to avoid intermediate
+            # copies; the decoded struct only lives until it is serialized into Frame::msg.
+            FieldType.shortstr: "std::string_view",
+            FieldType.longstr: "std::string_view",
+            FieldType.table: "std::string_view",
             FieldType.timestamp: "time_t",
         }
 
@@ -265,18 +267,16 @@ class AMQPMethod:
         """
         return f"k{self.c_struct_name} = {self.method_id}"
 
-    def gen_method_enum_select_case(self, constant_enum_name):
+    def gen_dispatch_table_entry(self, class_enum_value):
         """
-        Case used to Select the correct method to extract. The generated form will be
-        switch (static_cast<AMQPChannelMethods>(method_id))
-            case AMQPChannelMethods::kAMQPChannelOpen:
-                return ExtractAMQPChannelOpen(decoder, req);
-            ...
-        """
-        return f"""
-            case {constant_enum_name}::k{self.c_struct_name}:
-                return Extract{self.c_struct_name}(decoder, req);
+        Entry in the method dispatch table mapping (class_id, method_id) to the generated
+        per-method decoder:
+        {MethodKey(AMQPClasses::kChannel, kAMQPChannelOpen), &ExtractAMQPChannelOpen},
         """
+        return (
+            f"{{MethodKey({class_enum_value}, k{self.c_struct_name}),"
+            f" &Extract{self.c_struct_name}}},"
+        )
 
     def get_class_buffer_extract(self):
         """
@@ -379,30 +379,16 @@ class AMQPClass:
                 return Extract{self.content_header_method.c_struct_name}(decoder, req);
         """
 
-    def gen_method_select(self):
+    def gen_dispatch_table_entries(self):
         """
-        This will select the relevant method to extract from the buffer for a specific class.
-        switch (static_cast<AMQPChannelMethods>(method_id))
-            case AMQPChannelMethods::kAMQPChannelOpen:
-                return ExtractAMQPChannelOpen(decoder, req);
-            ...
+        Generates the dispatch table entries for all methods of this class:
+        {MethodKey(AMQPClasses::kChannel, kAMQPChannelOpen), &ExtractAMQPChannelOpen},
+        ...
         """
-        method_cases = "\n".join(
-            [
-                method.gen_method_enum_select_case(self.constant_enum_name)
-                for method in self.methods
-            ]
+        class_enum_value = f"AMQPClasses::k{self.class_name}"
+        return "\n".join(
+            [method.gen_dispatch_table_entry(class_enum_value) for method in self.methods]
         )
-        return f"""
-            Status Process{self.class_name}(BinaryDecoder *decoder, Frame *req, uint16_t  method_id) {{
-                switch(static_cast<{self.constant_enum_name}>(method_id)) {{
-                    {method_cases}
-                    default:
-                        VLOG(1) << absl::Substitute("Invalid {self.class_name} frame method $0", method_id);
-                }}
-                return Status::OK();
-            }}
-        """
 
     def gen_class_enum_declr(self):
         """
@@ -414,18 +400,6 @@ class AMQPClass:
         """
         return f"k{self.class_name} = {self.class_id}"
 
-    def gen_class_enum_select_case(self):
-        """
-        This will be included to easily select the extraction methods given class_id for Content Header Frame Type
-        switch (class_id) {
-            case AMQPConnectionMethods::kAMQPConnectionStart:
-                return ExtractAMQPConnectionStart(decoder, req);
-        """
-        return f"""
-            case AMQPClasses::k{self.class_name}:
-                return Process{self.class_name}(decoder, req, method_id);
-        """
-
 
 class CodeGenerator:
     """
@@ -649,42 +623,54 @@ class CodeGenerator:
             )
         return "\n".join(buffer_extract_methods)
 
-    def gen_method_select(self):
+    def gen_method_dispatch_table(self):
         """
-        Generates all the method selectors for the AMQPClasses
+        Generates a single table mapping (class_id, method_id) to the generated per-method
+        decoder. A flat table lookup replaces the previous per-class switch cascade.
+        """
+        dispatch_entries = "\n".join(
+            [amqp_class.gen_dispatch_table_entries() for amqp_class in self.amqp_classes]
+        )
+        return f"""
+        namespace {{
+
+        using MethodDecodeFn = Status (*)(BinaryDecoder*, Frame*);
+
+        constexpr uint32_t MethodKey(AMQPClasses class_id, uint16_t method_id) {{
+            return (static_cast<uint32_t>(class_id) << 16) | method_id;
+        }}
+
+        // Dispatch table mapping (class_id, method_id) to the generated per-method decoder.
+        const absl::flat_hash_map<uint32_t, MethodDecodeFn>& MethodDecoders() {{
+            static const auto* decoders = new absl::flat_hash_map<uint32_t, MethodDecodeFn>{{
+                {dispatch_entries}
+            }};
+            return *decoders;
+        }}
+
+        }}  // namespace
         """
-        class_select_methods = []
-        for amqp_class in self.amqp_classes:
-            class_select_methods.append(amqp_class.gen_method_select())
-        return "\n".join(class_select_methods)
 
     def gen_class_select(self):
         """
-        Given a buffer, uses the class_id to find list of functions that can extract the buffer.
-        Given the class_id, a list of relevant methods to the AMQP class can be found via method_id.
+        Given a buffer, extracts the class_id and method_id and dispatches to the matching
+        decoder via the method dispatch table.
         """
-
-        amqp_extract_class_case = []
-        for amqp_class in self.amqp_classes:
-            amqp_extract_class_case.append(amqp_class.gen_class_enum_select_case())
-
-        amqp_extract_class_case_str = "\n".join(amqp_extract_class_case)
-        return f"""
-        Status ProcessFrameMethod(BinaryDecoder* decoder, Frame* req) {{
+        return """
+        Status ProcessFrameMethod(BinaryDecoder* decoder, Frame* req) {
             PX_ASSIGN_OR_RETURN(uint16_t class_id, decoder->ExtractInt<uint16_t>());
             PX_ASSIGN_OR_RETURN(uint16_t method_id, decoder->ExtractInt<uint16_t>());
 
             req->class_id = class_id;
             req->method_id = method_id;
 
-            switch(static_cast<AMQPClasses>(class_id)) {{
-                {amqp_extract_class_case_str}
-                default:
-                    VLOG(1) << absl::Substitute("Unparsed frame method class $0 method $1", class_id, method_id);
-            }}
-
-            return Status::OK();
-        }}
+            auto it = MethodDecoders().find(MethodKey(static_cast<AMQPClasses>(class_id), method_id));
+            if (it == MethodDecoders().end()) {
+                VLOG(1) << absl::Substitute("Unparsed frame method class $0 method $1", class_id, method_id);
+                return Status::OK();
+            }
+            return it->second(decoder, req);
+        }
         """
 
     def gen_process_frame_type(self):
@@ -882,7 +868,7 @@ class CodeGeneratorWriter:
         process_class_methods = self.generator.gen_buffer_extract()
         process_content_header = self.generator.gen_process_content_header_select()
 
-        process_method_type = self.generator.gen_method_select()
+        process_method_type = self.generator.gen_method_dispatch_table()
         process_class_type = self.generator.gen_class_select()
         process_frame_type = self.generator.gen_process_frame_type()
 
@@ -165,14 +165,11 @@ class TestAMQPMethod(BaseTestCase):
             self.amqp_method.gen_method_enum_declr(), "kAMQPSampleClassSampleMethod = 1"
         )
 
-    def test_gen_method_enum_select_case(self):
+    def test_gen_dispatch_table_entry(self):
         self.assertEqualGenStr(
-            self.amqp_method.gen_method_enum_select_case(
-                "Connection"
-            ),  # TODO PASS CLASS NAME HERE
+            self.amqp_method.gen_dispatch_table_entry("AMQPClasses::kConnection"),
             """
-            case Connection::kAMQPSampleClassSampleMethod:
-                return ExtractAMQPSampleClassSampleMethod(decoder, req);
+            {MethodKey(AMQPClasses::kConnection, kAMQPSampleClassSampleMethod), &ExtractAMQPSampleClassSampleMethod},
             """,
         )
 
@@ -211,19 +208,11 @@ class TestAMQPClass(BaseTestCase):
             """,
         )
 
-    def test_gen_method_select(self):
+    def test_gen_dispatch_table_entries(self):
         self.assertEqualGenStr(
-            self.sample_class.gen_method_select(),
+            self.sample_class.gen_dispatch_table_entries(),
             """
-            Status ProcessSampleClass(BinaryDecoder *decoder, Frame *req, uint16_t  method_id) {
-                switch(static_cast<AMQPSampleClassMethods>(method_id)) {
-                    case AMQPSampleClassMethods::kAMQPSampleclassSampleMethod:
-                        return ExtractAMQPSampleclassSampleMethod(decoder, req);
-                    default:
-                        VLOG(1)<<absl::Substitute("Invalid Sample Class frame method $0", method_id);
-                }
-                return Status::OK();
-            }
+            {MethodKey(AMQPClasses::kSampleClass, kAMQPSampleclassSampleMethod), &ExtractAMQPSampleclassSampleMethod},
             """,
         )
 
@@ -239,15 +228,6 @@ class TestAMQPClass(BaseTestCase):
             """,
         )
 
-    def test_gen_class_enum_select_case(self):
-        self.assertEqualGenStr(
-            self.sample_class.gen_class_enum_select_case(),
-            """
-            case AMQPClasses::kSampleClass:
-                return ProcessSampleClass(decoder, req, method_id);
-            """,
-        )
-
 
 class TestAMQPCodeGeneratorParse(BaseTestCase):
     def setUp(self) -> None:
@@ -558,19 +538,27 @@ class TestAMQPCodeGeneratorGen(BaseTestCase):
             """,
         )
 
-    def test_gen_method_select(self):
+    def test_gen_method_dispatch_table(self):
         self.assertEqualGenStr(
-            self.code_generator_single_class.gen_method_select(),
+            self.code_generator_single_class.gen_method_dispatch_table(),
             """
-            Status ProcessConnection(BinaryDecoder *decoder, Frame *req, uint16_t  method_id) {
-                switch(static_cast<AMQPConnectionMethods>(method_id)) {
-                    case AMQPConnectionMethods::kAMQPConnectionStart:
-                        return ExtractAMQPConnectionStart(decoder, req);
-                    default:
-                        VLOG(1)<<absl::Substitute("Invalid Connection frame method $0", method_id);
-                }
-                returnStatus::OK();
+            namespace {
+
+            using MethodDecodeFn = Status (*)(BinaryDecoder*, Frame*);
+
+            constexpr uint32_t MethodKey(AMQPClasses class_id, uint16_t method_id) {
+                return (static_cast<uint32_t>(class_id) << 16) | method_id;
+            }
+
+            // Dispatch table mapping (class_id, method_id) to the generated per-method decoder.
+            const absl::flat_hash_map<uint32_t, MethodDecodeFn>& MethodDecoders() {
+                static const auto* decoders = new absl::flat_hash_map<uint32_t, MethodDecodeFn>{
+                    {MethodKey(AMQPClasses::kConnection, kAMQPConnectionStart), &ExtractAMQPConnectionStart},
+                };
+                return *decoders;
             }
+
+            }  // namespace
             """,
         )
 
@@ -585,13 +573,12 @@ class TestAMQPCodeGeneratorGen(BaseTestCase):
                 req->class_id = class_id;
                 req->method_id = method_id;
 
-                switch(static_cast<AMQPClasses>(class_id)) {
-                    case AMQPClasses::kConnection:
-                        return ProcessConnection(decoder, req, method_id);
-                    default:
-                        VLOG(1)<<absl::Substitute("Unparsed frame method class $0 method $1", class_id, method_id);
+                auto it = MethodDecoders().find(MethodKey(static_cast<AMQPClasses>(class_id), method_id));
+                if (it == MethodDecoders().end()) {
+                    VLOG(1) << absl::Substitute("Unparsed frame method class $0 method $1", class_id, method_id);
+                    return Status::OK();
                 }
-                return Status::OK();
+                return it->second(decoder, req);
             }
             """,
         )
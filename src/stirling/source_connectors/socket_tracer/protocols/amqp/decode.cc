@@ -18,6 +18,8 @@
 // Code generated by AMQP protocol generator. DO NOT EDIT.
 #include "src/stirling/source_connectors/socket_tracer/protocols/amqp/decode.h"
 
+#include <absl/container/flat_hash_map.h>
+
 #include <map>
 #include <stack>
 #include <string>
@@ -33,13 +35,15 @@ namespace stirling {
 namespace protocols {
 namespace amqp {
 
-StatusOr<std::string> ExtractShortString(BinaryDecoder* decoder) {
+// String fields are extracted as views into the frame buffer. The decoded struct only lives
+// until it is serialized into Frame::msg, so no intermediate copies are needed.
+StatusOr<std::string_view> ExtractShortString(BinaryDecoder* decoder) {
   // Short string defined as 2*OCTET(short-uint)
   PX_ASSIGN_OR_RETURN(uint8_t len, decoder->ExtractInt<uint8_t>());
   return decoder->ExtractString(len);
 }
 
-StatusOr<std::string> ExtractLongString(BinaryDecoder* decoder) {
+StatusOr<std::string_view> ExtractLongString(BinaryDecoder* decoder) {
   // Long string defined as 4*OCTET(short-uint)
   PX_ASSIGN_OR_RETURN(uint32_t len, decoder->ExtractInt<uint32_t>());
   return decoder->ExtractString(len);
@@ -731,212 +735,76 @@ Status ProcessContentHeader(BinaryDecoder* decoder, Frame* req) {
   return Status::OK();
 }
 
-Status ProcessConnection(BinaryDecoder* decoder, Frame* req, uint16_t method_id) {
-  switch (static_cast<AMQPConnectionMethods>(method_id)) {
-    case AMQPConnectionMethods::kAMQPConnectionStart:
-      return ExtractAMQPConnectionStart(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionStartOk:
-      return ExtractAMQPConnectionStartOk(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionSecure:
-      return ExtractAMQPConnectionSecure(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionSecureOk:
-      return ExtractAMQPConnectionSecureOk(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionTune:
-      return ExtractAMQPConnectionTune(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionTuneOk:
-      return ExtractAMQPConnectionTuneOk(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionOpen:
-      return ExtractAMQPConnectionOpen(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionOpenOk:
-      return ExtractAMQPConnectionOpenOk(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionClose:
-      return ExtractAMQPConnectionClose(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionCloseOk:
-      return ExtractAMQPConnectionCloseOk(decoder, req);
-
-    default:
-      VLOG(1) << absl::Substitute("Invalid Connection frame method $0", method_id);
-  }
-  return Status::OK();
-}
-
-Status ProcessChannel(BinaryDecoder* decoder, Frame* req, uint16_t method_id) {
-  switch (static_cast<AMQPChannelMethods>(method_id)) {
-    case AMQPChannelMethods::kAMQPChannelOpen:
-      return ExtractAMQPChannelOpen(decoder, req);
-
-    case AMQPChannelMethods::kAMQPChannelOpenOk:
-      return ExtractAMQPChannelOpenOk(decoder, req);
-
-    case AMQPChannelMethods::kAMQPChannelFlow:
-      return ExtractAMQPChannelFlow(decoder, req);
-
-    case AMQPChannelMethods::kAMQPChannelFlowOk:
-      return ExtractAMQPChannelFlowOk(decoder, req);
-
-    case AMQPChannelMethods::kAMQPChannelClose:
-      return ExtractAMQPChannelClose(decoder, req);
-
-    case AMQPChannelMethods::kAMQPChannelCloseOk:
-      return ExtractAMQPChannelCloseOk(decoder, req);
-
-    default:
-      VLOG(1) << absl::Substitute("Invalid Channel frame method $0", method_id);
-  }
-  return Status::OK();
-}
-
-Status ProcessExchange(BinaryDecoder* decoder, Frame* req, uint16_t method_id) {
-  switch (static_cast<AMQPExchangeMethods>(method_id)) {
-    case AMQPExchangeMethods::kAMQPExchangeDeclare:
-      return ExtractAMQPExchangeDeclare(decoder, req);
-
-    case AMQPExchangeMethods::kAMQPExchangeDeclareOk:
-      return ExtractAMQPExchangeDeclareOk(decoder, req);
-
-    case AMQPExchangeMethods::kAMQPExchangeDelete:
-      return ExtractAMQPExchangeDelete(decoder, req);
-
-    case AMQPExchangeMethods::kAMQPExchangeDeleteOk:
-      return ExtractAMQPExchangeDeleteOk(decoder, req);
-
-    default:
-      VLOG(1) << absl::Substitute("Invalid Exchange frame method $0", method_id);
-  }
-  return Status::OK();
-}
-
-Status ProcessQueue(BinaryDecoder* decoder, Frame* req, uint16_t method_id) {
-  switch (static_cast<AMQPQueueMethods>(method_id)) {
-    case AMQPQueueMethods::kAMQPQueueDeclare:
-      return ExtractAMQPQueueDeclare(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueueDeclareOk:
-      return ExtractAMQPQueueDeclareOk(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueueBind:
-      return ExtractAMQPQueueBind(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueueBindOk:
-      return ExtractAMQPQueueBindOk(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueueUnbind:
-      return ExtractAMQPQueueUnbind(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueueUnbindOk:
-      return ExtractAMQPQueueUnbindOk(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueuePurge:
-      return ExtractAMQPQueuePurge(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueuePurgeOk:
-      return ExtractAMQPQueuePurgeOk(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueueDelete:
-      return ExtractAMQPQueueDelete(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueueDeleteOk:
-      return ExtractAMQPQueueDeleteOk(decoder, req);
-
-    default:
-      VLOG(1) << absl::Substitute("Invalid Queue frame method $0", method_id);
-  }
-  return Status::OK();
-}
-
-Status ProcessBasic(BinaryDecoder* decoder, Frame* req, uint16_t method_id) {
-  switch (static_cast<AMQPBasicMethods>(method_id)) {
-    case AMQPBasicMethods::kAMQPBasicQos:
-      return ExtractAMQPBasicQos(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicQosOk:
-      return ExtractAMQPBasicQosOk(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicConsume:
-      return ExtractAMQPBasicConsume(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicConsumeOk:
-      return ExtractAMQPBasicConsumeOk(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicCancel:
-      return ExtractAMQPBasicCancel(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicCancelOk:
-      return ExtractAMQPBasicCancelOk(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicPublish:
-      return ExtractAMQPBasicPublish(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicReturn:
-      return ExtractAMQPBasicReturn(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicDeliver:
-      return ExtractAMQPBasicDeliver(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicGet:
-      return ExtractAMQPBasicGet(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicGetOk:
-      return ExtractAMQPBasicGetOk(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicGetEmpty:
-      return ExtractAMQPBasicGetEmpty(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicAck:
-      return ExtractAMQPBasicAck(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicReject:
-      return ExtractAMQPBasicReject(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicRecoverAsync:
-      return ExtractAMQPBasicRecoverAsync(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicRecover:
-      return ExtractAMQPBasicRecover(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicRecoverOk:
-      return ExtractAMQPBasicRecoverOk(decoder, req);
-
-    default:
-      VLOG(1) << absl::Substitute("Invalid Basic frame method $0", method_id);
-  }
-  return Status::OK();
-}
-
-Status ProcessTx(BinaryDecoder* decoder, Frame* req, uint16_t method_id) {
-  switch (static_cast<AMQPTxMethods>(method_id)) {
-    case AMQPTxMethods::kAMQPTxSelect:
-      return ExtractAMQPTxSelect(decoder, req);
-
-    case AMQPTxMethods::kAMQPTxSelectOk:
-      return ExtractAMQPTxSelectOk(decoder, req);
-
-    case AMQPTxMethods::kAMQPTxCommit:
-      return ExtractAMQPTxCommit(decoder, req);
-
-    case AMQPTxMethods::kAMQPTxCommitOk:
-      return ExtractAMQPTxCommitOk(decoder, req);
-
-    case AMQPTxMethods::kAMQPTxRollback:
-      return ExtractAMQPTxRollback(decoder, req);
-
-    case AMQPTxMethods::kAMQPTxRollbackOk:
-      return ExtractAMQPTxRollbackOk(decoder, req);
-
-    default:
-      VLOG(1) << absl::Substitute("Invalid Tx frame method $0", method_id);
-  }
-  return Status::OK();
-}
+namespace {
+
+using MethodDecodeFn = Status (*)(BinaryDecoder*, Frame*);
+
+constexpr uint32_t MethodKey(AMQPClasses class_id, uint16_t method_id) {
+  return (static_cast<uint32_t>(class_id) << 16) | method_id;
+}
+
+// Dispatch table mapping (class_id, method_id) to the generated per-method decoder.
+const absl::flat_hash_map<uint32_t, MethodDecodeFn>& MethodDecoders() {
+  static const auto* decoders = new absl::flat_hash_map<uint32_t, MethodDecodeFn>{
+      {MethodKey(AMQPClasses::kConnection, kAMQPConnectionStart), &ExtractAMQPConnectionStart},
+      {MethodKey(AMQPClasses::kConnection, kAMQPConnectionStartOk), &ExtractAMQPConnectionStartOk},
+      {MethodKey(AMQPClasses::kConnection, kAMQPConnectionSecure), &ExtractAMQPConnectionSecure},
+      {MethodKey(AMQPClasses::kConnection, kAMQPConnectionSecureOk),
+       &ExtractAMQPConnectionSecureOk},
+      {MethodKey(AMQPClasses::kConnection, kAMQPConnectionTune), &ExtractAMQPConnectionTune},
+      {MethodKey(AMQPClasses::kConnection, kAMQPConnectionTuneOk), &ExtractAMQPConnectionTuneOk},
+      {MethodKey(AMQPClasses::kConnection, kAMQPConnectionOpen), &ExtractAMQPConnectionOpen},
+      {MethodKey(AMQPClasses::kConnection, kAMQPConnectionOpenOk), &ExtractAMQPConnectionOpenOk},
+      {MethodKey(AMQPClasses::kConnection, kAMQPConnectionClose), &ExtractAMQPConnectionClose},
+      {MethodKey(AMQPClasses::kConnection, kAMQPConnectionCloseOk), &ExtractAMQPConnectionCloseOk},
+      {MethodKey(AMQPClasses::kChannel, kAMQPChannelOpen), &ExtractAMQPChannelOpen},
+      {MethodKey(AMQPClasses::kChannel, kAMQPChannelOpenOk), &ExtractAMQPChannelOpenOk},
+      {MethodKey(AMQPClasses::kChannel, kAMQPChannelFlow), &ExtractAMQPChannelFlow},
+      {MethodKey(AMQPClasses::kChannel, kAMQPChannelFlowOk), &ExtractAMQPChannelFlowOk},
+      {MethodKey(AMQPClasses::kChannel, kAMQPChannelClose), &ExtractAMQPChannelClose},
+      {MethodKey(AMQPClasses::kChannel, kAMQPChannelCloseOk), &ExtractAMQPChannelCloseOk},
+      {MethodKey(AMQPClasses::kExchange, kAMQPExchangeDeclare), &ExtractAMQPExchangeDeclare},
+      {MethodKey(AMQPClasses::kExchange, kAMQPExchangeDeclareOk), &ExtractAMQPExchangeDeclareOk},
+      {MethodKey(AMQPClasses::kExchange, kAMQPExchangeDelete), &ExtractAMQPExchangeDelete},
+      {MethodKey(AMQPClasses::kExchange, kAMQPExchangeDeleteOk), &ExtractAMQPExchangeDeleteOk},
+      {MethodKey(AMQPClasses::kQueue, kAMQPQueueDeclare), &ExtractAMQPQueueDeclare},
+      {MethodKey(AMQPClasses::kQueue, kAMQPQueueDeclareOk), &ExtractAMQPQueueDeclareOk},
+      {MethodKey(AMQPClasses::kQueue, kAMQPQueueBind), &ExtractAMQPQueueBind},
+      {MethodKey(AMQPClasses::kQueue, kAMQPQueueBindOk), &ExtractAMQPQueueBindOk},
+      {MethodKey(AMQPClasses::kQueue, kAMQPQueueUnbind), &ExtractAMQPQueueUnbind},
+      {MethodKey(AMQPClasses::kQueue, kAMQPQueueUnbindOk), &ExtractAMQPQueueUnbindOk},
+      {MethodKey(AMQPClasses::kQueue, kAMQPQueuePurge), &ExtractAMQPQueuePurge},
+      {MethodKey(AMQPClasses::kQueue, kAMQPQueuePurgeOk), &ExtractAMQPQueuePurgeOk},
+      {MethodKey(AMQPClasses::kQueue, kAMQPQueueDelete), &ExtractAMQPQueueDelete},
+      {MethodKey(AMQPClasses::kQueue, kAMQPQueueDeleteOk), &ExtractAMQPQueueDeleteOk},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicQos), &ExtractAMQPBasicQos},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicQosOk), &ExtractAMQPBasicQosOk},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicConsume), &ExtractAMQPBasicConsume},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicConsumeOk), &ExtractAMQPBasicConsumeOk},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicCancel), &ExtractAMQPBasicCancel},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicCancelOk), &ExtractAMQPBasicCancelOk},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicPublish), &ExtractAMQPBasicPublish},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicReturn), &ExtractAMQPBasicReturn},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicDeliver), &ExtractAMQPBasicDeliver},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicGet), &ExtractAMQPBasicGet},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicGetOk), &ExtractAMQPBasicGetOk},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicGetEmpty), &ExtractAMQPBasicGetEmpty},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicAck), &ExtractAMQPBasicAck},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicReject), &ExtractAMQPBasicReject},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicRecoverAsync), &ExtractAMQPBasicRecoverAsync},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicRecover), &ExtractAMQPBasicRecover},
+      {MethodKey(AMQPClasses::kBasic, kAMQPBasicRecoverOk), &ExtractAMQPBasicRecoverOk},
+      {MethodKey(AMQPClasses::kTx, kAMQPTxSelect), &ExtractAMQPTxSelect},
+      {MethodKey(AMQPClasses::kTx, kAMQPTxSelectOk), &ExtractAMQPTxSelectOk},
+      {MethodKey(AMQPClasses::kTx, kAMQPTxCommit), &ExtractAMQPTxCommit},
+      {MethodKey(AMQPClasses::kTx, kAMQPTxCommitOk), &ExtractAMQPTxCommitOk},
+      {MethodKey(AMQPClasses::kTx, kAMQPTxRollback), &ExtractAMQPTxRollback},
+      {MethodKey(AMQPClasses::kTx, kAMQPTxRollbackOk), &ExtractAMQPTxRollbackOk},
+  };
+  return *decoders;
+}
+
+}  // namespace
 
 Status ProcessFrameMethod(BinaryDecoder* decoder, Frame* req) {
   PX_ASSIGN_OR_RETURN(uint16_t class_id, decoder->ExtractInt<uint16_t>());
@@ -945,29 +813,12 @@ Status ProcessFrameMethod(BinaryDecoder* decoder, Frame* req) {
   req->class_id = class_id;
   req->method_id = method_id;
 
-  switch (static_cast<AMQPClasses>(class_id)) {
-    case AMQPClasses::kConnection:
-      return ProcessConnection(decoder, req, method_id);
-
-    case AMQPClasses::kChannel:
-      return ProcessChannel(decoder, req, method_id);
-
-    case AMQPClasses::kExchange:
-      return ProcessExchange(decoder, req, method_id);
-
-    case AMQPClasses::kQueue:
-      return ProcessQueue(decoder, req, method_id);
-
-    case AMQPClasses::kBasic:
-      return ProcessBasic(decoder, req, method_id);
-
-    case AMQPClasses::kTx:
-      return ProcessTx(decoder, req, method_id);
-
-    default:
-      VLOG(1) << absl::Substitute("Unparsed frame method class $0 method $1", class_id, method_id);
+  auto it = MethodDecoders().find(MethodKey(static_cast<AMQPClasses>(class_id), method_id));
+  if (it == MethodDecoders().end()) {
+    VLOG(1) << absl::Substitute("Unparsed frame method class $0 method $1", class_id, method_id);
+    return Status::OK();
   }
-  return Status::OK();
+  return it->second(decoder, req);
 }
 
 Status ProcessPayload(Frame* req, BinaryDecoder* decoder) {
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include "src/stirling/source_connectors/socket_tracer/protocols/amqp/types_gen.h"
 
 #include "src/common/base/base.h"
@@ -33,9 +34,9 @@ namespace amqp {
 struct AMQPConnectionStart {
   uint8_t version_major = 0;
   uint8_t version_minor = 0;
-  std::string server_properties = "";
-  std::string mechanisms = "";
-  std::string locales = "";
+  std::string_view server_properties = "";
+  std::string_view mechanisms = "";
+  std::string_view locales = "";
   bool synchronous = 1;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -48,10 +49,10 @@ struct AMQPConnectionStart {
 };
 
 struct AMQPConnectionStartOk {
-  std::string client_properties = "";
-  std::string mechanism = "";
-  std::string response = "";
-  std::string locale = "";
+  std::string_view client_properties = "";
+  std::string_view mechanism = "";
+  std::string_view response = "";
+  std::string_view locale = "";
   bool synchronous = 1;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -63,14 +64,14 @@ struct AMQPConnectionStartOk {
 };
 
 struct AMQPConnectionSecure {
-  std::string challenge = "";
+  std::string_view challenge = "";
   bool synchronous = 1;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const { builder->WriteKV("challenge", challenge); }
 };
 
 struct AMQPConnectionSecureOk {
-  std::string response = "";
+  std::string_view response = "";
   bool synchronous = 1;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const { builder->WriteKV("response", response); }
@@ -103,8 +104,8 @@ struct AMQPConnectionTuneOk {
 };
 
 struct AMQPConnectionOpen {
-  std::string virtual_host = "";
-  std::string reserved_1 = "";
+  std::string_view virtual_host = "";
+  std::string_view reserved_1 = "";
   bool reserved_2 = 0;
   bool synchronous = 1;
 
@@ -116,7 +117,7 @@ struct AMQPConnectionOpen {
 };
 
 struct AMQPConnectionOpenOk {
-  std::string reserved_1 = "";
+  std::string_view reserved_1 = "";
   bool synchronous = 1;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -126,7 +127,7 @@ struct AMQPConnectionOpenOk {
 
 struct AMQPConnectionClose {
   uint16_t reply_code = 0;
-  std::string reply_text = "";
+  std::string_view reply_text = "";
   uint16_t class_id = 0;
   uint16_t method_id = 0;
   bool synchronous = 1;
@@ -157,7 +158,7 @@ struct AMQPConnectionContentHeader {
 };
 
 struct AMQPChannelOpen {
-  std::string reserved_1 = "";
+  std::string_view reserved_1 = "";
   bool synchronous = 1;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -166,7 +167,7 @@ struct AMQPChannelOpen {
 };
 
 struct AMQPChannelOpenOk {
-  std::string reserved_1 = "";
+  std::string_view reserved_1 = "";
   bool synchronous = 1;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -190,7 +191,7 @@ struct AMQPChannelFlowOk {
 
 struct AMQPChannelClose {
   uint16_t reply_code = 0;
-  std::string reply_text = "";
+  std::string_view reply_text = "";
   uint16_t class_id = 0;
   uint16_t method_id = 0;
   bool synchronous = 1;
@@ -222,14 +223,14 @@ struct AMQPChannelContentHeader {
 
 struct AMQPExchangeDeclare {
   uint16_t reserved_1 = 0;
-  std::string exchange = "";
-  std::string type = "";
+  std::string_view exchange = "";
+  std::string_view type = "";
   bool passive = 0;
   bool durable = 0;
   bool reserved_2 = 0;
   bool reserved_3 = 0;
   bool no_wait = 0;
-  std::string arguments = "";
+  std::string_view arguments = "";
   bool synchronous = 1;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -253,7 +254,7 @@ struct AMQPExchangeDeclareOk {
 
 struct AMQPExchangeDelete {
   uint16_t reserved_1 = 0;
-  std::string exchange = "";
+  std::string_view exchange = "";
   bool if_unused = 0;
   bool no_wait = 0;
   bool synchronous = 1;
@@ -285,13 +286,13 @@ struct AMQPExchangeContentHeader {
 
 struct AMQPQueueDeclare {
   uint16_t reserved_1 = 0;
-  std::string queue = "";
+  std::string_view queue = "";
   bool passive = 0;
   bool durable = 0;
   bool exclusive = 0;
   bool auto_delete = 0;
   bool no_wait = 0;
-  std::string arguments = "";
+  std::string_view arguments = "";
   bool synchronous = 1;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -307,7 +308,7 @@ struct AMQPQueueDeclare {
 };
 
 struct AMQPQueueDeclareOk {
-  std::string queue = "";
+  std::string_view queue = "";
   uint32_t message_count = 0;
   uint32_t consumer_count = 0;
   bool synchronous = 1;
@@ -321,11 +322,11 @@ struct AMQPQueueDeclareOk {
 
 struct AMQPQueueBind {
   uint16_t reserved_1 = 0;
-  std::string queue = "";
-  std::string exchange = "";
-  std::string routing_key = "";
+  std::string_view queue = "";
+  std::string_view exchange = "";
+  std::string_view routing_key = "";
   bool no_wait = 0;
-  std::string arguments = "";
+  std::string_view arguments = "";
   bool synchronous = 1;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -346,10 +347,10 @@ struct AMQPQueueBindOk {
 
 struct AMQPQueueUnbind {
   uint16_t reserved_1 = 0;
-  std::string queue = "";
-  std::string exchange = "";
-  std::string routing_key = "";
-  std::string arguments = "";
+  std::string_view queue = "";
+  std::string_view exchange = "";
+  std::string_view routing_key = "";
+  std::string_view arguments = "";
   bool synchronous = 1;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -369,7 +370,7 @@ struct AMQPQueueUnbindOk {
 
 struct AMQPQueuePurge {
   uint16_t reserved_1 = 0;
-  std::string queue = "";
+  std::string_view queue = "";
   bool no_wait = 0;
   bool synchronous = 1;
 
@@ -391,7 +392,7 @@ struct AMQPQueuePurgeOk {
 
 struct AMQPQueueDelete {
   uint16_t reserved_1 = 0;
-  std::string queue = "";
+  std::string_view queue = "";
   bool if_unused = 0;
   bool if_empty = 0;
   bool no_wait = 0;
@@ -447,13 +448,13 @@ struct AMQPBasicQosOk {
 
 struct AMQPBasicConsume {
   uint16_t reserved_1 = 0;
-  std::string queue = "";
-  std::string consumer_tag = "";
+  std::string_view queue = "";
+  std::string_view consumer_tag = "";
   bool no_local = 0;
   bool no_ack = 0;
   bool exclusive = 0;
   bool no_wait = 0;
-  std::string arguments = "";
+  std::string_view arguments = "";
   bool synchronous = 1;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -469,7 +470,7 @@ struct AMQPBasicConsume {
 };
 
 struct AMQPBasicConsumeOk {
-  std::string consumer_tag = "";
+  std::string_view consumer_tag = "";
   bool synchronous = 1;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -478,7 +479,7 @@ struct AMQPBasicConsumeOk {
 };
 
 struct AMQPBasicCancel {
-  std::string consumer_tag = "";
+  std::string_view consumer_tag = "";
   bool no_wait = 0;
   bool synchronous = 1;
 
@@ -489,7 +490,7 @@ struct AMQPBasicCancel {
 };
 
 struct AMQPBasicCancelOk {
-  std::string consumer_tag = "";
+  std::string_view consumer_tag = "";
   bool synchronous = 1;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -499,8 +500,8 @@ struct AMQPBasicCancelOk {
 
 struct AMQPBasicPublish {
   uint16_t reserved_1 = 0;
-  std::string exchange = "";
-  std::string routing_key = "";
+  std::string_view exchange = "";
+  std::string_view routing_key = "";
   bool mandatory = 0;
   bool immediate = 0;
   bool synchronous = 0;
@@ -516,9 +517,9 @@ struct AMQPBasicPublish {
 
 struct AMQPBasicReturn {
   uint16_t reply_code = 0;
-  std::string reply_text = "";
-  std::string exchange = "";
-  std::string routing_key = "";
+  std::string_view reply_text = "";
+  std::string_view exchange = "";
+  std::string_view routing_key = "";
   bool synchronous = 0;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -530,11 +531,11 @@ struct AMQPBasicReturn {
 };
 
 struct AMQPBasicDeliver {
-  std::string consumer_tag = "";
+  std::string_view consumer_tag = "";
   uint64_t delivery_tag = 0;
   bool redelivered = 0;
-  std::string exchange = "";
-  std::string routing_key = "";
+  std::string_view exchange = "";
+  std::string_view routing_key = "";
   bool synchronous = 0;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -548,7 +549,7 @@ struct AMQPBasicDeliver {
 
 struct AMQPBasicGet {
   uint16_t reserved_1 = 0;
-  std::string queue = "";
+  std::string_view queue = "";
   bool no_ack = 0;
   bool synchronous = 1;
 
@@ -562,8 +563,8 @@ struct AMQPBasicGet {
 struct AMQPBasicGetOk {
   uint64_t delivery_tag = 0;
   bool redelivered = 0;
-  std::string exchange = "";
-  std::string routing_key = "";
+  std::string_view exchange = "";
+  std::string_view routing_key = "";
   uint32_t message_count = 0;
   bool synchronous = 1;
 
@@ -577,7 +578,7 @@ struct AMQPBasicGetOk {
 };
 
 struct AMQPBasicGetEmpty {
-  std::string reserved_1 = "";
+  std::string_view reserved_1 = "";
   bool synchronous = 1;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -630,20 +631,20 @@ struct AMQPBasicRecoverOk {
 struct AMQPBasicContentHeader {
   uint64_t body_size = 0;
   uint16_t property_flags = 0;
-  std::string content_type = "";
-  std::string content_encoding = "";
-  std::string headers = "";
+  std::string_view content_type = "";
+  std::string_view content_encoding = "";
+  std::string_view headers = "";
   uint8_t delivery_mode = 0;
   uint8_t priority = 0;
-  std::string correlation_id = "";
-  std::string reply_to = "";
-  std::string expiration = "";
-  std::string message_id = "";
+  std::string_view correlation_id = "";
+  std::string_view reply_to = "";
+  std::string_view expiration = "";
+  std::string_view message_id = "";
   time_t timestamp = 0;
-  std::string type = "";
-  std::string user_id = "";
-  std::string app_id = "";
-  std::string reserved = "";
+  std::string_view type = "";
+  std::string_view user_id = "";
+  std::string_view app_id = "";
+  std::string_view reserved = "";
   bool synchronous = 0;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
@@ -32,8 +32,9 @@
 #include "src/common/base/base.h"
 
 DEFINE_bool(stirling_data_stream_buffer_always_contiguous_buffer,
-            gflags::BoolFromEnv("PL_STIRLING_DATA_STREAM_BUFFER_ALWAYS_CONTIGUOUS_BUFFER", true),
-            "Flip flag to use alternative DataStreamBuffer implementation");
+            gflags::BoolFromEnv("PL_STIRLING_DATA_STREAM_BUFFER_ALWAYS_CONTIGUOUS_BUFFER", false),
+            "If true, use the legacy DataStreamBuffer implementation that keeps all buffered data "
+            "in a single contiguous buffer, instead of the event-chunk based implementation.");
 
 namespace px {
 namespace stirling {
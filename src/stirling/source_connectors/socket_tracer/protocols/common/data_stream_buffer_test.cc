@@ -69,7 +69,14 @@ TEST_P(DataStreamBufferTest, AddAndGet) {
   // Jump ahead, leaving a gap.
   stream_buffer.Add(28, "st", 28);
   stream_buffer.Add(26, "qr", 26);
-  EXPECT_EQ(stream_buffer.Head(), "fghij");
+  // The two implementations expire data differently: the old implementation slides its window
+  // forward and drops everything before it, while the new implementation evicts only as many of
+  // the oldest bytes as needed, retaining the rest of the previous head.
+  if (FLAGS_stirling_data_stream_buffer_always_contiguous_buffer) {
+    EXPECT_EQ(stream_buffer.Head(), "fghij");
+  } else {
+    EXPECT_EQ(stream_buffer.Head(), "9abcdefghij");
+  }
 
   // Fill in the gap.
   stream_buffer.Add(22, "mn", 22);
@@ -128,6 +135,25 @@ TEST_P(DataStreamBufferTest, RemovePrefixAndTrim) {
   EXPECT_EQ(stream_buffer.Head(), "abcd");
 }
 
+TEST_P(DataStreamBufferTest, EvictionRetainsUnconsumedHead) {
+  DataStreamBuffer stream_buffer(10, 10, 10);
+
+  stream_buffer.Add(0, "0123456789", 0);
+  EXPECT_EQ(stream_buffer.Head(), "0123456789");
+
+  // Expanding by 3 contiguous bytes evicts exactly the 3 oldest bytes.
+  stream_buffer.Add(10, "abc", 10);
+  EXPECT_EQ(stream_buffer.Head(), "3456789abc");
+  EXPECT_EQ(stream_buffer.position(), 3);
+
+  // Expanding past a gap evicts from the front, and Trim() then discards the bytes that can
+  // never become contiguous with the data after the gap.
+  stream_buffer.Add(20, "ABCDE", 20);
+  stream_buffer.Trim();
+  EXPECT_EQ(stream_buffer.Head(), "ABCDE");
+  EXPECT_EQ(stream_buffer.position(), 20);
+}
+
 TEST_P(DataStreamBufferTest, Timestamp) {
   DataStreamBuffer stream_buffer(15, 15, 15);
 
@@ -66,8 +66,64 @@ inline bool operator==(const StartEndPos& lhs, const StartEndPos& rhs) {
   return lhs.start == rhs.start && lhs.end == rhs.end;
 }
 
+namespace internal {
+
+// Capacity recycling for the frame-position vectors used by ParseFrames().
+//
+// ParseFrames() runs once per stream per transfer cycle — easily thousands of calls — and the
+// frame-position vector previously regrew from zero capacity on every call, which showed up as an
+// allocation hotspot. Parsing happens on the source connector's own thread, so a thread_local
+// freelist recycles the vectors without locking.
+
+inline std::vector<std::vector<StartEndPos>>& FramePositionFreelist() {
+  static thread_local std::vector<std::vector<StartEndPos>> freelist;
+  return freelist;
+}
+
+inline std::vector<StartEndPos> AcquireFramePositions() {
+  auto& freelist = FramePositionFreelist();
+  if (freelist.empty()) {
+    return {};
+  }
+  std::vector<StartEndPos> positions = std::move(freelist.back());
+  freelist.pop_back();
+  positions.clear();
+  return positions;
+}
+
+inline void RecycleFramePositions(std::vector<StartEndPos>&& positions) {
+  // A handful of vectors covers the deepest nesting of live ParseResults; pooling more than that
+  // would just pin memory.
+  constexpr size_t kMaxFreelistSize = 8;
+  auto& freelist = FramePositionFreelist();
+  if (positions.capacity() == 0 || freelist.size() >= kMaxFreelistSize) {
+    return;
+  }
+  freelist.push_back(std::move(positions));
+}
+
+}  // namespace internal
+
 // A ParseResult returns a vector of parsed frames, and also some position markers.
 struct ParseResult {
+  ParseResult() = default;
+  ParseResult(std::vector<StartEndPos> frame_positions, size_t end_position, ParseState state,
+              int invalid_frames, size_t frame_bytes)
+      : frame_positions(std::move(frame_positions)),
+        end_position(end_position),
+        state(state),
+        invalid_frames(invalid_frames),
+        frame_bytes(frame_bytes) {}
+
+  // On destruction, the frame-position vector's capacity is returned to the thread's freelist so
+  // the next ParseFrames() call can reuse it.
+  ~ParseResult() { internal::RecycleFramePositions(std::move(frame_positions)); }
+
+  ParseResult(ParseResult&&) = default;
+  ParseResult& operator=(ParseResult&&) = default;
+  ParseResult(const ParseResult&) = default;
+  ParseResult& operator=(const ParseResult&) = default;
+
   // Positions of frame start and end positions in the source buffer.
   std::vector<StartEndPos> frame_positions;
   // Position of where parsing ended consuming the source buffer.
@@ -162,7 +218,7 @@ ParseResult ParseFrames(message_type_t type, DataStreamBuffer* data_stream_buffe
 template <typename TFrameType, typename TStateType = NoState>
 ParseResult ParseFramesLoop(message_type_t type, std::string_view buf,
                             std::deque<TFrameType>* frames, TStateType* state = nullptr) {
-  std::vector<StartEndPos> frame_positions;
+  std::vector<StartEndPos> frame_positions = internal::AcquireFramePositions();
   const size_t buf_size = buf.size();
   ParseState s = ParseState::kSuccess;
   size_t bytes_processed = 0;
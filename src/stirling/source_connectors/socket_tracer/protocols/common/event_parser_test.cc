@@ -99,6 +99,26 @@ TEST_F(EventParserTest, BasicProtocolParsing) {
   EXPECT_THAT(timestamps, ElementsAre(0, 1, 1, 2, 3, 4));
 }
 
+// The frame-position vector's capacity should be returned to the thread's freelist when a
+// ParseResult dies, and reused by the next parse.
+TEST_F(EventParserTest, FramePositionCapacityIsRecycled) {
+  const StartEndPos* old_data = nullptr;
+  {
+    std::deque<TestFrame> word_frames;
+    std::vector<SocketDataEvent> events = CreateEvents<std::string>({"a,b,c,d,e,f,g,h,"});
+    AddEvents(events);
+    ParseResult res = ParseFrames(message_type_t::kRequest, &data_buffer_, &word_frames);
+    ASSERT_GT(res.frame_positions.capacity(), 0U);
+    old_data = res.frame_positions.data();
+  }
+
+  // The recycled vector should come back with its old allocation.
+  std::vector<StartEndPos> positions = internal::AcquireFramePositions();
+  EXPECT_TRUE(positions.empty());
+  EXPECT_EQ(old_data, positions.data());
+  internal::RecycleFramePositions(std::move(positions));
+}
+
 // TODO(oazizi): Move any protocol specific tests that check for general EventParser behavior here.
 // Should help reduce duplication of tests.
 
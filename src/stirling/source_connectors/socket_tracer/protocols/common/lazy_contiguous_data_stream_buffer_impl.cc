@@ -17,6 +17,7 @@
  */
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <utility>
@@ -33,7 +34,18 @@ FixedSizeContiguousBuffer::FixedSizeContiguousBuffer(size_t capacity)
   DCHECK_GT(capacity, 0U);
 }
 
+FixedSizeContiguousBuffer::FixedSizeContiguousBuffer(std::string data)
+    : adopted_data_(std::move(data)),
+      data_(reinterpret_cast<uint8_t*>(adopted_data_.data())),
+      capacity_(adopted_data_.size()) {
+  DCHECK_GT(capacity_, 0U);
+}
+
 FixedSizeContiguousBuffer::~FixedSizeContiguousBuffer() {
+  if (!adopted_data_.empty()) {
+    // Storage is owned by adopted_data_.
+    return;
+  }
   if (capacity_ == 0) {
     return;
   }
@@ -87,17 +99,22 @@ void LazyContiguousDataStreamBufferImpl::Add(size_t pos, std::string_view data,
 size_t LazyContiguousDataStreamBufferImpl::EvictBytes(size_t n_bytes) {
   size_t evicted = 0;
   // Eviction should only occur during the Add phase, so if there are bytes in the ContiguousBuffer,
-  // they are leftover from the previous iteration. If there are bytes in the ContiguousBuffer, we
-  // will evict all of them as a performance optimization, since each eviction (regardless of size)
-  // from the ContiguousBuffer requires copying the whole buffer. Note that because the retention
-  // capacity between polling iterations is significantly lower than the DataStreamBuffer capacity,
-  // the entire ContiguousBuffer is only dropped when a lot of new data was received this iteration,
-  // so dropping <=1MB of data from the previous iteration doesn't seem too bad.
-  // TODO(james): Look into halving the buffer each time instead of dropping the entire thing.
+  // they are leftover from the previous iteration. Evict only as many of them as needed by
+  // advancing the buffer's offset, which is O(1) and avoids both copying and dropping the
+  // remaining unconsumed bytes. The allocation itself is only released once every byte in it has
+  // been consumed or evicted, but since it never exceeds the DataStreamBuffer's capacity this
+  // waste is bounded.
   if (head_ != nullptr) {
-    evicted = head_->Capacity();
-    head_.reset();
-    head_pos_to_ts_.clear();
+    size_t removed = std::min(n_bytes, head_->Size());
+    head_->RemovePrefix(removed);
+    if (head_->Size() == 0) {
+      head_.reset();
+      head_pos_to_ts_.clear();
+    } else {
+      CleanupHeadTimestamps(removed);
+    }
+    head_position_ += removed;
+    evicted += removed;
   }
   if (evicted >= n_bytes) {
     return evicted;
@@ -122,6 +139,23 @@ bool LazyContiguousDataStreamBufferImpl::IsHeadAndEventsMergeable() const {
 }
 
 void LazyContiguousDataStreamBufferImpl::MergeContiguousEventsIntoHead() {
+  // Fast path: if there is no leftover head and only a single event is contiguous, adopt the
+  // event's buffer directly instead of copying it. This is the common case when each polling
+  // iteration's data is consumed in full before the next iteration's data arrives.
+  if (head_ == nullptr) {
+    auto first_it = events_.begin();
+    const size_t first_end_pos = first_it->first + first_it->second.data.size();
+    auto next_it = std::next(first_it);
+    if (next_it == events_.end() || next_it->first != first_end_pos) {
+      head_position_ = first_it->first;
+      head_pos_to_ts_.emplace(first_it->first, first_it->second.timestamp);
+      events_size_ -= first_it->second.data.size();
+      head_ = std::make_unique<FixedSizeContiguousBuffer>(std::move(first_it->second.data));
+      events_.erase(first_it);
+      return;
+    }
+  }
+
   size_t new_buffer_size = 0;
   size_t buffer_end_pos = FirstEventPos();
   size_t new_head_position = FirstEventPos();
@@ -252,6 +286,22 @@ void LazyContiguousDataStreamBufferImpl::CleanupHeadTimestamps(size_t removed) {
   head_pos_to_ts_.insert(std::move(nh));
 }
 
+void LazyContiguousDataStreamBufferImpl::Trim() {
+  // The head is contiguous by construction, so there is only something to trim when the buffered
+  // events start beyond a gap: any bytes left in the head can never become contiguous with those
+  // events (Add() ignores events before head_position_), so drop them to let Head() jump past the
+  // gap.
+  if (head_ == nullptr || events_.empty()) {
+    return;
+  }
+  if (FirstEventPos() <= head_position_ + head_->Size()) {
+    return;
+  }
+  head_position_ += head_->Size();
+  head_.reset();
+  head_pos_to_ts_.clear();
+}
+
 void LazyContiguousDataStreamBufferImpl::Reset() {
   head_.reset();
   head_pos_to_ts_.clear();
@@ -43,6 +43,9 @@ class FixedSizeContiguousBuffer : public NotCopyable {
   ~FixedSizeContiguousBuffer();
   // Passing capacity == 0 is undefined behaviour.
   explicit FixedSizeContiguousBuffer(size_t capacity);
+  // Adopts the string's storage as the buffer, avoiding a copy.
+  // Passing an empty string is undefined behaviour.
+  explicit FixedSizeContiguousBuffer(std::string data);
   std::string_view StringView();
   // Invalidate first n bytes of data
   void RemovePrefix(size_t n);
@@ -51,6 +54,9 @@ class FixedSizeContiguousBuffer : public NotCopyable {
   size_t Capacity() const;
 
  private:
+  // Storage when constructed by adopting a string. Empty when the buffer owns a heap allocation.
+  // Must precede data_ so that data_ can be initialized to point into it.
+  std::string adopted_data_;
   uint8_t* data_;
   size_t capacity_;
   size_t offset_ = 0;
@@ -87,7 +93,9 @@ class LazyContiguousDataStreamBufferImpl : public DataStreamBufferImpl {
 
   void Reset() override;
 
-  void Trim() override {}
+  // Discards any bytes left in `head_` that precede a gap, so that `Head()` can jump past the gap
+  // to the next buffered event.
+  void Trim() override;
 
   void ShrinkToFit() override;
 
@@ -32,6 +32,10 @@ namespace protocols {
 // Stitches request & response pairs based on the fact that the response's timestamp must be
 // later than that of its corresponding request.
 //
+// Both deques are timestamp-ordered, so this is a single merge pass with a guaranteed
+// O(reqs + resps) cost. Responses that arrive without an earlier unmatched request are counted
+// as errors (lost frames), rather than silently dropped.
+//
 // NOTICE: This cannot handle pipelining.
 //
 // TRecordType must have 2 member variables that are of TMessageType. Something like:
@@ -47,6 +51,10 @@ template <typename TRecordType, typename TMessageType>
 RecordsWithErrorCount<TRecordType> StitchMessagesWithTimestampOrder(
     std::deque<TMessageType>* req_messages, std::deque<TMessageType>* resp_messages) {
   std::vector<TRecordType> records;
+  // Each record consumes one response, so this reserves enough space to avoid re-allocating
+  // (and move-constructing all previously stitched records) as the vector grows.
+  records.reserve(resp_messages->size());
+  int error_count = 0;
 
   TRecordType record;
   record.req.timestamp_ns = 0;
@@ -71,7 +79,7 @@ RecordsWithErrorCount<TRecordType> StitchMessagesWithTimestampOrder(
       ++req_iter;
     } else {
       // Two cases for a response:
-      // 1) No older request was found: then we ignore the response.
+      // 1) No older request was found: the request frame was lost, count the response as an error.
       // 2) An older request was found: then it is considered a match. Push the record, and reset.
       if (record.req.timestamp_ns != 0) {
         record.resp = std::move(resp);
@@ -80,6 +88,8 @@ RecordsWithErrorCount<TRecordType> StitchMessagesWithTimestampOrder(
         // Reset record after pushing.
         record.req.timestamp_ns = 0;
         record.resp.timestamp_ns = 0;
+      } else {
+        ++error_count;
       }
       ++resp_iter;
     }
@@ -88,7 +98,7 @@ RecordsWithErrorCount<TRecordType> StitchMessagesWithTimestampOrder(
   req_messages->erase(req_messages->begin(), req_iter);
   resp_messages->erase(resp_messages->begin(), resp_iter);
 
-  return {std::move(records), 0};
+  return {std::move(records), error_count};
 }
 
 }  // namespace protocols
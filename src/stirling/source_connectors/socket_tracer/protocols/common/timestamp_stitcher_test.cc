@@ -143,6 +143,7 @@ TEST_F(TimestampStitcherTest, BasicSequentialMatching) {
 
   auto records = StitchMessagesWithTimestampOrder<Record>(&req_messages, &resp_messages);
   EXPECT_EQ(records.records.size(), 100);
+  EXPECT_EQ(records.error_count, 0);
 }
 
 TEST_F(TimestampStitcherTest, MissingOneReq) {
@@ -154,6 +155,8 @@ TEST_F(TimestampStitcherTest, MissingOneReq) {
 
   auto records = StitchMessagesWithTimestampOrder<Record>(&req_messages, &resp_messages);
   EXPECT_EQ(records.records.size(), 99);
+  // The response whose request is missing is accounted as a lost frame.
+  EXPECT_EQ(records.error_count, 1);
 }
 
 TEST_F(TimestampStitcherTest, MissingOneResp) {
@@ -165,6 +168,7 @@ TEST_F(TimestampStitcherTest, MissingOneResp) {
 
   auto records = StitchMessagesWithTimestampOrder<Record>(&req_messages, &resp_messages);
   EXPECT_EQ(records.records.size(), 99);
+  EXPECT_EQ(records.error_count, 0);
 }
 
 // TODO(chengruizhe): This test induces a mismatch in the timestamp stitcher. Update the test once
@@ -183,6 +187,7 @@ TEST_F(TimestampStitcherTest, MissingOneReqFollowedByOneResp) {
 
   // This are supposed to be 98 records. We currently have 99 due to a mismatch.
   EXPECT_EQ(records.records.size(), 99);
+  EXPECT_EQ(records.error_count, 0);
 }
 
 }  // namespace protocols
@@ -18,16 +18,14 @@
 
 #include "src/stirling/source_connectors/socket_tracer/protocols/dns/stitcher.h"
 
-#include <rapidjson/document.h>
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-
 #include <chrono>
 #include <deque>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "src/common/base/base.h"
+#include "src/common/json/json.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/dns/types.h"
 
 DEFINE_bool(include_respless_dns_requests, false,
@@ -47,37 +45,25 @@ namespace protocols {
 namespace dns {
 
 std::string HeaderToJSONString(const DNSHeader& header) {
-  rapidjson::Document d(rapidjson::kObjectType);
-
-  int qr = EXTRACT_DNS_FLAG(header.flags, kQRPos, kQRWidth);
-  int opcode = EXTRACT_DNS_FLAG(header.flags, kOpcodePos, kOpcodeWidth);
-  int aa = EXTRACT_DNS_FLAG(header.flags, kAAPos, kAAWidth);
-  int tc = EXTRACT_DNS_FLAG(header.flags, kTCPos, kTCWidth);
-  int rd = EXTRACT_DNS_FLAG(header.flags, kRDPos, kRDWidth);
-  int ra = EXTRACT_DNS_FLAG(header.flags, kRAPos, kRAWidth);
-  int ad = EXTRACT_DNS_FLAG(header.flags, kADPos, kADWidth);
-  int cd = EXTRACT_DNS_FLAG(header.flags, kCDPos, kCDWidth);
-  int rcode = EXTRACT_DNS_FLAG(header.flags, kRcodePos, kRcodeWidth);
-
-  d.AddMember("txid", header.txid, d.GetAllocator());
-  d.AddMember("qr", qr, d.GetAllocator());
-  d.AddMember("opcode", opcode, d.GetAllocator());
-  d.AddMember("aa", aa, d.GetAllocator());
-  d.AddMember("tc", tc, d.GetAllocator());
-  d.AddMember("rd", rd, d.GetAllocator());
-  d.AddMember("ra", ra, d.GetAllocator());
-  d.AddMember("ad", ad, d.GetAllocator());
-  d.AddMember("cd", cd, d.GetAllocator());
-  d.AddMember("rcode", rcode, d.GetAllocator());
-  d.AddMember("num_queries", header.num_queries, d.GetAllocator());
-  d.AddMember("num_answers", header.num_answers, d.GetAllocator());
-  d.AddMember("num_auth", header.num_auth, d.GetAllocator());
-  d.AddMember("num_addl", header.num_addl, d.GetAllocator());
-
-  rapidjson::StringBuffer sb;
-  rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
-  d.Accept(writer);
-  return std::string(sb.GetString());
+  // Serializes directly through the streaming writer, with no intermediate rapidjson document.
+  utils::JSONObjectBuilder builder;
+
+  builder.WriteKV("txid", header.txid);
+  builder.WriteKV("qr", EXTRACT_DNS_FLAG(header.flags, kQRPos, kQRWidth));
+  builder.WriteKV("opcode", EXTRACT_DNS_FLAG(header.flags, kOpcodePos, kOpcodeWidth));
+  builder.WriteKV("aa", EXTRACT_DNS_FLAG(header.flags, kAAPos, kAAWidth));
+  builder.WriteKV("tc", EXTRACT_DNS_FLAG(header.flags, kTCPos, kTCWidth));
+  builder.WriteKV("rd", EXTRACT_DNS_FLAG(header.flags, kRDPos, kRDWidth));
+  builder.WriteKV("ra", EXTRACT_DNS_FLAG(header.flags, kRAPos, kRAWidth));
+  builder.WriteKV("ad", EXTRACT_DNS_FLAG(header.flags, kADPos, kADWidth));
+  builder.WriteKV("cd", EXTRACT_DNS_FLAG(header.flags, kCDPos, kCDWidth));
+  builder.WriteKV("rcode", EXTRACT_DNS_FLAG(header.flags, kRcodePos, kRcodeWidth));
+  builder.WriteKV("num_queries", header.num_queries);
+  builder.WriteKV("num_answers", header.num_answers);
+  builder.WriteKV("num_auth", header.num_auth);
+  builder.WriteKV("num_addl", header.num_addl);
+
+  return builder.GetString();
 }
 
 std::string_view DNSRecordTypeName(InetAddrFamily addr_family) {
@@ -100,74 +86,67 @@ std::string_view DNSRecordTypeName(InetAddrFamily addr_family) {
   return type_name;
 }
 
-void ProcessReq(const Frame& req_frame, Request* req) {
-  req->timestamp_ns = req_frame.timestamp_ns;
-  req->header = HeaderToJSONString(req_frame.header);
+namespace {
 
-  rapidjson::Document d;
-  d.SetObject();
+// Adapters that render a DNSRecord as a query or an answer object through the streaming JSON
+// writer (see JSONObjectBuilder::WriteKVArrayRecursive).
+struct QueryJSONView {
+  const DNSRecord* record;
 
-  rapidjson::Value queries(rapidjson::kArrayType);
-  for (const auto& r : req_frame.records()) {
-    const std::string& name = r.name;
-    std::string_view type_name = DNSRecordTypeName(r.addr.family);
+  void ToJSON(utils::JSONObjectBuilder* builder) const {
+    builder->WriteKV("name", record->name);
+    builder->WriteKV("type", DNSRecordTypeName(record->addr.family));
+  }
+};
 
-    rapidjson::Value query(rapidjson::kObjectType);
-    query.AddMember("name", rapidjson::StringRef(name.data(), name.size()), d.GetAllocator());
-    query.AddMember("type", rapidjson::StringRef(type_name.data(), type_name.size()),
-                    d.GetAllocator());
+struct AnswerJSONView {
+  const DNSRecord* record;
 
-    queries.PushBack(query, d.GetAllocator());
+  void ToJSON(utils::JSONObjectBuilder* builder) const {
+    builder->WriteKV("name", record->name);
+    if (!record->cname.empty()) {
+      builder->WriteKV("type", "CNAME");
+      builder->WriteKV("cname", record->cname);
+    } else {
+      builder->WriteKV("type", DNSRecordTypeName(record->addr.family));
+      std::string addr = record->addr.AddrStr();
+      builder->WriteKV("addr", addr);
+    }
+  }
+};
+
+template <typename TRecordJSONView>
+std::vector<TRecordJSONView> RecordJSONViews(const Frame& frame) {
+  std::vector<TRecordJSONView> views;
+  views.reserve(frame.records().size());
+  for (const auto& r : frame.records()) {
+    views.push_back(TRecordJSONView{&r});
   }
+  return views;
+}
+
+}  // namespace
+
+void ProcessReq(const Frame& req_frame, Request* req) {
+  req->timestamp_ns = req_frame.timestamp_ns;
+  req->header = HeaderToJSONString(req_frame.header);
 
-  d.AddMember("queries", queries, d.GetAllocator());
+  std::vector<QueryJSONView> queries = RecordJSONViews<QueryJSONView>(req_frame);
 
-  rapidjson::StringBuffer sb;
-  rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
-  d.Accept(writer);
-  req->query = std::string(sb.GetString());
+  utils::JSONObjectBuilder builder;
+  builder.WriteKVArrayRecursive("queries", VectorView<QueryJSONView>(queries));
+  req->query = builder.GetString();
 }
 
 void ProcessResp(const Frame& resp_frame, Response* resp) {
   resp->timestamp_ns = resp_frame.timestamp_ns;
   resp->header = HeaderToJSONString(resp_frame.header);
 
-  rapidjson::Document d;
-  d.SetObject();
-
-  rapidjson::Value answers(rapidjson::kArrayType);
-  for (const auto& r : resp_frame.records()) {
-    const std::string& name = r.name;
-    rapidjson::Value answer(rapidjson::kObjectType);
-    answer.AddMember("name", rapidjson::StringRef(name.data(), name.size()), d.GetAllocator());
-
-    if (!r.cname.empty()) {
-      std::string_view type_name = "CNAME";
-      answer.AddMember("type", rapidjson::StringRef(type_name.data(), type_name.size()),
-                       d.GetAllocator());
-
-      answer.AddMember("cname", rapidjson::StringRef(r.cname.data(), r.cname.size()),
-                       d.GetAllocator());
-    } else {
-      std::string_view type_name = DNSRecordTypeName(r.addr.family);
-      answer.AddMember("type", rapidjson::StringRef(type_name.data(), type_name.size()),
-                       d.GetAllocator());
-
-      std::string addr = r.addr.AddrStr();
-      rapidjson::Value addr_str(rapidjson::kStringType);
-      addr_str.SetString(addr.data(), addr.size(), d.GetAllocator());
-      answer.AddMember("addr", addr_str, d.GetAllocator());
-    }
-
-    answers.PushBack(answer, d.GetAllocator());
-  }
-
-  d.AddMember("answers", answers, d.GetAllocator());
+  std::vector<AnswerJSONView> answers = RecordJSONViews<AnswerJSONView>(resp_frame);
 
-  rapidjson::StringBuffer sb;
-  rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
-  d.Accept(writer);
-  resp->msg = std::string(sb.GetString());
+  utils::JSONObjectBuilder builder;
+  builder.WriteKVArrayRecursive("answers", VectorView<AnswerJSONView>(answers));
+  resp->msg = builder.GetString();
 }
 
 StatusOr<Record> ProcessReqRespPair(const Frame& req_frame, const Frame& resp_frame) {
@@ -127,7 +127,7 @@ ParseState ExtractChunkData(std::string_view* data, size_t chunk_len, std::strin
 // Reference: https://www.w3.org/Protocols/rfc2616/rfc2616-sec3.html#sec3.6.1
 ParseState CustomParseChunked(std::string_view* buf, size_t body_size_limit_bytes,
                               std::string* result, size_t* body_size) {
-  std::vector<std::string_view> chunks;
+  std::string body;
   size_t total_bytes = 0;
 
   std::string_view data = *buf;
@@ -154,13 +154,11 @@ ParseState CustomParseChunked(std::string_view* buf, size_t body_size_limit_byte
       return s;
     }
 
-    // Only bother collecting chunks up to a certain size, since we will truncate anyways.
+    // Only bother collecting chunk bytes up to a certain size, since we will truncate anyways.
     // Don't break out of the parsing though, since we need to know where the body ends.
-    if (total_bytes + chunk_data.size() < body_size_limit_bytes) {
-      chunks.push_back(chunk_data);
-    } else if (total_bytes < body_size_limit_bytes) {
+    if (total_bytes < body_size_limit_bytes) {
       size_t bytes_available = body_size_limit_bytes - total_bytes;
-      chunks.push_back(chunk_data.substr(0, bytes_available));
+      body.append(chunk_data.substr(0, std::min(bytes_available, chunk_data.size())));
     }
 
     total_bytes += chunk_data.size();
@@ -185,7 +183,7 @@ ParseState CustomParseChunked(std::string_view* buf, size_t body_size_limit_byte
     data.remove_prefix(pos + 4);
   }
 
-  *result = absl::StrJoin(chunks, "");
+  *result = std::move(body);
   *body_size = total_bytes;
 
   // Update the input buffer only if the data was parsed properly, because
@@ -246,7 +244,8 @@ ParseState ParseChunked(std::string_view* data, size_t body_size_limit_bytes, st
 }
 
 ParseState ParseContent(std::string_view content_len_str, std::string_view* data,
-                        size_t body_size_limit_bytes, std::string* result, size_t* body_size) {
+                        size_t body_size_limit_bytes, std::string* result, size_t* body_size,
+                        size_t* body_bytes_to_skip) {
   size_t len;
   if (!absl::SimpleAtoi(content_len_str, &len)) {
     LOG(ERROR) << absl::Substitute("Unable to parse Content-Length: $0", content_len_str);
@@ -254,6 +253,16 @@ ParseState ParseContent(std::string_view content_len_str, std::string_view* data
   }
 
   if (data->size() < len) {
+    // The full body has not arrived, but if the portion that survives truncation is already in
+    // hand, there is no point waiting for (and buffering) the rest. Emit the message now, and
+    // have the caller skip the remaining body bytes as they arrive.
+    if (data->size() >= body_size_limit_bytes) {
+      *result = data->substr(0, body_size_limit_bytes);
+      *body_size = len;
+      *body_bytes_to_skip = len - data->size();
+      data->remove_prefix(data->size());
+      return ParseState::kSuccess;
+    }
     return ParseState::kNeedsMoreData;
   }
 
@@ -50,12 +50,17 @@ ParseState ParseChunked(std::string_view* buf, size_t body_size_limit_bytes, std
  * @param data View into the data buffer contained the body. If parsing succeeds, the corresponding
  * bytes are consumed; otherwise the string_view bytes are not modified.
  * @param result  Result where the body is placed upon success.
+ * @param body_bytes_to_skip Set to the number of not-yet-arrived body bytes when a body larger
+ * than body_size_limit_bytes is emitted before it has fully arrived. The caller is responsible
+ * for skipping that many subsequent bytes on the stream.
  * @return ParseState::kInvalid if content length cannot be parsed.
  *         ParseState::kNeedsMoreData if the message is incomplete.
- *         ParseState::kSuccess if the entire body is present and well-formed.
+ *         ParseState::kSuccess if the body (or at least the portion that survives truncation)
+ *         is present and well-formed.
  */
 ParseState ParseContent(std::string_view content_len_str, std::string_view* data,
-                        size_t body_size_limit_bytes, std::string* result, size_t* body_size);
+                        size_t body_size_limit_bytes, std::string* result, size_t* body_size,
+                        size_t* body_bytes_to_skip);
 
 }  // namespace http
 }  // namespace protocols
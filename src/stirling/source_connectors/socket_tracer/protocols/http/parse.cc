@@ -22,9 +22,12 @@
 #include <picohttpparser.h>
 
 #include <algorithm>
+#include <optional>
 #include <string>
 #include <utility>
 
+#include <absl/strings/match.h>
+
 DEFINE_uint32(http_body_limit_bytes,
               gflags::Uint32FromEnv("PX_STIRLING_HTTP_BODY_LIMIT_BYTES", 1024),
               "The amount of an HTTP body that will be returned on a parse");
@@ -85,9 +88,23 @@ HeadersMap GetHTTPHeadersMap(const phr_header* headers, size_t num_headers) {
   return result;
 }
 
+// Looks up a header by name (case-insensitive) directly in pico's parsed header array,
+// returning a view into the stream buffer. Used during body parsing so that the owned
+// HeadersMap only needs to be built once a complete message has been parsed.
+std::optional<std::string_view> GetHeader(const phr_header* headers, size_t num_headers,
+                                          std::string_view name) {
+  for (size_t i = 0; i < num_headers; i++) {
+    if (absl::EqualsIgnoreCase(std::string_view(headers[i].name, headers[i].name_len), name)) {
+      return std::string_view(headers[i].value, headers[i].value_len);
+    }
+  }
+  return std::nullopt;
+}
+
 }  // namespace pico_wrapper
 
-ParseState ParseRequestBody(std::string_view* buf, Message* result) {
+ParseState ParseRequestBody(std::string_view* buf, const phr_header* headers, size_t num_headers,
+                            Message* result, size_t* body_bytes_to_skip) {
   // From https://tools.ietf.org/html/rfc7230:
   //  A sender MUST NOT send a Content-Length header field in any message
   //  that contains a Transfer-Encoding header field.
@@ -102,19 +119,17 @@ ParseState ParseRequestBody(std::string_view* buf, Message* result) {
   //  body.
 
   // Case 1: Content-Length
-  const auto content_length_iter = result->headers.find(kContentLength);
-  if (content_length_iter != result->headers.end()) {
-    std::string_view content_len_str = content_length_iter->second;
-    auto r = ParseContent(content_len_str, buf, FLAGS_http_body_limit_bytes, &result->body,
-                          &result->body_size);
+  const auto content_length = pico_wrapper::GetHeader(headers, num_headers, kContentLength);
+  if (content_length.has_value()) {
+    auto r = ParseContent(content_length.value(), buf, FLAGS_http_body_limit_bytes, &result->body,
+                          &result->body_size, body_bytes_to_skip);
     DCHECK_LE(result->body.size(), FLAGS_http_body_limit_bytes);
     return r;
   }
 
   // Case 2: Chunked transfer.
-  const auto transfer_encoding_iter = result->headers.find(kTransferEncoding);
-  if (transfer_encoding_iter != result->headers.end() &&
-      transfer_encoding_iter->second == "chunked") {
+  const auto transfer_encoding = pico_wrapper::GetHeader(headers, num_headers, kTransferEncoding);
+  if (transfer_encoding == "chunked") {
     auto s = ParseChunked(buf, FLAGS_http_body_limit_bytes, &result->body, &result->body_size);
     DCHECK_LE(result->body.size(), FLAGS_http_body_limit_bytes);
     return s;
@@ -131,7 +146,8 @@ ParseState ParseRequestBody(std::string_view* buf, Message* result) {
   return ParseState::kSuccess;
 }
 
-ParseState ParseResponseBody(std::string_view* buf, Message* result, State* state) {
+ParseState ParseResponseBody(std::string_view* buf, const phr_header* headers, size_t num_headers,
+                             Message* result, State* state, size_t* body_bytes_to_skip) {
   // Case 0: Check for a HEAD response with no body.
   // Responses to HEAD requests are special, because they may include Content-Length
   // or Transfer-Encoding, but the body will still be empty.
@@ -152,19 +168,17 @@ ParseState ParseResponseBody(std::string_view* buf, Message* result, State* stat
   }
 
   // Case 1: Content-Length
-  const auto content_length_iter = result->headers.find(kContentLength);
-  if (content_length_iter != result->headers.end()) {
-    std::string_view content_len_str = content_length_iter->second;
-    auto s = ParseContent(content_len_str, buf, FLAGS_http_body_limit_bytes, &result->body,
-                          &result->body_size);
+  const auto content_length = pico_wrapper::GetHeader(headers, num_headers, kContentLength);
+  if (content_length.has_value()) {
+    auto s = ParseContent(content_length.value(), buf, FLAGS_http_body_limit_bytes, &result->body,
+                          &result->body_size, body_bytes_to_skip);
     DCHECK_LE(result->body.size(), FLAGS_http_body_limit_bytes);
     return s;
   }
 
   // Case 2: Chunked transfer.
-  const auto transfer_encoding_iter = result->headers.find(kTransferEncoding);
-  if (transfer_encoding_iter != result->headers.end() &&
-      transfer_encoding_iter->second == "chunked") {
+  const auto transfer_encoding = pico_wrapper::GetHeader(headers, num_headers, kTransferEncoding);
+  if (transfer_encoding == "chunked") {
     auto s = ParseChunked(buf, FLAGS_http_body_limit_bytes, &result->body, &result->body_size);
     DCHECK_LE(result->body.size(), FLAGS_http_body_limit_bytes);
     return s;
@@ -179,8 +193,8 @@ ParseState ParseResponseBody(std::string_view* buf, Message* result, State* stat
 
     // Status 101 is an even more special case.
     if (result->resp_status == 101) {
-      const auto upgrade_iter = result->headers.find(kUpgrade);
-      if (upgrade_iter == result->headers.end()) {
+      const auto upgrade = pico_wrapper::GetHeader(headers, num_headers, kUpgrade);
+      if (!upgrade.has_value()) {
         LOG(WARNING) << "Expected an Upgrade header with HTTP status 101";
       }
 
@@ -211,7 +225,7 @@ ParseState ParseResponseBody(std::string_view* buf, Message* result, State* stat
   return ParseState::kNeedsMoreData;
 }
 
-ParseState ParseRequest(std::string_view* buf, Message* result) {
+ParseState ParseRequest(std::string_view* buf, Message* result, size_t* body_bytes_to_skip) {
   pico_wrapper::HTTPRequest req;
   int retval = pico_wrapper::ParseRequest(*buf, &req);
 
@@ -220,12 +234,19 @@ ParseState ParseRequest(std::string_view* buf, Message* result) {
 
     result->type = message_type_t::kRequest;
     result->minor_version = req.minor_version;
-    result->headers = pico_wrapper::GetHTTPHeadersMap(req.headers, req.num_headers);
     result->req_method = std::string(req.method, req.method_len);
     result->req_path = std::string(req.path, req.path_len);
     result->headers_byte_size = retval;
 
-    return ParseRequestBody(buf, result);
+    ParseState s = ParseRequestBody(buf, req.headers, req.num_headers, result, body_bytes_to_skip);
+
+    // Defer building the owned headers map until the message has fully parsed.
+    // A message whose body is still streaming in gets re-parsed from the start on every new
+    // chunk of data, and building the map on each such attempt is wasted work.
+    if (s == ParseState::kSuccess || s == ParseState::kEOS) {
+      result->headers = pico_wrapper::GetHTTPHeadersMap(req.headers, req.num_headers);
+    }
+    return s;
   }
   if (retval == -2) {
     return ParseState::kNeedsMoreData;
@@ -233,7 +254,8 @@ ParseState ParseRequest(std::string_view* buf, Message* result) {
   return ParseState::kInvalid;
 }
 
-ParseState ParseResponse(std::string_view* buf, Message* result, State* state) {
+ParseState ParseResponse(std::string_view* buf, Message* result, State* state,
+                         size_t* body_bytes_to_skip) {
   pico_wrapper::HTTPResponse resp;
   int retval = pico_wrapper::ParseResponse(*buf, &resp);
 
@@ -242,12 +264,18 @@ ParseState ParseResponse(std::string_view* buf, Message* result, State* state) {
 
     result->type = message_type_t::kResponse;
     result->minor_version = resp.minor_version;
-    result->headers = pico_wrapper::GetHTTPHeadersMap(resp.headers, resp.num_headers);
     result->resp_status = resp.status;
     result->resp_message = std::string(resp.msg, resp.msg_len);
     result->headers_byte_size = retval;
 
-    return ParseResponseBody(buf, result, state);
+    ParseState s =
+        ParseResponseBody(buf, resp.headers, resp.num_headers, result, state, body_bytes_to_skip);
+
+    // See ParseRequest for why the owned headers map is only built on a complete parse.
+    if (s == ParseState::kSuccess || s == ParseState::kEOS) {
+      result->headers = pico_wrapper::GetHTTPHeadersMap(resp.headers, resp.num_headers);
+    }
+    return s;
   }
   if (retval == -2) {
     return ParseState::kNeedsMoreData;
@@ -265,12 +293,62 @@ ParseState ParseResponse(std::string_view* buf, Message* result, State* state) {
  * @param result: A parsed HTTP message, if parse was successful (must consider return value).
  * @return parse state indicating how the parse progressed.
  */
+namespace {
+
+// Returns whether buf begins with an HTTP message start marker (a request method or a response
+// version string). Mirrors the patterns used by FindFrameBoundary() below.
+bool StartsWithMessageMarker(message_type_t type, std::string_view buf) {
+  static constexpr std::string_view kHTTPReqStartPatterns[] = {
+      "GET ", "HEAD ", "POST ", "PUT ", "DELETE ", "CONNECT ", "OPTIONS ", "TRACE ", "PATCH ",
+  };
+  static constexpr std::string_view kHTTPRespStartPatterns[] = {"HTTP/1.1 ", "HTTP/1.0 "};
+
+  if (type == message_type_t::kRequest) {
+    for (std::string_view p : kHTTPReqStartPatterns) {
+      if (absl::StartsWith(buf, p)) {
+        return true;
+      }
+    }
+  } else {
+    for (std::string_view p : kHTTPRespStartPatterns) {
+      if (absl::StartsWith(buf, p)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
 ParseState ParseFrame(message_type_t type, std::string_view* buf, Message* result, State* state) {
+  size_t* body_bytes_to_skip = (type == message_type_t::kRequest)
+                                   ? &state->req_body_bytes_to_skip
+                                   : &state->resp_body_bytes_to_skip;
+
+  // If a previous message's body exceeded the capture limit, its remaining bytes are consumed
+  // here as they arrive, without being copied or parsed.
+  if (*body_bytes_to_skip > 0) {
+    // Body bytes may never arrive at all, e.g. when the BPF-side HTTP capture limit stopped
+    // submitting them, in which case the buffer resumes at a later stream position. If the buffer
+    // begins with a message start marker, give the marker precedence over skipping, so one
+    // truncated body doesn't consume the messages that follow it. The risk of a body coincidently
+    // beginning with a marker at exactly an event boundary is accepted as small.
+    if (StartsWithMessageMarker(type, *buf)) {
+      *body_bytes_to_skip = 0;
+    } else {
+      size_t skip = std::min(*body_bytes_to_skip, buf->size());
+      buf->remove_prefix(skip);
+      *body_bytes_to_skip -= skip;
+      return ParseState::kIgnored;
+    }
+  }
+
   switch (type) {
     case message_type_t::kRequest:
-      return ParseRequest(buf, result);
+      return ParseRequest(buf, result, body_bytes_to_skip);
     case message_type_t::kResponse:
-      return ParseResponse(buf, result, state);
+      return ParseResponse(buf, result, state, body_bytes_to_skip);
     default:
       return ParseState::kInvalid;
   }
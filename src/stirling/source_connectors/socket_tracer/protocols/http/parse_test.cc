@@ -552,6 +552,73 @@ TEST_F(HTTPParserTest, LongContentLengthBodyTruncated) {
   EXPECT_THAT(parsed_messages, ElementsAre(expected_message));
 }
 
+// A Content-Length body larger than the capture limit should be emitted as soon as the retained
+// portion has arrived, with the rest of the body skipped as it streams in, instead of being
+// buffered until the full body is present.
+TEST_F(HTTPParserTest, LargeBodyEmittedEarlyAndRemainderSkipped) {
+  StateWrapper state{};
+
+  std::string msg1 =
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Length: 1000\r\n"
+      "\r\n";
+  msg1 += std::string(300, 'x');
+
+  Message expected_message = EmptyHTTPResp();
+  expected_message.headers = {{"Content-Length", "1000"}};
+  expected_message.body = std::string(256, 'x');
+  expected_message.body_size = 1000;
+
+  std::deque<Message> parsed_messages;
+  ParseResult result = ParseFramesLoop(message_type_t::kResponse, msg1, &parsed_messages, &state);
+
+  EXPECT_EQ(ParseState::kSuccess, result.state);
+  EXPECT_THAT(parsed_messages, ElementsAre(expected_message));
+  EXPECT_EQ(700, state.global.resp_body_bytes_to_skip);
+
+  // The rest of the body arrives later and is consumed without being parsed,
+  // after which the next message parses normally.
+  std::string msg2 = absl::StrCat(std::string(700, 'x'), kHTTPResp1);
+  result = ParseFramesLoop(message_type_t::kResponse, msg2, &parsed_messages, &state);
+
+  EXPECT_EQ(ParseState::kSuccess, result.state);
+  EXPECT_EQ(0, state.global.resp_body_bytes_to_skip);
+  EXPECT_THAT(parsed_messages, ElementsAre(expected_message, HTTPResp1ExpectedMessage()));
+}
+
+// If the skipped body bytes never reach user space (e.g. the BPF-side HTTP capture limit stopped
+// submitting them), the buffer resumes at the next message. The skip must yield to the message
+// start marker instead of consuming the new message.
+TEST_F(HTTPParserTest, SkippedBodyLostInTransit) {
+  StateWrapper state{};
+
+  std::string msg1 =
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Length: 1000\r\n"
+      "\r\n";
+  msg1 += std::string(300, 'x');
+
+  Message expected_message = EmptyHTTPResp();
+  expected_message.headers = {{"Content-Length", "1000"}};
+  expected_message.body = std::string(256, 'x');
+  expected_message.body_size = 1000;
+
+  std::deque<Message> parsed_messages;
+  ParseResult result = ParseFramesLoop(message_type_t::kResponse, msg1, &parsed_messages, &state);
+
+  EXPECT_EQ(ParseState::kSuccess, result.state);
+  EXPECT_THAT(parsed_messages, ElementsAre(expected_message));
+  EXPECT_EQ(700, state.global.resp_body_bytes_to_skip);
+
+  // The remaining 700 body bytes were dropped in the kernel, so the next data to arrive is
+  // already the next message.
+  result = ParseFramesLoop(message_type_t::kResponse, kHTTPResp1, &parsed_messages, &state);
+
+  EXPECT_EQ(ParseState::kSuccess, result.state);
+  EXPECT_EQ(0, state.global.resp_body_bytes_to_skip);
+  EXPECT_THAT(parsed_messages, ElementsAre(expected_message, HTTPResp1ExpectedMessage()));
+}
+
 TEST_F(HTTPParserTest, ParseIncompleteChunks) {
   StateWrapper state{};
   std::string msg1 =
@@ -21,6 +21,8 @@
 #include <chrono>
 #include <string>
 
+#include <absl/container/btree_map.h>
+
 #include "src/common/base/utils.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/common/event_parser.h"  // For FrameBase
 
@@ -38,7 +40,10 @@ using ::px::operator<<;
 
 // HTTP1.x headers can have multiple values for the same name, and field names are case-insensitive:
 // https://www.w3.org/Protocols/rfc2616/rfc2616-sec4.html#sec4.2
-using HeadersMap = std::multimap<std::string, std::string, CaseInsensitiveLess>;
+// A btree multimap packs many headers per node, so building a message's header map costs a
+// handful of allocations instead of one per header. Insertion order is preserved for equal keys,
+// like std::multimap.
+using HeadersMap = absl::btree_multimap<std::string, std::string, CaseInsensitiveLess>;
 
 inline constexpr char kContentEncoding[] = "Content-Encoding";
 inline constexpr char kContentLength[] = "Content-Length";
@@ -102,6 +107,13 @@ struct Record {
 
 struct State {
   bool conn_closed = false;
+
+  // Number of remaining body bytes to consume without buffering (one counter per direction).
+  // Set when a message's Content-Length body exceeds FLAGS_http_body_limit_bytes: once the
+  // retained portion has been captured, the rest of the body is skipped as it arrives instead
+  // of being accumulated in the DataStreamBuffer.
+  size_t req_body_bytes_to_skip = 0;
+  size_t resp_body_bytes_to_skip = 0;
 };
 
 struct StateWrapper {
@@ -20,10 +20,11 @@
 
 #include <algorithm>
 #include <chrono>
-#include <map>
 #include <string>
+#include <string_view>
 #include <utility>
 
+#include <absl/container/btree_map.h>
 #include <absl/strings/str_join.h>
 
 #include "src/common/base/utils.h"
@@ -53,15 +54,17 @@ constexpr char kGZip[] = "gzip";
 // ... header field names MUST be converted to lowercase prior to their encoding in HTTP/2.
 // A request or response containing uppercase header field names MUST be treated as malformed.
 //
-// TODO(yzhao): Change to hold a std::map<> object instead of deriving from std::multiplemap<>.
-class NVMap : public std::multimap<std::string, std::string> {
+// A btree map is used instead of std::multimap for its better memory locality and to avoid a
+// node allocation per header. The transparent comparator allows lookups by string_view without
+// materializing a temporary std::string key.
+class NVMap : public absl::btree_multimap<std::string, std::string, std::less<>> {
  public:
-  std::string ValueByKey(const std::string& key, const std::string& default_value = "") const {
+  std::string ValueByKey(std::string_view key, std::string_view default_value = "") const {
     const auto iter = find(key);
     if (iter != end()) {
       return iter->second;
     }
-    return default_value;
+    return std::string(default_value);
   }
 
   size_t ByteSize() const {
@@ -73,7 +76,7 @@ class NVMap : public std::multimap<std::string, std::string> {
     return byte_size;
   }
 
-  bool HasKey(const std::string& key) const { return find(key) != end(); }
+  bool HasKey(std::string_view key) const { return find(key) != end(); }
 
   std::string ToString() const { return absl::StrJoin(*this, ", ", absl::PairFormatter(":")); }
 };
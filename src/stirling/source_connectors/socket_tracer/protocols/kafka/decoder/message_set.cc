@@ -18,6 +18,8 @@
 
 #include "src/stirling/source_connectors/socket_tracer/protocols/kafka/decoder/packet_decoder.h"
 
+#include <algorithm>
+
 namespace px {
 namespace stirling {
 namespace protocols {
@@ -85,7 +87,19 @@ StatusOr<RecordBatch> PacketDecoder::ExtractRecordBatch(int32_t* offset) {
   PX_UNUSED(producer_epoch);
   PX_UNUSED(base_sequence);
 
-  PX_ASSIGN_OR_RETURN(r.records, ExtractRegularArray(&PacketDecoder::ExtractRecordMessage));
+  if (lazy_decode_) {
+    // Only the record count is of interest from here on. The records themselves are payload
+    // bytes that are jumped over without being decoded or copied.
+    constexpr int32_t kNullSize = -1;
+    PX_ASSIGN_OR_RETURN(int32_t num_records, ExtractInt32());
+    if (num_records < kNullSize) {
+      return error::Internal("Length of array cannot be negative.");
+    }
+    r.record_count = std::max(num_records, 0);
+  } else {
+    PX_ASSIGN_OR_RETURN(r.records, ExtractRegularArray(&PacketDecoder::ExtractRecordMessage));
+    r.record_count = r.records.size();
+  }
   PX_RETURN_IF_ERROR(JumpToOffset());
 
   *offset += length + kBaseOffsetLength + kLengthLength;
@@ -121,7 +135,8 @@ StatusOr<MessageSet> PacketDecoder::ExtractMessageSet() {
   while (offset < message_set.size) {
     auto record_batch_result = ExtractRecordBatch(&offset);
     if (record_batch_result.ok()) {
-      message_set.record_batches.push_back(record_batch_result.ValueOrDie());
+      message_set.record_count += record_batch_result.ValueOrDie().record_count;
+      message_set.record_batches.push_back(record_batch_result.ConsumeValueOrDie());
     } else {
       PX_RETURN_IF_ERROR(JumpToOffset());
       return message_set;
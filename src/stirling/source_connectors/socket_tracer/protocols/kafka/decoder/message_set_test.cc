@@ -74,6 +74,25 @@ TEST(KafkaPacketDecoderTest, ExtractRecordBatchV9) {
   EXPECT_OK_AND_EQ(decoder.ExtractRecordBatch(), expected_result);
 }
 
+TEST(KafkaPacketDecoderTest, ExtractRecordBatchLazy) {
+  // Same input as ExtractRecordBatchV9. In lazy mode, the record payloads are skipped over,
+  // and only the record count is extracted.
+  const std::string_view input = CreateStringView<char>(
+      "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4e\xff\xff\xff\xff\x02\xc0\xde\x91\x11\x00"
+      "\x00\x00\x00\x00\x00\x00\x00\x01\x7a\x1b\xc8\x2d\xaa\x00\x00\x01\x7a\x1b\xc8\x2d\xaa\xff"
+      "\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\x00\x00\x00\x01\x38\x00\x00\x00\x01"
+      "\x2c\x54\x68\x69\x73\x20\x69\x73\x20\x6d\x79\x20\x66\x69\x72\x73\x74\x20\x65\x76\x65\x6e"
+      "\x74\x00");
+  PacketDecoder decoder(input);
+  decoder.SetAPIInfo(APIKey::kProduce, 9);
+  decoder.SetLazyDecode(true);
+  int32_t offset = 0;
+  ASSERT_OK_AND_ASSIGN(RecordBatch record_batch, decoder.ExtractRecordBatch(&offset));
+  EXPECT_THAT(record_batch.records, IsEmpty());
+  EXPECT_EQ(record_batch.record_count, 1);
+  EXPECT_TRUE(decoder.eof());
+}
+
 }  // namespace kafka
 }  // namespace protocols
 }  // namespace stirling
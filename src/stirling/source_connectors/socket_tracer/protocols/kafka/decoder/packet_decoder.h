@@ -244,6 +244,12 @@ class PacketDecoder {
     is_flexible_ = IsFlexible(api_key, api_version);
   }
 
+  // In lazy mode, record batches are decoded only up to their envelope fields (sizes, counts,
+  // offsets), and the record payload bytes are jumped over without being touched or copied.
+  // Record keys/values are left empty. This is a significant saving on busy brokers, where
+  // record payloads make up almost all of the bytes on the wire.
+  void SetLazyDecode(bool enable) { lazy_decode_ = enable; }
+
  private:
   // Represents a sequence of characters. First the length N is given as an INT16. Then N
   // bytes follow which are the UTF-8 encoding of the character sequence.
@@ -314,6 +320,7 @@ class PacketDecoder {
   APIKey api_key_;
   int16_t api_version_ = 0;
   bool is_flexible_ = false;
+  bool lazy_decode_ = false;
 };
 
 }  // namespace kafka
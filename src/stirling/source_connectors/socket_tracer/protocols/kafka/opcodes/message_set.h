@@ -43,6 +43,9 @@ struct RecordMessage {
 
 struct RecordBatch {
   std::vector<RecordMessage> records;
+  // Number of records in the batch, per the batch header. In lazy decode mode the records
+  // themselves are skipped over and only this count is populated.
+  int32_t record_count = 0;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
     builder->WriteKVArrayRecursive<RecordMessage>("records", records);
@@ -51,6 +54,8 @@ struct RecordBatch {
 
 struct MessageSet {
   int64_t size = 0;
+  // Total number of records across all record batches.
+  int64_t record_count = 0;
   std::vector<RecordBatch> record_batches;
 
   void ToJSON(utils::JSONObjectBuilder* builder, bool omit_record_batches = true) const {
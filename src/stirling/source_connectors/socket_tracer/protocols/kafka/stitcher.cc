@@ -27,6 +27,11 @@
 #include "src/stirling/source_connectors/socket_tracer/protocols/kafka/common/types.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/kafka/decoder/packet_decoder.h"
 
+DEFINE_bool(kafka_lazy_record_decoding, true,
+            "If true, decodes only the envelope fields of Kafka record batches (sizes, counts, "
+            "offsets), and skips over record payload bytes. Record keys and values are never "
+            "exported, so this only affects decoding cost.");
+
 namespace px {
 namespace stirling {
 namespace protocols {
@@ -98,6 +103,7 @@ Status ProcessMetadataReq(PacketDecoder* decoder, Request* req) {
 Status ProcessReq(Packet* req_packet, Request* req) {
   req->timestamp_ns = req_packet->timestamp_ns;
   PacketDecoder decoder(*req_packet);
+  decoder.SetLazyDecode(FLAGS_kafka_lazy_record_decoding);
   // Extracts api_key, api_version, and correlation_id.
   PX_RETURN_IF_ERROR(decoder.ExtractReqHeader(req));
 
@@ -122,6 +128,7 @@ Status ProcessReq(Packet* req_packet, Request* req) {
 Status ProcessResp(Packet* resp_packet, Response* resp, APIKey api_key, int16_t api_version) {
   resp->timestamp_ns = resp_packet->timestamp_ns;
   PacketDecoder decoder(*resp_packet);
+  decoder.SetLazyDecode(FLAGS_kafka_lazy_record_decoding);
   decoder.SetAPIInfo(api_key, api_version);
 
   PX_RETURN_IF_ERROR(decoder.ExtractRespHeader(resp));
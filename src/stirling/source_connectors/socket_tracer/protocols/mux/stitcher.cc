@@ -23,6 +23,7 @@
 #include <utility>
 #include <variant>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/strings/str_replace.h>
 
 #include "src/stirling/source_connectors/socket_tracer/protocols/common/interface.h"
@@ -40,41 +41,47 @@ RecordsWithErrorCount<mux::Record> StitchFrames(std::deque<mux::Frame>* reqs,
   std::vector<mux::Record> records;
   int error_count = 0;
 
-  for (auto& req : *reqs) {
-    for (auto resp_it = resps->begin(); resp_it != resps->end(); resp_it++) {
-      auto& resp = *resp_it;
+  // Requests seen but not yet matched to a response, keyed by tag. A mux tag identifies one
+  // outstanding exchange, so at any point in time there is at most one live request per tag;
+  // a reused tag replaces the stale entry.
+  absl::flat_hash_map<uint32_t, mux::Frame*> pending_reqs;
 
-      if (resp.consumed) continue;
+  auto req_iter = reqs->begin();
 
-      Type req_type = static_cast<Type>(req.type);
+  // Both deques are timestamp-ordered, so a single merge pass suffices: before examining a
+  // response, admit every request sent before it into the pending map, then match the response
+  // by tag and type. This bounds stitching at O(reqs + resps), even with missing frames.
+  for (auto& resp : *resps) {
+    while (req_iter != reqs->end() && req_iter->timestamp_ns < resp.timestamp_ns) {
+      auto& req = *req_iter;
+      ++req_iter;
 
       // Tlease messages do not have a response pair
-      if (req_type == Type::kTlease) {
+      if (static_cast<Type>(req.type) == Type::kTlease) {
         req.consumed = true;
         records.push_back({std::move(req), {}});
-        break;
-      }
-      if (req.timestamp_ns > resp.timestamp_ns) {
-        resp.consumed = true;
-        error_count++;
-        VLOG(1) << absl::Substitute(
-            "Did not find a request matching the response. Tag = $0 Type = $1", uint32_t(resp.tag),
-            resp.type);
         continue;
       }
+      pending_reqs[uint32_t(req.tag)] = &req;
+    }
 
-      StatusOr<Type> matching_resp_type = GetMatchingRespType(req_type);
-      Type res_type = static_cast<Type>(resp.type);
-      if (!matching_resp_type.ok() || res_type != matching_resp_type.ValueOrDie() ||
-          resp.tag != req.tag) {
+    auto pending_iter = pending_reqs.find(uint32_t(resp.tag));
+    if (pending_iter != pending_reqs.end()) {
+      auto& req = *pending_iter->second;
+      StatusOr<Type> matching_resp_type = GetMatchingRespType(static_cast<Type>(req.type));
+      if (matching_resp_type.ok() &&
+          static_cast<Type>(resp.type) == matching_resp_type.ValueOrDie()) {
+        req.consumed = true;
+        resp.consumed = true;
+        records.push_back({std::move(req), std::move(resp)});
+        pending_reqs.erase(pending_iter);
         continue;
       }
-
-      req.consumed = true;
-      resp.consumed = true;
-      records.push_back({std::move(req), std::move(resp)});
-      break;
     }
+
+    error_count++;
+    VLOG(1) << absl::Substitute("Did not find a request matching the response. Tag = $0 Type = $1",
+                                uint32_t(resp.tag), resp.type);
   }
   // TODO(ddelnano): Clean up stale requests once there is a mechanism to do so
   auto it = reqs->begin();
@@ -97,6 +97,28 @@ TEST_F(StitchFramesTest, VerifyTleaseIsHandled) {
   EXPECT_THAT(resps, IsEmpty());
 }
 
+TEST_F(StitchFramesTest, VerifyInterleavedTagsAreMatched) {
+  std::deque<mux::Frame> reqs = {
+      CreateMuxFrame(0, mux::Type::kTdispatch, 1),
+      CreateMuxFrame(1, mux::Type::kTdispatch, 2),
+  };
+  // Responses arrive in the reverse order of their requests.
+  std::deque<mux::Frame> resps = {
+      CreateMuxFrame(2, mux::Type::kRdispatch, 2),
+      CreateMuxFrame(3, mux::Type::kRdispatch, 1),
+  };
+
+  RecordsWithErrorCount<mux::Record> result = mux::StitchFrames(&reqs, &resps);
+
+  EXPECT_EQ(result.error_count, 0);
+  EXPECT_EQ(result.records.size(), 2);
+  EXPECT_EQ(uint32_t(result.records[0].req.tag), 2);
+  EXPECT_EQ(uint32_t(result.records[1].req.tag), 1);
+
+  EXPECT_THAT(reqs, IsEmpty());
+  EXPECT_THAT(resps, IsEmpty());
+}
+
 TEST_F(StitchFramesTest, UnmatchedResponsesAreHandled) {
   std::deque<mux::Frame> reqs = {
       // tinit check message
@@ -18,6 +18,7 @@
 
 #include "src/stirling/source_connectors/socket_tracer/protocols/mysql/stitcher.h"
 
+#include <algorithm>
 #include <deque>
 #include <string>
 #include <utility>
@@ -39,13 +40,16 @@ namespace mysql {
 // in which case those requests are popped off.
 void SyncRespQueue(const Packet& req_packet, std::deque<Packet>* resp_packets) {
   // This handles the case where there are responses that pre-date a request.
-  while (!resp_packets->empty() && resp_packets->front().timestamp_ns < req_packet.timestamp_ns) {
-    Packet& resp_packet = resp_packets->front();
-    VLOG(1) << absl::Substitute(
-        "Dropping response packet that pre-dates request. Size=$0 [OK=$1 ERR=$2 EOF=$3]",
-        resp_packet.msg.size(), IsOKPacket(resp_packet), IsErrPacket(resp_packet),
-        IsEOFPacket(resp_packet));
-    resp_packets->pop_front();
+  // The sync point is found with a binary search on timestamps (the deque is time-ordered),
+  // so recovering from a large run of dangling responses does not require examining each one.
+  auto first_in_sync_iter = std::lower_bound(
+      resp_packets->begin(), resp_packets->end(), req_packet.timestamp_ns,
+      [](const Packet& p, uint64_t timestamp_ns) { return p.timestamp_ns < timestamp_ns; });
+
+  if (first_in_sync_iter != resp_packets->begin()) {
+    VLOG(1) << absl::Substitute("Dropping $0 response packets that pre-date request.",
+                                std::distance(resp_packets->begin(), first_in_sync_iter));
+    resp_packets->erase(resp_packets->begin(), first_in_sync_iter);
   }
 }
 
@@ -60,15 +64,27 @@ void SyncRespQueue(const Packet& req_packet, std::deque<Packet>* resp_packets) {
  *
  * @param req_packets Deque of all received request packets (some may be missing).
  * @param resp_packets Dequeue of all received response packets (some may be missing).
+ * @param state Holds the scan progress from the previous stitching cycle, so a response stream
+ * that is still growing (e.g. a large resultset) is not re-walked from the start every cycle.
  * @return View into the "bundle" of response packets that correspond to the first request packet.
  */
 DequeView<Packet> GetRespView(const std::deque<Packet>& req_packets,
-                              const std::deque<Packet>& resp_packets) {
+                              const std::deque<Packet>& resp_packets, State* state) {
   DCHECK(!req_packets.empty());
 
-  int count = 0;
+  size_t count = 0;
 
-  for (const auto& resp_packet : resp_packets) {
+  // Resume the scan where the previous cycle left off, if it stopped on this same request while
+  // waiting for more responses. Progress is only recorded when this is the sole pending request,
+  // so the resumed prefix cannot straddle a later request's timestamp.
+  if (req_packets.size() == 1 &&
+      state->resp_scan_req_timestamp_ns == req_packets.front().timestamp_ns &&
+      state->resp_scan_count <= resp_packets.size()) {
+    count = state->resp_scan_count;
+  }
+
+  for (; count < resp_packets.size(); ++count) {
+    const auto& resp_packet = resp_packets[count];
     if (req_packets.size() > 1 && resp_packet.timestamp_ns > req_packets[1].timestamp_ns) {
       break;
     }
@@ -80,7 +96,6 @@ DequeView<Packet> GetRespView(const std::deque<Packet>& req_packets,
           resp_packet.sequence_id);
       break;
     }
-    ++count;
   }
 
   return DequeView<Packet>(resp_packets, 0, count);
@@ -203,7 +218,7 @@ RecordsWithErrorCount<Record> ProcessMySQLPackets(std::deque<Packet>* req_packet
     // For safety, make sure we have no stale response packets.
     SyncRespQueue(req_packet, resp_packets);
 
-    DequeView<Packet> resp_packets_view = GetRespView(*req_packets, *resp_packets);
+    DequeView<Packet> resp_packets_view = GetRespView(*req_packets, *resp_packets, state);
 
     VLOG(2) << absl::Substitute("req_packets=$0 resp_packets=$1 resp_view_size=$2",
                                 req_packets->size(), resp_packets->size(),
@@ -246,6 +261,9 @@ RecordsWithErrorCount<Record> ProcessMySQLPackets(std::deque<Packet>* req_packet
         if (is_last_req && resp_looks_healthy) {
           VLOG(3) << "Appears to be an incomplete message. Waiting for more data";
           // More response data will probably be captured in next iteration, so stop.
+          // Remember how far the response scan got, so the next cycle picks up from there.
+          state->resp_scan_req_timestamp_ns = req_packet.timestamp_ns;
+          state->resp_scan_count = resp_packets_view.size();
           break;
         }
         VLOG(1) << absl::Substitute(
@@ -261,6 +279,10 @@ RecordsWithErrorCount<Record> ProcessMySQLPackets(std::deque<Packet>* req_packet
 
     req_packets->pop_front();
     resp_packets->erase(resp_packets->begin(), resp_packets->begin() + resp_packets_view.size());
+
+    // Any recorded scan progress belonged to the request that was just consumed.
+    state->resp_scan_req_timestamp_ns = 0;
+    state->resp_scan_count = 0;
   }
 
   // If we haven't seen anything that gives us confidence that this is indeed a MySQL connection,
@@ -201,6 +201,46 @@ TEST(ProcessMySQLPacketsTest, OldResponses) {
   EXPECT_EQ(responses.size(), 0);
 }
 
+TEST(ProcessMySQLPacketsTest, StreamingResponseScanIsResumed) {
+  uint64_t t = 1;
+
+  Packet req = testutils::GenStmtExecuteRequest(testdata::kStmtExecuteRequest);
+  req.timestamp_ns = t++;
+
+  std::deque<Packet> full_resultset = testutils::GenResultset(testdata::kStmtExecuteResultset);
+  for (auto& p : full_resultset) {
+    p.timestamp_ns = t++;
+  }
+
+  State state{std::map<int, PreparedStatement>()};
+  state.prepared_statements.emplace(testdata::kStmtID, testdata::kPreparedStatement);
+
+  // First transfer cycle: the final packet of the resultset hasn't arrived yet,
+  // so the stitcher must wait, but should record how far it scanned.
+  std::deque<Packet> requests = {req};
+  std::deque<Packet> responses(full_resultset.begin(), std::prev(full_resultset.end()));
+  size_t num_partial_responses = responses.size();
+
+  RecordsWithErrorCount<Record> result = ProcessMySQLPackets(&requests, &responses, &state);
+  EXPECT_EQ(result.records.size(), 0);
+  EXPECT_EQ(result.error_count, 0);
+  EXPECT_EQ(requests.size(), 1);
+  EXPECT_EQ(state.resp_scan_req_timestamp_ns, req.timestamp_ns);
+  EXPECT_EQ(state.resp_scan_count, num_partial_responses);
+
+  // Second transfer cycle: the rest of the resultset has arrived, and the scan resumes
+  // from the recorded position. The record is emitted and the progress is cleared.
+  responses.push_back(full_resultset.back());
+
+  result = ProcessMySQLPackets(&requests, &responses, &state);
+  EXPECT_EQ(result.records.size(), 1);
+  EXPECT_EQ(result.error_count, 0);
+  EXPECT_EQ(requests.size(), 0);
+  EXPECT_EQ(responses.size(), 0);
+  EXPECT_EQ(state.resp_scan_req_timestamp_ns, 0);
+  EXPECT_EQ(state.resp_scan_count, 0);
+}
+
 TEST(ProcessMySQLPacketsTest, NonMySQLTraffic1) {
   Packet p0;
   p0.sequence_id = 0;
@@ -358,6 +358,13 @@ struct State {
   // Only on certain conditions, which increase our confidence that the data is indeed MySQL,
   // do we flip this switch, and start pushing data.
   bool active = false;
+
+  // Incremental response-scan progress for the request at the head of the request queue.
+  // When stitching stops to wait for more response data (e.g. a large resultset that is still
+  // streaming in), the number of responses already validated as contiguous is recorded here,
+  // so the next stitching cycle resumes the scan instead of re-walking the whole deque.
+  uint64_t resp_scan_req_timestamp_ns = 0;
+  size_t resp_scan_count = 0;
 };
 
 struct StateWrapper {
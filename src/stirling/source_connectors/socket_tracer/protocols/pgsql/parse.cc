@@ -44,7 +44,7 @@ constexpr int kNullValLen = -1;
 #define PX_ASSIGN_OR_RETURN_INVALID(expr, val_or) \
   PX_ASSIGN_OR(expr, val_or, return ParseState::kInvalid)
 
-ParseState ParseRegularMessage(std::string_view* buf, RegularMessage* msg) {
+ParseState ParseRegularMessage(std::string_view* buf, RegularMessage* msg, message_type_t type) {
   BinaryDecoder decoder(*buf);
   PX_ASSIGN_OR_RETURN_NEEDS_MORE_DATA(const char char_val, decoder.ExtractChar());
   msg->tag = static_cast<Tag>(char_val);
@@ -59,7 +59,11 @@ ParseState ParseRegularMessage(std::string_view* buf, RegularMessage* msg) {
   // Len includes the length field itself (int32_t), so the payload needs to exclude 4 bytes.
   PX_ASSIGN_OR_RETURN_NEEDS_MORE_DATA(std::string_view str_view,
                                       decoder.ExtractString<char>(str_len));
-  msg->payload = std::string(str_view);
+  // Response data rows are never decoded, only counted and sized by the stitcher (see
+  // FillQueryResp()). Skip buffering their payloads; the size is recovered from the len field.
+  if (!(type == message_type_t::kResponse && msg->tag == Tag::kDataRow)) {
+    msg->payload = std::string(str_view);
+  }
 
   *buf = decoder.Buf();
   return ParseState::kSuccess;
@@ -312,15 +316,13 @@ Status ParseDesc(const RegularMessage& msg, Desc* desc) {
 template <>
 ParseState ParseFrame(message_type_t type, std::string_view* buf, pgsql::RegularMessage* frame,
                       pgsql::StateWrapper* /*state*/) {
-  PX_UNUSED(type);
-
   std::string_view buf_copy = *buf;
   pgsql::StartupMessage startup_msg = {};
   if (pgsql::ParseStartupMessage(&buf_copy, &startup_msg).ok() && !startup_msg.nvs.empty()) {
     // Ignore startup message, but remove it from the buffer.
     *buf = buf_copy;
   }
-  return pgsql::ParseRegularMessage(buf, frame);
+  return pgsql::ParseRegularMessage(buf, frame, type);
 }
 
 template <>
@@ -33,8 +33,13 @@ namespace pgsql {
 
 /**
  * Parse input data into messages.
+ *
+ * If the message type is known to be a response, data row payloads are skipped over at the
+ * length-header level, without being buffered: the stitcher only summarizes data rows (see
+ * FillQueryResp()), so their contents are never needed.
  */
-ParseState ParseRegularMessage(std::string_view* buf, RegularMessage* msg);
+ParseState ParseRegularMessage(std::string_view* buf, RegularMessage* msg,
+                               message_type_t type = message_type_t::kUnknown);
 
 Status ParseStartupMessage(std::string_view* buf, StartupMessage* msg);
 Status ParseCmdCmpl(const RegularMessage& msg, CmdCmpl* cmd_cmpl);
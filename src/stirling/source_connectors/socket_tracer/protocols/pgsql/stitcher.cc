@@ -114,18 +114,19 @@ Status FillQueryResp(MsgDeqIter* resp_iter, const MsgDeqIter& end, QueryReqResp:
         resp->timestamp_ns = iter->timestamp_ns;
       }
 
-      PX_RETURN_IF_ERROR(ParseRowDesc(*iter, &resp->row_desc));
       iter->consumed = true;
     }
 
     // The response to a SELECT query (or other queries that return row sets, such as EXPLAIN or
     // SHOW) normally consists of RowDescription, zero or more DataRow messages, and then
     // CommandComplete. Therefore we should not break out of the for loop once the first DataRow
-    // message is parsed.
+    // message is seen.
+    //
+    // Row descriptions and data rows are not decoded; the exported record only needs a summary,
+    // so data rows are counted and sized from the length header alone.
     if (iter->tag == Tag::kDataRow) {
-      DataRow data_row;
-      PX_RETURN_IF_ERROR(ParseDataRow(*iter, &data_row));
-      resp->data_rows.push_back(std::move(data_row));
+      ++resp->data_row_count;
+      resp->data_row_bytes += iter->len - sizeof(int32_t);
       iter->consumed = true;
     }
   }
@@ -187,23 +188,23 @@ Status HandleQuery(const RegularMessage& msg, MsgDeqIter* resp_iter, const MsgDe
     if (iter->tag == Tag::kRowDesc) {
       found_resp = true;
       req_resp->resp.cmd_cmpl.timestamp_ns = iter->timestamp_ns;
-      PX_RETURN_IF_ERROR(ParseRowDesc(*iter, &req_resp->resp.row_desc));
 
       iter->consumed = true;
-      req_resp->resp.timestamp_ns = req_resp->resp.row_desc.timestamp_ns;
+      req_resp->resp.timestamp_ns = iter->timestamp_ns;
     }
 
     // The response to a SELECT query (or other queries that return row sets, such as EXPLAIN or
     // SHOW) normally consists of RowDescription, zero or more DataRow messages, and then
     // CommandComplete. Therefore we should not break out of the for loop once the first DataRow
-    // message is parsed.
+    // message is seen.
+    //
+    // As in FillQueryResp(), data rows are only counted and sized, not decoded.
     if (iter->tag == Tag::kDataRow) {
-      DataRow data_row;
-      PX_RETURN_IF_ERROR(ParseDataRow(*iter, &data_row));
+      ++req_resp->resp.data_row_count;
+      req_resp->resp.data_row_bytes += iter->len - sizeof(int32_t);
 
       iter->consumed = true;
-      req_resp->resp.timestamp_ns = data_row.timestamp_ns;
-      req_resp->resp.data_rows.push_back(std::move(data_row));
+      req_resp->resp.timestamp_ns = iter->timestamp_ns;
     }
   }
 
@@ -280,13 +281,14 @@ Status HandleBind(const RegularMessage& bind_msg, MsgDeqIter* resp_iter, const M
     if (bind_req.src_prepared_stat_name.empty()) {
       state->bound_statement = state->unnamed_statement;
     } else {
-      if (!state->prepared_statements.contains(bind_req.src_prepared_stat_name)) {
+      auto stmt_iter = state->prepared_statements.find(bind_req.src_prepared_stat_name);
+      if (stmt_iter == state->prepared_statements.end()) {
         // TODO(yzhao): The code should handle the case where the previous Parse message was not
         // seen, i.e., state->prepared_statements does not contain the requested statement name.
         return error::InvalidArgument("Statement [name=$0] is not recorded",
                                       bind_req.src_prepared_stat_name);
       }
-      state->bound_statement = state->prepared_statements[bind_req.src_prepared_stat_name];
+      state->bound_statement = stmt_iter->second;
     }
     state->bound_params = bind_req.params;
     req_resp->resp.msg = CmdCmpl{.timestamp_ns = iter->timestamp_ns, .cmd_tag = "BIND COMPLETE"};
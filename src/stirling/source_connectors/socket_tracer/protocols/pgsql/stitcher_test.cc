@@ -60,11 +60,13 @@ TEST(PGSQLParseTest, FillQueryResp) {
   QueryReqResp::QueryResp query_resp;
   auto begin = resps.begin();
   ASSERT_OK(FillQueryResp(&begin, resps.end(), &query_resp));
+  // Data rows are summarized from the length headers, not decoded.
   EXPECT_EQ(
-      "Name,Owner,Encoding,Collate,Ctype,Access privileges\n"
-      "postgres,postgres,UTF8,en_US.utf8,en_US.utf8,[NULL]\n"
+      "1 data rows, 66 bytes\n"
       "SELECT 1",
       query_resp.ToString());
+  EXPECT_EQ(1, query_resp.data_row_count);
+  EXPECT_EQ(66, query_resp.data_row_bytes);
   EXPECT_EQ(begin, resps.end());
 }
 
@@ -196,9 +198,8 @@ TEST_F(StitchFramesTest, VerifySingleOutputMessage) {
                           "type_modifier=-1 fmt_code=kText] "
                           "[name=email table_oid=16384 attr_num=3 type_oid=25 type_size=-1 "
                           "type_modifier=-1 fmt_code=kText]",
-                          "BIND COMPLETE", "Jason,Moiron,jmoiron@jmoiron.net\nSELECT 238",
-                          "Name,Owner,Encoding,Collate,Ctype,Access privileges\n"
-                          "postgres,postgres,UTF8,en_US.utf8,en_US.utf8,[NULL]\n"
+                          "BIND COMPLETE", "1 data rows, 44 bytes\nSELECT 238",
+                          "1 data rows, 66 bytes\n"
                           "SELECT 238",
                           "DROP TABLE", "ROLLBACK"));
 
@@ -435,11 +435,13 @@ struct QueryReqResp {
   struct QueryResp {
     uint64_t timestamp_ns = 0;
 
-    RowDesc row_desc;
-
     bool is_err_resp = false;
 
-    std::vector<DataRow> data_rows;
+    // Data rows are deliberately not decoded. The exported record only needs a summary, so the
+    // stitcher counts rows and payload bytes straight off the messages' length headers.
+    uint64_t data_row_count = 0;
+    uint64_t data_row_bytes = 0;
+
     CmdCmpl cmd_cmpl;
     ErrResp err_resp;
 
@@ -450,16 +452,8 @@ struct QueryReqResp {
 
       std::string res;
 
-      if (!data_rows.empty()) {
-        std::vector<std::string_view> field_names = row_desc.FieldNames();
-
-        if (!field_names.empty()) {
-          absl::StrAppend(&res, absl::StrJoin(field_names, ","));
-          absl::StrAppend(&res, "\n");
-        }
-
-        absl::StrAppend(&res, absl::StrJoin(data_rows, "\n", ToStringFormatter<DataRow>()));
-        absl::StrAppend(&res, "\n");
+      if (data_row_count > 0) {
+        absl::StrAppend(&res, data_row_count, " data rows, ", data_row_bytes, " bytes\n");
       }
 
       absl::StrAppend(&res, cmd_cmpl.cmd_tag);
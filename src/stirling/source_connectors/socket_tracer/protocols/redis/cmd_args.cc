@@ -496,7 +496,7 @@ std::optional<const CmdArgs*> GetCmdAndArgs(std::string_view payload) {
 
 }  // namespace
 
-std::optional<const CmdArgs*> GetCmdAndArgs(VectorView<std::string>* payloads) {
+std::optional<const CmdArgs*> GetCmdAndArgs(VectorView<std::string_view>* payloads) {
   if (payloads->empty()) {
     return std::nullopt;
   }
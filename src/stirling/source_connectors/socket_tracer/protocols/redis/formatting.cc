@@ -34,7 +34,7 @@ constexpr std::string_view kSet = "SET";
 constexpr std::string_view kSScan = "SSCAN";
 
 // Returns a JSON string that formats the input arguments as a JSON array.
-std::string FormatAsJSONArray(VectorView<std::string> args) {
+std::string FormatAsJSONArray(VectorView<std::string_view> args) {
   std::vector<std::string_view> args_copy = {args.begin(), args.end()};
   return utils::ToJSONString(args_copy);
 }
@@ -44,7 +44,7 @@ std::string FormatAsJSONArray(VectorView<std::string> args) {
 // SCRIPT LOAD "return 1"
 // e0e1f9fabfc9d4800c877a703b823ac0578ff8db // sha hash, used in EVALSHA to reference this script.
 // EVALSHA e0e1f9fabfc9d4800c877a703b823ac0578ff8db 2 1 1 2 2
-StatusOr<std::string> FormatEvalSHAArgs(VectorView<std::string> args) {
+StatusOr<std::string> FormatEvalSHAArgs(VectorView<std::string_view> args) {
   constexpr size_t kEvalSHAMinArgCount = 4;
   if (args.size() < kEvalSHAMinArgCount) {
     return error::InvalidArgument("EVALSHA requires at least 4 arguments, got $0",
@@ -79,7 +79,7 @@ StatusOr<std::string> FormatEvalSHAArgs(VectorView<std::string> args) {
 // [NX|XX] [GET]
 //
 // The values after key & value is grouped into options field.
-StatusOr<std::string> FormatSet(VectorView<std::string> args) {
+StatusOr<std::string> FormatSet(VectorView<std::string_view> args) {
   constexpr size_t kMinArgsCount = 2;
   if (args.size() < kMinArgsCount) {
     return error::InvalidArgument("SET expects at least 2 arguments, got $0", args.size());
@@ -120,7 +120,7 @@ StatusOr<std::string> FormatSet(VectorView<std::string> args) {
 
 // SSCAN is formatted as:
 // SSCAN key cursor [MATCH pattern] [COUNT count]
-StatusOr<std::string> FormatSScan(VectorView<std::string> args) {
+StatusOr<std::string> FormatSScan(VectorView<std::string_view> args) {
   constexpr size_t kMinArgsCount = 2;
   if (args.size() < kMinArgsCount) {
     return error::InvalidArgument("Redis SSCAN command expects at least 2 arguments, got $0",
@@ -161,7 +161,7 @@ StatusOr<std::string> FormatSScan(VectorView<std::string> args) {
 
 // Extracts arguments from the input argument values, and formats them according to the argument
 // format.
-Status FmtArg(const ArgDesc& arg_desc, VectorView<std::string>* args,
+Status FmtArg(const ArgDesc& arg_desc, VectorView<std::string_view>* args,
               utils::JSONObjectBuilder* json_builder) {
 #define RETURN_ERROR_IF_EMPTY(arg_values, arg_desc)                                   \
   if (arg_values->empty()) {                                                          \
@@ -197,7 +197,7 @@ Status FmtArg(const ArgDesc& arg_desc, VectorView<std::string>* args,
 }
 
 // Formats the input argument value based on this detected format of this command.
-StatusOr<std::string> FmtArgs(const CmdArgs& cmd_args, VectorView<std::string> args) {
+StatusOr<std::string> FmtArgs(const CmdArgs& cmd_args, VectorView<std::string_view> args) {
   if (cmd_args.cmd_name_ == kEvalSHA) {
     auto res_or = FormatEvalSHAArgs(args);
     if (res_or.ok()) {
@@ -232,7 +232,7 @@ StatusOr<std::string> FmtArgs(const CmdArgs& cmd_args, VectorView<std::string> a
 
 // Redis wire protocol said requests are array consisting of bulk strings:
 // https://redis.io/topics/protocol#sending-commands-to-a-redis-server
-void FormatArrayMessage(VectorView<std::string> payloads_view, Message* msg) {
+void FormatArrayMessage(VectorView<std::string_view> payloads_view, Message* msg) {
   std::optional<const CmdArgs*> cmd_args_opt = GetCmdAndArgs(&payloads_view);
 
   // If no command is found, this array message is formatted as JSON array.
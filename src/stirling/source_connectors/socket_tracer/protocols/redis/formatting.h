@@ -19,6 +19,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include "src/common/base/base.h"
 #include "src/common/json/json.h"
@@ -30,8 +31,9 @@ namespace protocols {
 namespace redis {
 
 // Formats an the payloads of an array message according to its type type, and writes the result
-// to the input message result argument.
-void FormatArrayMessage(VectorView<std::string> payloads_view, Message* msg);
+// to the input message result argument. The payloads are views into the parser's stream buffer,
+// and are only read during formatting.
+void FormatArrayMessage(VectorView<std::string_view> payloads_view, Message* msg);
 
 }  // namespace redis
 }  // namespace protocols
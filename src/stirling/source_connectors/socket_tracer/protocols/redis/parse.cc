@@ -18,6 +18,7 @@
 
 #include "src/stirling/source_connectors/socket_tracer/protocols/redis/parse.h"
 
+#include <deque>
 #include <initializer_list>
 #include <map>
 #include <optional>
@@ -74,7 +75,7 @@ StatusOr<int> ParseSize(BinaryDecoder* decoder) {
 }
 
 // Bulk string is formatted as <length>\r\n<actual string, up to 512MB>\r\n
-Status ParseBulkString(BinaryDecoder* decoder, Message* msg) {
+StatusOr<std::string_view> ParseBulkString(BinaryDecoder* decoder) {
   PX_ASSIGN_OR_RETURN(int len, ParseSize(decoder));
 
   constexpr int kMaxLen = 512 * 1024 * 1024;
@@ -86,8 +87,7 @@ Status ParseBulkString(BinaryDecoder* decoder, Message* msg) {
     constexpr std::string_view kNullBulkString = "<NULL>";
     // TODO(yzhao): This appears wrong, as Redis has NULL value, here "<NULL>" is presented as
     // a string. ATM don't know how to output NULL value in Rapidjson. Research and update this.
-    msg->payload = kNullBulkString;
-    return Status::OK();
+    return kNullBulkString;
   }
 
   PX_ASSIGN_OR_RETURN(std::string_view payload,
@@ -96,11 +96,10 @@ Status ParseBulkString(BinaryDecoder* decoder, Message* msg) {
     return error::InvalidArgument("Bulk string should be terminated by '$0'", kTerminalSequence);
   }
   payload.remove_suffix(kTerminalSequence.size());
-  msg->payload = payload;
-  return Status::OK();
+  return payload;
 }
 
-bool IsPubMsg(const std::vector<std::string>& payloads) {
+bool IsPubMsg(const std::vector<std::string_view>& payloads) {
   // Published message format is at https://redis.io/topics/pubsub#format-of-pushed-messages
   constexpr size_t kArrayPayloadSize = 3;
   if (payloads.size() < kArrayPayloadSize) {
@@ -113,69 +112,98 @@ bool IsPubMsg(const std::vector<std::string>& payloads) {
   return true;
 }
 
-// This calls ParseMessage(), which eventually calls ParseArray() and are both recursive
-// functions. This is because Array message can include nested array messages.
-Status ParseArray(message_type_t type, BinaryDecoder* decoder, Message* msg);
-
+// A partially-parsed array message. Tracks how many elements are still to be parsed, and the
+// payloads of the elements parsed so far.
+struct ArrayFrame {
+  int remaining = 0;
+  std::vector<std::string_view> payloads;
+};
+
+// Parses a single RESP message iteratively, using an explicit stack of array frames instead of
+// recursion (arrays can contain nested arrays). Scalar elements are kept as string_views over the
+// stream buffer; owned storage is only needed for payloads that are synthesized during parsing
+// (error messages and formatted nested arrays), which are kept in a deque so that views into them
+// remain stable.
 Status ParseMessage(message_type_t type, BinaryDecoder* decoder, Message* msg) {
-  PX_ASSIGN_OR_RETURN(const char type_marker, decoder->ExtractChar());
-
-  switch (type_marker) {
-    case kSimpleStringMarker: {
-      PX_ASSIGN_OR_RETURN(std::string_view str, decoder->ExtractStringUntil(kTerminalSequence));
-      msg->payload = str;
-      break;
-    }
-    case kBulkStringsMarker: {
-      PX_RETURN_IF_ERROR(ParseBulkString(decoder, msg));
-      break;
-    }
-    case kErrorMarker: {
-      PX_ASSIGN_OR_RETURN(std::string_view str, decoder->ExtractStringUntil(kTerminalSequence));
-      // Append ErrorMarker in front to differentiate error messages from the rest.
-      msg->payload = absl::StrCat("-", str);
-      break;
-    }
-    case kIntegerMarker: {
-      PX_ASSIGN_OR_RETURN(msg->payload, decoder->ExtractStringUntil(kTerminalSequence));
-      break;
+  std::vector<ArrayFrame> array_stack;
+  std::deque<std::string> scratch;
+
+  for (;;) {
+    PX_ASSIGN_OR_RETURN(const char type_marker, decoder->ExtractChar());
+
+    std::optional<std::string_view> payload;
+
+    switch (type_marker) {
+      case kSimpleStringMarker: {
+        PX_ASSIGN_OR_RETURN(std::string_view str, decoder->ExtractStringUntil(kTerminalSequence));
+        payload = str;
+        break;
+      }
+      case kBulkStringsMarker: {
+        PX_ASSIGN_OR_RETURN(std::string_view str, ParseBulkString(decoder));
+        payload = str;
+        break;
+      }
+      case kErrorMarker: {
+        PX_ASSIGN_OR_RETURN(std::string_view str, decoder->ExtractStringUntil(kTerminalSequence));
+        // Append ErrorMarker in front to differentiate error messages from the rest.
+        payload = scratch.emplace_back(absl::StrCat("-", str));
+        break;
+      }
+      case kIntegerMarker: {
+        PX_ASSIGN_OR_RETURN(std::string_view str, decoder->ExtractStringUntil(kTerminalSequence));
+        payload = str;
+        break;
+      }
+      case kArrayMarker: {
+        // Array is formatted as *<size_str>\r\n[one of simple string, error, bulk string, etc.]
+        PX_ASSIGN_OR_RETURN(int len, ParseSize(decoder));
+        if (len == kNullSize) {
+          constexpr std::string_view kNullArray = "[NULL]";
+          payload = kNullArray;
+          break;
+        }
+        // Note: the size is not used to reserve the payloads vector, because it comes straight
+        // off the wire and could be arbitrarily large for misclassified traffic.
+        array_stack.emplace_back().remaining = len;
+        break;
+      }
+      default:
+        return error::InvalidArgument(
+            "Unexpected Redis type marker char (displayed as integer): %d", type_marker);
     }
-    case kArrayMarker: {
-      PX_RETURN_IF_ERROR(ParseArray(type, decoder, msg));
-      break;
-    }
-    default:
-      return error::InvalidArgument("Unexpected Redis type marker char (displayed as integer): %d",
-                                    type_marker);
-  }
-  // This is needed for GCC build.
-  return Status::OK();
-}
-
-// Array is formatted as *<size_str>\r\n[one of simple string, error, bulk string, etc.]
-Status ParseArray(message_type_t type, BinaryDecoder* decoder, Message* msg) {
-  PX_ASSIGN_OR_RETURN(int len, ParseSize(decoder));
 
-  if (len == kNullSize) {
-    constexpr std::string_view kNullArray = "[NULL]";
-    msg->payload = kNullArray;
-    return Status::OK();
-  }
-
-  std::vector<std::string> payloads;
-  for (int i = 0; i < len; ++i) {
-    Message tmp;
-    PX_RETURN_IF_ERROR(ParseMessage(type, decoder, &tmp));
-    payloads.push_back(std::move(tmp.payload));
-  }
-
-  FormatArrayMessage(VectorView<std::string>(payloads), msg);
+    if (payload.has_value()) {
+      if (array_stack.empty()) {
+        // A scalar message at the top level is the whole message.
+        msg->payload = *payload;
+        return Status::OK();
+      }
+      array_stack.back().payloads.push_back(*payload);
+      --array_stack.back().remaining;
+    }
 
-  if (type == message_type_t::kResponse && IsPubMsg(payloads)) {
-    msg->is_published_message = true;
+    // Close out any arrays whose elements have all been parsed. Closing an array produces the
+    // payload of an element of its parent array, which in turn might become complete.
+    while (!array_stack.empty() && array_stack.back().remaining <= 0) {
+      ArrayFrame frame = std::move(array_stack.back());
+      array_stack.pop_back();
+
+      Message array_msg;
+      FormatArrayMessage(VectorView<std::string_view>(frame.payloads), &array_msg);
+
+      if (array_stack.empty()) {
+        msg->payload = std::move(array_msg.payload);
+        msg->command = array_msg.command;
+        if (type == message_type_t::kResponse && IsPubMsg(frame.payloads)) {
+          msg->is_published_message = true;
+        }
+        return Status::OK();
+      }
+      array_stack.back().payloads.push_back(scratch.emplace_back(std::move(array_msg.payload)));
+      --array_stack.back().remaining;
+    }
   }
-
-  return Status::OK();
 }
 
 }  // namespace
@@ -193,7 +221,6 @@ size_t FindMessageBoundary(std::string_view buf, size_t start_pos) {
 }
 
 // Redis protocol specification: https://redis.io/topics/protocol
-// This can also be implemented as a recursive function.
 ParseState ParseMessage(message_type_t type, std::string_view* buf, Message* msg) {
   BinaryDecoder decoder(*buf);
 
@@ -43,6 +43,7 @@ inline RecordsWithErrorCount<redis::Record> StitchFrames(std::deque<redis::Messa
   // See below.
 
   std::vector<redis::Record> records;
+  int error_count = 0;
 
   redis::Record record;
   record.req.timestamp_ns = 0;
@@ -114,6 +115,10 @@ inline RecordsWithErrorCount<redis::Record> StitchFrames(std::deque<redis::Messa
 
         record.req.timestamp_ns = 0;
         record.resp.timestamp_ns = 0;
+      } else {
+        // Same lost-frame accounting as StitchMessagesWithTimestampOrder(): the response's
+        // request frame was never seen.
+        ++error_count;
       }
       ++resp_iter;
     }
@@ -122,7 +127,7 @@ inline RecordsWithErrorCount<redis::Record> StitchFrames(std::deque<redis::Messa
   req_messages->erase(req_messages->begin(), req_iter);
   resp_messages->erase(resp_messages->begin(), resp_iter);
 
-  return {std::move(records), 0};
+  return {std::move(records), error_count};
 }
 
 }  // namespace protocols
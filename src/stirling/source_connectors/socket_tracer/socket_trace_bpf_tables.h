@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "src/stirling/bpf_tools/bcc_wrapper.h"
@@ -45,6 +46,11 @@ class ConnInfoMapManager {
 
   void CleanupBPFMapLeaks(ConnTrackersManager* conn_trackers_mgr);
 
+  // Returns a snapshot of all conn_info_map entries, keyed by the BPF-side tgid+fd key.
+  std::vector<std::pair<uint64_t, struct conn_info_t>> GetConnInfoEntries() {
+    return conn_info_map_->GetTableOffline();
+  }
+
  private:
   std::unique_ptr<WrappedBCCMap<uint64_t, struct conn_info_t>> conn_info_map_;
   std::unique_ptr<WrappedBCCMap<uint64_t, uint64_t>> conn_disabled_map_;
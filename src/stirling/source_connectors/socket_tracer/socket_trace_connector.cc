@@ -27,7 +27,11 @@
 #include <utility>
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/hash/hash.h>
 #include <absl/strings/match.h>
+#include <absl/strings/numbers.h>
+#include <absl/strings/str_split.h>
+#include <absl/strings/strip.h>
 #include <google/protobuf/text_format.h>
 #include <google/protobuf/util/delimited_message_util.h>
 #include <magic_enum.hpp>
@@ -44,6 +48,7 @@
 #include "src/stirling/source_connectors/socket_tracer/bcc_bpf_intf/socket_trace.hpp"
 #include "src/stirling/source_connectors/socket_tracer/conn_stats.h"
 #include "src/stirling/source_connectors/socket_tracer/proto/sock_event.pb.h"
+#include "src/stirling/source_connectors/socket_tracer/protocols/http/parse.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/http/utils.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/http2/grpc.h"
 #include "src/stirling/utils/linux_headers.h"
@@ -62,6 +67,33 @@ DEFINE_uint32(stirling_socket_tracer_stats_logging_ratio,
 DEFINE_bool(stirling_enable_periodic_bpf_map_cleanup, true,
             "Disable periodic BPF map cleanup (for testing)");
 
+DEFINE_uint32(stirling_socket_tracer_transfer_threads,
+              gflags::Uint32FromEnv("PX_STIRLING_TRANSFER_THREADS", 1),
+              "Number of worker threads used to parse and stitch conn trackers during "
+              "TransferData. Trackers are partitioned across threads by connection hash. "
+              "A value of 1 keeps all processing on the transfer thread.");
+
+DEFINE_bool(stirling_conn_tracker_dirty_list,
+            gflags::BoolFromEnv("PX_STIRLING_CONN_TRACKER_DIRTY_LIST", true),
+            "If true, each TransferData iteration only processes the conn trackers that received "
+            "BPF events since the previous iteration, making per-iteration cost proportional to "
+            "the number of active connections. All trackers are still processed on periodic "
+            "sweep iterations (see --stirling_conn_tracker_sweep_ratio).");
+
+DEFINE_uint32(stirling_conn_tracker_sweep_ratio,
+              std::chrono::seconds(5) / px::stirling::SocketTraceConnector::kSamplingPeriod,
+              "Ratio of how frequently all conn trackers (rather than only those with new events) "
+              "are processed, so that idle trackers still age out and expire buffered data. "
+              "Only meaningful with --stirling_conn_tracker_dirty_list.");
+
+DEFINE_int32(stirling_http_bpf_capture_limit_bytes,
+             gflags::Int32FromEnv("PX_STIRLING_HTTP_BPF_CAPTURE_LIMIT_BYTES", 0),
+             "Maximum number of bytes captured per HTTP message in BPF. Bytes beyond this limit "
+             "are not copied through the perf buffer, since user space discards them anyway "
+             "(see --http_body_limit_bytes). 0 sizes the limit automatically from "
+             "--http_body_limit_bytes plus a headers allowance; a negative value disables the "
+             "in-kernel cap.");
+
 DEFINE_int32(test_only_socket_trace_target_pid, kTraceAllTGIDs,
              "The PID of a process to trace. This forces BPF to export events by ignoring event "
              "filtering. The purpose is to observe the underlying raw events for debugging.");
@@ -121,6 +153,33 @@ DEFINE_bool(stirling_disable_golang_tls_tracing,
 DEFINE_bool(stirling_disable_self_tracing, true,
             "If true, stirling will not trace and process syscalls made by itself.");
 
+DEFINE_string(stirling_trace_allow_cidrs,
+              gflags::StringFromEnv("PX_STIRLING_TRACE_ALLOW_CIDRS", ""),
+              "Comma-separated list of CIDRs (e.g. 10.0.0.0/8,fd00::/8). When set, only "
+              "connections whose remote endpoint falls within one of the CIDRs are traced. "
+              "Filtering is performed inside BPF, before events cross the perf buffers.");
+DEFINE_string(stirling_trace_deny_cidrs, gflags::StringFromEnv("PX_STIRLING_TRACE_DENY_CIDRS", ""),
+              "Comma-separated list of CIDRs (e.g. 127.0.0.0/8). Connections whose remote "
+              "endpoint falls within one of the CIDRs are never traced. Deny entries take "
+              "precedence over allow entries.");
+DEFINE_string(stirling_trace_allow_ports,
+              gflags::StringFromEnv("PX_STIRLING_TRACE_ALLOW_PORTS", ""),
+              "Comma-separated list of ports. When set, only connections whose remote endpoint "
+              "uses one of the ports are traced.");
+DEFINE_string(stirling_trace_deny_ports, gflags::StringFromEnv("PX_STIRLING_TRACE_DENY_PORTS", ""),
+              "Comma-separated list of ports. Connections whose remote endpoint uses one of the "
+              "ports are never traced.");
+DEFINE_string(stirling_protocol_inference_port_hints,
+              gflags::StringFromEnv("PX_STIRLING_PROTOCOL_INFERENCE_PORT_HINTS", ""),
+              "Comma-separated list of <port>=<protocol> entries (e.g. '3306=mysql,6379=redis') "
+              "seeding the kernel-side protocol hint map. Connections to a hinted port try the "
+              "hinted protocol's matcher before the full inference chain.");
+DEFINE_bool(stirling_protocol_inference_learned_hints,
+            gflags::BoolFromEnv("PX_STIRLING_PROTOCOL_INFERENCE_LEARNED_HINTS", true),
+            "If true, protocols classified on client-side connections are fed back into the "
+            "kernel-side protocol hint map, so that later connections to the same server port "
+            "skip the full inference chain.");
+
 // Assume a moderate default network bandwidth peak of 100MiB/s across socket connections for data.
 DEFINE_uint32(stirling_socket_tracer_target_data_bw_percpu, 100 * 1024 * 1024,
               "Target bytes/sec of data per CPU");
@@ -143,6 +202,21 @@ DEFINE_uint64(stirling_socket_tracer_max_total_data_bw,
               "Maximum total bytes/sec of data.");
 DEFINE_uint64(stirling_socket_tracer_max_total_control_bw, 512 * 1024 * 1024 / 8 /*512Mibit/s*/,
               "Maximum total bytes/sec of control events.");
+DEFINE_bool(stirling_socket_tracer_overload_shedding,
+            gflags::BoolFromEnv("PX_STIRLING_OVERLOAD_SHEDDING", true),
+            "If true, sustained perf buffer event loss causes protocol data tracing to be shed "
+            "one protocol at a time (least valuable first) until the loss subsides. Conn stats "
+            "tracing is never shed.");
+DEFINE_uint32(stirling_socket_tracer_shed_loss_threshold, 1000,
+              "Number of lost perf buffer data events in one sampling window above which the "
+              "window counts towards overload shedding.");
+DEFINE_uint32(stirling_socket_tracer_shed_windows, 3,
+              "Number of consecutive windows with loss above the threshold before one more "
+              "protocol's data tracing is shed.");
+DEFINE_uint32(stirling_socket_tracer_recover_windows, 150,
+              "Number of consecutive loss-free windows before the most recently shed protocol's "
+              "data tracing is restored.");
+
 DEFINE_double(stirling_socket_tracer_max_total_bw_overprovision_factor, 1,
               "Factor to overprovision maximum total bandwidth, to account for the fact that "
               "traffic won't be exactly evenly distributed over all cpus.");
@@ -160,6 +234,13 @@ DEFINE_uint32(
 DEFINE_uint32(datastream_buffer_retention_size,
               gflags::Uint32FromEnv("PL_DATASTREAM_BUFFER_SIZE", 1024 * 1024),
               "The maximum size of a data stream buffer retained between cycles.");
+DEFINE_uint64(datastream_buffer_global_retention_budget_bytes,
+              gflags::Uint64FromEnv("PL_DATASTREAM_BUFFER_GLOBAL_BUDGET_BYTES", 0),
+              "When non-zero, a global budget for data stream buffer retention, redistributed "
+              "across connection trackers every iteration in proportion to the bytes each one "
+              "has buffered. High-throughput streams borrow retention from idle ones, instead of "
+              "every stream reserving datastream_buffer_retention_size. 0 keeps the fixed "
+              "per-stream limit.");
 
 DEFINE_uint64(max_body_bytes, gflags::Uint64FromEnv("PL_STIRLING_MAX_BODY_BYTES", 512),
               "The maximum number of bytes in the body of protocols like HTTP");
@@ -177,6 +258,7 @@ OBJ_STRVIEW(socket_trace_bcc_script, socket_trace);
 namespace px {
 namespace stirling {
 
+using px::stirling::bpf_tools::WrappedBCCMap;
 using px::stirling::bpf_tools::WrappedBCCPerCPUArrayTable;
 using px::system::ProcPath;
 using px::system::ProcPidPath;
@@ -206,6 +288,7 @@ SocketTraceConnector::SocketTraceConnector(std::string_view source_name)
           BuildCounterFamily(openssl_tls_source_metric, openssl_tls_source_help)),
       uprobe_mgr_(&this->BCC()) {
   proc_parser_ = std::make_unique<system::ProcParser>();
+  fd_link_cache_ = std::make_unique<FDLinkCache>(proc_parser_.get());
   InitProtocolTransferSpecs();
 }
 
@@ -428,6 +511,22 @@ auto SocketTraceConnector::InitPerfBufferSpecs() {
   return specs;
 }
 
+namespace {
+
+// Returns the per-message HTTP capture limit to compile into the BPF program, in bytes.
+// Negative means the in-kernel cap is disabled.
+int32_t HTTPCaptureLimitBytes() {
+  if (FLAGS_stirling_http_bpf_capture_limit_bytes != 0) {
+    return FLAGS_stirling_http_bpf_capture_limit_bytes;
+  }
+  // Automatic sizing: the retained body plus an allowance for the headers (and for chunked
+  // encoding overhead), since the body limit alone would risk cutting into parseable data.
+  constexpr int32_t kHTTPHeadersAllowanceBytes = 16384;
+  return static_cast<int32_t>(FLAGS_http_body_limit_bytes) + kHTTPHeadersAllowanceBytes;
+}
+
+}  // namespace
+
 Status SocketTraceConnector::InitBPF() {
   // PROTOCOL_LIST: Requires update on new protocols.
   std::vector<std::string> defines = {
@@ -443,6 +542,7 @@ Status SocketTraceConnector::InitBPF() {
       absl::StrCat("-DENABLE_NATS_TRACING=", protocol_transfer_specs_[kProtocolNATS].enabled),
       absl::StrCat("-DENABLE_AMQP_TRACING=", protocol_transfer_specs_[kProtocolAMQP].enabled),
       absl::StrCat("-DENABLE_MONGO_TRACING=", "true"),
+      absl::StrCat("-DHTTP_CAPTURE_LIMIT_BYTES=", HTTPCaptureLimitBytes()),
   };
   PX_RETURN_IF_ERROR(bcc_->InitBPFProgram(socket_trace_bcc_script, defines));
 
@@ -457,11 +557,7 @@ Status SocketTraceConnector::InitBPF() {
   // Set trace role to BPF probes.
   for (const auto& p : magic_enum::enum_values<traffic_protocol_t>()) {
     if (protocol_transfer_specs_[p].enabled) {
-      uint64_t role_mask = 0;
-      for (auto role : protocol_transfer_specs_[p].trace_roles) {
-        role_mask |= role;
-      }
-      PX_RETURN_IF_ERROR(UpdateBPFProtocolTraceRole(p, role_mask));
+      PX_RETURN_IF_ERROR(UpdateBPFProtocolTraceRole(p, ConfiguredProtocolRoleMask(p)));
     }
   }
 
@@ -469,6 +565,8 @@ Status SocketTraceConnector::InitBPF() {
   if (FLAGS_stirling_disable_self_tracing) {
     PX_RETURN_IF_ERROR(DisableSelfTracing());
   }
+  PX_RETURN_IF_ERROR(ConfigureEndpointFilters());
+  PX_RETURN_IF_ERROR(ConfigureProtocolHints());
   if (!FLAGS_socket_trace_data_events_output_path.empty()) {
     SetupOutput(FLAGS_socket_trace_data_events_output_path);
   }
@@ -630,6 +728,10 @@ void SocketTraceConnector::UpdateCommonState(ConnectorContext* ctx) {
   // It may be worth noting during debug.
   bcc_->PollPerfBuffers();
 
+  // The loss counters are updated by the perf buffer callbacks, so check for overload right
+  // after draining.
+  ManageOverloadShedding();
+
   // Set-up current state for connection inference purposes.
   if (socket_info_mgr_ != nullptr) {
     socket_info_mgr_->Flush();
@@ -729,6 +831,7 @@ void SocketTraceConnector::TransferDataImpl(ConnectorContext* ctx) {
   DataTable* conn_stats_table = data_tables_[kConnStatsTableNum];
   if (conn_stats_table != nullptr &&
       sampling_freq_mgr_.count() % FLAGS_stirling_conn_stats_sampling_ratio == 0) {
+    SnapshotConnStats();
     TransferConnStats(ctx, conn_stats_table);
   }
 
@@ -748,6 +851,14 @@ void SocketTraceConnector::TransferDataImpl(ConnectorContext* ctx) {
 
   std::vector<CIDRBlock> cluster_cidrs = ctx->GetClusterCIDRs();
 
+  // Adapt per-tracker buffer retention limits to the observed demand before the trackers'
+  // buffers are cleaned up below (in the transfer functions).
+  if (FLAGS_datastream_buffer_global_retention_budget_bytes > 0) {
+    conn_trackers_mgr_.UpdateBufferRetentionLimits(
+        FLAGS_datastream_buffer_global_retention_budget_bytes,
+        FLAGS_datastream_buffer_retention_size);
+  }
+
   for (size_t i = 0; i < data_tables_.size(); ++i) {
     DataTable* data_table = data_tables_[i];
 
@@ -759,16 +870,33 @@ void SocketTraceConnector::TransferDataImpl(ConnectorContext* ctx) {
     }
   }
 
-  for (const auto& conn_tracker : conn_trackers_mgr_.active_trackers()) {
-    const auto& transfer_spec = protocol_transfer_specs_[conn_tracker->protocol()];
+  const size_t num_shards = std::max<uint32_t>(1, FLAGS_stirling_socket_tracer_transfer_threads);
 
-    DataTable* data_table = nullptr;
-    if (transfer_spec.enabled) {
-      data_table = data_tables_[transfer_spec.table_num];
-    }
+  // Most iterations only process trackers that received BPF events since the previous iteration.
+  // Periodic full sweeps still visit every tracker, so that idle trackers age out (inactivity
+  // handling, death countdowns) and expire old buffered data.
+  // Trace-level disables must also reach all trackers, since the pid list is cleared below.
+  const bool full_sweep =
+      !FLAGS_stirling_conn_tracker_dirty_list ||
+      sampling_freq_mgr_.count() % std::max<uint32_t>(1, FLAGS_stirling_conn_tracker_sweep_ratio) ==
+          0 ||
+      !pids_to_trace_disable_.empty();
 
+  // Phase 1: per-tracker bookkeeping that touches shared connector state (trace levels, UPID
+  // tracking, socket info inference) stays on the transfer thread. While at it, partition the
+  // trackers by connection hash, so each tracker is processed by the same shard every iteration.
+  std::vector<std::vector<ConnTracker*>> shards(num_shards);
+
+  // FD tables cached in the previous iteration are stale; resolvers need a fresh sample.
+  fd_link_cache_->NewCycle();
+
+  auto pre_tick_tracker = [&](ConnTracker* conn_tracker) {
     UpdateTrackerTraceLevel(conn_tracker);
 
+    if (FLAGS_stirling_protocol_inference_learned_hints) {
+      RecordProtocolHint(*conn_tracker);
+    }
+
     // Once a known UPID, always a known UPID.
     if (!conn_tracker->is_tracked_upid()) {
       md::UPID upid(ctx->GetASID(), conn_tracker->conn_id().upid.pid,
@@ -779,25 +907,84 @@ void SocketTraceConnector::TransferDataImpl(ConnectorContext* ctx) {
     }
 
     conn_tracker->IterationPreTick(iteration_time_, cluster_cidrs, proc_parser_.get(),
-                                   socket_info_mgr_.get());
+                                   socket_info_mgr_.get(), fd_link_cache_.get());
 
-    if (transfer_spec.transfer_fn != nullptr) {
-      transfer_spec.transfer_fn(*this, ctx, conn_tracker, data_table);
-    } else {
-      // If there's no transfer function, then the tracker should not be holding any data.
-      // http::ProtocolTraits is used as a placeholder; the frames deque is expected to be
-      // std::monotstate.
-      ECHECK(conn_tracker->send_data().Empty<protocols::http::Message>());
-      ECHECK(conn_tracker->recv_data().Empty<protocols::http::Message>());
+    const auto& conn_id = conn_tracker->conn_id();
+    size_t shard_idx =
+        absl::HashOf(conn_id.upid.pid, conn_id.upid.start_time_ticks, conn_id.fd, conn_id.tsid) %
+        num_shards;
+    shards[shard_idx].push_back(conn_tracker);
+  };
+
+  if (full_sweep) {
+    for (const auto& conn_tracker : conn_trackers_mgr_.active_trackers()) {
+      pre_tick_tracker(conn_tracker);
+    }
+  } else {
+    for (ConnTracker* conn_tracker : conn_trackers_mgr_.dirty_trackers()) {
+      // Trackers that are ready for destruction have been removed from active_trackers(),
+      // but may still receive late events. Match the full-sweep behavior by skipping them.
+      if (conn_tracker->ReadyForDestruction()) {
+        continue;
+      }
+      pre_tick_tracker(conn_tracker);
+    }
+  }
+
+  // Phase 2: parse and stitch each shard. This is the CPU-heavy part of the iteration, and only
+  // operates on tracker-local state; writes to the shared DataTables are staged as tasks.
+  std::vector<AppendTaskList> append_tasks(num_shards);
+  auto process_shard = [&](size_t shard_idx) {
+    for (ConnTracker* conn_tracker : shards[shard_idx]) {
+      const auto& transfer_spec = protocol_transfer_specs_[conn_tracker->protocol()];
+
+      DataTable* data_table = nullptr;
+      if (transfer_spec.enabled) {
+        data_table = data_tables_[transfer_spec.table_num];
+      }
+
+      if (transfer_spec.transfer_fn != nullptr) {
+        transfer_spec.transfer_fn(*this, ctx, conn_tracker, data_table, &append_tasks[shard_idx]);
+      } else {
+        // If there's no transfer function, then the tracker should not be holding any data.
+        // http::ProtocolTraits is used as a placeholder; the frames deque is expected to be
+        // std::monotstate.
+        ECHECK(conn_tracker->send_data().Empty<protocols::http::Message>());
+        ECHECK(conn_tracker->recv_data().Empty<protocols::http::Message>());
+      }
+
+      conn_tracker->IterationPostTick();
     }
+  };
 
-    conn_tracker->IterationPostTick();
+  if (num_shards == 1) {
+    process_shard(0);
+  } else {
+    std::vector<std::thread> workers;
+    workers.reserve(num_shards);
+    for (size_t i = 0; i < num_shards; ++i) {
+      workers.emplace_back(process_shard, i);
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  }
+
+  // Phase 3: run the staged appends serially, since DataTable is not thread-safe.
+  for (auto& shard_tasks : append_tasks) {
+    for (auto& append_task : shard_tasks) {
+      append_task();
+    }
   }
 
   CheckTracerState();
 
   // Once we've cleared all the debug trace levels for this pid, we can remove it from the list.
   pids_to_trace_disable_.clear();
+
+  // The dirty trackers have been processed; events arriving from the next poll belong to a new
+  // generation.
+  conn_trackers_mgr_.StartNewGeneration();
 }
 
 Status SocketTraceConnector::UpdateBPFProtocolTraceRole(traffic_protocol_t protocol,
@@ -806,6 +993,115 @@ Status SocketTraceConnector::UpdateBPFProtocolTraceRole(traffic_protocol_t proto
   return control_map->SetValues(static_cast<int>(protocol), role_mask);
 }
 
+uint64_t SocketTraceConnector::ConfiguredProtocolRoleMask(traffic_protocol_t protocol) {
+  uint64_t role_mask = 0;
+  for (auto role : protocol_transfer_specs_[protocol].trace_roles) {
+    role_mask |= role;
+  }
+  return role_mask;
+}
+
+void SocketTraceConnector::set_data_tables(std::vector<DataTable*> data_tables) {
+  SourceConnector::set_data_tables(std::move(data_tables));
+
+  for (const auto& p : magic_enum::enum_values<traffic_protocol_t>()) {
+    TransferSpec& spec = protocol_transfer_specs_[p];
+    if (!spec.enabled || data_tables_[spec.table_num] != nullptr) {
+      continue;
+    }
+
+    spec.enabled = false;
+    LOG(INFO) << absl::Substitute(
+        "Disabling $0 tracing, because its output table is not subscribed.",
+        magic_enum::enum_name(p));
+
+    // Tables are set after Init(), so the BPF trace role set during InitImpl() must be
+    // cleared too, to stop kernel-side event submission for the protocol.
+    // In tests, tables may be set without BPF being deployed; skip the map update then.
+    if (state() == State::kActive) {
+      Status s = UpdateBPFProtocolTraceRole(p, /* role_mask */ 0);
+      LOG_IF(ERROR, !s.ok()) << absl::Substitute(
+          "Failed to disable BPF trace role for protocol $0, error: $1", magic_enum::enum_name(p),
+          s.ToString());
+    }
+  }
+}
+
+namespace {
+
+// The order in which protocol data tracing is shed under sustained perf buffer loss.
+// Earlier entries are shed first; HTTP goes last as it is typically the most valuable signal.
+// Conn stats are unaffected by shedding, since they bypass the protocol trace roles.
+constexpr traffic_protocol_t kLoadSheddingOrder[] = {
+    kProtocolAMQP,  kProtocolNATS,  kProtocolMux,   kProtocolRedis,
+    kProtocolDNS,   kProtocolKafka, kProtocolCQL,   kProtocolPGSQL,
+    kProtocolMySQL, kProtocolMongo, kProtocolHTTP2, kProtocolHTTP,
+};
+
+}  // namespace
+
+void SocketTraceConnector::ManageOverloadShedding() {
+  if (!FLAGS_stirling_socket_tracer_overload_shedding) {
+    return;
+  }
+
+  const int64_t loss_count =
+      stats_.Get(StatKey::kLossSocketDataEvent) + stats_.Get(StatKey::kLossHTTP2Event);
+  const int64_t loss_delta = loss_count - shed_prev_loss_count_;
+  shed_prev_loss_count_ = loss_count;
+
+  if (loss_delta >= static_cast<int64_t>(FLAGS_stirling_socket_tracer_shed_loss_threshold)) {
+    ++shed_windows_with_loss_;
+    shed_windows_without_loss_ = 0;
+  } else if (loss_delta == 0) {
+    shed_windows_with_loss_ = 0;
+    ++shed_windows_without_loss_;
+  } else {
+    // Some loss, but below the threshold: hold the current shedding level.
+    shed_windows_with_loss_ = 0;
+    shed_windows_without_loss_ = 0;
+  }
+
+  if (shed_windows_with_loss_ >= static_cast<int>(FLAGS_stirling_socket_tracer_shed_windows)) {
+    shed_windows_with_loss_ = 0;
+    for (traffic_protocol_t protocol : kLoadSheddingOrder) {
+      if (!protocol_transfer_specs_[protocol].enabled ||
+          std::find(shed_protocols_.begin(), shed_protocols_.end(), protocol) !=
+              shed_protocols_.end()) {
+        continue;
+      }
+      Status s = UpdateBPFProtocolTraceRole(protocol, /* role_mask */ 0);
+      if (!s.ok()) {
+        LOG(ERROR) << absl::Substitute("Failed to shed $0 data tracing: $1",
+                                       magic_enum::enum_name(protocol), s.msg());
+        return;
+      }
+      shed_protocols_.push_back(protocol);
+      LOG(WARNING) << absl::Substitute(
+          "Sustained perf buffer loss ($0 events in the last window); shedding $1 data tracing. "
+          "Conn stats tracing is unaffected.",
+          loss_delta, magic_enum::enum_name(protocol));
+      return;
+    }
+    return;
+  }
+
+  if (!shed_protocols_.empty() && shed_windows_without_loss_ >=
+                                      static_cast<int>(FLAGS_stirling_socket_tracer_recover_windows)) {
+    shed_windows_without_loss_ = 0;
+    traffic_protocol_t protocol = shed_protocols_.back();
+    Status s = UpdateBPFProtocolTraceRole(protocol, ConfiguredProtocolRoleMask(protocol));
+    if (!s.ok()) {
+      LOG(ERROR) << absl::Substitute("Failed to restore $0 data tracing: $1",
+                                     magic_enum::enum_name(protocol), s.msg());
+      return;
+    }
+    shed_protocols_.pop_back();
+    LOG(INFO) << absl::Substitute("Perf buffer loss subsided; restoring $0 data tracing.",
+                                  magic_enum::enum_name(protocol));
+  }
+}
+
 Status SocketTraceConnector::TestOnlySetTargetPID() {
   int64_t pid = FLAGS_test_only_socket_trace_target_pid;
   if (pid != kTraceAllTGIDs) {
@@ -829,6 +1125,175 @@ Status SocketTraceConnector::DisableSelfTracing() {
   return control_map->SetValues(kStirlingTGIDIndex, self_pid);
 }
 
+namespace {
+
+// Converts a CIDR string into a BPF filter entry.
+// IPv4 prefixes are stored in IPv4-mapped IPv6 form, matching the BPF-side comparison.
+StatusOr<filter_cidr_t> CIDRFilterEntry(std::string_view cidr_str, filter_action_t action) {
+  CIDRBlock cidr;
+  PX_RETURN_IF_ERROR(ParseCIDRBlock(cidr_str, &cidr));
+  if (cidr.ip_addr.family == InetAddrFamily::kIPv4) {
+    cidr = MapIPv4ToIPv6(cidr);
+  }
+
+  filter_cidr_t entry = {};
+  entry.action = action;
+  entry.enabled = 1;
+  const auto& addr6 = std::get<struct in6_addr>(cidr.ip_addr.addr);
+  static_assert(sizeof(entry.prefix) == sizeof(addr6));
+  memcpy(entry.prefix, &addr6, sizeof(entry.prefix));
+
+  // Build the netmask word-by-word, in network byte order.
+  size_t bits_remaining = cidr.prefix_length;
+  for (int i = 0; i < 4; ++i) {
+    const size_t word_bits = std::min<size_t>(bits_remaining, 32);
+    const uint32_t mask = (word_bits == 0) ? 0 : htonl(~uint32_t{0} << (32 - word_bits));
+    entry.mask[i] = mask;
+    entry.prefix[i] &= mask;
+    bits_remaining -= word_bits;
+  }
+  return entry;
+}
+
+StatusOr<uint16_t> ParseFilterPort(std::string_view port_str) {
+  uint32_t port = 0;
+  if (!absl::SimpleAtoi(port_str, &port) || port == 0 || port > 65535) {
+    return error::InvalidArgument("Invalid port in endpoint filter specification: '$0'.", port_str);
+  }
+  return static_cast<uint16_t>(port);
+}
+
+// Parses a protocol name like "http" or "mysql" (case-insensitive) into a traffic_protocol_t.
+StatusOr<traffic_protocol_t> ParseProtocolName(std::string_view name) {
+  for (const auto protocol : magic_enum::enum_values<traffic_protocol_t>()) {
+    std::string_view protocol_name =
+        absl::StripPrefix(magic_enum::enum_name(protocol), "kProtocol");
+    if (protocol != kProtocolUnknown && absl::EqualsIgnoreCase(name, protocol_name)) {
+      return protocol;
+    }
+  }
+  return error::InvalidArgument("Unknown protocol in port hint specification: '$0'.", name);
+}
+
+}  // namespace
+
+Status SocketTraceConnector::ConfigureEndpointFilters() {
+  std::vector<filter_cidr_t> cidr_entries;
+  for (std::string_view cidr_str :
+       absl::StrSplit(FLAGS_stirling_trace_allow_cidrs, ',', absl::SkipEmpty())) {
+    PX_ASSIGN_OR_RETURN(filter_cidr_t entry, CIDRFilterEntry(cidr_str, kFilterActionAllow));
+    cidr_entries.push_back(entry);
+  }
+  const bool has_allow_cidrs = !cidr_entries.empty();
+  for (std::string_view cidr_str :
+       absl::StrSplit(FLAGS_stirling_trace_deny_cidrs, ',', absl::SkipEmpty())) {
+    PX_ASSIGN_OR_RETURN(filter_cidr_t entry, CIDRFilterEntry(cidr_str, kFilterActionDeny));
+    cidr_entries.push_back(entry);
+  }
+  if (cidr_entries.size() > MAX_FILTER_CIDRS) {
+    return error::InvalidArgument("Too many CIDR filters specified: $0 (max $1).",
+                                  cidr_entries.size(), MAX_FILTER_CIDRS);
+  }
+
+  std::vector<std::pair<uint16_t, uint64_t>> port_entries;
+  for (std::string_view port_str :
+       absl::StrSplit(FLAGS_stirling_trace_allow_ports, ',', absl::SkipEmpty())) {
+    PX_ASSIGN_OR_RETURN(uint16_t port, ParseFilterPort(port_str));
+    port_entries.emplace_back(port, kFilterActionAllow);
+  }
+  const bool has_allow_ports = !port_entries.empty();
+  for (std::string_view port_str :
+       absl::StrSplit(FLAGS_stirling_trace_deny_ports, ',', absl::SkipEmpty())) {
+    PX_ASSIGN_OR_RETURN(uint16_t port, ParseFilterPort(port_str));
+    // A deny entry overrides an allow entry for the same port, since it is inserted later.
+    port_entries.emplace_back(port, kFilterActionDeny);
+  }
+
+  if (cidr_entries.empty() && port_entries.empty()) {
+    // No filters configured; leave the maps empty so that BPF allows everything.
+    return Status::OK();
+  }
+
+  auto cidr_map = WrappedBCCArrayTable<filter_cidr_t>::Create(bcc_.get(), "filter_cidr_map");
+  for (size_t i = 0; i < cidr_entries.size(); ++i) {
+    PX_RETURN_IF_ERROR(cidr_map->SetValue(i, cidr_entries[i]));
+  }
+
+  auto port_map = WrappedBCCMap<uint16_t, uint64_t>::Create(bcc_.get(), "filter_port_map");
+  for (const auto& [port, action] : port_entries) {
+    PX_RETURN_IF_ERROR(port_map->SetValue(port, action));
+  }
+
+  auto control_map =
+      WrappedBCCPerCPUArrayTable<int64_t>::Create(bcc_.get(), kControlValuesArrayName);
+  PX_RETURN_IF_ERROR(control_map->SetValues(kCIDRFilterDefaultDenyIndex, has_allow_cidrs ? 1 : 0));
+  PX_RETURN_IF_ERROR(control_map->SetValues(kPortFilterDefaultDenyIndex, has_allow_ports ? 1 : 0));
+
+  LOG(INFO) << absl::Substitute(
+      "Kernel-side endpoint filters installed: $0 CIDR entries, $1 port entries.",
+      cidr_entries.size(), port_entries.size());
+  return Status::OK();
+}
+
+Status SocketTraceConnector::ConfigureProtocolHints() {
+  protocol_hint_port_map_ =
+      WrappedBCCMap<uint16_t, uint64_t>::Create(bcc_.get(), "protocol_hint_port_map");
+
+  for (std::string_view entry :
+       absl::StrSplit(FLAGS_stirling_protocol_inference_port_hints, ',', absl::SkipEmpty())) {
+    std::pair<std::string_view, std::string_view> kv =
+        absl::StrSplit(entry, absl::MaxSplits('=', 1));
+    PX_ASSIGN_OR_RETURN(uint16_t port, ParseFilterPort(kv.first));
+    PX_ASSIGN_OR_RETURN(traffic_protocol_t protocol, ParseProtocolName(kv.second));
+    PX_RETURN_IF_ERROR(InstallProtocolHint(port, protocol));
+  }
+
+  if (!installed_protocol_hints_.empty()) {
+    LOG(INFO) << absl::Substitute("Kernel-side protocol hints seeded: $0 port entries.",
+                                  installed_protocol_hints_.size());
+  }
+  return Status::OK();
+}
+
+Status SocketTraceConnector::InstallProtocolHint(uint16_t port, traffic_protocol_t protocol) {
+  if (installed_protocol_hints_.size() >= MAX_PROTOCOL_HINT_PORTS) {
+    return error::ResourceUnavailable("Protocol hint map is full ($0 entries).",
+                                      installed_protocol_hints_.size());
+  }
+  // The first hint for a port wins, so conflicting observations don't cause flapping.
+  auto [it, inserted] = installed_protocol_hints_.try_emplace(port, protocol);
+  if (!inserted) {
+    return Status::OK();
+  }
+  return protocol_hint_port_map_->SetValue(port, static_cast<uint64_t>(protocol));
+}
+
+void SocketTraceConnector::RecordProtocolHint(const ConnTracker& conn_tracker) {
+  if (protocol_hint_port_map_ == nullptr) {
+    return;
+  }
+  // Only client-side trackers contribute: their remote port is the server's listening port,
+  // whereas a server-side tracker's remote port is an ephemeral client port. HTTP2 is excluded
+  // since it is traced via uprobes rather than protocol inference.
+  const traffic_protocol_t protocol = conn_tracker.protocol();
+  if (conn_tracker.role() != kRoleClient || protocol == kProtocolUnknown ||
+      protocol == kProtocolHTTP2) {
+    return;
+  }
+  const int port = conn_tracker.remote_endpoint().port();
+  if (port <= 0 || port > 65535) {
+    return;
+  }
+  if (installed_protocol_hints_.size() >= MAX_PROTOCOL_HINT_PORTS ||
+      installed_protocol_hints_.contains(static_cast<uint16_t>(port))) {
+    return;
+  }
+  Status s = InstallProtocolHint(static_cast<uint16_t>(port), protocol);
+  if (!s.ok()) {
+    VLOG(1) << absl::Substitute("Failed to install protocol hint for port=$0: $1", port, s.msg());
+  }
+}
+
 //-----------------------------------------------------------------------------
 // Perf Buffer Polling and Callback functions.
 //-----------------------------------------------------------------------------
@@ -1627,7 +2092,8 @@ void SocketTraceConnector::WriteDataEvent(const SocketDataEvent& event) {
 
 template <typename TProtocolTraits>
 void SocketTraceConnector::TransferStream(ConnectorContext* ctx, ConnTracker* tracker,
-                                          DataTable* data_table) {
+                                          DataTable* data_table,
+                                          AppendTaskList* append_tasks) {
   using TFrameType = typename TProtocolTraits::frame_type;
 
   VLOG(3) << absl::StrCat("Connection\n", DebugString<TProtocolTraits>(*tracker, ""));
@@ -1640,10 +2106,18 @@ void SocketTraceConnector::TransferStream(ConnectorContext* ctx, ConnTracker* tr
     // ProcessToRecords() parses raw events and produces messages in format that are expected by
     // table store. But those messages are not cached inside ConnTracker.
     auto records = tracker->ProcessToRecords<TProtocolTraits>();
-    for (auto& record : records) {
-      TProtocolTraits::ConvertTimestamps(
-          &record, [&](uint64_t mono_time) { return ConvertToRealTime(mono_time); });
-      AppendMessage(ctx, *tracker, std::move(record), data_table);
+    if (!records.empty()) {
+      for (auto& record : records) {
+        TProtocolTraits::ConvertTimestamps(
+            &record, [&](uint64_t mono_time) { return ConvertToRealTime(mono_time); });
+      }
+      // This function may run on a worker thread, and DataTable is not thread-safe, so the
+      // appends are staged here and run later on the transfer thread.
+      append_tasks->push_back([ctx, tracker, data_table, records = std::move(records)]() mutable {
+        for (auto& record : records) {
+          AppendMessage(ctx, *tracker, std::move(record), data_table);
+        }
+      });
     }
   }
 
@@ -1652,11 +2126,50 @@ void SocketTraceConnector::TransferStream(ConnectorContext* ctx, ConnTracker* tr
   auto message_expiry_timestamp =
       iteration_time() - std::chrono::seconds(FLAGS_messages_expiry_duration_secs);
 
-  tracker->Cleanup<TProtocolTraits>(FLAGS_messages_size_limit_bytes,
-                                    FLAGS_datastream_buffer_retention_size,
+  // Use the adaptive per-tracker retention limit when the global budget has assigned one;
+  // otherwise fall back to the fixed per-stream flag.
+  const size_t buffer_size_limit = tracker->buffer_retention_limit_bytes() != 0
+                                       ? tracker->buffer_retention_limit_bytes()
+                                       : FLAGS_datastream_buffer_retention_size;
+
+  tracker->Cleanup<TProtocolTraits>(FLAGS_messages_size_limit_bytes, buffer_size_limit,
                                     message_expiry_timestamp, buffer_expiry_timestamp);
 }
 
+// Snapshots the connection byte counters that BPF maintains in conn_info_map, and routes them
+// through the same path as conn_stats perf events. Since BPF aggregates the counters in-kernel,
+// mid-connection activity costs one map scan per conn-stats transfer period instead of a
+// continuous stream of per-connection events. The final counters of a connection are still
+// reported by the close-time conn_stats event, because the map entry is deleted on close.
+void SocketTraceConnector::SnapshotConnStats() {
+  if (conn_info_map_mgr_ == nullptr) {
+    return;
+  }
+
+  // Use the same clock basis as BPF event timestamps, so that the snapshot orders correctly
+  // against the close-time conn_stats events.
+  const uint64_t timestamp_ns = CurrentSteadyTimeNS();
+
+  for (const auto& [tgid_fd, conn_info] : conn_info_map_mgr_->GetConnInfoEntries()) {
+    PX_UNUSED(tgid_fd);
+
+    // Connections without any traffic have nothing to report. Skipping them also avoids
+    // creating trackers for connections that only ever appear in conn_info_map.
+    if (conn_info.wr_bytes == 0 && conn_info.rd_bytes == 0) {
+      continue;
+    }
+
+    conn_stats_event_t event = {};
+    event.timestamp_ns = timestamp_ns;
+    event.conn_id = conn_info.conn_id;
+    event.addr = conn_info.addr;
+    event.role = conn_info.role;
+    event.wr_bytes = conn_info.wr_bytes;
+    event.rd_bytes = conn_info.rd_bytes;
+    AcceptConnStatsEvent(event);
+  }
+}
+
 void SocketTraceConnector::TransferConnStats(ConnectorContext* ctx, DataTable* data_table) {
   namespace idx = ::px::stirling::conn_stats_idx;
 
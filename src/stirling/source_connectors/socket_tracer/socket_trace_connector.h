@@ -74,6 +74,7 @@ DECLARE_uint32(messages_expiry_duration_secs);
 DECLARE_uint32(messages_size_limit_bytes);
 DECLARE_uint32(datastream_buffer_expiry_duration_secs);
 DECLARE_uint32(datastream_buffer_retention_size);
+DECLARE_uint64(datastream_buffer_global_retention_budget_bytes);
 
 DECLARE_uint64(max_body_bytes);
 
@@ -121,6 +122,11 @@ class SocketTraceConnector : public BCCSourceConnector {
   void InitContextImpl(ConnectorContext* ctx) override;
   void TransferDataImpl(ConnectorContext* ctx) override;
 
+  // In addition to recording the tables, disables tracing of any protocol whose output table
+  // is not subscribed (nullptr entry), so that neither BPF-side event submission nor userspace
+  // parsing spends cycles on traffic that no table will ever consume.
+  void set_data_tables(std::vector<DataTable*> data_tables) override;
+
   void CheckTracerState();
 
   // Perform actions that are not specifically targeting a table.
@@ -137,11 +143,38 @@ class SocketTraceConnector : public BCCSourceConnector {
   // data from inside BPF to user-space.
   Status UpdateBPFProtocolTraceRole(traffic_protocol_t protocol, uint64_t role_mask);
 
+  // Returns the BPF trace role mask derived from the protocol's configured trace_roles.
+  uint64_t ConfiguredProtocolRoleMask(traffic_protocol_t protocol);
+
+  // Monitors perf buffer event loss and sheds BPF-side load under sustained loss.
+  // Data tracing is disabled one protocol at a time following kLoadSheddingOrder (least valuable
+  // first), and re-enabled in reverse order once the loss subsides. Conn stats events bypass the
+  // protocol trace roles, so connection-level visibility survives even when body tracing is shed.
+  void ManageOverloadShedding();
+
   // Instructs Stirling to log detailed debug information about the traced events from the PID
   // specified by --test_only_socket_trace_target_pid.
   Status TestOnlySetTargetPID();
   Status DisableSelfTracing();
 
+  // Installs the allow/deny CIDR and port filters specified by the --stirling_trace_{allow,deny}_*
+  // flags into the BPF filter maps, so that uninteresting traffic (e.g. loopback or node-local
+  // connections) is dropped inside the kernel, before it ever crosses a perf buffer.
+  Status ConfigureEndpointFilters();
+
+  // Creates the handle to the kernel-side protocol hint map and seeds it from
+  // --stirling_protocol_inference_port_hints. Connections to a hinted port try the hinted
+  // protocol's matcher in BPF before the full inference chain.
+  Status ConfigureProtocolHints();
+
+  // Installs a single port->protocol hint, recording it in installed_protocol_hints_ so that a
+  // port is only ever written once.
+  Status InstallProtocolHint(uint16_t port, traffic_protocol_t protocol);
+
+  // Feeds a tracker's observed classification back into the kernel-side protocol hint map, so
+  // that future connections to the same server port skip the full inference chain.
+  void RecordProtocolHint(const ConnTracker& conn_tracker);
+
   void DisablePIDTrace(int pid) override {
     SourceConnector::DisablePIDTrace(pid);
     pids_to_trace_disable_.insert(pid);
@@ -206,8 +239,14 @@ class SocketTraceConnector : public BCCSourceConnector {
       bool outgoing,
       /* OUT */ struct go_grpc_http2_header_event_t* header_event_data_go_style);
 
+  // Staged writes to the shared DataTables. TransferStream() can run on a worker thread, so it
+  // stages its DataTable appends as tasks, which are then run serially on the transfer thread.
+  using AppendTaskList = std::vector<std::function<void()>>;
+
   template <typename TProtocolTraits>
-  void TransferStream(ConnectorContext* ctx, ConnTracker* tracker, DataTable* data_table);
+  void TransferStream(ConnectorContext* ctx, ConnTracker* tracker, DataTable* data_table,
+                      AppendTaskList* append_tasks);
+  void SnapshotConnStats();
   void TransferConnStats(ConnectorContext* ctx, DataTable* data_table);
 
   void set_iteration_time(std::chrono::time_point<std::chrono::steady_clock> time) {
@@ -237,6 +276,11 @@ class SocketTraceConnector : public BCCSourceConnector {
   std::unique_ptr<WrappedBCCArrayTable<int>> openssl_trace_state_;
   std::unique_ptr<WrappedBCCMap<uint32_t, struct openssl_trace_state_debug_t>>
       openssl_trace_state_debug_;
+  // Kernel-side protocol hints (port -> traffic_protocol_t), plus a user-space mirror of the
+  // installed entries so each port is written at most once.
+  std::unique_ptr<WrappedBCCMap<uint16_t, uint64_t>> protocol_hint_port_map_;
+  absl::flat_hash_map<uint16_t, traffic_protocol_t> installed_protocol_hints_;
+
   prometheus::Family<prometheus::Counter>& openssl_trace_mismatched_fds_counter_family_;
   prometheus::Family<prometheus::Counter>& openssl_trace_tls_source_counter_family_;
 
@@ -250,7 +294,8 @@ class SocketTraceConnector : public BCCSourceConnector {
     int32_t trace_mode = TraceMode::Off;
     uint32_t table_num = 0;
     std::vector<endpoint_role_t> trace_roles;
-    std::function<void(SocketTraceConnector&, ConnectorContext*, ConnTracker*, DataTable*)>
+    std::function<void(SocketTraceConnector&, ConnectorContext*, ConnTracker*, DataTable*,
+                       AppendTaskList*)>
         transfer_fn = nullptr;
     bool enabled = false;
   };
@@ -267,6 +312,16 @@ class SocketTraceConnector : public BCCSourceConnector {
   // The transfer_fn defines which function is called to process the data for transfer.
   std::vector<TransferSpec> protocol_transfer_specs_;
 
+  // State for ManageOverloadShedding().
+  //
+  // Value of the data loss counters at the last check, used to compute per-window deltas.
+  int64_t shed_prev_loss_count_ = 0;
+  // Consecutive windows with loss above the threshold / with zero loss, respectively.
+  int shed_windows_with_loss_ = 0;
+  int shed_windows_without_loss_ = 0;
+  // Protocols whose data tracing is currently shed, in the order they were shed.
+  std::vector<traffic_protocol_t> shed_protocols_;
+
   // The time at which TransferDataImpl() begin. Used as a universal timestamp for the iteration,
   // to avoid too many calls to std::chrono::steady_clock::now().
   std::chrono::time_point<std::chrono::steady_clock> iteration_time_;
@@ -290,6 +345,10 @@ class SocketTraceConnector : public BCCSourceConnector {
 
   std::unique_ptr<system::ProcParser> proc_parser_;
 
+  // Per-cycle cache of /proc FD links, shared by the FDResolvers of all trackers.
+  // Invalidated at the start of every TransferData() iteration.
+  std::unique_ptr<FDLinkCache> fd_link_cache_;
+
   std::shared_ptr<ConnInfoMapManager> conn_info_map_mgr_;
 
   UProbeManager uprobe_mgr_;
@@ -26,8 +26,12 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
 #include <map>
+#include <thread>
 #include <tuple>
 
 #include "src/common/base/base.h"
@@ -38,6 +42,7 @@
 #include "src/stirling/bpf_tools/macros.h"
 #include "src/stirling/obj_tools/dwarf_reader.h"
 #include "src/stirling/obj_tools/go_syms.h"
+#include "src/stirling/obj_tools/reader_registry.h"
 #include "src/stirling/source_connectors/socket_tracer/bcc_bpf_intf/symaddrs.h"
 #include "src/stirling/utils/linux_headers.h"
 #include "src/stirling/utils/proc_path_tools.h"
@@ -51,12 +56,24 @@ DEFINE_bool(stirling_enable_grpc_c_tracing,
 DEFINE_double(stirling_rescan_exp_backoff_factor, 2.0,
               "Exponential backoff factor used in decided how often to rescan binaries for "
               "dynamically loaded libraries");
+DEFINE_uint32(stirling_uprobe_scan_threads,
+              gflags::Uint32FromEnv("PX_STIRLING_UPROBE_SCAN_THREADS", 4),
+              "Number of worker threads used to scan new Go binaries (ELF/DWARF analysis) for "
+              "uprobe deployment. Scanning is the expensive part of deployment; BPF map updates "
+              "and probe attachment remain on the deployment thread.");
+DEFINE_string(stirling_uprobe_symaddrs_cache_path,
+              gflags::StringFromEnv("PX_STIRLING_UPROBE_SYMADDRS_CACHE_PATH", ""),
+              "If set, path of a file in which Go symbol address scan results are persisted, "
+              "keyed by binary build-id. On restart, binaries whose build-id is in the cache "
+              "skip the expensive DWARF read. Point this at persistent storage (e.g. a hostPath "
+              "mount) for it to survive restarts.");
 
 namespace px {
 namespace stirling {
 
 using ::px::stirling::obj_tools::DwarfReader;
 using ::px::stirling::obj_tools::ElfReader;
+using ::px::stirling::obj_tools::ReaderRegistry;
 using ::px::stirling::utils::GetKernelVersion;
 using ::px::stirling::utils::KernelVersion;
 using ::px::stirling::utils::KernelVersionOrder;
@@ -81,6 +98,8 @@ void UProbeManager::Init(bool disable_go_tls_tracing, bool enable_http2_tracing,
   node_tlswrap_symaddrs_map_ =
       MapT<struct node_tlswrap_symaddrs_t>::Create(bcc_, "node_tlswrap_symaddrs_map");
   grpc_c_versions_map_ = MapT<uint64_t>::Create(bcc_, "grpc_c_versions");
+
+  LoadGoSymAddrsCache();
 }
 
 void UProbeManager::NotifyMMapEvent(upid_t upid) {
@@ -97,6 +116,14 @@ Status UProbeManager::LogAndAttachUProbe(const bpf_tools::UProbeSpec& spec) {
   return s;
 }
 
+Status UProbeManager::LogAndAttachUProbes(std::vector<bpf_tools::UProbeSpec> specs) {
+  specs = bpf_tools::BatchResolveUProbeSymbols(std::move(specs));
+  for (const auto& spec : specs) {
+    PX_RETURN_IF_ERROR(LogAndAttachUProbe(spec));
+  }
+  return Status::OK();
+}
+
 StatusOr<int> UProbeManager::AttachUProbeTmpl(const ArrayView<UProbeTmpl>& probe_tmpls,
                                               const std::string& binary,
                                               obj_tools::ElfReader* elf_reader) {
@@ -164,36 +191,175 @@ Status UProbeManager::UpdateOpenSSLSymAddrs(obj_tools::RawFptrManager* fptr_mana
   return Status::OK();
 }
 
-Status UProbeManager::UpdateGoCommonSymAddrs(ElfReader* elf_reader, DwarfReader* dwarf_reader,
-                                             const std::vector<int32_t>& pids) {
-  PX_ASSIGN_OR_RETURN(struct go_common_symaddrs_t symaddrs,
-                      GoCommonSymAddrs(elf_reader, dwarf_reader));
+namespace {
+
+// On-disk format of the persistent symaddrs cache (--stirling_uprobe_symaddrs_cache_path).
+// A versioned header followed by variable-length records, one per binary.
+// The header pins the symaddrs struct sizes and the tracing configuration under which the
+// results were computed; any mismatch invalidates the whole file, which is then rewritten.
+constexpr char kSymAddrsCacheMagic[4] = {'P', 'X', 'S', 'A'};
+constexpr uint32_t kSymAddrsCacheVersion = 1;
+
+struct SymAddrsCacheHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t common_size;
+  uint32_t tls_size;
+  uint32_t http2_size;
+  uint8_t disable_go_tls_tracing;
+  uint8_t enable_http2_tracing;
+};
 
-  for (auto& pid : pids) {
-    PX_RETURN_IF_ERROR(go_common_symaddrs_map_->SetValue(pid, symaddrs));
+}  // namespace
+
+void UProbeManager::LoadGoSymAddrsCache() {
+  const std::string& path = FLAGS_stirling_uprobe_symaddrs_cache_path;
+  if (path.empty()) {
+    return;
   }
 
-  return Status::OK();
-}
+  std::ifstream f(path, std::ios::binary);
+  if (!f) {
+    VLOG(1) << absl::Substitute("No uprobe symaddrs cache found at $0", path);
+    return;
+  }
 
-Status UProbeManager::UpdateGoHTTP2SymAddrs(ElfReader* elf_reader, DwarfReader* dwarf_reader,
-                                            const std::vector<int32_t>& pids) {
-  PX_ASSIGN_OR_RETURN(struct go_http2_symaddrs_t symaddrs,
-                      GoHTTP2SymAddrs(elf_reader, dwarf_reader));
+  SymAddrsCacheHeader header = {};
+  f.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!f || memcmp(header.magic, kSymAddrsCacheMagic, sizeof(kSymAddrsCacheMagic)) != 0 ||
+      header.version != kSymAddrsCacheVersion ||
+      header.common_size != sizeof(struct go_common_symaddrs_t) ||
+      header.tls_size != sizeof(struct go_tls_symaddrs_t) ||
+      header.http2_size != sizeof(struct go_http2_symaddrs_t) ||
+      header.disable_go_tls_tracing != static_cast<uint8_t>(cfg_disable_go_tls_tracing_) ||
+      header.enable_http2_tracing != static_cast<uint8_t>(cfg_enable_http2_tracing_)) {
+    LOG(WARNING) << absl::Substitute(
+        "Ignoring uprobe symaddrs cache at $0: incompatible version, struct layout or tracing "
+        "configuration.",
+        path);
+    return;
+  }
 
-  for (auto& pid : pids) {
-    PX_RETURN_IF_ERROR(go_http2_symaddrs_map_->SetValue(pid, symaddrs));
+  while (true) {
+    uint32_t build_id_len = 0;
+    f.read(reinterpret_cast<char*>(&build_id_len), sizeof(build_id_len));
+    if (f.eof()) {
+      break;
+    }
+
+    // Build-ids are short hex strings; anything oversized indicates a corrupt file.
+    constexpr uint32_t kMaxBuildIDLen = 256;
+    if (!f || build_id_len == 0 || build_id_len > kMaxBuildIDLen) {
+      LOG(WARNING) << absl::Substitute("Ignoring corrupt uprobe symaddrs cache at $0", path);
+      persistent_symaddrs_cache_.clear();
+      return;
+    }
+
+    std::string build_id(build_id_len, '\0');
+    f.read(build_id.data(), build_id_len);
+
+    uint8_t has_tls = 0;
+    uint8_t has_http2 = 0;
+    GoSymAddrs symaddrs;
+    f.read(reinterpret_cast<char*>(&has_tls), sizeof(has_tls));
+    f.read(reinterpret_cast<char*>(&has_http2), sizeof(has_http2));
+    f.read(reinterpret_cast<char*>(&symaddrs.common), sizeof(symaddrs.common));
+    if (has_tls != 0) {
+      struct go_tls_symaddrs_t tls = {};
+      f.read(reinterpret_cast<char*>(&tls), sizeof(tls));
+      symaddrs.tls = tls;
+    }
+    if (has_http2 != 0) {
+      struct go_http2_symaddrs_t http2 = {};
+      f.read(reinterpret_cast<char*>(&http2), sizeof(http2));
+      symaddrs.http2 = http2;
+    }
+
+    if (!f) {
+      LOG(WARNING) << absl::Substitute("Ignoring corrupt uprobe symaddrs cache at $0", path);
+      persistent_symaddrs_cache_.clear();
+      return;
+    }
+
+    persistent_symaddrs_cache_.insert_or_assign(std::move(build_id), std::move(symaddrs));
   }
 
-  return Status::OK();
+  LOG(INFO) << absl::Substitute("Loaded $0 uprobe symaddrs cache entries from $1",
+                                persistent_symaddrs_cache_.size(), path);
 }
 
-Status UProbeManager::UpdateGoTLSSymAddrs(ElfReader* elf_reader, DwarfReader* dwarf_reader,
-                                          const std::vector<int32_t>& pids) {
-  PX_ASSIGN_OR_RETURN(struct go_tls_symaddrs_t symaddrs, GoTLSSymAddrs(elf_reader, dwarf_reader));
+void UProbeManager::SaveGoSymAddrsCache() const {
+  const std::string& path = FLAGS_stirling_uprobe_symaddrs_cache_path;
+  if (path.empty()) {
+    return;
+  }
+
+  // Write to a temporary file and rename into place, so a crash mid-write cannot leave a
+  // truncated cache behind.
+  const std::string tmp_path = absl::StrCat(path, ".tmp");
+  {
+    std::ofstream f(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!f) {
+      LOG(WARNING) << absl::Substitute("Could not write uprobe symaddrs cache to $0", tmp_path);
+      return;
+    }
+
+    SymAddrsCacheHeader header = {};
+    memcpy(header.magic, kSymAddrsCacheMagic, sizeof(header.magic));
+    header.version = kSymAddrsCacheVersion;
+    header.common_size = sizeof(struct go_common_symaddrs_t);
+    header.tls_size = sizeof(struct go_tls_symaddrs_t);
+    header.http2_size = sizeof(struct go_http2_symaddrs_t);
+    header.disable_go_tls_tracing = cfg_disable_go_tls_tracing_;
+    header.enable_http2_tracing = cfg_enable_http2_tracing_;
+    f.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const auto& [build_id, symaddrs] : persistent_symaddrs_cache_) {
+      const uint32_t build_id_len = build_id.size();
+      const uint8_t has_tls = symaddrs.tls.has_value();
+      const uint8_t has_http2 = symaddrs.http2.has_value();
+      f.write(reinterpret_cast<const char*>(&build_id_len), sizeof(build_id_len));
+      f.write(build_id.data(), build_id.size());
+      f.write(reinterpret_cast<const char*>(&has_tls), sizeof(has_tls));
+      f.write(reinterpret_cast<const char*>(&has_http2), sizeof(has_http2));
+      f.write(reinterpret_cast<const char*>(&symaddrs.common), sizeof(symaddrs.common));
+      if (has_tls != 0) {
+        f.write(reinterpret_cast<const char*>(&symaddrs.tls.value()), sizeof(symaddrs.tls.value()));
+      }
+      if (has_http2 != 0) {
+        f.write(reinterpret_cast<const char*>(&symaddrs.http2.value()),
+                sizeof(symaddrs.http2.value()));
+      }
+    }
+
+    if (!f) {
+      LOG(WARNING) << absl::Substitute("Could not write uprobe symaddrs cache to $0", tmp_path);
+      return;
+    }
+  }
 
+  std::error_code ec;
+  std::filesystem::rename(tmp_path, path, ec);
+  if (ec) {
+    LOG(WARNING) << absl::Substitute("Could not move uprobe symaddrs cache into place at $0: $1",
+                                     path, ec.message());
+    return;
+  }
+
+  VLOG(1) << absl::Substitute("Saved $0 uprobe symaddrs cache entries to $1",
+                              persistent_symaddrs_cache_.size(), path);
+}
+
+Status UProbeManager::PopulateGoSymAddrs(const GoSymAddrs& symaddrs,
+                                         const std::vector<int32_t>& pids) {
   for (auto& pid : pids) {
-    PX_RETURN_IF_ERROR(go_tls_symaddrs_map_->SetValue(pid, symaddrs));
+    PX_RETURN_IF_ERROR(go_common_symaddrs_map_->SetValue(pid, symaddrs.common));
+    if (symaddrs.tls.has_value()) {
+      PX_RETURN_IF_ERROR(go_tls_symaddrs_map_->SetValue(pid, symaddrs.tls.value()));
+    }
+    if (symaddrs.http2.has_value()) {
+      PX_RETURN_IF_ERROR(go_http2_symaddrs_map_->SetValue(pid, symaddrs.http2.value()));
+    }
   }
 
   return Status::OK();
@@ -410,13 +576,14 @@ StatusOr<int> UProbeManager::AttachOpenSSLUProbesOnDynamicLib(uint32_t pid) {
     // terminated, so if attachment fails it will be deleted prior to the pid being
     // reused.
     PX_UNUSED(openssl_source_map_->SetValue(pid, ssl_source));
+    std::vector<bpf_tools::UProbeSpec> specs;
     for (auto spec : kOpenSSLUProbes) {
       spec.binary_path = container_libssl.string();
       spec.probe_fn =
           ProbeFuncForSocketAccessMethod(spec.probe_fn, ssl_library_match.socket_fd_access);
-
-      PX_RETURN_IF_ERROR(LogAndAttachUProbe(spec));
+      specs.push_back(std::move(spec));
     }
+    PX_RETURN_IF_ERROR(LogAndAttachUProbes(std::move(specs)));
   }
   return kOpenSSLUProbes.size();
 }
@@ -455,7 +622,8 @@ StatusOr<int> UProbeManager::AttachOpenSSLUProbesOnStaticBinary(const uint32_t p
   PX_ASSIGN_OR_RETURN(const std::filesystem::path proc_exe, proc_parser_->GetExePath(pid));
   const auto host_proc_exe = ProcPidRootPath(pid, proc_exe);
 
-  PX_ASSIGN_OR_RETURN(auto elf_reader, ElfReader::Create(host_proc_exe));
+  PX_ASSIGN_OR_RETURN(auto elf_reader,
+                      ReaderRegistry::GetInstance()->GetElfReader(host_proc_exe.string()));
   auto statusor = elf_reader->SearchTheOnlySymbol("SSL_write");
 
   if (error::IsNotFound(statusor.status())) {
@@ -463,11 +631,13 @@ StatusOr<int> UProbeManager::AttachOpenSSLUProbesOnStaticBinary(const uint32_t p
   }
   PX_RETURN_IF_ERROR(statusor);
 
+  std::vector<bpf_tools::UProbeSpec> specs;
   for (auto spec : kOpenSSLUProbes) {
     spec.binary_path = host_proc_exe.string();
     spec.probe_fn = absl::StrCat(spec.probe_fn, "_syscall_fd_access");
-    PX_RETURN_IF_ERROR(LogAndAttachUProbe(spec));
+    specs.push_back(std::move(spec));
   }
+  PX_RETURN_IF_ERROR(LogAndAttachUProbes(std::move(specs)));
   return kOpenSSLUProbes.size();
 }
 
@@ -497,33 +667,24 @@ StatusOr<int> UProbeManager::AttachNodeJsOpenSSLUprobes(const uint32_t pid) {
 
   // These probes are attached on OpenSSL dynamic library (if present) as well.
   // Here they are attached on statically linked OpenSSL library (eg. for node).
+  std::vector<bpf_tools::UProbeSpec> specs;
   for (auto spec : kOpenSSLUProbes) {
     spec.binary_path = host_proc_exe.string();
-    PX_RETURN_IF_ERROR(LogAndAttachUProbe(spec));
+    specs.push_back(std::move(spec));
   }
+  PX_RETURN_IF_ERROR(LogAndAttachUProbes(std::move(specs)));
 
   // These are node-specific probes.
   PX_ASSIGN_OR_RETURN(auto uprobe_tmpls, GetNodeOpensslUProbeTmpls(ver));
-  PX_ASSIGN_OR_RETURN(auto elf_reader, ElfReader::Create(host_proc_exe));
+  PX_ASSIGN_OR_RETURN(auto elf_reader,
+                      ReaderRegistry::GetInstance()->GetElfReader(host_proc_exe.string()));
   PX_ASSIGN_OR_RETURN(int count, AttachUProbeTmpl(uprobe_tmpls, host_proc_exe, elf_reader.get()));
 
   return kOpenSSLUProbes.size() + count;
 }
 
 StatusOr<int> UProbeManager::AttachGoTLSUProbes(const std::string& binary,
-                                                obj_tools::ElfReader* elf_reader,
-                                                obj_tools::DwarfReader* dwarf_reader,
-                                                const std::vector<int32_t>& pids) {
-  // Step 1: Update BPF symbols_map on all new PIDs.
-  Status s = UpdateGoTLSSymAddrs(elf_reader, dwarf_reader, pids);
-  if (!s.ok()) {
-    // Doesn't appear to be a binary with the mandatory symbols.
-    // Might not even be a golang binary.
-    // Either way, not of interest to probe.
-    return 0;
-  }
-
-  // Step 2: Deploy uprobes on all new binaries.
+                                                obj_tools::ElfReader* elf_reader) {
   auto result = go_tls_probed_binaries_.insert(binary);
   if (!result.second) {
     // This is not a new binary, so nothing more to do.
@@ -533,16 +694,7 @@ StatusOr<int> UProbeManager::AttachGoTLSUProbes(const std::string& binary,
 }
 
 StatusOr<int> UProbeManager::AttachGoHTTP2UProbes(const std::string& binary,
-                                                  obj_tools::ElfReader* elf_reader,
-                                                  obj_tools::DwarfReader* dwarf_reader,
-                                                  const std::vector<int32_t>& pids) {
-  // Step 1: Update BPF symaddrs for this binary.
-  Status s = UpdateGoHTTP2SymAddrs(elf_reader, dwarf_reader, pids);
-  if (!s.ok()) {
-    return 0;
-  }
-
-  // Step 2: Deploy uprobes on all new binaries.
+                                                  obj_tools::ElfReader* elf_reader) {
   auto result = go_http2_probed_binaries_.insert(binary);
   if (!result.second) {
     // This is not a new binary, so nothing more to do.
@@ -577,6 +729,18 @@ std::map<std::string, std::vector<int32_t>> ConvertPIDsListToMap(
   return pids;
 }
 
+// Identity key for a binary, independent of which process's /proc mount it was resolved through.
+// Container images deployed across many pods on a node share the underlying image-layer files
+// (e.g. via overlayfs), so device:inode dedupes identical binaries even when their
+// /proc/<pid>/root paths differ. Falls back to the path itself if stat() fails.
+std::string BinaryKey(const std::string& path) {
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0) {
+    return path;
+  }
+  return absl::Substitute("$0:$1", st.st_dev, st.st_ino);
+}
+
 }  // namespace
 
 std::thread UProbeManager::RunDeployUProbesThread(const absl::flat_hash_set<md::UPID>& upids) {
@@ -817,17 +981,90 @@ int UProbeManager::DeployGrpcCUProbes(const absl::flat_hash_set<md::UPID>& pids)
   return uprobe_count;
 }
 
+void UProbeManager::ScanGoBinary(GoBinaryScanTask* task) const {
+  // Read binary's symbols.
+  StatusOr<std::shared_ptr<ElfReader>> elf_reader_status =
+      ReaderRegistry::GetInstance()->GetElfReader(task->binary);
+  if (!elf_reader_status.ok()) {
+    LOG(WARNING) << absl::Substitute(
+        "Cannot analyze binary $0 for uprobe deployment. "
+        "If file is under /var/lib, container may have terminated. "
+        "Message = $1",
+        task->binary, elf_reader_status.msg());
+    return;
+  }
+  std::shared_ptr<ElfReader> elf_reader = elf_reader_status.ConsumeValueOrDie();
+
+  // Avoid going past this point if not a golang program.
+  // The DwarfReader is memory intensive, and the remaining probes are Golang specific.
+  if (!IsGoExecutable(elf_reader.get())) {
+    return;
+  }
+
+  task->build_id = elf_reader->BuildID().ConsumeValueOr("");
+
+  // If this binary was scanned in a previous run, skip the DWARF read and reuse its results.
+  if (!task->build_id.empty()) {
+    auto iter = persistent_symaddrs_cache_.find(task->build_id);
+    if (iter != persistent_symaddrs_cache_.end()) {
+      VLOG(1) << absl::Substitute("Binary $0 found in persistent symaddrs cache [build-id=$1]",
+                                  task->binary, task->build_id);
+      task->symaddrs = iter->second;
+      task->elf_reader = std::move(elf_reader);
+      return;
+    }
+  }
+
+  StatusOr<std::shared_ptr<DwarfReader>> dwarf_reader_status =
+      ReaderRegistry::GetInstance()->GetDwarfReader(task->binary);
+  if (!dwarf_reader_status.ok()) {
+    VLOG(1) << absl::Substitute(
+        "Failed to get binary $0 debug symbols. Cannot deploy uprobes. "
+        "Message = $1",
+        task->binary, dwarf_reader_status.msg());
+    return;
+  }
+  std::shared_ptr<DwarfReader> dwarf_reader = dwarf_reader_status.ConsumeValueOrDie();
+
+  GoSymAddrs symaddrs;
+
+  auto common_symaddrs_or = GoCommonSymAddrs(elf_reader.get(), dwarf_reader.get());
+  if (!common_symaddrs_or.ok()) {
+    VLOG(1) << absl::Substitute(
+        "Golang binary $0 does not have the mandatory symbols (e.g. TCPConn).", task->binary);
+    return;
+  }
+  symaddrs.common = common_symaddrs_or.ConsumeValueOrDie();
+
+  if (!cfg_disable_go_tls_tracing_) {
+    auto tls_symaddrs_or = GoTLSSymAddrs(elf_reader.get(), dwarf_reader.get());
+    if (tls_symaddrs_or.ok()) {
+      symaddrs.tls = tls_symaddrs_or.ConsumeValueOrDie();
+    }
+  }
+
+  if (!cfg_disable_go_tls_tracing_ && cfg_enable_http2_tracing_) {
+    auto http2_symaddrs_or = GoHTTP2SymAddrs(elf_reader.get(), dwarf_reader.get());
+    if (http2_symaddrs_or.ok()) {
+      symaddrs.http2 = http2_symaddrs_or.ConsumeValueOrDie();
+    }
+  }
+
+  task->elf_reader = std::move(elf_reader);
+  task->symaddrs = std::move(symaddrs);
+}
+
 int UProbeManager::DeployGoUProbes(const absl::flat_hash_set<md::UPID>& pids) {
   int uprobe_count = 0;
 
   static int32_t kPID = getpid();
 
-  for (const auto& [binary, pid_vec] : ConvertPIDsListToMap(pids)) {
-    // Don't bother rescanning binaries that have been scanned before to avoid unnecessary work.
-    if (!scanned_binaries_.insert(binary).second) {
-      continue;
-    }
-
+  // Phase 1: Gather the set of binaries that need scanning.
+  // Binaries previously scanned (keyed by identity, so identical container images dedupe) skip
+  // straight to updating the per-PID symaddrs BPF maps; the uprobes themselves attach to the
+  // binary file, so they already cover any new processes running it.
+  std::vector<GoBinaryScanTask> scan_tasks;
+  for (auto& [binary, pid_vec] : ConvertPIDsListToMap(pids)) {
     if (cfg_disable_self_probing_) {
       // Don't try to attach uprobes to self.
       // This speeds up stirling_wrapper initialization significantly.
@@ -836,69 +1073,104 @@ int UProbeManager::DeployGoUProbes(const absl::flat_hash_set<md::UPID>& pids) {
       }
     }
 
-    // Read binary's symbols.
-    StatusOr<std::unique_ptr<ElfReader>> elf_reader_status = ElfReader::Create(binary);
-    if (!elf_reader_status.ok()) {
-      LOG(WARNING) << absl::Substitute(
-          "Cannot analyze binary $0 for uprobe deployment. "
-          "If file is under /var/lib, container may have terminated. "
-          "Message = $1",
-          binary, elf_reader_status.msg());
-      continue;
-    }
-    std::unique_ptr<ElfReader> elf_reader = elf_reader_status.ConsumeValueOrDie();
+    std::string binary_key = BinaryKey(binary);
 
-    // Avoid going past this point if not a golang program.
-    // The DwarfReader is memory intensive, and the remaining probes are Golang specific.
-    if (!IsGoExecutable(elf_reader.get())) {
+    auto iter = go_symaddrs_cache_.find(binary_key);
+    if (iter != go_symaddrs_cache_.end()) {
+      if (iter->second.has_value()) {
+        Status s = PopulateGoSymAddrs(iter->second.value(), pid_vec);
+        LOG_IF(WARNING, !s.ok()) << absl::Substitute(
+            "Failed to update Go symaddrs maps for binary $0: $1", binary, s.ToString());
+      }
       continue;
     }
 
-    StatusOr<std::unique_ptr<DwarfReader>> dwarf_reader_status =
-        DwarfReader::CreateIndexingAll(binary);
-    if (!dwarf_reader_status.ok()) {
-      VLOG(1) << absl::Substitute(
-          "Failed to get binary $0 debug symbols. Cannot deploy uprobes. "
-          "Message = $1",
-          binary, dwarf_reader_status.msg());
-      continue;
+    scan_tasks.push_back(GoBinaryScanTask{binary, std::move(binary_key), std::move(pid_vec),
+                                          /* elf_reader */ nullptr, /* symaddrs */ std::nullopt});
+  }
+
+  // Phase 2: Scan the binaries (ELF/DWARF analysis) on a worker pool.
+  // This is the expensive part of deployment: a node-wide rollout can surface hundreds of new
+  // processes at once. Scanning only reads the binary files, so it parallelizes safely.
+  const size_t num_threads =
+      std::min<size_t>(std::max<uint32_t>(1, FLAGS_stirling_uprobe_scan_threads),
+                       scan_tasks.size());
+  if (num_threads <= 1) {
+    for (auto& task : scan_tasks) {
+      ScanGoBinary(&task);
     }
-    std::unique_ptr<DwarfReader> dwarf_reader = dwarf_reader_status.ConsumeValueOrDie();
-    Status s = UpdateGoCommonSymAddrs(elf_reader.get(), dwarf_reader.get(), pid_vec);
-    if (!s.ok()) {
-      VLOG(1) << absl::Substitute(
-          "Golang binary $0 does not have the mandatory symbols (e.g. TCPConn).", binary);
-      continue;
+  } else {
+    std::atomic<size_t> next_task = 0;
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+      workers.emplace_back([this, &scan_tasks, &next_task]() {
+        for (size_t t = next_task.fetch_add(1); t < scan_tasks.size();
+             t = next_task.fetch_add(1)) {
+          ScanGoBinary(&scan_tasks[t]);
+        }
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
     }
+  }
 
-    // GoTLS Probes.
-    if (!cfg_disable_go_tls_tracing_) {
-      VLOG(1) << absl::Substitute("Attempting to attach Go TLS uprobes to binary $0", binary);
-      StatusOr<int> attach_status =
-          AttachGoTLSUProbes(binary, elf_reader.get(), dwarf_reader.get(), pid_vec);
-      if (!attach_status.ok()) {
-        monitor_.AppendSourceStatusRecord("socket_tracer", attach_status.status(),
-                                          "AttachGoTLSUProbes");
-        LOG_FIRST_N(WARNING, 10) << absl::Substitute("Failed to attach GoTLS Uprobes to $0: $1",
-                                                     binary, attach_status.ToString());
-      } else {
-        uprobe_count += attach_status.ValueOrDie();
+  // Phase 3: Update BPF maps and attach uprobes.
+  // BCC is not thread-safe, so this stays on the deployment thread.
+  for (auto& task : scan_tasks) {
+    if (task.symaddrs.has_value()) {
+      Status s = PopulateGoSymAddrs(task.symaddrs.value(), task.pids);
+      if (!s.ok()) {
+        LOG(WARNING) << absl::Substitute("Failed to update Go symaddrs maps for binary $0: $1",
+                                         task.binary, s.ToString());
       }
-    }
 
-    // Go HTTP2 Probes.
-    if (!cfg_disable_go_tls_tracing_ && cfg_enable_http2_tracing_) {
-      StatusOr<int> attach_status =
-          AttachGoHTTP2UProbes(binary, elf_reader.get(), dwarf_reader.get(), pid_vec);
-      if (!attach_status.ok()) {
-        monitor_.AppendSourceStatusRecord("socket_tracer", attach_status.status(),
-                                          "AttachGoHTTP2UProbes");
-        LOG_FIRST_N(WARNING, 10) << absl::Substitute("Failed to attach HTTP2 Uprobes to $0: $1",
-                                                     binary, attach_status.ToString());
-      } else {
-        uprobe_count += attach_status.ValueOrDie();
+      // GoTLS Probes.
+      if (task.symaddrs->tls.has_value()) {
+        VLOG(1) << absl::Substitute("Attempting to attach Go TLS uprobes to binary $0",
+                                    task.binary);
+        StatusOr<int> attach_status = AttachGoTLSUProbes(task.binary, task.elf_reader.get());
+        if (!attach_status.ok()) {
+          monitor_.AppendSourceStatusRecord("socket_tracer", attach_status.status(),
+                                            "AttachGoTLSUProbes");
+          LOG_FIRST_N(WARNING, 10) << absl::Substitute("Failed to attach GoTLS Uprobes to $0: $1",
+                                                       task.binary, attach_status.ToString());
+        } else {
+          uprobe_count += attach_status.ValueOrDie();
+        }
       }
+
+      // Go HTTP2 Probes.
+      if (task.symaddrs->http2.has_value()) {
+        StatusOr<int> attach_status = AttachGoHTTP2UProbes(task.binary, task.elf_reader.get());
+        if (!attach_status.ok()) {
+          monitor_.AppendSourceStatusRecord("socket_tracer", attach_status.status(),
+                                            "AttachGoHTTP2UProbes");
+          LOG_FIRST_N(WARNING, 10) << absl::Substitute("Failed to attach HTTP2 Uprobes to $0: $1",
+                                                       task.binary, attach_status.ToString());
+        } else {
+          uprobe_count += attach_status.ValueOrDie();
+        }
+      }
+    }
+
+    // Record the result in the persistent cache so that a restarted Stirling can skip the
+    // DWARF read for this binary. Failures are not persisted: unlike the in-memory negative
+    // cache, a nullopt here could also mean the container terminated mid-scan.
+    if (task.symaddrs.has_value() && !task.build_id.empty() &&
+        !persistent_symaddrs_cache_.contains(task.build_id)) {
+      persistent_symaddrs_cache_.emplace(task.build_id, task.symaddrs.value());
+      persistent_symaddrs_cache_dirty_ = true;
     }
+
+    // Record the result (including failures, as nullopt) so the binary is not rescanned.
+    go_symaddrs_cache_.emplace(std::move(task.binary_key), std::move(task.symaddrs));
+  }
+
+  if (persistent_symaddrs_cache_dirty_) {
+    SaveGoSymAddrsCache();
+    persistent_symaddrs_cache_dirty_ = false;
   }
 
   return uprobe_count;
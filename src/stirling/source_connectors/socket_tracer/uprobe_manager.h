@@ -20,6 +20,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -488,37 +489,26 @@ class UProbeManager {
   void SetupGOIDMaps(const std::string& binary, const std::vector<int32_t>& pids);
 
   /**
-   * Attaches the required uprobes for Go HTTP2 tracing to the specified binary, if it is a
-   * compatible Go binary.
+   * Attaches the required uprobes for Go HTTP2 tracing to the specified binary.
+   * The binary is assumed to have already been scanned and found to use a Go HTTP2 library.
    *
    * @param binary The path to the binary on which to deploy Go HTTP2 probes.
    * @param elf_reader ELF reader for the binary.
-   * @param dwarf_reader DWARF reader for the binary.
-   * @param pids The list of PIDs that are new instances of the binary. Used to populate symbol
-   *             addresses.
-   * @return The number of uprobes deployed, or error. It is not considered an error if the binary
-   *         is not a Go binary or doesn't use a Go HTTP2 library; instead the return value will be
-   *         zero.
+   * @return The number of uprobes deployed, or error. Zero is returned if the binary already
+   *         has the probes attached.
    */
-  StatusOr<int> AttachGoHTTP2UProbes(const std::string& binary, obj_tools::ElfReader* elf_reader,
-                                     obj_tools::DwarfReader* dwarf_reader,
-                                     const std::vector<int32_t>& pids);
+  StatusOr<int> AttachGoHTTP2UProbes(const std::string& binary, obj_tools::ElfReader* elf_reader);
 
   /**
-   * Attaches the required probes for GoTLS tracing to the specified binary, if it is a compatible
-   * Go binary.
+   * Attaches the required probes for GoTLS tracing to the specified binary.
+   * The binary is assumed to have already been scanned and found to use Go TLS.
    *
-   * @param binary The path to the binary on which to deploy Go HTTP2 probes.
+   * @param binary The path to the binary on which to deploy Go TLS probes.
    * @param elf_reader ELF reader for the binary.
-   * @param dwarf_reader DWARF reader for the binary.
-   * @param pids The list of PIDs that are new instances of the binary. Used to populate symbol
-   *             addresses.
-   * @return The number of uprobes deployed, or error. It is not an error if the binary
-   *         is not a Go binary or doesn't use Go TLS; instead the return value will be zero.
+   * @return The number of uprobes deployed, or error. Zero is returned if the binary already
+   *         has the probes attached.
    */
-  StatusOr<int> AttachGoTLSUProbes(const std::string& binary, obj_tools::ElfReader* elf_reader,
-                                   obj_tools::DwarfReader* dwarf_reader,
-                                   const std::vector<int32_t>& new_pids);
+  StatusOr<int> AttachGoTLSUProbes(const std::string& binary, obj_tools::ElfReader* elf_reader);
 
   /**
    * Attaches the required probes for OpenSSL tracing to the specified PID, if it uses OpenSSL.
@@ -559,6 +549,12 @@ class UProbeManager {
    */
   Status LogAndAttachUProbe(const bpf_tools::UProbeSpec& spec);
 
+  /**
+   * Like LogAndAttachUProbe(), but resolves the symbols of the whole batch up-front with a
+   * single ELF pass per target binary, avoiding BCC's per-attach binary parsing.
+   */
+  Status LogAndAttachUProbes(std::vector<bpf_tools::UProbeSpec> specs);
+
   /**
    * Helper function that calls BCCWrapper.AttachUprobe() from a probe template.
    * Among other things, it finds all symbol matches as specified in the template,
@@ -578,17 +574,49 @@ class UProbeManager {
 
   Status UpdateOpenSSLSymAddrs(px::stirling::obj_tools::RawFptrManager* fptrManager,
                                std::filesystem::path container_lib, uint32_t pid);
-  Status UpdateGoCommonSymAddrs(obj_tools::ElfReader* elf_reader,
-                                obj_tools::DwarfReader* dwarf_reader,
-                                const std::vector<int32_t>& pids);
-  Status UpdateGoHTTP2SymAddrs(obj_tools::ElfReader* elf_reader,
-                               obj_tools::DwarfReader* dwarf_reader,
-                               const std::vector<int32_t>& pids);
-  Status UpdateGoTLSSymAddrs(obj_tools::ElfReader* elf_reader, obj_tools::DwarfReader* dwarf_reader,
-                             const std::vector<int32_t>& pids);
   Status UpdateNodeTLSWrapSymAddrs(int32_t pid, const std::filesystem::path& node_exe,
                                    const SemVer& ver);
 
+  // The symbol addresses extracted from scanning one Go binary.
+  // These are a property of the binary, not of any one process, so they are cached by binary
+  // identity (device:inode) and shared across all processes (containers) running that binary.
+  struct GoSymAddrs {
+    struct go_common_symaddrs_t common = {};
+    // Unset if the binary does not have the respective library's symbols (or tracing of the
+    // respective protocol is disabled).
+    std::optional<struct go_tls_symaddrs_t> tls;
+    std::optional<struct go_http2_symaddrs_t> http2;
+  };
+
+  // A unit of Go binary scanning work for DeployGoUProbes().
+  // The scan phase fills in elf_reader and symaddrs on a worker pool; the deployment phase
+  // consumes them on the deployment thread.
+  struct GoBinaryScanTask {
+    std::string binary;
+    std::string binary_key;
+    std::vector<int32_t> pids;
+    std::shared_ptr<obj_tools::ElfReader> elf_reader;
+    // The binary's GNU build-id, filled in by the scan phase (empty if the binary has none).
+    // Used to key the persistent symaddrs cache.
+    std::string build_id;
+    // Unset if the binary could not be read, is not a Go binary, or lacks mandatory symbols.
+    std::optional<GoSymAddrs> symaddrs;
+  };
+
+  // Scans the task's binary: creates the ELF/DWARF readers and extracts Go symbol addresses.
+  // Only reads the binary file and touches no BPF or manager state, so it is safe to call
+  // from multiple worker threads concurrently (on distinct tasks).
+  void ScanGoBinary(GoBinaryScanTask* task) const;
+
+  // Writes the given symbol addresses into the per-PID BPF maps for each of the given PIDs.
+  Status PopulateGoSymAddrs(const GoSymAddrs& symaddrs, const std::vector<int32_t>& pids);
+
+  // Loads/saves the persistent symaddrs cache (--stirling_uprobe_symaddrs_cache_path).
+  // The cache is keyed by build-id, so it survives restarts, node reboots and image re-pulls.
+  // A stale or corrupt file is ignored (and later overwritten); these are best-effort.
+  void LoadGoSymAddrsCache();
+  void SaveGoSymAddrsCache() const;
+
   // Clean-up various BPF maps used to communicate symbol addresses per PID.
   // Once the PID has terminated, the information is not required anymore.
   // Note that BPF maps can fill up if this is not done.
@@ -623,11 +651,24 @@ class UProbeManager {
   // and exponentially grows every time nothing new is found.
   absl::flat_hash_map<md::UPID, int> backoff_map_;
 
+  // Go binary scan results, keyed by binary identity (device:inode).
+  // A nullopt value records that the binary was scanned and found untraceable, so it is not
+  // scanned again. Keying by identity rather than /proc/<pid>/root path means the many
+  // containers of a node-wide rollout that run the same image are analyzed exactly once.
+  // TODO(oazizi): How should this map be cleaned up of old binaries, once they are deleted?
+  //               Without clean-up, it could consume more-and-more memory.
+  absl::flat_hash_map<std::string, std::optional<GoSymAddrs>> go_symaddrs_cache_;
+
+  // Scan results loaded from / destined for the on-disk cache, keyed by the binary's build-id.
+  // Lets a restarted Stirling skip the DWARF read for binaries scanned in a previous life.
+  // Read-only during the parallel scan phase; mutated only on the deployment thread.
+  absl::flat_hash_map<std::string, GoSymAddrs> persistent_symaddrs_cache_;
+  bool persistent_symaddrs_cache_dirty_ = false;
+
   // Records the binaries that have uprobes attached, so we don't try to probe them again.
   // TODO(oazizi): How should these sets be cleaned up of old binaries, once they are deleted?
   //               Without clean-up, these could consume more-and-more memory.
   absl::flat_hash_set<std::string> openssl_probed_binaries_;
-  absl::flat_hash_set<std::string> scanned_binaries_;
   absl::flat_hash_set<std::string> go_probed_binaries_;
   absl::flat_hash_set<std::string> go_http2_probed_binaries_;
   absl::flat_hash_set<std::string> go_tls_probed_binaries_;
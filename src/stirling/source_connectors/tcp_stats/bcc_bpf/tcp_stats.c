@@ -24,7 +24,9 @@
 #include <linux/in6.h>
 #include <linux/net.h>
 #include <linux/socket.h>
+#include <linux/tcp.h>
 #include <net/inet_sock.h>
+#include <net/tcp.h>
 
 #include "src/stirling/bpf_tools/bcc_bpf/task_struct_utils.h"
 #include "src/stirling/bpf_tools/bcc_bpf/utils.h"
@@ -40,8 +42,14 @@
 // so default hash map size 10240 serves without conflicts.
 BPF_HASH(sock_store, uint32_t, struct sock*, 10240);
 
-// This is the perf buffer for BPF program to export TCP data from kernel to user space.
-BPF_PERF_OUTPUT(tcp_events);
+// Per-connection counters, aggregated in-kernel.
+// User space periodically snapshots and clears this map, so the work per sampling period is
+// proportional to the number of active connections, not to the number of packet events.
+BPF_HASH(tcp_conn_stats, struct tcp_conn_key_t, struct tcp_conn_stats_t, 10240);
+
+// Per-connection log2 histogram of the smoothed RTT (in usec).
+// Keyed by {connection, bucket}; sized for several occupied buckets per tracked connection.
+BPF_HASH(tcp_rtt_hist, struct tcp_rtt_hist_key_t, uint64_t, 40960);
 
 static bool valid_ip_family(int family) {
   if (family == AF_INET || family == AF_INET6) {
@@ -50,49 +58,66 @@ static bool valid_ip_family(int family) {
   return false;
 }
 
-static int tcp_sendstat(struct pt_regs* ctx, uint32_t tgid, uint32_t id, int size) {
-  struct sock** sockpp;
-  sockpp = sock_store.lookup(&id);
-  if (sockpp == 0) {
-    return 0;  // entry missed
-  }
-
-  struct sock* sk = *sockpp;
+// Fills out the connection aggregation key from the socket.
+// Returns 0 on success; non-zero if the socket is not an IPv4/IPv6 socket.
+// The key must be zero-initialized by the caller so padding bytes are deterministic.
+static int fill_conn_key(struct sock* sk, struct tcp_conn_key_t* key) {
   struct sock_common* sk_common = &sk->__sk_common;
   uint16_t family = -1;
 
   BPF_PROBE_READ_KERNEL_VAR(family, &sk_common->skc_family);
   if (!valid_ip_family(family)) {
-    return 0;
+    return -1;
   }
 
   int lport = -1;
   int rport = -1;
-  BPF_PROBE_READ_KERNEL_VAR(rport, &sk_common->skc_dport);
   BPF_PROBE_READ_KERNEL_VAR(lport, &sk_common->skc_num);
+  BPF_PROBE_READ_KERNEL_VAR(rport, &sk_common->skc_dport);
 
-  struct tcp_event_t event = {};
-  event.remote_addr.sa.sa_family = family;
-  event.local_addr.sa.sa_family = family;
-  event.timestamp_ns = bpf_ktime_get_ns();
-  event.upid.tgid = tgid;
-  event.upid.start_time_ticks = get_tgid_start_time();
+  key->local_addr.sa.sa_family = family;
+  key->remote_addr.sa.sa_family = family;
 
   if (family == AF_INET) {
-    event.local_addr.in4.sin_port = ntohs(lport);
-    event.remote_addr.in4.sin_port = rport;
-    BPF_PROBE_READ_KERNEL_VAR(event.local_addr.in4.sin_addr.s_addr, &sk_common->skc_rcv_saddr);
-    BPF_PROBE_READ_KERNEL_VAR(event.remote_addr.in4.sin_addr.s_addr, &sk_common->skc_daddr);
+    key->local_addr.in4.sin_port = ntohs(lport);
+    key->remote_addr.in4.sin_port = rport;
+    BPF_PROBE_READ_KERNEL_VAR(key->local_addr.in4.sin_addr.s_addr, &sk_common->skc_rcv_saddr);
+    BPF_PROBE_READ_KERNEL_VAR(key->remote_addr.in4.sin_addr.s_addr, &sk_common->skc_daddr);
   } else if (family == AF_INET6) {
-    event.local_addr.in6.sin6_port = ntohs(lport);
-    event.remote_addr.in6.sin6_port = rport;
-    BPF_PROBE_READ_KERNEL_VAR(event.local_addr.in6.sin6_addr, &sk_common->skc_v6_rcv_saddr);
-    BPF_PROBE_READ_KERNEL_VAR(event.remote_addr.in6.sin6_addr, &sk_common->skc_v6_daddr);
+    key->local_addr.in6.sin6_port = ntohs(lport);
+    key->remote_addr.in6.sin6_port = rport;
+    BPF_PROBE_READ_KERNEL_VAR(key->local_addr.in6.sin6_addr, &sk_common->skc_v6_rcv_saddr);
+    BPF_PROBE_READ_KERNEL_VAR(key->remote_addr.in6.sin6_addr, &sk_common->skc_v6_daddr);
+  }
+
+  key->upid.tgid = bpf_get_current_pid_tgid() >> 32;
+  key->upid.start_time_ticks = get_tgid_start_time();
+  return 0;
+}
+
+static struct tcp_conn_stats_t* lookup_or_init_conn_stats(struct tcp_conn_key_t* key) {
+  struct tcp_conn_stats_t zero = {};
+  return tcp_conn_stats.lookup_or_try_init(key, &zero);
+}
+
+static int tcp_sendstat(uint32_t id, int size) {
+  struct sock** sockpp;
+  sockpp = sock_store.lookup(&id);
+  if (sockpp == 0) {
+    return 0;  // entry missed
   }
 
-  event.size = size;
-  event.type = kTCPTx;
-  tcp_events.perf_submit(ctx, &event, sizeof(event));
+  struct sock* sk = *sockpp;
+  struct tcp_conn_key_t key = {};
+  if (fill_conn_key(sk, &key) != 0) {
+    sock_store.delete(&id);
+    return 0;
+  }
+
+  struct tcp_conn_stats_t* stats = lookup_or_init_conn_stats(&key);
+  if (stats != NULL) {
+    __sync_fetch_and_add(&stats->bytes_sent, size);
+  }
 
   sock_store.delete(&id);
   return 0;
@@ -101,9 +126,8 @@ static int tcp_sendstat(struct pt_regs* ctx, uint32_t tgid, uint32_t id, int siz
 int probe_ret_tcp_sendmsg(struct pt_regs* ctx) {
   int size = PT_REGS_RC(ctx);
   if (size > 0) {
-    uint64_t id = bpf_get_current_pid_tgid();
-    uint32_t tgid = id >> 32;
-    return tcp_sendstat(ctx, tgid, id, size);
+    uint32_t id = bpf_get_current_pid_tgid();
+    return tcp_sendstat(id, size);
   } else {
     return 0;
   }
@@ -112,9 +136,8 @@ int probe_ret_tcp_sendmsg(struct pt_regs* ctx) {
 int probe_ret_tcp_sendpage(struct pt_regs* ctx) {
   int size = PT_REGS_RC(ctx);
   if (size > 0) {
-    uint64_t id = bpf_get_current_pid_tgid();
-    uint32_t tgid = id >> 32;
-    return tcp_sendstat(ctx, tgid, id, size);
+    uint32_t id = bpf_get_current_pid_tgid();
+    return tcp_sendstat(id, size);
   } else {
     return 0;
   }
@@ -139,42 +162,16 @@ int probe_entry_tcp_cleanup_rbuf(struct pt_regs* ctx, struct sock* sk, int copie
   if (copied <= 0) {
     return 0;
   }
-  uint32_t tgid = bpf_get_current_pid_tgid() >> 32;
 
-  uint16_t family = -1;
-
-  BPF_PROBE_READ_KERNEL_VAR(family, &sk->__sk_common.skc_family);
-  if (!valid_ip_family(family)) {
+  struct tcp_conn_key_t key = {};
+  if (fill_conn_key(sk, &key) != 0) {
     return 0;
   }
 
-  int lport = -1;
-  int rport = -1;
-  BPF_PROBE_READ_KERNEL_VAR(lport, &sk->__sk_common.skc_num);
-  BPF_PROBE_READ_KERNEL_VAR(rport, &sk->__sk_common.skc_dport);
-
-  struct tcp_event_t event = {};
-  event.remote_addr.sa.sa_family = family;
-  event.local_addr.sa.sa_family = family;
-
-  if (family == AF_INET) {
-    event.local_addr.in4.sin_port = ntohs(lport);
-    event.remote_addr.in4.sin_port = rport;
-    BPF_PROBE_READ_KERNEL_VAR(event.local_addr.in4.sin_addr.s_addr, &sk->__sk_common.skc_rcv_saddr);
-    BPF_PROBE_READ_KERNEL_VAR(event.remote_addr.in4.sin_addr.s_addr, &sk->__sk_common.skc_daddr);
-  } else if (family == AF_INET6) {
-    event.local_addr.in6.sin6_port = ntohs(lport);
-    event.remote_addr.in6.sin6_port = rport;
-    BPF_PROBE_READ_KERNEL_VAR(event.local_addr.in6.sin6_addr, &sk->__sk_common.skc_v6_rcv_saddr);
-    BPF_PROBE_READ_KERNEL_VAR(event.remote_addr.in6.sin6_addr, &sk->__sk_common.skc_v6_daddr);
-  }
-
-  event.timestamp_ns = bpf_ktime_get_ns();
-  event.upid.tgid = tgid;
-  event.upid.start_time_ticks = get_tgid_start_time();
-  event.type = kTCPRx;
-  event.size = copied;
-  tcp_events.perf_submit(ctx, &event, sizeof(event));
+  struct tcp_conn_stats_t* stats = lookup_or_init_conn_stats(&key);
+  if (stats != NULL) {
+    __sync_fetch_and_add(&stats->bytes_recv, copied);
+  }
   return 0;
 }
 
@@ -185,42 +182,46 @@ int probe_entry_tcp_retransmit_skb(struct pt_regs* ctx, struct sock* skp, struct
   }
 
   // Process id can be zero if syn packets are getting retransmitted.
-  uint32_t tgid = bpf_get_current_pid_tgid() >> 32;
+  struct tcp_conn_key_t key = {};
+  if (fill_conn_key(skp, &key) != 0) {
+    return 0;
+  }
 
-  uint16_t family = -1;
+  struct tcp_conn_stats_t* stats = lookup_or_init_conn_stats(&key);
+  if (stats != NULL) {
+    __sync_fetch_and_add(&stats->retransmissions, 1);
+  }
+  return 0;
+}
 
-  BPF_PROBE_READ_KERNEL_VAR(family, &skp->__sk_common.skc_family);
-  if (!valid_ip_family(family)) {
+int probe_entry_tcp_rcv_established(struct pt_regs* ctx, struct sock* sk, struct sk_buff* skb) {
+  if (sk == NULL) {
     return 0;
   }
 
-  int lport = -1;
-  int rport = -1;
-  BPF_PROBE_READ_KERNEL_VAR(lport, &skp->__sk_common.skc_num);
-  BPF_PROBE_READ_KERNEL_VAR(rport, &skp->__sk_common.skc_dport);
+  struct tcp_sock* ts = (struct tcp_sock*)sk;
+  uint32_t srtt_us = 0;
+  BPF_PROBE_READ_KERNEL_VAR(srtt_us, &ts->srtt_us);
+  // The kernel stores the smoothed RTT left-shifted by 3 (averaged over 8 samples).
+  srtt_us >>= 3;
+  if (srtt_us == 0) {
+    return 0;
+  }
 
-  struct tcp_event_t event = {};
-  event.remote_addr.sa.sa_family = family;
-  event.local_addr.sa.sa_family = family;
+  struct tcp_rtt_hist_key_t hkey = {};
+  if (fill_conn_key(sk, &hkey.conn) != 0) {
+    return 0;
+  }
 
-  if (family == AF_INET) {
-    event.local_addr.in4.sin_port = ntohs(lport);
-    event.remote_addr.in4.sin_port = rport;
-    BPF_PROBE_READ_KERNEL_VAR(event.local_addr.in4.sin_addr.s_addr,
-                              &skp->__sk_common.skc_rcv_saddr);
-    BPF_PROBE_READ_KERNEL_VAR(event.remote_addr.in4.sin_addr.s_addr, &skp->__sk_common.skc_daddr);
-  } else if (family == AF_INET6) {
-    event.local_addr.in6.sin6_port = ntohs(lport);
-    event.remote_addr.in6.sin6_port = rport;
-    BPF_PROBE_READ_KERNEL_VAR(event.local_addr.in6.sin6_addr, &skp->__sk_common.skc_v6_rcv_saddr);
-    BPF_PROBE_READ_KERNEL_VAR(event.remote_addr.in6.sin6_addr, &skp->__sk_common.skc_v6_daddr);
-  }
-
-  event.timestamp_ns = bpf_ktime_get_ns();
-  event.upid.tgid = tgid;
-  event.upid.start_time_ticks = get_tgid_start_time();
-  event.type = kTCPRetransmissions;
-  event.size = 1;
-  tcp_events.perf_submit(ctx, &event, sizeof(event));
+  hkey.bucket = bpf_log2l(srtt_us);
+  if (hkey.bucket >= TCP_RTT_NUM_BUCKETS) {
+    hkey.bucket = TCP_RTT_NUM_BUCKETS - 1;
+  }
+
+  uint64_t zero = 0;
+  uint64_t* count = tcp_rtt_hist.lookup_or_try_init(&hkey, &zero);
+  if (count != NULL) {
+    __sync_fetch_and_add(count, 1);
+  }
   return 0;
 }
@@ -28,25 +28,14 @@ union sockaddress_t {
   struct sockaddr_in6 in6;
 };
 
-enum tcp_event_type_t {
-  // Unknown Event.
-  kUnknownEvent,
-
-  // TCP egress data event.
-  kTCPTx,
-
-  // TCP ingress data event.
-  kTCPRx,
-
-  // TCP retransmissions.
-  kTCPRetransmissions,
-};
-
-struct tcp_event_t {
-  // The time when this was captured in the BPF time.
-  uint64_t timestamp_ns;
-
-  // The unique identifier of the process.
+// Number of log2 buckets in the per-connection RTT histogram.
+// Bucket i covers RTT values up to 2^i microseconds; 32 buckets cover any 32-bit srtt.
+#define TCP_RTT_NUM_BUCKETS 32
+
+// Identifies a TCP connection for in-kernel aggregation.
+// Always zero-initialize instances so that padding bytes hash/compare deterministically.
+struct tcp_conn_key_t {
+  // The unique identifier of the local process.
   struct upid_t upid;
 
   // IP address of the local endpoint.
@@ -54,10 +43,20 @@ struct tcp_event_t {
 
   // IP address of the remote endpoint.
   union sockaddress_t remote_addr;
+};
+
+// Per-connection counters, aggregated in-kernel.
+// User space snapshots and resets these periodically, so values are deltas per sampling period.
+struct tcp_conn_stats_t {
+  uint64_t bytes_sent;
+  uint64_t bytes_recv;
+  uint64_t retransmissions;
+};
 
-  // Number of bytes.
-  uint64_t size;
+// One log2 bucket of a per-connection RTT histogram.
+struct tcp_rtt_hist_key_t {
+  struct tcp_conn_key_t conn;
 
-  // Source of event.
-  enum tcp_event_type_t type;
+  // floor(log2(srtt_us)), clamped to TCP_RTT_NUM_BUCKETS - 1.
+  uint32_t bucket;
 };
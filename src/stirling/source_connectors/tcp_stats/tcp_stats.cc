@@ -18,6 +18,9 @@
 
 #include "src/stirling/source_connectors/tcp_stats/tcp_stats.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include <absl/strings/substitute.h>
 
 #include "src/common/base/base.h"
@@ -40,35 +43,58 @@ TCPStats::AggKey BuildAggKey(const upid_t& upid, const SockAddr& local_endpoint,
 
 }  // namespace
 
+namespace {
+
+TCPStats::AggKey BuildAggKeyFromConnKey(const tcp_conn_key_t& conn_key) {
+  SockAddr laddr, raddr;
+  auto la = conn_key.local_addr;
+  auto ra = conn_key.remote_addr;
+  PopulateSockAddr(reinterpret_cast<struct sockaddr*>(&la), &laddr);
+  PopulateSockAddr(reinterpret_cast<struct sockaddr*>(&ra), &raddr);
+  return BuildAggKey(conn_key.upid, laddr, raddr);
+}
+
+}  // namespace
+
 absl::flat_hash_map<TCPStats::AggKey, TCPStats::Stats>* TCPStats::UpdateStats(
-    const std::vector<tcp_event_t> events) {
-  for (auto& event : events) {
-    SockAddr laddr, raddr;
-    auto la = event.local_addr;
-    auto ra = event.remote_addr;
-    PopulateSockAddr(reinterpret_cast<struct sockaddr*>(&la), &laddr);
-    PopulateSockAddr(reinterpret_cast<struct sockaddr*>(&ra), &raddr);
-    TCPStats::AggKey key = BuildAggKey(event.upid, laddr, raddr);
-    auto& stats = tcp_agg_stats_[key];
-
-    switch (event.type) {
-      case kUnknownEvent:
-        continue;
-      case kTCPTx:
-        stats.bytes_sent += event.size;
-        continue;
-      case kTCPRx:
-        stats.bytes_recv += event.size;
-        continue;
-      case kTCPRetransmissions:
-        stats.retransmissions += event.size;
-        continue;
-      default:
-        continue;
-    }
+    const std::vector<std::pair<tcp_conn_key_t, tcp_conn_stats_t>>& conn_stats,
+    const std::vector<std::pair<tcp_rtt_hist_key_t, uint64_t>>& rtt_hist) {
+  for (const auto& [conn_key, counters] : conn_stats) {
+    auto& stats = tcp_agg_stats_[BuildAggKeyFromConnKey(conn_key)];
+    stats.bytes_sent += counters.bytes_sent;
+    stats.bytes_recv += counters.bytes_recv;
+    stats.retransmissions += counters.retransmissions;
+  }
+
+  for (const auto& [hist_key, count] : rtt_hist) {
+    auto& stats = tcp_agg_stats_[BuildAggKeyFromConnKey(hist_key.conn)];
+    uint32_t bucket = std::min<uint32_t>(hist_key.bucket, TCP_RTT_NUM_BUCKETS - 1);
+    stats.rtt_hist[bucket] += count;
   }
+
   return &tcp_agg_stats_;
 }
 
+uint64_t RTTHistogramPercentileNs(const std::array<uint64_t, TCP_RTT_NUM_BUCKETS>& hist, double p) {
+  uint64_t total = 0;
+  for (uint64_t count : hist) {
+    total += count;
+  }
+  if (total == 0) {
+    return 0;
+  }
+
+  const uint64_t target = static_cast<uint64_t>(std::ceil(p * total));
+  uint64_t cumulative = 0;
+  for (size_t bucket = 0; bucket < hist.size(); ++bucket) {
+    cumulative += hist[bucket];
+    if (cumulative >= target) {
+      // Represent the bucket by its upper bound: 2^bucket usec, converted to ns.
+      return (1ULL << bucket) * 1000;
+    }
+  }
+  return (1ULL << (hist.size() - 1)) * 1000;
+}
+
 }  // namespace stirling
 }  // namespace px
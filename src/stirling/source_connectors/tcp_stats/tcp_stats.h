@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <array>
 #include <string>
 #include <utility>
 #include <vector>
@@ -75,6 +76,10 @@ class TCPStats {
     uint64_t bytes_recv = 0;
     uint64_t retransmissions = 0;
 
+    // Log2 histogram of the smoothed RTT (usec), as maintained by the BPF program.
+    // Bucket i holds samples with RTT in (2^(i-1), 2^i] usec.
+    std::array<uint64_t, TCP_RTT_NUM_BUCKETS> rtt_hist = {};
+
     std::string ToString() const {
       return absl::Substitute("[bytes_sent=$0 bytes_recv=$1 retransmissions=$2]", bytes_sent,
                               bytes_recv, retransmissions);
@@ -82,17 +87,26 @@ class TCPStats {
   };
 
   /**
-   * Iterates through all the trackers and updates the internal state with any newly collected
-   * information that the tracker has received.
+   * Merges a snapshot of the in-kernel per-connection counters and RTT histograms into the
+   * internal state. The BPF maps are cleared on snapshot, so the inputs are per-period deltas.
    *
    * @return A mutable reference to all the aggregated connection stats. The reference is mutable
    *         for the purposes of removing stats that are no longer needed.
    */
-  absl::flat_hash_map<AggKey, Stats>* UpdateStats(const std::vector<tcp_event_t> events);
+  absl::flat_hash_map<AggKey, Stats>* UpdateStats(
+      const std::vector<std::pair<tcp_conn_key_t, tcp_conn_stats_t>>& conn_stats,
+      const std::vector<std::pair<tcp_rtt_hist_key_t, uint64_t>>& rtt_hist);
 
  private:
   absl::flat_hash_map<AggKey, Stats> tcp_agg_stats_;
 };
 
+/**
+ * Returns the approximate p-th percentile RTT, in nanoseconds, from a log2 histogram of
+ * microsecond samples. Each bucket is represented by its upper bound (2^i usec), so the result
+ * overestimates by at most 2x. Returns 0 if the histogram is empty.
+ */
+uint64_t RTTHistogramPercentileNs(const std::array<uint64_t, TCP_RTT_NUM_BUCKETS>& hist, double p);
+
 }  // namespace stirling
 }  // namespace px
@@ -32,10 +32,6 @@ OBJ_STRVIEW(tcpstats_bcc_script, tcpstats);
 namespace px {
 namespace stirling {
 
-// Allocating 50 MB perf buffer. It can accommodate ~125000 events
-// Considering each event size ~400 bytes (struct tcp_event_t).
-constexpr uint32_t kPerfBufferPerCPUSizeBytes = 50 * 1024 * 1024;
-
 using ProbeType = bpf_tools::BPFProbeAttachType;
 const auto kProbeSpecs = MakeArray<bpf_tools::KProbeSpec>(
     {{"tcp_sendmsg", ProbeType::kEntry, "probe_entry_tcp_sendmsg", /*is_syscall*/ false},
@@ -44,33 +40,19 @@ const auto kProbeSpecs = MakeArray<bpf_tools::KProbeSpec>(
      {"tcp_sendpage", ProbeType::kReturn, "probe_ret_tcp_sendpage", /*is_syscall*/ false},
      {"tcp_cleanup_rbuf", ProbeType::kEntry, "probe_entry_tcp_cleanup_rbuf", /*is_syscall*/ false},
      {"tcp_retransmit_skb", ProbeType::kEntry, "probe_entry_tcp_retransmit_skb",
+      /*is_syscall*/ false},
+     {"tcp_rcv_established", ProbeType::kEntry, "probe_entry_tcp_rcv_established",
       /*is_syscall*/ false}});
 
-void HandleTcpEvent(void* cb_cookie, void* data, int /*data_size*/) {
-  auto* connector = reinterpret_cast<TCPStatsConnector*>(cb_cookie);
-  auto* event = reinterpret_cast<struct tcp_event_t*>(data);
-  connector->AcceptTcpEvent(*event);
-}
-
-void TCPStatsConnector::AcceptTcpEvent(const struct tcp_event_t& event) {
-  events_.push_back(event);
-}
-
-void HandleTcpEventLoss(void* /*cb_cookie*/, uint64_t /*lost*/) {
-  // TODO(RagalahariP): Add stats counter.
-}
-
 Status TCPStatsConnector::InitImpl() {
-  const auto perf_buffer_specs = MakeArray<bpf_tools::PerfBufferSpec>({
-      {"tcp_events", HandleTcpEvent, HandleTcpEventLoss, this, kPerfBufferPerCPUSizeBytes,
-       bpf_tools::PerfBufferSizeCategory::kData},
-  });
-
   sampling_freq_mgr_.set_period(kSamplingPeriod);
   push_freq_mgr_.set_period(kPushPeriod);
   PX_RETURN_IF_ERROR(bcc_->InitBPFProgram(tcpstats_bcc_script));
   PX_RETURN_IF_ERROR(bcc_->AttachKProbes(kProbeSpecs));
-  PX_RETURN_IF_ERROR(bcc_->OpenPerfBuffers(perf_buffer_specs));
+  conn_stats_map_ = bpf_tools::WrappedBCCMap<struct tcp_conn_key_t, struct tcp_conn_stats_t>::
+      Create(bcc_.get(), "tcp_conn_stats");
+  rtt_hist_map_ = bpf_tools::WrappedBCCMap<struct tcp_rtt_hist_key_t, uint64_t>::Create(
+      bcc_.get(), "tcp_rtt_hist");
   LOG(INFO) << absl::Substitute("Successfully deployed $0 kprobes.", kProbeSpecs.size());
   return Status::OK();
 }
@@ -83,10 +65,12 @@ Status TCPStatsConnector::StopImpl() {
 void TCPStatsConnector::TransferDataImpl(ConnectorContext* ctx) {
   DCHECK_EQ(data_tables_.size(), 1U) << "Only one table is allowed per TCPStatsConnector.";
 
-  bcc_->PollPerfBuffers();
-
   DataTable* data_table = data_tables_[0];
-  auto* agg_stats = tcp_stats_.UpdateStats(events_);
+
+  // Snapshot-and-reset the in-kernel aggregates: values are per-period deltas.
+  auto conn_stats = conn_stats_map_->GetTableOffline(/* clear_table */ true);
+  auto rtt_hist = rtt_hist_map_->GetTableOffline(/* clear_table */ true);
+  auto* agg_stats = tcp_stats_.UpdateStats(conn_stats, rtt_hist);
   uint64_t time = AdjustedSteadyClockNowNS();
   absl::flat_hash_set<md::UPID> upids = ctx->GetUPIDs();
 
@@ -107,11 +91,11 @@ void TCPStatsConnector::TransferDataImpl(ConnectorContext* ctx) {
     r.Append<tcp_stats::kTCPBytesReceivedIdx>(stats.bytes_recv);
     r.Append<tcp_stats::kTCPBytesSentIdx>(stats.bytes_sent);
     r.Append<tcp_stats::kTCPRetransmitsIdx>(stats.retransmissions);
+    r.Append<tcp_stats::kTCPRttP50Idx>(RTTHistogramPercentileNs(stats.rtt_hist, 0.50));
+    r.Append<tcp_stats::kTCPRttP99Idx>(RTTHistogramPercentileNs(stats.rtt_hist, 0.99));
 
     agg_stats->erase(iter++);
   }
-
-  events_.clear();
 }
 }  // namespace stirling
 }  // namespace px
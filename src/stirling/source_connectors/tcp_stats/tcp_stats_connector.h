@@ -43,8 +43,6 @@ class TCPStatsConnector : public BCCSourceConnector {
   TCPStatsConnector() = delete;
   ~TCPStatsConnector() override = default;
 
-  void AcceptTcpEvent(const struct tcp_event_t& event);
-
   static std::unique_ptr<SourceConnector> Create(std::string_view name) {
     return std::unique_ptr<SourceConnector>(new TCPStatsConnector(name));
   }
@@ -57,7 +55,11 @@ class TCPStatsConnector : public BCCSourceConnector {
   explicit TCPStatsConnector(std::string_view name) : BCCSourceConnector(name, kTables) {}
 
  private:
-  std::vector<struct tcp_event_t> events_;
+  // Handles to the in-kernel per-connection aggregation maps, snapshot-and-reset each cycle.
+  std::unique_ptr<bpf_tools::WrappedBCCMap<struct tcp_conn_key_t, struct tcp_conn_stats_t>>
+      conn_stats_map_;
+  std::unique_ptr<bpf_tools::WrappedBCCMap<struct tcp_rtt_hist_key_t, uint64_t>> rtt_hist_map_;
+
   TCPStats tcp_stats_;
 };
 }  // namespace stirling
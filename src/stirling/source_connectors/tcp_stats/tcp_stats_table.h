@@ -57,6 +57,10 @@ static constexpr DataElement kTCPStatsElements[] = {
          types::DataType::INT64, types::SemanticType::ST_BYTES, types::PatternType::METRIC_COUNTER},
       {"retransmits", "The number of retransmissions to the remote endpoint(s).",
          types::DataType::INT64, types::SemanticType::ST_NONE, types::PatternType::METRIC_COUNTER},
+      {"rtt_p50", "The median smoothed round-trip time, from the in-kernel log2 RTT histogram.",
+         types::DataType::INT64, types::SemanticType::ST_DURATION_NS, types::PatternType::METRIC_GAUGE},
+      {"rtt_p99", "The 99th percentile smoothed round-trip time, from the in-kernel log2 RTT histogram.",
+         types::DataType::INT64, types::SemanticType::ST_DURATION_NS, types::PatternType::METRIC_GAUGE},
 };
 
 // clang-format on
@@ -76,6 +80,8 @@ constexpr int kTCPRemotePortIdx = kTCPStatsTable.ColIndex("remote_port");
 constexpr int kTCPBytesSentIdx = kTCPStatsTable.ColIndex("tx");
 constexpr int kTCPBytesReceivedIdx = kTCPStatsTable.ColIndex("rx");
 constexpr int kTCPRetransmitsIdx = kTCPStatsTable.ColIndex("retransmits");
+constexpr int kTCPRttP50Idx = kTCPStatsTable.ColIndex("rtt_p50");
+constexpr int kTCPRttP99Idx = kTCPStatsTable.ColIndex("rtt_p99");
 
 }  // namespace tcp_stats
 }  // namespace stirling
@@ -48,12 +48,8 @@ class TcpTraceBPFTestFixture : public ::testing::Test {
   void TearDown() override { ASSERT_OK(source_->Stop()); }
 
   void StartTransferDataThread() {
-    // Drain the perf buffers before starting the thread.
-    // Otherwise, perf buffers may already be full, causing lost events and flaky test results.
     ASSERT_TRUE(source_ != nullptr);
 
-    source_->BCC().PollPerfBuffers();
-
     transfer_data_thread_ = std::thread([this]() {
       transfer_enable_ = true;
       while (transfer_enable_) {
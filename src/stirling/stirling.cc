@@ -31,10 +31,14 @@
 #include <absl/base/internal/spinlock.h>
 
 #include "src/common/base/base.h"
+#include "src/common/event/api_impl.h"
+#include "src/common/event/dispatcher.h"
+#include "src/common/event/real_time_system.h"
 #include "src/common/json/json.h"
 #include "src/common/perf/elapsed_timer.h"
 #include "src/stirling/utils/run_core_stats.h"
 #include "src/stirling/utils/system_info.h"
+#include "src/stirling/utils/worker_pool.h"
 
 #include "src/stirling/bpf_tools/probe_cleaner.h"
 #include "src/stirling/core/data_table.h"
@@ -66,6 +70,39 @@ DEFINE_string(stirling_sources, gflags::StringFromEnv("PL_STIRLING_SOURCES", "kP
               "comma separated list of "
               "sources (find them the header files of source connector classes).");
 
+DEFINE_string(stirling_unsubscribed_tables,
+              gflags::StringFromEnv("PL_STIRLING_UNSUBSCRIBED_TABLES", ""),
+              "Comma separated list of table names (e.g. nats_events.beta,amqp_events) that will "
+              "not be collected. The tables are still published in the schema, but stay empty, "
+              "and source connectors skip the corresponding collection work "
+              "(e.g. the socket tracer disables protocol tracing for unsubscribed tables).");
+
+DEFINE_bool(stirling_adaptive_sampling, gflags::BoolFromEnv("PL_STIRLING_ADAPTIVE_SAMPLING", true),
+            "If true, sources that opt in (pure polling sources like jvm_stats) adapt their "
+            "sampling period to their data rate: sampling cycles that produce no records back "
+            "off exponentially, and bursty cycles tighten the period. See FrequencyManager.");
+
+DEFINE_bool(stirling_dispatcher_run_loop,
+            gflags::BoolFromEnv("PL_STIRLING_DISPATCHER_RUN_LOOP", false),
+            "If true, the Stirling run loop is driven by the common event dispatcher, with one "
+            "timer per source connector, instead of the default sleep-and-poll loop. Wakeups then "
+            "track each source's own sampling and push cadence exactly.");
+
+DEFINE_int32(stirling_transfer_data_threads,
+             gflags::Int32FromEnv("PL_STIRLING_TRANSFER_DATA_THREADS", 1),
+             "Number of threads used to run source connectors' TransferData(). The default of 1 "
+             "keeps everything on the Stirling thread. With more threads, independent source "
+             "connectors sample in parallel, so a slow cycle in one connector (e.g. perf profiler "
+             "symbolization) does not delay draining the others. Each connector is pinned to one "
+             "worker, keeping connector-local state thread-affine.");
+
+DEFINE_int32(stirling_source_init_threads,
+             gflags::Int32FromEnv("PL_STIRLING_SOURCE_INIT_THREADS", 1),
+             "Number of threads used to initialize source connectors at startup. The default of "
+             "1 initializes them serially. With more threads, the BPF-based connectors compile "
+             "their programs (seconds of BCC/LLVM work each) concurrently, shrinking Stirling's "
+             "cold start to roughly the slowest connector.");
+
 namespace px {
 namespace stirling {
 
@@ -220,13 +257,16 @@ class StirlingImpl final : public Stirling {
   void SetDebugLevel(int level);
   void EnablePIDTrace(int pid);
   void DisablePIDTrace(int pid);
+  void SetProfilerPIDSampling(int pid);
+  void SetProfilerSampleDivisor(int divisor);
 
   void UpdateDynamicTraceStatus(const sole::uuid& uuid,
                                 const StatusOr<stirlingpb::Publish>& status);
 
  private:
   // Adds a source to Stirling, and updates all state accordingly.
-  Status AddSource(std::unique_ptr<SourceConnector> source);
+  // If init_source is false, the caller must have already called source->Init() successfully.
+  Status AddSource(std::unique_ptr<SourceConnector> source, bool init_source = true);
 
   // Removes a source and all its info classes from stirling.
   Status RemoveSource(std::string_view source_name);
@@ -242,6 +282,9 @@ class StirlingImpl final : public Stirling {
   // Main run implementation.
   void RunCore();
 
+  // Event-driven variant of the main run loop, selected by FLAGS_stirling_dispatcher_run_loop.
+  void RunCoreEventDriven();
+
   // Computes the amount of time to sleep based on the next source connector that needs to wakeup.
   std::chrono::milliseconds TimeUntilNextTick(const time_point now);
 
@@ -253,6 +296,10 @@ class StirlingImpl final : public Stirling {
 
   std::atomic<bool> run_enable_ = false;
   std::atomic<bool> running_ = false;
+
+  // The dispatcher driving the event-driven run loop. Only set while RunCoreEventDriven() is
+  // active; Stop() uses it to break the dispatcher out of its run loop from another thread.
+  std::atomic<event::Dispatcher*> run_dispatcher_ = nullptr;
   std::vector<std::unique_ptr<SourceConnector>> sources_ ABSL_GUARDED_BY(info_class_mgrs_lock_);
 
   InfoClassManagerVec info_class_mgrs_ ABSL_GUARDED_BY(info_class_mgrs_lock_);
@@ -291,6 +338,10 @@ class StirlingImpl final : public Stirling {
   // RunCoreStats tracks how much work is accomplished in each run core iteration,
   // and it also keeps a histogram of sleep durations.
   RunCoreStats run_core_stats_;
+
+  // Worker pool for running TransferData() of independent sources in parallel.
+  // Only created when FLAGS_stirling_transfer_data_threads > 1, and only used by RunCore().
+  std::unique_ptr<WorkerPool> transfer_data_workers_;
 };
 
 StirlingImpl* g_stirling_ptr = nullptr;
@@ -307,6 +358,18 @@ enum class SignalOpCode {
   // Only the SocketTracer currently implements this, but in theory other source connectors
   // could enable PID traces as well.
   kPIDTrace = 2,
+
+  // Override the perf profiler's sampling of an individual PID: a positive value restores
+  // full-rate sampling of that PID, a negative value stops sampling of that PID, and zero
+  // clears all per-PID overrides. Useful to boost a hot pod during an incident investigation
+  // (in combination with kProfilerSampleDivisor) or to skip idle ones, without restarting
+  // the profiler.
+  kProfilerPIDSampling = 3,
+
+  // Set the perf profiler's default downsampling divisor: only 1 of every <value> stack-trace
+  // samples is kept for processes without a per-PID override. A value of 1 restores the
+  // default behavior.
+  kProfilerSampleDivisor = 4,
 };
 
 void ProcessSetDebugLevelOpcode(int level) {
@@ -325,6 +388,22 @@ void ProcessPIDTraceOpcode(int pid) {
   }
 }
 
+void ProcessProfilerPIDSamplingOpcode(int pid) {
+  if (pid > 0) {
+    LOG(INFO) << absl::Substitute("Profiler: restoring full-rate sampling of PID: $0", pid);
+  } else if (pid < 0) {
+    LOG(INFO) << absl::Substitute("Profiler: stopping sampling of PID: $0", -1 * pid);
+  } else {
+    LOG(INFO) << "Profiler: clearing all per-PID sampling overrides";
+  }
+  g_stirling_ptr->SetProfilerPIDSampling(pid);
+}
+
+void ProcessProfilerSampleDivisorOpcode(int divisor) {
+  LOG(INFO) << absl::Substitute("Profiler: setting default sample divisor to $0", divisor);
+  g_stirling_ptr->SetProfilerSampleDivisor(divisor);
+}
+
 // To multiplex different actions onto a single signal handler, Stirling uses a simple
 // opcode+value protocol. Stirling expects signals to arrive in pairs:
 //   signal 1: opcode - Chooses what action to perform.
@@ -363,6 +442,12 @@ void UserSignalHandler(int /* signum */, siginfo_t* info, void* /* context */) {
     case SignalOpCode::kPIDTrace:
       ProcessPIDTraceOpcode(value);
       break;
+    case SignalOpCode::kProfilerPIDSampling:
+      ProcessProfilerPIDSamplingOpcode(value);
+      break;
+    case SignalOpCode::kProfilerSampleDivisor:
+      ProcessProfilerSampleDivisorOpcode(value);
+      break;
     default:
       LOG(INFO) << absl::Substitute("Unexpected signal opcode: $0", value);
   }
@@ -407,14 +492,49 @@ Status StirlingImpl::Init() {
     return error::NotFound("Source registry doesn't exist");
   }
 
-  for (const auto& [name, create_source_fn, _] : registry_->sources()) {
-    auto source_ptr = create_source_fn(name);
+  if (FLAGS_stirling_source_init_threads > 1) {
+    // Instantiate all sources, then run their Init() calls concurrently. Init() is where
+    // each BPF-based connector pays seconds of BCC/LLVM compile time, and the connectors
+    // are independent, so cold start shrinks to roughly the slowest connector.
+    std::vector<std::unique_ptr<SourceConnector>> pending_sources;
+    for (const auto& [name, create_source_fn, _] : registry_->sources()) {
+      pending_sources.push_back(create_source_fn(name));
+    }
 
-    Status s = AddSource(std::move(source_ptr));
-    monitor_.AppendSourceStatusRecord(name, s, "Init");
+    std::vector<Status> init_statuses(pending_sources.size());
+    if (!pending_sources.empty()) {
+      WorkerPool pool(
+          std::min<size_t>(FLAGS_stirling_source_init_threads, pending_sources.size()));
+      for (size_t i = 0; i < pending_sources.size(); ++i) {
+        pool.SubmitTo(i, [&pending_sources, &init_statuses, i]() {
+          init_statuses[i] = pending_sources[i]->Init();
+        });
+      }
+      pool.Wait();
+    }
 
-    LOG_IF(WARNING, !s.ok()) << absl::Substitute(
-        "Source Connector (registry name=$0) not instantiated, error: $1", name, s.ToString());
+    // Register the successfully initialized sources, serially.
+    for (size_t i = 0; i < pending_sources.size(); ++i) {
+      const std::string name(pending_sources[i]->name());
+      Status s = init_statuses[i];
+      if (s.ok()) {
+        s = AddSource(std::move(pending_sources[i]), /* init_source */ false);
+      }
+      monitor_.AppendSourceStatusRecord(name, s, "Init");
+
+      LOG_IF(WARNING, !s.ok()) << absl::Substitute(
+          "Source Connector (registry name=$0) not instantiated, error: $1", name, s.ToString());
+    }
+  } else {
+    for (const auto& [name, create_source_fn, _] : registry_->sources()) {
+      auto source_ptr = create_source_fn(name);
+
+      Status s = AddSource(std::move(source_ptr));
+      monitor_.AppendSourceStatusRecord(name, s, "Init");
+
+      LOG_IF(WARNING, !s.ok()) << absl::Substitute(
+          "Source Connector (registry name=$0) not instantiated, error: $1", name, s.ToString());
+    }
   }
   LOG(INFO) << "Stirling successfully initialized.";
   return Status::OK();
@@ -427,18 +547,32 @@ std::unique_ptr<ConnectorContext> StirlingImpl::GetContext() {
   return std::unique_ptr<ConnectorContext>(new SystemWideStandaloneContext());
 }
 
-Status StirlingImpl::AddSource(std::unique_ptr<SourceConnector> source) {
-  PX_RETURN_IF_ERROR(source->Init());
+Status StirlingImpl::AddSource(std::unique_ptr<SourceConnector> source, bool init_source) {
+  if (init_source) {
+    PX_RETURN_IF_ERROR(source->Init());
+  }
 
   absl::base_internal::SpinLockHolder lock(&info_class_mgrs_lock_);
 
   std::vector<DataTable*> data_tables;
 
+  const absl::flat_hash_set<std::string_view> unsubscribed_tables =
+      absl::StrSplit(FLAGS_stirling_unsubscribed_tables, ",", absl::SkipEmpty());
+
   for (const DataTableSchema& schema : source->table_schemas()) {
     LOG(INFO) << absl::Substitute("Adding info class: [$0/$1]", source->name(), schema.name());
     auto mgr = std::make_unique<InfoClassManager>(schema);
     mgr->SetSourceConnector(source.get());
-    data_tables.push_back(mgr->data_table());
+    if (unsubscribed_tables.contains(schema.name())) {
+      // A nullptr entry tells the source connector not to collect this table.
+      // The InfoClassManager is still created so the table appears in the publish message,
+      // but it will stay empty.
+      LOG(INFO) << absl::Substitute("Table [$0/$1] is unsubscribed; skipping collection.",
+                                    source->name(), schema.name());
+      data_tables.push_back(nullptr);
+    } else {
+      data_tables.push_back(mgr->data_table());
+    }
     info_class_mgrs_.push_back(std::move(mgr));
   }
 
@@ -770,14 +904,34 @@ bool DataExceedsThreshold(const std::vector<DataTable*>& data_tables) {
   return false;
 }
 
+// Returns the total number of records currently buffered across a source's tables.
+size_t TotalOccupancy(const std::vector<DataTable*>& data_tables) {
+  size_t total = 0;
+  for (const auto* data_table : data_tables) {
+    if (data_table != nullptr) {
+      total += data_table->Occupancy();
+    }
+  }
+  return total;
+}
+
 }  // namespace
 
 // Main Data Collector loop.
 // Poll on Data Source Through connectors, when appropriate, then go to sleep.
 // Must run as a thread, so only call from Run() as a thread.
 void StirlingImpl::RunCore() {
+  if (FLAGS_stirling_dispatcher_run_loop) {
+    RunCoreEventDriven();
+    return;
+  }
+
   running_ = true;
 
+  if (FLAGS_stirling_transfer_data_threads > 1) {
+    transfer_data_workers_ = std::make_unique<WorkerPool>(FLAGS_stirling_transfer_data_threads);
+  }
+
   // First initialize each info class manager with context.
   {
     absl::base_internal::SpinLockHolder lock(&info_class_mgrs_lock_);
@@ -825,18 +979,47 @@ void StirlingImpl::RunCore() {
       // Needed to avoid race with main thread update info_class_mgrs_ on new subscription.
       absl::base_internal::SpinLockHolder lock(&info_class_mgrs_lock_);
 
-      // Run through every SourceConnector and InfoClassManager being managed.
-      for (auto& source : sources_) {
-        // Phase 1: Probe each source for its data.
-        if (source->sampling_freq_mgr().Expired(now_plus_run_window)) {
+      // Phase 1: Probe each source for its data.
+      // With multiple transfer threads, expired sources sample in parallel. Each source is
+      // pinned to one worker (hash of the source pointer), so connector-local state (BCC
+      // handles, symbolizer caches) is only ever touched by one thread, and the barrier below
+      // makes the data tables single-threaded again before any data is pushed.
+      std::vector<std::pair<SourceConnector*, size_t>> sampled_sources;
+      for (auto& s : sources_) {
+        SourceConnector* source = s.get();
+        if (!source->sampling_freq_mgr().Expired(now_plus_run_window)) {
+          continue;
+        }
+        sampled_sources.emplace_back(source, TotalOccupancy(source->data_tables()));
+        if (transfer_data_workers_ != nullptr) {
+          transfer_data_workers_->SubmitTo(
+              std::hash<SourceConnector*>{}(source),
+              [source, ctx_ptr = ctx.get()]() { source->TransferData(ctx_ptr); });
+        } else {
           source->TransferData(ctx.get());
+        }
+      }
+      if (!sampled_sources.empty()) {
+        if (transfer_data_workers_ != nullptr) {
+          transfer_data_workers_->Wait();
+        }
 
-          // TransferData() is normally a significant amount of work: update "time now".
-          now = std::chrono::steady_clock::now();
-          source->sampling_freq_mgr().Reset(now);
-          run_core_stats_.IncrementTransferDataCount();
+        // TransferData() is normally a significant amount of work: update "time now".
+        now = std::chrono::steady_clock::now();
+      }
+      for (const auto& [source, occupancy_before] : sampled_sources) {
+        if (FLAGS_stirling_adaptive_sampling) {
+          // TransferData() only appends to the tables, so the occupancy delta is the number
+          // of records this sampling cycle produced.
+          source->sampling_freq_mgr().UpdatePeriod(TotalOccupancy(source->data_tables()) -
+                                                   occupancy_before);
         }
-        // Phase 2: Push Data upstream.
+        source->sampling_freq_mgr().Reset(now);
+        run_core_stats_.IncrementTransferDataCount();
+      }
+
+      // Phase 2: Push Data upstream.
+      for (auto& source : sources_) {
         if (source->push_freq_mgr().Expired(now_plus_run_window) ||
             DataExceedsThreshold(source->data_tables())) {
           source->PushData(data_push_callback_);
@@ -870,6 +1053,173 @@ void StirlingImpl::RunCore() {
       run_core_stats_.EndIter(std::chrono::milliseconds::zero());
     }
   }
+
+  // Joins the worker threads; no TransferData() can be in flight past this point.
+  transfer_data_workers_.reset();
+
+  running_ = false;
+}
+
+// Event-driven variant of the main data collector loop, enabled by
+// FLAGS_stirling_dispatcher_run_loop. Each source connector gets its own dispatcher timer,
+// armed for the earlier of the source's next sampling or push deadline, so wakeups follow
+// each source's own cadence rather than a shared sleep computed across all sources.
+// A reconcile timer refreshes the k8s context and keeps the per-source timers in sync with
+// dynamically added and removed sources.
+void StirlingImpl::RunCoreEventDriven() {
+  running_ = true;
+
+  // First initialize each info class manager with context.
+  {
+    absl::base_internal::SpinLockHolder lock(&info_class_mgrs_lock_);
+    std::unique_ptr<ConnectorContext> initial_context = GetContext();
+    for (const auto& s : sources_) {
+      s->InitContext(initial_context.get());
+    }
+  }
+
+  // Indicates completion of initialization, and start of data collection.
+  LOG(INFO) << "Stirling is running (event-driven run loop).";
+
+  event::RealTimeSystem time_system;
+  event::APIImpl api(&time_system);
+  event::DispatcherUPtr dispatcher = api.AllocateDispatcher("stirling");
+
+  // Same run window as the sleep-and-poll loop: work that is due anywhere in the next
+  // run window is batched into the current wakeup.
+  constexpr auto kRunWindow = std::chrono::milliseconds{1};
+
+  // Worst case, wake each source up every so often, even with no subscribed info classes.
+  constexpr std::chrono::milliseconds kMaxTimerDelay{1000};
+
+  // Matches the k8s context refresh period of the sleep-and-poll loop.
+  constexpr std::chrono::milliseconds kReconcilePeriod{200};
+
+  std::unique_ptr<ConnectorContext> ctx = GetContext();
+
+  // One timer per source. Only touched from the dispatcher thread.
+  absl::flat_hash_map<SourceConnector*, event::TimerUPtr> source_timers;
+
+  // Runs one sampling/push iteration for a single source, then re-arms that source's timer.
+  auto service_source = [&](SourceConnector* source) {
+    if (!run_enable_) {
+      // Do not re-arm: armed timers drain, and the dispatcher run loop exits.
+      return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    auto next_wakeup = now + kMaxTimerDelay;
+    {
+      // Acquire spin lock for one iteration of sampling and pushing data.
+      // Needed to avoid race with main thread update info_class_mgrs_ on new subscription.
+      absl::base_internal::SpinLockHolder lock(&info_class_mgrs_lock_);
+
+      // The source may have been removed between when this timer was armed and now.
+      bool still_active = false;
+      for (const auto& s : sources_) {
+        still_active = still_active || (s.get() == source);
+      }
+      if (!still_active) {
+        return;
+      }
+
+      const auto now_plus_run_window = now + kRunWindow;
+
+      // Phase 1: Probe the source for its data.
+      if (source->sampling_freq_mgr().Expired(now_plus_run_window)) {
+        const size_t occupancy_before = TotalOccupancy(source->data_tables());
+        source->TransferData(ctx.get());
+
+        // TransferData() is normally a significant amount of work: update "time now".
+        now = std::chrono::steady_clock::now();
+        if (FLAGS_stirling_adaptive_sampling) {
+          source->sampling_freq_mgr().UpdatePeriod(TotalOccupancy(source->data_tables()) -
+                                                   occupancy_before);
+        }
+        source->sampling_freq_mgr().Reset(now);
+        run_core_stats_.IncrementTransferDataCount();
+      }
+      // Phase 2: Push Data upstream.
+      if (source->push_freq_mgr().Expired(now_plus_run_window) ||
+          DataExceedsThreshold(source->data_tables())) {
+        source->PushData(data_push_callback_);
+
+        // PushData() is normally a significant amount of work: update "time now".
+        now = std::chrono::steady_clock::now();
+        source->push_freq_mgr().Reset(now);
+        run_core_stats_.IncrementPushDataCount();
+      }
+
+      next_wakeup = std::min(next_wakeup, source->sampling_freq_mgr().next());
+      next_wakeup = std::min(next_wakeup, source->push_freq_mgr().next());
+    }
+
+    auto it = source_timers.find(source);
+    if (it != source_timers.end()) {
+      const auto delay =
+          std::max(std::chrono::duration_cast<std::chrono::milliseconds>(next_wakeup - now),
+                   std::chrono::milliseconds::zero());
+      it->second->EnableTimer(delay);
+      run_core_stats_.EndIter(delay);
+    }
+  };
+
+  // Creates timers for newly added sources, and drops timers for removed ones.
+  auto reconcile_source_timers = [&]() {
+    absl::flat_hash_set<SourceConnector*> active_sources;
+    {
+      absl::base_internal::SpinLockHolder lock(&info_class_mgrs_lock_);
+      for (const auto& source : sources_) {
+        active_sources.insert(source.get());
+      }
+    }
+
+    for (auto it = source_timers.begin(); it != source_timers.end();) {
+      if (active_sources.contains(it->first)) {
+        ++it;
+      } else {
+        source_timers.erase(it++);
+      }
+    }
+
+    for (SourceConnector* source : active_sources) {
+      if (source_timers.contains(source)) {
+        continue;
+      }
+      auto timer =
+          dispatcher->CreateTimer([&service_source, source]() { service_source(source); });
+      // Fire immediately: the new source is due for its first sampling pass.
+      timer->EnableTimer(std::chrono::milliseconds::zero());
+      source_timers[source] = std::move(timer);
+    }
+  };
+
+  // The reconcile timer also refreshes the k8s context, like the sleep-and-poll loop does.
+  event::TimerUPtr reconcile_timer;
+  reconcile_timer = dispatcher->CreateTimer([&]() {
+    if (!run_enable_) {
+      return;
+    }
+    ctx = GetContext();
+    reconcile_source_timers();
+    reconcile_timer->EnableTimer(kReconcilePeriod);
+  });
+
+  reconcile_source_timers();
+  reconcile_timer->EnableTimer(kReconcilePeriod);
+
+  // Publish the dispatcher so that Stop() can break it out of its run loop, then check
+  // run_enable_ once more in case Stop() raced with startup.
+  run_dispatcher_ = dispatcher.get();
+  if (run_enable_) {
+    dispatcher->Run(event::Dispatcher::RunType::Block);
+  }
+  run_dispatcher_ = nullptr;
+
+  // Destroy the timers before the dispatcher they were created on.
+  reconcile_timer.reset();
+  source_timers.clear();
+
   running_ = false;
 }
 
@@ -890,6 +1240,15 @@ Status StirlingImpl::WaitUntilRunning(std::chrono::milliseconds timeout) const {
 
 void StirlingImpl::Stop() {
   run_enable_ = false;
+
+  // If the event-driven run loop is active, break its dispatcher out of the run loop.
+  // Dispatcher::Stop() is safe to call from any thread; armed timers then drain without
+  // re-arming (their callbacks observe run_enable_ == false), and the dispatcher exits.
+  event::Dispatcher* dispatcher = run_dispatcher_.load();
+  if (dispatcher != nullptr) {
+    dispatcher->Stop();
+  }
+
   WaitForStop();
 
   // Stop all sources.
@@ -926,6 +1285,20 @@ void StirlingImpl::DisablePIDTrace(int pid) {
   }
 }
 
+void StirlingImpl::SetProfilerPIDSampling(int pid) {
+  absl::base_internal::SpinLockHolder lock(&info_class_mgrs_lock_);
+  for (auto& s : sources_) {
+    s->SetProfilerPIDSampling(pid);
+  }
+}
+
+void StirlingImpl::SetProfilerSampleDivisor(int divisor) {
+  absl::base_internal::SpinLockHolder lock(&info_class_mgrs_lock_);
+  for (auto& s : sources_) {
+    s->SetProfilerSampleDivisor(divisor);
+  }
+}
+
 void StirlingImpl::UpdateDynamicTraceStatus(const sole::uuid& trace_id,
                                             const StatusOr<stirlingpb::Publish>& s) {
   absl::base_internal::SpinLockHolder lock(&dynamic_trace_status_map_lock_);
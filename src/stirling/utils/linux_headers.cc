@@ -31,6 +31,7 @@
 
 #include <absl/strings/numbers.h>
 #include <absl/strings/str_replace.h>
+#include <absl/synchronization/mutex.h>
 
 #include "src/common/base/file.h"
 #include "src/common/fs/fs_wrapper.h"
@@ -649,7 +650,9 @@ Status InstallPackagedLinuxHeaders(const std::filesystem::path& lib_modules_dir)
   return Status::OK();
 }
 
-StatusOr<std::filesystem::path> FindOrInstallLinuxHeaders() {
+namespace {
+
+StatusOr<std::filesystem::path> FindOrInstallLinuxHeadersImpl() {
   PX_ASSIGN_OR_RETURN(std::string uname, GetUname());
   LOG(INFO) << absl::Substitute("Detected kernel release (uname -r): $0", uname);
 
@@ -696,6 +699,25 @@ StatusOr<std::filesystem::path> FindOrInstallLinuxHeaders() {
   return error::Internal("Could not find any linux headers to use.");
 }
 
+}  // namespace
+
+StatusOr<std::filesystem::path> FindOrInstallLinuxHeaders() {
+  // Every BPF source connector re-enters this on startup, and the headers location cannot change
+  // within the lifetime of the process. Resolve once and reuse the result thereafter, so only the
+  // first caller pays for the discovery (and potential installation) work.
+  static absl::Mutex mu(absl::kConstInit);
+  static std::filesystem::path* cached_headers_dir = nullptr;
+
+  absl::MutexLock lock(&mu);
+  if (cached_headers_dir != nullptr) {
+    return *cached_headers_dir;
+  }
+
+  PX_ASSIGN_OR_RETURN(std::filesystem::path headers_dir, FindOrInstallLinuxHeadersImpl());
+  cached_headers_dir = new std::filesystem::path(headers_dir);
+  return headers_dir;
+}
+
 }  // namespace utils
 }  // namespace stirling
 }  // namespace px
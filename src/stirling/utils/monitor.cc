@@ -70,8 +70,31 @@ void StirlingMonitor::AppendProbeStatusRecord(const std::string& source_connecto
                                               const std::string& tracepoint, const Status& status,
                                               const std::string& info) {
   absl::base_internal::SpinLockHolder lock(&probe_status_lock_);
-  probe_status_records_.push_back(
-      {CurrentTimeNS(), source_connector, tracepoint, status.code(), status.msg(), info});
+
+  if (probe_status_occurrences_.size() >= kMaxProbeStatusKeys) {
+    probe_status_occurrences_.clear();
+  }
+
+  // Deduplicate repeated identical records with exponential rate limiting: the Nth occurrence of
+  // a (probe, error) pair is recorded only when N is a power of two. A probe that keeps failing
+  // on a hot binary thus costs O(log N) table records instead of flooding the table, while the
+  // occurrence count in `info` preserves the storm's magnitude.
+  uint64_t& occurrences = probe_status_occurrences_[{source_connector, tracepoint,
+                                                     static_cast<int>(status.code()), status.msg()}];
+  ++occurrences;
+  if ((occurrences & (occurrences - 1)) != 0) {
+    return;
+  }
+
+  std::string record_info =
+      (occurrences == 1) ? info : absl::Substitute(R"({"occurrence_count":$0})", occurrences);
+  probe_status_records_.push_back({CurrentTimeNS(), source_connector, tracepoint, status.code(),
+                                   status.msg(), std::move(record_info)});
+}
+
+void StirlingMonitor::ResetProbeStatusDedupState() {
+  absl::base_internal::SpinLockHolder lock(&probe_status_lock_);
+  probe_status_occurrences_.clear();
 }
 
 std::vector<SourceStatusRecord> StirlingMonitor::ConsumeSourceStatusRecords() {
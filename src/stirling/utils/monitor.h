@@ -22,6 +22,7 @@
 
 #include <absl/container/flat_hash_map.h>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -70,8 +71,16 @@ class StirlingMonitor : NotCopyMoveable {
   std::vector<ProbeStatusRecord> ConsumeProbeStatusRecords();
   std::vector<SourceStatusRecord> ConsumeSourceStatusRecords();
 
+  // Forgets the probe status deduplication state, so identical errors report afresh.
+  // Intended for tests.
+  void ResetProbeStatusDedupState();
+
   static constexpr auto kCrashWindow = std::chrono::seconds{5};
 
+  // Cap on the number of distinct probe status keys tracked for deduplication. Beyond this, the
+  // state is reset, trading some duplicate records for bounded memory.
+  static constexpr size_t kMaxProbeStatusKeys = 1024;
+
  private:
   StirlingMonitor();
   using timestamp_t = std::chrono::time_point<std::chrono::steady_clock>;
@@ -79,6 +88,13 @@ class StirlingMonitor : NotCopyMoveable {
 
   // Records of probe deployment status.
   std::vector<ProbeStatusRecord> probe_status_records_ ABSL_GUARDED_BY(probe_status_lock_);
+
+  // Occurrence counts of probe status records, keyed by (source connector, tracepoint, status
+  // code, error). Used to deduplicate repeated identical errors with exponential rate limiting,
+  // so error storms cost O(distinct errors) table records instead of O(events).
+  using ProbeStatusKey = std::tuple<std::string, std::string, int, std::string>;
+  absl::flat_hash_map<ProbeStatusKey, uint64_t> probe_status_occurrences_
+      ABSL_GUARDED_BY(probe_status_lock_);
   // Records of Stirling Source Connector status.
   std::vector<SourceStatusRecord> source_status_records_ ABSL_GUARDED_BY(source_status_lock_);
 
@@ -66,5 +66,35 @@ TEST(MonitorTest, DoesNotDisableJavaIfNotInCrashInWindow) {
   EXPECT_TRUE(FLAGS_stirling_profiler_java_symbols);
 }
 
+TEST(MonitorTest, ProbeStatusRecordsDeduplicated) {
+  StirlingMonitor& monitor = *StirlingMonitor::GetInstance();
+  monitor.ResetProbeStatusDedupState();
+  monitor.ConsumeProbeStatusRecords();
+
+  const Status error = error::Internal("Failed to attach uprobe.");
+
+  // 100 identical errors should produce O(log N) records: occurrences 1, 2, 4, 8, ..., 64.
+  for (int i = 0; i < 100; ++i) {
+    monitor.AppendProbeStatusRecord("socket_tracer", "probe_entry_foo", error, R"({"pid":1})");
+  }
+  std::vector<ProbeStatusRecord> records = monitor.ConsumeProbeStatusRecords();
+  ASSERT_EQ(records.size(), 7);
+  EXPECT_EQ(records[0].info, R"({"pid":1})");
+  EXPECT_EQ(records[1].info, R"({"occurrence_count":2})");
+  EXPECT_EQ(records[6].info, R"({"occurrence_count":64})");
+  for (const auto& r : records) {
+    EXPECT_EQ(r.tracepoint, "probe_entry_foo");
+    EXPECT_EQ(r.error, "Failed to attach uprobe.");
+  }
+
+  // A different (probe, error) pair is recorded independently.
+  monitor.AppendProbeStatusRecord("socket_tracer", "probe_entry_bar", error, "");
+  records = monitor.ConsumeProbeStatusRecords();
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].tracepoint, "probe_entry_bar");
+
+  monitor.ResetProbeStatusDedupState();
+}
+
 }  // namespace stirling
 }  // namespace px
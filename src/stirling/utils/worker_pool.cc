@@ -0,0 +1,90 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/stirling/utils/worker_pool.h"
+
+#include <utility>
+
+namespace px {
+namespace stirling {
+
+WorkerPool::WorkerPool(size_t num_workers) {
+  DCHECK_GT(num_workers, 0U);
+  workers_.reserve(num_workers);
+  for (size_t i = 0; i < num_workers; ++i) {
+    auto worker = std::make_unique<Worker>();
+    worker->thread = std::thread(&WorkerPool::WorkerLoop, this, worker.get());
+    workers_.push_back(std::move(worker));
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  for (auto& worker : workers_) {
+    {
+      std::lock_guard<std::mutex> lock(worker->mu);
+      worker->stop = true;
+    }
+    worker->cv.notify_one();
+  }
+  for (auto& worker : workers_) {
+    worker->thread.join();
+  }
+}
+
+void WorkerPool::SubmitTo(size_t worker_idx, std::function<void()> task) {
+  Worker* worker = workers_[worker_idx % workers_.size()].get();
+  {
+    std::lock_guard<std::mutex> lock(outstanding_mu_);
+    ++num_outstanding_;
+  }
+  {
+    std::lock_guard<std::mutex> lock(worker->mu);
+    worker->tasks.push_back(std::move(task));
+  }
+  worker->cv.notify_one();
+}
+
+void WorkerPool::Wait() {
+  std::unique_lock<std::mutex> lock(outstanding_mu_);
+  outstanding_cv_.wait(lock, [this] { return num_outstanding_ == 0; });
+}
+
+void WorkerPool::WorkerLoop(Worker* worker) {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(worker->mu);
+      worker->cv.wait(lock, [worker] { return worker->stop || !worker->tasks.empty(); });
+      if (worker->tasks.empty()) {
+        // Stop requested and queue drained.
+        return;
+      }
+      task = std::move(worker->tasks.front());
+      worker->tasks.pop_front();
+    }
+    task();
+    {
+      std::lock_guard<std::mutex> lock(outstanding_mu_);
+      --num_outstanding_;
+    }
+    outstanding_cv_.notify_all();
+  }
+}
+
+}  // namespace stirling
+}  // namespace px
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "src/common/base/base.h"
+
+namespace px {
+namespace stirling {
+
+/**
+ * A small fixed-size pool of worker threads with one task queue per worker.
+ *
+ * Tasks are submitted to an explicit worker index, giving callers stable thread affinity:
+ * tasks submitted to the same worker always run on the same thread, in submission order.
+ * This lets source connectors with thread-affine state (BCC handles, symbolizer caches)
+ * run in parallel with each other, while each connector still only ever sees one thread.
+ */
+class WorkerPool : public NotCopyMoveable {
+ public:
+  explicit WorkerPool(size_t num_workers);
+
+  // Drains all queued tasks, then joins the worker threads.
+  ~WorkerPool();
+
+  size_t num_workers() const { return workers_.size(); }
+
+  // Enqueues a task on the worker at worker_idx (taken modulo num_workers()).
+  // Tasks on the same worker run serially, in submission order.
+  void SubmitTo(size_t worker_idx, std::function<void()> task);
+
+  // Blocks until every task submitted so far has finished running.
+  void Wait();
+
+ private:
+  struct Worker {
+    std::mutex mu;
+    std::condition_variable cv;
+    std::deque<std::function<void()>> tasks;
+    bool stop = false;
+    std::thread thread;
+  };
+
+  void WorkerLoop(Worker* worker);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+
+  // Count of submitted-but-unfinished tasks across all workers, for Wait().
+  std::mutex outstanding_mu_;
+  std::condition_variable outstanding_cv_;
+  size_t num_outstanding_ = 0;
+};
+
+}  // namespace stirling
+}  // namespace px
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/stirling/utils/worker_pool.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace stirling {
+
+TEST(WorkerPoolTest, WaitDrainsAllSubmittedTasks) {
+  WorkerPool pool(4);
+  std::atomic<int> counter = 0;
+
+  constexpr int kNumTasks = 100;
+  for (int i = 0; i < kNumTasks; ++i) {
+    pool.SubmitTo(i, [&counter]() { ++counter; });
+  }
+  pool.Wait();
+
+  EXPECT_EQ(counter, kNumTasks);
+}
+
+TEST(WorkerPoolTest, SameWorkerTasksRunOnSameThreadInOrder) {
+  WorkerPool pool(2);
+
+  std::vector<std::thread::id> thread_ids;
+  std::vector<int> order;
+
+  constexpr int kNumTasks = 10;
+  for (int i = 0; i < kNumTasks; ++i) {
+    pool.SubmitTo(/* worker_idx */ 0, [&thread_ids, &order, i]() {
+      // Safe without a lock: all tasks on one worker run serially.
+      thread_ids.push_back(std::this_thread::get_id());
+      order.push_back(i);
+    });
+  }
+  pool.Wait();
+
+  ASSERT_EQ(thread_ids.size(), kNumTasks);
+  for (const auto& tid : thread_ids) {
+    EXPECT_EQ(tid, thread_ids.front());
+  }
+  for (int i = 0; i < kNumTasks; ++i) {
+    EXPECT_EQ(order[i], i);
+  }
+}
+
+TEST(WorkerPoolTest, DifferentWorkersRunConcurrently) {
+  WorkerPool pool(2);
+
+  // The task on worker 0 only finishes once the task on worker 1 has started,
+  // which requires the two workers to run concurrently.
+  std::atomic<bool> unblocked = false;
+
+  pool.SubmitTo(0, [&unblocked]() {
+    while (!unblocked) {
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+  });
+  pool.SubmitTo(1, [&unblocked]() { unblocked = true; });
+
+  pool.Wait();
+  EXPECT_TRUE(unblocked);
+}
+
+}  // namespace stirling
+}  // namespace px
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#include <arrow/array.h>
+
+#include "src/common/base/base.h"
+
+namespace px {
+namespace table_store {
+namespace schema {
+
+/**
+ * RollingColumnSizeStats tracks a rolling average of bytes per row for each column of a relation,
+ * so that arrow builders assembling future batches can preallocate their variable-length data
+ * buffers in one shot instead of growing by doubling and re-copying string data mid-batch. It is
+ * shared between table store batch assembly and the exec nodes that build output batches row by
+ * row (e.g. ordered unions and joins).
+ *
+ * Only variable-width (string) columns need tracking; fixed-width columns are fully sized by the
+ * row count alone.
+ */
+class RollingColumnSizeStats {
+ public:
+  RollingColumnSizeStats() = default;
+  explicit RollingColumnSizeStats(size_t num_columns) { Init(num_columns); }
+
+  void Init(size_t num_columns) { avg_bytes_per_row_.assign(num_columns, 0.0); }
+
+  /**
+   * Folds the observed bytes-per-row of a string column batch into the rolling average. Arrays of
+   * other types and empty arrays are ignored.
+   */
+  void UpdateStringColumn(size_t col_idx, const arrow::Array& arr) {
+    if (arr.type_id() != arrow::Type::STRING || arr.length() == 0) {
+      return;
+    }
+    DCHECK_LT(col_idx, avg_bytes_per_row_.size());
+    const auto& str_arr = static_cast<const arrow::StringArray&>(arr);
+    const double bytes_per_row =
+        static_cast<double>(str_arr.value_offset(arr.length()) - str_arr.value_offset(0)) /
+        static_cast<double>(arr.length());
+    double& avg = avg_bytes_per_row_[col_idx];
+    avg = (avg == 0.0) ? bytes_per_row : (1.0 - kAlpha) * avg + kAlpha * bytes_per_row;
+  }
+
+  /**
+   * Bytes to preallocate for a string column builder expecting num_rows rows. Includes headroom so
+   * a batch slightly larger than the rolling average still appends single-copy. Returns 0 until
+   * the column has history, in which case the builder falls back to growth on demand.
+   */
+  int64_t ReservationHintBytes(size_t col_idx, int64_t num_rows) const {
+    DCHECK_LT(col_idx, avg_bytes_per_row_.size());
+    return std::llrint(kHeadroomFactor * avg_bytes_per_row_[col_idx] *
+                       static_cast<double>(num_rows));
+  }
+
+ private:
+  // Weight of the most recent batch in the rolling average.
+  static constexpr double kAlpha = 0.25;
+  static constexpr double kHeadroomFactor = 1.25;
+
+  std::vector<double> avg_bytes_per_row_;
+};
+
+}  // namespace schema
+}  // namespace table_store
+}  // namespace px
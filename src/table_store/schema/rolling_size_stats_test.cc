@@ -0,0 +1,78 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <vector>
+
+#include "src/common/testing/testing.h"
+#include "src/shared/types/arrow_adapter.h"
+#include "src/table_store/schema/rolling_size_stats.h"
+
+namespace px {
+namespace table_store {
+namespace schema {
+
+TEST(RollingColumnSizeStatsTest, NoHistoryMeansNoReservation) {
+  RollingColumnSizeStats stats(2);
+  EXPECT_EQ(0, stats.ReservationHintBytes(0, 1024));
+  EXPECT_EQ(0, stats.ReservationHintBytes(1, 1024));
+}
+
+TEST(RollingColumnSizeStatsTest, TracksBytesPerRowWithHeadroom) {
+  RollingColumnSizeStats stats(1);
+  // 4 rows x 8 bytes each.
+  std::vector<types::StringValue> values = {"aaaaaaaa", "bbbbbbbb", "cccccccc", "dddddddd"};
+  auto arr = types::ToArrow(values, arrow::default_memory_pool());
+  stats.UpdateStringColumn(0, *arr);
+
+  // 8 bytes/row * 100 rows * 1.25 headroom.
+  EXPECT_EQ(1000, stats.ReservationHintBytes(0, 100));
+}
+
+TEST(RollingColumnSizeStatsTest, IgnoresNonStringAndEmptyArrays) {
+  RollingColumnSizeStats stats(1);
+  std::vector<types::Int64Value> ints = {1, 2, 3};
+  auto int_arr = types::ToArrow(ints, arrow::default_memory_pool());
+  stats.UpdateStringColumn(0, *int_arr);
+
+  std::vector<types::StringValue> empty;
+  auto empty_arr = types::ToArrow(empty, arrow::default_memory_pool());
+  stats.UpdateStringColumn(0, *empty_arr);
+
+  EXPECT_EQ(0, stats.ReservationHintBytes(0, 100));
+}
+
+TEST(RollingColumnSizeStatsTest, RollingAverageFollowsRecentBatches) {
+  RollingColumnSizeStats stats(1);
+  std::vector<types::StringValue> small = {"aa", "bb"};
+  auto small_arr = types::ToArrow(small, arrow::default_memory_pool());
+  stats.UpdateStringColumn(0, *small_arr);
+  auto hint_after_small = stats.ReservationHintBytes(0, 100);
+
+  std::vector<types::StringValue> large = {"aaaaaaaaaaaaaaaa", "bbbbbbbbbbbbbbbb"};
+  auto large_arr = types::ToArrow(large, arrow::default_memory_pool());
+  stats.UpdateStringColumn(0, *large_arr);
+  auto hint_after_large = stats.ReservationHintBytes(0, 100);
+
+  // The average moves toward the larger recent batch but doesn't jump all the way there.
+  EXPECT_GT(hint_after_large, hint_after_small);
+  EXPECT_LT(hint_after_large, std::llrint(1.25 * 16 * 100));
+}
+
+}  // namespace schema
+}  // namespace table_store
+}  // namespace px
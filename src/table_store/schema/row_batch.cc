@@ -126,6 +126,37 @@ void CopyIntoOutputPB(table_store::schemapb::Column* output_column, arrow::Array
 
   size_t col_length = input_column->length();
   auto casted_output_data = GetMutablePBDataColumn<T>(output_column);
+  if constexpr (T == DataType::INT64 || T == DataType::TIME64NS || T == DataType::FLOAT64) {
+    // Fixed-width columns are stored contiguously by arrow, so copy the value buffer into the
+    // repeated field in one shot instead of appending element-by-element.
+    using arrow_array_type = typename types::DataTypeTraits<T>::arrow_array_type;
+    const auto* raw = static_cast<const arrow_array_type*>(input_column)->raw_values();
+    casted_output_data->mutable_data()->Add(raw, raw + col_length);
+    return;
+  }
+  if constexpr (T == DataType::STRING) {
+    // Assign each string straight from its view into the arrow buffer; going through
+    // GetValueFromArrowArray would materialize a temporary std::string per row.
+    casted_output_data->mutable_data()->Reserve(col_length);
+    for (size_t i = 0; i < col_length; ++i) {
+      auto view = types::GetStringViewFromArrowArray(input_column, i);
+      casted_output_data->add_data()->assign(view.data(), view.size());
+    }
+    return;
+  }
+  if constexpr (T == DataType::BOOLEAN) {
+    // Bools are bit-packed by arrow; unpack them into the reserved repeated field directly.
+    const auto* bool_array = static_cast<const arrow::BooleanArray*>(input_column);
+    auto* out = casted_output_data->mutable_data();
+    out->Reserve(col_length);
+    for (size_t i = 0; i < col_length; ++i) {
+      out->Add(bool_array->Value(i));
+    }
+    return;
+  }
+  if constexpr (T == DataType::UINT128) {
+    casted_output_data->mutable_data()->Reserve(col_length);
+  }
   for (size_t i = 0; i < col_length; ++i) {
     if constexpr (T == DataType::UINT128) {
       auto out_datum = casted_output_data->add_data();
@@ -147,6 +178,27 @@ Status CopyFromInputPB(std::shared_ptr<arrow::Array>* output_column,
   auto input_data = GetPBDataColumn<T>(input_column);
   PX_RETURN_IF_ERROR(builder->Reserve(input_data.data_size()));
 
+  if constexpr (T == DataType::INT64 || T == DataType::TIME64NS || T == DataType::FLOAT64) {
+    // The repeated field is contiguous for fixed-width types, so append it as one block.
+    using arrow_builder_type =
+        typename types::ValueTypeTraits<typename types::DataTypeTraits<T>::value_type>::
+            arrow_builder_type;
+    auto* casted_builder = static_cast<arrow_builder_type*>(builder.get());
+    PX_RETURN_IF_ERROR(
+        casted_builder->AppendValues(input_data.data().data(), input_data.data_size()));
+    PX_RETURN_IF_ERROR(builder->Finish(output_column));
+    return Status::OK();
+  }
+
+  if constexpr (T == DataType::STRING) {
+    // Pre-size the character buffer so the builder doesn't re-grow it while appending.
+    size_t total_bytes = 0;
+    for (const auto& datum : input_data.data()) {
+      total_bytes += datum.size();
+    }
+    PX_RETURN_IF_ERROR(static_cast<arrow::StringBuilder*>(builder.get())->ReserveData(total_bytes));
+  }
+
   for (const auto& datum : input_data.data()) {
     if constexpr (T == DataType::UINT128) {
       PX_RETURN_IF_ERROR(CopyValue<T>(builder.get(), types::UInt128Value(datum).val));
@@ -259,8 +311,14 @@ StatusOr<std::unique_ptr<RowBatch>> RowBatch::Slice(int64_t offset, int64_t leng
   }
   std::unique_ptr<RowBatch> output_rb = std::make_unique<RowBatch>(desc(), length);
   for (int64_t input_col_idx = 0; input_col_idx < num_columns(); ++input_col_idx) {
-    auto col = ColumnAt(input_col_idx);
-    PX_RETURN_IF_ERROR(output_rb->AddColumn(col->Slice(offset, length)));
+    const auto& col = ColumnAt(input_col_idx);
+    // Share the refcounted array directly when the slice spans all rows; arrow arrays are
+    // immutable so no defensive copy is needed.
+    if (offset == 0 && length == num_rows()) {
+      PX_RETURN_IF_ERROR(output_rb->AddColumn(col));
+    } else {
+      PX_RETURN_IF_ERROR(output_rb->AddColumn(col->Slice(offset, length)));
+    }
   }
   return output_rb;
 }
@@ -36,6 +36,9 @@ namespace schema {
 /**
  * A RowBatch is a table-like structure which consists of equal-length arrays
  * that match the schema described by the RowDescriptor.
+ *
+ * Columns are stored as refcounted, immutable arrow arrays: adding a column, slicing a row batch,
+ * or reading one back out never copies the underlying column data, only the array wrappers.
  */
 class RowBatch {
  public:
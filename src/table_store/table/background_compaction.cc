@@ -0,0 +1,81 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/table_store/table/background_compaction.h"
+
+#include <sys/resource.h>
+
+#include <utility>
+
+#include "src/common/base/base.h"
+
+namespace px {
+namespace table_store {
+
+namespace {
+// Nice value for the compaction thread; compaction should always yield to query execution and
+// data collection threads.
+constexpr int kCompactionThreadNiceValue = 19;
+}  // namespace
+
+BackgroundCompactionManager::BackgroundCompactionManager(TableStore* table_store,
+                                                         arrow::MemoryPool* mem_pool,
+                                                         std::chrono::milliseconds tick_period,
+                                                         int64_t batches_per_tick)
+    : table_store_(table_store),
+      mem_pool_(mem_pool),
+      tick_period_(tick_period),
+      batches_per_tick_(batches_per_tick) {
+  thread_ = std::thread(&BackgroundCompactionManager::RunLoop, this);
+}
+
+BackgroundCompactionManager::~BackgroundCompactionManager() { Stop(); }
+
+void BackgroundCompactionManager::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(stop_mu_);
+    stop_ = true;
+  }
+  stop_cv_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void BackgroundCompactionManager::RunLoop() {
+  // Lower the thread priority so compaction only consumes otherwise-idle CPU. Failure is
+  // non-fatal; compaction still runs, just without the priority hint.
+  if (setpriority(PRIO_PROCESS, 0, kCompactionThreadNiceValue) != 0) {
+    LOG(WARNING) << "Failed to lower priority of the table compaction thread.";
+  }
+  std::unique_lock<std::mutex> lock(stop_mu_);
+  while (!stop_) {
+    lock.unlock();
+    // Snapshot the tables so compaction doesn't hold any reference to TableStore internals while
+    // doing work. Each table gets at most one bounded compaction slice per tick.
+    for (const auto& table : table_store_->GetTables()) {
+      auto s = table->CompactHotToCold(mem_pool_, batches_per_tick_);
+      LOG_IF(ERROR, !s.ok()) << "Background compaction failed: " << s.msg();
+    }
+    lock.lock();
+    stop_cv_.wait_for(lock, tick_period_, [this]() { return stop_; });
+  }
+}
+
+}  // namespace table_store
+}  // namespace px
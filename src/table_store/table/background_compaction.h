@@ -0,0 +1,79 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <arrow/memory_pool.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "src/table_store/table/table_store.h"
+
+namespace px {
+namespace table_store {
+
+/**
+ * BackgroundCompactionManager runs table store compaction incrementally on a dedicated
+ * low-priority thread, instead of compacting all ready batches synchronously from the caller's
+ * thread. Each tick compacts at most `batches_per_tick` cold batches per table, and Table's
+ * per-batch locking means queries and writes only ever wait for a single batch's compaction, not
+ * a full pass.
+ *
+ * The manager snapshots the table list on every tick, so tables registered at runtime (e.g. by
+ * dynamic tracepoint deployment) are picked up on the next tick; TableStore itself is
+ * thread-safe.
+ */
+class BackgroundCompactionManager {
+ public:
+  static constexpr std::chrono::milliseconds kDefaultTickPeriod = std::chrono::milliseconds{5000};
+  static constexpr int64_t kDefaultBatchesPerTick = 1;
+
+  BackgroundCompactionManager(TableStore* table_store, arrow::MemoryPool* mem_pool)
+      : BackgroundCompactionManager(table_store, mem_pool, kDefaultTickPeriod,
+                                    kDefaultBatchesPerTick) {}
+
+  BackgroundCompactionManager(TableStore* table_store, arrow::MemoryPool* mem_pool,
+                              std::chrono::milliseconds tick_period, int64_t batches_per_tick);
+  ~BackgroundCompactionManager();
+
+  /**
+   * Stop signals the compaction thread to exit and joins it. Safe to call multiple times.
+   */
+  void Stop();
+
+ private:
+  void RunLoop();
+
+  TableStore* const table_store_;
+  arrow::MemoryPool* const mem_pool_;
+  const std::chrono::milliseconds tick_period_;
+  const int64_t batches_per_tick_;
+
+  std::mutex stop_mu_;
+  std::condition_variable stop_cv_;
+  bool stop_ = false;
+  std::thread thread_;
+};
+
+}  // namespace table_store
+}  // namespace px
@@ -19,16 +19,18 @@
 
 #include "src/table_store/table/internal/arrow_array_compactor.h"
 #include "src/table_store/table/internal/record_or_row_batch.h"
+#include "src/table_store/table/internal/string_dictionary.h"
 
 namespace px {
 namespace table_store {
 namespace internal {
 
 ArrowArrayCompactor::ArrowArrayCompactor(const schema::Relation& rel, arrow::MemoryPool* mem_pool)
-    : rel_(rel) {
+    : rel_(rel), mem_pool_(mem_pool) {
   for (const auto& type : rel_.col_types()) {
     builders_.push_back(types::MakeTypeErasedArrowBuilder(type, mem_pool));
   }
+  dictionaries_.resize(builders_.size());
 }
 
 Status ArrowArrayCompactor::Reserve(size_t num_rows,
@@ -55,6 +57,14 @@ StatusOr<std::vector<ArrowArrayPtr>> ArrowArrayCompactor::Finish() {
   for (const auto& [col_idx, builder] : Enumerate(builders_)) {
     out_columns.emplace_back();
     PX_RETURN_IF_ERROR(builder->Finish(&out_columns.back()));
+    if (FLAGS_table_store_dictionary_encode_strings &&
+        rel_.col_types()[col_idx] == types::DataType::STRING) {
+      // Repetitive string columns are stored dictionary encoded in cold, against a per-column
+      // dictionary shared across compactions; reads materialize only the rows they touch (see
+      // MaterializeDictionarySlice).
+      PX_ASSIGN_OR_RETURN(out_columns.back(),
+                          dictionaries_[col_idx].Encode(out_columns.back(), mem_pool_));
+    }
   }
   return out_columns;
 }
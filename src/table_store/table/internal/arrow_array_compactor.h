@@ -24,6 +24,7 @@
 
 #include "src/table_store/schema/relation.h"
 #include "src/table_store/table/internal/record_or_row_batch.h"
+#include "src/table_store/table/internal/string_dictionary.h"
 #include "src/table_store/table/internal/types.h"
 
 namespace px {
@@ -77,7 +78,11 @@ class ArrowArrayCompactor {
 
  private:
   const schema::Relation& rel_;
+  arrow::MemoryPool* mem_pool_;
   std::vector<std::unique_ptr<types::TypeErasedArrowBuilder>> builders_;
+  // Per-column dictionaries shared across compactions, so string values that repeat from batch
+  // to batch are stored once. Only the entries for STRING columns are used.
+  std::vector<SharedStringDictionary> dictionaries_;
 };
 
 }  // namespace internal
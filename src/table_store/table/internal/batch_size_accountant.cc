@@ -15,8 +15,8 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <algorithm>
 #include <memory>
-#include <numeric>
 #include <utility>
 
 #include "src/table_store/table/internal/batch_size_accountant.h"
@@ -66,10 +66,25 @@ BatchSizeAccountant::BatchStats BatchSizeAccountant::CalcBatchStats(
   stats.num_rows = batch.Length();
   stats.bytes = non_mutable_state.per_row_fixed_size * stats.num_rows;
 
+  // Fixed width only relations need no per-row work at all: every row has the same size, known
+  // from the relation's types at accountant creation time.
+  if (non_mutable_state.variable_cols_indices.empty()) {
+    return stats;
+  }
+
+  stats.row_bytes_prefix_sum.resize(stats.num_rows + 1);
+  for (uint64_t i = 0; i <= stats.num_rows; ++i) {
+    stats.row_bytes_prefix_sum[i] = non_mutable_state.per_row_fixed_size * i;
+  }
   for (auto col_idx : non_mutable_state.variable_cols_indices) {
     auto rows_bytes = batch.GetVariableSizedColumnRowBytes(col_idx);
-    stats.bytes += std::accumulate(rows_bytes.begin(), rows_bytes.end(), 0ULL);
-    stats.variable_cols_row_bytes.emplace(col_idx, std::move(rows_bytes));
+    std::vector<uint64_t> col_prefix(stats.num_rows + 1, 0);
+    for (uint64_t i = 0; i < stats.num_rows; ++i) {
+      col_prefix[i + 1] = col_prefix[i] + rows_bytes[i];
+      stats.row_bytes_prefix_sum[i + 1] += col_prefix[i + 1];
+    }
+    stats.bytes += col_prefix[stats.num_rows];
+    stats.variable_cols_prefix_bytes.emplace(col_idx, std::move(col_prefix));
   }
   return stats;
 }
@@ -94,36 +109,54 @@ void BatchSizeAccountant::NewHotBatch(const BatchStats& batch_stats) {
   DCHECK(batch_stats.bytes > 0) << "BatchSizeAccountant does not support 0-sized batches.";
   hot_bytes_ += batch_stats.bytes;
 
-  CompactedBatchSpec::HotSlice curr_hot_slice = {};
-  curr_hot_slice.variable_col_bytes = std::vector<uint64_t>(non_mutable_state_.num_cols, 0);
+  // Place each compacted batch boundary directly, instead of walking the batch row by row. For
+  // fixed width only relations the number of rows needed to fill the current compacted batch is
+  // simple arithmetic; otherwise it's a binary search over the prefix sums computed (outside the
+  // hot lock) by CalcBatchStats. A boundary falls immediately after the row that pushes the
+  // compacted batch to at least `compacted_size` bytes, matching the previous per-row behavior.
+  const auto& prefix = batch_stats.row_bytes_prefix_sum;
+  const bool fixed_width_only = non_mutable_state_.variable_cols_indices.empty();
+  uint64_t row_idx = 0;
+  while (row_idx < batch_stats.num_rows) {
+    DCHECK(compacted_spec->bytes < non_mutable_state_.compacted_size);
+    const uint64_t remaining = non_mutable_state_.compacted_size - compacted_spec->bytes;
+
+    uint64_t end_row;
+    if (fixed_width_only) {
+      const uint64_t rows_needed = (remaining + non_mutable_state_.per_row_fixed_size - 1) /
+                                   non_mutable_state_.per_row_fixed_size;
+      end_row = std::min<uint64_t>(batch_stats.num_rows, row_idx + rows_needed);
+    } else {
+      const uint64_t target = prefix[row_idx] + remaining;
+      end_row = std::lower_bound(prefix.begin() + row_idx + 1, prefix.end(), target) -
+                prefix.begin();
+      end_row = std::min<uint64_t>(batch_stats.num_rows, end_row);
+    }
 
-  for (uint64_t row_idx = 0; row_idx < batch_stats.num_rows; ++row_idx) {
-    uint64_t row_bytes = non_mutable_state_.per_row_fixed_size;
-    for (int64_t col_idx : non_mutable_state_.variable_cols_indices) {
-      auto datum_variable_bytes = batch_stats.variable_cols_row_bytes.at(col_idx)[row_idx];
-      row_bytes += datum_variable_bytes;
-      compacted_spec->variable_col_bytes[col_idx] += datum_variable_bytes;
-      curr_hot_slice.variable_col_bytes[col_idx] += datum_variable_bytes;
+    CompactedBatchSpec::HotSlice hot_slice = {};
+    hot_slice.start_row = row_idx;
+    hot_slice.end_row = end_row;
+    hot_slice.last_slice_for_batch = (end_row == batch_stats.num_rows);
+    hot_slice.variable_col_bytes = std::vector<uint64_t>(non_mutable_state_.num_cols, 0);
+    if (fixed_width_only) {
+      hot_slice.bytes = (end_row - row_idx) * non_mutable_state_.per_row_fixed_size;
+    } else {
+      hot_slice.bytes = prefix[end_row] - prefix[row_idx];
+      for (int64_t col_idx : non_mutable_state_.variable_cols_indices) {
+        const auto& col_prefix = batch_stats.variable_cols_prefix_bytes.at(col_idx);
+        const uint64_t col_bytes = col_prefix[end_row] - col_prefix[row_idx];
+        hot_slice.variable_col_bytes[col_idx] = col_bytes;
+        compacted_spec->variable_col_bytes[col_idx] += col_bytes;
+      }
     }
-    curr_hot_slice.end_row++;
-    compacted_spec->num_rows++;
-    compacted_spec->bytes += row_bytes;
-    curr_hot_slice.bytes += row_bytes;
+    compacted_spec->num_rows += end_row - row_idx;
+    compacted_spec->bytes += hot_slice.bytes;
+    compacted_spec->hot_slices.push_back(std::move(hot_slice));
+
     if (compacted_spec->bytes >= non_mutable_state_.compacted_size) {
-      curr_hot_slice.last_slice_for_batch = (row_idx == batch_stats.num_rows - 1);
-      compacted_spec->hot_slices.push_back(std::move(curr_hot_slice));
-      curr_hot_slice = CompactedBatchSpec::HotSlice{};
-      curr_hot_slice.start_row = row_idx + 1;
-      curr_hot_slice.end_row = row_idx + 1;
-      curr_hot_slice.variable_col_bytes = std::vector<uint64_t>(non_mutable_state_.num_cols, 0);
       compacted_spec = NewCompactedBatchSpec();
     }
-  }
-
-  // If we added any rows to the current hot slice, push it to the compacted spec.
-  if (curr_hot_slice.start_row != curr_hot_slice.end_row) {
-    curr_hot_slice.last_slice_for_batch = true;
-    compacted_spec->hot_slices.push_back(std::move(curr_hot_slice));
+    row_idx = end_row;
   }
 }
 
@@ -56,7 +56,15 @@ class BatchSizeAccountant {
   struct BatchStats {
     uint64_t num_rows = 0;
     uint64_t bytes = 0;
-    std::unordered_map<int64_t, std::vector<uint64_t>> variable_cols_row_bytes;
+    // Prefix sums over total row bytes (fixed plus variable): `row_bytes_prefix_sum[i]` is the
+    // number of bytes in rows [0, i), so it has `num_rows + 1` entries. Storing prefix sums instead
+    // of per-row sizes means NewHotBatch can place compacted batch boundaries with a binary search
+    // per boundary, rather than walking every row whilst the hot lock is held. Left empty when the
+    // relation has no variable sized columns, since then every row has the same compile-time
+    // derived size (see BatchSizeAccountantNonMutableState::per_row_fixed_size).
+    std::vector<uint64_t> row_bytes_prefix_sum;
+    // Per variable sized column prefix sums of that column's row bytes, keyed by column index.
+    std::unordered_map<int64_t, std::vector<uint64_t>> variable_cols_prefix_bytes;
   };
 
   struct CompactedBatchSpec {
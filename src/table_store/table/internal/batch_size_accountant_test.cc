@@ -75,20 +75,32 @@ class BatchSizeAccountantTest : public RecordOrRowBatchParamTest {
 };
 
 TEST_P(BatchSizeAccountantTest, BatchStatsBasic) {
+  auto prefix_sum = [](const std::vector<uint64_t>& sizes) {
+    std::vector<uint64_t> prefix(sizes.size() + 1, 0);
+    for (size_t i = 0; i < sizes.size(); ++i) {
+      prefix[i + 1] = prefix[i] + sizes[i];
+    }
+    return prefix;
+  };
+
   auto stats = BatchSizeAccountant::CalcBatchStats(accountant_->NonMutableState(),
                                                    *larger_than_compaction_rb_);
   EXPECT_EQ(4, stats.num_rows);
   EXPECT_EQ(larger_than_compaction_rb_bytes_, stats.bytes);
-  EXPECT_THAT(stats.variable_cols_row_bytes,
+  EXPECT_THAT(stats.variable_cols_prefix_bytes,
               ::testing::UnorderedElementsAre(std::pair<int64_t, std::vector<uint64_t>>{
-                  string_col_idx_, larger_than_compaction_string_sizes_}));
+                  string_col_idx_, prefix_sum(larger_than_compaction_string_sizes_)}));
+  ASSERT_EQ(5, stats.row_bytes_prefix_sum.size());
+  EXPECT_EQ(0, stats.row_bytes_prefix_sum.front());
+  EXPECT_EQ(stats.bytes, stats.row_bytes_prefix_sum.back());
 
   stats = BatchSizeAccountant::CalcBatchStats(accountant_->NonMutableState(), *half_compaction_rb_);
   EXPECT_EQ(3, stats.num_rows);
   EXPECT_EQ(half_compaction_rb_bytes_, stats.bytes);
-  EXPECT_THAT(stats.variable_cols_row_bytes,
+  EXPECT_THAT(stats.variable_cols_prefix_bytes,
               ::testing::ElementsAre(std::pair<int64_t, std::vector<uint64_t>>{
-                  string_col_idx_, half_compaction_string_sizes_}));
+                  string_col_idx_, prefix_sum(half_compaction_string_sizes_)}));
+  EXPECT_EQ(stats.bytes, stats.row_bytes_prefix_sum.back());
 }
 
 #define HOT_SLICE_MATCHER(start, end, last_slice)                                                \
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/table_store/table/internal/cold_batch_compression.h"
+
+#include <zlib.h>
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/common/base/base.h"
+
+DEFINE_bool(table_store_compress_cold_batches,
+            gflags::BoolFromEnv("PL_TABLE_STORE_COMPRESS_COLD_BATCHES", false),
+            "If true, cold batch columns are zlib-compressed at compaction time and lazily "
+            "decompressed when a cursor touches them.");
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+namespace {
+
+constexpr int64_t kBufferAlignment = 64;
+
+// Arrow buffer over a 64-byte-aligned malloc'd region, freed on destruction. Decompressed column
+// buffers are allocated this way so that reconstructed arrays satisfy arrow's usual alignment.
+class AlignedBuffer : public arrow::Buffer {
+ public:
+  AlignedBuffer(uint8_t* data, int64_t size) : arrow::Buffer(data, size) {}
+  ~AlignedBuffer() override { free(const_cast<uint8_t*>(data_)); }
+};
+
+}  // namespace
+
+int64_t CompressedColumn::CompressedBytes() const {
+  int64_t bytes = 0;
+  for (const auto& buf : compressed_buffers) {
+    bytes += buf.size();
+  }
+  return bytes;
+}
+
+int64_t CompressedColumn::UncompressedBytes() const {
+  int64_t bytes = 0;
+  for (auto size : uncompressed_buffer_sizes) {
+    if (size > 0) {
+      bytes += size;
+    }
+  }
+  return bytes;
+}
+
+bool ColumnIsCompressible(const ArrowArrayPtr& column) {
+  return column != nullptr && column->type_id() != arrow::Type::DICTIONARY;
+}
+
+StatusOr<CompressedColumn> CompressColumn(types::DataType data_type,
+                                          const ArrowArrayPtr& column) {
+  DCHECK(ColumnIsCompressible(column));
+  CompressedColumn compressed;
+  compressed.data_type = data_type;
+  compressed.length = column->length();
+
+  const auto& buffers = column->data()->buffers;
+  compressed.uncompressed_buffer_sizes.reserve(buffers.size());
+  compressed.compressed_buffers.reserve(buffers.size());
+  for (const auto& buffer : buffers) {
+    if (buffer == nullptr) {
+      compressed.uncompressed_buffer_sizes.push_back(-1);
+      compressed.compressed_buffers.emplace_back();
+      continue;
+    }
+    std::string out;
+    out.resize(compressBound(buffer->size()));
+    uLongf out_size = out.size();
+    // Z_BEST_SPEED keeps compaction cheap; cold batches are written once and read rarely, so the
+    // tradeoff favors low compression latency over ratio.
+    int zerr = compress2(reinterpret_cast<Bytef*>(out.data()), &out_size, buffer->data(),
+                         buffer->size(), Z_BEST_SPEED);
+    if (zerr != Z_OK) {
+      return error::Internal("Failed to compress cold batch column (zlib error $0)", zerr);
+    }
+    out.resize(out_size);
+    out.shrink_to_fit();
+    compressed.uncompressed_buffer_sizes.push_back(buffer->size());
+    compressed.compressed_buffers.push_back(std::move(out));
+  }
+  return compressed;
+}
+
+StatusOr<ArrowArrayPtr> DecompressColumn(const CompressedColumn& column) {
+  std::vector<std::shared_ptr<arrow::Buffer>> buffers;
+  buffers.reserve(column.uncompressed_buffer_sizes.size());
+  for (const auto& [buf_idx, uncompressed_size] : Enumerate(column.uncompressed_buffer_sizes)) {
+    if (uncompressed_size < 0) {
+      buffers.push_back(nullptr);
+      continue;
+    }
+    void* data = nullptr;
+    if (posix_memalign(&data, kBufferAlignment, std::max<int64_t>(uncompressed_size, 1)) != 0) {
+      return error::Internal("Failed to allocate $0 bytes for cold batch decompression",
+                             uncompressed_size);
+    }
+    auto buffer = std::make_shared<AlignedBuffer>(static_cast<uint8_t*>(data), uncompressed_size);
+    const auto& compressed_buf = column.compressed_buffers[buf_idx];
+    uLongf out_size = uncompressed_size;
+    int zerr = uncompress(static_cast<Bytef*>(data), &out_size,
+                          reinterpret_cast<const Bytef*>(compressed_buf.data()),
+                          compressed_buf.size());
+    if (zerr != Z_OK || out_size != static_cast<uLongf>(uncompressed_size)) {
+      return error::Internal("Failed to decompress cold batch column (zlib error $0)", zerr);
+    }
+    buffers.push_back(std::move(buffer));
+  }
+  auto array_data = arrow::ArrayData::Make(ArrowDataTypeFromColumnType(column.data_type),
+                                           column.length, std::move(buffers), /* null_count */ 0);
+  return arrow::MakeArray(array_data);
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "src/common/base/statusor.h"
+#include "src/shared/types/types.h"
+#include "src/table_store/table/internal/types.h"
+
+DECLARE_bool(table_store_compress_cold_batches);
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+/**
+ * CompressedColumn is the zlib-compressed representation of a single cold batch column. Each of
+ * the column's arrow buffers is compressed independently, so the column can be reconstructed
+ * without knowing the arrow memory layout here.
+ */
+struct CompressedColumn {
+  types::DataType data_type;
+  int64_t length = 0;
+  // Uncompressed size of each arrow buffer slot; -1 marks an absent (nullptr) slot.
+  std::vector<int64_t> uncompressed_buffer_sizes;
+  // Compressed bytes of each buffer slot; empty for absent slots.
+  std::vector<std::string> compressed_buffers;
+
+  int64_t CompressedBytes() const;
+  int64_t UncompressedBytes() const;
+};
+
+/**
+ * ColumnIsCompressible returns whether the given cold column can be handed to CompressColumn.
+ * Dictionary-encoded columns are excluded: their indices/dictionary split already shrinks them,
+ * and their dictionary lives outside the array's own buffers.
+ */
+bool ColumnIsCompressible(const ArrowArrayPtr& column);
+
+/**
+ * CompressColumn compresses each buffer of the given dense cold column with zlib.
+ * @param data_type the table column type, used to reconstruct the array on decompression.
+ * @param column the dense arrow array to compress.
+ * @return the compressed representation, or an error if zlib fails.
+ */
+StatusOr<CompressedColumn> CompressColumn(types::DataType data_type, const ArrowArrayPtr& column);
+
+/**
+ * DecompressColumn reconstructs the dense arrow array for a column compressed by CompressColumn.
+ * @param column the compressed representation.
+ * @return the dense arrow array, or an error if decompression fails.
+ */
+StatusOr<ArrowArrayPtr> DecompressColumn(const CompressedColumn& column);
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
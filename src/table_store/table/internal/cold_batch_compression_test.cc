@@ -0,0 +1,65 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "src/shared/types/arrow_adapter.h"
+#include "src/table_store/table/internal/cold_batch_compression.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+TEST(ColdBatchCompressionTest, RoundTripInt64) {
+  std::vector<types::Int64Value> values;
+  for (int i = 0; i < 1024; ++i) {
+    values.emplace_back(i % 4);
+  }
+  auto arr = types::ToArrow(values, arrow::default_memory_pool());
+
+  ASSERT_TRUE(ColumnIsCompressible(arr));
+  auto compressed = CompressColumn(types::DataType::INT64, arr).ConsumeValueOrDie();
+  EXPECT_EQ(1024, compressed.length);
+  // Repetitive data must actually shrink.
+  EXPECT_LT(compressed.CompressedBytes(), compressed.UncompressedBytes());
+
+  auto dense = DecompressColumn(compressed).ConsumeValueOrDie();
+  EXPECT_TRUE(dense->Equals(arr));
+}
+
+TEST(ColdBatchCompressionTest, RoundTripString) {
+  std::vector<types::StringValue> values;
+  for (int i = 0; i < 256; ++i) {
+    values.emplace_back("a reasonably long, highly repetitive string value");
+  }
+  auto arr = types::ToArrow(values, arrow::default_memory_pool());
+
+  auto compressed = CompressColumn(types::DataType::STRING, arr).ConsumeValueOrDie();
+  EXPECT_LT(compressed.CompressedBytes(), compressed.UncompressedBytes());
+
+  auto dense = DecompressColumn(compressed).ConsumeValueOrDie();
+  EXPECT_TRUE(dense->Equals(arr));
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
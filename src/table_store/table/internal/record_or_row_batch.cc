@@ -25,6 +25,20 @@ namespace px {
 namespace table_store {
 namespace internal {
 
+namespace {
+
+// Arrow arrays are immutable and refcounted, so a slice that spans the whole array can hand out
+// the array itself rather than allocating a new Slice wrapper. No data is copied either way.
+std::shared_ptr<arrow::Array> SliceIfNeeded(const std::shared_ptr<arrow::Array>& arr,
+                                            size_t row_start, size_t batch_size) {
+  if (row_start == 0 && batch_size == static_cast<size_t>(arr->length())) {
+    return arr;
+  }
+  return arr->Slice(row_start, batch_size);
+}
+
+}  // namespace
+
 size_t RecordOrRowBatch::Length() const {
   return std::visit(overloaded{
                         [this](const RecordBatchWithCache& record_batch_w_cache) {
@@ -122,15 +136,15 @@ Status RecordOrRowBatch::AddBatchSliceToRowBatch(size_t row_start, size_t batch_
                 record_batch_w_cache.arrow_cache[col_idx] = arr;
                 record_batch_w_cache.cache_validity[col_idx] = true;
               }
-              auto arr = record_batch_w_cache.arrow_cache[col_idx]->Slice(row_start, batch_size);
-              PX_RETURN_IF_ERROR(output_rb->AddColumn(arr));
+              PX_RETURN_IF_ERROR(output_rb->AddColumn(SliceIfNeeded(
+                  record_batch_w_cache.arrow_cache[col_idx], row_start, batch_size)));
             }
             return Status::OK();
           },
           [row_start, batch_size, cols, output_rb](const schema::RowBatch& row_batch) {
             for (auto col_idx : cols) {
-              auto arr = row_batch.ColumnAt(col_idx)->Slice(row_start, batch_size);
-              PX_RETURN_IF_ERROR(output_rb->AddColumn(arr));
+              PX_RETURN_IF_ERROR(output_rb->AddColumn(
+                  SliceIfNeeded(row_batch.ColumnAt(col_idx), row_start, batch_size)));
             }
             return Status::OK();
           },
@@ -138,6 +152,18 @@ Status RecordOrRowBatch::AddBatchSliceToRowBatch(size_t row_start, size_t batch_
       batch_);
 }
 
+namespace {
+
+// Fixed-width types whose value wrappers and arrow arrays both expose contiguous native values,
+// allowing whole column ranges to be appended with a single memcpy instead of per-cell appends.
+template <types::DataType TDataType>
+constexpr bool SupportsContiguousAppend() {
+  return TDataType == types::DataType::INT64 || TDataType == types::DataType::FLOAT64 ||
+         TDataType == types::DataType::TIME64NS;
+}
+
+}  // namespace
+
 void RecordOrRowBatch::UnsafeAppendColumnToBuilder(types::TypeErasedArrowBuilder* builder,
                                                    types::DataType data_type, int64_t col_idx,
                                                    size_t start_row, size_t end_row) const {
@@ -148,18 +174,34 @@ void RecordOrRowBatch::UnsafeAppendColumnToBuilder(types::TypeErasedArrowBuilder
           [builder, data_type, col_idx, start_row,
            end_row](const RecordBatchWithCache& record_batch_w_cache) {
             const auto& record_batch = *record_batch_w_cache.record_batch;
-#define TYPE_CASE(_dt_)                                                            \
-  auto iterable = types::ColumnWrapperIterator<_dt_>(record_batch[col_idx].get()); \
-  auto typed_builder = types::GetTypedArrowBuilder<_dt_>(builder);                 \
-  typed_builder->UnsafeAppendValues(iterable.begin() + start_row, iterable.begin() + end_row);
+#define TYPE_CASE(_dt_)                                                                           \
+  auto typed_builder = types::GetTypedArrowBuilder<_dt_>(builder);                                \
+  if constexpr (SupportsContiguousAppend<_dt_>()) {                                               \
+    using native_type = typename types::DataTypeTraits<_dt_>::native_type;                        \
+    using value_type = typename types::DataTypeTraits<_dt_>::value_type;                          \
+    static_assert(sizeof(value_type) == sizeof(native_type),                                      \
+                  "Value wrapper must be layout compatible with its native type.");               \
+    const auto* raw_values =                                                                      \
+        reinterpret_cast<const native_type*>(record_batch[col_idx]->UnsafeRawData());             \
+    typed_builder->UnsafeAppendValues(raw_values + start_row, end_row - start_row);               \
+  } else {                                                                                        \
+    auto iterable = types::ColumnWrapperIterator<_dt_>(record_batch[col_idx].get());              \
+    typed_builder->UnsafeAppendValues(iterable.begin() + start_row, iterable.begin() + end_row);  \
+  }
             PX_SWITCH_FOREACH_DATATYPE(data_type, TYPE_CASE);
 #undef TYPE_CASE
           },
           [builder, data_type, col_idx, start_row, end_row](const schema::RowBatch& row_batch) {
-#define TYPE_CASE(_dt_)                                                               \
-  auto iterable = types::ArrowArrayIterator<_dt_>(row_batch.ColumnAt(col_idx).get()); \
-  auto typed_builder = types::GetTypedArrowBuilder<_dt_>(builder);                    \
-  typed_builder->UnsafeAppendValues(iterable.begin() + start_row, iterable.begin() + end_row);
+#define TYPE_CASE(_dt_)                                                                           \
+  auto typed_builder = types::GetTypedArrowBuilder<_dt_>(builder);                                \
+  if constexpr (SupportsContiguousAppend<_dt_>()) {                                               \
+    using arrow_array_type = typename types::DataTypeTraits<_dt_>::arrow_array_type;              \
+    const auto* typed_arr = static_cast<arrow_array_type*>(row_batch.ColumnAt(col_idx).get());    \
+    typed_builder->UnsafeAppendValues(typed_arr->raw_values() + start_row, end_row - start_row);  \
+  } else {                                                                                        \
+    auto iterable = types::ArrowArrayIterator<_dt_>(row_batch.ColumnAt(col_idx).get());          \
+    typed_builder->UnsafeAppendValues(iterable.begin() + start_row, iterable.begin() + end_row);  \
+  }
             PX_SWITCH_FOREACH_DATATYPE(data_type, TYPE_CASE);
 #undef TYPE_CASE
           },
@@ -192,6 +234,14 @@ std::vector<uint64_t> RecordOrRowBatch::GetVariableSizedColumnRowBytes(size_t co
   return rows_bytes;
 }
 
+RecordBatchPtr RecordOrRowBatch::ReleaseRecordBatch() {
+  auto* record_batch_w_cache = std::get_if<RecordBatchWithCache>(&batch_);
+  if (record_batch_w_cache == nullptr) {
+    return nullptr;
+  }
+  return std::move(record_batch_w_cache->record_batch);
+}
+
 }  // namespace internal
 }  // namespace table_store
 }  // namespace px
@@ -125,6 +125,15 @@ class RecordOrRowBatch {
    */
   std::vector<uint64_t> GetVariableSizedColumnRowBytes(size_t col_idx) const;
 
+  /**
+   * ReleaseRecordBatch releases ownership of the underlying `ColumnWrapperRecordBatch`, if this
+   * batch wraps one. This is used to recycle column wrapper buffers once a hot batch has been fully
+   * consumed by compaction. After this call the batch is no longer usable, so callers must
+   * immediately remove it from its store.
+   * @return the underlying ColumnWrapperRecordBatch, or nullptr if this batch wraps a RowBatch.
+   */
+  RecordBatchPtr ReleaseRecordBatch();
+
  private:
   std::variant<RecordBatchWithCache, schema::RowBatch> batch_;
   int64_t row_offset_ = 0;
@@ -0,0 +1,245 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/table_store/table/internal/spilled_batch_store.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/strings/str_format.h>
+
+#include "src/common/base/base.h"
+#include "src/common/fs/fs_wrapper.h"
+#include "src/shared/types/type_utils.h"
+#include "src/table_store/table/internal/string_dictionary.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+namespace {
+
+constexpr int64_t kSpillAlignment = 64;
+constexpr int64_t kSpillMagic = 0x50585350494C4C31;  // "PXSPILL1"
+
+struct BatchHeader {
+  int64_t magic;
+  int64_t num_columns;
+};
+
+struct ColumnHeader {
+  int64_t length;
+  int64_t num_buffers;
+};
+
+struct BufferHeader {
+  // Offset of the buffer within the file, or -1 for an absent (nullptr) buffer slot.
+  int64_t offset;
+  int64_t size;
+};
+
+int64_t AlignUp(int64_t val) {
+  return (val + kSpillAlignment - 1) & ~(kSpillAlignment - 1);
+}
+
+// Arrow buffer that owns a read-only mmap region and unmaps it on destruction. Per-column
+// buffers are created as slices of this buffer, which keeps the mapping alive for as long as
+// any array still references it (even after the backing file is unlinked).
+class MmapBuffer : public arrow::Buffer {
+ public:
+  MmapBuffer(uint8_t* data, int64_t size) : arrow::Buffer(data, size) {}
+  ~MmapBuffer() override { munmap(const_cast<uint8_t*>(data_), size_); }
+};
+
+}  // namespace
+
+SpilledBatchStore::SpilledBatchStore(std::string spill_dir, std::string file_prefix)
+    : spill_dir_(std::move(spill_dir)), file_prefix_(std::move(file_prefix)) {
+  auto s = fs::CreateDirectories(spill_dir_);
+  LOG_IF(ERROR, !s.ok()) << absl::StrFormat("Failed to create spill directory '%s': %s", spill_dir_,
+                                            s.msg());
+}
+
+SpilledBatchStore::~SpilledBatchStore() {
+  while (!files_.empty()) {
+    DropOldest();
+  }
+}
+
+StatusOr<ColdBatch> SpilledBatchStore::Spill(const schema::Relation& rel, const ColdBatch& batch) {
+  DCHECK_EQ(batch.size(), rel.NumColumns());
+
+  // Dictionary-encoded columns keep their dictionary outside the flat buffer list, so they are
+  // materialized to dense arrays before spilling.
+  ColdBatch dense_batch;
+  dense_batch.reserve(batch.size());
+  for (const auto& col : batch) {
+    if (col->type_id() == arrow::Type::DICTIONARY) {
+      PX_ASSIGN_OR_RETURN(auto dense, MaterializeDictionarySlice(col, 0, col->length(),
+                                                                 arrow::default_memory_pool()));
+      dense_batch.push_back(dense);
+    } else {
+      dense_batch.push_back(col);
+    }
+  }
+
+  // Gather all arrow buffers of all columns, keeping absent buffer slots so that ArrayData can be
+  // reconstructed exactly on read back.
+  std::vector<ColumnHeader> col_headers;
+  std::vector<BufferHeader> buf_headers;
+  std::vector<std::shared_ptr<arrow::Buffer>> buffers;
+  for (const auto& col : dense_batch) {
+    const auto& array_data = col->data();
+    col_headers.push_back(
+        ColumnHeader{array_data->length, static_cast<int64_t>(array_data->buffers.size())});
+    for (const auto& buf : array_data->buffers) {
+      buf_headers.push_back(BufferHeader{-1, buf == nullptr ? -1 : buf->size()});
+      buffers.push_back(buf);
+    }
+  }
+
+  int64_t header_bytes = sizeof(BatchHeader) + col_headers.size() * sizeof(ColumnHeader) +
+                         buf_headers.size() * sizeof(BufferHeader);
+  int64_t offset = AlignUp(header_bytes);
+  for (auto& buf_header : buf_headers) {
+    if (buf_header.size < 0) {
+      continue;
+    }
+    buf_header.offset = offset;
+    offset = AlignUp(offset + buf_header.size);
+  }
+  int64_t file_size = offset;
+
+  auto path = absl::StrFormat("%s/%s_%d.spill", spill_dir_, file_prefix_, next_file_id_);
+  next_file_id_++;
+
+  int fd = open(path.c_str(), O_CREAT | O_TRUNC | O_RDWR, 0600);
+  if (fd < 0) {
+    return error::Internal("Failed to open spill file '$0': $1", path, strerror(errno));
+  }
+  auto close_and_unlink = [&](const std::string& context) {
+    close(fd);
+    unlink(path.c_str());
+    return error::Internal("Failed to $0 spill file '$1': $2", context, path, strerror(errno));
+  };
+
+  if (ftruncate(fd, file_size) != 0) {
+    return close_and_unlink("resize");
+  }
+
+  BatchHeader batch_header{kSpillMagic, static_cast<int64_t>(batch.size())};
+  std::string header;
+  header.append(reinterpret_cast<const char*>(&batch_header), sizeof(batch_header));
+  header.append(reinterpret_cast<const char*>(col_headers.data()),
+                col_headers.size() * sizeof(ColumnHeader));
+  header.append(reinterpret_cast<const char*>(buf_headers.data()),
+                buf_headers.size() * sizeof(BufferHeader));
+  if (pwrite(fd, header.data(), header.size(), 0) != static_cast<ssize_t>(header.size())) {
+    return close_and_unlink("write header to");
+  }
+  for (const auto& [i, buf] : Enumerate(buffers)) {
+    if (buf == nullptr || buf->size() == 0) {
+      continue;
+    }
+    if (pwrite(fd, buf->data(), buf->size(), buf_headers[i].offset) != buf->size()) {
+      return close_and_unlink("write buffer to");
+    }
+  }
+  close(fd);
+
+  auto batch_or_s = MapSpilledFile(rel, path);
+  if (!batch_or_s.ok()) {
+    unlink(path.c_str());
+    return batch_or_s.status();
+  }
+
+  files_.emplace_back(path, file_size);
+  spilled_bytes_ += file_size;
+  return batch_or_s.ConsumeValueOrDie();
+}
+
+StatusOr<ColdBatch> SpilledBatchStore::MapSpilledFile(const schema::Relation& rel,
+                                                      const std::string& path) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return error::Internal("Failed to open spill file '$0': $1", path, strerror(errno));
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    return error::Internal("Failed to stat spill file '$0': $1", path, strerror(errno));
+  }
+  void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  // The mapping keeps the file contents accessible, so the fd can be closed immediately.
+  close(fd);
+  if (addr == MAP_FAILED) {
+    return error::Internal("Failed to mmap spill file '$0': $1", path, strerror(errno));
+  }
+  auto base =
+      std::make_shared<MmapBuffer>(reinterpret_cast<uint8_t*>(addr), static_cast<int64_t>(st.st_size));
+
+  const auto* batch_header = reinterpret_cast<const BatchHeader*>(base->data());
+  if (batch_header->magic != kSpillMagic ||
+      batch_header->num_columns != static_cast<int64_t>(rel.NumColumns())) {
+    return error::Internal("Spill file '$0' has an invalid header.", path);
+  }
+  const auto* col_headers =
+      reinterpret_cast<const ColumnHeader*>(base->data() + sizeof(BatchHeader));
+  const auto* buf_headers = reinterpret_cast<const BufferHeader*>(
+      base->data() + sizeof(BatchHeader) + batch_header->num_columns * sizeof(ColumnHeader));
+
+  ColdBatch out_batch;
+  size_t buf_idx = 0;
+  for (int64_t col_idx = 0; col_idx < batch_header->num_columns; ++col_idx) {
+    const auto& col_header = col_headers[col_idx];
+    std::vector<std::shared_ptr<arrow::Buffer>> col_buffers;
+    for (int64_t i = 0; i < col_header.num_buffers; ++i, ++buf_idx) {
+      const auto& buf_header = buf_headers[buf_idx];
+      if (buf_header.size < 0) {
+        col_buffers.push_back(nullptr);
+        continue;
+      }
+      col_buffers.push_back(arrow::SliceBuffer(base, buf_header.offset, buf_header.size));
+    }
+    auto array_data =
+        arrow::ArrayData::Make(ArrowDataTypeFromColumnType(rel.GetColumnType(col_idx)),
+                               col_header.length, std::move(col_buffers), /* null_count */ 0);
+    out_batch.push_back(arrow::MakeArray(array_data));
+  }
+  return out_batch;
+}
+
+void SpilledBatchStore::DropOldest() {
+  DCHECK(!files_.empty());
+  const auto& [path, size] = files_.front();
+  unlink(path.c_str());
+  spilled_bytes_ -= size;
+  files_.pop_front();
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
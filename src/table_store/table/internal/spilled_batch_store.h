@@ -0,0 +1,91 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/common/base/status.h"
+#include "src/common/base/statusor.h"
+#include "src/table_store/schema/relation.h"
+#include "src/table_store/table/internal/types.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+/**
+ * SpilledBatchStore serializes evicted cold batches into flat per-column files and maps them back
+ * into the process with mmap. The returned batches are regular `ColdBatch`s (vectors of arrow
+ * arrays), except that all of their value buffers point directly into the read-only mapping, so a
+ * spilled batch costs no heap memory beyond the arrow wrapper objects. Reads through
+ * `StoreWithRowTimeAccounting` work on spilled batches unmodified.
+ *
+ * On-disk layout (all sections 64-byte aligned):
+ *   [BatchHeader][ColumnHeader xN][BufferHeader xM][buffer bytes ...]
+ * Each arrow buffer of each column (validity/offsets/data) is written verbatim, so reading a
+ * batch back requires no deserialization, only reconstructing the arrow::ArrayData wrappers.
+ *
+ * This class is not thread safe; callers are expected to synchronize access (Table guards it
+ * with its spilled-store lock).
+ */
+class SpilledBatchStore {
+ public:
+  SpilledBatchStore(std::string spill_dir, std::string file_prefix);
+  ~SpilledBatchStore();
+
+  /**
+   * Spill serializes the given cold batch to a new file in the spill directory and returns an
+   * equivalent batch whose column buffers are backed by a read-only mmap of that file.
+   * @param rel the relation for the table, used to reconstruct column types on read back.
+   * @param batch the cold batch to spill.
+   * @return a mmap-backed ColdBatch equivalent to the input batch.
+   */
+  StatusOr<ColdBatch> Spill(const schema::Relation& rel, const ColdBatch& batch);
+
+  /**
+   * DropOldest unlinks the file backing the oldest spilled batch. Any outstanding mmap-backed
+   * arrays remain valid until their buffers are destroyed, since the mapping outlives the unlink.
+   */
+  void DropOldest();
+
+  /**
+   * SpilledBytes returns the total on-disk size of all live spill files.
+   */
+  int64_t SpilledBytes() const { return spilled_bytes_; }
+
+  size_t NumSpilledFiles() const { return files_.size(); }
+
+ private:
+  StatusOr<ColdBatch> MapSpilledFile(const schema::Relation& rel, const std::string& path);
+
+  const std::string spill_dir_;
+  const std::string file_prefix_;
+  int64_t next_file_id_ = 0;
+  // Oldest file first; pair of (path, file size in bytes).
+  std::deque<std::pair<std::string, int64_t>> files_;
+  int64_t spilled_bytes_ = 0;
+};
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+#include "src/common/testing/testing.h"
+#include "src/shared/types/arrow_adapter.h"
+#include "src/table_store/schema/relation.h"
+#include "src/table_store/table/internal/spilled_batch_store.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+class SpilledBatchStoreTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    rel_ = std::make_unique<schema::Relation>(
+        std::vector<types::DataType>({types::DataType::TIME64NS, types::DataType::FLOAT64,
+                                      types::DataType::STRING}),
+        std::vector<std::string>({"time_", "float_col", "string_col"}));
+    spill_dir_ = std::filesystem::temp_directory_path() / "spilled_batch_store_test";
+    store_ = std::make_unique<SpilledBatchStore>(spill_dir_.string(), "test_table");
+  }
+
+  void TearDown() override {
+    store_.reset();
+    std::filesystem::remove_all(spill_dir_);
+  }
+
+  ColdBatch MakeColdBatch(const std::vector<types::Time64NSValue>& times,
+                          const std::vector<types::Float64Value>& floats,
+                          const std::vector<types::StringValue>& strings) {
+    return ColdBatch{types::ToArrow(times, arrow::default_memory_pool()),
+                     types::ToArrow(floats, arrow::default_memory_pool()),
+                     types::ToArrow(strings, arrow::default_memory_pool())};
+  }
+
+  std::unique_ptr<schema::Relation> rel_;
+  std::filesystem::path spill_dir_;
+  std::unique_ptr<SpilledBatchStore> store_;
+};
+
+TEST_F(SpilledBatchStoreTest, SpillRoundTrip) {
+  auto batch = MakeColdBatch({1, 2, 3}, {1.0, 2.5, -3.0}, {"abc", "", "longer string value"});
+
+  ASSERT_OK_AND_ASSIGN(auto spilled, store_->Spill(*rel_, batch));
+  EXPECT_EQ(1, store_->NumSpilledFiles());
+  EXPECT_GT(store_->SpilledBytes(), 0);
+
+  ASSERT_EQ(batch.size(), spilled.size());
+  for (size_t i = 0; i < batch.size(); ++i) {
+    EXPECT_TRUE(batch[i]->Equals(spilled[i])) << "Column " << i << " differs after spilling";
+  }
+}
+
+TEST_F(SpilledBatchStoreTest, SpilledBatchOutlivesFile) {
+  auto batch = MakeColdBatch({1, 2}, {1.0, 2.0}, {"a", "b"});
+  ASSERT_OK_AND_ASSIGN(auto spilled, store_->Spill(*rel_, batch));
+
+  // Dropping the backing file must not invalidate the mmap-backed arrays.
+  store_->DropOldest();
+  EXPECT_EQ(0, store_->NumSpilledFiles());
+  EXPECT_EQ(0, store_->SpilledBytes());
+  for (size_t i = 0; i < batch.size(); ++i) {
+    EXPECT_TRUE(batch[i]->Equals(spilled[i]));
+  }
+}
+
+TEST_F(SpilledBatchStoreTest, DropOldestReclaimsBytes) {
+  auto batch0 = MakeColdBatch({1}, {1.0}, {"first"});
+  auto batch1 = MakeColdBatch({2}, {2.0}, {"second"});
+  ASSERT_OK(store_->Spill(*rel_, batch0));
+  auto bytes_after_first = store_->SpilledBytes();
+  ASSERT_OK(store_->Spill(*rel_, batch1));
+  EXPECT_EQ(2, store_->NumSpilledFiles());
+
+  store_->DropOldest();
+  EXPECT_EQ(1, store_->NumSpilledFiles());
+  EXPECT_EQ(store_->SpilledBytes(), bytes_after_first);
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
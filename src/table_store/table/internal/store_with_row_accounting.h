@@ -18,16 +18,23 @@
 
 #pragma once
 
+#include <algorithm>
 #include <deque>
+#include <list>
 #include <memory>
 #include <optional>
 #include <utility>
 #include <vector>
 
+#include <absl/strings/str_format.h>
+
+#include "src/common/base/base.h"
 #include "src/common/base/status.h"
 #include "src/shared/types/arrow_adapter.h"
 #include "src/shared/types/column_wrapper.h"
 #include "src/table_store/schema/relation.h"
+#include "src/table_store/table/internal/cold_batch_compression.h"
+#include "src/table_store/table/internal/string_dictionary.h"
 #include "src/table_store/table/internal/types.h"
 
 namespace px {
@@ -127,7 +134,7 @@ class StoreWithRowTimeAccounting {
     auto output_rb =
         std::make_unique<schema::RowBatch>(schema::RowDescriptor(col_types), batch_size);
     PX_RETURN_IF_ERROR(
-        AddBatchSliceToRowBatch(batch, row_offset, batch_size, cols, output_rb.get()));
+        AddBatchSliceToRowBatch(batch_id, batch, row_offset, batch_size, cols, output_rb.get()));
 
     // Update the ptr to the last read row.
     *last_read_row_id = start_row_id + batch_size - 1;
@@ -139,6 +146,39 @@ class StoreWithRowTimeAccounting {
     return output_rb;
   }
 
+  /**
+   * SkipNextRowBatch advances the row accounting past the batch that GetNextRowBatch would
+   * return, without materializing (or decompressing) the batch data. Used by sampling scans
+   * that only read every Nth batch.
+   * @param last_read_row_id, pointer to the unique RowID of the last read row; updated to the
+   * last row of the skipped batch (clamped to stop_row_id, as with GetNextRowBatch).
+   * @param hints, pointer to a BatchHints object, updated to point at the following batch.
+   * @param stop_row_id, optional RowID at which iteration stops.
+   * @return true if a batch in this store was skipped, false if the next row is not in this
+   * store.
+   */
+  bool SkipNextRowBatch(RowID* last_read_row_id, BatchHints* hints,
+                        std::optional<RowID> stop_row_id) const {
+    auto start_row_id = *last_read_row_id + 1;
+    if (batches_.empty() || start_row_id < FirstRowID() || start_row_id > LastRowID()) {
+      return false;
+    }
+    BatchID batch_id;
+    if (hints != nullptr && BatchHintValid(*hints, start_row_id)) {
+      batch_id = hints->batch_id;
+    } else {
+      batch_id = FindBatchIDFromRowID(start_row_id);
+    }
+    RowID batch_last_row_id = BatchLastRowID(batch_id);
+    if (stop_row_id.has_value() && batch_last_row_id >= stop_row_id.value()) {
+      batch_last_row_id = stop_row_id.value() - 1;
+    }
+    *last_read_row_id = batch_last_row_id;
+    hints->batch_id = batch_id + 1;
+    hints->hint_type = TStoreType;
+    return true;
+  }
+
   /**
    * Size returns the number of batches in this store.
    * @return number of batches.
@@ -164,6 +204,14 @@ class StoreWithRowTimeAccounting {
 
     row_ids_.pop_front();
     if (time_col_idx_ != -1) times_.pop_front();
+    if constexpr (std::is_same_v<TBatch, ColdBatch>) {
+      zone_maps_.pop_front();
+    }
+    if constexpr (TStoreType == StoreType::Cold) {
+      compressed_cols_.pop_front();
+      decompressed_cache_.remove_if(
+          [this](const auto& entry) { return entry.first < first_batch_id_; });
+    }
 
     auto&& front = std::move(batches_.front());
     batches_.pop_front();
@@ -186,9 +234,107 @@ class StoreWithRowTimeAccounting {
       auto last_time = GetTimeValue(batch, BatchLength(batch) - 1);
       times_.emplace_back(first_time, last_time);
     }
+    if constexpr (std::is_same_v<TBatch, ColdBatch>) {
+      zone_maps_.push_back(ComputeZoneMaps(batch));
+    }
+    if constexpr (TStoreType == StoreType::Cold) {
+      // Compress after the row/time/zone-map accounting above, which needs the dense arrays.
+      // Spilled batches are excluded: their buffers are mmap-backed and already off-heap.
+      MaybeCompressBatch(&batch);
+    }
     return batch;
   }
 
+  /**
+   * DecompressedFront returns a copy of the first batch in the store with any compressed columns
+   * replaced by their dense arrow arrays (bypassing the decompressed-batch cache, since callers
+   * like the spill path consume the batch exactly once). Only available for the cold store.
+   * @return the first batch with every column dense.
+   */
+  StatusOr<ColdBatch> DecompressedFront() {
+    static_assert(TStoreType == StoreType::Cold,
+                  "DecompressedFront is only available for the cold store.");
+    DCHECK(!batches_.empty());
+    ColdBatch batch = batches_.front();
+    for (size_t col_idx = 0; col_idx < batch.size(); ++col_idx) {
+      if (batch[col_idx] != nullptr) {
+        continue;
+      }
+      const auto& compressed = compressed_cols_.front()[col_idx];
+      DCHECK(compressed.has_value());
+      PX_ASSIGN_OR_RETURN(batch[col_idx], DecompressColumn(compressed.value()));
+    }
+    return batch;
+  }
+
+  /**
+   * WarmTimeRange pre-fills the decompressed-batch cache for batches whose time intervals
+   * overlap the inclusive window [start_time, stop_time], starting at the beginning of the
+   * window. At most kDecompressedBatchCacheSize batches are warmed, so every warmed batch is
+   * still cached when a scan of the window reaches it. Batches with no compressed columns cost
+   * nothing. Only available for the cold store.
+   * @param start_time inclusive lower bound of the scan's time window.
+   * @param stop_time inclusive upper bound of the scan's time window.
+   * @return the number of batches that were decompressed into the cache.
+   */
+  size_t WarmTimeRange(Time start_time, Time stop_time) const {
+    static_assert(TStoreType == StoreType::Cold,
+                  "WarmTimeRange is only available for the cold store.");
+    if (time_col_idx_ == -1 || times_.empty()) {
+      return 0;
+    }
+    auto it = std::lower_bound(times_.begin(), times_.end(), start_time,
+                               TimeIntervalComparatorLowerBound);
+    size_t warmed = 0;
+    for (size_t i = std::distance(times_.begin(), it);
+         i < batches_.size() && warmed < kDecompressedBatchCacheSize; ++i) {
+      if (times_[i].first > stop_time) {
+        break;
+      }
+      const BatchID batch_id = first_batch_id_ + i;
+      bool decompressed_any = false;
+      for (const auto& [col_idx, compressed] : Enumerate(compressed_cols_[i])) {
+        if (!compressed.has_value()) {
+          continue;
+        }
+        auto arr_or_s = GetDecompressedColumn(batch_id, static_cast<int64_t>(col_idx));
+        if (!arr_or_s.ok()) {
+          // Warming is best-effort: the scan will decompress on demand and surface the error.
+          LOG(WARNING) << absl::StrFormat("Failed to warm cold batch column: %s",
+                                          arr_or_s.msg());
+          return warmed;
+        }
+        decompressed_any = true;
+      }
+      if (decompressed_any) {
+        ++warmed;
+      }
+    }
+    return warmed;
+  }
+
+  /**
+   * FindRowIDIntervalsOverlappingInt64Range returns the row-id intervals of all batches whose
+   * zone map for the given INT64/TIME64NS column overlaps the inclusive range [min_val, max_val].
+   * Batches without a valid zone map for the column are conservatively included. Only available
+   * for stores whose batches carry zone maps (i.e. the cold and spilled stores).
+   */
+  std::vector<RowIDInterval> FindRowIDIntervalsOverlappingInt64Range(int64_t col_idx,
+                                                                     int64_t min_val,
+                                                                     int64_t max_val) const {
+    static_assert(std::is_same_v<TBatch, ColdBatch>,
+                  "Zone maps are only maintained for cold batches.");
+    std::vector<RowIDInterval> intervals;
+    for (size_t i = 0; i < batches_.size(); ++i) {
+      const auto& zone_map = zone_maps_[i][col_idx];
+      if (zone_map.valid && (zone_map.max_int64 < min_val || zone_map.min_int64 > max_val)) {
+        continue;
+      }
+      intervals.push_back(row_ids_[i]);
+    }
+    return intervals;
+  }
+
   /**
    * FirstRowID returns the RowID of the first row in the store.
    * @return RowID of the first row in the store.
@@ -384,13 +530,32 @@ class StoreWithRowTimeAccounting {
     }
   }
 
-  Status AddBatchSliceToRowBatch(const TBatch& batch, size_t row_offset, size_t batch_size,
-                                 const std::vector<int64_t>& cols,
+  Status AddBatchSliceToRowBatch(BatchID batch_id, const TBatch& batch, size_t row_offset,
+                                 size_t batch_size, const std::vector<int64_t>& cols,
                                  schema::RowBatch* output_rb) const {
     if constexpr (std::is_same_v<TBatch, ColdBatch>) {
       for (auto col_idx : cols) {
-        auto arr = batch[col_idx]->Slice(row_offset, batch_size);
-        PX_RETURN_IF_ERROR(output_rb->AddColumn(arr));
+        ArrowArrayPtr arr = batch[col_idx];
+        if constexpr (TStoreType == StoreType::Cold) {
+          if (arr == nullptr) {
+            // Compressed column; decompress it (or fetch it from the decompressed-batch cache).
+            PX_ASSIGN_OR_RETURN(arr, GetDecompressedColumn(batch_id, col_idx));
+          }
+        }
+        if (arr->type_id() == arrow::Type::DICTIONARY) {
+          // Dictionary-encoded string column; materialize only the requested rows.
+          PX_ASSIGN_OR_RETURN(auto dense, MaterializeDictionarySlice(arr, row_offset, batch_size,
+                                                                     arrow::default_memory_pool()));
+          PX_RETURN_IF_ERROR(output_rb->AddColumn(dense));
+          continue;
+        }
+        // When the requested slice spans the whole batch, hand out the refcounted array itself
+        // instead of allocating a per-column Slice wrapper. Either way no data is copied.
+        if (row_offset == 0 && batch_size == static_cast<size_t>(arr->length())) {
+          PX_RETURN_IF_ERROR(output_rb->AddColumn(arr));
+        } else {
+          PX_RETURN_IF_ERROR(output_rb->AddColumn(arr->Slice(row_offset, batch_size)));
+        }
       }
       return Status::OK();
     } else if constexpr (std::is_same_v<TBatch, HotBatch>) {
@@ -400,12 +565,121 @@ class StoreWithRowTimeAccounting {
     }
   }
 
+  // Computes per-column min/max statistics for a cold batch. The time column's stats come
+  // straight from its first/last values since the data is time sorted; other numeric columns
+  // require a scan, which is cheap relative to the compaction that produced the batch.
+  std::vector<ColumnZoneMap> ComputeZoneMaps(const ColdBatch& batch) const {
+    std::vector<ColumnZoneMap> zone_maps(rel_.NumColumns());
+    for (const auto& [col_idx, data_type] : Enumerate(rel_.col_types())) {
+      auto& zone_map = zone_maps[col_idx];
+      const auto& arr = batch[col_idx];
+      auto length = arr->length();
+      if (length == 0) {
+        continue;
+      }
+      switch (data_type) {
+        case types::DataType::TIME64NS: {
+          const auto* values =
+              static_cast<const arrow::Time64Array*>(arr.get())->raw_values();
+          zone_map.min_int64 = values[0];
+          zone_map.max_int64 = values[length - 1];
+          zone_map.valid = true;
+          break;
+        }
+        case types::DataType::INT64: {
+          const auto* values = static_cast<const arrow::Int64Array*>(arr.get())->raw_values();
+          const auto [min_it, max_it] = std::minmax_element(values, values + length);
+          zone_map.min_int64 = *min_it;
+          zone_map.max_int64 = *max_it;
+          zone_map.valid = true;
+          break;
+        }
+        case types::DataType::FLOAT64: {
+          const auto* values = static_cast<const arrow::DoubleArray*>(arr.get())->raw_values();
+          const auto [min_it, max_it] = std::minmax_element(values, values + length);
+          zone_map.min_float64 = *min_it;
+          zone_map.max_float64 = *max_it;
+          zone_map.valid = true;
+          break;
+        }
+        default:
+          break;
+      }
+    }
+    return zone_maps;
+  }
+
+  // Compresses eligible columns of the newly emplaced cold batch, when enabled by
+  // --table_store_compress_cold_batches. Compressed columns are nulled out in the stored batch and
+  // kept in `compressed_cols_`; the time column stays dense since time-based row lookups binary
+  // search it, and columns whose compressed form isn't smaller stay dense too.
+  void MaybeCompressBatch(ColdBatch* batch) {
+    auto& compressed_cols = compressed_cols_.emplace_back(rel_.NumColumns());
+    if (!FLAGS_table_store_compress_cold_batches) {
+      return;
+    }
+    for (const auto& [col_idx, data_type] : Enumerate(rel_.col_types())) {
+      if (static_cast<int64_t>(col_idx) == time_col_idx_) {
+        continue;
+      }
+      auto& arr = (*batch)[col_idx];
+      if (!ColumnIsCompressible(arr)) {
+        continue;
+      }
+      auto compressed_or_s = CompressColumn(data_type, arr);
+      if (!compressed_or_s.ok()) {
+        LOG(WARNING) << absl::StrFormat("Failed to compress cold batch column, keeping it dense: %s",
+                                        compressed_or_s.msg());
+        continue;
+      }
+      auto compressed = compressed_or_s.ConsumeValueOrDie();
+      if (compressed.CompressedBytes() >= compressed.UncompressedBytes()) {
+        continue;
+      }
+      compressed_cols[col_idx] = std::move(compressed);
+      arr = nullptr;
+    }
+  }
+
+  // Returns the dense array for a compressed cold column, decompressing it on first touch and
+  // memoizing it in a small LRU cache of decompressed batches so that scans which touch a batch's
+  // columns (or the same batch) repeatedly don't decompress it over and over.
+  StatusOr<ArrowArrayPtr> GetDecompressedColumn(BatchID batch_id, int64_t col_idx) const {
+    auto it = std::find_if(decompressed_cache_.begin(), decompressed_cache_.end(),
+                           [batch_id](const auto& entry) { return entry.first == batch_id; });
+    if (it != decompressed_cache_.end()) {
+      decompressed_cache_.splice(decompressed_cache_.begin(), decompressed_cache_, it);
+    } else {
+      decompressed_cache_.emplace_front(batch_id, ColdBatch(rel_.NumColumns()));
+      if (decompressed_cache_.size() > kDecompressedBatchCacheSize) {
+        decompressed_cache_.pop_back();
+      }
+    }
+    auto& cached_cols = decompressed_cache_.front().second;
+    if (cached_cols[col_idx] == nullptr) {
+      const auto& compressed = compressed_cols_[batch_id - first_batch_id_][col_idx];
+      DCHECK(compressed.has_value());
+      PX_ASSIGN_OR_RETURN(cached_cols[col_idx], DecompressColumn(compressed.value()));
+    }
+    return cached_cols[col_idx];
+  }
+
+  static constexpr size_t kDecompressedBatchCacheSize = 4;
+
   BatchID first_batch_id_ = 0;
   const schema::Relation& rel_;
   const int64_t time_col_idx_;
   std::deque<TBatch> batches_;
   std::deque<RowIDInterval> row_ids_;
   std::deque<TimeInterval> times_;
+  // Per-batch, per-column min/max statistics; only maintained for cold batches.
+  std::deque<std::vector<ColumnZoneMap>> zone_maps_;
+  // Compressed representations of cold batch columns, parallel to `batches_`; entries are
+  // std::nullopt for columns kept dense. Only maintained for the cold store.
+  std::deque<std::vector<std::optional<CompressedColumn>>> compressed_cols_;
+  // LRU cache of decompressed batches, most recently used first; per-column entries are filled
+  // lazily as cursors touch them. Mutable because decompression happens on (const) reads.
+  mutable std::list<std::pair<BatchID, ColdBatch>> decompressed_cache_;
 };
 
 }  // namespace internal
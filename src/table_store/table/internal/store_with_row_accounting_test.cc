@@ -124,6 +124,117 @@ TEST_F(ColdStoreTest, PushRowBatchesCheckProperties) {
   EXPECT_EQ(4, optional_row_id.value());
 }
 
+TEST_F(ColdStoreTest, ZoneMapsSkipNonOverlappingBatches) {
+  auto rb0 = MakeRowBatch({1, 2, 10}, {true, false, true}, {"a", "b", "c"});
+  auto rb1 = MakeRowBatch({20, 21, 30}, {true, false, true}, {"d", "e", "f"});
+  store_->EmplaceBack(0, rb0.columns());
+  store_->EmplaceBack(3, rb1.columns());
+
+  // Range fully inside the first batch's time zone map.
+  auto intervals = store_->FindRowIDIntervalsOverlappingInt64Range(0, 2, 5);
+  ASSERT_EQ(1, intervals.size());
+  EXPECT_EQ(0, intervals[0].first);
+  EXPECT_EQ(2, intervals[0].second);
+
+  // Range between the two batches matches neither.
+  intervals = store_->FindRowIDIntervalsOverlappingInt64Range(0, 12, 15);
+  EXPECT_EQ(0, intervals.size());
+
+  // Range spanning both batches matches both.
+  intervals = store_->FindRowIDIntervalsOverlappingInt64Range(0, 5, 25);
+  ASSERT_EQ(2, intervals.size());
+  EXPECT_EQ(3, intervals[1].first);
+  EXPECT_EQ(5, intervals[1].second);
+
+  // Columns without zone maps (e.g. strings) are conservatively included.
+  intervals = store_->FindRowIDIntervalsOverlappingInt64Range(2, 100, 200);
+  EXPECT_EQ(2, intervals.size());
+}
+
+TEST_F(ColdStoreTest, CompressedColdBatchReadBack) {
+  FLAGS_table_store_compress_cold_batches = true;
+
+  std::vector<types::Time64NSValue> times;
+  std::vector<types::BoolValue> bools;
+  std::vector<types::StringValue> strings;
+  for (int i = 0; i < 256; ++i) {
+    times.emplace_back(i);
+    bools.emplace_back(i % 2 == 0);
+    strings.emplace_back("a reasonably long, highly repetitive string value");
+  }
+  auto rb = MakeRowBatch(times, bools, strings);
+  store_->EmplaceBack(0, rb.columns());
+
+  // Read the batch back twice; the second read is served by the decompressed-batch cache.
+  for (int i = 0; i < 2; ++i) {
+    RowID last_read_row_id = -1;
+    BatchHints hints = {};
+    auto out_rb = store_
+                      ->GetNextRowBatch(&last_read_row_id, &hints, std::nullopt,
+                                        std::vector<int64_t>{0, 1, 2})
+                      .ConsumeValueOrDie();
+    ASSERT_NE(nullptr, out_rb);
+    EXPECT_TRUE(out_rb->ColumnAt(0)->Equals(rb.ColumnAt(0)));
+    EXPECT_TRUE(out_rb->ColumnAt(1)->Equals(rb.ColumnAt(1)));
+    EXPECT_TRUE(out_rb->ColumnAt(2)->Equals(rb.ColumnAt(2)));
+    EXPECT_EQ(255, last_read_row_id);
+  }
+
+  // Time-based lookups still work, since the time column is kept dense.
+  auto optional_row_id = store_->FindRowIDFromTimeFirstGreaterThanOrEqual(100);
+  ASSERT_TRUE(optional_row_id.has_value());
+  EXPECT_EQ(100, optional_row_id.value());
+
+  // DecompressedFront (used by the spill path) must return fully dense columns.
+  auto dense = store_->DecompressedFront().ConsumeValueOrDie();
+  for (const auto& col : dense) {
+    ASSERT_NE(nullptr, col);
+  }
+  EXPECT_TRUE(dense[2]->Equals(rb.ColumnAt(2)));
+
+  FLAGS_table_store_compress_cold_batches = false;
+}
+
+TEST_F(ColdStoreTest, WarmTimeRangeFillsDecompressedCache) {
+  FLAGS_table_store_compress_cold_batches = true;
+
+  auto make_compressible_batch = [this](int64_t first_time) {
+    std::vector<types::Time64NSValue> times;
+    std::vector<types::BoolValue> bools;
+    std::vector<types::StringValue> strings;
+    for (int i = 0; i < 256; ++i) {
+      times.emplace_back(first_time + i);
+      bools.emplace_back(i % 2 == 0);
+      strings.emplace_back("a reasonably long, highly repetitive string value");
+    }
+    return MakeRowBatch(times, bools, strings);
+  };
+
+  auto rb0 = make_compressible_batch(0);
+  auto rb1 = make_compressible_batch(1000);
+  store_->EmplaceBack(0, rb0.columns());
+  store_->EmplaceBack(256, rb1.columns());
+
+  // A window covering only the second batch warms just that batch.
+  EXPECT_EQ(1, store_->WarmTimeRange(1000, 2000));
+  // A window covering both batches warms both.
+  EXPECT_EQ(2, store_->WarmTimeRange(0, 2000));
+  // A window past the data warms nothing.
+  EXPECT_EQ(0, store_->WarmTimeRange(3000, 4000));
+
+  // Reads after warming still return the original data.
+  RowID last_read_row_id = -1;
+  BatchHints hints = {};
+  auto out_rb = store_
+                    ->GetNextRowBatch(&last_read_row_id, &hints, std::nullopt,
+                                      std::vector<int64_t>{0, 1, 2})
+                    .ConsumeValueOrDie();
+  ASSERT_NE(nullptr, out_rb);
+  EXPECT_TRUE(out_rb->ColumnAt(2)->Equals(rb0.ColumnAt(2)));
+
+  FLAGS_table_store_compress_cold_batches = false;
+}
+
 TEST_P(HotStoreTest, PushRowBatchesCheckProperties) {
   std::vector<types::Time64NSValue> times = {1, 1, 10, 11};
   std::vector<types::BoolValue> bools = {true, false, true, false};
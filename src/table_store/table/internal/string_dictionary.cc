@@ -0,0 +1,149 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/table_store/table/internal/string_dictionary.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+#include <arrow/builder.h>
+
+#include "src/common/base/base.h"
+#include "src/shared/types/arrow_adapter.h"
+
+DEFINE_bool(table_store_dictionary_encode_strings,
+            gflags::BoolFromEnv("PL_TABLE_STORE_DICTIONARY_ENCODE_STRINGS", false),
+            "Whether to dictionary encode low-cardinality string columns when compacting them "
+            "into the cold store.");
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+StatusOr<ArrowArrayPtr> SharedStringDictionary::Encode(const ArrowArrayPtr& arr,
+                                                       arrow::MemoryPool* mem_pool) {
+  DCHECK_EQ(arr->type_id(), arrow::Type::STRING);
+  const auto* string_arr = static_cast<const arrow::StringArray*>(arr.get());
+  auto num_rows = string_arr->length();
+  if (num_rows == 0) {
+    return arr;
+  }
+
+  std::vector<int32_t> indices(num_rows);
+  size_t num_new_values = 0;
+  int64_t new_dict_bytes = 0;
+  for (int64_t i = 0; i < num_rows; ++i) {
+    auto view = string_arr->GetView(i);
+    const std::string_view value(view.data(), view.size());
+    auto it = value_to_index_.find(value);
+    if (it == value_to_index_.end()) {
+      values_.emplace_back(value);
+      it = value_to_index_
+               .emplace(std::string_view(values_.back()), static_cast<int32_t>(values_.size() - 1))
+               .first;
+      ++num_new_values;
+      new_dict_bytes += static_cast<int64_t>(value.size());
+    }
+    indices[i] = it->second;
+  }
+
+  // Marginal footprint comparison: the encoded batch costs an int32 index per row plus one copy
+  // of each value the shared dictionary hasn't seen before; the dense form costs an int32 offset
+  // per row plus every value byte. Encoding wins when the batch repeats values, either internally
+  // or across earlier batches sharing this dictionary.
+  int64_t dense_bytes = string_arr->value_offset(num_rows) - string_arr->value_offset(0) +
+                        num_rows * static_cast<int64_t>(sizeof(int32_t));
+  int64_t encoded_bytes = new_dict_bytes +
+                          static_cast<int64_t>(num_new_values) * sizeof(int32_t) +
+                          num_rows * static_cast<int64_t>(sizeof(int32_t));
+  if (encoded_bytes >= dense_bytes) {
+    // Not a win: roll the new values back out, so high-cardinality columns don't bloat the
+    // shared dictionary a little more on every compaction.
+    for (size_t i = 0; i < num_new_values; ++i) {
+      value_to_index_.erase(std::string_view(values_.back()));
+      values_.pop_back();
+    }
+    return arr;
+  }
+
+  if (num_new_values > 0 || dictionary_ == nullptr) {
+    dictionary_bytes_ += new_dict_bytes;
+    arrow::StringBuilder dict_builder(mem_pool);
+    PX_RETURN_IF_ERROR(dict_builder.Reserve(values_.size()));
+    PX_RETURN_IF_ERROR(dict_builder.ReserveData(dictionary_bytes_));
+    for (const auto& value : values_) {
+      dict_builder.UnsafeAppend(value.data(), value.size());
+    }
+    PX_RETURN_IF_ERROR(dict_builder.Finish(&dictionary_));
+  }
+
+  arrow::Int32Builder index_builder(mem_pool);
+  PX_RETURN_IF_ERROR(index_builder.Reserve(num_rows));
+  PX_RETURN_IF_ERROR(index_builder.AppendValues(indices));
+  std::shared_ptr<arrow::Array> index_arr;
+  PX_RETURN_IF_ERROR(index_builder.Finish(&index_arr));
+
+  auto result = arrow::DictionaryArray::FromArrays(arrow::dictionary(arrow::int32(), arrow::utf8()),
+                                                   index_arr, dictionary_);
+  if (!result.ok()) {
+    return error::Internal("Failed to dictionary encode string column: $0",
+                           result.status().message());
+  }
+
+  // Once the dictionary outgrows its budget, start fresh for later batches. Batches encoded
+  // before the reset keep their shared_ptr reference to the old dictionary array.
+  if (dictionary_bytes_ > kMaxDictionaryBytes) {
+    value_to_index_.clear();
+    values_.clear();
+    dictionary_bytes_ = 0;
+    dictionary_ = nullptr;
+  }
+
+  return ArrowArrayPtr(result.ValueOrDie());
+}
+
+StatusOr<ArrowArrayPtr> MaterializeDictionarySlice(const ArrowArrayPtr& arr, int64_t offset,
+                                                   int64_t length, arrow::MemoryPool* mem_pool) {
+  DCHECK_EQ(arr->type_id(), arrow::Type::DICTIONARY);
+  const auto* dict_arr = static_cast<const arrow::DictionaryArray*>(arr.get());
+  const auto* dict = static_cast<const arrow::StringArray*>(dict_arr->dictionary().get());
+  const auto* indices = static_cast<const arrow::Int32Array*>(dict_arr->indices().get());
+
+  int64_t data_bytes = 0;
+  for (int64_t i = offset; i < offset + length; ++i) {
+    data_bytes += dict->value_length(indices->Value(i));
+  }
+
+  arrow::StringBuilder builder(mem_pool);
+  PX_RETURN_IF_ERROR(builder.Reserve(length));
+  PX_RETURN_IF_ERROR(builder.ReserveData(data_bytes));
+  for (int64_t i = offset; i < offset + length; ++i) {
+    auto view = dict->GetView(indices->Value(i));
+    builder.UnsafeAppend(view.data(), view.size());
+  }
+  std::shared_ptr<arrow::Array> out;
+  PX_RETURN_IF_ERROR(builder.Finish(&out));
+  return ArrowArrayPtr(out);
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
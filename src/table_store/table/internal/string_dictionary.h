@@ -0,0 +1,97 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <arrow/array.h>
+#include <arrow/memory_pool.h>
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <absl/container/flat_hash_map.h>
+
+#include "src/common/base/base.h"
+#include "src/common/base/statusor.h"
+#include "src/table_store/table/internal/types.h"
+
+DECLARE_bool(table_store_dictionary_encode_strings);
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+/**
+ * SharedStringDictionary dictionary-encodes the string column of successive cold batches against
+ * a single dictionary that persists across batches. Values that repeat from batch to batch (HTTP
+ * header JSON, user agents, remote addresses) are then stored once per table rather than once per
+ * batch: every encoded batch's DictionaryArray holds a reference to the same dictionary array.
+ *
+ * One instance should be kept per string column (see ArrowArrayCompactor). The dictionary is
+ * reset once it exceeds kMaxDictionaryBytes; batches encoded before the reset keep their
+ * reference to the old dictionary, so they remain readable.
+ */
+class SharedStringDictionary {
+ public:
+  // Upper bound on the shared dictionary size. Resetting bounds both the dictionary rebuild cost
+  // per encoded batch and the memory pinned by a long-lived dictionary of stale values.
+  static constexpr int64_t kMaxDictionaryBytes = 4 * 1024 * 1024;
+
+  /**
+   * Encode dictionary-encodes the given dense string array if doing so reduces its memory
+   * footprint. The marginal cost of an encoded batch is an int32 index per row plus one copy of
+   * each value not already in the shared dictionary, so repetition across batches makes encoding
+   * cheaper over time. High-cardinality batches are returned unchanged and leave the dictionary
+   * untouched.
+   * @param arr the dense string array to encode.
+   * @param mem_pool arrow MemoryPool for the dictionary and index buffers.
+   * @return a DictionaryArray if encoding is a net win, otherwise the input array unchanged.
+   */
+  StatusOr<ArrowArrayPtr> Encode(const ArrowArrayPtr& arr, arrow::MemoryPool* mem_pool);
+
+  size_t num_values() const { return value_to_index_.size(); }
+  int64_t dictionary_bytes() const { return dictionary_bytes_; }
+
+ private:
+  // Distinct values in index order. A deque keeps element addresses stable, so the string_view
+  // keys in value_to_index_ remain valid as values are appended.
+  std::deque<std::string> values_;
+  absl::flat_hash_map<std::string_view, int32_t> value_to_index_;
+  int64_t dictionary_bytes_ = 0;
+  // The arrow dictionary array shared by all batches encoded since the last rebuild.
+  std::shared_ptr<arrow::Array> dictionary_;
+};
+
+/**
+ * MaterializeDictionarySlice decodes a row range of a dictionary-encoded string column back into
+ * a dense StringArray. Only the requested rows are materialized, so scans of encoded cold batches
+ * pay a copy proportional to the rows they actually read.
+ * @param arr a DictionaryArray with a string dictionary.
+ * @param offset first row to materialize.
+ * @param length number of rows to materialize.
+ * @param mem_pool arrow MemoryPool for the output array.
+ * @return a dense StringArray with the requested rows.
+ */
+StatusOr<ArrowArrayPtr> MaterializeDictionarySlice(const ArrowArrayPtr& arr, int64_t offset,
+                                                   int64_t length, arrow::MemoryPool* mem_pool);
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <memory>
+#include <vector>
+
+#include "src/common/testing/testing.h"
+#include "src/shared/types/arrow_adapter.h"
+#include "src/table_store/table/internal/string_dictionary.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+TEST(StringDictionaryTest, EncodeAndMaterializeRoundTrip) {
+  std::vector<types::StringValue> values;
+  for (int i = 0; i < 100; ++i) {
+    values.push_back(i % 2 == 0 ? "GET" : "POST");
+  }
+  auto dense = types::ToArrow(values, arrow::default_memory_pool());
+
+  SharedStringDictionary dict;
+  ASSERT_OK_AND_ASSIGN(auto encoded, dict.Encode(dense, arrow::default_memory_pool()));
+  ASSERT_EQ(encoded->type_id(), arrow::Type::DICTIONARY);
+  EXPECT_EQ(encoded->length(), dense->length());
+  EXPECT_EQ(dict.num_values(), 2);
+
+  ASSERT_OK_AND_ASSIGN(auto decoded, MaterializeDictionarySlice(encoded, 0, encoded->length(),
+                                                                arrow::default_memory_pool()));
+  EXPECT_TRUE(dense->Equals(decoded));
+}
+
+TEST(StringDictionaryTest, MaterializeSlice) {
+  std::vector<types::StringValue> values = {"a", "b", "a", "c", "b", "a"};
+  auto dense = types::ToArrow(values, arrow::default_memory_pool());
+  SharedStringDictionary dict;
+  ASSERT_OK_AND_ASSIGN(auto encoded, dict.Encode(dense, arrow::default_memory_pool()));
+  ASSERT_EQ(encoded->type_id(), arrow::Type::DICTIONARY);
+
+  ASSERT_OK_AND_ASSIGN(auto decoded,
+                       MaterializeDictionarySlice(encoded, 2, 3, arrow::default_memory_pool()));
+  EXPECT_TRUE(dense->Slice(2, 3)->Equals(decoded));
+}
+
+TEST(StringDictionaryTest, HighCardinalityStaysDense) {
+  // Every value distinct: encoding would only add index overhead, so the input is returned and
+  // the shared dictionary is left untouched.
+  std::vector<types::StringValue> values;
+  for (int i = 0; i < 100; ++i) {
+    values.push_back("unique_value_" + std::to_string(i));
+  }
+  auto dense = types::ToArrow(values, arrow::default_memory_pool());
+  SharedStringDictionary dict;
+  ASSERT_OK_AND_ASSIGN(auto encoded, dict.Encode(dense, arrow::default_memory_pool()));
+  EXPECT_EQ(encoded.get(), dense.get());
+  EXPECT_EQ(dict.num_values(), 0);
+  EXPECT_EQ(dict.dictionary_bytes(), 0);
+}
+
+TEST(StringDictionaryTest, DictionarySharedAcrossBatches) {
+  std::vector<types::StringValue> values;
+  for (int i = 0; i < 100; ++i) {
+    values.push_back(i % 2 == 0 ? "GET" : "POST");
+  }
+  auto dense1 = types::ToArrow(values, arrow::default_memory_pool());
+  auto dense2 = types::ToArrow(values, arrow::default_memory_pool());
+
+  SharedStringDictionary dict;
+  ASSERT_OK_AND_ASSIGN(auto encoded1, dict.Encode(dense1, arrow::default_memory_pool()));
+  ASSERT_OK_AND_ASSIGN(auto encoded2, dict.Encode(dense2, arrow::default_memory_pool()));
+  ASSERT_EQ(encoded1->type_id(), arrow::Type::DICTIONARY);
+  ASSERT_EQ(encoded2->type_id(), arrow::Type::DICTIONARY);
+
+  // Both batches repeat the same values, so they reference one dictionary array.
+  const auto* dict_arr1 = static_cast<const arrow::DictionaryArray*>(encoded1.get());
+  const auto* dict_arr2 = static_cast<const arrow::DictionaryArray*>(encoded2.get());
+  EXPECT_EQ(dict_arr1->dictionary().get(), dict_arr2->dictionary().get());
+  EXPECT_EQ(dict.num_values(), 2);
+
+  // Later batches with new values get a grown dictionary; earlier batches keep theirs.
+  std::vector<types::StringValue> values3;
+  for (int i = 0; i < 100; ++i) {
+    values3.push_back(i % 2 == 0 ? "GET" : "PUT");
+  }
+  auto dense3 = types::ToArrow(values3, arrow::default_memory_pool());
+  ASSERT_OK_AND_ASSIGN(auto encoded3, dict.Encode(dense3, arrow::default_memory_pool()));
+  ASSERT_EQ(encoded3->type_id(), arrow::Type::DICTIONARY);
+  EXPECT_EQ(dict.num_values(), 3);
+
+  ASSERT_OK_AND_ASSIGN(auto decoded3, MaterializeDictionarySlice(encoded3, 0, encoded3->length(),
+                                                                 arrow::default_memory_pool()));
+  EXPECT_TRUE(dense3->Equals(decoded3));
+  ASSERT_OK_AND_ASSIGN(auto decoded1, MaterializeDictionarySlice(encoded1, 0, encoded1->length(),
+                                                                 arrow::default_memory_pool()));
+  EXPECT_TRUE(dense1->Equals(decoded1));
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <arrow/array.h>
+#include <arrow/type.h>
 
 #include <deque>
 #include <memory>
@@ -26,6 +27,7 @@
 #include <variant>
 #include <vector>
 
+#include "src/common/base/base.h"
 #include "src/shared/types/column_wrapper.h"
 #include "src/shared/types/types.h"
 #include "src/table_store/schema/row_batch.h"
@@ -53,6 +55,8 @@ struct RecordBatchWithCache {
 enum StoreType {
   Hot,
   Cold,
+  // Cold batches that have been evicted from memory and serialized to mmap-backed spill files.
+  Spilled,
 };
 
 struct BatchHints {
@@ -60,10 +64,50 @@ struct BatchHints {
   BatchID batch_id;
 };
 
+/**
+ * ColumnZoneMap holds per-batch min/max statistics for a single numeric column, so that scans
+ * with a range predicate can skip batches whose value range doesn't overlap the predicate.
+ * Only INT64, TIME64NS and FLOAT64 columns carry zone maps; `valid` is false for other types.
+ */
+struct ColumnZoneMap {
+  bool valid = false;
+  // Populated for INT64 and TIME64NS columns.
+  int64_t min_int64 = 0;
+  int64_t max_int64 = 0;
+  // Populated for FLOAT64 columns.
+  double min_float64 = 0.0;
+  double max_float64 = 0.0;
+};
+
 class RecordOrRowBatch;
 
 using ColdBatch = std::vector<ArrowArrayPtr>;
 
+/**
+ * ArrowDataTypeFromColumnType maps a table column's DataType to the arrow DataType used for its
+ * dense cold representation. Used when reconstructing arrow arrays from raw buffers (e.g. after
+ * reading back a spilled or compressed cold batch).
+ */
+inline std::shared_ptr<arrow::DataType> ArrowDataTypeFromColumnType(types::DataType data_type) {
+  switch (data_type) {
+    case types::DataType::BOOLEAN:
+      return arrow::boolean();
+    case types::DataType::INT64:
+      return arrow::int64();
+    case types::DataType::UINT128:
+      return std::make_shared<arrow::UInt128Type>();
+    case types::DataType::FLOAT64:
+      return arrow::float64();
+    case types::DataType::TIME64NS:
+      return arrow::time64(arrow::TimeUnit::NANO);
+    case types::DataType::STRING:
+      return arrow::utf8();
+    default:
+      CHECK(false) << "Unsupported data type for dense cold storage: "
+                   << types::ToString(data_type);
+  }
+}
+
 template <StoreType type>
 struct StoreTypeTraits {};
 template <>
@@ -74,6 +118,11 @@ template <>
 struct StoreTypeTraits<StoreType::Cold> {
   using batch_type = ColdBatch;
 };
+template <>
+struct StoreTypeTraits<StoreType::Spilled> {
+  // Spilled batches are regular cold batches whose buffers are backed by mmap'd spill files.
+  using batch_type = ColdBatch;
+};
 
 }  // namespace internal
 }  // namespace table_store
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/table_store/table/memory_admission_controller.h"
+
+#include <vector>
+
+#include <absl/container/flat_hash_set.h>
+
+namespace px {
+namespace table_store {
+
+MemoryAdmissionController::MemoryAdmissionController(TableStore* table_store,
+                                                     int64_t total_budget_bytes,
+                                                     double rate_smoothing, double floor_fraction,
+                                                     double read_weight)
+    : table_store_(table_store),
+      total_budget_bytes_(total_budget_bytes),
+      rate_smoothing_(rate_smoothing),
+      floor_fraction_(floor_fraction),
+      read_weight_(read_weight) {
+  DCHECK_GT(total_budget_bytes_, 0);
+  DCHECK(rate_smoothing_ > 0.0 && rate_smoothing_ <= 1.0);
+  DCHECK(floor_fraction_ >= 0.0 && floor_fraction_ <= 1.0);
+  DCHECK_GE(read_weight_, 0.0);
+}
+
+void MemoryAdmissionController::Rebalance() {
+  auto tables = table_store_->GetTables();
+  if (tables.empty()) {
+    return;
+  }
+
+  struct Observation {
+    Table* table;
+    double score;
+  };
+  std::vector<Observation> observations;
+  observations.reserve(tables.size());
+  absl::flat_hash_set<const Table*> live_tables;
+  live_tables.reserve(tables.size());
+
+  double total_score = 0.0;
+  for (const auto& table : tables) {
+    live_tables.insert(table.get());
+    const auto stats = table->GetTableStats();
+
+    auto [it, inserted] = table_states_.try_emplace(table.get());
+    auto& state = it->second;
+    // A table seen for the first time has no baseline, so its counters only seed the next
+    // period's deltas rather than counting as a burst of traffic now.
+    double write_delta = 0.0;
+    double read_delta = 0.0;
+    if (!inserted) {
+      write_delta = static_cast<double>(stats.bytes_added - state.prev_bytes_added);
+      read_delta = static_cast<double>(stats.bytes_read - state.prev_bytes_read);
+    }
+    state.prev_bytes_added = stats.bytes_added;
+    state.prev_bytes_read = stats.bytes_read;
+    state.write_rate_ewma =
+        rate_smoothing_ * write_delta + (1.0 - rate_smoothing_) * state.write_rate_ewma;
+    state.read_rate_ewma =
+        rate_smoothing_ * read_delta + (1.0 - rate_smoothing_) * state.read_rate_ewma;
+
+    const double score = state.write_rate_ewma + read_weight_ * state.read_rate_ewma;
+    total_score += score;
+    observations.push_back(Observation{table.get(), score});
+  }
+
+  // Drop state for tables that are no longer in the store.
+  for (auto it = table_states_.begin(); it != table_states_.end();) {
+    if (!live_tables.contains(it->first)) {
+      table_states_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+
+  // Every table keeps an even share of the floor; the rest of the envelope is divided in
+  // proportion to demand. With no observed demand anywhere the whole envelope is split evenly.
+  const double num_tables = static_cast<double>(observations.size());
+  const double floor_per_table = floor_fraction_ * static_cast<double>(total_budget_bytes_) /
+                                 num_tables;
+  const double demand_pool =
+      static_cast<double>(total_budget_bytes_) - floor_per_table * num_tables;
+  for (const auto& obs : observations) {
+    const double demand_share =
+        total_score > 0.0 ? demand_pool * (obs.score / total_score) : demand_pool / num_tables;
+    obs.table->SetMaxTableSize(static_cast<int64_t>(floor_per_table + demand_share));
+  }
+}
+
+}  // namespace table_store
+}  // namespace px
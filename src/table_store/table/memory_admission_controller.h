@@ -0,0 +1,96 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <absl/container/flat_hash_map.h>
+
+#include "src/table_store/table/table_store.h"
+
+namespace px {
+namespace table_store {
+
+/**
+ * MemoryAdmissionController coordinates retention budgets across all tables in a TableStore,
+ * within a fixed total memory envelope. Tables are otherwise created with a static per-table
+ * limit, so a bursty table (e.g. http_events) expires data aggressively while a quiet one (e.g.
+ * stack traces) sits far under its quota. The controller periodically redistributes the envelope
+ * in proportion to each table's observed demand, so retention goes to the tables whose data is
+ * actually arriving and being queried.
+ *
+ * Demand is measured from each table's cumulative byte counters (which are maintained by
+ * BatchSizeAccountant on the write path and by cursor reads): the per-period deltas of bytes
+ * written and bytes read are smoothed with an exponential moving average, and a table's share of
+ * the envelope above a fixed floor is its share of the summed demand scores. Read traffic is
+ * weighted above write traffic, since bytes that queries come back for are direct evidence of
+ * useful retention. The floor guarantees that a currently-idle table keeps enough budget to
+ * absorb new data until the next rebalance notices it.
+ *
+ * Rebalance() should be called periodically from a single thread (e.g. alongside the background
+ * compaction tick); it is not safe to call concurrently with itself. Shrinking a table's budget
+ * never evicts data immediately, it only lowers the threshold that the table's next write
+ * enforces.
+ */
+class MemoryAdmissionController {
+ public:
+  // Smoothing factor for the per-period rate EWMAs. Higher values react faster to traffic
+  // changes, lower values resist thrashing budgets back and forth between bursty tables.
+  static constexpr double kDefaultRateSmoothing = 0.3;
+  // Fraction of the envelope that is always divided evenly across tables, regardless of demand.
+  static constexpr double kDefaultFloorFraction = 0.25;
+  // Weight of read bytes relative to written bytes in a table's demand score.
+  static constexpr double kDefaultReadWeight = 2.0;
+
+  MemoryAdmissionController(TableStore* table_store, int64_t total_budget_bytes)
+      : MemoryAdmissionController(table_store, total_budget_bytes, kDefaultRateSmoothing,
+                                  kDefaultFloorFraction, kDefaultReadWeight) {}
+
+  MemoryAdmissionController(TableStore* table_store, int64_t total_budget_bytes,
+                            double rate_smoothing, double floor_fraction, double read_weight);
+
+  /**
+   * Rebalance recomputes every table's retention budget from the traffic observed since the
+   * previous call and applies it via Table::SetMaxTableSize. Until a table has been observed for
+   * a full period its demand is treated as zero, so a freshly created table starts at the evenly
+   * divided share of the envelope and earns more as traffic appears.
+   */
+  void Rebalance();
+
+ private:
+  struct TableState {
+    int64_t prev_bytes_added = 0;
+    int64_t prev_bytes_read = 0;
+    double write_rate_ewma = 0.0;
+    double read_rate_ewma = 0.0;
+  };
+
+  TableStore* const table_store_;
+  const int64_t total_budget_bytes_;
+  const double rate_smoothing_;
+  const double floor_fraction_;
+  const double read_weight_;
+
+  // Per-table rate tracking, keyed by table identity. Entries for tables no longer in the store
+  // are pruned on each Rebalance.
+  absl::flat_hash_map<const Table*, TableState> table_states_;
+};
+
+}  // namespace table_store
+}  // namespace px
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+#include "src/common/testing/testing.h"
+#include "src/table_store/schema/relation.h"
+#include "src/table_store/table/memory_admission_controller.h"
+#include "src/table_store/table/table_store.h"
+
+namespace px {
+namespace table_store {
+
+class MemoryAdmissionControllerTest : public ::testing::Test {
+ protected:
+  static constexpr int64_t kEnvelope = 64 * 1024;
+
+  void SetUp() override {
+    rel_ = schema::Relation({types::DataType::BOOLEAN, types::DataType::FLOAT64},
+                            {"col1", "col2"});
+    busy_table_ = Table::Create("busy_table", rel_);
+    idle_table_ = Table::Create("idle_table", rel_);
+    table_store_.AddTable(busy_table_, "busy_table");
+    table_store_.AddTable(idle_table_, "idle_table");
+  }
+
+  std::unique_ptr<types::ColumnWrapperRecordBatch> MakeBatch() {
+    std::vector<types::BoolValue> col1 = {true, false, true};
+    std::vector<types::Float64Value> col2 = {1.4, 6.2, 10.2};
+    auto wrapper_batch = std::make_unique<types::ColumnWrapperRecordBatch>();
+    auto col_wrapper1 = std::make_shared<types::BoolValueColumnWrapper>(3);
+    auto col_wrapper2 = std::make_shared<types::Float64ValueColumnWrapper>(3);
+    col_wrapper1->Clear();
+    col_wrapper1->AppendFromVector(col1);
+    col_wrapper2->Clear();
+    col_wrapper2->AppendFromVector(col2);
+    wrapper_batch->push_back(col_wrapper1);
+    wrapper_batch->push_back(col_wrapper2);
+    return wrapper_batch;
+  }
+
+  TableStore table_store_;
+  std::shared_ptr<Table> busy_table_;
+  std::shared_ptr<Table> idle_table_;
+  schema::Relation rel_;
+};
+
+TEST_F(MemoryAdmissionControllerTest, splits_evenly_without_traffic) {
+  MemoryAdmissionController controller(&table_store_, kEnvelope);
+
+  controller.Rebalance();
+
+  EXPECT_EQ(kEnvelope / 2, busy_table_->GetTableStats().max_table_size);
+  EXPECT_EQ(kEnvelope / 2, idle_table_->GetTableStats().max_table_size);
+}
+
+TEST_F(MemoryAdmissionControllerTest, reallocates_budget_toward_busy_table) {
+  MemoryAdmissionController controller(&table_store_, kEnvelope);
+  // First call seeds the per-table counter baselines.
+  controller.Rebalance();
+
+  // All write and read traffic goes to one table.
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_OK(busy_table_->TransferRecordBatch(MakeBatch()));
+  }
+  Table::Cursor cursor(busy_table_.get());
+  while (!cursor.Done()) {
+    EXPECT_OK(cursor.GetNextRowBatch({0, 1}));
+  }
+
+  controller.Rebalance();
+
+  const int64_t busy_budget = busy_table_->GetTableStats().max_table_size;
+  const int64_t idle_budget = idle_table_->GetTableStats().max_table_size;
+  EXPECT_GT(busy_budget, idle_budget);
+  // The idle table retains exactly its even share of the floor.
+  const int64_t floor_per_table =
+      static_cast<int64_t>(kEnvelope * MemoryAdmissionController::kDefaultFloorFraction / 2);
+  EXPECT_EQ(floor_per_table, idle_budget);
+  // The envelope is conserved, modulo integer rounding.
+  EXPECT_NEAR(kEnvelope, busy_budget + idle_budget, 2);
+
+  // When traffic moves to the other table, budget follows it.
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_OK(idle_table_->TransferRecordBatch(MakeBatch()));
+  }
+  controller.Rebalance();
+  EXPECT_GT(idle_table_->GetTableStats().max_table_size, idle_budget);
+  EXPECT_LT(busy_table_->GetTableStats().max_table_size, busy_budget);
+}
+
+}  // namespace table_store
+}  // namespace px
@@ -17,12 +17,15 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstddef>
 #include <iterator>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <string>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -30,6 +33,7 @@
 #include "internal/store_with_row_accounting.h"
 #include "src/common/base/base.h"
 #include "src/common/base/status.h"
+#include "src/common/system/numa.h"
 #include "src/shared/types/arrow_adapter.h"
 #include "src/shared/types/type_utils.h"
 #include "src/table_store/schema/relation.h"
@@ -45,6 +49,18 @@ DEFINE_int32(table_store_table_size_limit,
              "The maximal size a table allows. When the size grows beyond this limit, "
              "old data will be discarded.");
 
+DEFINE_bool(table_store_enable_cold_spill,
+            gflags::BoolFromEnv("PL_TABLE_STORE_ENABLE_COLD_SPILL", false),
+            "Whether cold batches evicted from memory should be spilled to mmap-backed files "
+            "instead of being discarded.");
+DEFINE_string(table_store_cold_spill_dir,
+              gflags::StringFromEnv("PL_TABLE_STORE_COLD_SPILL_DIR", "/tmp/px_table_store_spill"),
+              "The directory used to store spilled cold batches.");
+DEFINE_int64(table_store_max_spilled_size,
+             gflags::Int64FromEnv("PL_TABLE_STORE_MAX_SPILLED_SIZE", 1024LL * 1024 * 1024),
+             "The maximal on-disk size of spilled cold batches per table. When the size grows "
+             "beyond this limit, the oldest spill files are deleted.");
+
 namespace px {
 namespace table_store {
 
@@ -151,6 +167,50 @@ bool Table::Cursor::Done() {
 
 void Table::Cursor::UpdateStopSpec(Cursor::StopSpec stop) { StopStateFromSpec(std::move(stop)); }
 
+Table::Cursor::Cursor(const Table* table, RowID last_read_row_id, StopState stop)
+    : table_(table),
+      hints_(internal::BatchHints{}),
+      last_read_row_id_(last_read_row_id),
+      stop_(std::move(stop)) {}
+
+std::vector<std::unique_ptr<Table::Cursor>> Table::Cursor::Split(size_t num_shards) {
+  std::vector<std::unique_ptr<Cursor>> shards;
+  if (num_shards == 0) {
+    return shards;
+  }
+  // Cursors whose stop position isn't determined yet have no known range to divide up.
+  if (stop_.spec.type == StopSpec::StopType::Infinite ||
+      (stop_.spec.type == StopSpec::StopType::StopAtTime && !stop_.stop_row_id_final)) {
+    return shards;
+  }
+  const RowID next_row_id = last_read_row_id_ + 1;
+  if (next_row_id >= stop_.stop_row_id) {
+    return shards;
+  }
+  const uint64_t num_rows = stop_.stop_row_id - next_row_id;
+  const uint64_t actual_shards = std::min<uint64_t>(num_shards, num_rows);
+  const uint64_t rows_per_shard = num_rows / actual_shards;
+  const uint64_t remainder = num_rows % actual_shards;
+
+  RowID shard_start = next_row_id;
+  for (uint64_t i = 0; i < actual_shards; ++i) {
+    const uint64_t shard_rows = rows_per_shard + (i < remainder ? 1 : 0);
+    StopState shard_stop;
+    // Shards stop at a fixed row id, which is exactly the stop state of a CurrentEndOfTable
+    // cursor after creation.
+    shard_stop.spec.type = StopSpec::StopType::CurrentEndOfTable;
+    shard_stop.stop_row_id = shard_start + shard_rows;
+    shard_stop.stop_row_id_final = true;
+    shards.push_back(
+        std::unique_ptr<Cursor>(new Cursor(table_, /*last_read_row_id*/ shard_start - 1,
+                                           std::move(shard_stop))));
+    shard_start += shard_rows;
+  }
+  // Exhaust this cursor, so that its remaining rows are only ever returned through the shards.
+  last_read_row_id_ = stop_.stop_row_id - 1;
+  return shards;
+}
+
 internal::RowID* Table::Cursor::LastReadRowID() { return &last_read_row_id_; }
 
 internal::BatchHints* Table::Cursor::Hints() { return &hints_; }
@@ -167,6 +227,8 @@ StatusOr<std::unique_ptr<schema::RowBatch>> Table::Cursor::GetNextRowBatch(
   return table_->GetNextRowBatch(this, cols);
 }
 
+Status Table::Cursor::SkipNextRowBatch() { return table_->SkipNextRowBatch(this); }
+
 Table::Table(std::string_view table_name, const schema::Relation& relation, size_t max_table_size,
              size_t compacted_batch_size)
     : metrics_(&(GetMetricsRegistry()), std::string(table_name)),
@@ -187,6 +249,17 @@ Table::Table(std::string_view table_name, const schema::Relation& relation, size
       rel_, time_col_idx_);
   cold_store_ = std::make_unique<internal::StoreWithRowTimeAccounting<internal::StoreType::Cold>>(
       rel_, time_col_idx_);
+  if (FLAGS_table_store_enable_cold_spill) {
+    absl::base_internal::SpinLockHolder spilled_lock(&spilled_lock_);
+    // Tablets of the same table share a name, so disambiguate spill files with an instance id.
+    static std::atomic<int64_t> table_instance_id = 0;
+    spilled_store_ =
+        std::make_unique<internal::StoreWithRowTimeAccounting<internal::StoreType::Spilled>>(
+            rel_, time_col_idx_);
+    spill_files_ = std::make_unique<internal::SpilledBatchStore>(
+        FLAGS_table_store_cold_spill_dir,
+        absl::StrFormat("%s_%d", table_name, table_instance_id.fetch_add(1)));
+  }
 }
 
 Status Table::ToProto(table_store::schemapb::Table* table_proto) const {
@@ -212,6 +285,15 @@ Status Table::ToProto(table_store::schemapb::Table* table_proto) const {
 StatusOr<std::unique_ptr<schema::RowBatch>> Table::GetNextRowBatch(
     Cursor* cursor, const std::vector<int64_t>& cols) const {
   DCHECK(!cursor->Done()) << "Calling GetNextRowBatch on an exhausted Cursor";
+  if (ABSL_TS_UNCHECKED_READ(spilled_store_) != nullptr) {
+    absl::base_internal::SpinLockHolder spilled_lock(&spilled_lock_);
+    PX_ASSIGN_OR_RETURN(auto spilled_rb,
+                        spilled_store_->GetNextRowBatch(cursor->LastReadRowID(), cursor->Hints(),
+                                                        cursor->StopRowID(), cols));
+    if (spilled_rb != nullptr) {
+      return spilled_rb;
+    }
+  }
   absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
   PX_ASSIGN_OR_RETURN(auto rb,
                       cold_store_->GetNextRowBatch(cursor->LastReadRowID(), cursor->Hints(),
@@ -234,20 +316,62 @@ StatusOr<std::unique_ptr<schema::RowBatch>> Table::GetNextRowBatch(
   if (rb == nullptr) {
     return error::InvalidArgument("Data after Cursor is not in the table.");
   }
+  batches_read_.fetch_add(1, std::memory_order_relaxed);
+  bytes_read_.fetch_add(rb->NumBytes(), std::memory_order_relaxed);
   return rb;
 }
 
+Status Table::SkipNextRowBatch(Cursor* cursor) const {
+  DCHECK(!cursor->Done()) << "Calling SkipNextRowBatch on an exhausted Cursor";
+  if (ABSL_TS_UNCHECKED_READ(spilled_store_) != nullptr) {
+    absl::base_internal::SpinLockHolder spilled_lock(&spilled_lock_);
+    if (spilled_store_->SkipNextRowBatch(cursor->LastReadRowID(), cursor->Hints(),
+                                         cursor->StopRowID())) {
+      return Status::OK();
+    }
+  }
+  absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
+  if (cold_store_->SkipNextRowBatch(cursor->LastReadRowID(), cursor->Hints(),
+                                    cursor->StopRowID())) {
+    return Status::OK();
+  }
+  absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
+  if (hot_store_->SkipNextRowBatch(cursor->LastReadRowID(), cursor->Hints(),
+                                   cursor->StopRowID())) {
+    return Status::OK();
+  }
+  if (hot_store_->Size() > 0) {
+    // As in GetNextRowBatch, a cursor pointing at an expired row batch is moved up to the start
+    // of the table before retrying.
+    *cursor->LastReadRowID() = hot_store_->FirstRowID() - 1;
+    if (!cursor->Done() && hot_store_->SkipNextRowBatch(cursor->LastReadRowID(), cursor->Hints(),
+                                                        cursor->StopRowID())) {
+      return Status::OK();
+    }
+  }
+  return error::InvalidArgument("Data after Cursor is not in the table.");
+}
+
+int64_t Table::PrefetchTimeRange(Time start_time, Time stop_time) const {
+  // The cold lock is held for the whole warm-up, which decompresses at most a cache's worth of
+  // batches; this is the same order of work as a single cursor read of a compressed batch, and
+  // runs once per query rather than per read.
+  absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
+  return static_cast<int64_t>(cold_store_->WarmTimeRange(start_time, stop_time));
+}
+
 Status Table::ExpireRowBatches(int64_t row_batch_size) {
-  if (row_batch_size > max_table_size_) {
+  const int64_t max_table_size = max_table_size_.load(std::memory_order_relaxed);
+  if (row_batch_size > max_table_size) {
     return error::InvalidArgument("RowBatch size ($0) is bigger than maximum table size ($1).",
-                                  row_batch_size, max_table_size_);
+                                  row_batch_size, max_table_size);
   }
   int64_t bytes;
   {
     absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
     bytes = batch_size_accountant_->HotBytes() + batch_size_accountant_->ColdBytes();
   }
-  while (bytes + row_batch_size > max_table_size_) {
+  while (bytes + row_batch_size > max_table_size) {
     PX_RETURN_IF_ERROR(ExpireBatch());
     {
       absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
@@ -262,12 +386,27 @@ Status Table::ExpireRowBatches(int64_t row_batch_size) {
   return Status::OK();
 }
 
+void Table::RecordWriterPlacement() {
+  int node = system::NumaTopology::GetInstance().NodeOfCurrentThread();
+  if (node < 0) {
+    return;
+  }
+  int expected = -1;
+  if (numa_home_node_.compare_exchange_strong(expected, node, std::memory_order_relaxed)) {
+    metrics_.numa_home_node_gauge.Set(node);
+  } else if (expected != node) {
+    metrics_.cross_numa_writes_counter.Increment();
+  }
+}
+
 Status Table::WriteRowBatch(const schema::RowBatch& rb) {
   // Don't write empty row batches.
   if (rb.num_columns() == 0 || rb.ColumnAt(0)->length() == 0) {
     return Status::OK();
   }
 
+  RecordWriterPlacement();
+
   internal::RecordOrRowBatch record_or_row_batch(rb);
 
   PX_RETURN_IF_ERROR(WriteHot(std::move(record_or_row_batch)));
@@ -281,6 +420,8 @@ Status Table::TransferRecordBatch(
     return Status::OK();
   }
 
+  RecordWriterPlacement();
+
   auto record_batch_w_cache = internal::RecordBatchWithCache{
       std::move(record_batch),
       std::vector<ArrowArrayPtr>(rel_.NumColumns()),
@@ -292,6 +433,89 @@ Status Table::TransferRecordBatch(
   return Status::OK();
 }
 
+std::unique_ptr<px::types::ColumnWrapperRecordBatch> Table::NewHotBatchBuffer(size_t reserve_rows) {
+  internal::RecordBatchPtr batch;
+  {
+    absl::base_internal::SpinLockHolder pool_lock(&pool_lock_);
+    if (!hot_batch_buffer_pool_.empty()) {
+      batch = std::move(hot_batch_buffer_pool_.front());
+      hot_batch_buffer_pool_.pop_front();
+    }
+  }
+  if (batch == nullptr) {
+    batch = std::make_unique<px::types::ColumnWrapperRecordBatch>();
+    batch->reserve(rel_.NumColumns());
+    for (const auto& col_type : rel_.col_types()) {
+      batch->push_back(px::types::ColumnWrapper::Make(col_type, 0));
+    }
+  }
+  for (const auto& col : *batch) {
+    col->Reserve(reserve_rows);
+  }
+  return batch;
+}
+
+void Table::RecycleHotBatchBuffer(internal::RecordBatchPtr buffer) {
+  if (buffer == nullptr) {
+    return;
+  }
+  // Clear retains the heap capacity of each column wrapper (modulo per-string storage), so the
+  // next producer to fill this buffer avoids re-growing the wrappers from scratch.
+  for (const auto& col : *buffer) {
+    col->Clear();
+  }
+  absl::base_internal::SpinLockHolder pool_lock(&pool_lock_);
+  if (hot_batch_buffer_pool_.size() >= kMaxPooledHotBatchBuffers) {
+    return;
+  }
+  hot_batch_buffer_pool_.push_back(std::move(buffer));
+}
+
+Table::SubscriptionID Table::Subscribe(SubscriptionCallback callback) {
+  absl::base_internal::SpinLockHolder lock(&subscribers_lock_);
+  auto id = next_subscription_id_++;
+  subscribers_.emplace_back(id, std::move(callback));
+  return id;
+}
+
+void Table::Unsubscribe(SubscriptionID subscription_id) {
+  absl::base_internal::SpinLockHolder lock(&subscribers_lock_);
+  subscribers_.erase(
+      std::remove_if(subscribers_.begin(), subscribers_.end(),
+                     [subscription_id](const auto& sub) { return sub.first == subscription_id; }),
+      subscribers_.end());
+}
+
+bool Table::HasSubscribers() const {
+  absl::base_internal::SpinLockHolder lock(&subscribers_lock_);
+  return !subscribers_.empty();
+}
+
+StatusOr<std::shared_ptr<const schema::RowBatch>> Table::MakeSubscriberBatch(
+    const internal::RecordOrRowBatch& batch) const {
+  std::vector<int64_t> all_cols(rel_.NumColumns());
+  std::iota(all_cols.begin(), all_cols.end(), 0);
+  auto rb =
+      std::make_shared<schema::RowBatch>(schema::RowDescriptor(rel_.col_types()), batch.Length());
+  PX_RETURN_IF_ERROR(batch.AddBatchSliceToRowBatch(0, batch.Length(), all_cols, rb.get()));
+  return std::shared_ptr<const schema::RowBatch>(std::move(rb));
+}
+
+void Table::NotifySubscribers(RowID first_row_id,
+                              const std::shared_ptr<const schema::RowBatch>& batch) {
+  std::vector<SubscriptionCallback> callbacks;
+  {
+    absl::base_internal::SpinLockHolder lock(&subscribers_lock_);
+    callbacks.reserve(subscribers_.size());
+    for (const auto& [id, callback] : subscribers_) {
+      callbacks.push_back(callback);
+    }
+  }
+  for (const auto& callback : callbacks) {
+    callback(first_row_id, batch);
+  }
+}
+
 Status Table::WriteHot(internal::RecordOrRowBatch&& record_or_row_batch) {
   // See BatchSizeAccountantNonMutableState for an explanation of the thread safety and necessity of
   // NonMutableState.
@@ -300,10 +524,21 @@ Status Table::WriteHot(internal::RecordOrRowBatch&& record_or_row_batch) {
 
   PX_RETURN_IF_ERROR(ExpireRowBatches(batch_stats.bytes));
 
+  // Subscribers get a read-only reference to the batch, which has to be built before the batch is
+  // moved into the hot store. Skipped entirely when nothing is subscribed; for record batches the
+  // arrow conversion it performs lands in the batch's arrow cache, where cursor reads would
+  // otherwise perform it.
+  std::shared_ptr<const schema::RowBatch> subscriber_batch;
+  if (HasSubscribers()) {
+    PX_ASSIGN_OR_RETURN(subscriber_batch, MakeSubscriberBatch(record_or_row_batch));
+  }
+
+  RowID first_row_id = 0;
   {
     absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
     auto batch_length = record_or_row_batch.Length();
     batch_size_accountant_->NewHotBatch(std::move(batch_stats));
+    first_row_id = next_row_id_;
     hot_store_->EmplaceBack(next_row_id_, std::move(record_or_row_batch));
     next_row_id_ += batch_length;
   }
@@ -318,10 +553,20 @@ Status Table::WriteHot(internal::RecordOrRowBatch&& record_or_row_batch) {
 
   // Make sure locks are released for this call, since they are reacquired inside.
   PX_RETURN_IF_ERROR(UpdateTableMetricGauges());
+
+  if (subscriber_batch != nullptr) {
+    NotifySubscribers(first_row_id, subscriber_batch);
+  }
   return Status::OK();
 }
 
 Table::RowID Table::FirstRowID() const {
+  if (ABSL_TS_UNCHECKED_READ(spilled_store_) != nullptr) {
+    absl::base_internal::SpinLockHolder spilled_lock(&spilled_lock_);
+    if (spilled_store_->Size() > 0) {
+      return spilled_store_->FirstRowID();
+    }
+  }
   absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
   if (cold_store_->Size() > 0) {
     return cold_store_->FirstRowID();
@@ -346,6 +591,15 @@ Table::RowID Table::LastRowID() const {
 }
 
 Table::Time Table::MaxTime() const {
+  // The spilled store holds the oldest rows, so its max time only matters if both the hot and
+  // cold stores are empty. It's checked first to maintain the spilled < cold < hot lock order.
+  Time spilled_max_time = -1;
+  if (ABSL_TS_UNCHECKED_READ(spilled_store_) != nullptr) {
+    absl::base_internal::SpinLockHolder spilled_lock(&spilled_lock_);
+    if (spilled_store_->Size() > 0) {
+      spilled_max_time = spilled_store_->MaxTime();
+    }
+  }
   absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
   absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
   if (hot_store_->Size() > 0) {
@@ -354,10 +608,17 @@ Table::Time Table::MaxTime() const {
   if (cold_store_->Size() > 0) {
     return cold_store_->MaxTime();
   }
-  return -1;
+  return spilled_max_time;
 }
 
 Table::RowID Table::FindRowIDFromTimeFirstGreaterThanOrEqual(Time time) const {
+  if (ABSL_TS_UNCHECKED_READ(spilled_store_) != nullptr) {
+    absl::base_internal::SpinLockHolder spilled_lock(&spilled_lock_);
+    auto spilled_row_id = spilled_store_->FindRowIDFromTimeFirstGreaterThanOrEqual(time);
+    if (spilled_row_id.has_value()) {
+      return spilled_row_id.value();
+    }
+  }
   absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
   auto optional_row_id = cold_store_->FindRowIDFromTimeFirstGreaterThanOrEqual(time);
   if (optional_row_id.has_value()) {
@@ -372,6 +633,13 @@ Table::RowID Table::FindRowIDFromTimeFirstGreaterThanOrEqual(Time time) const {
 }
 
 Table::RowID Table::FindRowIDFromTimeFirstGreaterThan(Time time) const {
+  if (ABSL_TS_UNCHECKED_READ(spilled_store_) != nullptr) {
+    absl::base_internal::SpinLockHolder spilled_lock(&spilled_lock_);
+    auto spilled_row_id = spilled_store_->FindRowIDFromTimeFirstGreaterThan(time);
+    if (spilled_row_id.has_value()) {
+      return spilled_row_id.value();
+    }
+  }
   absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
   auto optional_row_id = cold_store_->FindRowIDFromTimeFirstGreaterThan(time);
   if (optional_row_id.has_value()) {
@@ -385,6 +653,23 @@ Table::RowID Table::FindRowIDFromTimeFirstGreaterThan(Time time) const {
   return next_row_id_;
 }
 
+std::vector<Table::RowIDInterval> Table::RowIDIntervalsForInt64Range(int64_t col_idx,
+                                                                     int64_t min_val,
+                                                                     int64_t max_val) const {
+  DCHECK(rel_.GetColumnType(col_idx) == types::DataType::INT64 ||
+         rel_.GetColumnType(col_idx) == types::DataType::TIME64NS);
+  std::vector<RowIDInterval> intervals;
+  if (ABSL_TS_UNCHECKED_READ(spilled_store_) != nullptr) {
+    absl::base_internal::SpinLockHolder spilled_lock(&spilled_lock_);
+    intervals = spilled_store_->FindRowIDIntervalsOverlappingInt64Range(col_idx, min_val, max_val);
+  }
+  absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
+  auto cold_intervals =
+      cold_store_->FindRowIDIntervalsOverlappingInt64Range(col_idx, min_val, max_val);
+  intervals.insert(intervals.end(), cold_intervals.begin(), cold_intervals.end());
+  return intervals;
+}
+
 schema::Relation Table::GetRelation() const { return rel_; }
 
 TableStats Table::GetTableStats() const {
@@ -393,9 +678,15 @@ TableStats Table::GetTableStats() const {
   int64_t num_batches = 0;
   int64_t hot_bytes = 0;
   int64_t cold_bytes = 0;
+  if (ABSL_TS_UNCHECKED_READ(spilled_store_) != nullptr) {
+    absl::base_internal::SpinLockHolder spilled_lock(&spilled_lock_);
+    min_time = spilled_store_->MinTime();
+  }
   {
     absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
-    min_time = cold_store_->MinTime();
+    if (min_time == -1) {
+      min_time = cold_store_->MinTime();
+    }
     num_batches += cold_store_->Size();
     absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
     num_batches += hot_store_->Size();
@@ -410,12 +701,14 @@ TableStats Table::GetTableStats() const {
   info.batches_added = batches_added_;
   info.batches_expired = batches_expired_;
   info.bytes_added = bytes_added_;
+  info.batches_read = batches_read_.load(std::memory_order_relaxed);
+  info.bytes_read = bytes_read_.load(std::memory_order_relaxed);
   info.num_batches = num_batches;
   info.bytes = hot_bytes + cold_bytes;
   info.hot_bytes = hot_bytes;
   info.cold_bytes = cold_bytes;
   info.compacted_batches = compacted_batches_;
-  info.max_table_size = max_table_size_;
+  info.max_table_size = max_table_size_.load(std::memory_order_relaxed);
   info.min_time = min_time;
 
   return info;
@@ -435,6 +728,9 @@ Status Table::CompactSingleBatchUnlocked(arrow::MemoryPool*) {
 
     compactor_.UnsafeAppendBatchSlice(hot_store_->front(), hot_slice.start_row, hot_slice.end_row);
     if (hot_slice.last_slice_for_batch) {
+      // The batch's rows have been copied into the compactor's builders, so its column wrapper
+      // buffers can be recycled for future producers. See NewHotBatchBuffer.
+      RecycleHotBatchBuffer(hot_store_->front().ReleaseRecordBatch());
       hot_store_->PopFront();
     }
   }
@@ -457,12 +753,17 @@ Status Table::CompactSingleBatchUnlocked(arrow::MemoryPool*) {
 }
 
 Status Table::CompactHotToCold(arrow::MemoryPool* mem_pool) {
+  return CompactHotToCold(mem_pool, kMaxBatchesPerCompactionCall);
+}
+
+Status Table::CompactHotToCold(arrow::MemoryPool* mem_pool, int64_t max_cold_batches) {
   bool next_ready = false;
   {
     absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
     next_ready = batch_size_accountant_->CompactedBatchReady();
   }
-  while (next_ready) {
+  int64_t cold_batches_created = 0;
+  while (next_ready && cold_batches_created < max_cold_batches) {
     absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
     absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
     // We have to check CompactedBatchReady() again, in case hot batches were expired since the last
@@ -471,17 +772,59 @@ Status Table::CompactHotToCold(arrow::MemoryPool* mem_pool) {
       break;
     }
     PX_RETURN_IF_ERROR(CompactSingleBatchUnlocked(mem_pool));
+    cold_batches_created++;
     next_ready = batch_size_accountant_->CompactedBatchReady();
   }
   return Status::OK();
 }
 
 StatusOr<bool> Table::ExpireCold() {
+  if (ABSL_TS_UNCHECKED_READ(spilled_store_) != nullptr) {
+    return SpillColdBatch();
+  }
+  absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
+  if (cold_store_->Size() == 0) {
+    return false;
+  }
+  cold_store_->PopFront();
+  absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
+  batch_size_accountant_->ExpireColdBatch();
+  return true;
+}
+
+StatusOr<bool> Table::SpillColdBatch() {
+  absl::base_internal::SpinLockHolder spilled_lock(&spilled_lock_);
   absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
   if (cold_store_->Size() == 0) {
     return false;
   }
+  auto first_row_id = cold_store_->FirstRowID();
+  // DecompressedFront copies the batch (shared_ptrs only, unless columns were compressed, in which
+  // case they are decompressed here since spill files hold the dense representation).
+  auto batch_or_s = cold_store_->DecompressedFront();
   cold_store_->PopFront();
+  if (!batch_or_s.ok()) {
+    LOG(WARNING) << absl::StrFormat("Failed to decompress cold batch for spilling, discarding: %s",
+                                    batch_or_s.msg());
+    absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
+    batch_size_accountant_->ExpireColdBatch();
+    return true;
+  }
+  ColdBatch batch = batch_or_s.ConsumeValueOrDie();
+  auto spilled_or_s = spill_files_->Spill(rel_, batch);
+  if (spilled_or_s.ok()) {
+    spilled_store_->EmplaceBack(first_row_id, spilled_or_s.ConsumeValueOrDie());
+    // Keep the on-disk footprint bounded by dropping the oldest spill files.
+    while (spill_files_->SpilledBytes() > FLAGS_table_store_max_spilled_size &&
+           spilled_store_->Size() > 1) {
+      spilled_store_->PopFront();
+      spill_files_->DropOldest();
+    }
+  } else {
+    // If spilling fails (e.g. the spill disk is full), fall back to discarding the batch.
+    LOG(WARNING) << absl::StrFormat("Failed to spill cold batch, discarding it instead: %s",
+                                    spilled_or_s.msg());
+  }
   absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
   batch_size_accountant_->ExpireColdBatch();
   return true;
@@ -492,6 +835,7 @@ Status Table::ExpireHot() {
   if (hot_store_->Size() == 0) {
     return error::InvalidArgument("Failed to expire row batch, no row batches in table");
   }
+  RecycleHotBatchBuffer(hot_store_->front().ReleaseRecordBatch());
   hot_store_->PopFront();
   batch_size_accountant_->ExpireHotBatch();
   return Status::OK();
@@ -22,7 +22,9 @@
 #include <arrow/array.h>
 #include <arrow/record_batch.h>
 #include <algorithm>
+#include <atomic>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -44,11 +46,15 @@
 #include "src/table_store/table/internal/arrow_array_compactor.h"
 #include "src/table_store/table/internal/batch_size_accountant.h"
 #include "src/table_store/table/internal/record_or_row_batch.h"
+#include "src/table_store/table/internal/spilled_batch_store.h"
 #include "src/table_store/table/internal/store_with_row_accounting.h"
 #include "src/table_store/table/internal/types.h"
 #include "src/table_store/table/table_metrics.h"
 
 DECLARE_int32(table_store_table_size_limit);
+DECLARE_bool(table_store_enable_cold_spill);
+DECLARE_string(table_store_cold_spill_dir);
+DECLARE_int64(table_store_max_spilled_size);
 
 namespace px {
 namespace table_store {
@@ -63,6 +69,8 @@ struct TableStats {
   int64_t batches_added;
   int64_t batches_expired;
   int64_t bytes_added;
+  int64_t batches_read;
+  int64_t bytes_read;
   int64_t compacted_batches;
   int64_t max_table_size;
   int64_t min_time;
@@ -184,11 +192,29 @@ class Table : public NotCopyable {
     // is past the stopping condition. In this case `GetNextRowBatch(...)` will return an error.
     bool NextBatchReady();
     StatusOr<std::unique_ptr<schema::RowBatch>> GetNextRowBatch(const std::vector<int64_t>& cols);
+    // Advances the cursor past the batch that GetNextRowBatch would return, using only batch
+    // metadata (spilled and compressed cold batches are not loaded). Used by sampling scans.
+    Status SkipNextRowBatch();
     // In the case of StopType == Infinite, this function always returns false.
     bool Done();
     // Change the StopSpec of the cursor.
     void UpdateStopSpec(StopSpec stop);
 
+    /**
+     * Split divides the remaining rows of this cursor into up to `num_shards` independent cursors
+     * covering contiguous, disjoint row-id subranges, for exec threads to drain in parallel. Row
+     * ids are stable across compaction, so shard boundaries remain correct even if batches move
+     * from hot to cold mid-scan (shards that start or stop mid-batch get slices, as with any
+     * cursor). This cursor is exhausted by the call, so no row is ever returned by both it and a
+     * shard. Fewer than `num_shards` cursors are returned if fewer rows than shards remain.
+     * @param num_shards maximum number of shard cursors to create.
+     * @return the shard cursors, in row-id order. Empty if this cursor has no remaining rows, or
+     * if its stop position isn't yet determined (StopType::Infinite, or StopType::StopAtTime
+     * before the stop time is within the table), in which case callers should fall back to
+     * iterating this cursor directly.
+     */
+    std::vector<std::unique_ptr<Cursor>> Split(size_t num_shards);
+
    private:
     void AdvanceToStart(const StartSpec& start);
     void StopStateFromSpec(StopSpec&& stop);
@@ -206,6 +232,9 @@ class Table : public NotCopyable {
       // within the table. This bool keeps track of when that happens.
       bool stop_row_id_final = false;
     };
+
+    // Constructor for shard cursors created by Split, which start and stop at explicit row ids.
+    Cursor(const Table* table, RowID last_read_row_id, StopState stop);
     const Table* table_;
     internal::BatchHints hints_;
     RowID last_read_row_id_;
@@ -238,6 +267,25 @@ class Table : public NotCopyable {
   StatusOr<std::unique_ptr<schema::RowBatch>> GetNextRowBatch(
       Cursor* cursor, const std::vector<int64_t>& cols) const;
 
+  /**
+   * Advance the given cursor past the next data, without materializing it. Only batch metadata
+   * is touched, so skipping a spilled or compressed cold batch doesn't load or decompress it.
+   * @param cursor the Table::Cursor to advance.
+   */
+  Status SkipNextRowBatch(Cursor* cursor) const;
+
+  /**
+   * Warms the cold partition for a time-bounded scan, by decompressing the first cold batches
+   * overlapping the inclusive window [start_time, stop_time] into the decompressed-batch cache.
+   * Memory sources call this ahead of a scan, so the scan's first reads hit dense arrays
+   * instead of paying decompression on the query's critical path. Best-effort: a failure only
+   * means the scan decompresses on demand as usual.
+   * @param start_time inclusive lower bound of the scan's time window.
+   * @param stop_time inclusive upper bound of the scan's time window.
+   * @return the number of cold batches that were decompressed into the cache.
+   */
+  int64_t PrefetchTimeRange(Time start_time, Time stop_time) const;
+
   /**
    * Get the unique identifier of the first row in the table.
    * If all the data is expired from the table, this returns the last row id that was in the table.
@@ -268,6 +316,19 @@ class Table : public NotCopyable {
    */
   RowID FindRowIDFromTimeFirstGreaterThan(Time time) const;
 
+  /**
+   * Find the row-id intervals of cold (and spilled) batches that might contain values of the
+   * given INT64 or TIME64NS column within the inclusive range [min_val, max_val], based on the
+   * per-batch zone maps maintained at compaction time. Hot batches carry no zone maps, so callers
+   * must still scan the hot store. Intended for range-predicate pushdown into table scans.
+   * @param col_idx index of the column in the table's relation.
+   * @param min_val inclusive lower bound of the range.
+   * @param max_val inclusive upper bound of the range.
+   * @return row-id intervals of batches that may contain matching rows, in row-id order.
+   */
+  std::vector<RowIDInterval> RowIDIntervalsForInt64Range(int64_t col_idx, int64_t min_val,
+                                                         int64_t max_val) const;
+
   /**
    * Writes a row batch to the table.
    * @param rb Rowbatch to write to the table.
@@ -282,6 +343,17 @@ class Table : public NotCopyable {
    */
   Status TransferRecordBatch(std::unique_ptr<px::types::ColumnWrapperRecordBatch> record_batch);
 
+  /**
+   * Returns an empty ColumnWrapperRecordBatch, matching this table's relation, for a producer to
+   * fill and later pass back via `TransferRecordBatch`. Where possible, the batch is recycled from
+   * a pool of buffers whose rows have already been compacted into the cold store, so that its
+   * column wrappers retain their previous heap capacity. This avoids re-growing the wrappers from
+   * scratch on every batch on the write hot path.
+   * @param reserve_rows number of rows to reserve capacity for in each column wrapper.
+   * @return an empty record batch with one column wrapper per column in the table's relation.
+   */
+  std::unique_ptr<px::types::ColumnWrapperRecordBatch> NewHotBatchBuffer(size_t reserve_rows);
+
   schema::Relation GetRelation() const;
   StatusOr<std::vector<RecordBatchSPtr>> GetTableAsRecordBatches() const;
 
@@ -294,6 +366,23 @@ class Table : public NotCopyable {
 
   TableStats GetTableStats() const;
 
+  /**
+   * Update the table's retention budget. This only moves the threshold at which future writes
+   * expire old data; shrinking the budget does not evict anything immediately, the next write that
+   * pushes the table over the new limit does. Used by MemoryAdmissionController to reallocate
+   * budget between tables at runtime.
+   * @param max_table_size the new maximum number of bytes the table may hold.
+   */
+  void SetMaxTableSize(int64_t max_table_size) {
+    max_table_size_.store(max_table_size, std::memory_order_relaxed);
+  }
+
+  /**
+   * The NUMA node of the first thread to write to this table, or -1 before any write has been
+   * seen. Used by the exec engine to schedule readers near the table's data.
+   */
+  int numa_home_node() const { return numa_home_node_.load(std::memory_order_relaxed); }
+
   /**
    * Compacts hot batches into compacted_batch_size_ sized cold batches. Each call to
    * CompactHotToCold will create a maximum of kMaxBatchesPerCompactionCall cold batches.
@@ -301,9 +390,61 @@ class Table : public NotCopyable {
    */
   Status CompactHotToCold(arrow::MemoryPool* mem_pool);
 
+  /**
+   * Compacts hot batches into at most `max_cold_batches` cold batches. The hot and cold locks are
+   * only held for the duration of a single cold batch's compaction, so concurrent readers and
+   * writers are never blocked on a full compaction pass. Callers that want incremental compaction
+   * (e.g. a background compaction thread) should pass a small `max_cold_batches` and call this
+   * repeatedly.
+   * @param mem_pool arrow MemoryPool to be used for creating new cold batches.
+   * @param max_cold_batches maximum number of cold batches to create in this call.
+   */
+  Status CompactHotToCold(arrow::MemoryPool* mem_pool, int64_t max_cold_batches);
+
+  using SubscriptionID = int64_t;
+  /**
+   * Callback invoked for each batch written to the table. `first_row_id` is the table-unique id
+   * of the batch's first row (see `Time and Row Indexing` above); it orders notifications and is
+   * a resume point for a Cursor should a listener fall behind.
+   */
+  using SubscriptionCallback =
+      std::function<void(RowID first_row_id, const std::shared_ptr<const schema::RowBatch>& batch)>;
+
+  /**
+   * Subscribe registers a listener that is notified with a read-only reference to every batch
+   * written to the table, so standing queries can consume new data push-style instead of
+   * periodically polling a Cursor. Column data is shared with the table rather than copied:
+   * batches written as RowBatches share their arrow arrays directly, and batches transferred
+   * from Stirling are converted to arrow once, into the same per-batch cache that cursor reads
+   * use.
+   *
+   * Callbacks run on the writing thread, after the batch is in the table and with no table locks
+   * held, so listeners may read the table but must return quickly to avoid stalling the write
+   * path. Listeners that need to do real work should hand the batch reference off to their own
+   * executor; the reference keeps the column data alive even after the batch is expired from the
+   * table.
+   * @param callback the callback to invoke for each new batch.
+   * @return an id that can be passed to Unsubscribe to remove the listener.
+   */
+  SubscriptionID Subscribe(SubscriptionCallback callback);
+
+  /**
+   * Unsubscribe removes a listener previously registered with Subscribe. Notifications already
+   * in flight on writer threads may still be delivered while this call is in progress, but none
+   * will start after it returns.
+   * @param subscription_id the id returned by Subscribe.
+   */
+  void Unsubscribe(SubscriptionID subscription_id);
+
  private:
+  // Records the NUMA node of the calling (writer) thread. The first writer claims the home node;
+  // writes issued from any other node are counted as cross-node.
+  void RecordWriterPlacement();
+
   TableMetrics metrics_;
 
+  std::atomic<int> numa_home_node_{-1};
+
   schema::Relation rel_;
 
   mutable absl::base_internal::SpinLock stats_lock_;
@@ -311,7 +452,11 @@ class Table : public NotCopyable {
   int64_t batches_added_ ABSL_GUARDED_BY(stats_lock_) = 0;
   int64_t bytes_added_ ABSL_GUARDED_BY(stats_lock_) = 0;
   int64_t compacted_batches_ ABSL_GUARDED_BY(stats_lock_) = 0;
-  int64_t max_table_size_ = 0;
+  // Atomic (rather than guarded by stats_lock_) so that cursor reads can bump the read counters
+  // and ExpireRowBatches can check the limit without taking the stats lock on hot paths.
+  mutable std::atomic<int64_t> batches_read_{0};
+  mutable std::atomic<int64_t> bytes_read_{0};
+  std::atomic<int64_t> max_table_size_{0};
   const int64_t compacted_batch_size_;
   mutable absl::base_internal::SpinLock hot_lock_;
   std::unique_ptr<internal::StoreWithRowTimeAccounting<internal::StoreType::Hot>> hot_store_
@@ -322,16 +467,54 @@ class Table : public NotCopyable {
       ABSL_GUARDED_BY(cold_lock_);
   std::deque<int64_t> cold_batch_bytes_ ABSL_GUARDED_BY(cold_lock_);
 
+  // Spilled tier below the cold store, enabled via --table_store_enable_cold_spill. Cold batches
+  // that would otherwise be expired are serialized to mmap-backed spill files and remain readable
+  // through cursors at near-zero RAM cost. `spilled_lock_` must be acquired before `cold_lock_`.
+  mutable absl::base_internal::SpinLock spilled_lock_;
+  std::unique_ptr<internal::StoreWithRowTimeAccounting<internal::StoreType::Spilled>>
+      spilled_store_ ABSL_GUARDED_BY(spilled_lock_);
+  std::unique_ptr<internal::SpilledBatchStore> spill_files_ ABSL_GUARDED_BY(spilled_lock_);
+
   // Counter to assign a unique row ID to each row. Synchronized by hot_lock_ since its only
   // accessed on a hot write.
   int64_t next_row_id_ ABSL_GUARDED_BY(hot_lock_) = 0;
   int64_t time_col_idx_ = -1;
 
+  // Maximum number of recycled hot batch buffers kept in `hot_batch_buffer_pool_`. Beyond this,
+  // retired buffers are simply destroyed.
+  static constexpr size_t kMaxPooledHotBatchBuffers = 16;
+
+  // Pool of ColumnWrapperRecordBatch buffers recycled after their rows were compacted or expired.
+  // See NewHotBatchBuffer. Guarded by its own lock so producers acquiring a buffer never contend
+  // with readers or writers; `pool_lock_` is only ever acquired after `hot_lock_` (on the recycle
+  // path) or on its own (on the acquire path).
+  mutable absl::base_internal::SpinLock pool_lock_;
+  std::deque<internal::RecordBatchPtr> hot_batch_buffer_pool_ ABSL_GUARDED_BY(pool_lock_);
+
+  // Listeners registered via Subscribe. The lock only guards the list itself; callbacks are
+  // invoked from a copy of the list, outside of any table locks.
+  mutable absl::base_internal::SpinLock subscribers_lock_;
+  SubscriptionID next_subscription_id_ ABSL_GUARDED_BY(subscribers_lock_) = 0;
+  std::vector<std::pair<SubscriptionID, SubscriptionCallback>> subscribers_
+      ABSL_GUARDED_BY(subscribers_lock_);
+
+  bool HasSubscribers() const;
+  StatusOr<std::shared_ptr<const schema::RowBatch>> MakeSubscriberBatch(
+      const internal::RecordOrRowBatch& batch) const;
+  void NotifySubscribers(RowID first_row_id,
+                         const std::shared_ptr<const schema::RowBatch>& batch);
+
   Status WriteHot(internal::RecordOrRowBatch&& record_or_row_batch);
 
+  // Clears the given buffer and returns it to `hot_batch_buffer_pool_` (or destroys it if the pool
+  // is full). Accepts nullptr (e.g. for hot batches wrapping a RowBatch), in which case it's a
+  // no-op.
+  void RecycleHotBatchBuffer(internal::RecordBatchPtr buffer);
+
   Status ExpireBatch();
   Status ExpireHot();
   StatusOr<bool> ExpireCold();
+  StatusOr<bool> SpillColdBatch();
   Status ExpireRowBatches(int64_t row_batch_size);
   Status CompactSingleBatchUnlocked(arrow::MemoryPool* mem_pool)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(cold_lock_) ABSL_EXCLUSIVE_LOCKS_REQUIRED(hot_lock_);
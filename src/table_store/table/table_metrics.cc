@@ -67,4 +67,15 @@ TableMetrics::TableMetrics(prometheus::Registry* registry, std::string table_nam
                              .Name("min_time")
                              .Help("The current retention window for data in this table")
                              .Register(*registry)
-                             .Add({{"name", table_name}})) {}
+                             .Add({{"name", table_name}})),
+      numa_home_node_gauge(prometheus::BuildGauge()
+                               .Name("table_numa_home_node")
+                               .Help("NUMA node of the first writer to the table; -1 if unknown")
+                               .Register(*registry)
+                               .Add({{"name", table_name}})),
+      cross_numa_writes_counter(
+          prometheus::BuildCounter()
+              .Name("table_cross_numa_writes")
+              .Help("Total writes to the table issued from a NUMA node other than its home node")
+              .Register(*registry)
+              .Add({{"name", table_name}})) {}
@@ -34,4 +34,6 @@ struct TableMetrics {
   prometheus::Counter& compacted_batches_counter;
   prometheus::Gauge& max_table_size_gauge;
   prometheus::Gauge& retention_ns_gauge;
+  prometheus::Gauge& numa_home_node_gauge;
+  prometheus::Counter& cross_numa_writes_counter;
 };
@@ -26,6 +26,7 @@ namespace px {
 namespace table_store {
 
 std::unique_ptr<std::unordered_map<std::string, schema::Relation>> TableStore::GetRelationMap() {
+  absl::MutexLock lock(&mu_);
   auto map = std::make_unique<RelationMap>();
   map->reserve(name_to_relation_map_.size());
   for (auto& [table_name, relation] : name_to_relation_map_) {
@@ -60,13 +61,21 @@ Status TableStore::AppendData(uint64_t table_id, types::TabletID tablet_id,
   Table* table = GetTable(table_id, tablet_id);
   // We create new tablets only if the table at `table_id` exists, otherwise errors out.
   if (table == nullptr) {
-    PX_ASSIGN_OR_RETURN(table, CreateNewTablet(table_id, tablet_id));
+    absl::MutexLock lock(&mu_);
+    // Re-check under the lock, in case another thread created the tablet in the meantime.
+    auto id_to_table_iter = id_to_table_map_.find(TableIDTablet{table_id, tablet_id});
+    if (id_to_table_iter != id_to_table_map_.end()) {
+      table = id_to_table_iter->second.get();
+    } else {
+      PX_ASSIGN_OR_RETURN(table, CreateNewTablet(table_id, tablet_id));
+    }
   }
   return table->TransferRecordBatch(std::move(record_batch));
 }
 
 table_store::Table* TableStore::GetTable(const std::string& table_name,
                                          const types::TabletID& tablet_id) const {
+  absl::MutexLock lock(&mu_);
   auto name_to_table_iter = name_to_table_map_.find(NameTablet{table_name, tablet_id});
   if (name_to_table_iter == name_to_table_map_.end()) {
     return nullptr;
@@ -76,6 +85,7 @@ table_store::Table* TableStore::GetTable(const std::string& table_name,
 
 table_store::Table* TableStore::GetTable(uint64_t table_id,
                                          const types::TabletID& tablet_id) const {
+  absl::MutexLock lock(&mu_);
   auto id_to_table_iter = id_to_table_map_.find(TableIDTablet{table_id, tablet_id});
   if (id_to_table_iter == id_to_table_map_.end()) {
     return nullptr;
@@ -116,6 +126,8 @@ void TableStore::AddTable(std::shared_ptr<table_store::Table> table, const std::
                           std::optional<uint64_t> table_id, const types::TabletID& tablet_id) {
   const auto& table_relation = table->GetRelation();
 
+  absl::MutexLock lock(&mu_);
+
   // Register the table by name.
   RegisterTableName(table_name, tablet_id, table_relation, table);
 
@@ -126,6 +138,7 @@ void TableStore::AddTable(std::shared_ptr<table_store::Table> table, const std::
 }
 
 Status TableStore::AddTableAlias(uint64_t table_id, const std::string& table_name) {
+  absl::MutexLock lock(&mu_);
   auto table_iter = name_to_table_map_.find({table_name, ""});
   if (table_iter == name_to_table_map_.end()) {
     return error::Internal(
@@ -147,10 +160,12 @@ Status TableStore::AddTableAlias(uint64_t table_id, const std::string& table_nam
 }
 
 Status TableStore::SchemaAsProto(schemapb::Schema* schema) const {
+  absl::MutexLock lock(&mu_);
   return schema::Schema::ToProto(schema, name_to_relation_map_);
 }
 
 std::vector<uint64_t> TableStore::GetTableIDs() const {
+  absl::MutexLock lock(&mu_);
   std::vector<uint64_t> ids;
   for (const auto& it : id_to_table_map_) {
     ids.emplace_back(it.first.table_id_);
@@ -159,11 +174,29 @@ std::vector<uint64_t> TableStore::GetTableIDs() const {
 }
 
 Status TableStore::RunCompaction(arrow::MemoryPool* mem_pool) {
-  for (const auto& it : name_to_table_map_) {
-    PX_RETURN_IF_ERROR(it.second->CompactHotToCold(mem_pool));
+  // Compact a snapshot of the tables, so the store's lock is not held during compaction.
+  for (const auto& table : GetTables()) {
+    PX_RETURN_IF_ERROR(table->CompactHotToCold(mem_pool));
+  }
+  return Status::OK();
+}
+
+Status TableStore::RunCompaction(arrow::MemoryPool* mem_pool, int64_t max_batches_per_table) {
+  for (const auto& table : GetTables()) {
+    PX_RETURN_IF_ERROR(table->CompactHotToCold(mem_pool, max_batches_per_table));
   }
   return Status::OK();
 }
 
+std::vector<std::shared_ptr<Table>> TableStore::GetTables() const {
+  absl::MutexLock lock(&mu_);
+  std::vector<std::shared_ptr<Table>> tables;
+  tables.reserve(name_to_table_map_.size());
+  for (const auto& it : name_to_table_map_) {
+    tables.push_back(it.second);
+  }
+  return tables;
+}
+
 }  // namespace table_store
 }  // namespace px
@@ -24,7 +24,9 @@
 #include <utility>
 #include <vector>
 
+#include <absl/base/thread_annotations.h>
 #include <absl/container/flat_hash_map.h>
+#include <absl/synchronization/mutex.h>
 
 #include "src/common/base/base.h"
 #include "src/shared/types/column_wrapper.h"
@@ -75,6 +77,10 @@ struct TableInfo {
 
 /**
  * TableStore keeps track of the tables in our system.
+ *
+ * Thread-safe: tables can be registered at runtime (e.g. dynamic tracepoint deployment) while
+ * other threads (query execution, background compaction) look tables up. Tables are never
+ * removed, so returned Table pointers remain valid for the lifetime of the store.
  */
 class TableStore {
  public:
@@ -158,6 +164,7 @@ class TableStore {
    * GetTableName returns the table name if the ID is found, else empty string.
    */
   std::string GetTableName(uint64_t id) const {
+    absl::MutexLock lock(&mu_);
     const auto& it = id_to_table_info_map_.find(id);
     if (it != id_to_table_info_map_.end()) {
       return it->second.table_name;
@@ -167,13 +174,27 @@ class TableStore {
 
   Status RunCompaction(arrow::MemoryPool* mem_pool);
 
+  /**
+   * RunCompaction with a bound on the amount of work performed per table. Each table creates at
+   * most `max_batches_per_table` cold batches before moving on, so a single call does a bounded
+   * compaction slice rather than a full pass.
+   */
+  Status RunCompaction(arrow::MemoryPool* mem_pool, int64_t max_batches_per_table);
+
+  /**
+   * GetTables returns a snapshot of all tables (across all tablets) currently in the store.
+   */
+  std::vector<std::shared_ptr<Table>> GetTables() const;
+
  private:
   void RegisterTableName(const std::string& table_name, const types::TabletID& tablet_id,
                          const schema::Relation& table_relation,
-                         std::shared_ptr<table_store::Table> table);
+                         std::shared_ptr<table_store::Table> table)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   void RegisterTableID(uint64_t table_id, TableInfo table_info, const types::TabletID& tablet_id,
-                       std::shared_ptr<table_store::Table> table);
+                       std::shared_ptr<table_store::Table> table)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   /**
    * Create a new tablet inside of the table with table_id
@@ -182,21 +203,26 @@ class TableStore {
    * @param tablet_id: the tablet to create for the tablet.
    * @return StatusOr<Table*>: the table object or an error if the table is nonexistant.
    */
-  StatusOr<Table*> CreateNewTablet(uint64_t table_id, const types::TabletID& tablet_id);
+  StatusOr<Table*> CreateNewTablet(uint64_t table_id, const types::TabletID& tablet_id)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   // The default value for tablets, when tablet is not specified.
   inline static types::TabletID kDefaultTablet = "";
+
+  // Guards the maps below. Held only for map operations, never while operating on a Table, so
+  // registration cannot block on a slow append or compaction.
+  mutable absl::Mutex mu_;
   // Map a name to a table.
-  absl::flat_hash_map<NameTablet, std::shared_ptr<Table>> name_to_table_map_;
+  absl::flat_hash_map<NameTablet, std::shared_ptr<Table>> name_to_table_map_ ABSL_GUARDED_BY(mu_);
   // Map an id to a table.
-  absl::flat_hash_map<TableIDTablet, std::shared_ptr<Table>> id_to_table_map_;
+  absl::flat_hash_map<TableIDTablet, std::shared_ptr<Table>> id_to_table_map_ ABSL_GUARDED_BY(mu_);
   // Mapping from name to relation for adding new tablets.
   // TODO(oazizi): value should likely be shared_ptr<schema::Relation> because the
   //               same information is in id_to_table_info_map_ TableInfo.
   //               Can avoid this copy.
-  absl::flat_hash_map<std::string, schema::Relation> name_to_relation_map_;
+  absl::flat_hash_map<std::string, schema::Relation> name_to_relation_map_ ABSL_GUARDED_BY(mu_);
   // Mapping from id to name and relation pair for adding new tablets.
-  absl::flat_hash_map<uint64_t, TableInfo> id_to_table_info_map_;
+  absl::flat_hash_map<uint64_t, TableInfo> id_to_table_info_map_ ABSL_GUARDED_BY(mu_);
 };
 
 }  // namespace table_store
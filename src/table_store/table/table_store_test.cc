@@ -20,6 +20,8 @@
 #include <google/protobuf/text_format.h>
 #include <google/protobuf/util/message_differencer.h>
 #include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
 #include <vector>
 
 #include "src/common/testing/testing.h"
@@ -94,6 +96,33 @@ TEST_F(TableStoreTest, get_table_ids) {
   EXPECT_THAT(table_store.GetTableIDs(), ::testing::UnorderedElementsAre(1, 20));
 }
 
+// Stresses runtime table registration (e.g. dynamic tracepoint deployment) against the
+// snapshotting reads used by the background compaction thread. TSAN builds verify the locking.
+TEST_F(TableStoreTest, concurrent_add_and_snapshot) {
+  auto table_store = TableStore();
+  constexpr int kNumTables = 500;
+  std::atomic<bool> done{false};
+
+  std::thread reader([&] {
+    while (!done) {
+      for (const auto& table : table_store.GetTables()) {
+        EXPECT_NE(table, nullptr);
+      }
+      table_store.GetTableIDs();
+    }
+  });
+
+  for (int i = 0; i < kNumTables; ++i) {
+    const std::string name = absl::StrCat("table", i);
+    table_store.AddTable(Table::Create(name, rel1), name, i);
+  }
+
+  done = true;
+  reader.join();
+
+  EXPECT_EQ(table_store.GetTables().size(), static_cast<size_t>(kNumTables));
+}
+
 TEST_F(TableStoreTest, table_id_aliasing) {
   auto table_store = TableStore();
 
@@ -204,6 +204,170 @@ TEST(TableTest, bytes_test_w_compaction) {
   EXPECT_EQ(table.GetTableStats().bytes, rb1_size + rb2_size + rb3_size);
 }
 
+TEST(TableTest, bounded_compaction_test) {
+  auto rd = schema::RowDescriptor({types::DataType::INT64, types::DataType::STRING});
+  schema::Relation rel(rd.types(), {"col1", "col2"});
+
+  schema::RowBatch rb1(rd, 3);
+  std::vector<types::Int64Value> col1_rb1 = {4, 5, 10};
+  std::vector<types::StringValue> col2_rb1 = {"hello", "abc", "defg"};
+  auto col1_rb1_arrow = types::ToArrow(col1_rb1, arrow::default_memory_pool());
+  auto col2_rb1_arrow = types::ToArrow(col2_rb1, arrow::default_memory_pool());
+  EXPECT_OK(rb1.AddColumn(col1_rb1_arrow));
+  EXPECT_OK(rb1.AddColumn(col2_rb1_arrow));
+  int64_t rb1_size = 3 * sizeof(int64_t) + 12 * sizeof(char) + 3 * sizeof(uint32_t);
+
+  // Make the minimum cold batch size a single row batch, so that each written batch makes another
+  // compacted batch ready.
+  std::shared_ptr<Table> table_ptr = std::make_shared<Table>("test_table", rel, 128 * 1024, rb1_size);
+  Table& table = *table_ptr;
+
+  EXPECT_OK(table.WriteRowBatch(rb1));
+  EXPECT_OK(table.WriteRowBatch(rb1));
+  EXPECT_OK(table.WriteRowBatch(rb1));
+  EXPECT_OK(table.WriteRowBatch(rb1));
+
+  // A bounded compaction call should create exactly one cold batch, even though more are ready.
+  EXPECT_OK(table.CompactHotToCold(arrow::default_memory_pool(), 1));
+  EXPECT_EQ(table.GetTableStats().compacted_batches, 1);
+
+  // The unbounded call compacts everything that is ready.
+  EXPECT_OK(table.CompactHotToCold(arrow::default_memory_pool()));
+  EXPECT_GE(table.GetTableStats().compacted_batches, 3);
+}
+
+TEST(TableTest, hot_batch_buffer_pool_test) {
+  auto rd = schema::RowDescriptor({types::DataType::INT64, types::DataType::STRING});
+  schema::Relation rel(rd.types(), {"col1", "col2"});
+
+  int64_t batch_size = 3 * sizeof(int64_t) + 12 * sizeof(char) + 3 * sizeof(uint32_t);
+  // Make the minimum cold batch size a single record batch, so that compaction fully consumes
+  // (and can recycle) each hot batch buffer.
+  std::shared_ptr<Table> table_ptr =
+      std::make_shared<Table>("test_table", rel, 128 * 1024, batch_size);
+  Table& table = *table_ptr;
+
+  auto write_pooled_batch = [&]() {
+    auto wrapper_batch = table.NewHotBatchBuffer(/*reserve_rows*/ 3);
+    ASSERT_EQ(2, wrapper_batch->size());
+    ASSERT_EQ(0, wrapper_batch->at(0)->Size());
+    static_cast<types::Int64ValueColumnWrapper*>(wrapper_batch->at(0).get())
+        ->AppendFromVector(std::vector<types::Int64Value>{4, 5, 10});
+    static_cast<types::StringValueColumnWrapper*>(wrapper_batch->at(1).get())
+        ->AppendFromVector(std::vector<types::StringValue>{"hello", "abc", "defg"});
+    EXPECT_OK(table.TransferRecordBatch(std::move(wrapper_batch)));
+  };
+
+  // Buffers handed back by NewHotBatchBuffer must be empty and round-trip through
+  // TransferRecordBatch, whether they are freshly created or recycled after compaction.
+  write_pooled_batch();
+  EXPECT_OK(table.CompactHotToCold(arrow::default_memory_pool()));
+  EXPECT_EQ(table.GetTableStats().compacted_batches, 1);
+  write_pooled_batch();
+  EXPECT_OK(table.CompactHotToCold(arrow::default_memory_pool()));
+  EXPECT_EQ(table.GetTableStats().compacted_batches, 2);
+
+  auto cursor = Table::Cursor(table_ptr.get());
+  auto rb = cursor.GetNextRowBatch(std::vector<int64_t>{0, 1}).ConsumeValueOrDie();
+  EXPECT_TRUE(rb->ColumnAt(0)->Equals(
+      types::ToArrow(std::vector<types::Int64Value>{4, 5, 10}, arrow::default_memory_pool())));
+}
+
+TEST(TableTest, split_cursor_test) {
+  auto rd = schema::RowDescriptor({types::DataType::INT64, types::DataType::STRING});
+  schema::Relation rel(rd.types(), {"col1", "col2"});
+
+  int64_t batch_size = 3 * sizeof(int64_t) + 12 * sizeof(char) + 3 * sizeof(uint32_t);
+  std::shared_ptr<Table> table_ptr =
+      std::make_shared<Table>("test_table", rel, 128 * 1024, batch_size);
+  Table& table = *table_ptr;
+
+  schema::RowBatch rb1(rd, 3);
+  std::vector<types::Int64Value> col1_rb1 = {4, 5, 10};
+  std::vector<types::StringValue> col2_rb1 = {"hello", "abc", "defg"};
+  EXPECT_OK(rb1.AddColumn(types::ToArrow(col1_rb1, arrow::default_memory_pool())));
+  EXPECT_OK(rb1.AddColumn(types::ToArrow(col2_rb1, arrow::default_memory_pool())));
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_OK(table.WriteRowBatch(rb1));
+  }
+  // Compact some of the batches into cold, so shards cross the hot/cold boundary.
+  EXPECT_OK(table.CompactHotToCold(arrow::default_memory_pool(), 2));
+
+  auto cursor = Table::Cursor(table_ptr.get());
+  auto shards = cursor.Split(3);
+  ASSERT_EQ(3, shards.size());
+  // The original cursor is exhausted by the split.
+  EXPECT_TRUE(cursor.Done());
+
+  // Draining the shards in order must return each of the 12 rows exactly once.
+  std::vector<types::Int64Value> drained;
+  for (auto& shard : shards) {
+    while (!shard->Done()) {
+      auto rb = shard->GetNextRowBatch(std::vector<int64_t>{0}).ConsumeValueOrDie();
+      auto arr = std::static_pointer_cast<arrow::Int64Array>(rb->ColumnAt(0));
+      for (int64_t i = 0; i < arr->length(); ++i) {
+        drained.emplace_back(arr->Value(i));
+      }
+    }
+  }
+  ASSERT_EQ(12, drained.size());
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_EQ(col1_rb1[j].val, drained[i * 3 + j].val);
+    }
+  }
+
+  // Infinite cursors have no known end, so they can't be split.
+  auto infinite_cursor = Table::Cursor(
+      table_ptr.get(), Table::Cursor::StartSpec{},
+      Table::Cursor::StopSpec{Table::Cursor::StopSpec::StopType::Infinite, /*stop_time*/ -1});
+  EXPECT_EQ(0, infinite_cursor.Split(3).size());
+}
+
+TEST(TableTest, skip_next_row_batch_test) {
+  auto rd = schema::RowDescriptor({types::DataType::INT64, types::DataType::STRING});
+  schema::Relation rel(rd.types(), {"col1", "col2"});
+
+  int64_t batch_size = 3 * sizeof(int64_t) + 12 * sizeof(char) + 3 * sizeof(uint32_t);
+  std::shared_ptr<Table> table_ptr =
+      std::make_shared<Table>("test_table", rel, 128 * 1024, batch_size);
+  Table& table = *table_ptr;
+
+  std::vector<types::StringValue> col2 = {"hello", "abc", "defg"};
+  for (int i = 0; i < 4; ++i) {
+    schema::RowBatch rb(rd, 3);
+    // Tag each batch's rows with the batch index so reads identify which batches were skipped.
+    std::vector<types::Int64Value> col1 = {i, i, i};
+    EXPECT_OK(rb.AddColumn(types::ToArrow(col1, arrow::default_memory_pool())));
+    EXPECT_OK(rb.AddColumn(types::ToArrow(col2, arrow::default_memory_pool())));
+    EXPECT_OK(table.WriteRowBatch(rb));
+  }
+  // Compact some of the batches into cold, so skips cross the hot/cold boundary.
+  EXPECT_OK(table.CompactHotToCold(arrow::default_memory_pool(), 2));
+
+  // Alternate read/skip: batches 0 and 2 are read, batches 1 and 3 are skipped.
+  auto cursor = Table::Cursor(table_ptr.get());
+  std::vector<int64_t> read_batch_tags;
+  while (!cursor.Done()) {
+    auto rb = cursor.GetNextRowBatch(std::vector<int64_t>{0}).ConsumeValueOrDie();
+    auto arr = std::static_pointer_cast<arrow::Int64Array>(rb->ColumnAt(0));
+    ASSERT_EQ(3, arr->length());
+    read_batch_tags.push_back(arr->Value(0));
+    if (!cursor.Done()) {
+      EXPECT_OK(cursor.SkipNextRowBatch());
+    }
+  }
+  EXPECT_EQ(std::vector<int64_t>({0, 2}), read_batch_tags);
+
+  // A skip before the first read starts the scan at the second batch.
+  auto offset_cursor = Table::Cursor(table_ptr.get());
+  EXPECT_OK(offset_cursor.SkipNextRowBatch());
+  auto rb = offset_cursor.GetNextRowBatch(std::vector<int64_t>{0}).ConsumeValueOrDie();
+  auto arr = std::static_pointer_cast<arrow::Int64Array>(rb->ColumnAt(0));
+  EXPECT_EQ(1, arr->Value(0));
+}
+
 TEST(TableTest, expiry_test) {
   auto rd = schema::RowDescriptor({types::DataType::INT64, types::DataType::STRING});
   schema::Relation rel(rd.types(), {"col1", "col2"});
@@ -1474,5 +1638,67 @@ INSTANTIATE_TEST_SUITE_P(CursorTableTestSuite, CursorTableTest,
                            return info.param.name;
                          });
 
+TEST(TableTest, subscribe_test) {
+  schema::Relation rel({types::DataType::BOOLEAN, types::DataType::INT64}, {"col1", "col2"});
+
+  std::shared_ptr<Table> table_ptr = Table::Create("test_table", rel);
+  Table& table = *table_ptr;
+
+  std::vector<int64_t> first_row_ids;
+  std::vector<std::shared_ptr<const schema::RowBatch>> batches;
+  auto sub_id = table.Subscribe(
+      [&](int64_t first_row_id, const std::shared_ptr<const schema::RowBatch>& batch) {
+        first_row_ids.push_back(first_row_id);
+        batches.push_back(batch);
+      });
+
+  // A RowBatch write: the subscriber's batch shares the writer's arrow arrays.
+  auto rb1 = schema::RowBatch(schema::RowDescriptor(rel.col_types()), 3);
+  std::vector<types::BoolValue> col1_in1 = {true, false, true};
+  std::vector<types::Int64Value> col2_in1 = {1, 2, 3};
+  auto col1_in1_arrow = types::ToArrow(col1_in1, arrow::default_memory_pool());
+  auto col2_in1_arrow = types::ToArrow(col2_in1, arrow::default_memory_pool());
+  EXPECT_OK(rb1.AddColumn(col1_in1_arrow));
+  EXPECT_OK(rb1.AddColumn(col2_in1_arrow));
+  EXPECT_OK(table.WriteRowBatch(rb1));
+
+  ASSERT_EQ(batches.size(), 1);
+  EXPECT_EQ(first_row_ids[0], 0);
+  EXPECT_EQ(batches[0]->num_rows(), 3);
+  // Zero-copy: the same underlying arrow data, not an equal copy.
+  EXPECT_EQ(batches[0]->ColumnAt(0).get(), col1_in1_arrow.get());
+  EXPECT_EQ(batches[0]->ColumnAt(1).get(), col2_in1_arrow.get());
+
+  // A record batch transfer (the Stirling write path).
+  std::vector<types::BoolValue> col1_in2 = {false, true};
+  std::vector<types::Int64Value> col2_in2 = {5, 6};
+  auto wrapper_batch = std::make_unique<types::ColumnWrapperRecordBatch>();
+  auto col_wrapper_1 = std::make_shared<types::BoolValueColumnWrapper>(2);
+  col_wrapper_1->Clear();
+  for (const auto& val : col1_in2) {
+    col_wrapper_1->Append(val);
+  }
+  auto col_wrapper_2 = std::make_shared<types::Int64ValueColumnWrapper>(2);
+  col_wrapper_2->Clear();
+  for (const auto& val : col2_in2) {
+    col_wrapper_2->Append(val);
+  }
+  wrapper_batch->push_back(col_wrapper_1);
+  wrapper_batch->push_back(col_wrapper_2);
+  EXPECT_OK(table.TransferRecordBatch(std::move(wrapper_batch)));
+
+  ASSERT_EQ(batches.size(), 2);
+  EXPECT_EQ(first_row_ids[1], 3);
+  EXPECT_TRUE(
+      batches[1]->ColumnAt(0)->Equals(types::ToArrow(col1_in2, arrow::default_memory_pool())));
+  EXPECT_TRUE(
+      batches[1]->ColumnAt(1)->Equals(types::ToArrow(col2_in2, arrow::default_memory_pool())));
+
+  // After unsubscribing, further writes don't notify.
+  table.Unsubscribe(sub_id);
+  EXPECT_OK(table.WriteRowBatch(rb1));
+  EXPECT_EQ(batches.size(), 2);
+}
+
 }  // namespace table_store
 }  // namespace px
@@ -17,6 +17,7 @@
  */
 
 #pragma once
+#include <chrono>
 #include <string>
 #include <vector>
 
@@ -24,6 +25,7 @@
 #include "src/carnot/udf/udf.h"
 #include "src/carnot/udfspb/udfs.pb.h"
 #include "src/common/base/base.h"
+#include "src/common/perf/profile_capture.h"
 #include "src/common/perf/tcmalloc.h"
 #include "src/common/system/proc_parser.h"
 #include "src/shared/types/typespb/types.pb.h"
@@ -120,6 +122,55 @@ class HeapGrowthStacksUDTF final : public carnot::udf::UDTF<HeapGrowthStacksUDTF
   }
 };
 
+/**
+ * Samples the CPU of every agent for the requested duration and returns the pprof-format
+ * profile per agent. This makes CPU profiles of production agents reachable through a regular
+ * script (like _HeapSample for memory), with no redeploy or file copying.
+ *
+ * Note that the query blocks for the profiling duration, so keep it short enough to stay within
+ * the query deadline.
+ */
+class CPUProfileUDTF final : public carnot::udf::UDTF<CPUProfileUDTF> {
+ public:
+  static constexpr int64_t kMaxSeconds = 60;
+
+  static constexpr auto Executor() { return carnot::udfspb::UDTFSourceExecutor::UDTF_ALL_AGENTS; }
+
+  static constexpr auto InitArgs() {
+    return MakeArray(UDTFArg::Make<types::DataType::INT64>(
+        "seconds", "Duration of the CPU profile in seconds", 15));
+  }
+
+  static constexpr auto OutputRelation() {
+    return MakeArray(ColInfo("asid", types::DataType::INT64, types::PatternType::GENERAL,
+                             "The short ID of the agent"),
+                     ColInfo("profile", types::DataType::STRING, types::PatternType::GENERAL,
+                             "The pprof-format CPU profile"));
+  }
+
+  Status Init(FunctionContext*, types::Int64Value seconds) {
+    if (seconds.val <= 0 || seconds.val > kMaxSeconds) {
+      return error::InvalidArgument("seconds must be in (0, $0], got: $1", kMaxSeconds,
+                                    seconds.val);
+    }
+    duration_ = std::chrono::seconds(seconds.val);
+    return Status::OK();
+  }
+
+  bool NextRecord(FunctionContext* ctx, RecordWriter* rw) {
+    auto profile_or_s = profiler::ProfileCapture::CPUProfile(duration_);
+
+    rw->Append<IndexOf("asid")>(ctx->metadata_state()->asid());
+    rw->Append<IndexOf("profile")>(profile_or_s.ok() ? profile_or_s.ConsumeValueOrDie()
+                                                     : profile_or_s.msg());
+
+    return false;
+  }
+
+ private:
+  std::chrono::milliseconds duration_;
+};
+
 class AgentProcStatusUDTF final : public carnot::udf::UDTF<AgentProcStatusUDTF> {
  public:
   using Config = system::Config;
@@ -43,6 +43,12 @@ DEFINE_int32(table_store_proc_exit_events_limit_bytes,
              gflags::Int32FromEnv("PL_TABLE_STORE_PROC_EXIT_EVENTS_LIMIT_BYTES", 10 * 1024 * 1024),
              "The maximum amount of data to store in the proc_exit_events table.");
 
+DEFINE_bool(table_store_admission_control,
+            gflags::BoolFromEnv("PL_TABLE_STORE_ADMISSION_CONTROL", true),
+            "Whether to periodically rebalance per-table retention budgets within the table store "
+            "data limit based on observed write and read traffic, instead of keeping the static "
+            "per-table limits assigned at startup.");
+
 namespace px {
 namespace vizier {
 namespace agent {
@@ -66,6 +72,19 @@ Status PEMManager::PostRegisterHookImpl() {
       std::bind(&px::md::AgentMetadataStateManager::CurrentAgentMetadataState, mds_manager()));
 
   PX_RETURN_IF_ERROR(InitSchemas());
+
+  if (FLAGS_table_store_admission_control) {
+    memory_admission_controller_ = std::make_unique<table_store::MemoryAdmissionController>(
+        table_store(), static_cast<int64_t>(FLAGS_table_store_data_limit) * 1024 * 1024);
+    admission_control_timer_ = dispatcher()->CreateTimer([this]() {
+      memory_admission_controller_->Rebalance();
+      if (admission_control_timer_) {
+        admission_control_timer_->EnableTimer(kMemoryAdmissionRebalancePeriod);
+      }
+    });
+    admission_control_timer_->EnableTimer(kMemoryAdmissionRebalancePeriod);
+  }
+
   PX_RETURN_IF_ERROR(stirling_->RunAsThread());
 
   auto execute_query_handler = std::make_shared<ExecuteQueryMessageHandler>(
@@ -27,6 +27,7 @@
 #include <prometheus/gauge.h>
 
 #include "src/stirling/stirling.h"
+#include "src/table_store/table/memory_admission_controller.h"
 #include "src/vizier/services/agent/pem/tracepoint_manager.h"
 #include "src/vizier/services/agent/shared/manager/manager.h"
 
@@ -38,6 +39,8 @@ namespace agent {
 
 constexpr auto kNodeMemoryCollectionPeriod = std::chrono::minutes(1);
 
+constexpr auto kMemoryAdmissionRebalancePeriod = std::chrono::minutes(1);
+
 class PEMManager : public Manager {
  public:
   template <typename... Args>
@@ -101,6 +104,12 @@ class PEMManager : public Manager {
   std::unique_ptr<stirling::Stirling> stirling_;
   std::shared_ptr<TracepointManager> tracepoint_manager_;
 
+  // Rebalances per-table retention budgets within the table store memory envelope. Only created
+  // when --table_store_admission_control is enabled.
+  std::unique_ptr<table_store::MemoryAdmissionController> memory_admission_controller_;
+  // Timer driving periodic MemoryAdmissionController rebalances.
+  px::event::TimerUPtr admission_control_timer_;
+
   // Timer for triggering ClockConverter polls.
   px::event::TimerUPtr clock_converter_timer_;
   // Timer for collecting info about the node's available memory.
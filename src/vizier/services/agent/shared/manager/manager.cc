@@ -32,6 +32,7 @@
 
 #include "src/common/base/base.h"
 #include "src/common/metrics/metrics.h"
+#include "src/common/metrics/sharded_metrics.h"
 #include "src/common/perf/perf.h"
 #include "src/vizier/funcs/context/vizier_context.h"
 #include "src/vizier/funcs/funcs.h"
@@ -62,6 +63,11 @@ DEFINE_string(jwt_signing_key, gflags::StringFromEnv("PL_JWT_SIGNING_KEY", ""),
 
 DEFINE_string(vizier_id, gflags::StringFromEnv("PL_VIZIER_ID", ""), "The ID of the cluster.");
 
+DEFINE_bool(table_store_background_compaction,
+            gflags::BoolFromEnv("PL_TABLE_STORE_BACKGROUND_COMPACTION", true),
+            "Whether to run table store compaction incrementally on a dedicated low-priority "
+            "thread instead of periodically on the event loop.");
+
 DEFINE_string(vizier_name, gflags::StringFromEnv("PL_VIZIER_NAME", ""),
               "The name of the cluster according to vizier.");
 
@@ -194,6 +200,9 @@ Status Manager::Stop(std::chrono::milliseconds timeout) {
   stop_called_ = true;
 
   dispatcher_->Stop();
+  // Stop the compaction thread before tearing down the rest of the manager, since it reads from
+  // the table store.
+  tablestore_compaction_manager_.reset();
   auto s = StopImpl(timeout);
 
   // Wait for a limited amount of time for main thread to stop processing.
@@ -324,17 +333,25 @@ Status Manager::PostRegisterHook(uint32_t asid) {
 
   PX_RETURN_IF_ERROR(metrics_nats_connector_->Connect(dispatcher_.get()));
 
-  tablestore_compaction_timer_ = dispatcher()->CreateTimer([this]() {
+  if (FLAGS_table_store_background_compaction) {
     // TODO(james): when we change ExecState::exec_mem_pool to not return just the default pool, we
     // will need to figure out how to use the correct memory pool here, but for now we can just use
     // the default pool.
-    auto status = table_store()->RunCompaction(arrow::default_memory_pool());
-    LOG_IF(ERROR, !status.ok()) << status.msg();
-    if (tablestore_compaction_timer_) {
-      tablestore_compaction_timer_->EnableTimer(kTableStoreCompactionPeriod);
-    }
-  });
-  tablestore_compaction_timer_->EnableTimer(kTableStoreCompactionPeriod);
+    tablestore_compaction_manager_ = std::make_unique<table_store::BackgroundCompactionManager>(
+        table_store(), arrow::default_memory_pool(),
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            kTableStoreBackgroundCompactionTickPeriod),
+        table_store::BackgroundCompactionManager::kDefaultBatchesPerTick);
+  } else {
+    tablestore_compaction_timer_ = dispatcher()->CreateTimer([this]() {
+      auto status = table_store()->RunCompaction(arrow::default_memory_pool());
+      LOG_IF(ERROR, !status.ok()) << status.msg();
+      if (tablestore_compaction_timer_) {
+        tablestore_compaction_timer_->EnableTimer(kTableStoreCompactionPeriod);
+      }
+    });
+    tablestore_compaction_timer_->EnableTimer(kTableStoreCompactionPeriod);
+  }
 
   memory_metrics_timer_ = dispatcher()->CreateTimer([this]() {
     memory_metrics_.MeasureMemory();
@@ -351,6 +368,8 @@ Status Manager::PostRegisterHook(uint32_t asid) {
       return;
     }
     auto& registry = GetMetricsRegistry();
+    // Fold thread-sharded hot-path metrics into their backing registry metrics before collecting.
+    FlushShardedMetrics();
     auto metrics = registry.Collect();
     int64_t timestamp_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
                                std::chrono::system_clock::now().time_since_epoch())
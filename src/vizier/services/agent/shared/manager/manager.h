@@ -32,6 +32,7 @@
 #include "src/common/metrics/memory_metrics.h"
 #include "src/common/uuid/uuid.h"
 #include "src/shared/metadata/metadata.h"
+#include "src/table_store/table/background_compaction.h"
 #include "src/vizier/funcs/context/vizier_context.h"
 #include "src/vizier/messages/messagespb/messages.pb.h"
 #include "src/vizier/services/agent/shared/base/base_manager.h"
@@ -64,6 +65,10 @@ constexpr auto kChanIdleGracePeriod = std::chrono::minutes(1);
 
 constexpr auto kTableStoreCompactionPeriod = std::chrono::minutes(1);
 
+// Period between incremental compaction slices when background compaction is enabled. Each slice
+// does a small bounded amount of work, so the period is much shorter than the full-pass period.
+constexpr auto kTableStoreBackgroundCompactionTickPeriod = std::chrono::seconds(5);
+
 constexpr auto kMemoryMetricsCollectPeriod = std::chrono::minutes(1);
 
 constexpr auto kMetricsPushPeriod = std::chrono::minutes(1);
@@ -210,8 +215,11 @@ class Manager : public BaseManager {
   // Factory context for vizier functions.
   funcs::VizierFuncFactoryContext func_context_;
 
-  // Timer to manage table store compaction.
+  // Timer to manage table store compaction. Only used when background compaction is disabled.
   px::event::TimerUPtr tablestore_compaction_timer_;
+  // Dedicated low-priority compaction thread, used when --table_store_background_compaction is
+  // enabled.
+  std::unique_ptr<table_store::BackgroundCompactionManager> tablestore_compaction_manager_;
 
   px::metrics::MemoryMetrics memory_metrics_;
   // Timer to collect MemoryMetrics for this agent.